@@ -0,0 +1,642 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_ASYNC_UFSTREAM_HPP
+#define BOOST_UNICODE_ASYNC_UFSTREAM_HPP
+
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <vector>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include "ustream.hpp"
+#include "utf8_count.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Asynchronous file output:
+	// The stream fills one block while a background thread writes the ones filled
+	// before it, so the thread putting characters only waits for the disk when every
+	// block is full and waiting to be written.
+	//================================================================================
+
+	class async_filebuf : public std::streambuf
+	{
+	public:
+		static const std::size_t default_block_size = 65536;
+
+		// max_blocks is the number of blocks in flight, counting the one being filled:
+		// 2 is double buffering, 3 triple buffering and so on.
+		async_filebuf(std::size_t _block_size=default_block_size, std::size_t _max_blocks=3)
+			: block_size(_block_size ? _block_size : 1), max_blocks(_max_blocks < 2 ? 2 : _max_blocks), stopping(false), failed(false)
+		{
+		}
+
+		~async_filebuf()
+		{
+			close();
+		}
+
+		async_filebuf* open(const char* filename)
+		{
+			if(is_open() || !file.open(filename, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary))
+				return 0;
+
+			blocks.assign(max_blocks, std::vector<char>(block_size));
+
+			for(std::size_t i=1; i < max_blocks; ++i)
+				free_blocks.push_back(&blocks[i][0]);
+
+			setp(&blocks[0][0], &blocks[0][0] + block_size);
+
+			stopping = false;
+			failed = false;
+			writer.reset(new boost::thread(&async_filebuf::write_blocks, this));
+
+			return this;
+		}
+
+		bool is_open() const
+		{
+			return writer.get() != 0;
+		}
+
+		// Write out everything and wait for the background thread to finish.
+		async_filebuf* close()
+		{
+			if(!is_open())
+				return 0;
+
+			bool ok = hand_over();
+
+			{
+				boost::unique_lock<boost::mutex> lock(mutex);
+				stopping = true;
+				filled.notify_one();
+			}
+
+			writer->join();
+			writer.reset();
+
+			setp(0, 0);
+			free_blocks.clear();
+			blocks.clear();
+
+			ok = file.close() && ok && !failed;
+			return ok ? this : 0;
+		}
+
+	protected:
+		int overflow(int c)
+		{
+			if(!is_open() || !hand_over())
+				return EOF;
+
+			if(c == EOF)
+				return 0;
+
+			*pptr() = (char)c;
+			pbump(1);
+			return c;
+		}
+
+		// Hand over what has been put so far and wait until it's all written to the file.
+		int sync()
+		{
+			if(!is_open())
+				return 0;
+
+			if(!hand_over())
+				return -1;
+
+			boost::unique_lock<boost::mutex> lock(mutex);
+
+			while(!full.empty())
+				freed.wait(lock);
+
+			// The writer is idle and can't start again without the lock, so the file is ours.
+			return file.pubsync() == 0 && !failed ? 0 : -1;
+		}
+
+	private:
+		typedef std::pair<char*, std::size_t> block;
+
+		// Queue the block being filled for writing and start filling a free one,
+		// waiting for the writer to free one if there aren't any.
+		bool hand_over()
+		{
+			boost::unique_lock<boost::mutex> lock(mutex);
+
+			if(pptr() != pbase())
+			{
+				full.push_back(block(pbase(), pptr() - pbase()));
+				filled.notify_one();
+
+				while(free_blocks.empty())
+					freed.wait(lock);
+
+				char* b = free_blocks.back();
+				free_blocks.pop_back();
+				setp(b, b + block_size);
+			}
+
+			return !failed;
+		}
+
+		// The background thread: write full blocks in order until told to stop.
+		void write_blocks()
+		{
+			boost::unique_lock<boost::mutex> lock(mutex);
+
+			for(;;)
+			{
+				while(full.empty() && !stopping)
+					filled.wait(lock);
+
+				if(full.empty())
+					break; // Stopping, and nothing left to write.
+
+				// The block stays in the queue while it's written, so an empty queue means everything is written.
+				block b = full.front();
+
+				lock.unlock();
+				bool ok = file.sputn(b.first, b.second) == (std::streamsize)b.second;
+				lock.lock();
+
+				full.pop_front();
+				free_blocks.push_back(b.first);
+
+				if(!ok)
+					failed = true;
+
+				freed.notify_all();
+			}
+		}
+
+		std::size_t block_size;
+		std::size_t max_blocks;
+		std::filebuf file;
+		std::vector<std::vector<char> > blocks; // Storage for every block.
+		std::deque<block> full; // Blocks waiting to be written, oldest first.
+		std::vector<char*> free_blocks; // Blocks that can be filled.
+		boost::scoped_ptr<boost::thread> writer;
+		boost::mutex mutex;
+		boost::condition_variable filled; // Signalled when a block is queued, or on close.
+		boost::condition_variable freed; // Signalled when a block has been written.
+		bool stopping;
+		bool failed;
+	};
+
+	// Unicode output file stream that writes in the background.
+	// flush() and close() wait until everything put so far is in the file.
+	template<class encoder_type>
+	class specific_async_uofstream : public specific_uostream<encoder_type>
+	{
+	private:
+		async_filebuf fb;
+		std::ostream fs;
+
+	public:
+		specific_async_uofstream(std::size_t block_size=async_filebuf::default_block_size, std::size_t max_blocks=3)
+			: specific_uostream<encoder_type>(&fs), fb(block_size, max_blocks), fs(&fb)
+		{
+		}
+
+		specific_async_uofstream(const char* filename, std::size_t block_size=async_filebuf::default_block_size, std::size_t max_blocks=3)
+			: specific_uostream<encoder_type>(&fs), fb(block_size, max_blocks), fs(&fb)
+		{
+			open(filename);
+		}
+
+		~specific_async_uofstream()
+		{
+			// fs and fb go before the encoder does, so its buffer has to be written now.
+			close();
+		}
+
+		void open(const char* filename)
+		{
+			if(fb.open(filename))
+				fs.clear();
+			else
+				fs.setstate(std::ios_base::failbit);
+		}
+
+		bool is_open() const
+		{
+			return fb.is_open();
+		}
+
+		void close()
+		{
+			if(fb.is_open())
+			{
+				this->flush();
+
+				if(!fb.close())
+					fs.setstate(std::ios_base::failbit);
+			}
+		}
+	};
+
+	//================================================================================
+	// Read-ahead file input:
+	// A background thread reads the blocks after the one being decoded, so reading
+	// and decoding overlap. It can also check that they are valid UTF-8 on the way.
+	//================================================================================
+
+	class prefetch_filebuf : public std::streambuf
+	{
+	public:
+		static const std::size_t default_block_size = 65536;
+		static const std::size_t putback_size = 16; // Bytes of the previous block kept for unget().
+
+		// max_blocks is the number of blocks in flight, counting the one being read from.
+		// If validate is set, the background thread checks blocks are valid UTF-8.
+		prefetch_filebuf(std::size_t _block_size=default_block_size, std::size_t _max_blocks=4, bool _validate=false)
+			: block_size(_block_size < 4 ? 4 : _block_size), max_blocks(_max_blocks < 2 ? 2 : _max_blocks), validate(_validate),
+			stopping(false), at_end(false), base_offset(0), next_offset(0), pending_skip(0), carry_size(0), carry_offset(0), invalid_offset(-1)
+		{
+			current.data = 0;
+		}
+
+		~prefetch_filebuf()
+		{
+			close();
+		}
+
+		prefetch_filebuf* open(const char* filename)
+		{
+			if(is_open() || !file.open(filename, std::ios_base::in | std::ios_base::binary))
+				return 0;
+
+			blocks.assign(max_blocks, std::vector<char>(putback_size + block_size));
+			invalid_offset = -1;
+			restart(0);
+
+			return this;
+		}
+
+		bool is_open() const
+		{
+			return reader.get() != 0;
+		}
+
+		prefetch_filebuf* close()
+		{
+			if(!is_open())
+				return 0;
+
+			stop();
+			setg(0, 0, 0);
+			current.data = 0;
+			full.clear();
+			free_blocks.clear();
+			blocks.clear();
+
+			return file.close() ? this : 0;
+		}
+
+		// Byte offset of the first malformed UTF-8 the background thread has come across,
+		// or -1 if it hasn't found any (or isn't validating). It may be ahead of the reader.
+		std::streamoff first_invalid()
+		{
+			boost::unique_lock<boost::mutex> lock(mutex);
+			return invalid_offset;
+		}
+
+	protected:
+		int_type underflow()
+		{
+			if(gptr() < egptr())
+				return traits_type::to_int_type(*gptr());
+
+			if(!is_open())
+				return traits_type::eof();
+
+			boost::unique_lock<boost::mutex> lock(mutex);
+
+			while(gptr() == egptr())
+			{
+				while(full.empty() && !at_end)
+					filled.wait(lock);
+
+				if(full.empty())
+					return traits_type::eof();
+
+				block next = full.front();
+				full.pop_front();
+
+				// Keep the end of the current block in front of the next one so unget() works across blocks.
+				std::size_t keep = 0;
+
+				if(current.data)
+				{
+					keep = egptr() - eback() < (std::ptrdiff_t)putback_size ? egptr() - eback() : putback_size;
+					std::memcpy(next.data + putback_size - keep, egptr() - keep, keep);
+
+					free_blocks.push_back(current.data);
+					freed.notify_one();
+				}
+
+				current = next;
+				base_offset = current.offset;
+
+				// After a seek, reading starts a little early so there is something to unget().
+				std::size_t skip = pending_skip < current.size ? pending_skip : current.size;
+				pending_skip -= skip;
+
+				char* b = current.data + putback_size;
+				setg(b - keep, b + skip, b + current.size);
+			}
+
+			return traits_type::to_int_type(*gptr());
+		}
+
+		int_type pbackfail(int_type c)
+		{
+			// Straight after a seek nothing has been read yet, so read the block and step back in it.
+			if(!current.data && underflow() != traits_type::eof() && gptr() > eback())
+			{
+				gbump(-1);
+
+				if(traits_type::eq_int_type(c, traits_type::eof()) || traits_type::eq_int_type(c, traits_type::to_int_type(*gptr())))
+					return traits_type::to_int_type(*gptr());
+
+				gbump(1);
+			}
+
+			return traits_type::eof();
+		}
+
+		pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which=std::ios_base::in)
+		{
+			if(!is_open() || !(which & std::ios_base::in))
+				return pos_type(off_type(-1));
+
+			char* b = current.data ? current.data + putback_size : 0;
+			off_type here = current.data ? base_offset + (gptr() - b) : base_offset + pending_skip;
+
+			if(dir != std::ios_base::end)
+			{
+				off_type target = dir == std::ios_base::beg ? off : here + off;
+
+				// Seeks within what's in memory, like tellg() or going back to re-read a character, are cheap.
+				if(current.data && target >= base_offset - (b - eback()) && target <= base_offset + (egptr() - b))
+				{
+					setg(eback(), b + (target - base_offset), egptr());
+					return pos_type(target);
+				}
+
+				stop();
+				return restart(target) ? pos_type(target) : pos_type(off_type(-1));
+			}
+
+			stop();
+			pos_type target = file.pubseekoff(off, std::ios_base::end, std::ios_base::in);
+
+			if(target == pos_type(off_type(-1)) || !restart(target))
+				return pos_type(off_type(-1));
+
+			return target;
+		}
+
+		pos_type seekpos(pos_type pos, std::ios_base::openmode which=std::ios_base::in)
+		{
+			return seekoff(off_type(pos), std::ios_base::beg, which);
+		}
+
+	private:
+		struct block
+		{
+			char* data; // Storage. The block's bytes start putback_size in.
+			std::size_t size;
+			std::streamoff offset; // Where the block's first byte is in the file.
+		};
+
+		// Stop the background thread.
+		void stop()
+		{
+			{
+				boost::unique_lock<boost::mutex> lock(mutex);
+				stopping = true;
+				freed.notify_all();
+			}
+
+			reader->join();
+			reader.reset();
+		}
+
+		// Throw away everything read ahead and start reading ahead again from offset.
+		bool restart(std::streamoff offset)
+		{
+			full.clear();
+			free_blocks.clear();
+
+			for(std::size_t i=0; i < max_blocks; ++i)
+				free_blocks.push_back(&blocks[i][0]);
+
+			setg(0, 0, 0);
+			current.data = 0;
+			pending_skip = offset < (std::streamoff)putback_size ? (std::size_t)offset : putback_size;
+			base_offset = next_offset = offset - pending_skip;
+			stopping = false;
+			at_end = false;
+			carry_size = 0;
+
+			if(file.pubseekpos(next_offset, std::ios_base::in) == pos_type(off_type(-1)))
+				return false;
+
+			reader.reset(new boost::thread(&prefetch_filebuf::read_blocks, this));
+			return true;
+		}
+
+		// The background thread: fill free blocks in file order until the end of the file.
+		void read_blocks()
+		{
+			boost::unique_lock<boost::mutex> lock(mutex);
+
+			for(;;)
+			{
+				while(free_blocks.empty() && !stopping)
+					freed.wait(lock);
+
+				if(stopping)
+					break;
+
+				block b;
+				b.data = free_blocks.back();
+				b.offset = next_offset;
+				free_blocks.pop_back();
+
+				lock.unlock();
+				std::streamsize got = file.sgetn(b.data + putback_size, block_size);
+
+				std::streamoff invalid = validate ? check(b, got) : -1;
+
+				lock.lock();
+
+				if(invalid >= 0 && invalid_offset < 0)
+					invalid_offset = invalid;
+
+				if(got <= 0)
+				{
+					free_blocks.push_back(b.data);
+					at_end = true;
+					filled.notify_one();
+					break;
+				}
+
+				b.size = got;
+				next_offset += got;
+				full.push_back(b);
+				filled.notify_one();
+			}
+		}
+
+		// Check a block is valid UTF-8, carrying a sequence cut short by the end of one
+		// block over to the next. Returns the offset of the first malformed byte or -1.
+		std::streamoff check(const block& b, std::streamsize got)
+		{
+			// Not following on from the last block checked (after a seek), so any carried bytes are no use.
+			bool follows = b.offset == carry_offset + (std::streamoff)carry_size;
+
+			if(!follows)
+				carry_size = 0;
+
+			if(got <= 0)
+				return carry_size ? carry_offset : -1; // The file ends in the middle of a character.
+
+			const boost::uint8_t* first = (const boost::uint8_t*)b.data + putback_size;
+			const boost::uint8_t* last = first + got;
+			const boost::uint8_t* tail;
+
+			if(carry_size)
+			{
+				// Finish the carried sequence with the start of this block.
+				std::size_t len = utf8_character_sizes_lookup[carry[0]];
+				std::size_t needed = len - carry_size;
+
+				if(got < (std::streamsize)needed)
+					return carry_offset;
+
+				boost::uint8_t tmp[4];
+				std::memcpy(tmp, carry, carry_size);
+				std::memcpy(tmp + carry_size, first, needed);
+
+				if(utf8_find_invalid(tmp, tmp + len, tail) != tmp + len || tail != tmp + len)
+					return carry_offset;
+
+				first += needed;
+				carry_size = 0;
+			}
+			else if(!follows && b.offset != 0)
+			{
+				// Starting somewhere in the middle of the file, maybe in the middle of a character.
+				for(int i=0; i < 3 && first != last && (*first & 0xC0) == 0x80; ++i)
+					++first;
+			}
+
+			const boost::uint8_t* bad = utf8_find_invalid(first, last, tail);
+
+			if(bad != last)
+				return b.offset + (bad - ((const boost::uint8_t*)b.data + putback_size));
+
+			carry_size = last - tail;
+			carry_offset = b.offset + (tail - ((const boost::uint8_t*)b.data + putback_size));
+			std::memcpy(carry, tail, carry_size);
+
+			return -1;
+		}
+
+		std::size_t block_size;
+		std::size_t max_blocks;
+		bool validate;
+		std::filebuf file;
+		std::vector<std::vector<char> > blocks; // Storage for every block.
+		std::deque<block> full; // Blocks read ahead, in file order.
+		std::vector<char*> free_blocks; // Blocks that can be read into.
+		block current; // The block being read from.
+		boost::scoped_ptr<boost::thread> reader;
+		boost::mutex mutex;
+		boost::condition_variable filled; // Signalled when a block has been read, or at the end of the file.
+		boost::condition_variable freed; // Signalled when a block is finished with, or to stop.
+		bool stopping;
+		bool at_end;
+		std::streamoff base_offset; // Where the current block's first byte is in the file.
+		std::streamoff next_offset; // Where the background thread reads from next.
+		std::size_t pending_skip; // Bytes to skip at the start of the first block after a seek.
+		boost::uint8_t carry[4]; // Start of a sequence cut short by the end of the last block checked.
+		std::size_t carry_size;
+		std::streamoff carry_offset;
+		std::streamoff invalid_offset;
+	};
+
+	// Unicode input file stream that reads ahead in the background.
+	template<class decoder_type>
+	class specific_prefetch_uifstream : public specific_uistream<decoder_type>
+	{
+	private:
+		prefetch_filebuf fb;
+		std::istream fs;
+
+	public:
+		specific_prefetch_uifstream(std::size_t block_size=prefetch_filebuf::default_block_size, std::size_t max_blocks=4, bool validate=false)
+			: specific_uistream<decoder_type>(&fs), fb(block_size, max_blocks, validate), fs(&fb)
+		{
+		}
+
+		specific_prefetch_uifstream(const char* filename, std::size_t block_size=prefetch_filebuf::default_block_size, std::size_t max_blocks=4, bool validate=false)
+			: specific_uistream<decoder_type>(&fs), fb(block_size, max_blocks, validate), fs(&fb)
+		{
+			open(filename);
+		}
+
+		void open(const char* filename)
+		{
+			if(fb.open(filename))
+				fs.clear();
+			else
+				fs.setstate(std::ios_base::failbit);
+		}
+
+		bool is_open() const
+		{
+			return fb.is_open();
+		}
+
+		void close()
+		{
+			if(fb.is_open() && !fb.close())
+				fs.setstate(std::ios_base::failbit);
+		}
+
+		// Byte offset of the first malformed UTF-8 found while reading ahead, or -1. See prefetch_filebuf::first_invalid().
+		std::streamoff first_invalid()
+		{
+			return fb.first_invalid();
+		}
+	};
+
+	// All of the read-ahead Unicode input file streams:
+	typedef specific_prefetch_uifstream<utf8_decoder> utf8_prefetch_uifstream; // UTF-8 Input Stream
+	typedef specific_prefetch_uifstream<utf16le_decoder> utf16le_prefetch_uifstream; // UTF-16 Little-Endian Input Stream
+	typedef specific_prefetch_uifstream<utf16be_decoder> utf16be_prefetch_uifstream; // UTF-16 Big-Endian Input Stream
+	typedef specific_prefetch_uifstream<utf32le_decoder> utf32le_prefetch_uifstream; // UTF-32 Little-Endian Input Stream
+	typedef specific_prefetch_uifstream<utf32be_decoder> utf32be_prefetch_uifstream; // UTF-32 Big-Endian Input Stream
+
+	// All of the asynchronous Unicode output file streams:
+	typedef specific_async_uofstream<utf8_encoder> utf8_async_uofstream; // UTF-8 Output Stream
+	typedef specific_async_uofstream<utf16le_encoder> utf16le_async_uofstream; // UTF-16 Little-Endian Output Stream
+	typedef specific_async_uofstream<utf16be_encoder> utf16be_async_uofstream; // UTF-16 Big-Endian Output Stream
+	typedef specific_async_uofstream<utf32le_encoder> utf32le_async_uofstream; // UTF-32 Little-Endian Output Stream
+	typedef specific_async_uofstream<utf32be_encoder> utf32be_async_uofstream; // UTF-32 Big-Endian Output Stream
+}
+
+#endif
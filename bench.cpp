@@ -0,0 +1,329 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Benchmarks for the block-at-a-time UTF-8 routines and buffered encoders against
+// their one-character-at-a-time (or one-byte-at-a-time) equivalents, and for the
+// latency of writing log lines through synchronous and asynchronous file streams,
+// and for scanning a file with and without read-ahead.
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <boost/chrono.hpp>
+#include "utf8_count.hpp"
+#include "ustream.hpp"
+#include "async_ufstream.hpp"
+#include "bench_corpus.hpp"
+
+using namespace std;
+
+// Size of a character given its first byte.
+inline int char_size(boost::uint8_t b)
+{
+	static const int sizes[16] = { 1,1,1,1,1,1,1,1,1,1,1,1,2,2,3,4 };
+	return sizes[b >> 4];
+}
+
+// Count characters by stepping from first byte to first byte like basic_ustring::iterator.
+size_t count_stepping(const boost::uint8_t* p, const boost::uint8_t* last)
+{
+	size_t ret = 0;
+
+	for(; p < last; ++ret)
+		p += char_size(*p);
+
+	return ret;
+}
+
+double seconds(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+void run(const char* name, const buffer& b, int rounds)
+{
+	const boost::uint8_t* first = &b[0];
+	const boost::uint8_t* last = first + b.size();
+	double mb = (double)b.size() * rounds / (1024*1024);
+	size_t expect = count_stepping(first, last);
+	size_t sum = 0;
+
+	clock_t start = clock();
+	for(int i=0; i < rounds; ++i)
+		sum += count_stepping(first, last);
+	double t_step = seconds(start);
+
+	start = clock();
+	for(int i=0; i < rounds; ++i)
+		sum += unicode::utf8_count(first, last);
+	double t_count = seconds(start);
+
+	// Walk the text in hops of 1000 characters, as repeated at() or seekg() calls would.
+	start = clock();
+	for(int i=0; i < rounds; ++i)
+	{
+		const boost::uint8_t* p = first;
+		while(p < last)
+		{
+			for(int n=0; n < 1000 && p < last; ++n)
+				p += char_size(*p);
+		}
+		sum += p - first;
+	}
+	double t_hop_step = seconds(start);
+
+	start = clock();
+	for(int i=0; i < rounds; ++i)
+	{
+		const boost::uint8_t* p = first;
+		while(p < last)
+		{
+			size_t qty = 1000;
+			p = unicode::utf8_advance(p, last, qty);
+		}
+		sum += p - first;
+	}
+	double t_hop_advance = seconds(start);
+
+	if(unicode::utf8_count(first, last) != expect)
+		printf("%s: utf8_count disagrees with stepping!\n", name);
+
+	printf("%-8s %8.1f MB  count: step %7.0f MB/s  block %7.0f MB/s (x%.1f)  advance(1000): step %7.0f MB/s  block %7.0f MB/s (x%.1f)  [%lu]\n",
+		name, (double)b.size() / (1024*1024),
+		mb / t_step, mb / t_count, t_step / t_count,
+		mb / t_hop_step, mb / t_hop_advance, t_hop_step / t_hop_advance,
+		(unsigned long)(sum & 0xF));
+}
+
+// A streambuf that throws everything away, so only the encoder is measured.
+class null_buffer : public std::streambuf
+{
+protected:
+	int overflow(int c)
+	{
+		return c == EOF ? 0 : c;
+	}
+
+	std::streamsize xsputn(const char*, std::streamsize n)
+	{
+		return n;
+	}
+};
+
+// UTF-8 encoder as it was before encoders had their own buffer: one put() per byte.
+class put_utf8_encoder : public unicode::basic_encoder
+{
+public:
+	put_utf8_encoder(std::ostream* _os) : basic_encoder(_os) {}
+
+	void encode(boost::int_fast32_t ch)
+	{
+		if(ch < 0x80)
+		{
+			os->put((boost::uint8_t)ch);
+		}
+		else if(ch < 0x800)
+		{
+			os->put((boost::uint8_t)(0xC0 | ch >> 6));
+			os->put((boost::uint8_t)(0x80 | (ch & 0x3F)));
+		}
+		else if(ch < 0x10000)
+		{
+			os->put((boost::uint8_t)(0xE0 | ch >> 12));
+			os->put((boost::uint8_t)(0x80 | (ch >> 6 & 0x3F)));
+			os->put((boost::uint8_t)(0x80 | (ch & 0x3F)));
+		}
+		else
+		{
+			os->put((boost::uint8_t)(0xF0 | ch >> 18));
+			os->put((boost::uint8_t)(0x80 | (ch >> 12 & 0x3F)));
+			os->put((boost::uint8_t)(0x80 | (ch >> 6 & 0x3F)));
+			os->put((boost::uint8_t)(0x80 | (ch & 0x3F)));
+		}
+	}
+};
+
+// UTF-16 encoder as it was before encoders had their own buffer.
+class put_utf16le_encoder : public unicode::basic_encoder
+{
+public:
+	put_utf16le_encoder(std::ostream* _os) : basic_encoder(_os) {}
+
+	void put_unit(boost::uint16_t u)
+	{
+		os->put((char)(u & 0xFF));
+		os->put((char)(u >> 8));
+	}
+
+	void encode(boost::int_fast32_t ch)
+	{
+		if(ch <= 0xFFFF)
+		{
+			put_unit((boost::uint16_t)ch);
+		}
+		else
+		{
+			ch -= 0x10000;
+			put_unit((boost::uint16_t)((ch >> 10) + 0xD800));
+			put_unit((boost::uint16_t)((ch & 0x3FF) + 0xDC00));
+		}
+	}
+};
+
+vector<boost::int_fast32_t> decode_all(const buffer& b)
+{
+	vector<boost::int_fast32_t> ret;
+	string s(b.begin(), b.end());
+	istringstream is(s);
+	unicode::utf8_decoder dec(&is);
+
+	for(boost::int_fast32_t ch; (ch = dec.decode()) != EOF; )
+		ret.push_back(ch);
+
+	return ret;
+}
+
+template<class encoder_type>
+double time_encoder(const vector<boost::int_fast32_t>& chars, int rounds)
+{
+	null_buffer nb;
+	std::ostream os(&nb);
+	clock_t start = clock();
+
+	for(int i=0; i < rounds; ++i)
+	{
+		encoder_type enc(&os);
+
+		for(size_t j=0; j < chars.size(); ++j)
+			enc.encode(chars[j]);
+
+		enc.flush();
+	}
+
+	return seconds(start);
+}
+
+void run_encoders(const char* name, const buffer& b, int rounds)
+{
+	vector<boost::int_fast32_t> chars = decode_all(b);
+	double mchars = (double)chars.size() * rounds / 1000000;
+
+	double t_put8 = time_encoder<put_utf8_encoder>(chars, rounds);
+	double t_buf8 = time_encoder<unicode::utf8_encoder>(chars, rounds);
+	double t_put16 = time_encoder<put_utf16le_encoder>(chars, rounds);
+	double t_buf16 = time_encoder<unicode::utf16le_encoder>(chars, rounds);
+
+	printf("%-8s encode Mchars/s  utf8: put %6.1f  buffered %6.1f (x%.1f)  utf16le: put %6.1f  buffered %6.1f (x%.1f)\n",
+		name,
+		mchars / t_put8, mchars / t_buf8, t_put8 / t_buf8,
+		mchars / t_put16, mchars / t_buf16, t_put16 / t_buf16);
+}
+
+// Write log lines of the given characters and record how long each line took to put.
+template<class stream_type>
+void time_log_lines(stream_type& out, const vector<boost::int_fast32_t>& chars, int lines, vector<double>& times)
+{
+	typedef boost::chrono::high_resolution_clock clock_type;
+	const size_t line_length = 120;
+
+	times.clear();
+
+	for(int i=0; i < lines; ++i)
+	{
+		size_t first = (i * line_length) % (chars.size() - line_length);
+		clock_type::time_point start = clock_type::now();
+
+		for(size_t j=first; j < first + line_length; ++j)
+			out.put(chars[j]);
+		out.put('\n');
+
+		times.push_back(boost::chrono::duration<double, boost::micro>(clock_type::now() - start).count());
+	}
+
+	sort(times.begin(), times.end());
+}
+
+void print_latency(const char* name, const vector<double>& times)
+{
+	printf("%-22s per line us  p50 %7.2f  p99 %7.2f  p99.9 %8.2f  max %9.2f\n", name,
+		times[times.size() / 2], times[times.size() * 99 / 100], times[times.size() * 999 / 1000], times.back());
+}
+
+void run_log_latency(const buffer& b, int lines)
+{
+	vector<boost::int_fast32_t> chars = decode_all(b);
+	vector<double> times;
+
+	{
+		unicode::utf8_uofstream out("bench_sync.log");
+		time_log_lines(out, chars, lines, times);
+	}
+	print_latency("utf8_uofstream", times);
+
+	{
+		unicode::utf8_async_uofstream out("bench_async.log");
+		time_log_lines(out, chars, lines, times);
+	}
+	print_latency("utf8_async_uofstream", times);
+
+	remove("bench_sync.log");
+	remove("bench_async.log");
+}
+
+// Wall clock time to decode a whole file, since reading ahead happens on another thread.
+template<class stream_type>
+double time_scan(const char* filename, size_t& chars)
+{
+	boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+	stream_type in(filename);
+
+	chars = 0;
+	while(in.get() != EOF)
+		++chars;
+
+	return boost::chrono::duration<double>(boost::chrono::steady_clock::now() - start).count();
+}
+
+void run_scan(const buffer& b)
+{
+	{
+		ofstream out("bench_scan.txt", ios::binary);
+		out.write((const char*)&b[0], b.size());
+	}
+
+	size_t chars;
+	double mb = (double)b.size() / (1024*1024);
+	double t_sync = time_scan<unicode::utf8_uifstream>("bench_scan.txt", chars);
+	double t_prefetch = time_scan<unicode::utf8_prefetch_uifstream>("bench_scan.txt", chars);
+
+	printf("scan %.0f MB  utf8_uifstream %6.1f MB/s  utf8_prefetch_uifstream %6.1f MB/s (x%.2f)\n",
+		mb, mb / t_sync, mb / t_prefetch, t_sync / t_prefetch);
+
+	remove("bench_scan.txt");
+}
+
+int main()
+{
+	const size_t size = 16*1024*1024;
+
+	buffer cjk = to_utf8(make_corpus("cjk", size));
+	buffer emoji = to_utf8(make_corpus("emoji", size));
+
+	run("cjk", cjk, 20);
+	run("emoji", emoji, 20);
+
+	run_encoders("cjk", cjk, 4);
+	run_encoders("emoji", emoji, 4);
+
+	run_log_latency(cjk, 500000);
+
+	run_scan(cjk);
+
+	return 0;
+}
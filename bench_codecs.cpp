@@ -0,0 +1,504 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Benchmark suite for every decoder and encoder in ustream.hpp (and Windows-1252,
+// Shift_JIS and GB18030), for the basic_ustring conversions, compare(),
+// compare_nocase(), grapheme_count(), word and line break iteration and at(), and for
+// the block conversions in utf_convert.hpp at every CPU tier the machine has (which
+// BOOST_UNICODE_CPU can cap), over generated corpora (see bench_corpus.hpp).
+// Results go to stdout as JSON so runs of different releases can be compared.
+//
+// usage: bench_codecs [kilobytes per corpus] [seconds per measurement]
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <boost/chrono.hpp>
+#include "ustream.hpp"
+#include "ustring.h"
+#include "case_folding.hpp"
+#include "grapheme.hpp"
+#include "word_break.hpp"
+#include "line_break.hpp"
+#include "display_width.hpp"
+#include "single_byte.hpp"
+#include "multi_byte.hpp"
+#include "split.hpp"
+#include "utf_convert.hpp"
+#include "bench_corpus.hpp"
+
+using namespace std;
+
+typedef unicode::basic_ustring<unicode::utf8_encoder, unicode::utf8_decoder> bench_ustring;
+
+struct result
+{
+	string corpus;
+	string operation; // decode, encode, utf16, utf32, ascii, compare, compare_nocase, graphemes, words, lines, width, find, split, at,
+		// utf8_to_utf16, utf8_to_utf32, utf16_to_utf8 or utf32_to_utf8
+	string subject; // The codec, basic_ustring, or the CPU tier for the block conversions.
+	double bytes; // Bytes handled by one run.
+	double code_points; // Code points handled by one run.
+	double calls; // Calls made by one run, for at().
+	double seconds; // Time of the fastest run.
+};
+
+vector<result> results;
+double min_seconds = 0.5;
+
+// Results that are otherwise unused go here, so the work isn't optimized away.
+volatile boost::uint32_t sink;
+
+// Run f over and over for at least min_seconds (and at least 3 times), and return the
+// time of the fastest run, which is the one least disturbed by everything else going on.
+template<class function_type>
+double time_best(function_type f)
+{
+	typedef boost::chrono::steady_clock clock_type;
+
+	double best = 1e30, total = 0;
+
+	for(int runs=0; runs < 3 || total < min_seconds; ++runs)
+	{
+		clock_type::time_point start = clock_type::now();
+		f();
+		double t = boost::chrono::duration<double>(clock_type::now() - start).count();
+
+		best = t < best ? t : best;
+		total += t;
+	}
+
+	return best;
+}
+
+void add_result(const string& corpus, const string& operation, const string& subject,
+	double bytes, double code_points, double calls, double seconds)
+{
+	result r;
+	r.corpus = corpus;
+	r.operation = operation;
+	r.subject = subject;
+	r.bytes = bytes;
+	r.code_points = code_points;
+	r.calls = calls;
+	r.seconds = seconds > 0 ? seconds : 1e-9;
+	results.push_back(r);
+
+	if(calls)
+		fprintf(stderr, "%-10s %-8s %-14s %10.0f calls/s\n", corpus.c_str(), operation.c_str(),
+			subject.c_str(), calls / r.seconds);
+	else
+		fprintf(stderr, "%-10s %-8s %-14s %10.1f MB/s %8.1f M code points/s\n", corpus.c_str(), operation.c_str(),
+			subject.c_str(), bytes / r.seconds / (1024*1024), code_points / r.seconds / 1000000);
+}
+
+//================================================================================
+// Codecs
+//================================================================================
+
+// A streambuf that throws everything away, so only the encoder is measured.
+class null_buffer : public std::streambuf
+{
+protected:
+	int overflow(int c)
+	{
+		return c == EOF ? 0 : c;
+	}
+
+	std::streamsize xsputn(const char*, std::streamsize n)
+	{
+		return n;
+	}
+};
+
+template<class decoder_type>
+struct decode_run
+{
+	std::istringstream* is;
+	double* chars;
+
+	void operator()()
+	{
+		is->clear();
+		is->seekg(0);
+
+		decoder_type dec(is);
+		size_t n = 0;
+
+		while(dec.decode() != EOF)
+			++n;
+
+		*chars = (double)n;
+	}
+};
+
+template<class encoder_type>
+struct encode_run
+{
+	const code_points* text;
+
+	void operator()()
+	{
+		null_buffer nb;
+		std::ostream os(&nb);
+		encoder_type enc(&os);
+
+		for(size_t i=0; i < text->size(); ++i)
+			enc.encode((*text)[i]);
+
+		enc.flush();
+	}
+};
+
+template<class encoder_type>
+string encode_all(const code_points& text)
+{
+	std::ostringstream os;
+
+	{
+		encoder_type enc(&os);
+
+		for(size_t i=0; i < text.size(); ++i)
+			enc.encode(text[i]);
+	}
+
+	return os.str();
+}
+
+template<class decoder_type, class encoder_type>
+void bench_codec(const string& corpus, const char* name, const code_points& text)
+{
+	string bytes = encode_all<encoder_type>(text);
+
+	if(corpus == "malformed")
+		corrupt(bytes);
+
+	std::istringstream is(bytes);
+	double chars = 0;
+	decode_run<decoder_type> d = { &is, &chars };
+	double t = time_best(d);
+	add_result(corpus, "decode", name, (double)bytes.size(), chars, 0, t);
+
+	// Malformed text only matters to the decoders.
+	if(corpus != "malformed")
+	{
+		encode_run<encoder_type> e = { &text };
+		t = time_best(e);
+		add_result(corpus, "encode", name, (double)bytes.size(), (double)text.size(), 0, t);
+	}
+}
+
+//================================================================================
+// basic_ustring
+//================================================================================
+
+struct utf16_run
+{
+	bench_ustring* s;
+	void operator()() { s->utf16(); }
+};
+
+struct utf32_run
+{
+	bench_ustring* s;
+	void operator()() { s->utf32(); }
+};
+
+struct ascii_run
+{
+	bench_ustring* s;
+	void operator()() { s->ascii(); }
+};
+
+struct compare_run
+{
+	const bench_ustring* s;
+	const bench_ustring* with;
+	void operator()() { sink = sink + s->compare(*with); }
+};
+
+struct compare_nocase_run
+{
+	const bench_ustring* s;
+	const bench_ustring* with;
+	void operator()() { sink = sink + unicode::compare_nocase(*s, *with); }
+};
+
+struct graphemes_run
+{
+	const bench_ustring* s;
+	void operator()() { sink = sink + unicode::grapheme_count(*s); }
+};
+
+struct words_run
+{
+	const bench_ustring* s;
+
+	void operator()()
+	{
+		unicode::word_iterator end = unicode::word_end(*s);
+
+		for(unicode::word_iterator i=unicode::word_begin(*s); i != end; ++i)
+			sink = sink + 1;
+	}
+};
+
+struct lines_run
+{
+	const bench_ustring* s;
+
+	void operator()()
+	{
+		unicode::line_break_iterator end = unicode::line_break_end(*s);
+
+		for(unicode::line_break_iterator i=unicode::line_break_begin(*s); i != end; ++i)
+			sink = sink + 1;
+	}
+};
+
+struct width_run
+{
+	const bench_ustring* s;
+	void operator()() { sink = sink + (int)unicode::display_width(*s); }
+};
+
+struct find_run
+{
+	const bench_ustring* s;
+	const bench_ustring* what;
+	void operator()() { sink = sink + *s->find(*what); }
+};
+
+struct split_run
+{
+	const bench_ustring* s;
+
+	void operator()()
+	{
+		unicode::split_range<unicode::char_delimiter> fields = unicode::split(*s, ' ');
+
+		for(unicode::split_range<unicode::char_delimiter>::iterator i=fields.begin(); i != fields.end(); ++i)
+			sink = sink + 1;
+	}
+};
+
+struct at_run
+{
+	const bench_ustring* s;
+	const vector<int>* positions;
+
+	void operator()()
+	{
+		for(size_t i=0; i < positions->size(); ++i)
+			sink = sink + *s->at((*positions)[i]);
+	}
+};
+
+void bench_ustring_ops(const string& corpus, const code_points& text)
+{
+	bench_ustring s, t;
+
+	for(size_t i=0; i < text.size(); ++i)
+		s.append(text[i]);
+
+	t = s; // Equal strings, so compare() has to look at everything.
+
+	double bytes = (double)to_utf8(text).size();
+	double chars = (double)text.size();
+
+	utf16_run u16 = { &s };
+	add_result(corpus, "utf16", "basic_ustring", bytes, chars, 0, time_best(u16));
+
+	utf32_run u32 = { &s };
+	add_result(corpus, "utf32", "basic_ustring", bytes, chars, 0, time_best(u32));
+
+	ascii_run a = { &s };
+	add_result(corpus, "ascii", "basic_ustring", bytes, chars, 0, time_best(a));
+
+	compare_run c = { &s, &t };
+	add_result(corpus, "compare", "basic_ustring", bytes, chars, 0, time_best(c));
+
+	compare_nocase_run cn = { &s, &t };
+	add_result(corpus, "compare_nocase", "basic_ustring", bytes, chars, 0, time_best(cn));
+
+	graphemes_run g = { &s };
+	add_result(corpus, "graphemes", "basic_ustring", bytes, chars, 0, time_best(g));
+
+	words_run w = { &s };
+	add_result(corpus, "words", "basic_ustring", bytes, chars, 0, time_best(w));
+
+	lines_run l = { &s };
+	add_result(corpus, "lines", "basic_ustring", bytes, chars, 0, time_best(l));
+
+	width_run wd = { &s };
+	add_result(corpus, "width", "basic_ustring", bytes, chars, 0, time_best(wd));
+
+	// The last few characters, so the whole string has to be searched.
+	bench_ustring tail;
+
+	for(size_t i=text.size() < 8 ? 0 : text.size() - 8; i < text.size(); ++i)
+		tail.append(text[i]);
+
+	find_run f = { &s, &tail };
+	add_result(corpus, "find", "basic_ustring", bytes, chars, 0, time_best(f));
+
+	split_run sp = { &s };
+	add_result(corpus, "split", "basic_ustring", bytes, chars, 0, time_best(sp));
+
+	vector<int> positions;
+	corpus_random r(42);
+
+	for(int i=0; i < 1000; ++i)
+		positions.push_back(r.below(s.size()));
+
+	at_run at = { &s, &positions };
+	add_result(corpus, "at", "basic_ustring", 0, 0, (double)positions.size(), time_best(at));
+}
+
+//================================================================================
+// Block conversions, at every CPU tier the machine has
+//================================================================================
+
+struct utf8_to_utf16_run
+{
+	const buffer* in;
+	vector<boost::uint16_t>* out;
+	void operator()() { sink = sink + *unicode::utf8_to_utf16(&(*in)[0], &(*in)[0] + in->size(), &(*out)[0]); }
+};
+
+struct utf8_to_utf32_run
+{
+	const buffer* in;
+	vector<boost::uint32_t>* out;
+	void operator()() { sink = sink + *unicode::utf8_to_utf32(&(*in)[0], &(*in)[0] + in->size(), &(*out)[0]); }
+};
+
+struct utf16_to_utf8_run
+{
+	const vector<boost::uint16_t>* in;
+	buffer* out;
+	void operator()() { sink = sink + *unicode::utf16_to_utf8(&(*in)[0], &(*in)[0] + in->size(), &(*out)[0]); }
+};
+
+struct utf32_to_utf8_run
+{
+	const vector<boost::uint32_t>* in;
+	buffer* out;
+	void operator()() { sink = sink + *unicode::utf32_to_utf8(&(*in)[0], &(*in)[0] + in->size(), &(*out)[0]); }
+};
+
+void bench_block_conversions(const string& corpus, const code_points& text)
+{
+	buffer utf8 = to_utf8(text);
+	vector<boost::uint16_t> utf16(utf8.size() + 1);
+	vector<boost::uint32_t> utf32(text.begin(), text.end());
+	buffer back(utf8.size() * 4 + 1);
+
+	utf16.resize(unicode::utf8_to_utf16(&utf8[0], &utf8[0] + utf8.size(), &utf16[0]) - &utf16[0]);
+
+	double bytes = (double)utf8.size();
+	double chars = (double)text.size();
+
+	for(int tier = unicode::cpu_tier_scalar; tier <= unicode::available_cpu_tier(); ++tier)
+	{
+		unicode::set_cpu_tier(tier);
+		const char* name = unicode::cpu_tier_name(tier);
+
+		utf8_to_utf16_run a = { &utf8, &utf16 };
+		add_result(corpus, "utf8_to_utf16", name, bytes, chars, 0, time_best(a));
+
+		utf8_to_utf32_run b = { &utf8, &utf32 };
+		add_result(corpus, "utf8_to_utf32", name, bytes, chars, 0, time_best(b));
+
+		utf16_to_utf8_run c = { &utf16, &back };
+		add_result(corpus, "utf16_to_utf8", name, bytes, chars, 0, time_best(c));
+
+		utf32_to_utf8_run d = { &utf32, &back };
+		add_result(corpus, "utf32_to_utf8", name, bytes, chars, 0, time_best(d));
+	}
+
+	unicode::set_cpu_tier(unicode::available_cpu_tier());
+}
+
+//================================================================================
+// Output
+//================================================================================
+
+void print_json(size_t corpus_bytes)
+{
+	printf("{\n");
+	printf("  \"suite\": \"codecs\",\n");
+	printf("  \"corpus_bytes\": %lu,\n", (unsigned long)corpus_bytes);
+	printf("  \"min_seconds\": %g,\n", min_seconds);
+#ifdef BOOST_UNICODE_HAS_SSE2
+	printf("  \"sse2\": true,\n");
+#else
+	printf("  \"sse2\": false,\n");
+#endif
+	printf("  \"cpu_tier\": \"%s\",\n", unicode::cpu_tier_name(unicode::available_cpu_tier()));
+	printf("  \"results\": [\n");
+
+	for(size_t i=0; i < results.size(); ++i)
+	{
+		const result& r = results[i];
+
+		printf("    {\"corpus\": \"%s\", \"operation\": \"%s\", \"subject\": \"%s\", \"seconds\": %.9f",
+			r.corpus.c_str(), r.operation.c_str(), r.subject.c_str(), r.seconds);
+
+		if(r.calls)
+			printf(", \"calls\": %.0f, \"calls_per_second\": %.1f", r.calls, r.calls / r.seconds);
+		else
+			printf(", \"bytes\": %.0f, \"code_points\": %.0f, \"bytes_per_second\": %.1f, \"code_points_per_second\": %.1f",
+				r.bytes, r.code_points, r.bytes / r.seconds, r.code_points / r.seconds);
+
+		printf("}%s\n", i+1 < results.size() ? "," : "");
+	}
+
+	printf("  ]\n");
+	printf("}\n");
+}
+
+int main(int argc, char** argv)
+{
+	static const char* corpora[7] = { "ascii", "latin1", "cyrillic", "cjk", "emoji", "mixed", "malformed" };
+
+	size_t corpus_bytes = (argc > 1 ? atoi(argv[1]) : 1024) * 1024;
+	if(argc > 2)
+		min_seconds = atof(argv[2]);
+
+	for(int i=0; i < 7; ++i)
+	{
+		string corpus = corpora[i];
+		code_points text = make_corpus(corpus, corpus_bytes);
+
+		bench_codec<unicode::utf8_decoder, unicode::utf8_encoder>(corpus, "utf8", text);
+		bench_codec<unicode::utf16le_decoder, unicode::utf16le_encoder>(corpus, "utf16le", text);
+		bench_codec<unicode::utf16be_decoder, unicode::utf16be_encoder>(corpus, "utf16be", text);
+		bench_codec<unicode::utf32le_decoder, unicode::utf32le_encoder>(corpus, "utf32le", text);
+		bench_codec<unicode::utf32be_decoder, unicode::utf32be_encoder>(corpus, "utf32be", text);
+
+		// Single-byte code pages can't represent the other corpora.
+		if(corpus == "ascii" || corpus == "latin1")
+			bench_codec<unicode::windows1252_decoder, unicode::windows1252_encoder>(corpus, "windows1252", text);
+
+		if(corpus == "ascii" || corpus == "cjk")
+		{
+			bench_codec<unicode::shift_jis_decoder, unicode::shift_jis_encoder>(corpus, "shift_jis", text);
+			bench_codec<unicode::gb18030_decoder, unicode::gb18030_encoder>(corpus, "gb18030", text);
+		}
+
+		if(corpus != "malformed")
+		{
+			bench_ustring_ops(corpus, text);
+			bench_block_conversions(corpus, text);
+		}
+	}
+
+	print_json(corpus_bytes);
+
+	return 0;
+}
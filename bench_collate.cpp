@@ -0,0 +1,192 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Benchmark of sorting many short strings: by compare() (code point order), by
+// compare_collated() (which works out both sort keys on every comparison), and by
+// making every sort key once with sort_key() and sorting the keys with memcmp().
+// Results go to stdout as JSON like bench_codecs.
+//
+// usage: bench_collate [number of strings] [number of strings to sort with compare_collated()]
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <boost/chrono.hpp>
+#include "ustream.hpp"
+#include "ustring.h"
+#include "collate.hpp"
+#include "bench_corpus.hpp"
+
+using namespace std;
+
+typedef unicode::basic_ustring<unicode::utf8_encoder, unicode::utf8_decoder> bench_ustring;
+typedef boost::chrono::steady_clock clock_type;
+
+struct result
+{
+	string operation; // sort_compare, sort_collated, make_keys, sort_keys or sort_by_keys
+	double strings; // Strings sorted (or keys made).
+	double seconds;
+};
+
+vector<result> results;
+
+double seconds_since(clock_type::time_point start)
+{
+	return boost::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+void add_result(const string& operation, double strings, double seconds)
+{
+	result r;
+	r.operation = operation;
+	r.strings = strings;
+	r.seconds = seconds > 0 ? seconds : 1e-9;
+	results.push_back(r);
+
+	fprintf(stderr, "%-14s %10.0f strings %8.3f s %10.0f strings/s\n", operation.c_str(), strings, r.seconds, strings / r.seconds);
+}
+
+// A word of 3 to 16 letters, mostly Latin with accents and capitals, some Cyrillic
+// and some CJK, so the sort keys have something to do at every level.
+bench_ustring make_word(corpus_random& r)
+{
+	static const char* scripts[4] = { "ascii", "latin1", "cyrillic", "cjk" };
+	static const unsigned weights[4] = { 40, 35, 15, 10 };
+
+	unsigned n = r.below(100), i = 0;
+	while(n >= weights[i])
+		n -= weights[i++];
+
+	string script = scripts[i];
+	bench_ustring ret;
+
+	for(int len=3 + r.below(14); len; --len)
+	{
+		boost::uint32_t c = corpus_char(script, r);
+
+		if(c == ' ' || c == '\n' || c == '.' || c == 0x3002)
+			c = script == "cjk" ? 0x4E00 + r.below(0x5200) : 'a' + r.below(26);
+		else if(c < 0x80 && r.below(10) == 0)
+			c -= 'a' - 'A';
+
+		ret.append(c);
+	}
+
+	return ret;
+}
+
+struct compare_less
+{
+	bool operator()(const bench_ustring& a, const bench_ustring& b) const
+	{
+		return a.compare(b) < 0;
+	}
+};
+
+struct collated_less
+{
+	bool operator()(const bench_ustring& a, const bench_ustring& b) const
+	{
+		return unicode::compare_collated(a, b) < 0;
+	}
+};
+
+// Orders the indexes of strings by their sort keys.
+struct key_less
+{
+	const vector<unicode::collation_key>* keys;
+
+	bool operator()(size_t a, size_t b) const
+	{
+		return unicode::compare_sort_keys((*keys)[a], (*keys)[b]) < 0;
+	}
+};
+
+void print_json(size_t count)
+{
+	printf("{\n");
+	printf("  \"suite\": \"collate\",\n");
+	printf("  \"strings\": %lu,\n", (unsigned long)count);
+	printf("  \"results\": [\n");
+
+	for(size_t i=0; i < results.size(); ++i)
+	{
+		const result& r = results[i];
+
+		printf("    {\"operation\": \"%s\", \"strings\": %.0f, \"seconds\": %.6f, \"strings_per_second\": %.1f}%s\n",
+			r.operation.c_str(), r.strings, r.seconds, r.strings / r.seconds, i+1 < results.size() ? "," : "");
+	}
+
+	printf("  ]\n");
+	printf("}\n");
+}
+
+int main(int argc, char** argv)
+{
+	size_t count = argc > 1 ? strtoul(argv[1], 0, 10) : 10000000;
+	size_t collated_count = argc > 2 ? strtoul(argv[2], 0, 10) : 100000;
+	collated_count = collated_count < count ? collated_count : count;
+
+	vector<bench_ustring> words;
+	words.reserve(count);
+	corpus_random r(10);
+
+	for(size_t i=0; i < count; ++i)
+		words.push_back(make_word(r));
+
+	{
+		vector<bench_ustring> v(words);
+		clock_type::time_point start = clock_type::now();
+		sort(v.begin(), v.end(), compare_less());
+		add_result("sort_compare", (double)count, seconds_since(start));
+	}
+
+	// Making both keys on every comparison is far slower, so fewer strings are sorted.
+	{
+		vector<bench_ustring> v(words.begin(), words.begin() + collated_count);
+		clock_type::time_point start = clock_type::now();
+		sort(v.begin(), v.end(), collated_less());
+		add_result("sort_collated", (double)collated_count, seconds_since(start));
+	}
+
+	{
+		clock_type::time_point start = clock_type::now();
+
+		vector<unicode::collation_key> keys(count);
+		for(size_t i=0; i < count; ++i)
+			keys[i] = unicode::sort_key(words[i]);
+
+		double make = seconds_since(start);
+		add_result("make_keys", (double)count, make);
+
+		clock_type::time_point sort_start = clock_type::now();
+
+		vector<size_t> order(count);
+		for(size_t i=0; i < count; ++i)
+			order[i] = i;
+
+		key_less less = { &keys };
+		sort(order.begin(), order.end(), less);
+		add_result("sort_keys", (double)count, seconds_since(sort_start));
+		add_result("sort_by_keys", (double)count, seconds_since(start));
+
+		// The keys have to give the same order as comparing the strings one pair at a time.
+		for(size_t i=1; i < collated_count; ++i)
+		{
+			if(unicode::compare_collated(words[order[i-1]], words[order[i]]) > 0)
+			{
+				fprintf(stderr, "sort keys out of order at %lu\n", (unsigned long)i);
+				return 1;
+			}
+		}
+	}
+
+	print_json(count);
+
+	return 0;
+}
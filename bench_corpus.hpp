@@ -0,0 +1,146 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_BENCH_CORPUS_HPP
+#define BOOST_UNICODE_BENCH_CORPUS_HPP
+
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+
+//================================================================================
+// Text for the benchmarks. Every corpus is generated from a fixed seed with its own
+// random number generator (not rand(), which differs between C libraries), so the
+// same name and size give the same text everywhere.
+//================================================================================
+
+typedef std::vector<boost::uint8_t> buffer;
+typedef std::vector<boost::uint32_t> code_points;
+
+// xorshift32
+class corpus_random
+{
+public:
+	corpus_random(boost::uint32_t seed) : state(seed ? seed : 1) {}
+
+	boost::uint32_t next()
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	// A number in [0, n).
+	boost::uint32_t below(boost::uint32_t n)
+	{
+		return next() % n;
+	}
+
+private:
+	boost::uint32_t state;
+};
+
+inline void append_utf8(buffer& b, boost::uint32_t c)
+{
+	if(c < 0x80)
+	{
+		b.push_back((boost::uint8_t)c);
+	}
+	else if(c < 0x800)
+	{
+		b.push_back((boost::uint8_t)(0xC0 | c >> 6));
+		b.push_back((boost::uint8_t)(0x80 | (c & 0x3F)));
+	}
+	else if(c < 0x10000)
+	{
+		b.push_back((boost::uint8_t)(0xE0 | c >> 12));
+		b.push_back((boost::uint8_t)(0x80 | (c >> 6 & 0x3F)));
+		b.push_back((boost::uint8_t)(0x80 | (c & 0x3F)));
+	}
+	else
+	{
+		b.push_back((boost::uint8_t)(0xF0 | c >> 18));
+		b.push_back((boost::uint8_t)(0x80 | (c >> 12 & 0x3F)));
+		b.push_back((boost::uint8_t)(0x80 | (c >> 6 & 0x3F)));
+		b.push_back((boost::uint8_t)(0x80 | (c & 0x3F)));
+	}
+}
+
+inline int utf8_size(boost::uint32_t c)
+{
+	return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+}
+
+// A random character of the given script, with spaces and the odd line break in between.
+inline boost::uint32_t corpus_char(const std::string& script, corpus_random& r)
+{
+	boost::uint32_t n = r.below(100);
+
+	if(script == "ascii")
+		return n < 15 ? ' ' : n < 17 ? '\n' : n < 20 ? '.' : 'a' + r.below(26);
+	else if(script == "latin1")
+		return n < 15 ? ' ' : n < 17 ? '\n' : n < 45 ? 0xC0 + r.below(0x40) : 'a' + r.below(26);
+	else if(script == "cyrillic")
+		return n < 15 ? ' ' : n < 17 ? '\n' : n < 20 ? '.' : 0x430 + r.below(0x20);
+	else if(script == "cjk")
+		return n < 5 ? ' ' : n < 10 ? 0x3002 : 0x4E00 + r.below(0x5200);
+	else // emoji
+		return n < 33 ? 'a' + r.below(26) : 0x1F300 + r.below(0x350);
+}
+
+// Generate about the given number of bytes of UTF-8 text of a corpus: ascii, latin1,
+// cyrillic, cjk, emoji, mixed (words of all of those) or malformed (mixed, which is
+// spoiled by corrupt() once it's encoded).
+inline code_points make_corpus(const std::string& name, std::size_t bytes)
+{
+	static const char* scripts[5] = { "ascii", "latin1", "cyrillic", "cjk", "emoji" };
+
+	code_points ret;
+	boost::uint32_t seed = 0;
+
+	for(std::size_t i=0; i < name.size(); ++i)
+		seed = seed * 31 + (boost::uint8_t)name[i];
+
+	corpus_random r(seed);
+	bool mixed = name == "mixed" || name == "malformed";
+	std::string script = name;
+	std::size_t size = 0;
+
+	while(size < bytes)
+	{
+		if(mixed && r.below(8) == 0)
+			script = scripts[r.below(5)];
+
+		boost::uint32_t c = corpus_char(script, r);
+		ret.push_back(c);
+		size += utf8_size(c);
+	}
+
+	return ret;
+}
+
+inline buffer to_utf8(const code_points& text)
+{
+	buffer ret;
+	ret.reserve(text.size() * 2);
+
+	for(std::size_t i=0; i < text.size(); ++i)
+		append_utf8(ret, text[i]);
+
+	return ret;
+}
+
+// Overwrite about one byte in a hundred with 0xFF, which isn't valid UTF-8, and in
+// UTF-16 or UTF-32 makes unpaired surrogates, noncharacters or values past U+10FFFF.
+inline void corrupt(std::string& bytes)
+{
+	corpus_random r(0xBAD);
+
+	for(std::size_t i=r.below(100); i < bytes.size(); i += 1 + r.below(200))
+		bytes[i] = (char)0xFF;
+}
+
+#endif
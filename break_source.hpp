@@ -0,0 +1,162 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_BREAK_SOURCE_HPP
+#define BOOST_UNICODE_BREAK_SOURCE_HPP
+
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "utf8_count.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Where word_break.hpp and line_break.hpp get characters from. Some of their rules
+	// look past the next character, so a source can peek ahead as well as take the
+	// next character:
+	//
+	//   peek(n)   The nth character after the next one (0 for the next one), or -1
+	//             past the end. Doesn't move.
+	//   take()    Move past the next character.
+	//   skip_ascii_word(before_last, last)
+	//             Move past a run of ASCII letters, digits and underscores, which never
+	//             have a word boundary or line break between them, setting last (and,
+	//             if there were two or more, before_last) to the last ones. Returns how
+	//             many there were, or 0 if the source can't do it quickly.
+	//================================================================================
+
+	// Is b an ASCII letter, digit or underscore?
+	inline bool is_ascii_word(boost::uint8_t b)
+	{
+		return (boost::uint8_t)((b | 0x20) - 'a') < 26 || (boost::uint8_t)(b - '0') < 10 || b == '_';
+	}
+
+	// Skip ASCII letters, digits and underscores, 16 at a time where there are that many.
+	inline const boost::uint8_t* skip_ascii_word(const boost::uint8_t* first, const boost::uint8_t* last)
+	{
+#ifdef BOOST_UNICODE_HAS_SSE2
+		// Bytes of 0x80 and above are negative, so they're never in a range.
+		const __m128i case_bit = _mm_set1_epi8(0x20);
+
+		while(last - first >= 16)
+		{
+			__m128i x = _mm_loadu_si128((const __m128i*)first);
+			__m128i lower = _mm_or_si128(x, case_bit);
+			__m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+			__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1)));
+			__m128i underscore = _mm_cmpeq_epi8(x, _mm_set1_epi8('_'));
+
+			if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit), underscore)) != 0xFFFF)
+				break;
+
+			first += 16;
+		}
+#endif
+
+		while(first != last && is_ascii_word(*first))
+			++first;
+
+		return first;
+	}
+
+	// Well-formed UTF-8 in memory.
+	class utf8_break_source
+	{
+	public:
+		utf8_break_source(const boost::uint8_t* _p, const boost::uint8_t* _last) : p(_p), last(_last)
+		{
+		}
+
+		boost::int_fast32_t peek(std::size_t n) const
+		{
+			const boost::uint8_t* q = p;
+
+			for(; n && q != last; --n)
+				utf8_next(q);
+
+			return q == last ? -1 : (boost::int_fast32_t)utf8_next(q);
+		}
+
+		void take()
+		{
+			utf8_next(p);
+		}
+
+		std::size_t skip_ascii_word(boost::uint32_t& before_last, boost::uint32_t& last_char)
+		{
+			const boost::uint8_t* q = unicode::skip_ascii_word(p, last);
+			std::size_t n = q - p;
+
+			if(n)
+				last_char = q[-1];
+			if(n > 1)
+				before_last = q[-2];
+
+			p = q;
+			return n;
+		}
+
+		const boost::uint8_t* position() const
+		{
+			return p;
+		}
+
+	private:
+		const boost::uint8_t* p;
+		const boost::uint8_t* last;
+	};
+
+	// A Unicode input stream (a uistream, or anything else with a get() that returns
+	// code points and EOF at the end). Characters that are taken are appended to out,
+	// and characters that have been peeked at are kept for later.
+	template<class stream_type>
+	class stream_break_source
+	{
+	public:
+		stream_break_source(stream_type* _s) : s(_s), out(0)
+		{
+		}
+
+		boost::int_fast32_t peek(std::size_t n)
+		{
+			while(ahead.size() <= n)
+			{
+				if(!ahead.empty() && ahead.back() == EOF)
+					return -1;
+
+				ahead.push_back(s->get());
+			}
+
+			return ahead[n] == EOF ? -1 : ahead[n];
+		}
+
+		void take()
+		{
+			out->push_back((boost::uint32_t)ahead.front());
+			ahead.pop_front();
+		}
+
+		std::size_t skip_ascii_word(boost::uint32_t&, boost::uint32_t&)
+		{
+			return 0;
+		}
+
+		// Where taken characters go.
+		void output(std::vector<boost::uint32_t>* _out)
+		{
+			out = _out;
+		}
+
+	private:
+		stream_type* s;
+		std::vector<boost::uint32_t>* out;
+		std::deque<boost::int_fast32_t> ahead; // Characters read but not taken yet, ending with EOF once it's been read.
+	};
+}
+
+#endif
@@ -0,0 +1,297 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_CASE_FOLDING_HPP
+#define BOOST_UNICODE_CASE_FOLDING_HPP
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include "case_folding_tables.hpp"
+#include "utf8_count.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Case folding (section 3.13 of the Unicode standard). Folding maps every case of
+	// a character to the same thing, so strings can be compared without regard to
+	// case. Simple folding maps each character to one character; full folding maps a
+	// few to more than one (e.g. U+00DF to "ss"), and is what comparing uses.
+	// Turkic folding maps I to dotless i and dotted I to i, for Turkish and Azerbaijani.
+	//================================================================================
+
+	// The longest full folding.
+	const int max_case_folding = 3;
+
+	// Fold an ASCII character.
+	inline boost::uint32_t fold_ascii(boost::uint32_t c)
+	{
+		return c - 'A' < 26 ? c + ('a' - 'A') : c;
+	}
+
+	// Simple case folding.
+	inline boost::uint32_t fold_case(boost::uint32_t cp, bool turkic=false)
+	{
+		if(cp < 0x80 && !turkic)
+			return fold_ascii(cp);
+
+		if(turkic && (cp == 0x49 || cp == 0x130))
+			return cp == 0x49 ? 0x131 : 0x69;
+
+		return cp + case_folding_data<>::case_folding_delta[case_folding_entry(cp)];
+	}
+
+	// Full case folding into out, which has room for max_case_folding characters.
+	// Returns the number of characters.
+	inline int fold_case_full(boost::uint32_t cp, boost::uint32_t* out, bool turkic=false)
+	{
+		typedef case_folding_data<> data;
+
+		if(cp < 0x80 && !turkic)
+		{
+			out[0] = fold_ascii(cp);
+			return 1;
+		}
+
+		int entry = case_folding_entry(cp);
+		boost::uint16_t full = data::case_folding_full[entry];
+
+		if(!full || (turkic && cp == 0x130))
+		{
+			out[0] = fold_case(cp, turkic);
+			return 1;
+		}
+
+		int n = data::case_folding_pool[full];
+
+		for(int i=0; i < n; ++i)
+			out[i] = data::case_folding_pool[full + 1 + i];
+
+		return n;
+	}
+
+#ifdef BOOST_UNICODE_HAS_SSE2
+	// Fold 16 ASCII characters at once.
+	inline __m128i fold_ascii16(__m128i x)
+	{
+		__m128i upper = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8('Z' + 1)));
+		return _mm_add_epi8(x, _mm_and_si128(upper, _mm_set1_epi8('a' - 'A')));
+	}
+#endif
+
+	//--------------------------------------------------------------------------------
+	// Folding well-formed UTF-8 on the fly, one code point at a time, so nothing has to
+	// be allocated.
+	//--------------------------------------------------------------------------------
+
+	class utf8_case_folder
+	{
+	public:
+		utf8_case_folder(const boost::uint8_t* _first, const boost::uint8_t* _last, bool _turkic=false)
+			: p(_first), last(_last), pending(0), next_pending(0), turkic(_turkic)
+		{
+		}
+
+		// The next code point of the folded text, or -1 at the end.
+		boost::int_fast32_t next()
+		{
+			if(next_pending < pending)
+				return buf[next_pending++];
+
+			if(p == last)
+				return -1;
+
+			if(*p < 0x80 && !turkic)
+				return fold_ascii(*p++);
+
+			pending = fold_case_full(utf8_next(p), buf, turkic);
+			next_pending = 1;
+			return buf[0];
+		}
+
+		// Is the folder between characters, with nothing of the last one left to return?
+		bool between() const
+		{
+			return next_pending >= pending;
+		}
+
+		const boost::uint8_t* position() const
+		{
+			return p;
+		}
+
+		const boost::uint8_t* end() const
+		{
+			return last;
+		}
+
+		void skip(std::size_t bytes)
+		{
+			p += bytes;
+		}
+
+		bool is_turkic() const
+		{
+			return turkic;
+		}
+
+	private:
+		const boost::uint8_t* p;
+		const boost::uint8_t* last;
+		boost::uint32_t buf[max_case_folding]; // Folding of the last character.
+		int pending; // Number of code points in buf.
+		int next_pending; // The next one of them to return.
+		bool turkic;
+	};
+
+	// Skip the 16 byte blocks of ASCII that are the same in both folders once folded.
+	inline void skip_equal_ascii(utf8_case_folder& a, utf8_case_folder& b)
+	{
+#ifdef BOOST_UNICODE_HAS_SSE2
+		if(!a.between() || !b.between() || a.is_turkic())
+			return;
+
+		std::size_t n = 0;
+		const boost::uint8_t* x = a.position();
+		const boost::uint8_t* y = b.position();
+		std::size_t left = a.end() - x < b.end() - y ? a.end() - x : b.end() - y;
+
+		for(; left - n >= 16; n += 16)
+		{
+			__m128i u = _mm_loadu_si128((const __m128i*)(x + n));
+			__m128i v = _mm_loadu_si128((const __m128i*)(y + n));
+
+			if(_mm_movemask_epi8(_mm_or_si128(u, v))
+				|| _mm_movemask_epi8(_mm_cmpeq_epi8(fold_ascii16(u), fold_ascii16(v))) != 0xFFFF)
+				break;
+		}
+
+		a.skip(n);
+		b.skip(n);
+#endif
+	}
+
+	// Compare two well-formed UTF-8 strings without regard to case, as if both were
+	// fully case folded first. Equal ASCII is compared 16 bytes at a time.
+	inline int compare_folded_utf8(const boost::uint8_t* a_first, const boost::uint8_t* a_last,
+		const boost::uint8_t* b_first, const boost::uint8_t* b_last, bool turkic=false)
+	{
+		utf8_case_folder a(a_first, a_last, turkic);
+		utf8_case_folder b(b_first, b_last, turkic);
+
+		// Blocks are only tried again after this many characters since the last try
+		// that didn't skip anything, so text that isn't ASCII isn't slowed down.
+		int wait = 0;
+
+		for(;;)
+		{
+			if(wait)
+				--wait;
+			else
+			{
+				const boost::uint8_t* before = a.position();
+				skip_equal_ascii(a, b);
+				wait = a.position() == before ? 16 : 0;
+			}
+
+			boost::int_fast32_t x = a.next();
+			boost::int_fast32_t y = b.next();
+
+			if(x != y)
+				return x < y ? -1 : 1; // The end (-1) is less than anything.
+
+			if(x < 0)
+				return 0;
+		}
+	}
+
+	// FNV-1a hash of the full case folding of well-formed UTF-8, so strings that compare
+	// equal with compare_folded_utf8() hash the same.
+	inline std::size_t hash_folded_utf8(const boost::uint8_t* first, const boost::uint8_t* last, bool turkic=false)
+	{
+		std::size_t h = 2166136261UL;
+		boost::uint32_t buf[max_case_folding];
+
+		while(first != last)
+		{
+			if(*first < 0x80 && !turkic)
+			{
+				h ^= fold_ascii(*first++);
+				h *= 16777619UL;
+				continue;
+			}
+
+			int n = fold_case_full(utf8_next(first), buf, turkic);
+
+			for(int i=0; i < n; ++i)
+			{
+				h ^= buf[i];
+				h *= 16777619UL;
+			}
+		}
+
+		return h;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Strings and views. A basic_ustring converts to a ustring_view, so the functions
+	// that take a view work for both.
+	//--------------------------------------------------------------------------------
+
+	// Compare without regard to case (using full case folding), without making folded copies.
+	inline int compare_nocase(const ustring_view& a, const ustring_view& b, bool turkic=false)
+	{
+		return compare_folded_utf8(a.data(), a.data() + a.bytes(), b.data(), b.data() + b.bytes(), turkic);
+	}
+
+	// A hash that is the same for strings that compare_nocase() says are equal.
+	inline std::size_t hash_nocase(const ustring_view& s, bool turkic=false)
+	{
+		return hash_folded_utf8(s.data(), s.data() + s.bytes(), turkic);
+	}
+
+	// A fully case folded copy of s.
+	template<class tpl_enc, class tpl_dec>
+	basic_ustring<tpl_enc, tpl_dec> fold_case(const basic_ustring<tpl_enc, tpl_dec>& s, bool turkic=false)
+	{
+		ustring_view v(s);
+		basic_ustring<tpl_enc, tpl_dec> ret;
+		utf8_case_folder f(v.data(), v.data() + v.bytes(), turkic);
+
+		for(boost::int_fast32_t c=f.next(); c >= 0; c=f.next())
+			ret.append((utf32_unit)c);
+
+		return ret;
+	}
+
+	// Function objects for containers keyed without regard to case, e.g.
+	// std::map<ustring_view, int, nocase_less> or
+	// boost::unordered_map<ustring_view, int, nocase_hash, nocase_equal>.
+	struct nocase_less
+	{
+		bool operator()(const ustring_view& a, const ustring_view& b) const
+		{
+			return compare_nocase(a, b) < 0;
+		}
+	};
+
+	struct nocase_equal
+	{
+		bool operator()(const ustring_view& a, const ustring_view& b) const
+		{
+			return compare_nocase(a, b) == 0;
+		}
+	};
+
+	struct nocase_hash
+	{
+		std::size_t operator()(const ustring_view& s) const
+		{
+			return hash_nocase(s);
+		}
+	};
+}
+
+#endif
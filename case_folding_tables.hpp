@@ -0,0 +1,251 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tables for case folding (see case_folding.hpp).
+// Generated by tools/ucdgen.py from the Unicode Character Database 14.0.0. Don't edit.
+// Tables: 4125 bytes.
+
+#ifndef BOOST_UNICODE_CASE_FOLDING_TABLES_HPP
+#define BOOST_UNICODE_CASE_FOLDING_TABLES_HPP
+
+#include <boost/cstdint.hpp>
+
+namespace unicode
+{
+	// The tables are static members of a class template so that they're only
+	// stored once however many translation units include this.
+	template<class T=void>
+	struct case_folding_data
+	{
+		static const boost::uint8_t case_folding_entry_stage1[245];
+		static const boost::uint8_t case_folding_entry_stage2[640];
+		static const boost::uint8_t case_folding_entry_stage3[1376];
+		static const boost::int32_t case_folding_delta[201];
+		static const boost::uint16_t case_folding_full[201];
+		static const boost::uint16_t case_folding_pool[329];
+	};
+
+	template<class T> const boost::uint8_t case_folding_data<T>::case_folding_entry_stage1[245] = {
+		0,1,2,3,3,3,3,3,4,5,3,3,3,3,6,7,
+		8,3,9,3,3,3,10,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,11,3,12,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,13,3,14,
+		3,3,15,3,3,3,16,3,3,3,3,3,17,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,18,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,3,3,19
+	};
+
+	template<class T> const boost::uint8_t case_folding_data<T>::case_folding_entry_stage2[640] = {
+		0,0,0,0,1,2,0,0,0,0,0,3,4,5,0,0,
+		6,6,6,7,8,6,6,9,10,11,12,13,14,15,6,16,
+		6,6,17,18,19,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,20,0,0,21,22,23,24,25,26,27,6,28,
+		29,4,4,0,0,0,6,6,30,6,6,6,31,6,6,6,
+		6,6,6,32,33,34,0,0,35,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,36,36,37,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,
+		0,0,0,0,0,0,0,0,39,40,40,41,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		6,6,6,6,6,6,6,6,6,42,6,6,6,6,6,6,
+		43,38,43,43,38,44,43,0,45,46,47,48,49,50,51,52,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,53,54,0,0,55,0,56,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,57,58,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		33,33,33,0,0,0,59,60,6,6,6,6,6,6,61,62,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,6,6,63,0,6,64,0,0,0,0,0,0,
+		0,0,65,65,6,6,6,66,67,68,69,70,71,72,0,73,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,74,74,74,74,74,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,
+		77,77,78,0,0,0,0,0,0,0,0,77,77,79,0,0,
+		0,0,0,0,0,0,0,80,80,81,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,82,82,82,83,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,4,4,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		84,84,85,0,0,0,0,0,0,0,0,0,0,0,0,0
+	};
+
+	template<class T> const boost::uint8_t case_folding_data<T>::case_folding_entry_stage3[1376] = {
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+		0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,3,
+		4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,
+		5,0,4,0,4,0,4,0,0,4,0,4,0,4,0,4,
+		0,4,0,4,0,4,0,4,0,6,4,0,4,0,4,0,
+		4,0,4,0,4,0,4,0,7,4,0,4,0,4,0,8,
+		0,9,4,0,4,0,10,4,0,11,11,4,0,0,12,13,
+		14,4,0,11,15,0,16,17,4,0,0,0,16,18,0,19,
+		4,0,4,0,4,0,20,4,0,20,0,0,4,0,20,4,
+		0,21,21,4,0,4,0,22,4,0,0,0,4,0,0,0,
+		0,0,0,0,23,4,0,23,4,0,23,4,0,4,0,4,
+		0,4,0,4,0,4,0,4,0,4,0,4,0,0,4,0,
+		24,23,4,0,4,0,25,26,4,0,4,0,4,0,4,0,
+		27,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,
+		4,0,4,0,0,0,0,0,0,0,28,4,0,29,30,0,
+		0,4,0,31,32,33,4,0,4,0,4,0,4,0,4,0,
+		0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,
+		4,0,4,0,0,0,4,0,0,0,0,0,0,0,0,34,
+		0,0,0,0,0,0,35,0,36,36,36,0,37,0,38,38,
+		39,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,0,1,1,1,1,1,1,1,1,1,0,0,0,0,
+		40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,41,
+		42,43,0,0,0,44,45,0,4,0,4,0,4,0,4,0,
+		46,47,0,0,48,49,0,4,0,50,4,0,0,27,27,27,
+		51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+		4,0,0,0,0,0,0,0,0,0,4,0,4,0,4,0,
+		52,4,0,4,0,4,0,4,0,4,0,4,0,4,0,0,
+		0,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+		53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+		53,53,53,53,53,53,53,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,
+		55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+		55,55,55,55,55,55,0,55,0,0,0,0,0,55,0,0,
+		0,0,0,0,0,0,0,0,56,56,56,56,56,56,0,0,
+		57,58,59,60,60,61,62,63,64,0,0,0,0,0,0,0,
+		65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+		65,65,65,65,65,65,65,65,65,65,65,0,0,65,65,65,
+		4,0,4,0,4,0,66,67,68,69,70,71,0,0,72,0,
+		0,0,0,0,0,0,0,0,56,56,56,56,56,56,56,56,
+		73,0,74,0,75,0,76,0,0,56,0,56,0,56,0,56,
+		77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,
+		93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,
+		109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,
+		0,0,125,126,127,0,128,129,56,56,130,130,131,0,132,0,
+		0,0,133,134,135,0,136,137,138,138,138,138,139,0,0,0,
+		0,0,140,141,0,0,142,143,56,56,144,144,0,0,0,0,
+		0,0,145,146,147,0,148,149,56,56,150,150,50,0,0,0,
+		0,0,151,152,153,0,154,155,156,156,157,157,158,0,0,0,
+		0,0,0,0,0,0,159,0,0,0,160,161,0,0,0,0,
+		0,0,162,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,
+		0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,164,164,164,164,164,164,164,164,164,164,
+		164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,
+		4,0,165,166,167,0,0,4,0,4,0,4,0,168,169,170,
+		171,0,4,0,0,4,0,0,0,0,0,0,0,0,172,172,
+		4,0,4,0,0,0,0,0,0,0,0,4,0,4,0,0,
+		0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		4,0,4,0,4,0,4,0,4,0,4,0,4,0,0,0,
+		4,0,4,0,4,0,4,0,4,0,4,0,0,0,0,0,
+		0,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,
+		0,0,0,0,0,0,0,0,0,4,0,4,0,173,4,0,
+		4,0,4,0,4,0,4,0,0,0,0,4,0,174,0,0,
+		4,0,4,0,0,0,4,0,4,0,4,0,4,0,4,0,
+		4,0,4,0,4,0,4,0,4,0,175,176,177,178,175,0,
+		179,180,181,182,4,0,4,0,4,0,4,0,4,0,4,0,
+		4,0,4,0,47,183,184,4,0,4,0,0,0,0,0,0,
+		4,0,0,0,0,0,4,0,4,0,0,0,0,0,0,0,
+		0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		186,187,188,189,190,191,192,0,0,0,0,0,0,0,0,0,
+		0,0,0,193,194,195,196,197,0,0,0,0,0,0,0,0,
+		198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,
+		198,198,198,198,198,198,198,198,0,0,0,0,0,0,0,0,
+		198,198,198,198,0,0,0,0,0,0,0,0,0,0,0,0,
+		199,199,199,199,199,199,199,199,199,199,199,0,199,199,199,199,
+		199,199,199,0,199,199,0,0,0,0,0,0,0,0,0,0,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,
+		200,200,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+	};
+
+	template<class T> const boost::int32_t case_folding_data<T>::case_folding_delta[201] = {
+		0,32,775,0,1,0,0,-121,-268,210,206,205,
+		79,202,203,207,211,209,213,214,218,217,219,2,
+		0,-97,-56,-130,10795,-163,10792,-195,69,71,116,38,
+		37,64,63,0,0,8,-30,-25,-15,-22,-54,-48,
+		-60,-64,-7,80,15,48,0,7264,-8,-6222,-6221,-6212,
+		-6210,-6211,-6204,-6180,35267,-3008,0,0,0,0,0,-58,
+		-7615,0,0,0,0,0,0,0,0,0,0,0,
+		0,-8,-8,-8,-8,-8,-8,-8,-8,0,0,0,
+		0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,
+		-8,0,0,0,0,0,0,0,0,-8,-8,-8,
+		-8,-8,-8,-8,-8,0,0,0,0,0,-74,-9,
+		-7173,0,0,0,0,0,-86,-9,0,0,0,0,
+		-100,0,0,0,0,0,-112,0,0,0,0,0,
+		-128,-126,-9,-7517,-8383,-8262,28,16,26,-10743,-3814,-10727,
+		-10780,-10749,-10783,-10782,-10815,-35332,-42280,-42308,-42319,-42315,-42305,-42258,
+		-42282,-42261,928,-42307,-35384,-38864,0,0,0,0,0,0,
+		0,0,0,0,0,0,40,39,34
+	};
+
+	template<class T> const boost::uint16_t case_folding_data<T>::case_folding_full[201] = {
+		0,0,0,1,0,4,7,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,13,17,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,21,0,0,0,0,0,0,0,0,0,
+		0,0,24,27,30,33,36,0,39,42,45,49,53,57,60,63,
+		66,69,72,75,78,81,84,87,90,93,96,99,102,105,108,111,
+		114,117,120,123,126,129,132,135,138,141,144,147,150,153,156,159,
+		162,165,168,171,174,177,180,183,186,189,192,195,198,201,204,207,
+		210,213,0,217,0,220,223,226,229,232,0,236,239,243,247,250,
+		0,254,258,262,265,268,0,272,275,278,281,284,0,0,288,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,291,294,297,300,304,308,
+		311,314,317,320,323,326,0,0,0
+	};
+
+	template<class T> const boost::uint16_t case_folding_data<T>::case_folding_pool[329] = {
+		0,2,115,115,2,105,775,2,700,110,2,106,780,3,953,776,
+		769,3,965,776,769,2,1381,1410,2,104,817,2,116,776,2,119,
+		778,2,121,778,2,97,702,2,115,115,2,965,787,3,965,787,
+		768,3,965,787,769,3,965,787,834,2,7936,953,2,7937,953,2,
+		7938,953,2,7939,953,2,7940,953,2,7941,953,2,7942,953,2,7943,
+		953,2,7936,953,2,7937,953,2,7938,953,2,7939,953,2,7940,953,
+		2,7941,953,2,7942,953,2,7943,953,2,7968,953,2,7969,953,2,
+		7970,953,2,7971,953,2,7972,953,2,7973,953,2,7974,953,2,7975,
+		953,2,7968,953,2,7969,953,2,7970,953,2,7971,953,2,7972,953,
+		2,7973,953,2,7974,953,2,7975,953,2,8032,953,2,8033,953,2,
+		8034,953,2,8035,953,2,8036,953,2,8037,953,2,8038,953,2,8039,
+		953,2,8032,953,2,8033,953,2,8034,953,2,8035,953,2,8036,953,
+		2,8037,953,2,8038,953,2,8039,953,2,8048,953,2,945,953,2,
+		940,953,2,945,834,3,945,834,953,2,945,953,2,8052,953,2,
+		951,953,2,942,953,2,951,834,3,951,834,953,2,951,953,3,
+		953,776,768,3,953,776,769,2,953,834,3,953,776,834,3,965,
+		776,768,3,965,776,769,2,961,787,2,965,834,3,965,776,834,
+		2,8060,953,2,969,953,2,974,953,2,969,834,3,969,834,953,
+		2,969,953,2,102,102,2,102,105,2,102,108,3,102,102,105,
+		3,102,102,108,2,115,116,2,115,116,2,1396,1398,2,1396,1381,
+		2,1396,1387,2,1406,1398,2,1396,1389
+	};
+
+	// Index into case_folding_delta and case_folding_full, or 0 if the character doesn't fold.
+	inline boost::uint8_t case_folding_entry(boost::uint32_t cp)
+	{
+		if(cp >= 0x1EA00) // Everything from here on has the same value.
+			return 0;
+
+		return case_folding_data<>::case_folding_entry_stage3[(case_folding_data<>::case_folding_entry_stage2[(case_folding_data<>::case_folding_entry_stage1[cp >> 9] << 5) + ((cp >> 4) & 0x1F)] << 4) + (cp & 0xF)];
+	}
+}
+
+#endif
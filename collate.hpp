@@ -0,0 +1,400 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_COLLATE_HPP
+#define BOOST_UNICODE_COLLATE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "collation_tables.hpp"
+#include "normalize.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// The Unicode Collation Algorithm with the Default Unicode Collation Element Table
+	// (see UTS #10, http://www.unicode.org/reports/tr10/). Strings are turned into sort
+	// keys, byte strings that compare with memcmp() (or std::vector's operator<) in the
+	// same order as the strings collate, so sorting many strings only has to work out
+	// each key once.
+	//================================================================================
+
+	// How many levels of differences count.
+	enum collation_strength
+	{
+		collation_primary = 1, // Letters only: "a" = "A" = "á".
+		collation_secondary, // And accents: "a" = "A" < "á".
+		collation_tertiary, // And case: "a" < "A" < "á".
+		collation_quaternary // And, with variable_shifted, punctuation: "a-b" < "ab".
+	};
+
+	// What to do with variable collation elements (spaces, punctuation and symbols).
+	enum variable_weighting
+	{
+		variable_non_ignorable, // They sort like letters, before them.
+		variable_shifted // They only count at the quaternary level: "a-b" < "ab" < "abc".
+	};
+
+	struct collation_element
+	{
+		boost::uint16_t primary;
+		boost::uint8_t secondary; // Ranked, so it fits in a byte (see tools/ucdgen.py).
+		boost::uint8_t tertiary;
+	};
+
+	// A sort key. Keys compare like the strings they were made from collate.
+	typedef std::vector<boost::uint8_t> collation_key;
+
+	// Append the collation elements stored at p in collation_pool.
+	inline void collation_decode(const boost::uint16_t* p, std::vector<collation_element>& out)
+	{
+		typedef collation_data<> data;
+
+		for(;;)
+		{
+			unsigned u = *p++;
+			collation_element e;
+
+			if(u < data::long_first)
+			{
+				// Just a primary, with the common secondary and tertiary.
+				bool last = u >= data::short_last;
+				e.primary = (boost::uint16_t)(last ? u - data::short_last : u);
+				e.secondary = data::common_secondary;
+				e.tertiary = 2;
+				out.push_back(e);
+
+				if(last)
+					return;
+			}
+			else
+			{
+				e.tertiary = (boost::uint8_t)(u >> 8 & 0x1F);
+				e.secondary = (boost::uint8_t)u;
+				e.primary = *p++;
+				out.push_back(e);
+
+				if(u & data::last_flag)
+					return;
+			}
+		}
+	}
+
+	// Append the implicit weights of a character that isn't in the table.
+	inline void collation_implicit(boost::uint32_t cp, std::vector<collation_element>& out)
+	{
+		typedef collation_data<> data;
+
+		boost::uint32_t aaaa = 0xFBC0 + (cp >> 15);
+		boost::uint32_t bbbb = (cp & 0x7FFF) | 0x8000;
+
+		for(int i=0; i < data::implicit_count; ++i)
+		{
+			if(cp >= data::implicit_first[i] && cp <= data::implicit_last[i])
+			{
+				// Ranges with the same base (Tangut and the Tangut Supplement) all count
+				// from the start of the first one.
+				boost::uint32_t origin = data::implicit_first[i];
+
+				for(int j=0; j < data::implicit_count; ++j)
+				{
+					if(data::implicit_base[j] == data::implicit_base[i] && data::implicit_first[j] < origin)
+						origin = data::implicit_first[j];
+				}
+
+				aaaa = data::implicit_base[i];
+				bbbb = (cp - origin) | 0x8000;
+			}
+		}
+
+		for(int i=0; i < data::ideograph_count; ++i)
+		{
+			if(cp >= data::ideograph_first[i] && cp <= data::ideograph_last[i])
+				aaaa = (data::ideograph_core[i] ? 0xFB40 : 0xFB80) + (cp >> 15);
+		}
+
+		collation_element e;
+		e.primary = (boost::uint16_t)aaaa;
+		e.secondary = data::common_secondary;
+		e.tertiary = 2;
+		out.push_back(e);
+
+		e.primary = (boost::uint16_t)bbbb;
+		e.secondary = 0;
+		e.tertiary = 0;
+		out.push_back(e);
+	}
+
+	// Index of the contraction of a, b and c (0 for a contraction of two), or -1.
+	inline int find_contraction(boost::uint32_t a, boost::uint32_t b, boost::uint32_t c)
+	{
+		typedef collation_data<> data;
+
+		int lo = 0, hi = data::contraction_count;
+
+		while(lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+			const boost::uint32_t* m = &data::contraction_chars[mid * 3];
+
+			if(m[0] < a || (m[0] == a && (m[1] < b || (m[1] == b && m[2] < c))))
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		if(lo < data::contraction_count)
+		{
+			const boost::uint32_t* m = &data::contraction_chars[lo * 3];
+
+			if(m[0] == a && m[1] == b && m[2] == c)
+				return lo;
+		}
+
+		return -1;
+	}
+
+	// Append the collation elements of s, which has to be in NFD. Characters that
+	// are matched out of order (by discontiguous contractions) are overwritten.
+	inline void collation_elements(std::vector<boost::uint32_t>& s, std::vector<collation_element>& out)
+	{
+		typedef collation_data<> data;
+
+		// Marks a character that has already been matched.
+		const boost::uint32_t matched = 0xFFFFFFFF;
+
+		for(std::size_t i=0; i < s.size(); ++i)
+		{
+			boost::uint32_t cp = s[i];
+
+			if(cp == matched)
+				continue;
+
+			boost::uint16_t offset = collation_offset(cp);
+
+			if(!offset)
+			{
+				collation_implicit(cp, out);
+				continue;
+			}
+
+			const boost::uint16_t* p = &data::collation_pool[offset];
+
+			if(*p != data::contraction_marker)
+			{
+				collation_decode(p, out);
+				continue;
+			}
+
+			// The longest contraction of the characters that follow...
+			boost::uint32_t chars[3] = { cp, 0, 0 };
+			int length = 1;
+			int match = -1;
+
+			if(i + 2 < s.size() && (match = find_contraction(cp, s[i+1], s[i+2])) >= 0)
+				length = 3;
+			else if(i + 1 < s.size() && (match = find_contraction(cp, s[i+1], 0)) >= 0)
+				length = 2;
+
+			for(int k=1; k < length; ++k)
+				chars[k] = s[i+k];
+
+			int contiguous = length;
+
+			// ...extended by combining marks after it that aren't blocked from it by
+			// another one of the same or a higher combining class.
+			int blocking = 0;
+
+			for(std::size_t j=i+length; j < s.size() && length < 3; ++j)
+			{
+				if(s[j] == matched)
+					continue;
+
+				int ccc = combining_class(s[j]);
+
+				if(!ccc)
+					break;
+
+				if(blocking < ccc)
+				{
+					chars[length] = s[j];
+					int m = find_contraction(chars[0], chars[1], chars[2]);
+
+					if(m >= 0)
+					{
+						match = m;
+						++length;
+						s[j] = matched;
+						continue;
+					}
+
+					chars[length] = 0;
+				}
+
+				blocking = ccc > blocking ? ccc : blocking;
+			}
+
+			if(match < 0)
+			{
+				collation_decode(p + 1, out);
+				continue;
+			}
+
+			collation_decode(&data::collation_pool[data::contraction_offset[match]], out);
+			i += contiguous - 1;
+		}
+	}
+
+	//--------------------------------------------------------------------------------
+	// Sort keys
+	//--------------------------------------------------------------------------------
+
+	// Make the sort key of collation elements. Levels are separated by a 0 byte, and
+	// are made of 2 byte primaries, 1 byte secondaries, 1 byte tertiaries and (with
+	// variable_shifted) 2 byte quaternaries, none of which start with 0.
+	inline void make_sort_key(const std::vector<collation_element>& elements, collation_key& key,
+		collation_strength strength=collation_tertiary, variable_weighting weighting=variable_non_ignorable)
+	{
+		typedef collation_data<> data;
+
+		key.clear();
+		std::size_t n = elements.size();
+
+		// With variable_shifted, a variable element (and any ignorables after it) only
+		// counts at the quaternary level.
+		std::vector<bool> shifted;
+		if(weighting == variable_shifted)
+		{
+			shifted.resize(n);
+			bool after_variable = false;
+
+			for(std::size_t i=0; i < n; ++i)
+			{
+				const collation_element& e = elements[i];
+
+				if(e.primary && e.primary <= data::variable_top)
+					shifted[i] = after_variable = true;
+				else if(!e.primary && after_variable)
+					shifted[i] = true;
+				else if(e.primary)
+					after_variable = false;
+			}
+		}
+
+		for(std::size_t i=0; i < n; ++i)
+		{
+			if(elements[i].primary && (shifted.empty() || !shifted[i]))
+			{
+				key.push_back((boost::uint8_t)(elements[i].primary >> 8));
+				key.push_back((boost::uint8_t)elements[i].primary);
+			}
+		}
+
+		if(strength >= collation_secondary)
+		{
+			key.push_back(0);
+
+			for(std::size_t i=0; i < n; ++i)
+				if(elements[i].secondary && (shifted.empty() || !shifted[i]))
+					key.push_back(elements[i].secondary);
+		}
+
+		if(strength >= collation_tertiary)
+		{
+			key.push_back(0);
+
+			for(std::size_t i=0; i < n; ++i)
+				if(elements[i].tertiary && (shifted.empty() || !shifted[i]))
+					key.push_back(elements[i].tertiary);
+		}
+
+		if(strength >= collation_quaternary && weighting == variable_shifted)
+		{
+			key.push_back(0);
+
+			for(std::size_t i=0; i < n; ++i)
+			{
+				const collation_element& e = elements[i];
+				boost::uint16_t q;
+
+				if(shifted[i])
+					q = e.primary; // 0 for an ignorable after a variable.
+				else if(e.primary || e.secondary || e.tertiary)
+					q = 0xFFFF;
+				else
+					q = 0;
+
+				if(q)
+				{
+					key.push_back((boost::uint8_t)(q >> 8));
+					key.push_back((boost::uint8_t)q);
+				}
+			}
+		}
+	}
+
+	// Make the sort key of the code points in [first, last).
+	inline void make_sort_key(const boost::uint32_t* first, const boost::uint32_t* last, collation_key& key,
+		collation_strength strength=collation_tertiary, variable_weighting weighting=variable_non_ignorable)
+	{
+		std::vector<boost::uint32_t> s;
+
+		if(quick_check(first, last, nfd) == quick_check_yes)
+			s.assign(first, last);
+		else
+			normalize(first, last, nfd, s);
+
+		std::vector<collation_element> elements;
+		elements.reserve(s.size() + 4);
+		collation_elements(s, elements);
+		make_sort_key(elements, key, strength, weighting);
+	}
+
+	// Compare sort keys: less than 0 if a sorts first, 0 if they're equal, and greater than 0 if b sorts first.
+	inline int compare_sort_keys(const collation_key& a, const collation_key& b)
+	{
+		std::size_t n = a.size() < b.size() ? a.size() : b.size();
+		int ret = n ? std::memcmp(&a[0], &b[0], n) : 0;
+
+		if(ret)
+			return ret < 0 ? -1 : 1;
+
+		return a.size() < b.size() ? -1 : a.size() > b.size() ? 1 : 0;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Strings and views. A basic_ustring converts to a ustring_view, so the functions
+	// that take a view work for both.
+	//--------------------------------------------------------------------------------
+
+	// The sort key of s. Sorting keys with memcmp() gives the same order as
+	// compare_collated(), but each string is only worked out once.
+	inline collation_key sort_key(const ustring_view& s, collation_strength strength=collation_tertiary,
+		variable_weighting weighting=variable_non_ignorable)
+	{
+		std::vector<boost::uint32_t> in;
+		in.reserve(s.bytes());
+
+		for(ustring_view::iterator i=s.begin(); i != s.end(); ++i)
+			in.push_back(*i);
+
+		collation_key ret;
+		const boost::uint32_t* first = in.empty() ? 0 : &in[0];
+		make_sort_key(first, first + in.size(), ret, strength, weighting);
+		return ret;
+	}
+
+	// Compare in the order people expect (e.g. "a" < "B" < "\u00E9" < "f"), rather than by code point.
+	inline int compare_collated(const ustring_view& a, const ustring_view& b, collation_strength strength=collation_tertiary,
+		variable_weighting weighting=variable_non_ignorable)
+	{
+		return compare_sort_keys(sort_key(a, strength, weighting), sort_key(b, strength, weighting));
+	}
+}
+
+#endif
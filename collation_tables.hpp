@@ -0,0 +1,5628 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tables for collation (see collate.hpp).
+// Generated by tools/ucdgen.py from the Unicode Character Database 14.0.0. Don't edit.
+// Tables: 179960 bytes.
+
+#ifndef BOOST_UNICODE_COLLATION_TABLES_HPP
+#define BOOST_UNICODE_COLLATION_TABLES_HPP
+
+#include <boost/cstdint.hpp>
+
+namespace unicode
+{
+	// The tables are static members of a class template so that they're only
+	// stored once however many translation units include this.
+	template<class T=void>
+	struct collation_data
+	{
+		static const boost::uint8_t collation_offset_stage1[897];
+		static const boost::uint16_t collation_offset_stage2[1568];
+		static const boost::uint16_t collation_offset_stage3[35008];
+		static const int variable_top = 8005;
+		static const int short_last = 24576;
+		static const int long_first = 49152;
+		static const int last_flag = 8192;
+		static const int contraction_marker = 49151;
+		static const int common_secondary = 1;
+		static const boost::uint16_t collation_pool[46295];
+		static const int contraction_count = 939;
+		static const boost::uint32_t contraction_chars[2817];
+		static const boost::uint16_t contraction_offset[939];
+		static const int implicit_count = 4;
+		static const boost::uint32_t implicit_first[4];
+		static const boost::uint32_t implicit_last[4];
+		static const boost::uint16_t implicit_base[4];
+		static const int ideograph_count = 15;
+		static const boost::uint32_t ideograph_first[15];
+		static const boost::uint32_t ideograph_last[15];
+		static const boost::uint8_t ideograph_core[15];
+	};
+
+	template<class T> const boost::uint8_t collation_data<T>::collation_offset_stage1[897] = {
+		0,1,2,3,4,5,6,7,8,9,10,11,12,13,13,13,
+		13,13,13,14,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,15,16,17,13,13,13,13,13,
+		13,13,13,13,13,18,13,13,13,13,13,13,13,13,19,20,
+		21,22,23,24,25,26,27,28,29,30,13,13,31,32,13,13,
+		13,33,13,13,13,13,13,13,13,13,34,35,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,36,13,13,37,
+		13,13,13,13,38,39,40,13,41,13,42,43,44,45,46,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,47,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		48
+	};
+
+	template<class T> const boost::uint16_t collation_data<T>::collation_offset_stage2[1568] = {
+		0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+		16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+		32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,
+		48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+		64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,
+		80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,
+		96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,
+		112,113,114,68,115,116,117,68,118,119,120,121,122,123,124,68,
+		125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,
+		141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,
+		157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,
+		173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,
+		189,190,191,192,193,194,195,196,197,198,199,200,201,202,203,204,
+		205,206,207,208,188,209,210,68,211,212,213,214,215,216,217,218,
+		219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,
+		235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,
+		251,252,253,254,255,256,257,258,259,260,261,262,263,264,265,266,
+		267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,
+		283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,
+		299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,
+		315,316,317,318,319,320,321,322,323,324,325,326,327,328,329,330,
+		331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,
+		347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,
+		363,364,365,68,366,367,368,369,370,371,372,373,374,375,376,377,
+		378,379,380,381,382,383,384,385,386,387,388,389,390,391,392,393,
+		394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,410,411,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,
+		428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,
+		444,445,446,447,448,449,450,451,452,453,454,455,456,457,458,459,
+		460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,
+		476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,
+		492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,508,509,510,
+		68,68,68,68,68,68,68,68,511,512,513,514,515,516,517,518,
+		519,520,521,522,523,524,525,68,526,527,528,529,530,531,532,533,
+		534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,
+		550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,
+		566,567,568,68,569,570,571,572,573,574,575,576,577,578,579,580,
+		68,68,68,68,581,582,583,584,585,586,587,588,589,590,591,68,
+		592,593,594,595,596,597,598,599,600,601,602,603,68,68,68,68,
+		604,605,606,607,608,609,610,611,612,613,614,615,68,68,68,68,
+		616,617,618,619,620,621,68,622,623,624,68,68,625,626,627,628,
+		629,630,631,632,633,68,634,635,636,637,638,639,640,641,68,68,
+		642,643,644,68,645,646,647,648,649,650,68,68,68,68,68,68,
+		68,68,68,651,652,653,68,68,654,655,656,68,68,657,658,659,
+		660,661,662,663,664,665,666,667,668,669,670,671,672,673,674,675,
+		676,677,68,68,678,679,680,681,682,683,684,685,68,68,68,68,
+		686,687,688,689,690,691,692,68,68,68,68,68,693,694,695,68,
+		696,697,698,699,700,701,702,68,703,704,68,68,68,68,68,68,
+		705,706,68,68,68,707,708,709,710,711,712,68,68,713,714,715,
+		716,717,718,719,720,721,722,723,68,68,68,68,68,68,68,68,
+		724,725,726,727,728,729,68,68,730,731,732,733,734,702,68,68,
+		68,68,68,68,68,68,68,735,68,68,68,68,68,736,737,738,
+		739,740,741,742,743,744,745,746,747,748,749,750,751,752,753,754,
+		755,756,757,758,759,760,761,762,763,764,765,766,767,68,68,68,
+		768,769,770,771,772,773,774,775,776,777,778,68,68,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		779,780,781,782,783,784,785,786,787,788,789,790,791,792,793,794,
+		795,796,797,798,799,800,801,802,803,804,805,806,807,808,809,810,
+		811,812,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		813,814,815,816,817,818,819,820,821,822,823,824,825,826,827,828,
+		829,830,831,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		832,833,834,835,836,837,838,839,840,841,842,843,844,845,846,847,
+		848,849,850,851,68,68,852,853,854,855,856,857,858,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		68,68,859,860,861,68,68,68,862,863,864,865,866,68,68,867,
+		868,869,870,871,872,873,874,875,876,68,877,878,68,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		879,880,881,882,883,884,68,68,68,68,68,68,68,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		885,886,887,888,889,890,891,892,893,894,895,896,897,898,899,900,
+		901,902,903,68,68,68,68,904,905,906,907,908,68,68,68,68,
+		909,910,911,912,913,914,915,916,917,918,919,920,921,909,910,922,
+		912,923,924,925,916,926,927,928,929,930,931,932,933,934,935,936,
+		937,938,939,940,941,942,943,944,945,946,947,948,949,950,951,952,
+		953,954,953,955,956,957,68,68,68,68,68,68,68,68,68,68,
+		958,959,68,68,68,68,68,68,960,961,962,68,68,68,68,68,
+		68,68,68,68,68,68,963,964,68,68,68,68,68,68,68,68,
+		965,966,967,968,969,970,971,68,972,973,974,68,68,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		68,68,68,975,976,977,68,68,978,979,68,68,68,68,68,68,
+		980,981,982,983,984,985,68,986,68,68,68,68,68,68,68,68,
+		987,988,989,990,991,992,993,994,995,996,997,998,999,1000,68,1001,
+		1002,1003,1004,1005,68,68,68,68,1006,1007,1008,1009,1010,1011,1012,1013,
+		1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1028,1029,
+		1030,1031,1032,1033,1034,1035,1036,1037,1038,1039,1040,1041,1042,1043,1044,1045,
+		1046,1047,1048,1049,1050,1051,68,68,1052,1053,1054,1055,1056,1057,1058,1059,
+		1060,1061,1062,1063,1064,1065,1066,68,1067,1068,1069,1070,1071,1072,1073,1074,
+		1075,1076,1077,1078,1079,1080,1081,1082,1083,1084,1085,1086,1087,1088,1089,1090,
+		1091,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		1092,953,953,953,68,68,68,68,953,953,953,953,953,953,953,1093,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68
+	};
+
+	template<class T> const boost::uint16_t collation_data<T>::collation_offset_stage3[35008] = {
+		1,1,1,1,1,1,1,1,1,3,4,5,6,7,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		8,9,10,11,8659,12,13,14,15,16,17,18,19,20,21,22,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,23,24,25,26,27,28,
+		29,10041,10522,10608,10791,10995,11295,11407,11560,11733,11972,12033,12208,12429,12619,12807,
+		13266,13402,13449,13648,13880,14043,14407,14538,14640,14719,14832,30,31,32,33,34,
+		35,10026,10507,10593,10776,10980,11280,11392,11545,11718,11959,12018,12192,12414,12604,12792,
+		13251,13389,13434,13633,13865,14028,14392,14523,14625,14706,14817,36,37,38,39,1,
+		1,1,1,1,1,40,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		41,43,8656,8664,8655,8667,44,45,46,47,10055,48,49,1,50,51,
+		52,53,9258,9519,54,15850,55,56,57,8777,12821,58,8995,8899,9566,59,
+		10071,10064,10129,10231,10209,10187,10352,10667,11025,11018,11039,11097,11765,11758,11779,11793,
+		10866,12663,12837,12830,12851,12942,12913,60,13000,14073,14066,14087,14112,14740,14942,13810,
+		10068,10061,10126,10228,10202,10184,10346,10660,11022,11015,11036,11094,11762,11755,11776,11790,
+		10862,12660,12834,12827,12848,12939,12906,61,12997,14070,14063,14084,14105,14737,14941,14761,
+		10263,10260,10078,10075,10256,10253,10635,10632,10642,10639,10656,10653,10649,10646,10816,10813,
+		10837,10834,11143,11140,11032,11029,11111,11108,11136,11133,11090,11087,11442,11439,11435,11432,
+		11456,11453,11463,11460,11583,11580,11618,11615,11811,11808,11829,11826,11772,11769,11822,11819,
+		11815,11928,11900,11896,11995,11992,12070,12067,13433,12234,12231,12248,12245,12241,12238,12294,
+		12291,12255,12252,12642,12639,12677,12674,12656,12653,14998,12787,12786,13036,13033,12844,12841,
+		12935,12932,13173,13167,13472,13469,13493,13490,13479,13476,13677,13674,13695,13692,13727,13724,
+		13702,13699,13920,13917,13903,13900,14008,14007,14174,14171,14199,14196,14080,14077,14101,14098,
+		14167,14164,14192,14189,14573,14570,14754,14751,14764,14853,14850,14874,14871,14867,14864,13764,
+		10572,10583,10586,10585,14990,14989,13214,10765,10764,10968,10971,10975,10974,14892,11242,11250,
+		11258,11386,11385,11530,11538,11692,11954,11942,12175,12174,12378,12412,14377,12769,12773,13234,
+		13090,13087,11543,11542,13376,13375,13588,14984,14983,13855,13861,14014,14018,14017,14021,14242,
+		14239,14387,14509,14808,14807,14898,14897,14923,14936,14935,14939,14973,14987,14986,13986,14950,
+		15026,15027,15028,15029,10942,10936,10930,12306,12302,12298,12736,12732,12728,10180,10177,11786,
+		11783,12902,12899,14094,14091,14158,14153,14125,14120,14147,14142,14136,14131,11241,10222,10217,
+		10247,10242,10388,10380,11526,11525,11449,11446,12063,12060,13018,13015,13027,13022,14930,14927,
+		11999,10926,10922,10918,11428,11425,11693,14951,12649,12646,10196,10191,10372,10364,13009,13004,
+		10277,10274,10284,10281,11179,11176,11186,11183,11843,11840,11850,11847,13076,13073,13083,13080,
+		13508,13505,13515,13512,14228,14225,14235,14232,13760,13757,13934,13931,14815,14814,11590,11587,
+		12774,10977,13246,13245,14905,14904,10238,10235,11118,11115,12926,12921,12973,12968,12982,12979,
+		12991,12986,14785,14782,12406,12783,14023,12002,10886,13418,10476,10756,10755,12379,14011,13847,
+		14913,14994,14993,10573,14353,14519,11236,11235,12007,12006,13431,13430,13598,13597,14805,14804,
+		10487,10492,10501,10582,13213,10767,10967,10970,11265,11247,11266,11257,11267,11276,11277,12014,
+		11529,11516,11522,11537,11279,14369,11696,11715,11941,11953,11931,12384,12393,12402,12408,14376,
+		14383,12595,12768,12780,12760,13233,13204,13241,13385,13601,13605,13607,13611,13612,13616,13618,
+		13585,13624,13842,13852,12017,13862,13864,14025,14020,14352,14386,14508,14518,14620,12413,14803,
+		14907,14910,14922,14940,14992,15011,15025,15030,15031,10571,11278,11532,11691,12009,12189,12366,
+		13429,15023,15024,10918,10956,10952,13986,13994,13960,11366,12348,12362,15032,15033,14374,14375,
+		11574,11699,11986,13463,13602,13608,13625,14552,14733,62,63,11716,14997,11717,15003,15014,
+		14996,15015,64,65,66,67,68,69,70,71,72,73,74,75,76,77,
+		8613,8614,78,79,80,81,82,83,84,85,86,87,88,89,90,91,
+		11540,12225,13668,14656,15012,92,93,94,95,96,97,98,99,100,15002,101,
+		102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,
+		8053,8051,8057,8073,8083,8103,8055,8075,8065,8105,8061,8071,8059,8085,8085,8107,
+		8109,8111,8085,8047,8049,8085,8087,8087,8087,8087,8085,8113,8087,8087,8087,8087,
+		8087,8115,8117,8119,8121,8123,8125,8079,8081,8087,8087,8087,8087,8127,8129,8087,
+		8131,8133,8045,8087,8135,8101,8089,8089,8077,8137,8087,8087,8087,8085,8085,8085,
+		8053,8051,8063,8047,8067,8139,8085,8087,8087,8087,8085,8085,8085,8087,8087,1,
+		8085,8085,8085,8087,8087,8087,8087,8085,8141,8087,8087,8085,8087,8085,8085,8087,
+		8143,8145,8087,10029,10983,11721,12795,14031,10596,10779,11548,12417,13437,13868,14395,14628,
+		15422,15421,16457,16456,62,118,15409,15408,0,0,15676,16041,16038,16044,24,15818,
+		0,0,0,0,54,119,15236,56,15390,15626,15767,0,15972,0,16124,16416,
+		15795,15037,15291,15302,15314,15325,15417,15427,15667,15680,15825,15844,15854,15893,15900,15907,
+		15988,16007,0,16030,16050,16057,16187,16198,16209,16217,15791,16152,15233,15387,15623,15764,
+		16160,15034,15286,15299,15311,15320,15414,15424,15662,15675,15820,15841,15849,15890,15897,15904,
+		15983,16002,16036,16025,16047,16054,16182,16195,16206,16214,15788,16149,15969,16121,16413,15835,
+		15287,15663,16059,16128,16156,16183,15984,15829,16000,15999,15412,15411,15404,15401,15997,15996,
+		16454,16453,16562,16561,16577,16576,16580,16579,16589,16588,16610,16609,16619,16618,16631,16630,
+		15821,16003,16026,15817,15669,15321,122,16460,16459,16032,15994,15993,16024,16042,16039,16045,
+		16753,16767,16734,16698,16774,16829,16878,16887,16898,16957,17005,17092,16913,16856,17102,17240,
+		16651,16683,16688,16693,16725,16748,16779,16807,16850,16895,16908,16941,16971,16982,17013,17037,
+		17051,17062,17077,17097,17144,17149,17189,17206,17245,17253,17263,17273,17285,17301,17313,17324,
+		16648,16680,16685,16690,16722,16745,16776,16804,16846,16894,16905,16938,16968,16979,17010,17034,
+		17048,17059,17074,17094,17141,17146,17186,17203,17242,17250,17260,17270,17282,17300,17310,17323,
+		16750,16764,16733,16695,16771,16828,16877,16880,16897,16956,17004,17091,16910,16853,17099,17239,
+		17172,17169,17295,17292,17332,17329,17337,17334,17351,17350,17345,17342,17359,17356,17362,17361,
+		17365,17364,17370,17367,17373,17372,17378,17375,17139,17138,17184,17183,17181,17180,17175,17174,
+		17046,17045,123,8147,8085,8049,8047,8085,1,1,16875,16874,17290,17289,17054,17053,
+		16706,16702,16711,16710,16717,16716,16802,16801,16743,16742,16918,16917,16930,16929,16927,16926,
+		16924,16923,16993,16992,17002,17001,17043,17042,17386,17385,17072,17071,17086,17085,17128,17127,
+		17131,17130,17158,17157,17198,17197,17222,17221,17228,17227,17161,17160,17234,17233,17237,17236,
+		17392,16784,16781,16921,16920,16945,16944,16996,16995,16990,16989,17225,17224,16974,16973,17391,
+		16656,16653,16663,16660,16678,16677,16760,16757,16668,16667,16673,16670,16791,16788,16812,16809,
+		16835,16834,16870,16867,16863,16860,17020,17017,17025,17024,17030,17027,17306,17303,17123,17120,
+		17109,17106,17116,17113,17211,17208,16720,16719,17278,17275,16714,16713,17152,17151,17155,17154,
+		16728,16727,16740,16739,16820,16819,16841,16840,16963,16962,17008,17007,17069,17068,17083,17082,
+		16823,16822,16951,16950,16966,16965,17057,17056,17327,17326,16936,16935,17389,17388,16933,16932,
+		16954,16953,16999,16998,17040,17039,17164,17163,16987,16986,16796,16795,17216,17215,16948,16947,
+		0,17920,17924,17927,17930,17933,17940,17943,17946,17949,17952,17955,17958,17961,17964,17967,
+		17970,17973,17976,17979,17982,18001,18005,18008,18011,18014,18017,18020,18023,18026,18029,18036,
+		18039,18042,18045,18048,18051,18054,18057,0,0,18059,124,125,126,127,128,129,
+		17922,17919,17923,17926,17929,17932,17939,17942,17945,17948,17951,17954,17957,17960,17963,17966,
+		17969,17972,17975,17978,17981,18000,18004,18007,18010,18013,18016,18019,18022,18025,18028,18035,
+		18038,18041,18044,18047,18050,18053,18056,17935,18003,130,131,0,0,132,133,8670,
+		0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		8151,8153,8155,8157,8159,8161,8163,8165,8167,8169,8169,8171,8177,1,134,8179,
+		135,8175,8173,136,1,1,137,8167,0,0,0,0,0,0,0,0,
+		18060,18078,18087,18093,18101,18107,18122,18126,18127,18131,18159,18156,18171,18180,18177,18186,
+		18185,18191,18195,18199,18198,18212,18211,18217,18221,18227,18247,0,0,0,0,18138,
+		18114,18118,18146,138,139,0,0,0,0,0,0,0,0,0,0,0,
+		1,1,1,1,1,1,140,141,142,143,144,8671,145,146,147,148,
+		1,1,1,1,1,1,1,1,1,1,1,149,1,0,150,151,
+		21282,18301,18310,18315,18326,18331,18339,18487,18528,18666,18671,18842,18937,19073,19134,19190,
+		19197,19237,19264,19296,19447,19611,19752,19847,19918,19943,20030,20449,20450,21279,21280,21281,
+		1,20098,20206,20284,20454,20648,20788,20964,21050,21117,21134,8205,8215,8227,8239,8259,
+		8277,8295,8305,8311,8313,8315,8319,8321,8323,8327,8329,8331,8333,8335,8337,8317,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,152,153,154,155,18525,20203,
+		8355,18321,18320,18336,18302,18505,21060,21088,21148,18905,18914,18627,18923,18924,18636,18925,
+		18645,19181,19182,19032,19041,19183,19050,19060,19208,19213,19214,19215,19216,19221,19227,19232,
+		19233,19271,19276,19277,19278,19279,19280,19281,19282,19287,19602,19603,19604,19843,19845,19941,
+		20091,20175,20178,20180,20181,20191,20192,20279,20281,20393,20402,20403,20404,20406,20415,20417,
+		20427,20428,20437,20438,20447,20641,20642,20643,20644,20960,20941,20949,20958,20959,21015,19059,
+		21039,21024,21033,21036,21072,21073,21078,21083,21096,21101,21106,21107,21258,21267,21268,21113,
+		21269,21278,21287,21292,156,21038,1,1,1,1,1,1,1,1,157,1,
+		1,1,1,1,1,21052,21136,1,1,158,1,1,1,1,19234,19288,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,19605,19846,20093,18306,20659,21037,
+		159,160,161,162,163,164,165,166,167,168,169,170,171,172,0,1,
+		21305,8357,21306,21311,21312,21321,21320,21326,21327,21328,21330,21331,21332,21336,21337,21338,
+		21340,21341,21342,21343,21344,21346,21347,21348,21353,21354,21355,21356,21357,21307,21316,21322,
+		8359,8361,8363,8365,8367,8369,8371,8373,8375,8377,8379,8381,8383,8385,8387,8389,
+		1,8085,8087,1,1,8085,8087,1,1,1,1,0,0,21329,21339,21352,
+		18654,18655,18656,18657,18658,18659,18661,19184,19185,19235,19236,19289,19606,20094,20095,20096,
+		20201,20202,20448,20451,20452,20785,20786,20961,20962,20963,20645,19290,19291,19607,19186,19187,
+		19608,19292,19188,18337,18338,21283,21284,21285,21114,21115,21303,21304,19189,19609,19610,20405,
+		21394,21397,21398,21399,21401,21402,21403,21404,21407,21409,21410,21411,21413,21417,21418,21420,
+		21421,21425,21426,21427,21428,21429,21430,21431,21414,21395,21396,21412,21400,21422,21423,21424,
+		21415,21416,21405,21406,21419,21408,21433,21434,21435,21436,21437,21438,21439,21440,21441,21442,
+		21443,21432,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,21444,21445,21446,21447,21448,21449,
+		21450,21451,21452,21453,21454,21455,21456,21461,21466,21467,21472,21473,21474,21475,21476,21477,
+		21478,21479,21480,21481,21482,21483,21484,21485,21457,21462,21468,8391,8393,8395,8397,8399,
+		8401,8403,8405,8407,21486,21487,173,174,175,176,1,0,0,8087,8672,8673,
+		18275,18276,18277,18278,18279,18280,18281,18282,18283,18284,18285,18286,18287,18288,18289,18290,
+		18291,18292,18293,18294,18295,18296,18297,18298,8199,8201,18299,18300,8183,8183,8185,8185,
+		8185,8187,8187,8187,8189,8189,8191,8191,8193,8193,8193,8195,8197,8203,0,0,
+		177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,0,
+		21369,21370,21371,21372,21373,21374,21375,21376,21377,21378,21379,21380,21381,21382,21383,21384,
+		21385,21386,21387,21388,21389,21390,21391,21392,21393,8087,8087,8087,0,0,192,0,
+		21358,21359,21360,21361,21362,21363,21364,21365,21366,21367,21368,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		18660,18663,19069,19942,20190,20283,20646,20787,18484,18485,19293,21116,18486,18489,19226,19844,
+		20426,21112,19294,20097,20416,0,18664,18665,18934,19295,21286,20179,20280,20948,18662,18935,
+		18936,19070,20453,20092,20282,19071,19072,20647,0,0,0,0,0,0,0,0,
+		0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,8339,8253,8273,8291,8213,8225,8237,1,1,1,1,1,1,
+		8211,8223,8235,1,8255,8257,8293,8341,8343,8351,8353,8347,8349,8345,8275,8325,
+		8441,8441,8443,8445,22001,22002,22003,22009,22010,22011,22012,22013,22015,22017,22018,22019,
+		22020,22022,22023,22024,22025,22026,22030,22034,22039,22040,22041,22042,22043,22049,22050,22051,
+		22052,22054,22059,22063,22064,22065,22066,22067,22068,22069,22072,22073,22077,22079,22080,22081,
+		22086,22087,22090,22091,22092,22095,22096,22097,22098,22099,22112,22113,8439,22100,22111,22117,
+		22118,22119,22120,22121,22122,22125,22127,22128,22130,22132,22133,22134,22135,22136,22129,22114,
+		21998,1,1,8053,8051,22126,22115,22116,22027,22031,22035,22044,22055,22060,22074,22082,
+		22014,22016,22123,22124,193,194,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		195,8615,22000,22004,22005,22006,22007,22008,22053,22047,22085,22038,22048,22101,22058,22078,
+		22137,8441,8443,8445,0,22138,22139,22140,22141,22142,22143,22144,22146,0,0,22148,
+		22149,0,0,22150,22151,22152,22153,22154,22155,22156,22157,22158,22159,22160,22161,22162,
+		22163,22164,22168,22172,22173,22178,22179,22180,22181,0,22182,22183,22184,22185,22186,22187,
+		22191,0,22193,0,0,0,22195,22196,22197,22198,0,0,8439,22199,22200,22201,
+		22202,22203,22204,22205,22206,0,0,22209,22211,0,0,22212,22213,22214,22174,0,
+		0,0,0,0,0,0,0,22215,0,0,0,0,22165,22169,0,22188,
+		22145,22147,22207,22208,0,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		22192,22194,8674,8675,196,197,198,199,200,201,202,8676,22216,203,8447,0,
+		0,8441,8443,8445,0,22222,22223,22227,22228,22219,22220,0,0,0,0,22229,
+		22224,0,0,22221,22225,22236,22237,22241,22245,22246,22247,22248,22249,22253,22254,22255,
+		22256,22257,22258,22259,22260,22261,22262,22263,22264,0,22265,22266,22270,22271,22272,22273,
+		22275,0,22276,22277,0,22280,22231,0,22230,22234,0,0,8439,0,22282,22283,
+		22284,22285,22286,0,0,0,0,22287,22288,0,0,22289,22290,22291,0,0,
+		0,22235,0,0,0,0,0,0,0,22238,22242,22250,22281,0,22267,0,
+		0,0,0,0,0,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		8449,8451,22226,22218,22217,22274,204,0,0,0,0,0,0,0,0,0,
+		0,8441,8443,8445,0,22293,22294,22295,22296,22297,22298,22299,22301,22303,0,22304,
+		22305,22306,0,22307,22308,22309,22310,22311,22312,22313,22314,22315,22316,22318,22319,22320,
+		22321,22322,22323,22324,22325,22326,22327,22328,22329,0,22330,22331,22332,22333,22334,22335,
+		22336,0,22337,22343,0,22338,22339,22340,22341,22342,0,0,8439,22344,22345,22346,
+		22347,22348,22349,22350,22351,22354,0,22355,22356,22357,0,22358,22359,22360,0,0,
+		22292,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		22300,22302,22352,22353,0,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		205,8677,0,0,0,0,0,0,0,22317,8305,8295,8311,8439,8439,8439,
+		0,8441,8443,8445,0,22361,22362,22363,22364,22365,22366,22367,22369,0,0,22371,
+		22372,0,0,22373,22374,22375,22376,22377,22378,22379,22380,22381,22382,22383,22384,22385,
+		22386,22387,22391,22395,22396,22397,22398,22399,22400,0,22401,22402,22403,22404,22405,22406,
+		22408,0,22409,22410,0,22411,22413,22414,22415,22416,0,0,8439,22417,22418,22419,
+		22420,22421,22422,22423,22424,0,0,22427,22429,0,0,22430,22431,22432,0,0,
+		0,0,0,0,0,8085,22433,22434,0,0,0,0,22388,22392,0,22407,
+		22368,22370,22425,22426,0,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		206,22412,207,208,209,210,211,212,0,0,0,0,0,0,0,0,
+		0,0,8443,22449,0,22436,22437,22438,22439,22440,22441,0,0,0,22442,22443,
+		22444,0,22445,22447,22448,22450,0,0,0,22451,22452,0,22468,0,22453,22454,
+		0,0,0,22455,22456,0,0,0,22457,22467,22458,0,0,0,22459,22460,
+		22461,22466,22462,22465,22464,22463,22469,22470,22471,22472,0,0,0,0,22473,22474,
+		22475,22476,22477,0,0,0,22478,22480,22482,0,22483,22484,22485,22486,0,0,
+		22435,0,0,0,0,0,0,22487,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		213,214,215,216,217,218,219,220,221,8679,222,0,0,0,0,0,
+		8441,8441,8443,8445,8443,22488,22489,22490,22491,22492,22493,22494,22496,0,22498,22499,
+		22500,0,22501,22502,22503,22504,22505,22506,22507,22508,22509,22511,22512,22514,22515,22516,
+		22517,22518,22519,22520,22521,22522,22523,22524,22525,0,22526,22527,22528,22529,22530,22531,
+		22532,22533,22534,22540,22541,22535,22536,22537,22538,22539,0,0,0,22543,22544,22545,
+		22546,22547,22548,22549,22550,0,22553,22555,22556,0,22557,22558,22559,22560,0,0,
+		0,0,0,0,0,22561,22562,0,22510,22513,22542,0,0,0,0,0,
+		22495,22497,22551,22552,0,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		0,0,0,0,0,0,0,223,8721,8754,9235,9496,8754,9235,9496,224,
+		22618,8441,8443,8445,225,22563,22564,22565,22566,22567,22568,22569,22571,0,22573,22574,
+		22575,0,22576,22577,22578,22579,22580,22581,22582,22583,22584,22585,22586,22587,22588,22589,
+		22590,22591,22592,22593,22594,22595,22596,22597,22598,0,22599,22600,22601,22602,22603,22604,
+		22605,22606,22607,22613,0,22608,22609,22610,22611,22612,0,0,8439,22615,22619,22620,
+		22622,22623,22624,22625,22626,0,22629,22631,22632,0,22633,22635,22636,22637,0,0,
+		0,0,0,0,0,22638,22639,0,0,0,0,0,0,0,22614,0,
+		22570,22572,22627,22628,0,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		0,22616,22617,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		8443,8441,8443,8445,22732,22640,22641,22642,22643,22645,22646,22647,22649,0,22651,22652,
+		22653,0,22654,22655,22656,22657,22662,22663,22664,22665,22666,22667,22668,22669,22670,22671,
+		22672,22673,22674,22675,22680,22681,22682,22683,22684,22689,22690,22691,22692,22693,22694,22699,
+		22704,22729,22709,22719,22724,22714,22715,22716,22717,22718,22730,22752,22752,22731,22733,22734,
+		22735,22736,22737,22738,22739,0,22742,22744,22746,0,22747,22748,22749,22751,22705,226,
+		0,0,0,0,22695,22700,22725,22750,227,228,229,230,231,232,233,22644,
+		22648,22650,22740,22741,0,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		234,235,236,237,238,239,240,241,242,243,22676,22685,22705,22710,22720,22658,
+		0,8441,8443,8445,0,22754,22755,22756,22757,22758,22759,22760,22761,22762,22763,22764,
+		22765,22766,22767,22768,22769,22770,22771,0,0,0,22772,22773,22774,22775,22776,22777,
+		22778,22779,22780,22781,22782,22783,22784,22785,22786,22787,22788,22789,22790,22791,22792,22793,
+		22794,22795,0,22796,22797,22798,22799,22800,22801,22802,22803,22804,0,22805,0,0,
+		22806,22807,22808,22809,22810,22811,22812,0,0,0,22832,0,0,0,0,22813,
+		22814,22815,22816,22817,22818,0,22819,0,22820,22824,22826,22827,22828,22830,22831,22822,
+		0,0,0,0,0,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		0,0,22821,22823,244,0,0,0,0,0,0,0,0,0,0,0,
+		0,24295,24296,24297,24298,24299,24300,24301,24302,24303,24304,24305,24306,24307,24308,24309,
+		24310,24311,24312,24313,24314,24315,24316,24317,24318,24319,24320,24321,24322,24323,24324,24325,
+		24326,24327,24328,24329,24330,24331,24332,24333,24334,24335,24336,24337,24338,24339,24340,24341,
+		24342,24343,24344,24345,24346,24347,24348,24349,24350,24351,24352,0,0,0,0,8684,
+		24353,24355,24357,24359,24361,24363,8616,8475,8477,8479,8481,8483,8485,8487,8473,245,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,246,247,0,0,0,0,
+		0,24365,24366,0,24367,0,24368,24369,24370,24371,24373,0,24374,24377,24375,24378,
+		24379,24380,24381,24382,24383,24384,24385,24386,24387,24388,24389,24390,24391,24392,24393,24394,
+		24395,24396,24397,24398,0,24399,0,24400,24401,24402,24372,24403,24412,24413,24414,24415,
+		24416,24417,24418,24419,24420,24421,24422,24423,24424,24425,24426,24427,24428,24429,0,0,
+		24430,24432,24434,24436,24438,0,8617,0,8490,8492,8494,8496,8498,8500,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,24404,24408,24364,24376,
+		24625,248,249,250,251,252,253,254,255,256,257,258,259,261,262,263,
+		264,265,266,267,268,269,270,271,1,1,272,273,274,275,276,277,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,8757,9238,9499,9629,9728,9799,
+		9858,9923,9980,8724,278,1,279,1,280,8507,281,282,283,284,1,1,
+		24512,24519,24521,24522,24527,24529,24531,24533,0,24535,24537,24539,24541,24542,24547,24549,
+		24551,24553,24554,24559,24561,24563,24565,24566,24571,24573,24575,24577,24578,24583,24589,24591,
+		24593,24595,24601,24613,24616,24618,24620,24622,24624,24513,24602,24518,24612,0,0,0,
+		0,24640,24642,24643,24646,24647,24648,24649,24650,24651,24652,24653,24654,24655,8443,8445,
+		24644,24645,1,1,24656,285,1,1,24632,24634,24638,24639,24636,24633,24635,24637,
+		24515,24520,24524,24525,24528,24530,24532,24534,0,24536,24538,24540,24544,24545,24548,24550,
+		24552,24556,24557,24560,24562,24564,24568,24569,24572,24574,24576,24580,24581,24584,24590,24592,
+		24594,24596,24606,24614,24617,24619,24621,24623,24631,24516,24585,24597,24608,0,286,287,
+		288,289,290,291,292,293,1,294,295,296,297,298,299,0,300,301,
+		302,303,304,305,306,307,308,309,310,311,312,0,0,0,0,0,
+		25304,25306,25308,25312,25315,25317,25320,25324,25329,25336,25340,25341,25343,25345,25348,25351,
+		25355,25356,25357,25360,25363,25367,25368,25374,25377,25380,25382,25384,25388,25390,25397,25405,
+		25411,25418,25419,25420,25421,25422,25424,25429,25430,25431,25432,25434,25433,25439,25441,25443,
+		25446,25451,25455,25442,25457,25453,8443,8515,8445,25463,25464,25383,25387,25391,25408,25398,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,313,314,315,316,317,318,
+		25394,25395,25425,25426,25427,25428,25447,25448,25449,25450,25316,25330,25413,25414,25366,25381,
+		25389,25334,25458,25465,25466,25396,25417,25459,25460,25467,25468,25469,25470,25471,25352,25415,
+		25416,25440,25437,25444,25445,25305,25307,25309,25318,25327,25337,25358,25364,25369,25370,25375,
+		25393,25406,25392,25436,25452,25454,25462,25472,25474,25477,25478,25473,25475,25476,25372,25479,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,25480,25481,25438,25456,319,320,
+		17663,17669,17675,17681,17687,17693,17699,17711,17717,17723,17729,17735,17743,17755,17761,17767,
+		17773,17779,17785,17797,17803,17809,17815,17821,17827,17833,17839,17845,17851,17857,17863,17875,
+		17881,17705,17749,17791,17869,17887,0,17896,0,0,0,0,0,17911,0,0,
+		17659,17665,17671,17677,17683,17689,17695,17707,17713,17719,17725,17731,17737,17751,17757,17763,
+		17769,17775,17781,17793,17799,17805,17811,17817,17823,17829,17835,17841,17847,17853,17859,17871,
+		17877,17701,17745,17787,17865,17883,17889,17892,17898,17901,17904,321,17740,17907,17913,17916,
+		29313,29338,29343,29368,29393,29398,29423,29448,29473,29478,29503,29508,29563,29604,29609,29644,
+		29669,29694,29719,29744,29745,29748,29751,29752,29753,29754,29755,29760,29761,29764,29767,29770,
+		29771,29774,29779,29782,29785,29786,29787,29788,29791,29792,29795,29796,29799,29802,29805,29808,
+		29811,29812,29813,29816,29817,29818,29819,29822,29823,29824,29825,29826,29827,29828,29829,29830,
+		29831,29834,29835,29836,29837,29838,29839,29840,29843,29844,29845,29846,29847,29850,29851,29852,
+		29853,29854,29855,29856,29857,29858,29859,29860,29863,29866,29869,29870,29871,29872,29873,29903,
+		29904,29909,29914,29919,29924,29929,29934,29939,29944,29949,29954,29959,29964,29969,29974,29979,
+		29984,29989,29994,29999,30004,30009,30014,30015,30016,30017,30018,30019,30020,30021,30022,30023,
+		30024,30025,30026,30027,30028,30031,30034,30035,30036,30039,30040,30041,30042,30043,30044,30045,
+		30046,30047,30050,30053,30054,30057,30058,30059,30060,30061,30062,30063,30064,30065,30066,30069,
+		30070,30071,30074,30075,30076,30077,30078,30079,30103,30104,30105,30110,30111,30116,30121,30122,
+		30123,30128,30133,30138,30143,30148,30153,30154,30155,30156,30157,30158,30159,30160,30161,30162,
+		30163,30164,30165,30166,30167,30168,30169,30170,30173,30176,30177,30178,30179,30182,30183,30186,
+		30187,30188,30189,30190,30193,30194,30195,30196,30199,30200,30203,30204,30205,30206,30209,30210,
+		30213,30214,30215,30216,30217,30218,30219,30220,30221,30222,30223,30224,30225,30226,30227,30228,
+		30229,30230,30233,30236,30237,30238,30239,30240,30241,30242,30243,30244,30245,30246,30247,30248,
+		21545,21546,21547,21548,21549,21550,21551,21552,21553,21554,21555,21556,21557,21558,21559,21560,
+		21562,21563,21564,21565,21566,21567,21568,21569,21570,21571,21572,21573,21574,21575,21576,21577,
+		21583,21584,21585,21586,21587,21588,21589,21590,21591,21592,21593,21594,21595,21596,21597,21598,
+		21600,21601,21602,21603,21604,21605,21606,21607,21615,21616,21617,21618,21619,21620,21621,21622,
+		21624,21625,21626,21627,21628,21629,21630,21631,21632,0,21633,21634,21635,21636,0,0,
+		21637,21638,21639,21640,21641,21642,21643,0,21644,0,21645,21646,21647,21648,0,0,
+		21649,21650,21651,21652,21653,21654,21655,21656,21662,21663,21664,21665,21666,21667,21668,21669,
+		21670,21671,21672,21673,21674,21675,21676,21677,21679,21680,21681,21682,21683,21684,21685,21686,
+		21688,21689,21690,21691,21692,21693,21694,21695,21696,0,21697,21698,21699,21700,0,0,
+		21701,21702,21703,21704,21705,21706,21707,21708,21710,21711,21712,21713,21714,21715,21716,21717,
+		21719,21720,21721,21722,21723,21724,21725,21726,21728,21729,21730,21731,21732,21733,21734,21735,
+		21736,0,21737,21738,21739,21740,0,0,21741,21742,21743,21744,21745,21746,21747,0,
+		21748,0,21749,21750,21751,21752,0,0,21753,21754,21755,21756,21757,21758,21759,21760,
+		21761,21762,21763,21764,21765,21766,21767,0,21768,21769,21770,21771,21772,21773,21774,21775,
+		21783,21784,21785,21786,21787,21788,21789,21790,21791,21792,21793,21794,21795,21796,21797,21798,
+		21799,21800,21801,21802,21803,21804,21805,21806,21814,21815,21816,21817,21818,21819,21820,21821,
+		21823,21824,21825,21826,21827,21828,21829,21830,21832,21833,21834,21835,21836,21837,21838,21839,
+		21840,0,21841,21842,21843,21844,0,0,21845,21846,21847,21848,21849,21850,21851,21852,
+		21857,21858,21859,21860,21861,21862,21863,21864,21866,21867,21868,21869,21870,21871,21872,21873,
+		21882,21883,21884,21885,21886,21887,21888,21889,21891,21892,21893,21894,21895,21896,21897,21898,
+		21906,21907,21908,21909,21910,21911,21912,21913,21914,21915,21916,21917,21918,21919,21920,21921,
+		21926,21927,21928,21929,21930,21931,21932,21933,21939,21940,21941,0,0,8413,8411,8409,
+		322,323,324,325,326,327,328,329,330,8754,9235,9496,9626,9725,9796,9855,
+		9920,9977,331,332,333,334,335,336,337,338,339,340,341,0,0,0,
+		21578,21579,21580,21581,21657,21658,21659,21660,21922,21923,21924,21925,21934,21935,21936,21937,
+		342,343,344,345,346,347,348,349,350,351,0,0,0,0,0,0,
+		26239,26242,26245,26248,26251,26254,26257,26260,26263,26266,26269,26272,26275,26278,26281,26284,
+		26287,26290,26293,26296,26299,26302,26305,26308,26311,26314,26317,26320,26323,26326,26329,26332,
+		26335,26338,26341,26344,26347,26350,26353,26356,26359,26362,26365,26368,26371,26374,26377,26380,
+		26383,26386,26389,26392,26395,26398,26401,26404,26407,26410,26413,26416,26419,26422,26425,26428,
+		26431,26434,26437,26440,26443,26446,26449,26452,26455,26458,26461,26464,26467,26470,26473,26476,
+		26479,26482,26485,26488,26491,26494,0,0,26478,26481,26484,26487,26490,26493,0,0,
+		352,26604,26605,26606,26607,26608,26609,26610,26611,26612,26613,26614,26615,26616,26617,26618,
+		26619,26620,26621,26622,26623,26624,26625,26626,26627,26628,26629,26630,26631,26632,26633,26634,
+		26635,26636,26637,26638,26639,26640,26641,26642,26643,26644,26645,26646,26647,26648,26649,26650,
+		26651,26652,26653,26654,26655,26656,26657,26658,26659,26660,26661,26662,26663,26664,26665,26666,
+		26667,26668,26669,26670,26671,26672,26673,26674,26675,26676,26677,26678,26679,26680,26681,26682,
+		26683,26684,26685,26686,26687,26688,26689,26690,26691,26692,26693,26694,26695,26696,26697,26698,
+		26699,26700,26701,26702,26703,26704,26705,26706,26707,26708,26709,26710,26711,26712,26713,26714,
+		26715,26716,26717,26718,26719,26720,26721,26722,26723,26724,26725,26726,26727,26728,26729,26730,
+		26731,26732,26733,26734,26735,26736,26737,26738,26739,26740,26741,26742,26743,26744,26745,26746,
+		26747,26748,26749,26750,26751,26752,26753,26754,26755,26756,26757,26758,26759,26760,26761,26762,
+		26763,26764,26765,26766,26767,26768,26769,26770,26771,26772,26773,26774,26775,26776,26777,26778,
+		26779,26780,26781,26782,26783,26784,26785,26786,26787,26788,26789,26790,26791,26792,26793,26794,
+		26795,26796,26797,26798,26799,26800,26801,26802,26803,26804,26805,26806,26807,26808,26809,26810,
+		26811,26812,26813,26814,26815,26816,26817,26818,26819,26820,26821,26822,26823,26824,26825,26826,
+		26827,26828,26829,26830,26831,26832,26833,26834,26835,26836,26837,26838,26839,26840,26841,26842,
+		26843,26844,26845,26846,26847,26848,26849,26850,26851,26852,26853,26854,26855,26856,26857,26858,
+		26859,26860,26861,26862,26863,26864,26865,26866,26867,26868,26869,26870,26871,26872,26873,26874,
+		26875,26876,26877,26878,26879,26880,26881,26882,26883,26884,26885,26886,26887,26888,26889,26890,
+		26891,26892,26893,26894,26895,26896,26897,26898,26899,26900,26901,26902,26903,26904,26905,26906,
+		26907,26908,26909,26910,26911,26912,26913,26914,26915,26916,26917,26918,26919,26920,26921,26922,
+		26923,26924,26925,26926,26927,26928,26929,26930,26931,26932,26933,26934,26935,26936,26937,26938,
+		26939,26940,26941,26942,26943,26944,26945,26946,26947,26948,26949,26950,26951,26952,26953,26954,
+		26955,26956,26957,26958,26959,26960,26961,26962,26963,26964,26965,26966,26967,26968,26969,26970,
+		26971,26972,26973,26974,26975,26976,26977,26978,26979,26980,26981,26982,27033,26983,26985,26986,
+		26987,26988,26989,26990,26991,26992,26993,26994,26995,26996,26997,26998,26999,27000,27002,27003,
+		27004,27005,27006,27007,27008,27009,27016,27017,27018,27019,27020,27021,27022,27023,27024,27025,
+		27026,27027,27028,27029,27030,27031,27032,27034,27035,27036,27037,27038,27039,27040,27041,27042,
+		27043,27044,27045,27046,27047,27048,27049,27050,27051,27052,27053,27054,27055,27056,27057,27058,
+		27059,27060,27061,27062,27063,27064,27065,27066,27067,27068,27069,27070,27071,27072,27073,27074,
+		27075,27076,27077,27078,27079,27080,27081,27082,27083,27084,27085,27086,27087,27088,27089,27090,
+		27091,27092,27093,27094,27095,27096,27097,27098,27099,27100,27101,27102,27103,27104,27105,27106,
+		27107,27108,27109,27110,27111,27112,27113,27114,27115,27116,27117,27118,27119,27120,27121,27122,
+		27123,27124,27125,27126,27127,27128,27129,27130,27131,27132,27133,27134,27135,27136,27137,27138,
+		27139,27140,27141,27142,27143,27144,27145,27146,27147,27148,27149,27150,27151,27152,27153,27154,
+		27155,27156,27157,27158,27159,27160,27161,27162,27163,27164,27165,27166,27167,27168,27169,27170,
+		27171,27172,27173,27174,27175,27176,27177,27178,27179,27180,27181,27182,27183,27184,27185,27186,
+		27187,27188,27189,27190,27191,27192,27193,27194,27195,27196,27197,27198,27199,27200,27201,27202,
+		27203,27204,27205,27206,27207,27208,27209,27210,27211,27212,27213,27214,27215,27216,27217,27218,
+		27219,27220,27221,27222,27223,27224,27225,27226,27227,27228,27229,27230,27231,353,354,26984,
+		27001,27010,27011,27012,27013,27014,27015,27232,27233,27234,27235,27236,27237,27238,27239,27240,
+		355,27311,27312,27313,27314,27315,27316,27317,27318,27319,27320,27321,27322,27323,27324,27325,
+		27326,27327,27328,27329,27330,27331,27332,27333,27334,27335,27336,357,358,0,0,0,
+		27337,27338,27342,27530,27343,27347,27351,27352,27360,27361,27526,27528,27365,27369,27373,27378,
+		27379,27380,27381,27382,27386,27390,27394,27399,27533,27400,27405,27406,27410,27414,27418,27419,
+		27423,27427,27428,27433,27434,27438,27439,27447,27448,27453,27454,27455,27463,27467,27471,27476,
+		27477,27481,27485,27486,27490,27449,27494,27496,27497,27501,27513,27514,27518,27519,27523,27524,
+		27531,27535,27536,27532,27534,27537,27538,27539,27543,27401,27459,359,360,361,27443,27505,
+		27356,27398,27475,27525,27377,27432,27495,27527,27529,0,0,0,0,0,0,0,
+		25040,25041,25042,25043,25044,25045,25046,25047,25048,25049,25050,25051,25052,0,25053,25054,
+		25055,25056,25057,25058,25059,0,0,0,0,0,0,0,0,0,0,0,
+		25060,25061,25062,25063,25064,25065,25066,25067,25068,25069,25070,25071,25072,25073,25074,25075,
+		25076,25077,25078,25079,25080,362,363,0,0,0,0,0,0,0,0,0,
+		25081,25082,25083,25084,25085,25086,25087,25088,25089,25090,25091,25092,25093,25094,25095,25096,
+		25097,25098,25099,25100,0,0,0,0,0,0,0,0,0,0,0,0,
+		25101,25102,25103,25104,25105,25106,25107,25108,25109,25110,25111,25112,25113,0,25114,25115,
+		25116,0,25117,25118,0,0,0,0,0,0,0,0,0,0,0,0,
+		25580,25581,25582,25583,25584,25585,25586,25587,25588,25589,25590,25591,25592,25593,25594,25595,
+		25596,25597,25598,25599,25600,25601,25602,25603,25604,25605,25606,25607,25608,25609,25610,25611,
+		25612,25613,25614,25616,25617,25618,25619,25620,25621,25622,25623,25624,25625,25626,25627,25628,
+		25629,25630,25631,25632,1,1,25633,25634,25635,25636,25637,25638,25639,25640,25641,25642,
+		25643,25644,25645,25646,25647,25648,8443,8445,8517,8519,8521,8085,8085,8085,8085,8085,
+		8085,8085,25649,1,364,365,366,8618,367,368,369,8685,25615,8085,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		370,371,372,373,374,375,376,377,378,379,1,1,1,1,1,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		26078,26080,26083,26089,26091,26094,26096,26099,26100,26101,26106,26108,26111,26113,26118,26120,
+		26121,26122,26129,26132,26135,26141,26145,26148,26150,26152,26155,26160,26161,26164,26168,26171,
+		26172,26173,26174,26077,26081,26084,26090,26092,26095,26097,26102,26107,26109,26112,26114,26119,
+		26130,26133,26136,26142,26162,26146,26151,26156,26166,26169,26175,26176,26139,26082,26085,26088,
+		26098,26093,26103,26157,26115,26117,26110,26123,26131,26134,26143,26153,26167,26170,26163,26165,
+		26177,26137,26147,26086,26158,26149,26154,26144,26138,0,0,0,0,0,0,0,
+		26070,26071,26072,26073,26074,26075,26076,26079,26087,26159,26104,26140,26178,26180,26181,26183,
+		26184,26187,26189,26190,26192,26194,26196,26197,26185,26195,26116,26105,26124,26125,26179,26182,
+		26186,26188,26126,26193,26127,26128,26198,26199,26191,26201,26200,0,0,0,0,0,
+		27241,27242,27243,27244,27245,27246,27247,27248,27249,27250,27251,27252,27253,27254,27255,27256,
+		27257,27258,27259,27260,27261,27262,27263,27264,27265,27266,27267,27268,27269,27270,27271,27272,
+		27273,27274,27275,27276,27277,27278,27279,27280,27281,27282,27283,27284,27285,27286,27287,27288,
+		27289,27290,27291,27292,27293,27294,27295,27296,27297,27298,27299,27300,27301,27302,27303,27304,
+		27305,27306,27307,27308,27309,27310,0,0,0,0,0,0,0,0,0,0,
+		24982,24983,24984,24985,24986,24987,24988,24989,24990,24995,24996,24997,25002,25003,25004,25005,
+		25006,25007,25008,25009,25010,25011,25012,25013,25014,25015,25016,25017,25018,24991,24998,0,
+		25019,25020,25021,25022,25023,25024,25025,25026,25027,25028,25029,25030,0,0,0,0,
+		25031,25032,25033,25034,25035,25036,25037,25038,25039,8539,8541,8543,0,0,0,0,
+		380,0,0,0,381,382,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		25650,25651,25652,25653,25654,25655,25656,25657,25658,25659,25660,25661,25662,25663,25664,25665,
+		25666,25667,25668,25669,25670,25671,25672,25673,25674,25675,25676,25677,25678,25679,0,0,
+		25680,25681,25682,25683,25684,0,0,0,0,0,0,0,0,0,0,0,
+		25685,25686,25687,25688,25689,25690,25691,25692,25693,25694,25695,25696,25697,25698,25699,25700,
+		25701,25702,25703,25704,25705,25706,25707,25708,25709,25710,25711,25712,25713,25724,25725,25726,
+		25727,25728,25729,25730,25731,25732,25733,25734,25735,25736,25737,25738,0,0,0,0,
+		25739,25740,25741,25742,25743,25744,25746,25748,25750,25751,25752,25754,25755,25756,25757,25758,
+		25759,25760,25761,25762,25763,25764,25765,25766,25767,25768,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,8754,0,0,0,25714,25718,
+		383,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,
+		399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,
+		25119,25120,25121,25122,25123,25124,25125,25126,25127,25128,25129,25130,25131,25132,25133,25134,
+		25135,25136,25137,25138,25139,25140,25141,25142,25143,25144,25145,25146,0,0,415,416,
+		25769,25770,25771,25772,25773,25774,25775,25778,25779,25780,25781,25782,25783,25784,25785,25786,
+		25787,25788,25789,25790,25791,25792,25793,25794,25795,25796,25797,25798,25801,25802,25803,25804,
+		25805,25806,25807,25808,25809,25810,25811,25818,25819,25820,25821,25822,25823,25832,25833,25834,
+		25835,25836,25837,25824,25812,25826,25827,25828,25776,25776,25799,25799,25829,25830,25831,0,
+		25857,25838,25840,25841,25842,25844,25845,25846,25847,25848,25849,25825,25839,25856,25850,25851,
+		25853,25854,25855,25852,8443,8523,8525,8527,8529,8531,8533,8535,8537,0,0,1,
+		417,418,419,420,421,422,423,8619,424,425,426,427,428,429,0,0,
+		8085,8085,8085,8085,8085,8087,8087,8087,8087,8087,8087,8085,8085,8087,8091,14526,
+		14621,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		8441,8441,8443,8453,8445,25927,25929,25930,25932,25933,25935,25936,25938,25939,25941,25942,
+		25943,25944,25946,25947,25950,25951,25952,25953,25954,25955,25956,25957,25958,25959,25960,25961,
+		25962,25963,25964,25966,25967,25968,25969,25970,25972,25973,25974,25975,25976,25977,25978,25979,
+		25981,25982,25983,25986,8439,25987,25988,25989,25990,25991,25992,25994,25995,25997,25998,26000,
+		26002,26003,26004,26006,26007,25948,25949,25965,25971,25980,25984,25985,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,430,431,432,433,434,435,
+		436,437,438,439,440,441,442,443,444,445,446,1,1,1,1,1,
+		1,1,1,1,447,448,449,450,451,452,453,454,455,0,0,0,
+		8443,8457,8445,24068,24071,24072,24073,24074,24075,24076,24077,24081,24082,24083,24084,24085,
+		24086,24087,24088,24089,24090,24091,24092,24093,24094,24096,24100,24102,24105,24108,24110,24111,
+		24113,24101,24103,24106,24114,24115,24116,24117,24118,24119,24120,24121,24099,24109,24080,24112,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,24069,24104,24107,24095,24078,24097,
+		25170,25171,25173,25174,25174,25176,25177,25179,25180,25182,25183,25185,25186,25186,25188,25189,
+		25191,25192,25193,25194,25196,25197,25199,25200,25202,25203,25203,25205,25206,25208,25209,25210,
+		25212,25213,25214,25215,25216,25217,8439,25218,25219,25221,25222,25223,25225,25226,25228,25229,
+		25231,25232,25233,25234,0,0,0,0,0,0,0,0,456,457,458,459,
+		24872,24873,24874,24875,24876,24877,24878,24879,24880,24881,24885,24886,24887,24888,24889,24890,
+		24891,24892,24893,24894,24895,24896,24897,24898,24899,24900,24901,24903,24905,24906,24907,24908,
+		24909,24910,24911,24912,24902,24904,24914,24915,24916,24917,24918,24919,24920,24921,24922,24923,
+		24924,24925,24926,24927,24928,24929,24913,8439,0,0,0,460,461,462,463,464,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,24882,24883,24884,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,26202,26203,26204,26205,26206,26207,
+		26208,26209,26210,26211,26212,26213,26214,26215,26216,26217,26218,26219,26220,26221,26222,26223,
+		26224,26225,26226,26227,26228,26229,26230,26231,26232,26233,26234,26235,26236,26237,465,466,
+		16686,16723,17011,17060,17075,17075,17261,17293,17134,0,0,0,0,0,0,0,
+		17660,17666,17672,17678,17684,17690,17696,17708,17714,17720,17726,17732,17738,17752,17758,17764,
+		17770,17776,17782,17794,17800,17806,17812,17818,17824,17830,17836,17842,17848,17854,17860,17872,
+		17878,17702,17746,17788,17866,17884,17890,17893,17899,17902,17905,0,0,17908,17914,17917,
+		467,468,469,470,471,472,473,474,0,0,0,0,0,0,0,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,22102,22103,22103,22103,8443,22103,22103,
+		22103,22103,8445,8445,1,22105,22106,1,1,1,22103,0,0,0,0,0,
+		10474,10482,10483,10576,10754,10960,10961,11232,11273,11938,12005,12172,12374,12590,12766,13201,
+		13218,13202,13219,13211,13205,13250,13226,13229,13366,13596,13604,14006,14341,14345,14348,14382,
+		14503,14613,14896,14934,15016,15017,15310,15848,15992,16023,16213,16943,10059,10358,10538,10575,
+		10811,11013,11244,11423,11578,11753,11990,12051,12229,12449,12637,12765,12825,13248,13284,13467,
+		13898,14061,14554,10055,10490,10497,10484,10536,10807,11009,11252,11262,11274,11421,11939,12047,
+		12445,12789,12821,13216,13227,13230,13280,13894,14057,14346,14379,14423,15018,15295,15306,15318,
+		16191,16202,11751,13465,14059,14425,15297,15308,16011,16193,16204,14349,10577,10965,11383,12593,
+		12767,13373,13600,13617,13840,14013,14900,11533,16984,11482,13970,11946,11958,13367,14361,14391,
+		10581,10966,11384,11528,12173,12399,12594,12779,13374,13606,13841,13860,14507,14696,14901,10478,
+		10500,10973,11238,11264,11272,11256,11949,13221,13863,14362,14938,10504,10628,10768,10870,11270,
+		11313,12015,11519,14372,11944,11956,11934,11947,12012,12403,12400,12369,12598,14384,12771,12781,
+		12763,13236,13386,13845,13857,14015,14355,14389,14342,14511,14521,14846,14908,14911,14925,15673,
+		8085,8085,8087,8085,8085,8085,8085,8085,8085,8085,13437,8085,8085,8085,8085,8087,
+		8087,8085,14966,10324,10346,10410,10442,10663,10874,10862,11395,11523,12021,12196,12367,12591,
+		12607,12761,13586,13592,13636,13764,14820,10493,10510,10589,11248,11283,12390,13062,13254,13853,
+		14214,14526,10205,12909,14108,8085,8085,8085,8085,8087,0,8085,8087,8087,8085,8087,
+		10320,10317,10543,10540,10550,10547,10557,10554,10676,10671,10823,10820,10844,10841,10858,10855,
+		10830,10827,10851,10848,11163,11158,11152,11147,11211,11208,11218,11215,11127,11122,11320,11317,
+		11470,11467,11604,11601,11629,11626,11597,11594,11611,11608,11636,11633,11864,11861,11802,11797,
+		12056,12053,12085,12082,12092,12089,12262,12259,12271,12266,12287,12284,12280,12277,12454,12451,
+		12461,12458,12468,12465,12670,12667,12692,12689,12706,12703,12699,12696,12951,12946,12962,12957,
+		13056,13051,13045,13040,13289,13286,13296,13293,13486,13483,13522,13519,13531,13526,13540,13537,
+		13720,13717,13742,13739,13686,13681,13711,13706,13751,13746,13913,13910,13927,13924,13948,13945,
+		13941,13938,14311,14308,14325,14322,14318,14315,14183,14178,14208,14203,14432,14429,14439,14436,
+		14566,14563,14559,14556,14583,14580,14590,14587,14597,14594,14672,14669,14665,14662,14778,14775,
+		14860,14857,14881,14878,14888,14885,11640,13907,14577,14758,10470,13772,13850,13851,13816,10979,
+		10291,10288,10270,10267,10138,10133,10149,10144,10171,10166,10160,10155,10311,10306,10087,10082,
+		10098,10093,10120,10115,10109,10104,10300,10295,11193,11190,11172,11169,11104,11101,11048,11043,
+		11059,11054,11081,11076,11070,11065,11202,11197,11836,11833,11857,11854,13152,13149,13069,13066,
+		12860,12855,12871,12866,12893,12888,12882,12877,13161,13156,13099,13094,13110,13105,13132,13127,
+		13121,13116,13143,13138,14304,14301,14221,14218,14251,14246,14262,14257,14284,14279,14273,14268,
+		14295,14290,14747,14744,14799,14796,14792,14789,14771,14768,12314,12310,14516,14515,14811,14810,
+		15041,15137,15074,15170,15048,15144,15100,15196,15044,15140,15079,15175,15053,15149,15105,15201,
+		15329,15358,15347,15376,15336,15365,0,0,15332,15361,15352,15381,15341,15370,0,0,
+		15431,15527,15464,15560,15438,15534,15490,15586,15434,15530,15469,15565,15443,15539,15495,15591,
+		15684,15724,15702,15742,15691,15731,15713,15753,15687,15727,15707,15747,15696,15736,15718,15758,
+		15911,15940,15929,15958,15918,15947,0,0,15914,15943,15934,15963,15923,15952,0,0,
+		16063,16081,16071,16099,16066,16088,16076,16110,0,16084,0,16104,0,16093,0,16115,
+		16221,16317,16254,16350,16228,16324,16280,16376,16224,16320,16259,16355,16233,16329,16285,16381,
+		15245,15233,15394,15387,15635,15623,15771,15764,15976,15969,16132,16121,16425,16413,0,0,
+		15126,15222,15085,15181,15059,15155,15111,15207,15131,15227,15092,15188,15066,15162,15118,15214,
+		15516,15612,15475,15571,15449,15545,15501,15597,15521,15617,15482,15578,15456,15552,15508,15604,
+		16306,16402,16265,16361,16239,16335,16291,16387,16311,16407,16272,16368,16246,16342,16298,16394,
+		15257,15272,15252,15279,15240,0,15264,15267,15260,15275,15248,15236,15282,475,15675,475,
+		476,477,15642,15655,15630,0,15647,15650,15397,15390,15638,15626,15658,480,483,486,
+		15778,15810,15800,15795,0,0,15785,15805,15781,15813,15774,15767,0,489,492,495,
+		16139,16175,16165,16160,16013,16016,16146,16170,16142,16178,16135,16124,16019,498,119,35,
+		0,0,16432,16445,16420,0,16437,16440,15979,15972,16428,16416,16448,54,501,0,
+		355,355,355,355,355,355,355,41,355,355,355,1,1,1,1,1,
+		502,503,505,506,507,508,509,510,511,512,513,514,515,516,517,518,
+		519,520,521,522,523,525,529,535,536,537,1,1,1,1,1,41,
+		538,539,540,541,545,551,552,556,562,563,564,565,566,570,571,572,
+		573,574,575,576,577,578,579,580,584,588,592,593,594,595,596,597,
+		598,599,600,601,602,603,604,605,613,614,615,616,617,618,619,355,
+		1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,
+		8738,11749,0,0,9649,9748,9819,9878,9943,10000,620,622,624,626,628,12633,
+		8740,8779,9260,9521,9651,9750,9821,9880,9945,10002,630,632,634,636,638,0,
+		10057,11011,12823,14658,11254,11576,12049,12227,12447,12635,13282,13670,13896,0,0,0,
+		8687,8688,8689,8690,8691,8692,8693,8694,13580,8695,8698,8699,8700,8701,8702,8703,
+		8704,8705,8706,8707,8708,8709,8710,8711,8712,8713,8715,8716,8717,8718,8719,8720,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		8583,8585,8587,8587,8589,8591,8593,8595,8089,8089,8089,8597,8599,8091,8091,8091,
+		8091,8601,8091,8091,8091,8089,8603,8605,8607,8609,8089,8089,8087,8087,8087,8087,
+		8085,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		10340,10418,10624,10612,640,10728,10748,11260,641,11299,11403,11570,11570,11570,11556,11615,
+		11745,11745,12221,12204,642,12629,12744,643,644,13276,13412,13459,13459,13459,645,646,
+		13792,13964,13982,647,14842,648,16217,649,14842,650,12033,10187,10532,10624,651,10991,
+		11005,11309,11389,12441,12803,18061,18079,18088,18094,11729,652,11332,15986,15300,15304,15990,
+		653,655,656,657,658,10803,10787,10991,11729,11968,659,660,661,10424,11388,662,
+		9115,9195,8849,8955,9352,9035,9398,9576,9681,9075,9766,9155,9594,9772,9896,8781,
+		11737,11880,11890,11916,14411,14447,14457,14471,11924,14644,14680,14690,12213,10616,10795,12433,
+		11721,11876,11884,11912,14395,14443,14451,14463,11920,14628,14676,14684,12196,10596,10779,12417,
+		663,664,665,10771,10770,9796,666,667,668,8742,669,670,0,0,0,0,
+		671,672,673,674,675,676,677,678,679,680,681,684,687,688,689,690,
+		691,692,693,694,695,696,697,698,699,700,701,702,703,704,705,708,
+		709,710,711,712,713,714,715,716,717,718,719,720,721,722,723,724,
+		725,726,727,728,729,730,731,732,733,734,735,736,737,738,741,744,
+		747,748,749,750,751,752,753,754,755,756,757,758,759,760,761,762,
+		763,764,765,766,767,768,769,770,771,772,773,774,775,776,777,778,
+		779,780,781,782,783,784,785,786,787,788,789,790,791,792,793,794,
+		795,796,797,798,799,802,803,804,805,806,809,810,811,814,815,816,
+		817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,832,
+		833,834,835,836,837,840,841,844,845,846,847,848,849,853,859,860,
+		864,870,871,872,873,874,875,876,877,878,879,880,881,882,883,884,
+		885,886,889,890,891,894,895,896,899,900,903,904,905,906,907,908,
+		909,910,911,912,913,914,915,916,917,918,919,920,921,922,923,924,
+		925,928,929,932,933,934,935,936,937,938,939,940,941,942,945,948,
+		951,954,957,958,959,962,965,966,967,970,973,974,975,976,977,978,
+		979,982,985,986,987,990,993,994,995,998,1001,1002,1003,1004,1005,1006,
+		1007,1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,
+		1023,1024,1025,1026,1027,1028,1029,1030,1031,1032,1033,1034,1035,1038,1041,1044,
+		1047,1048,1049,1050,1051,1052,1053,1054,1055,1056,1057,1058,1059,1060,1061,1062,
+		1063,1064,1065,1066,1067,1068,1069,1070,1071,1072,1073,1074,1075,1076,1077,1078,
+		1079,1080,1081,1082,1083,1084,1085,1086,1087,1088,1089,1090,1091,1092,1093,1094,
+		1095,1098,1101,1104,1107,1108,1109,1110,1111,1112,1113,1116,1119,1122,1125,1126,
+		1127,1128,1129,1130,1131,1132,1133,1134,1135,1136,1137,1138,1139,1140,1141,1142,
+		1143,1144,1145,1146,1147,1148,1149,1150,1151,1152,1153,1154,1155,1156,1157,1158,
+		1159,1160,1161,1162,1163,1164,1165,1166,1167,1168,1169,1170,1171,1172,1173,1174,
+		1175,1176,1177,1178,1179,1180,1181,1182,1183,1184,1185,1186,1187,1188,1189,1190,
+		1191,1192,1193,1194,1195,1196,1197,1198,1199,1200,1201,1202,1203,1204,1205,1206,
+		1207,1208,1209,1210,1211,1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,
+		1223,1224,1225,1226,1227,1228,1229,1230,1231,1232,1233,1234,1235,1236,1237,1238,
+		1239,1240,1241,1242,1243,1244,1245,1246,1247,1248,1249,1250,1251,1252,1253,1254,
+		1255,1256,1257,1258,1259,1260,1261,1262,1263,1264,1265,1266,1267,1268,1269,1270,
+		1271,1272,1273,1274,1275,1276,1277,1278,1279,1280,1281,1282,1283,1284,1285,1286,
+		1287,1288,1289,1290,1291,1292,1293,1294,1295,1296,1297,1298,1299,1300,1301,1302,
+		1303,1304,1305,1306,1307,1308,1309,1310,1311,1312,1313,1314,1315,1316,1317,1318,
+		1319,1320,1321,1322,1323,1324,1325,1326,1327,1328,1329,1330,1331,1332,1333,1334,
+		1335,1336,1337,1338,1339,1340,1341,1342,1343,1344,1345,1346,1347,1348,1349,1350,
+		1351,1352,1353,1354,1355,1356,1357,1358,1359,1360,1361,1362,1363,1364,1365,1366,
+		1367,1368,1369,1370,1371,1372,1373,1374,1375,1376,1377,1378,1379,1380,1381,1382,
+		1383,1384,1385,1386,1387,1388,1389,1390,1391,1392,1393,1394,1395,1396,1397,1398,
+		1399,1400,1401,1402,1403,1404,1405,1406,1407,1408,1409,1410,1411,1412,1413,1414,
+		1415,1416,1417,1418,1419,1420,1421,1422,1423,1424,1425,1426,1427,1428,1429,1430,
+		1431,1432,1433,1434,1435,1436,1437,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1448,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		8775,9256,9517,9647,9746,9817,9876,9941,9998,8803,8845,8895,8951,8991,9031,9071,
+		9111,9151,9191,9280,8759,9240,9501,9631,9730,9801,9860,9925,9982,8789,8831,8881,
+		8937,8977,9017,9057,9097,9137,9177,9266,8765,9246,9507,9637,9736,9807,9866,9931,
+		9988,8797,8839,8889,8945,8985,9025,9065,9105,9145,9185,9274,10031,10512,10598,10781,
+		10985,11285,11397,11550,11723,11962,12023,12198,12419,12609,12797,13256,13392,13439,13638,13870,
+		14033,14397,14528,14630,14709,14822,10053,10534,10626,10805,11007,11311,11419,11572,11747,11984,
+		12045,12223,12443,12631,12819,13278,13414,13461,13666,13892,14055,14421,14550,14654,14731,14844,
+		10039,10520,10606,10789,10993,11293,11405,11558,11731,11970,12031,12206,12427,12617,12805,13264,
+		13400,13447,13646,13878,14041,14405,14536,14638,14717,14830,8736,8845,8895,8951,8991,9031,
+		9071,9111,9151,9191,9280,8775,9256,9517,9647,9746,9817,9876,9941,9998,8803,8736,
+		1449,1450,1451,1452,1453,1454,1455,1456,1457,1458,1459,1460,1461,1462,1463,1464,
+		1465,1466,1467,1468,1469,1470,1471,1472,1473,1474,1475,1476,1477,1478,1479,1480,
+		1481,1482,1483,1484,1485,1486,1487,1488,1489,1490,1491,1492,1493,1494,1495,1496,
+		1497,1498,1499,1500,1501,1502,1503,1504,1505,1506,1507,1508,1509,1510,1511,1512,
+		1513,1514,1515,1516,1517,1518,1519,1520,1521,1522,1523,1524,1525,1526,1527,1528,
+		1529,1530,1531,1532,1533,1534,1535,1536,1537,1538,1539,1540,1541,1542,1543,1544,
+		1545,1546,1547,1548,1549,1550,1551,1552,1553,1554,1555,1556,1557,1558,1559,1560,
+		1561,1562,1563,1564,1565,1566,1567,1568,1569,1570,1571,1572,1573,1574,1575,1576,
+		1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,1590,1591,1592,
+		1593,1594,1595,1596,1597,1598,1599,1600,1601,1602,1603,1604,1605,1606,1607,1608,
+		1609,1610,1611,1612,1613,1614,1615,1616,1617,1618,1619,1620,1621,1622,1623,1624,
+		1625,1626,1627,1628,1629,1630,1631,1632,1633,1634,1635,1636,1637,1638,1639,1640,
+		1641,1642,1643,1644,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,
+		1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,
+		1673,1674,1675,1676,1677,1678,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,
+		1689,1690,1691,1692,1693,1694,1695,1696,1697,1698,1699,1700,1701,1702,1703,1704,
+		1705,1706,1707,1708,1709,1710,1711,1712,1713,1714,1715,1716,1717,1718,1719,1720,
+		1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,
+		1737,1738,1739,1740,1741,1742,1743,1744,1745,1746,1747,1748,1749,1750,1751,1752,
+		1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,
+		1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,
+		1785,1786,1787,1788,1789,1790,1791,1792,1793,1794,1795,1796,1797,1798,1799,1800,
+		1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,
+		1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,
+		1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,
+		1849,1850,1851,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1864,
+		1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,
+		1881,1882,1883,1884,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,
+		1897,1898,1899,1900,1901,1902,1903,1904,1905,1906,1907,1908,1909,1910,1911,1912,
+		1913,1914,1915,1916,1917,1918,1919,1920,1921,1922,1923,1924,1925,1926,1927,1928,
+		1929,1930,1931,1932,1933,1934,1935,1936,1937,1938,1939,1940,1941,1942,1943,1944,
+		1945,1946,1947,1948,1949,1950,1951,1952,1953,1954,1955,1956,1957,1958,1959,1960,
+		1961,1962,1963,1964,1965,1966,1967,1968,1969,1970,1971,1972,1973,1974,1975,1976,
+		1977,1978,1979,1980,1981,1982,1983,1984,1985,1986,1987,1988,1989,1990,1991,1992,
+		1993,1994,1995,1996,1997,1998,1999,2000,2001,2002,2003,2004,2005,2006,2007,2008,
+		2009,2010,2011,2012,2013,2014,2015,2016,2017,2018,2019,2020,2021,2022,2023,2024,
+		2025,2026,2027,2028,2029,2030,2031,2032,2033,2034,2035,2036,2037,2038,2039,2040,
+		2041,2042,2043,2044,2045,2046,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,
+		2057,2058,2059,2060,2061,2062,2063,2064,2065,2066,2067,2068,2069,2070,2071,2072,
+		2073,2074,2075,2076,2077,2078,8775,9256,9517,9647,9746,9817,9876,9941,9998,8803,
+		8775,9256,9517,9647,9746,9817,9876,9941,9998,8803,8775,9256,9517,9647,9746,9817,
+		9876,9941,9998,8803,2079,2080,2081,2082,2083,2084,2085,2086,2087,2088,2089,2090,
+		2091,2092,2093,2094,2095,2096,2097,2098,2099,2100,2101,2102,2103,2104,2105,2106,
+		2107,2108,2109,2110,2111,2112,2113,2114,2115,2116,2117,2118,2119,2120,2121,2122,
+		2123,2124,2125,2126,2127,2128,2129,2130,2131,2132,2133,2134,2135,2136,2137,2138,
+		2139,2140,2141,2142,2143,2144,2145,2146,2147,2148,2149,2150,2151,2152,2153,2154,
+		2155,2156,2157,2158,2159,2160,2161,2162,2163,2164,2165,2166,2167,2168,2169,2170,
+		2171,2172,2173,2174,2175,2176,2177,2178,2179,2180,2181,2182,2183,2184,2185,2186,
+		2187,2188,2189,2190,2191,2192,2193,2194,2195,2196,2197,2198,2199,2200,2201,2202,
+		2203,2204,2205,2206,2207,2208,2209,2210,2211,2212,2213,2214,2215,2216,2217,2218,
+		2219,2220,2221,2222,2223,2224,2225,2226,2227,2228,2229,2230,2231,2232,2233,2234,
+		2235,2236,2237,2238,2239,2240,2241,2242,2243,2244,2245,2246,2247,2248,2249,2250,
+		2251,2252,2253,2254,2255,2256,2257,2258,2259,2260,2261,2262,2263,2264,2265,2266,
+		2267,2268,2269,2270,2271,2272,2273,2274,2275,2276,2277,2278,2279,2280,2281,2282,
+		2283,2284,2285,2286,2287,2288,2289,2290,2291,2292,2293,2294,2295,2296,2297,2298,
+		2299,2300,2301,2302,2303,2304,2305,2306,2307,2308,2309,2310,2311,2312,2313,2314,
+		2315,2316,2317,2318,2319,2320,2321,2322,2323,2324,2325,2326,2327,2328,2329,2330,
+		2331,2332,2333,2334,2335,2336,2337,2338,2339,2340,2341,2342,2343,2344,2345,2346,
+		2347,2348,2349,2350,2351,2352,2353,2354,2355,2356,2357,2358,2359,2360,2361,2362,
+		2363,2364,2365,2366,2367,2368,2369,2370,2371,2372,2373,2374,2375,2376,2377,2378,
+		2379,2380,2381,2382,2383,2384,2385,2386,2387,2388,2389,2390,2391,2392,2393,2394,
+		2395,2396,2397,2398,2399,2400,2401,2402,2403,2404,2405,2406,2407,2408,2409,2410,
+		2411,2412,2413,2414,2415,2416,2417,2418,2419,2420,2421,2422,2423,2424,2425,2426,
+		2427,2428,2429,2430,2431,2432,2433,2434,2435,2436,2437,2438,2439,2440,2441,2442,
+		2443,2444,2445,2446,2447,2448,2449,2450,2451,2452,2453,2454,2455,2456,2457,2458,
+		2459,2460,2461,2462,2463,2464,2465,2466,2467,2468,2469,2470,2471,2472,2473,2474,
+		2475,2476,2477,2478,2479,2480,2481,2482,2483,2484,2485,2486,2487,2488,2489,2490,
+		2491,2492,2493,2494,2495,2496,2497,2498,2499,2500,2501,2502,2503,2504,2505,2506,
+		2507,2508,2509,2510,2511,2512,2513,2514,2515,2516,2517,2518,2519,2520,2521,2522,
+		2523,2524,2525,2526,2527,2528,2529,2530,2531,2532,2533,2534,2535,2536,2537,2538,
+		2539,2540,2541,2542,2543,2544,2545,2546,2547,2548,2549,2550,2551,2552,2553,2554,
+		2555,2556,2557,2558,2559,2560,2561,2562,2563,2564,2565,2566,2567,2568,2569,2570,
+		2571,2572,2573,2574,2575,2576,2577,2578,2579,2580,2581,2582,2583,2584,2585,2586,
+		2587,2588,2589,2590,2591,2592,2593,2594,2595,2596,2597,2598,2599,2600,2601,2602,
+		2603,2604,2605,2606,2607,2608,2609,2610,2611,2612,2613,2614,2615,2616,2617,2618,
+		2619,2620,2621,2622,2623,2624,2625,2626,2627,2628,2629,2630,2631,2632,2633,2634,
+		2635,2636,2637,2638,2639,2640,2641,2642,2643,2644,2645,2646,2647,2648,2649,2650,
+		2651,2652,2653,2654,2655,2656,2657,2658,2659,2660,2661,2662,2663,2664,2665,2666,
+		2667,2668,2669,2670,2671,2672,2673,2674,2675,2676,2677,2678,2679,2680,2681,2682,
+		2683,2684,2685,2686,2687,2688,2689,2690,2691,2692,2693,2694,2695,2696,2697,2698,
+		2699,2700,2701,2702,2703,2704,2705,2706,2707,2708,2709,2710,2711,2719,2720,2721,
+		2722,2723,2724,2725,2726,2727,2728,2729,2730,2731,2732,2733,2734,2735,2736,2737,
+		2738,2739,2740,2741,2742,2743,2744,2745,2746,2747,2748,2749,2750,2751,2752,2753,
+		2754,2755,2756,2757,2758,2759,2760,2761,2762,2763,2764,2765,2766,2767,2768,2769,
+		2770,2771,2772,2773,2774,2775,2776,2777,2778,2779,2780,2781,2782,2783,2784,2785,
+		2786,2787,2788,2789,2790,2791,2792,2793,2794,2795,2796,2797,2798,2799,2800,2801,
+		2802,2803,2804,2805,2806,2807,2808,2809,2810,2811,2812,2813,2814,2815,2816,2817,
+		2818,2819,2820,2821,2822,2828,2832,2838,2839,2840,2841,2842,2843,2844,2845,2846,
+		2847,2848,2849,2850,2851,2852,2853,2854,2855,2856,2857,2858,2859,2860,2861,2862,
+		2863,2864,2865,2866,2867,2868,2869,2870,2871,2872,2873,2874,2875,2876,2877,2878,
+		2879,2880,2881,2882,2883,2884,2885,2886,2887,2888,2889,2890,2891,2892,2893,2894,
+		2895,2896,2897,2898,2899,2900,2901,2902,2903,2904,2905,2906,2907,2908,2909,2910,
+		2911,2912,2913,2914,2915,2916,2917,2918,2919,2920,2921,2922,2923,2924,2925,2926,
+		2927,2928,2929,2930,2931,2932,2933,2934,2935,2936,2937,2938,2939,2942,2943,2944,
+		2945,2946,2947,2948,2949,2950,2951,2952,2953,2954,2955,2956,2957,2958,2959,2960,
+		2961,2962,2963,2964,2965,2966,2967,2968,2969,2970,2971,2972,2973,2974,2975,2976,
+		2977,2978,2979,2980,2981,2982,2983,2984,2985,2986,2987,2988,2989,2990,2991,2992,
+		2993,2994,2995,2996,2997,2998,2999,3000,3001,3002,3003,3004,3005,3006,3007,3008,
+		3009,3010,3011,3012,3013,3014,3015,3016,3017,3018,3019,3020,3021,3022,3023,3024,
+		3025,3026,3027,3028,3029,3030,3031,3032,3033,3034,3035,3036,3037,3038,3039,3040,
+		3041,3042,3043,3044,3045,3046,3047,3048,3049,3050,3051,3052,3053,3054,3055,3056,
+		3057,3058,3059,3060,3061,3062,3063,3064,3065,3066,3067,3068,3069,3070,3071,3072,
+		3073,3074,3075,3076,3077,3078,3079,3080,3081,3082,3083,3084,3085,3086,3087,3088,
+		3089,3090,3091,3092,0,0,3093,3094,3095,3096,3097,3098,3099,3100,3101,3102,
+		3103,3104,3105,3106,3107,3108,3109,3110,3111,3112,3113,3114,3115,3116,3117,3118,
+		3119,3120,3121,3122,3123,3124,0,3125,3126,3127,3128,3129,3130,3131,3132,3133,
+		3134,3135,3136,3137,3138,3139,3140,3141,3142,3143,3144,3145,3146,3147,3148,3149,
+		3150,3151,3152,3153,3154,3155,3156,3157,3158,3159,3160,3161,3162,3163,3164,3165,
+		3166,3167,3168,3169,3170,3171,3172,3173,3174,3175,3176,3177,3178,3179,3180,3181,
+		3182,3183,3184,3185,3186,3187,3188,3189,3190,3191,3192,3193,3194,3195,3196,3197,
+		3198,3199,3200,3201,3202,3203,3204,3205,3206,3207,3208,3209,3210,3211,3212,3213,
+		3214,3215,3216,3217,3218,3219,3220,3221,3222,3223,3224,3225,3226,3227,3228,3229,
+		17397,17402,17407,17412,17417,17422,17427,17430,17435,17440,17445,17450,17455,17460,17465,17470,
+		17475,17480,17485,17490,17495,17500,17505,17510,17515,17518,17521,17526,17531,17536,17541,17546,
+		17551,17556,17559,17564,17569,17572,17577,17582,17587,17592,17597,17600,17603,17606,17609,0,
+		17394,17399,17404,17409,17414,17419,17424,17429,17432,17437,17442,17447,17452,17457,17462,17467,
+		17472,17477,17482,17487,17492,17497,17502,17507,17512,17517,17520,17523,17528,17533,17538,17543,
+		17548,17553,17558,17561,17566,17571,17574,17579,17584,17589,17594,17599,17602,17605,17608,0,
+		12382,12381,12385,13368,13613,10475,14010,11702,11701,12178,12177,14917,14916,10495,12596,10488,
+		10502,14513,14618,14617,14514,11705,11704,13388,11240,13610,13232,11246,11988,14427,13848,14914,
+		16463,16462,16466,16465,16469,16468,16472,16471,16475,16474,16481,16480,16484,16483,16487,16486,
+		16490,16489,16493,16492,16496,16495,16508,16507,16511,16510,16514,16513,16523,16522,16526,16525,
+		16529,16528,16532,16531,16535,16534,16538,16537,16541,16540,16544,16543,16547,16546,16550,16549,
+		16553,16552,16634,16633,16637,16636,16478,16477,16505,16504,16517,16516,16520,16519,16556,16555,
+		16559,16558,16568,16567,16571,16570,16574,16573,16586,16585,16592,16591,16595,16594,16598,16597,
+		16601,16600,16604,16603,16607,16606,16616,16615,16622,16621,16625,16624,16628,16627,16640,16639,
+		16643,16642,16646,16645,16498,3230,3231,3232,3233,3234,3235,16565,16564,16613,16612,8085,
+		8049,8047,16583,16582,0,0,0,0,0,3236,3237,3238,3239,3240,3241,3242,
+		17662,17668,17674,17680,17686,17692,17698,17710,17716,17722,17728,17734,17742,17754,17760,17766,
+		17772,17778,17784,17796,17802,17808,17814,17820,17826,17832,17838,17844,17850,17856,17862,17874,
+		17880,17704,17748,17790,17868,17886,0,17895,0,0,0,0,0,17910,0,0,
+		21488,21489,21490,21491,21492,21493,21494,21495,21496,21497,21498,21499,21501,21502,21503,21504,
+		21505,21506,21507,21508,21509,21510,21511,21512,21513,21514,21515,21516,21517,21518,21519,21520,
+		21521,21522,21523,21524,21526,21527,21528,21529,21530,21531,21532,21533,21534,21535,21536,21537,
+		21538,21539,21540,21541,21542,21543,21500,21525,0,0,0,0,0,0,0,21544,
+		3243,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		21561,21582,21599,21608,21623,21661,21678,21687,21709,21718,21727,21776,21807,21822,21831,21865,
+		21874,21890,21938,21853,21854,21855,21856,0,0,0,0,0,0,0,0,0,
+		21942,21943,21944,21945,21946,21947,21948,0,21949,21950,21951,21952,21953,21954,21955,0,
+		21956,21957,21958,21959,21960,21961,21962,0,21963,21964,21965,21966,21967,21968,21969,0,
+		21970,21971,21972,21973,21974,21975,21976,0,21977,21978,21979,21980,21981,21982,21983,0,
+		21984,21985,21986,21987,21988,21989,21990,0,21991,21992,21993,21994,21995,21996,21997,0,
+		16681,16686,16691,16723,16777,16805,16906,16939,16969,16980,17011,17035,17049,17060,17075,17147,
+		17187,17204,17243,17251,17368,17064,16649,16746,16901,17134,17293,17311,17319,17335,17343,17357,
+		3244,3245,3246,3247,3248,3249,3250,3251,3252,3253,3254,3255,3256,3257,3258,3259,
+		3260,3261,3262,3263,3264,3265,3266,3267,3268,3269,3270,3271,3272,3273,3274,3275,
+		3276,3277,3278,3279,3280,3281,3282,3283,3284,3285,3286,3287,3288,3289,3290,17258,
+		3291,3292,3293,3294,3295,3296,3297,3298,3299,3300,3301,3302,3303,3304,3305,3306,
+		3307,3308,3309,3310,3311,3312,3313,3314,3315,3316,3317,3318,3319,3320,3321,3322,
+		3323,3324,3325,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		38717,39399,38761,38757,38751,38853,39053,39127,39145,39151,39359,39369,39933,39939,39953,39959,
+		39949,39963,40073,40113,40203,40197,40265,40259,40417,40561,0,40629,40657,40751,40977,41007,
+		41023,41047,41051,41251,41339,41343,38693,41381,41415,41459,41593,41679,41765,41771,41935,42009,
+		42077,42103,42093,42107,42113,42097,42139,42145,42151,42183,42233,42227,42241,42311,42361,42365,
+		42371,42533,42629,42681,42677,42701,42705,42709,42779,42867,42891,42949,42977,42981,42987,43025,
+		43155,43159,43163,43167,43187,43195,43201,43269,43299,43331,43375,43383,43391,43395,43403,43399,
+		43429,43437,43471,43479,43513,43535,43563,43571,43597,43613,43645,43689,43695,43703,43709,43721,
+		43731,43743,43749,43755,0,0,0,0,0,0,0,0,0,0,0,0,
+		38593,38689,38713,38735,38743,38781,38789,38833,38845,38969,38993,39009,39049,39075,39091,39123,
+		39137,39141,39211,39267,39283,39291,39295,39307,39355,39365,39395,39405,39413,39429,39605,39637,
+		39713,39733,39741,39745,39765,39809,39857,39877,39917,39929,39949,39969,39997,40001,40045,40057,
+		40069,40081,40097,40113,40121,40165,40173,40181,40185,40193,40211,40227,40255,40385,40405,40409,
+		40553,40557,40589,40597,40609,40617,40625,40641,40715,40731,40785,40941,40953,40973,40991,41003,
+		41011,41015,41019,41027,41031,41235,41331,41353,41357,41361,41365,41373,41377,41411,41443,41451,
+		41521,41525,41533,41537,41549,41553,41589,41599,41627,41631,41635,41639,41675,41717,41721,41725,
+		41761,41867,41871,41903,41923,41931,41969,42005,42081,42089,42135,42167,42179,42191,42195,42199,
+		42223,42237,42271,42279,42295,42307,42325,42333,42337,42341,42349,42353,42529,42553,42605,42613,
+		42625,42673,42693,42705,42719,42783,42787,42799,42803,42807,42871,42875,42887,42913,42921,42953,
+		42965,42969,43021,43059,43079,43087,43099,43159,43171,43191,43237,43249,43265,43295,43307,43311,
+		43315,43319,43335,43339,43347,43379,43387,43395,43433,43443,43451,43475,43485,43489,43497,43501,
+		43505,43509,43519,43539,43567,43581,43593,43605,43609,43617,43625,43633,43637,43653,43661,43669,
+		43677,43685,43699,43717,43739,43759,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		3326,3327,3328,3329,3330,3331,3332,3333,3334,3335,3336,3337,0,0,0,0,
+		3338,3340,3341,3342,3343,8630,30790,8721,1184,1185,3344,3345,3346,3347,3348,3349,
+		3350,3351,3352,3353,3354,3355,3356,3357,3358,3359,3360,3361,3362,3363,3364,3365,
+		3366,8754,9235,9496,9626,9725,9796,9855,9920,9977,8567,8569,8571,8573,8575,8577,
+		3367,8635,8636,8639,8640,8643,3368,3370,39307,39323,39327,8631,31396,3371,3372,3373,
+		0,30298,30300,30346,30348,30376,30378,30406,30408,30440,30442,30468,30478,30524,30532,30614,
+		30624,30674,30684,30698,30706,30736,30746,30772,30782,30804,30814,30822,30830,30850,30858,30866,
+		30874,30890,30898,30906,30908,30920,30928,30936,30954,30964,30982,30994,31002,31012,31020,31034,
+		31044,31052,31096,31106,31114,31154,31164,31172,31218,31228,31236,31300,31310,31318,31374,31422,
+		31454,31464,31496,31504,31506,31532,31534,31552,31554,31570,31580,31602,31630,31656,31666,31668,
+		31690,31704,31718,31732,30390,30466,30672,0,0,8093,8097,3374,3375,8644,8645,31566,
+		3376,30302,30306,30350,30354,30380,30384,30410,30414,30444,30448,30472,30482,30526,30536,30618,
+		30628,30678,30688,30700,30710,30738,30750,30776,30786,30808,30818,30824,30834,30852,30862,30868,
+		30878,30892,30902,30910,30914,30924,30930,30940,30958,30968,30984,30996,31006,31014,31022,31038,
+		31048,31056,31100,31110,31118,31158,31168,31176,31222,31232,31240,31304,31314,31322,31376,31424,
+		31458,31466,31498,31508,31512,31536,31540,31556,31560,31574,31584,31606,31634,31660,31670,31672,
+		31694,31708,31722,31736,30394,30470,30676,31678,31698,31712,31728,3377,8648,8651,8652,30726,
+		0,0,0,0,0,32026,32031,32034,32036,32038,32039,32042,32044,32045,32052,32057,
+		32060,32065,32066,32070,32071,32072,32073,32074,32079,32080,32084,32089,32095,32098,32104,32109,
+		32110,32115,32116,32117,32118,32120,32123,32124,32133,32142,32037,32055,32067,32143,32096,32043,
+		0,29314,29339,30106,29344,30112,30117,29369,29394,29399,30124,30129,30134,30139,30144,30149,
+		29756,29424,29449,29474,29775,29479,29504,29509,29564,29605,29610,29645,29670,29695,29720,29910,
+		29915,29920,29925,29930,29935,29940,29945,29950,29955,29960,29965,29970,29975,29980,29985,29990,
+		29995,30000,30005,30010,29905,29746,29749,30171,30174,30180,30184,30191,30197,30201,29762,30207,
+		30211,29765,29768,29772,29780,29783,29789,29793,29797,29800,29803,29806,29809,29814,29820,29832,
+		29841,29848,30231,30234,29861,29864,29867,30029,30032,30037,30048,30051,30055,30067,30072,0,
+		3378,3379,38609,38813,38653,39621,38665,38701,38673,41557,38747,38681,38617,39777,39653,38849,
+		32027,32075,32061,32048,32099,32100,32094,32090,32138,32085,32125,32134,32035,32056,32105,32111,
+		32121,32122,32119,32129,32032,32040,32053,32058,32081,32082,32083,32046,32068,32069,32144,32145,
+		3380,3381,3382,3383,3384,3385,3386,3387,3388,3389,3390,3391,3392,3393,3394,3395,
+		3396,3397,3398,3399,3400,3401,3402,3403,3404,3405,3406,3407,3408,3409,3410,3411,
+		3412,3413,3414,3415,0,0,0,0,0,0,0,0,0,0,0,0,
+		30616,30774,30806,30956,31004,31036,31098,31156,31220,31302,31456,31572,31582,31604,31632,31658,
+		29316,29346,29371,29401,29426,29451,29481,29511,29566,29612,29647,29672,29697,29722,29326,29356,
+		29381,29411,29436,29461,29491,29521,29576,29622,29657,29682,29707,29732,29588,29533,29547,0,
+		38597,38793,38633,39609,38821,39029,38621,39013,38765,39311,40735,41239,41035,40789,43103,39641,
+		40645,40853,40757,41783,39465,41391,42811,41815,39223,38865,39505,39865,41659,38885,42839,39339,
+		41835,38897,42283,42299,39533,40117,40593,41945,8803,9280,9530,9657,9756,9827,9886,9951,
+		13352,9300,9320,9348,9374,9394,9412,9424,9436,9448,9530,9542,9554,9558,9562,9572,
+		29322,29352,29377,29407,29432,29457,29487,29517,29572,29618,29653,29678,29703,29728,29334,29364,
+		29389,29419,29444,29469,29499,29529,29584,29630,29665,29690,29715,29740,29634,29596,29559,3416,
+		38605,38809,38649,39617,38829,39037,38629,39021,38773,39319,40743,41247,41043,40797,43111,39649,
+		40653,40861,40765,41791,39473,41399,42819,41823,39231,41879,41565,39813,43005,38965,39375,41083,
+		43351,38905,39083,40957,38661,38697,38669,40061,39449,39299,39893,39873,41667,38893,42847,39347,
+		39757,9582,9586,9590,9600,9657,9661,9665,9669,9673,9677,9687,9691,9695,9699,9756,
+		9223,9484,9614,9713,9784,9843,9908,9965,10014,8815,8865,8921,11657,11222,11228,12352,
+		30310,30358,30388,30418,30452,30476,30530,30622,30682,30704,30742,30780,30812,30828,30856,30872,
+		30896,30918,30934,30962,30988,31000,31010,31018,31026,31042,31104,31162,31226,31308,31380,31428,
+		31462,31470,31502,31516,31544,31564,31578,31588,31610,31638,31664,31676,31696,31710,31726,38877,
+		30318,30328,30336,30312,30360,30370,30398,30428,30420,30460,30454,30486,30492,30500,30508,30516,
+		30540,30548,30556,30564,30576,30580,30592,30604,30632,30640,30652,30664,30692,30730,30714,30754,
+		30762,30794,30838,30844,30882,30948,30972,30978,30990,31028,31090,31060,31072,31080,31122,31134,
+		31142,31148,31180,31192,31200,31212,31262,31272,31278,31286,31292,31244,31254,31338,31352,31360,
+		31364,31326,31332,31382,31390,31400,31406,31412,31430,31438,31442,31480,31486,31472,31518,31526,
+		31546,31590,31598,31622,31612,31640,31644,31682,8748,9229,9490,9620,9719,9790,9849,9914,
+		9971,10020,8823,8873,8929,8969,9009,9049,9089,9129,9169,9209,9292,9312,9340,9366,
+		9386,11677,10882,10438,10561,13197,13312,10902,10906,10912,11908,40101,40679,39769,40663,40865,
+		13300,12710,15858,12480,12096,12100,12488,11496,10682,12104,13316,12720,15862,15866,12500,12112,
+		11687,12116,12504,11500,13976,15870,12516,10898,12126,11362,12740,15874,12520,10712,12130,12524,
+		10716,12472,12138,12530,10722,12476,12144,12552,12562,13304,12150,12542,11506,13552,13558,13568,
+		13348,12748,15878,12558,13358,12752,15882,12570,12160,12574,13362,12756,15886,12578,12164,12582,
+		12168,12586,10396,10567,10688,10696,10700,10734,10890,11512,11643,11673,11904,12122,12134,12156,
+		12318,12322,12326,12358,12484,12510,12536,13320,13324,13332,13344,13802,13832,14601,14479,10404,
+		9217,9478,9608,9707,9778,9837,9902,9959,10008,8807,8857,8913,8961,9001,9041,9081,
+		9121,9161,9201,9284,9304,9332,9358,9378,9404,9416,9428,9440,9452,9534,9546,11490,
+		3417,3418,3419,3420,3421,3422,3423,3424,3425,3426,3427,3428,3429,3430,3431,3432,
+		3433,3434,3435,3436,3437,3438,3439,3440,3441,3442,3443,3444,3445,3446,3447,3448,
+		3449,3450,3451,3452,3453,3454,3455,3456,3457,3458,3459,3460,3461,3462,3463,3464,
+		3465,3466,3467,3468,3469,3470,3471,3472,3473,3474,3475,3476,3477,3478,3479,3480,
+		32146,32147,32148,32149,32150,32151,32152,32153,32154,32155,32156,32157,32158,32159,32160,32161,
+		32162,32163,32164,32165,32166,32167,32168,32169,32170,32171,32172,32173,32174,32175,32176,32177,
+		32178,32179,32180,32181,32182,32183,32184,32185,32186,32187,32188,32189,32190,32191,32192,32193,
+		32194,32195,32196,32197,32198,32199,32200,32201,32202,32203,32204,32205,32206,32207,32208,32209,
+		32210,32211,32212,32213,32214,32215,32216,32217,32218,32219,32220,32221,32222,32223,32224,32225,
+		32226,32227,32228,32229,32230,32231,32232,32233,32234,32235,32236,32237,32238,32239,32240,32241,
+		32242,32243,32244,32245,32246,32247,32248,32249,32250,32251,32252,32253,32254,32255,32256,32257,
+		32258,32259,32260,32261,32262,32263,32264,32265,32266,32267,32268,32269,32270,32271,32272,32273,
+		32274,32275,32276,32277,32278,32279,32280,32281,32282,32283,32284,32285,32286,32287,32288,32289,
+		32290,32291,32292,32293,32294,32295,32296,32297,32298,32299,32300,32301,32302,32303,32304,32305,
+		32306,32307,32308,32309,32310,32311,32312,32313,32314,32315,32316,32317,32318,32319,32320,32321,
+		32322,32323,32324,32325,32326,32327,32328,32329,32330,32331,32332,32333,32334,32335,32336,32337,
+		32338,32339,32340,32341,32342,32343,32344,32345,32346,32347,32348,32349,32350,32351,32352,32353,
+		32354,32355,32356,32357,32358,32359,32360,32361,32362,32363,32364,32365,32366,32367,32368,32369,
+		32370,32371,32372,32373,32374,32375,32376,32377,32378,32379,32380,32381,32382,32383,32384,32385,
+		32386,32387,32388,32389,32390,32391,32392,32393,32394,32395,32396,32397,32398,32399,32400,32401,
+		32402,32403,32404,32405,32406,32407,32408,32409,32410,32411,32412,32413,32414,32415,32416,32417,
+		32418,32419,32420,32421,32422,32423,32424,32425,32426,32427,32428,32429,32430,32431,32432,32433,
+		32434,32435,32436,32437,32438,32439,32440,32441,32442,32443,32444,32445,32446,32447,32448,32449,
+		32450,32451,32452,32453,32454,32455,32456,32457,32458,32459,32460,32461,32462,32463,32464,32465,
+		32466,32467,32468,32469,32470,32471,32472,32473,32474,32475,32476,32477,32478,32479,32480,32481,
+		32482,32483,32484,32485,32486,32487,32488,32489,32490,32491,32492,32493,32494,32495,32496,32497,
+		32498,32499,32500,32501,32502,32503,32504,32505,32506,32507,32508,32509,32510,32511,32512,32513,
+		32514,32515,32516,32517,32518,32519,32520,32521,32522,32523,32524,32525,32526,32527,32528,32529,
+		32530,32531,32532,32533,32534,32535,32536,32537,32538,32539,32540,32541,32542,32543,32544,32545,
+		32546,32547,32548,32549,32550,32551,32552,32553,32554,32555,32556,32557,32558,32559,32560,32561,
+		32562,32563,32564,32565,32566,32567,32568,32569,32570,32571,32572,32573,32574,32575,32576,32577,
+		32578,32579,32580,32581,32582,32583,32584,32585,32586,32587,32588,32589,32590,32591,32592,32593,
+		32594,32595,32596,32597,32598,32599,32600,32601,32602,32603,32604,32605,32606,32607,32608,32609,
+		32610,32611,32612,32613,32614,32615,32616,32617,32618,32619,32620,32621,32622,32623,32624,32625,
+		32626,32627,32628,32629,32630,32631,32632,32633,32634,32635,32636,32637,32638,32639,32640,32641,
+		32642,32643,32644,32645,32646,32647,32648,32649,32650,32651,32652,32653,32654,32655,32656,32657,
+		32658,32659,32660,32661,32662,32663,32664,32665,32666,32667,32668,32669,32670,32671,32672,32673,
+		32674,32675,32676,32677,32678,32679,32680,32681,32682,32683,32684,32685,32686,32687,32688,32689,
+		32690,32691,32692,32693,32694,32695,32696,32697,32698,32699,32700,32701,32702,32703,32704,32705,
+		32706,32707,32708,32709,32710,32711,32712,32713,32714,32715,32716,32717,32718,32719,32720,32721,
+		32722,32723,32724,32725,32726,32727,32728,32729,32730,32731,32732,32733,32734,32735,32736,32737,
+		32738,32739,32740,32741,32742,32743,32744,32745,32746,32747,32748,32749,32750,32751,32752,32753,
+		32754,32755,32756,32757,32758,32759,32760,32761,32762,32763,32764,32765,32766,32767,32768,32769,
+		32770,32771,32772,32773,32774,32775,32776,32777,32778,32779,32780,32781,32782,32783,32784,32785,
+		32786,32787,32788,32789,32790,32791,32792,32793,32794,32795,32796,32797,32798,32799,32800,32801,
+		32802,32803,32804,32805,32806,32807,32808,32809,32810,32811,32812,32813,32814,32815,32816,32817,
+		32818,32819,32820,32821,32822,32823,32824,32825,32826,32827,32828,32829,32830,32831,32832,32833,
+		32834,32835,32836,32837,32838,32839,32840,32841,32842,32843,32844,32845,32846,32847,32848,32849,
+		32850,32851,32852,32853,32854,32855,32856,32857,32858,32859,32860,32861,32862,32863,32864,32865,
+		32866,32867,32868,32869,32870,32871,32872,32873,32874,32875,32876,32877,32878,32879,32880,32881,
+		32882,32883,32884,32885,32886,32887,32888,32889,32890,32891,32892,32893,32894,32895,32896,32897,
+		32898,32899,32900,32901,32902,32903,32904,32905,32906,32907,32908,32909,32910,32911,32912,32913,
+		32914,32915,32916,32917,32918,32919,32920,32921,32922,32923,32924,32925,32926,32927,32928,32929,
+		32930,32931,32932,32933,32934,32935,32936,32937,32938,32939,32940,32941,32942,32943,32944,32945,
+		32946,32947,32948,32949,32950,32951,32952,32953,32954,32955,32956,32957,32958,32959,32960,32961,
+		32962,32963,32964,32965,32966,32967,32968,32969,32970,32971,32972,32973,32974,32975,32976,32977,
+		32978,32979,32980,32981,32982,32983,32984,32985,32986,32987,32988,32989,32990,32991,32992,32993,
+		32994,32995,32996,32997,32998,32999,33000,33001,33002,33003,33004,33005,33006,33007,33008,33009,
+		33010,33011,33012,33013,33014,33015,33016,33017,33018,33019,33020,33021,33022,33023,33024,33025,
+		33026,33027,33028,33029,33030,33031,33032,33033,33034,33035,33036,33037,33038,33039,33040,33041,
+		33042,33043,33044,33045,33046,33047,33048,33049,33050,33051,33052,33053,33054,33055,33056,33057,
+		33058,33059,33060,33061,33062,33063,33064,33065,33066,33067,33068,33069,33070,33071,33072,33073,
+		33074,33075,33076,33077,33078,33079,33080,33081,33082,33083,33084,33085,33086,33087,33088,33089,
+		33090,33091,33092,33093,33094,33095,33096,33097,33098,33099,33100,33101,33102,33103,33104,33105,
+		33106,33107,33108,33109,33110,33111,33112,33113,33114,33115,33116,33117,33118,33119,33120,33121,
+		33122,33123,33124,33125,33126,33127,33128,33129,33130,33131,33132,33133,33134,33135,33136,33137,
+		33138,33139,33140,33141,33142,33143,33144,33145,33146,33147,33148,33149,33150,33151,33152,33153,
+		33154,33155,33156,33157,33158,33159,33160,33161,33162,33163,33164,33165,33166,33167,33168,33169,
+		33170,33171,33172,33173,33174,33175,33176,33177,33178,33179,33180,33181,33182,33183,33184,33185,
+		33186,33187,33188,33189,33190,33191,33192,33193,33194,33195,33196,33197,33198,33199,33200,33201,
+		33202,33203,33204,33205,33206,33207,33208,33209,33210,33211,33212,33213,33214,33215,33216,33217,
+		33218,33219,33220,33221,33222,33223,33224,33225,33226,33227,33228,33229,33230,33231,33232,33233,
+		33234,33235,33236,33237,33238,33239,33240,33241,33242,33243,33244,33245,33246,33247,33248,33249,
+		33250,33251,33252,33253,33254,33255,33256,33257,33258,33259,33260,33261,33262,33263,33264,33265,
+		33266,33267,33268,33269,33270,33271,33272,33273,33274,33275,33276,33277,33278,33279,33280,33281,
+		33282,33283,33284,33285,33286,33287,33288,33289,33290,33291,33292,33293,33294,33295,33296,33297,
+		33298,33299,33300,33301,33302,33303,33304,33305,33306,33307,33308,33309,33310,0,0,0,
+		3481,3482,3483,3484,3485,3486,3487,3488,3489,3490,3491,3492,3493,3494,3495,3496,
+		3497,3498,3499,3500,3501,3502,3503,3504,3505,3506,3507,3508,3509,3510,3511,3512,
+		3513,3514,3515,3516,3517,3518,3519,3520,3521,3522,3523,3524,3525,3526,3527,3528,
+		3529,3530,3531,3532,3533,3534,3535,0,0,0,0,0,0,0,0,0,
+		33317,33318,33319,33320,33321,33322,33323,33324,33325,33326,33327,33328,33329,33330,33331,33332,
+		33333,33334,33335,33336,33337,33338,33339,33340,33341,33342,33345,33343,33346,33344,33348,33349,
+		33350,33351,33352,33353,33354,33355,33356,33357,33311,33312,33313,33314,33316,33315,3536,3537,
+		27907,27908,27909,27910,27911,27912,27913,27914,27915,27916,27917,27918,27919,27924,27925,27926,
+		27927,27928,27929,27930,27931,27932,27933,27934,27935,27936,27937,27938,27939,27940,27941,27946,
+		27947,27948,27949,27950,27951,27952,27953,27954,27955,27956,27957,27958,27959,27960,27961,27962,
+		27963,27964,27965,27966,27971,27972,27973,27974,27975,27976,27977,27978,27979,27980,27981,27982,
+		27983,27984,27985,27986,27987,27988,27989,27990,27995,27996,27997,27998,27999,28000,28001,28002,
+		28003,28004,28005,28010,28011,28012,28013,28014,28015,28022,28023,28028,28029,28030,28031,28032,
+		28033,28038,28039,28040,28041,28042,28043,28044,28045,28046,28047,28050,28051,28052,28053,28056,
+		28057,28058,28059,28060,28061,28062,28063,28064,28065,28066,28067,28068,28069,28070,28071,28072,
+		28073,28074,28075,28076,28077,28078,28083,28084,28087,28088,28089,28090,28091,28092,28093,28094,
+		28095,28096,28097,28098,28099,28100,28101,28102,28103,28104,28105,28106,28107,28108,28109,28110,
+		28111,28112,28113,28114,28115,28116,28117,28118,28119,28120,28121,28122,28123,28124,28125,28126,
+		28127,28128,28129,28130,28131,28136,28137,28138,28139,28140,28141,28142,28143,28144,28145,28146,
+		28147,28148,28149,28150,28151,28152,28153,28154,28155,28156,28157,28158,28163,28164,28165,28166,
+		28167,28168,28175,28176,28177,28178,28179,28180,28181,28186,28187,28188,28189,28190,28191,28192,
+		28193,28194,28195,28196,28197,28198,28199,28200,28201,28202,28203,28204,28205,28206,28207,28208,
+		28209,28210,28211,28212,28213,28214,28215,28216,28217,28218,28219,28220,28221,28222,28223,28224,
+		28225,28226,28227,28228,28229,28230,28231,28232,28233,28234,28235,28236,28237,3538,3539,3540,
+		28016,28048,28085,27920,27942,27967,27991,28006,28018,28024,28034,28079,28132,28159,28171,28182,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,28054,28169,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		16817,16816,16826,16825,16832,16831,16892,16891,16903,16900,17136,17133,17178,17177,17256,17255,
+		17268,17267,17298,17297,17316,17315,17321,17318,17340,17339,17348,17347,17354,17353,17383,17382,
+		17192,17191,16737,16736,16960,16959,16977,16976,17015,17011,17015,17011,17015,17011,17011,8149,
+		1,1,1,3541,16772,16848,16883,17095,17261,17271,17283,17170,8085,8085,3542,17259,
+		16731,16730,16844,16843,16799,16798,17231,17230,16838,16837,17089,17088,17080,17079,17195,17194,
+		17201,17200,17219,17218,17167,17166,17248,17247,17015,17011,17015,17011,17265,17287,17142,17330,
+		28238,28239,28240,28241,28242,28243,28244,28245,28246,28247,28248,28249,28250,28251,28252,28253,
+		28254,28255,28256,28257,28258,28259,28260,28261,28262,28263,28264,28265,28266,28267,28268,28269,
+		28270,28271,28272,28273,28274,28275,28276,28277,28278,28279,28280,28281,28282,28283,28284,28285,
+		28286,28287,28288,28289,28290,28291,28292,28293,28294,28295,28296,28297,28298,28299,28300,28301,
+		28302,28303,28304,28305,28306,28307,28308,28309,28310,28311,28312,28313,28314,28315,28316,28317,
+		8415,8417,3543,3544,3545,3546,3547,3548,0,0,0,0,0,0,0,0,
+		3549,3550,3551,3552,3553,3554,3555,3556,3557,3558,3559,3560,3561,3562,3563,3564,
+		3565,3566,3567,3568,3569,3570,3571,3572,3573,3574,3575,3576,3577,3578,3579,3580,
+		3581,3582,15005,15004,15021,15020,11711,11710,14002,13998,14975,14974,14978,14977,14981,14980,
+		11378,13836,10332,10328,10414,10410,10434,10430,10446,10442,10456,10450,10466,10462,10774,10773,
+		12181,12180,12184,12183,12187,12186,12372,12371,12376,12375,13239,13238,13224,13223,13193,13189,
+		13371,13370,13379,13378,13382,13381,13424,13423,13427,13426,13594,13591,13631,13630,14505,14504,
+		14499,14495,14920,14919,14945,14944,14948,14947,14954,14953,14960,14959,14963,14962,14968,14965,
+		14970,10978,12407,12603,12785,13628,13629,14024,14972,10878,10874,11328,11324,11486,11535,11534,
+		12410,12409,13548,13544,13768,13764,13956,13952,3583,3584,3585,15008,15007,14370,12405,15010,
+		12777,12776,10759,10758,10761,11695,10579,10578,11381,11380,10213,10205,12917,12909,14116,14108,
+		11478,11474,12078,12074,12685,12681,13501,13497,13735,13731,11697,11268,11517,12394,11932,13422,
+		12190,14026,12010,14702,10591,10588,13243,13242,14359,14358,10480,10479,11951,11950,14367,14366,
+		0,0,14615,14614,10762,13843,14902,10963,10962,13838,13837,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,11708,11707,11937,11622,13179,14381,11391,13384,12601,11936,12602,
+		22896,22897,22898,22899,22900,22901,22902,22904,22905,22906,22907,8443,22908,22909,22910,22911,
+		22912,22913,22914,22915,22916,22917,22918,22919,22920,22921,22922,22923,22924,22925,22926,22927,
+		22928,22929,22930,22931,22932,22933,22934,22935,3586,3587,3588,3589,22903,0,0,0,
+		3590,3591,3592,3593,3594,3595,3596,3597,8678,3598,0,0,0,0,0,0,
+		24930,24931,24932,24933,24934,24935,24936,24937,24942,24943,24944,24945,24946,24947,24948,24949,
+		24950,24951,24952,24953,24955,24956,24957,24958,24961,24964,24965,24967,24968,24971,24976,24977,
+		24978,24979,24972,24973,24974,24975,24980,24954,24959,24938,24939,24940,24941,24960,24966,24969,
+		24970,24962,24963,24981,3599,3600,3601,3602,0,0,0,0,0,0,0,0,
+		8443,8445,22936,22937,22938,22939,22940,22941,22942,22943,22944,22945,22946,22947,22948,22949,
+		22950,22951,22952,22953,22954,22955,22956,22957,22958,22959,22960,22961,22962,22963,22964,22965,
+		22966,22967,22968,22969,22970,22971,22972,22973,22974,22975,22976,22977,22978,22979,22980,22981,
+		22982,22983,22984,22985,22986,22987,22988,22989,22990,22991,22992,22993,22994,22995,22996,22997,
+		22998,22999,23000,23001,23002,8441,0,0,0,0,0,0,0,0,3603,3604,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,22107,22108,22108,22108,22108,22108,3605,3606,3607,22110,3608,21999,22021,22131,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,25271,25272,25273,25274,25275,25276,
+		25277,25278,25279,25280,25281,25282,25283,25284,25285,25286,25287,25288,25289,25290,25291,25292,
+		25293,25294,25295,25296,25297,25298,25299,25300,25301,25302,25303,8509,8511,8513,3609,3610,
+		25235,25236,25237,25238,25239,25240,25241,25242,25243,25244,25245,25246,25247,25248,25249,25250,
+		25251,25252,25253,25254,25255,25256,25257,25258,25259,25260,25261,25262,25263,25264,25265,25266,
+		25267,25268,25269,25270,0,0,0,0,0,0,0,0,0,0,0,3611,
+		29874,29875,29876,29877,29878,29879,29880,29881,29882,29883,29884,29885,29886,29887,29888,29889,
+		29890,29891,29892,29893,29894,29895,29896,29897,29898,29899,29900,29901,29902,0,0,0,
+		8441,8443,8455,8445,26008,26009,26010,26011,26012,26013,26014,26015,26016,26017,26018,26019,
+		26020,26021,26022,26023,26024,26025,26026,26027,26028,26029,26030,26031,26032,26033,26034,26035,
+		26036,26037,26038,26039,26040,26041,26042,26043,26044,26045,26046,26048,26049,26052,26053,26054,
+		26055,26056,26057,8439,26058,26059,26062,26063,26064,26065,26067,26068,26061,26066,26047,26051,
+		26069,3612,3613,3614,3615,3616,3617,3618,3619,3620,3621,3622,3623,3624,0,8620,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,3625,3626,
+		25313,25321,25331,25353,25378,25461,8621,25339,25373,25311,25314,25326,25333,25347,25350,25354,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,25412,25359,25362,25376,25379,0,
+		25858,25859,25860,25861,25862,25863,25864,25865,25866,25867,25868,25869,25870,25871,25872,25873,
+		25874,25875,25876,25877,25878,25879,25880,25881,25882,25883,25884,25885,25886,25887,25888,25889,
+		25890,25891,25892,25893,25894,25895,25896,25897,25898,25903,25904,25905,25906,25907,25908,25909,
+		25910,25911,25912,25899,25900,25901,25902,0,0,0,0,0,0,0,0,0,
+		25913,25914,25915,25916,25917,25918,25919,25920,25921,25922,25923,25924,25925,25926,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,3627,3628,3629,3630,
+		25310,25319,25322,25325,25332,25338,25342,25344,25346,25349,25361,25365,25404,25407,25409,25371,
+		8622,25410,25328,25385,25485,25486,25487,3631,3632,3633,25386,25482,25483,25484,25323,25335,
+		24440,24441,24442,24443,24444,24445,24446,24447,24448,24449,24450,24451,24452,24453,24454,24455,
+		24456,24457,24458,24459,24460,24461,24462,24463,24464,24465,24466,24467,24468,24469,24470,24471,
+		24472,24473,24474,24475,24476,24477,24478,24479,24480,24481,24482,24483,24484,24485,24486,24487,
+		24488,24489,24490,24491,24492,24493,24495,24497,24498,24499,24501,24502,24504,24506,24507,8503,
+		24508,8505,24509,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,24510,24511,8623,3634,3635,
+		22861,22862,22863,22864,22865,22866,22867,22868,22869,22870,22871,22880,22881,22882,22883,22884,
+		3636,3637,22833,8624,8625,22885,22895,0,0,0,0,0,0,0,0,0,
+		0,21609,21610,21611,21612,21613,21614,0,0,21808,21809,21810,21811,21812,21813,0,
+		0,21777,21778,21779,21780,21781,21782,0,0,0,0,0,0,0,0,0,
+		21875,21876,21877,21878,21879,21880,21881,0,21899,21900,21901,21902,21903,21904,21905,0,
+		10499,10486,11233,11234,11239,11379,11521,12396,12389,12392,12600,12784,12791,13203,13212,13220,
+		13208,13206,13207,13209,13210,13584,13590,13619,13620,13615,13621,13622,13623,13859,14344,14357,
+		14350,14351,14363,14701,14704,14705,14697,14698,14699,14700,14813,3638,11713,12397,12387,14364,
+		14956,14957,13222,14958,10506,16452,10948,13990,13627,14623,3639,3640,0,0,0,0,
+		26238,26241,26244,26247,26250,26253,26256,26259,26262,26265,26268,26271,26274,26277,26280,26283,
+		26286,26289,26292,26295,26298,26301,26304,26307,26310,26313,26316,26319,26322,26325,26328,26331,
+		26334,26337,26340,26343,26346,26349,26352,26355,26358,26361,26364,26367,26370,26373,26376,26379,
+		26382,26385,26388,26391,26394,26397,26400,26403,26406,26409,26412,26415,26418,26421,26424,26427,
+		26430,26433,26436,26439,26442,26445,26448,26451,26454,26457,26460,26463,26466,26469,26472,26475,
+		22834,22835,22836,22837,22838,22839,22840,22841,22842,22843,22844,22845,22846,22847,22848,22849,
+		22850,22851,22852,22853,22854,22855,22856,22857,22858,22859,22860,22886,22887,22888,22889,22890,
+		22891,22892,22893,22872,22873,22874,22875,22876,22877,22878,22879,3641,8459,22894,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		30080,30081,30082,30083,30084,30085,30086,30087,30088,30089,30090,30091,30092,30093,30094,30095,
+		30096,30097,30098,30099,30100,30101,30102,0,0,0,0,30249,30250,30251,30252,30253,
+		30254,30255,30256,30257,30258,30259,30260,30261,30262,30263,30264,30265,30266,30267,30268,30269,
+		30270,30271,30272,30273,30274,30275,30276,30277,30278,30279,30280,30281,30282,30283,30284,30285,
+		30286,30287,30288,30289,30290,30291,30292,30293,30294,30295,30296,30297,0,0,0,0,
+		42791,40719,42917,42851,41179,38709,39433,43735,43735,39793,43095,39553,39789,40377,41623,42131,
+		42525,42589,42653,43017,40917,41091,41287,41473,42469,43067,43459,38777,39383,40937,41323,42521,
+		43559,40021,41211,42505,42669,40445,42267,42601,40145,40773,41115,41427,43035,38917,39103,39255,
+		40549,40929,41319,41671,42175,42513,42541,42905,43287,43523,43555,41737,41843,42041,42441,43139,
+		43577,42743,39709,40177,41965,42219,41387,41745,42835,43279,39705,39981,40921,41135,41187,42025,
+		42065,43209,39243,42247,39115,39111,41887,42045,42465,43217,42771,40449,40917,42755,38727,39905,
+		40285,41447,41585,39287,41753,38933,40247,38677,41071,40585,42021,39409,39689,41689,42473,42727,
+		40995,42961,41063,40465,42401,40497,41581,38841,39005,39107,40885,41997,42345,42739,43091,39263,
+		39493,39805,40161,40621,41215,41757,43179,43467,43585,43621,39207,40711,40965,42945,40109,40353,
+		40381,40541,41199,41299,41509,41875,42053,42211,42929,42481,42993,43143,39163,39215,39521,41283,
+		42633,42727,40141,40277,40489,40987,41961,41435,38873,39625,39905,40041,40289,41469,41497,42159,
+		42203,43115,43275,43291,43359,38921,41863,43075,43245,40313,38785,38957,39909,39973,40601,40917,
+		41311,41619,42493,43013,43713,40695,43205,39203,40825,40837,41107,41163,41481,41577,41733,42017,
+		43371,39025,40397,43221,38941,40013,41139,42933,40231,40321,40845,41447,43229,39171,39477,39989,
+		40671,40809,40897,41079,41477,41603,42123,42637,42649,43083,43257,39303,41167,39481,41315,41513,
+		42509,43233,43531,43589,40833,41131,42275,41919,41941,41977,41423,41267,42767,38857,42417,39175,
+		39159,40125,40453,41989,39881,41095,40707,42941,42609,43213,42689,40153,38973,39577,43763,43767,
+		39685,43771,40691,43775,43779,39119,41431,41643,41775,41827,41831,41859,43303,41981,42163,43783,
+		42517,43787,42751,43791,43795,42997,43047,43799,43803,43807,43413,43417,43421,43551,43039,43241,
+		38925,38961,38981,39239,39259,39335,39561,39589,39597,39681,39693,39985,39993,40301,40341,40349,
+		40373,40565,40633,40699,40889,41119,41147,41195,41303,41335,41485,41741,41779,41799,41795,41803,
+		41807,41811,41851,41855,41891,41911,41949,42053,42061,42069,42119,42187,42291,42357,42357,42477,
+		42661,42697,42759,42763,42855,42859,42973,42997,43261,43343,43367,40293,44251,42329,0,0,
+		38685,39099,39001,38913,38977,39045,39235,39271,39561,39541,39557,39585,39685,39701,39785,39797,
+		39833,39849,40149,40157,40219,40251,40309,40333,40317,40349,40337,40373,40401,40505,40517,40525,
+		40569,40691,40773,40777,40817,40969,40995,41107,41183,41175,41195,41223,41303,41713,41349,41419,
+		41431,41501,41529,41569,41611,41615,41643,41655,41685,41705,41701,41749,41915,41949,41973,42033,
+		42053,42085,42187,42421,42461,42581,42665,42685,42697,42731,42751,42735,42759,42755,42747,42763,
+		42775,42859,42937,43009,43071,43123,43225,43261,43303,43323,43343,43355,43367,43493,43735,44167,
+		44163,44203,43895,43935,43939,44307,44343,44439,43681,43727,0,0,0,0,0,0,
+		11338,11354,11358,11342,11348,13826,13822,0,0,0,0,0,0,0,0,0,
+		0,0,0,17996,17984,17988,18031,17992,0,0,0,0,0,18132,8181,18150,
+		18196,18063,18096,18102,18157,18172,18178,18222,18248,3642,18231,18228,18242,18237,18065,18068,
+		18071,18081,18090,18098,18104,18111,18123,0,18128,18135,18164,18161,18174,0,18182,0,
+		18188,18192,0,18204,18201,0,18214,18218,18224,18234,18250,18108,18084,18168,18208,18074,
+		18324,18322,18634,18632,18628,18630,18643,18641,18637,18639,18652,18650,18646,18648,18921,18919,
+		18915,18917,18932,18930,18926,18928,18912,18910,18906,18908,20188,20186,20182,20184,20199,20197,
+		20193,20195,19048,19046,19042,19044,19039,19037,19033,19035,19057,19055,19051,19053,19067,19065,
+		19061,19063,19224,19222,19219,19217,19230,19228,19211,19209,19285,19283,19274,19272,20400,20398,
+		20394,20396,20424,20422,20418,20420,20445,20443,20439,20441,20435,20433,20429,20431,20946,20944,
+		20956,20954,20950,20952,21046,21042,21031,21029,21025,21027,21022,21020,21016,21018,21290,21288,
+		21299,21295,3644,3645,3646,3647,3648,3649,3650,3651,3652,3653,3654,3655,3656,3657,
+		3658,3659,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,20413,20411,20407,20409,21086,21084,21081,21079,21099,21097,21092,21110,21108,
+		21076,21074,21104,21102,21276,21274,21270,21272,21118,21120,18352,18348,18416,18412,18424,18420,
+		18440,18436,18432,18428,18448,18444,18480,18476,18472,18460,18456,18452,21265,21263,21259,21261,
+		18360,18368,18396,18460,18468,18543,18551,18565,18595,18615,18623,18686,18712,18738,18780,18830,
+		18838,18853,18877,18893,18901,18952,18988,19088,19102,19149,19153,19161,19315,19339,19357,19389,
+		19626,19720,19767,19775,19795,19823,19862,19874,19937,19958,19986,20045,20053,20113,20121,20129,
+		20149,20163,20171,20221,20235,20267,20275,20299,20307,20315,20323,20339,20355,20381,20389,20501,
+		20539,20571,20599,20629,20637,20671,20703,20737,20767,20777,20781,20803,20847,20873,20897,20929,
+		20937,20983,20991,21007,21011,21156,21170,21184,21208,21246,21254,19204,19244,21130,8219,8231,
+		8249,8269,8287,8301,18376,18380,18392,18400,18456,18464,18575,18579,18591,18599,18611,18619,
+		18760,18764,18776,18814,18826,18834,18857,18861,18873,18881,18889,18897,20159,20167,20263,20271,
+		20295,20335,20351,20377,20385,20595,20625,20633,20663,20763,20877,20881,20893,20913,20925,20933,
+		21126,21188,21192,21204,21230,21242,21250,18356,18364,18372,18384,18404,18539,18547,18561,18583,
+		18603,18682,18708,18734,18768,18818,18865,18948,18984,19084,19098,19145,19157,19307,19331,19349,
+		19381,19622,19648,19716,19763,19771,19791,19819,19858,19929,19954,19982,20041,20049,20109,20117,
+		20125,20145,20217,20231,20303,20311,20319,20327,20343,20497,20535,20567,20587,20621,20667,20699,
+		20733,20759,20799,20843,20869,20885,20917,20979,20987,20975,21152,21166,21180,21196,21234,18388,
+		18408,18587,18607,18772,18822,18869,18885,19385,19427,19542,19582,20331,20347,20591,20889,20921,
+		21200,21238,8245,8265,8283,19906,19914,20018,20026,20079,20087,19435,19443,19590,19598,19122,
+		19130,19020,19028,19169,19177,19740,19748,19831,19839,19470,19492,19526,19550,19534,19377,19656,
+		19815,19902,19910,20014,20022,20075,20083,19431,19439,19586,19594,19118,19126,19016,19024,19165,
+		19173,19736,19744,19827,19835,19466,19488,19522,19546,19530,19373,19652,19811,19458,19480,19514,
+		19538,19423,19578,19866,19311,19335,19353,19462,19484,19518,19870,19933,18497,18501,3660,3661,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		18690,18722,18716,18728,18742,18784,18790,18796,18998,18992,19112,19106,19343,19319,19325,19405,
+		19399,19393,19417,19411,19636,19630,19730,19502,19496,19474,19560,19554,19572,19566,19779,19805,
+		19799,19884,19878,19890,19896,19968,19996,19990,20002,20057,20069,20063,20139,20133,20245,20251,
+		20549,20561,20555,20505,20511,20581,20575,20609,20603,20707,20713,20727,20675,20687,20741,20747,
+		0,0,20681,20995,21001,20851,20857,20825,20819,20831,20907,20901,21218,21212,18569,18702,
+		18696,18754,18748,18808,18802,19010,18956,19004,19361,19642,19508,19785,20529,20615,21174,21160,
+		21224,20771,20257,20863,20239,20543,20008,20371,20807,20753,20517,20365,20523,20813,18962,19092,
+		20693,20153,18555,20359,19962,19724,19367,20837,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		19710,20225,18517,18509,20719,19660,19248,19974,21064,19668,19674,18968,19256,3662,0,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		3663,3665,3667,3669,3671,3673,3675,3677,3679,3681,0,0,0,0,0,0,
+		8145,1,8143,1,1,1,1,8087,1,8143,1,1,1,1,8147,1,
+		3687,3691,3693,3695,3695,3697,3699,3701,3703,3705,3707,3709,3711,3713,3715,3717,
+		3719,3721,3723,3725,3727,3729,3730,3731,3733,3735,3735,3735,3735,3737,3737,3737,
+		3739,3741,3743,0,3745,3747,3749,3751,3753,3755,3757,3759,3761,3763,3765,3767,
+		3769,3771,3773,3775,3777,3779,3781,0,3783,8662,3785,3787,0,0,0,0,
+		8209,8207,8217,1,8229,0,8243,8241,8263,8261,8281,8279,8299,8297,8309,8307,
+		18304,18313,18311,18318,18316,18329,18327,18334,18332,18346,18344,18340,18342,18495,18493,18537,
+		18535,18531,18533,18669,18667,18680,18678,18674,18676,18851,18849,18845,18847,18946,18944,18940,
+		18942,19082,19080,19076,19078,19143,19141,19137,19139,19195,19193,19202,19200,19242,19240,19269,
+		19267,19305,19303,19299,19301,19456,19454,19450,19452,19620,19618,19614,19616,19761,19759,19755,
+		19757,19856,19854,19850,19852,19927,19925,19921,19923,19952,19950,19946,19948,20039,20037,20033,
+		20035,20107,20105,20101,20103,20215,20213,20209,20211,20293,20291,20287,20289,20463,20461,20457,
+		20459,20657,20655,20651,20653,20797,20795,20791,20793,20973,20971,20967,20969,21058,21056,21124,
+		21122,21146,21144,21140,21142,20469,20465,20477,20473,20485,20481,20493,20489,0,0,1,
+		0,3789,3791,3793,8660,3795,3797,3799,3801,3803,3805,3807,3809,3811,3813,3815,
+		8722,8755,9236,9497,9627,9726,9797,9856,9921,9978,3817,3819,3821,3823,3825,3827,
+		3829,10043,10524,10610,10793,10997,11297,11409,11562,11735,11974,12035,12211,12431,12621,12809,
+		13268,13404,13451,13650,13882,14045,14409,14540,14642,14721,14834,3831,3833,3835,3837,3839,
+		3841,10027,10508,10594,10777,10981,11281,11393,11546,11719,11960,12019,12194,12415,12605,12793,
+		13252,13390,13435,13634,13866,14029,14393,14524,14626,14707,14818,3843,3845,3847,3849,3851,
+		3853,3855,3857,3859,3861,3863,31724,30304,30352,30382,30412,30446,31510,31538,31558,30912,
+		8649,30308,30356,30386,30416,30450,30474,30528,30620,30680,30702,30740,30778,30810,30826,30854,
+		30870,30894,30916,30932,30960,30986,30998,31008,31016,31024,31040,31102,31160,31224,31306,31378,
+		31426,31460,31468,31500,31514,31542,31562,31576,31586,31608,31636,31662,31674,31738,8095,8099,
+		29907,29324,29341,30108,29354,30114,30119,29379,29396,29409,30126,30131,30136,30141,30146,30151,
+		29758,29434,29459,29476,29777,29489,29506,29519,29574,29607,29620,29655,29680,29705,29730,0,
+		0,0,29912,29917,29922,29927,29932,29937,0,0,29942,29947,29952,29957,29962,29967,
+		0,0,29972,29977,29982,29987,29992,29997,0,0,30002,30007,30012,0,0,0,
+		8657,8665,3865,3867,3869,8668,8696,0,3871,3873,3875,3877,3879,3881,3883,0,
+		0,0,0,0,0,0,0,0,0,1,1,1,3885,44519,0,0,
+		34501,34502,34503,34504,34505,34506,34507,34508,34509,34510,34511,34512,0,34513,34514,34515,
+		34516,34517,34518,34519,34520,34521,34522,34523,34524,34525,34526,34527,34528,34529,34530,34531,
+		34532,34533,34534,34535,34536,34537,34538,0,34539,34540,34541,34542,34543,34544,34545,34546,
+		34547,34548,34549,34550,34551,34552,34553,34554,34555,34556,34557,0,34558,34559,0,34560,
+		34561,34562,34563,34564,34565,34566,34567,34568,34569,34570,34571,34572,34573,34574,0,0,
+		34575,34576,34577,34578,34579,34580,34581,34582,34583,34584,34585,34586,34587,34588,0,0,
+		34589,34590,34591,34592,34593,34594,34595,34596,34597,34598,34599,34600,34601,34602,34603,34604,
+		34605,34606,34607,34608,34609,34610,34611,34612,34613,34614,34615,34616,34617,34618,34619,34620,
+		34621,34622,34623,34624,34625,34626,34627,34628,34629,34630,34631,34632,34633,34634,34635,34636,
+		34637,34638,34639,34640,34641,34642,34643,34644,34645,34646,34647,34648,34649,34650,34651,34652,
+		34653,34654,34655,34656,34657,34658,34659,34660,34661,34662,34663,34664,34665,34666,34667,34668,
+		34669,34670,34671,34672,34673,34674,34675,34676,34677,34678,34679,34680,34681,34682,34683,34684,
+		34685,34686,34687,34688,34689,34690,34691,34692,34693,34694,34695,34696,34697,34698,34699,34700,
+		34701,34702,34703,34704,34705,34706,34707,34708,34709,34710,34711,0,0,0,0,0,
+		3886,3887,3888,0,0,0,0,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		3889,3890,3891,3892,3893,3894,3895,3896,3897,3898,3899,3900,3901,3902,3903,3904,
+		3905,3906,3907,3908,3909,3910,3911,3912,3913,3914,3915,3916,3917,3918,3919,3920,
+		3921,3922,3923,3924,0,0,0,3925,3926,3927,3928,3929,3930,3931,3932,3933,
+		3934,3935,8754,9725,3936,3937,3938,3939,9725,3940,3941,3942,3943,3944,3945,9725,
+		3946,3947,3948,3949,3950,3951,3952,3953,8754,8754,8754,9235,9235,9235,9235,9725,
+		3954,3955,3956,3957,3958,3959,3960,3961,3962,3963,3964,3965,3966,3967,3968,3969,
+		3970,3971,3972,9725,3973,3974,3975,3976,3977,3978,3979,3980,3981,3982,3983,3984,
+		3985,3986,3987,3988,3989,3990,3991,3992,3993,3994,8721,3995,3996,3997,3998,0,
+		3999,4000,4001,4002,4003,4004,4005,4006,4007,4008,4009,4010,4011,0,0,0,
+		4012,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		4013,4014,4015,4016,4017,4018,4019,4020,4021,4022,4023,4024,4025,4026,4027,4028,
+		4029,4030,4031,4032,4033,4034,4035,4036,4037,4038,4039,4040,4041,4042,4043,4044,
+		4045,4046,4047,4048,4049,4050,4051,4052,4053,4054,4055,4056,4057,8611,0,0,
+		33850,33851,33852,33853,33854,33855,33856,33857,33858,33859,33860,33861,33862,33863,33864,33865,
+		33866,33867,33868,33869,33870,33871,33872,33873,33874,33875,33876,33877,33878,0,0,0,
+		33879,33880,33881,33882,33883,33884,33885,33886,33887,33888,33889,33890,33891,33892,33893,33894,
+		33895,33896,33897,33898,33899,33900,33901,33902,33903,33904,33905,33906,33907,33908,33909,33910,
+		33911,33912,33913,33914,33915,33916,33917,33918,33919,33920,33921,33922,33923,33924,33925,33926,
+		33927,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		1,8754,9235,9496,9626,9725,9796,9855,9920,9977,4058,4059,4060,4061,4062,4063,
+		4064,4065,4066,4067,4068,4069,4070,4071,4072,4073,4074,4075,0,0,0,0,
+		33954,33955,33956,33957,33958,33959,33960,33961,33962,33963,33964,33965,33966,33967,33968,33970,
+		33971,33972,33973,33974,33975,33976,33977,33978,33979,33980,33981,33982,33983,33984,33985,33969,
+		8754,9725,4076,4077,0,0,0,0,0,0,0,0,0,33986,33987,33988,
+		33989,33990,33991,33992,33993,33994,33995,33996,33997,33998,33999,34000,34001,34002,34003,34004,
+		34005,34006,34007,34008,34009,34010,34011,34012,34013,34014,34015,0,0,0,0,0,
+		17611,17614,17615,17616,17619,17620,17621,17622,17625,17626,17627,17628,17629,17630,17633,17634,
+		17635,17636,17639,17640,17641,17642,17643,17644,17645,17646,17647,17648,17649,17650,17651,17652,
+		17653,17654,17655,17656,17657,17658,17612,17617,17623,17631,17637,0,0,0,0,0,
+		35596,35597,35598,35599,35600,35601,35602,35603,35604,35605,35606,35607,35608,35609,35610,35611,
+		35612,35613,35614,35615,35616,35617,35618,35619,35620,35621,35622,35623,35624,35625,0,4078,
+		35626,35627,35628,35629,35630,35631,35632,35633,35634,35635,35636,35637,35638,35639,35640,35641,
+		35642,35643,35644,35645,35646,35647,35648,35649,35650,35651,35652,35653,35654,35655,35656,35657,
+		35658,35659,35660,35661,0,0,0,0,35662,35663,35664,35665,35666,35667,35668,35669,
+		4079,8754,9235,4080,4081,4082,0,0,0,0,0,0,0,0,0,0,
+		34017,34020,34023,34026,34029,34032,34035,34038,34041,34044,34047,34050,34053,34056,34059,34062,
+		34065,34068,34071,34074,34077,34080,34083,34086,34089,34092,34095,34098,34101,34104,34107,34110,
+		34113,34116,34119,34122,34125,34128,34131,34134,34016,34019,34022,34025,34028,34031,34034,34037,
+		34040,34043,34046,34049,34052,34055,34058,34061,34064,34067,34070,34073,34076,34079,34082,34085,
+		34088,34091,34094,34097,34100,34103,34106,34109,34112,34115,34118,34121,34124,34127,34130,34133,
+		34136,34137,34138,34139,34140,34141,34142,34143,34144,34145,34146,34147,34148,34149,34150,34151,
+		34152,34153,34154,34155,34156,34157,34158,34159,34160,34161,34162,34163,34164,34165,34166,34167,
+		34168,34169,34170,34171,34172,34173,34174,34175,34176,34177,34178,34179,34180,34181,34182,34183,
+		34323,34324,34325,34326,34327,34328,34329,34330,34331,34332,34333,34334,34335,34336,34337,34338,
+		34339,34340,34341,34342,34343,34344,34345,34346,34347,34348,34349,34350,34351,34352,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		26497,26500,26503,26506,26509,26512,26515,26518,26521,26524,26527,26530,26533,26536,26539,26542,
+		26545,26548,26551,26554,26557,26560,26563,26566,26569,26572,26575,26578,26581,26584,26587,26590,
+		26593,26596,26599,26602,0,0,0,0,26496,26499,26502,26505,26508,26511,26514,26517,
+		26520,26523,26526,26529,26532,26535,26538,26541,26544,26547,26550,26553,26556,26559,26562,26565,
+		26568,26571,26574,26577,26580,26583,26586,26589,26592,26595,26598,26601,0,0,0,0,
+		34353,34354,34355,34356,34357,34358,34359,34360,34361,34362,34363,34364,34365,34366,34367,34368,
+		34369,34370,34371,34372,34373,34374,34375,34376,34377,34378,34379,34380,34381,34382,34383,34384,
+		34385,34386,34387,34388,34389,34390,34391,34392,0,0,0,0,0,0,0,0,
+		34393,34394,34395,34396,34397,34398,34399,34400,34401,34402,34403,34404,34405,34406,34407,34408,
+		34409,34410,34411,34412,34413,34414,34415,34416,34417,34418,34419,34420,34421,34422,34423,34424,
+		34425,34426,34427,34428,34429,34430,34431,34432,34433,34434,34435,34436,34437,34438,34439,34440,
+		34441,34442,34443,34444,0,0,0,0,0,0,0,0,0,0,0,4083,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		34712,34713,34714,34715,34716,34717,34718,34719,34720,34721,34722,34723,34724,34725,34726,34727,
+		34728,34729,34730,34731,34732,34733,34734,34735,34736,34737,34738,34739,34740,34741,34742,34743,
+		34744,34745,34746,34747,34748,34749,34750,34751,34752,34753,34754,34755,34756,34757,34758,34759,
+		34760,34761,34762,34763,34764,34765,34766,34767,34768,34769,34770,34771,34772,34773,34774,34775,
+		34776,34777,34778,34779,34780,34781,34782,34783,34784,34785,34786,34787,34788,34789,34790,34791,
+		34792,34793,34794,34795,34796,34797,34798,34799,34800,34801,34802,34803,34804,34805,34806,34807,
+		34808,34809,34810,34811,34812,34813,34814,34815,34816,34817,34818,34819,34820,34821,34822,34823,
+		34824,34825,34826,34827,34828,34829,34830,34831,34832,34833,34834,34835,34836,34837,34838,34839,
+		34840,34841,34842,34843,34844,34845,34846,34847,34848,34849,34850,34851,34852,34853,34854,34855,
+		34856,34857,34858,34859,34860,34861,34862,34863,34864,34865,34866,34867,34868,34869,34870,34871,
+		34872,34873,34874,34875,34876,34877,34878,34879,34880,34881,34882,34883,34884,34885,34886,34887,
+		34888,34889,34890,34891,34892,34893,34894,34895,34896,34897,34898,34899,34900,34901,34902,34903,
+		34904,34905,34906,34907,34908,34909,34910,34911,34912,34913,34914,34915,34916,34917,34918,34919,
+		34920,34921,34922,34923,34924,34925,34926,34927,34928,34929,34930,34931,34932,34933,34934,34935,
+		34936,34937,34938,34939,34940,34941,34942,34943,34944,34945,34946,34947,34948,34949,34950,34951,
+		34952,34953,34954,34955,34956,34957,34958,34959,34960,34961,34962,34963,34964,34965,34966,34967,
+		34968,34969,34970,34971,34972,34973,34974,34975,34976,34977,34978,34979,34980,34981,34982,34983,
+		34984,34985,34986,34987,34988,34989,34990,34991,34992,34993,34994,34995,34996,34997,34998,34999,
+		35000,35001,35002,35003,35004,35005,35006,35007,35008,35009,35010,35011,35012,35013,35014,35015,
+		35016,35017,35018,35019,35020,35021,35022,0,0,0,0,0,0,0,0,0,
+		35023,35024,35025,35026,35027,35028,35029,35030,35031,35032,35033,35034,35035,35036,35037,35038,
+		35039,35040,35041,35042,35043,35044,0,0,0,0,0,0,0,0,0,0,
+		35045,35046,35047,35048,35049,35050,35051,35052,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		35053,35054,35055,35056,35057,35058,0,0,35059,0,35060,35061,35062,35063,35064,35065,
+		35066,35067,35068,35069,35070,35071,35072,35073,35074,35075,35076,35077,35078,35079,35080,35081,
+		35082,35083,35084,35085,35086,35087,35088,35089,35090,35091,35092,35093,35094,35095,35096,35097,
+		35098,35099,35100,35101,35102,35103,0,35104,35105,0,0,0,35106,0,0,35107,
+		35308,35309,35310,35311,35312,35313,35314,35315,35316,35317,35318,35319,35320,35321,35322,35323,
+		35324,35325,35326,35327,35328,35329,0,4084,8754,9235,9496,4085,4086,4087,4088,4089,
+		35223,35224,35225,35226,35227,35228,35229,35230,35231,35232,35233,35234,35235,35237,35236,35239,
+		35240,35241,35242,35243,35244,35245,35246,4090,4091,8754,9235,9496,9626,9725,4092,4093,
+		35248,35247,35251,35250,35253,35254,35256,35255,35258,35259,35260,35261,35263,35262,35266,35265,
+		35269,35268,35272,35271,35275,35274,35277,35278,35279,35280,35281,35282,35284,35283,35286,0,
+		0,0,0,0,0,0,0,8754,9235,9496,9626,9626,9725,4094,4095,4096,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		35287,35288,35289,35290,35291,35292,35293,35294,35295,35296,35297,35298,35299,35300,35301,35302,
+		35303,35304,35305,0,35306,35307,0,0,0,0,0,8754,9725,4097,4098,4099,
+		18253,18254,18255,18256,18257,18258,18259,18260,18261,18262,18263,18264,18265,18266,18267,18268,
+		18269,18270,18271,18272,18273,18274,8754,4100,4101,4102,9235,9496,0,0,0,4103,
+		33928,33929,33930,33931,33932,33933,33934,33935,33936,33937,33938,33939,33940,33941,33942,33943,
+		33944,33945,33946,33947,33948,33949,33950,33951,33952,33953,0,0,0,0,0,4104,
+		37860,37865,37870,37875,37880,37885,37890,37894,37899,37904,37909,37913,37918,37922,37927,37931,
+		37936,37941,37946,37955,37959,37964,37969,37974,37979,37983,37988,37992,37997,38002,38008,38009,
+		37859,37864,37869,37874,37879,37884,37889,37898,37903,37908,37917,37926,37935,37940,37945,37950,
+		37951,37963,37968,37973,37978,37987,37996,38001,0,0,0,0,4105,4106,38006,38007,
+		8754,9235,9496,9626,9725,9796,9855,9920,9977,4107,4108,4109,4110,4111,4112,4113,
+		0,0,4114,4115,4116,4117,4118,4119,4120,4121,4122,4123,4124,4125,4126,4127,
+		4128,4129,4130,4131,4132,4133,4134,4135,4136,4137,4138,4139,4140,4141,4142,4143,
+		4144,4145,4146,4147,4148,4149,4150,4151,4152,4153,4154,4155,4156,4157,4158,4159,
+		24191,24192,24193,24194,0,24195,24196,0,0,0,0,0,24197,8087,8443,8445,
+		24198,24200,24201,24202,0,24203,24204,24205,0,24206,24207,24209,24211,24212,24213,24214,
+		24215,24216,24217,24218,24219,24220,24221,24222,24223,24224,24225,24226,24227,24229,24230,24231,
+		24232,24233,24199,24210,24208,24228,0,0,8461,8463,8465,0,0,0,0,24234,
+		8754,9235,9496,9626,4160,4161,4162,4163,4164,0,0,0,0,0,0,0,
+		4165,4166,4167,4168,4169,4170,4171,4172,4173,0,0,0,0,0,0,0,
+		35108,35109,35110,35111,35112,35113,35114,35115,35116,35117,35118,35119,35120,35121,35122,35123,
+		35124,35125,35126,35127,35128,35129,35130,35131,35132,35133,35134,35135,35136,8754,4174,4175,
+		35137,35138,35139,35140,35141,35142,35143,35144,35145,35146,35147,35148,35149,35150,35151,35152,
+		35153,35154,35155,35156,35157,35158,35159,35160,35161,35162,35163,35164,35165,8754,4176,4177,
+		35415,35416,35417,35418,35419,35420,35421,35422,35423,35427,35428,35429,35430,35431,35432,35433,
+		35434,35435,35436,35437,35438,35439,35440,35441,35442,35443,35444,35445,35446,35447,35448,35449,
+		35450,35451,35452,35453,35454,8085,8087,0,0,0,0,8754,9725,4178,4179,4180,
+		4181,4182,4183,4184,4185,4186,4187,0,0,0,0,0,0,0,0,0,
+		35166,35167,35168,35169,35170,35171,35172,35173,35174,35175,35176,35177,35178,35179,35180,35181,
+		35182,35183,35184,35185,35186,35187,35188,35189,35190,35191,35192,35193,35194,35195,35196,35197,
+		35198,35199,35200,35201,35202,35203,35204,35205,35206,35207,35208,35209,35210,35211,35212,35216,
+		35217,35218,35219,35220,35221,35222,0,0,0,4188,4189,4190,4191,4192,4193,4194,
+		35330,35331,35332,35333,35334,35335,35336,35337,35338,35339,35340,35341,35342,35343,35344,35345,
+		35346,35347,35348,35349,35350,35351,0,0,8754,9235,9496,9626,4195,4196,4197,4198,
+		35352,35353,35354,35355,35356,35357,35358,35359,35360,35361,35362,35363,35364,35365,35366,35367,
+		35368,35369,35370,0,0,0,0,0,8754,9235,9496,9626,4199,4200,4201,4202,
+		35371,35372,35373,35374,35375,35376,35377,35378,35379,35380,35381,35382,35383,35384,35385,35386,
+		35387,35388,0,0,0,0,0,0,0,4203,4204,4205,4206,0,0,0,
+		0,0,0,0,0,0,0,0,0,8754,9235,9496,9626,4207,4208,4209,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		27750,27751,27755,27756,27757,27761,27762,27763,27764,27768,27769,27773,27774,27778,27779,27783,
+		27784,27788,27789,27793,27794,27795,27799,27800,27804,27805,27809,27810,27814,27815,27819,27820,
+		27824,27825,27826,27827,27828,27829,27833,27834,27838,27839,27843,27844,27848,27849,27850,27854,
+		27855,27856,27857,27858,27862,27863,27867,27868,27872,27873,27877,27878,27882,27883,27884,27885,
+		27886,27890,27891,27895,27896,27900,27901,27905,27906,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		27548,27554,27559,27562,27565,27568,27571,27574,27577,27580,27586,27594,27599,27602,27605,27608,
+		27611,27617,27622,27625,27628,27631,27634,27637,27640,27643,27646,27649,27655,27660,27666,27674,
+		27679,27682,27685,27691,27696,27699,27702,27705,27708,27711,27714,27720,27725,27731,27736,27739,
+		27742,27745,27748,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		27547,27550,27558,27561,27564,27567,27570,27573,27576,27579,27582,27590,27598,27601,27604,27607,
+		27610,27613,27621,27624,27627,27630,27633,27636,27639,27642,27645,27648,27651,27659,27662,27670,
+		27678,27681,27684,27687,27695,27698,27701,27704,27707,27710,27713,27716,27724,27727,27735,27738,
+		27741,27744,27747,0,0,0,0,0,0,0,8754,9725,4210,4211,4212,4213,
+		25488,25494,25495,25496,25497,25498,25499,25500,25501,25502,25503,25504,25505,25506,25507,25508,
+		25509,25510,25511,25512,25513,25514,25515,25516,25517,25518,25519,25520,25521,25489,25490,25491,
+		25492,25493,25522,25523,8085,8085,8085,8085,0,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		8754,9235,9496,9626,9725,9796,9855,9920,9977,4214,4215,4216,4217,4218,4219,4220,
+		4221,4222,4223,4224,4225,4226,4227,4228,4229,4230,4231,4232,4233,4234,4235,0,
+		35531,35532,35533,35534,35535,35536,35537,35538,35539,35540,35541,35542,35543,35544,35545,35546,
+		35547,35548,35549,35550,35551,35552,35553,35554,35555,35556,35557,35558,35559,35560,35561,35562,
+		35563,35565,35566,35567,35568,35569,35570,35571,35572,35574,0,8313,8311,4236,0,0,
+		35564,35573,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		35455,35456,35458,35459,35461,35462,35463,35465,35466,35467,35468,35469,35470,35471,35472,35473,
+		35475,35479,35480,35481,35489,35490,35491,35493,35497,35498,35499,35500,35502,8754,9235,9496,
+		9626,9725,4237,4238,4239,4240,4241,35485,0,0,0,0,0,0,0,0,
+		35506,35507,35508,35509,35510,35511,35512,35513,35514,35515,35516,35517,35518,35519,35520,35521,
+		35522,35523,35528,35529,35530,35524,8087,8087,8085,8085,8085,8087,8085,8087,8087,8087,
+		8087,8754,4242,4243,4244,4245,4246,4247,4248,4249,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		35575,35576,35577,35578,35579,35580,35581,35582,35583,35584,35585,35586,35587,35588,35589,35590,
+		35591,35592,35593,35594,35595,8754,9235,9496,9626,4250,4251,4252,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		35389,35390,35391,35392,35393,35394,35395,35400,35401,35402,35403,35404,35405,35406,35407,35408,
+		35409,35410,35411,35412,35413,35414,35396,0,0,0,0,0,0,0,0,0,
+		8441,8443,8445,24169,24170,24122,24123,24124,24125,24126,24127,24128,24129,24130,24131,24132,
+		24133,24134,24135,24136,24137,24138,24139,24140,24141,24142,24143,24144,24145,24146,24147,24148,
+		24149,24150,24151,24152,24153,24154,24155,24156,24157,24158,24159,24160,24161,24162,24163,24164,
+		24165,24166,24167,24168,24171,24172,24173,24174,24175,24176,24177,24178,24179,24180,24181,24182,
+		24183,24184,24185,24186,24187,24188,24189,4253,4254,4255,4256,4257,4258,4259,0,0,
+		0,0,8754,9235,9496,9626,9725,9796,9855,9920,9977,4260,4261,4262,4263,4264,
+		4265,4266,4267,4268,4269,4270,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24190,
+		8441,8443,8445,23003,23004,23005,23006,23007,23008,23009,23010,23011,23012,23013,23014,23015,
+		23016,23017,23018,23019,23020,23021,23022,23023,23024,23025,23026,23029,23030,23033,23034,23035,
+		23036,23037,23038,23039,23040,23041,23045,23046,23047,23048,23049,23042,23050,23051,23052,23053,
+		23054,23055,23056,23057,23058,23059,23060,23061,23062,23063,8439,4271,4272,1,4273,4274,
+		4275,4276,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+		34445,34446,34447,34448,34449,34450,34451,34452,34453,34454,34455,34456,34457,34458,34459,34460,
+		34461,34462,34463,34464,34465,34466,34467,34468,34469,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		8441,8443,8445,25524,25525,25526,25527,25528,25529,25530,25531,25532,25533,25534,25535,25536,
+		25537,25538,25539,25540,25541,25542,25543,25544,25545,25546,25547,25548,25549,25550,25551,25552,
+		25553,25554,25555,25556,25558,25559,25560,25562,25563,25564,25565,25566,25567,25568,25569,25570,
+		25571,25572,25574,25578,25579,0,8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		4277,4278,4279,4280,25561,25576,25577,25557,0,0,0,0,0,0,0,0,
+		23064,23065,23066,23067,23068,23069,23070,23071,23072,23073,23074,23075,23076,23077,23078,23079,
+		23080,23081,23082,23083,23084,23085,23086,23087,23088,23089,23090,23091,23092,23093,23094,23095,
+		23097,23098,23099,8439,4281,4282,23096,0,0,0,0,0,0,0,0,0,
+		8441,8443,8445,23102,23103,23104,23105,23106,23107,23108,23109,23110,23111,23112,23113,23114,
+		23115,23116,23117,23118,23119,23120,23121,23122,23123,23124,23125,23126,23127,23128,23129,23130,
+		23131,23132,23133,23134,23135,23136,23137,23138,23139,23140,23141,23142,23143,23144,23145,23146,
+		23147,23148,23149,23154,23155,23156,23157,23158,23159,23160,23161,23162,23163,23165,23166,23167,
+		23168,23150,23151,23152,23100,4283,4284,4285,4286,8447,8439,8467,8469,4287,23164,8441,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,23101,4288,23153,4289,4290,4291,
+		0,8754,9235,9496,9626,9725,9796,9855,9920,9977,4292,4293,4294,4295,4296,4297,
+		4298,4299,4300,4301,4302,0,0,0,0,0,0,0,0,0,0,0,
+		23169,23170,23171,23172,23173,23174,23175,23176,23177,23178,23179,23180,23181,23182,23183,23184,
+		23185,23186,0,23187,23188,23189,23190,23191,23192,23193,23194,23195,23196,23197,23198,23199,
+		23200,23201,23202,23203,23204,23205,23206,23207,23208,23209,23210,23211,23212,23213,23214,23215,
+		23216,23217,23218,23219,8443,23220,8439,8295,4303,4304,4305,4306,4307,4308,8305,0,
+		23278,23279,23280,23281,23284,23285,23286,0,23287,0,23288,23289,23290,23291,0,23292,
+		23293,23294,23295,23296,23297,23298,23299,23300,23301,23302,23303,23304,23305,23306,0,23307,
+		23308,23309,23310,23311,23312,23282,23283,23313,23314,4309,0,0,0,0,0,0,
+		23221,23222,23223,23224,23225,23226,23227,23228,23229,23230,23231,23232,23233,23234,23235,23236,
+		23237,23238,23239,23240,23241,23242,23243,23244,23245,23246,23247,23248,23249,23250,23251,23252,
+		23253,23254,23255,23256,23257,23258,23259,23260,23261,23262,23263,23264,23265,23266,23267,8443,
+		23268,23269,23270,23271,23272,23273,23274,23275,23276,8439,23277,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		8443,8441,8443,8445,0,23316,23317,23318,23319,23320,23321,23322,23324,0,0,23326,
+		23327,0,0,23328,23329,23330,23331,23332,23333,23334,23335,23336,23337,23338,23339,23340,
+		23341,23342,23343,23344,23345,23346,23347,23348,23349,0,23350,23351,23352,23353,23354,23355,
+		23356,0,23357,23358,0,23359,23360,23361,23362,23363,0,8439,8439,23364,23367,23368,
+		23369,23370,23371,23372,23373,0,0,23376,23378,0,0,23379,23380,23381,0,0,
+		23315,0,0,0,0,0,0,23382,0,0,0,0,0,23383,23365,23366,
+		23323,23325,23374,23375,0,0,1,1,1,1,1,1,1,0,0,0,
+		1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,
+		23386,23387,23388,23389,23390,23391,23392,23393,23394,23395,23396,23397,23398,23399,23400,23401,
+		23402,23403,23404,23405,23406,23407,23408,23409,23410,23411,23412,23413,23414,23415,23416,23417,
+		23418,23419,23420,23421,23422,23423,23424,23425,23426,23427,23428,23429,23430,23431,23432,23433,
+		23434,23435,23436,23437,23438,23444,23445,23446,23447,23448,23449,23450,23451,23452,23453,23454,
+		23455,23456,23457,8441,8443,8445,8439,23439,23442,23384,23385,4310,4311,4312,4313,4314,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,4315,4316,0,4317,8447,23443,
+		23440,23441,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		23459,23460,23461,23462,23463,23464,23465,23466,23467,23468,23469,23470,23471,23472,23473,23474,
+		23475,23476,23477,23478,23479,23480,23481,23482,23483,23484,23485,23486,23487,23488,23489,23490,
+		23491,23492,23493,23494,23495,23496,23497,23498,23499,23500,23501,23502,23503,23504,23505,23506,
+		23509,23510,23511,23512,23513,23514,23515,23516,23517,23518,23520,23521,23522,23523,23524,8441,
+		8443,8445,23525,8439,23507,23508,4318,23458,0,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		23526,23527,23528,23537,23542,23547,23548,23549,23550,23551,23552,23553,23554,23555,23556,23557,
+		23558,23559,23560,23561,23562,23563,23564,23565,23566,23567,23568,23569,23570,23571,23572,23573,
+		23574,23575,23576,23577,23578,23579,23580,23581,23582,23583,23584,23585,23586,23587,23588,23589,
+		23590,23591,23592,23597,23602,23603,0,0,23604,23606,23608,23609,8441,8443,8445,23610,
+		8439,4319,4320,4321,4322,4323,4324,4325,4326,4327,4328,4329,4330,4331,4332,4333,
+		4334,4335,4336,4337,4338,4339,4340,4341,23529,23533,23538,23543,23593,23598,0,0,
+		23611,23612,23613,23614,23615,23616,23617,23618,23619,23620,23621,23622,23623,23624,23625,23626,
+		23627,23628,23629,23630,23631,23632,23633,23634,23635,23636,23637,23638,23639,23640,23641,23642,
+		23643,23644,23645,23646,23647,23648,23649,23650,23651,23652,23653,23654,23655,23656,23657,23658,
+		23659,23660,23661,23662,23663,23664,23665,23666,23667,23668,23669,23670,23671,8443,8445,23672,
+		8441,4342,4343,4344,23673,0,0,0,0,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		4345,4346,4347,4348,4349,4350,4351,4352,4353,4354,4355,4356,4357,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		23674,23675,23676,23677,23678,23679,23680,23681,23682,23683,23687,23688,23690,23691,23692,23693,
+		23694,23695,23696,23697,23698,23699,23700,23701,23702,23703,23704,23705,23706,23707,23708,23709,
+		23710,23711,23712,23713,23714,23715,23716,23685,23684,23686,23717,8443,8445,23718,23719,23720,
+		23721,23722,23723,23724,23725,23726,23727,8439,23689,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		23903,23904,23905,23906,23907,23908,23912,23913,23914,23919,23920,23921,23922,23923,23924,23925,
+		23926,23927,23928,23929,23930,23931,23932,23936,23937,23938,23915,0,0,23951,23952,23953,
+		23939,23940,23941,23942,23943,23944,23945,23946,23947,23948,23949,23950,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,4358,4359,4360,4361,4362,4363,
+		23847,23848,23849,23850,23851,23852,23853,23854,23855,23856,23857,23858,23859,23860,23861,23862,
+		23863,23864,23865,23866,23867,23868,23869,23870,23871,23872,23873,23874,23875,23876,23877,23878,
+		23879,23880,23881,23882,23883,23884,23885,23886,23887,23888,23889,23890,23891,23892,23893,23894,
+		23895,23896,23897,23898,23899,23900,23901,8443,8445,23902,8439,4364,0,0,0,0,
+		33513,33516,33519,33522,33525,33528,33531,33534,33537,33540,33543,33546,33549,33552,33555,33558,
+		33561,33564,33567,33570,33573,33576,33579,33582,33585,33588,33591,33594,33597,33600,33603,33606,
+		33512,33515,33518,33521,33524,33527,33530,33533,33536,33539,33542,33545,33548,33551,33554,33557,
+		33560,33563,33566,33569,33572,33575,33578,33581,33584,33587,33590,33593,33596,33599,33602,33605,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,4365,4366,4367,4368,4369,4370,
+		4371,4372,4373,0,0,0,0,0,0,0,0,0,0,0,0,33511,
+		23728,23729,23730,23731,23732,23733,23734,0,0,23735,0,0,23736,23737,23738,23739,
+		23740,23742,23743,23744,0,23745,23746,0,23747,23748,23749,23750,23751,23752,23753,23754,
+		23755,23756,23757,23758,23759,23760,23762,23764,23766,23767,23768,23769,23770,23771,23772,23773,
+		23774,23775,23776,23777,23778,23779,0,23781,23782,0,0,8443,8441,23783,23784,23741,
+		23761,23763,23765,8439,4374,4375,4376,0,0,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		23785,23786,23787,23788,23789,23790,23791,23792,0,0,23793,23794,23795,23796,23797,23798,
+		23799,23800,23801,23802,23803,23804,23805,23806,23807,23808,23809,23810,23811,23812,23813,23814,
+		23815,23816,23817,23818,23819,23820,23821,23822,23823,23824,23825,23826,23827,23828,23829,23830,
+		23831,23834,23835,23836,23837,23838,23839,23840,0,0,23841,23843,23844,23845,8443,8445,
+		23846,23832,4377,23833,23842,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		24707,24708,24709,24710,24711,24712,24713,24714,24715,24716,24717,24657,24659,24660,24661,24662,
+		24663,24664,24665,24666,24667,24668,24669,24670,24671,24672,24673,24674,24675,24676,24677,24678,
+		24679,24680,24681,24682,24683,24684,24685,24686,24687,24688,24689,24692,24697,24700,24703,24704,
+		24705,24706,24658,8439,24718,8441,8441,8441,8443,8445,24693,24690,24695,24698,24701,4378,
+		4379,4380,4381,4382,4383,4384,4385,24719,0,0,0,0,0,0,0,0,
+		24720,24721,24722,24723,24726,24728,24727,24729,24730,24724,24725,24731,24732,24736,24739,24740,
+		24741,24744,24745,24746,24747,24748,24749,24750,24751,24752,24753,24754,24757,24758,24759,24760,
+		24763,24766,24767,24768,24769,24772,24773,24774,24775,24776,24777,24780,24781,24786,24791,24792,
+		24797,24798,24803,24735,24804,24805,24782,24787,24793,24799,24733,24737,24742,24755,24761,24764,
+		24770,24784,24789,24795,24801,24778,8443,8445,8471,24806,4386,4387,4388,24807,4389,4390,
+		4391,4392,4393,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		33615,33616,33617,33618,33619,33620,33621,33622,33623,33624,33625,33626,33627,33628,33629,33630,
+		33631,33632,33633,33634,33635,33608,33609,33610,33611,33612,33613,33614,33636,33637,33643,33638,
+		33639,33640,33641,33642,33644,33650,33648,33662,33651,33649,33663,33658,33656,33659,33657,33645,
+		33664,33647,33646,33654,33652,33660,33655,33653,33661,0,0,0,0,0,0,0,
+		24235,24236,24237,24238,24239,24240,24241,24242,24243,0,24244,24245,24246,24247,24248,24249,
+		24250,24251,24252,24253,24254,24255,24256,24257,24258,24259,24260,24261,24262,24263,24264,24265,
+		24266,24267,24268,24269,24270,24271,24272,24273,24274,24275,24276,24277,24278,24279,24280,24282,
+		24283,24284,24285,24286,24287,24288,24289,0,24290,24291,24292,24293,8441,8443,8445,24294,
+		24281,4394,4395,4396,4397,4398,0,0,0,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,8754,9235,9496,9626,9725,9796,
+		9855,9920,9977,4399,4400,4401,4402,4403,4404,4405,4406,4407,4408,0,0,0,
+		4409,4410,24808,24810,24812,24814,24816,24818,24820,24822,24824,24826,24828,24830,24832,24834,
+		24836,24838,24840,24842,24844,24846,24848,24850,24852,24853,24855,24857,24859,24861,24863,24865,
+		0,0,24809,24811,24813,24815,24817,24819,24821,24823,24825,24827,24829,24831,24833,24835,
+		24837,24839,24841,24843,24845,24847,24849,24851,0,24854,24856,24858,24860,24862,24864,24866,
+		24867,24868,24869,24870,24871,8443,8441,0,0,0,0,0,0,0,0,0,
+		23954,23955,23956,23957,23958,23959,23960,0,23961,23962,0,23963,23964,23965,23966,23967,
+		23968,23969,23970,23971,23972,23973,23974,23975,23976,23977,23978,23979,23980,23981,23982,23983,
+		23984,23985,23986,23987,23988,23989,23990,23995,23996,23997,23998,23999,24000,24001,24002,24003,
+		24004,24005,24006,24007,24008,24009,24010,0,0,0,24011,0,24012,24013,0,24014,
+		8443,8445,8439,8441,24015,24016,23991,23993,0,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,0,
+		24018,24019,24020,24021,24022,24023,0,24024,24025,0,24026,24027,24028,24029,24030,24031,
+		24032,24033,24034,24035,24036,24037,24038,24039,24040,24041,24042,24043,24044,24045,24046,24047,
+		24048,24049,24050,24051,24052,24053,24054,24055,24056,24057,24058,24059,24060,24061,24062,0,
+		24063,24064,0,24065,24066,8443,8445,24067,24017,0,0,0,0,0,0,0,
+		25147,25148,25149,25150,25151,25152,25153,25154,25155,25156,25157,25158,25159,25160,25161,25162,
+		25163,25164,25165,25166,25167,25168,25169,4411,4412,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		33347,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		4413,4414,4415,4416,4417,4418,4419,4420,4421,4422,4423,4424,4425,4426,4427,4428,
+		4429,4430,4431,4432,4433,4434,4435,4436,4437,4438,4439,4440,4441,8680,8681,8682,
+		8683,4442,4443,4444,4445,4446,4447,4448,4449,4450,4451,4452,4453,4454,4455,4456,
+		4457,4458,0,0,0,0,0,0,0,0,0,0,0,0,0,4459,
+		35670,35671,35672,35673,35674,35675,35676,35677,35678,35679,35680,35681,35682,35683,35684,35685,
+		35686,35687,35688,35689,35690,35691,35692,35693,35694,35695,35696,35697,35698,35699,35700,35701,
+		35702,35703,35704,35705,35706,35707,35708,35709,35710,35711,35712,35713,35714,35715,35716,35717,
+		35718,35719,35720,35721,35722,35723,35724,35725,35726,35727,35728,35729,35730,35731,35732,35733,
+		35734,35735,35736,35737,35738,35739,35740,35741,35742,35743,35744,35745,35746,35747,35748,35749,
+		35750,35751,35752,35753,35754,35755,35756,35757,35758,35759,35760,35761,35762,35763,35764,35765,
+		35766,35767,35768,35769,35770,35771,35772,35773,35774,35775,35776,35777,35778,35779,35780,35781,
+		35782,35783,35784,35785,35786,35787,35788,35789,35790,35791,35792,35793,35794,35795,35796,35797,
+		35798,35799,35800,35801,35802,35803,35804,35805,35806,35807,35808,35809,35810,35811,35812,35813,
+		35814,35815,35816,35817,35818,35819,35820,35821,35822,35823,35824,35825,35826,35827,35828,35829,
+		35830,35831,35832,35833,35834,35835,35836,35837,35838,35839,35840,35841,35842,35843,35844,35845,
+		35846,35847,35848,35849,35850,35851,35852,35853,35854,35855,35856,35857,35858,35859,35860,35861,
+		35862,35863,35864,35865,35866,35867,35868,35869,35870,35871,35872,35873,35874,35875,35876,35877,
+		35878,35879,35880,35881,35882,35883,35884,35885,35886,35887,35888,35889,35890,35891,35892,35893,
+		35894,35895,35896,35897,35898,35899,35900,35901,35902,35903,35904,35905,35906,35907,35908,35909,
+		35910,35911,35912,35913,35914,35915,35916,35917,35918,35919,35920,35921,35922,35923,35924,35925,
+		35926,35927,35928,35929,35930,35931,35932,35933,35934,35935,35936,35937,35938,35939,35940,35941,
+		35942,35943,35944,35945,35946,35947,35948,35949,35950,35951,35952,35953,35954,35955,35956,35957,
+		35958,35959,35960,35961,35962,35963,35964,35965,35966,35967,35968,35969,35970,35971,35972,35973,
+		35974,35975,35976,35977,35978,35979,35980,35981,35982,35983,35984,35985,35986,35987,35988,35989,
+		35990,35991,35992,35993,35994,35995,35996,35997,35998,35999,36000,36001,36002,36003,36004,36005,
+		36006,36007,36008,36009,36010,36011,36012,36013,36014,36015,36016,36017,36018,36019,36020,36021,
+		36022,36023,36024,36025,36026,36027,36028,36029,36030,36031,36032,36033,36034,36035,36036,36037,
+		36038,36039,36040,36041,36042,36043,36044,36045,36046,36047,36048,36049,36050,36051,36052,36053,
+		36054,36055,36056,36057,36058,36059,36060,36061,36062,36063,36064,36065,36066,36067,36068,36069,
+		36070,36071,36072,36073,36074,36075,36076,36077,36078,36079,36080,36081,36082,36083,36084,36085,
+		36086,36087,36088,36089,36090,36091,36092,36093,36094,36095,36096,36097,36098,36099,36100,36101,
+		36102,36103,36104,36105,36106,36107,36108,36109,36110,36111,36112,36113,36114,36115,36116,36117,
+		36118,36119,36120,36121,36122,36123,36124,36125,36126,36127,36128,36129,36130,36131,36132,36133,
+		36134,36135,36136,36137,36138,36139,36140,36141,36142,36143,36144,36145,36146,36147,36148,36149,
+		36150,36151,36152,36153,36154,36155,36156,36157,36158,36159,36160,36161,36162,36163,36164,36165,
+		36166,36167,36168,36169,36170,36171,36172,36173,36174,36175,36176,36177,36178,36179,36180,36181,
+		36182,36183,36184,36185,36186,36187,36188,36189,36190,36191,36192,36193,36194,36195,36196,36197,
+		36198,36199,36200,36201,36202,36203,36204,36205,36206,36207,36208,36209,36210,36211,36212,36213,
+		36214,36215,36216,36217,36218,36219,36220,36221,36222,36223,36224,36225,36226,36227,36228,36229,
+		36230,36231,36232,36233,36234,36235,36236,36237,36238,36239,36240,36241,36242,36243,36244,36245,
+		36246,36247,36248,36249,36250,36251,36252,36253,36254,36255,36256,36257,36258,36259,36260,36261,
+		36262,36263,36264,36265,36266,36267,36268,36269,36270,36271,36272,36273,36274,36275,36276,36277,
+		36278,36279,36280,36283,36284,36285,36286,36287,36288,36289,36290,36291,36292,36293,36294,36295,
+		36296,36297,36298,36299,36300,36301,36302,36303,36304,36305,36306,36307,36308,36309,36310,36311,
+		36312,36313,36314,36315,36316,36317,36318,36319,36320,36321,36322,36323,36324,36325,36326,36327,
+		36328,36329,36330,36331,36332,36333,36334,36335,36336,36337,36338,36339,36340,36341,36342,36343,
+		36344,36345,36346,36347,36348,36349,36350,36351,36352,36353,36354,36355,36356,36357,36358,36359,
+		36360,36361,36362,36363,36364,36365,36366,36367,36368,36369,36370,36371,36372,36373,36374,36375,
+		36376,36377,36378,36379,36380,36381,36382,36383,36384,36385,36386,36387,36388,36389,36390,36391,
+		36392,36393,36394,36395,36281,36282,36396,36397,36398,36399,36400,36401,36402,36403,36404,36405,
+		36406,36407,36408,36409,36410,36411,36412,36413,36414,36415,36416,36417,36418,36419,36420,36421,
+		36422,36423,36424,36425,36426,36427,36428,36429,36430,36431,36432,36433,36434,36435,36436,36437,
+		36438,36439,36440,36441,36442,36443,36444,36445,36446,36447,36448,36449,36450,36451,36452,36453,
+		36454,36455,36456,36457,36458,36459,36460,36461,36462,36463,36464,36465,36466,36467,36468,36469,
+		36470,36471,36472,36473,36474,36475,36476,36477,36478,36479,36480,36481,36482,36483,36484,36485,
+		36486,36487,36488,36489,36490,36491,36492,36493,36494,36495,36496,36497,36498,36499,36500,36501,
+		36502,36503,36504,36505,36506,36507,36508,36509,36510,36511,36512,36513,36514,36515,36516,36517,
+		36518,36519,36520,36521,36522,36523,36524,36525,36526,36527,36528,36529,36530,36531,36532,36533,
+		36534,36535,36536,36537,36538,36539,36540,36541,36542,36543,36544,36545,36546,36547,36548,36549,
+		36550,36551,36552,36553,36554,36555,36556,36557,36558,36559,36560,36561,36562,36563,36564,36565,
+		36566,36567,36568,36569,36570,36571,36572,36573,36574,36575,36576,36577,36578,36579,36580,36581,
+		36582,36583,36584,36585,36586,36587,36588,36589,36590,36591,0,0,0,0,0,0,
+		9235,9496,9626,9725,9796,9855,9920,9977,9496,9626,9725,9796,9855,9920,9977,9626,
+		9725,9796,9855,9920,9977,8754,9235,9496,9626,9725,9796,9855,9920,9977,8754,9235,
+		9496,9626,9725,9235,9496,9496,9626,9725,9796,9855,9920,9977,8754,9235,9496,9496,
+		9626,9725,4460,4461,8754,9235,9496,9496,9626,9725,9496,9496,9626,9626,9626,9626,
+		9796,9855,9855,9855,9920,9920,9977,9977,9977,9977,9235,9496,9626,9725,9796,8754,
+		9235,9496,9626,9626,9725,9725,9235,9496,8754,9235,4462,4463,4464,4465,4466,4467,
+		4468,4469,4470,4471,4472,4473,4474,4475,4476,9626,9725,9796,9855,9920,9977,0,
+		4477,4478,4479,4480,4481,0,0,0,0,0,0,0,0,0,0,0,
+		36592,36593,36594,36595,36596,36597,36598,36599,36600,36601,36602,36603,36604,36605,36606,36607,
+		36608,36609,36610,36611,36612,36613,36614,36615,36616,36617,36618,36619,36620,36621,36622,36623,
+		36624,36625,36626,36627,36628,36629,36630,36631,36632,36633,36634,36635,36636,36637,36638,36639,
+		36640,36641,36642,36643,36644,36645,36646,36647,36648,36649,36650,36651,36652,36653,36654,36655,
+		36656,36657,36658,36659,36660,36661,36662,36663,36664,36665,36666,36667,36668,36669,36670,36671,
+		36672,36673,36674,36675,36676,36677,36678,36679,36680,36681,36682,36683,36684,36685,36686,36687,
+		36688,36689,36690,36691,36692,36693,36694,36695,36696,36697,36698,36699,36700,36701,36702,36703,
+		36704,36705,36706,36707,36708,36709,36710,36711,36712,36713,36714,36715,36716,36717,36718,36719,
+		36720,36721,36722,36723,36724,36725,36726,36727,36728,36729,36730,36731,36732,36733,36734,36735,
+		36736,36737,36738,36739,36740,36741,36742,36743,36744,36745,36746,36747,36748,36749,36750,36751,
+		36752,36753,36754,36755,36756,36757,36758,36759,36760,36761,36762,36763,36764,36765,36766,36767,
+		36768,36769,36770,36771,36772,36773,36774,36775,36776,36777,36778,36779,36780,36781,36782,36783,
+		36784,36785,36786,36787,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		36788,36789,36790,36791,36792,36793,36794,36795,36796,36797,36798,36799,36800,36801,36802,36803,
+		36804,36805,36806,36807,36808,36809,36810,36811,36812,36813,36814,36815,36816,36817,36818,36819,
+		36820,36821,36822,36823,36824,36825,36826,36827,36828,36829,36830,36831,36832,36833,36834,36835,
+		36836,36837,36838,36839,36840,36841,36842,36843,36844,36845,36846,36847,36848,36849,36850,36851,
+		36852,36853,36854,36855,36856,36857,36858,36859,36860,36861,36862,36863,36864,36865,36866,36867,
+		36868,36869,36870,36871,36872,36873,36874,36875,36876,36877,36878,36879,36880,36881,36882,36883,
+		36884,36885,36886,36887,36888,36889,36890,36891,36892,36893,36894,36895,36896,36897,36898,36899,
+		36900,36901,36902,36903,36904,36905,36906,36907,36908,36909,36910,36911,36912,36913,36914,36915,
+		36916,36917,36918,36919,36920,36921,36922,36923,36924,36925,36926,36927,36928,36929,36930,36931,
+		36932,36933,36934,36935,36936,36937,36938,36939,36940,36941,36942,36943,36944,36945,36946,36947,
+		36948,36949,36950,36951,36952,36953,36954,36955,36956,36957,36958,36959,36960,36961,36962,36963,
+		36964,36965,36966,36967,36968,36969,36970,36971,36972,36973,36974,36975,36976,36977,36978,36979,
+		36980,36981,36982,36983,36984,36985,36986,36987,36988,36989,36990,36991,36992,36993,36994,36995,
+		36996,36997,36998,36999,37000,37001,37002,37003,37004,37005,37006,37007,37008,37009,37010,37011,
+		37012,37013,37014,37015,37016,37017,37018,37019,37020,37021,37022,37023,37024,37025,37026,37027,
+		37028,37029,37030,37031,37032,37033,37034,37035,37036,37037,37038,37039,37040,37041,37042,37043,
+		37044,37045,37046,37047,37048,37049,37050,37051,37052,37053,37054,37055,37056,37057,37058,37059,
+		37060,37061,37062,37063,37064,37065,37066,37067,37068,37069,37070,37071,37072,37073,37074,37075,
+		37076,37077,37078,37079,37080,37081,37082,37083,37084,37085,37086,37087,37088,37089,37090,37091,
+		37092,37093,37094,37095,37096,37097,37098,37099,37100,37101,37102,37103,37104,37105,37106,37107,
+		37108,37109,37110,37111,37112,37113,37114,37115,37116,37117,37118,37119,37120,37121,37122,37123,
+		37124,37125,37126,37127,37128,37129,37130,37131,37132,37133,37134,37135,37136,37137,37138,37139,
+		37140,37141,37142,37143,37144,37145,37146,37147,37148,37149,37150,37151,37152,37153,37154,37155,
+		37156,37157,37158,37159,37160,37161,37162,37163,37164,37165,37166,37167,37168,37169,37170,37171,
+		37172,37173,37174,37175,37176,37177,37178,37179,37180,37181,37182,37183,37184,37185,37186,37187,
+		37188,37189,37190,37191,37192,37193,37194,37195,37196,37197,37198,37199,37200,37201,37202,37203,
+		37204,37205,37206,37207,37208,37209,37210,37211,37212,37213,37214,37215,37216,37217,37218,37219,
+		37220,37221,37222,37223,37224,37225,37226,37227,37228,37229,37230,37231,37232,37233,37234,37235,
+		37236,37237,37238,37239,37240,37241,37242,37243,37244,37245,37246,37247,37248,37249,37250,37251,
+		37252,37253,37254,37255,37256,37257,37258,37259,37260,37261,37262,37263,37264,37265,37266,37267,
+		37268,37269,37270,37271,37272,37273,37274,37275,37276,37277,37278,37279,37280,37281,37282,37283,
+		37284,37285,37286,37287,37288,37289,37290,37291,37292,37293,37294,37295,37296,37297,37298,37299,
+		37300,37301,37302,37303,37304,37305,37306,37307,37308,37309,37310,37311,37312,37313,37314,37315,
+		37316,37317,37318,37319,37320,37321,37322,37323,37324,37325,37326,37327,37328,37329,37330,37331,
+		37332,37333,37334,37335,37336,37337,37338,37339,37340,37341,37342,37343,37344,37345,37346,37347,
+		37348,37349,37350,37351,37352,37353,37354,37355,37356,37357,37358,37359,37360,37361,37362,37363,
+		37364,37365,37366,37367,37368,37369,37370,37371,37372,37373,37374,37375,37376,37377,37378,37379,
+		37380,37381,37382,37383,37384,37385,37386,37387,37388,37389,37390,37391,37392,37393,37394,37395,
+		37396,37397,37398,37399,37400,37401,37402,37403,37404,37405,37406,37407,37408,37409,37410,37411,
+		37412,37413,37414,37415,37416,37417,37418,37419,37420,37421,37422,37423,37424,37425,37426,37427,
+		37428,37429,37430,37431,37432,37433,37434,37435,37436,37437,37438,37439,37440,37441,37442,37443,
+		37444,37445,37446,37447,37448,37449,37450,37451,37452,37453,37454,37455,37456,37457,37458,37459,
+		37460,37461,37462,37463,37464,37465,37466,37467,37468,37469,37470,37471,37472,37473,37474,37475,
+		37476,37477,37478,37479,37480,37481,37482,37483,37484,37485,37486,37487,37488,37489,37490,37491,
+		37492,37493,37494,37495,37496,37497,37498,37499,37500,37501,37502,37503,37504,37505,37506,37507,
+		37508,37509,37510,37511,37512,37513,37514,37515,37516,37517,37518,37519,37520,37521,37522,37523,
+		37524,37525,37526,37527,37528,37529,37530,37531,37532,37533,37534,37535,37536,37537,37538,37539,
+		37540,37541,37542,37543,37544,37545,37546,37547,37548,37549,37550,37551,37552,37553,37554,37555,
+		37556,37557,37558,37559,37560,37561,37562,37563,37564,37565,37566,37567,37568,37569,37570,37571,
+		37572,37573,37574,37575,37576,37577,37578,37579,37580,37581,37582,37583,37584,37585,37586,37587,
+		37588,37589,37590,37591,37592,37593,37594,37595,37596,37597,37598,37599,37600,37601,37602,37603,
+		37604,37605,37606,37607,37608,37609,37610,37611,37612,37613,37614,37615,37616,37617,37618,37619,
+		37620,37621,37622,37623,37624,37625,37626,37627,37628,37629,37630,37631,37632,37633,37634,37635,
+		37636,37637,37638,37639,37640,37641,37642,37643,37644,37645,37646,37647,37648,37649,37650,37651,
+		37652,37653,37654,37655,37656,37657,37658,37659,37660,37661,37662,37663,37664,37665,37666,37667,
+		37668,37669,37670,37671,37672,37673,37674,37675,37676,37677,37678,37679,37680,37681,37682,37683,
+		37684,37685,37686,37687,37688,37689,37690,37691,37692,37693,37694,37695,37696,37697,37698,37699,
+		37700,37701,37702,37703,37704,37705,37706,37707,37708,37709,37710,37711,37712,37713,37714,37715,
+		37716,37717,37718,37719,37720,37721,37722,37723,37724,37725,37726,37727,37728,37729,37730,37731,
+		37732,37733,37734,37735,37736,37737,37738,37739,37740,37741,37742,37743,37744,37745,37746,37747,
+		37748,37749,37750,37751,37752,37753,37754,37755,37756,37757,37758,37759,37760,37761,37762,37763,
+		37764,37765,37766,37767,37768,37769,37770,37771,37772,37773,37774,37775,37776,37777,37778,37779,
+		37780,37781,37782,37783,37784,37785,37786,37787,37788,37789,37790,37791,37792,37793,37794,37795,
+		37796,37797,37798,37799,37800,37801,37802,37803,37804,37805,37806,37807,37808,37809,37810,37811,
+		37812,37813,37814,37815,37816,37817,37818,37819,37820,37821,37822,37823,37824,37825,37826,37827,
+		37828,37829,37830,37831,37832,37833,37834,37835,37836,37837,37838,37839,37840,37841,37842,37843,
+		37844,37845,37846,37847,37848,37849,37850,37851,37852,37853,37854,37855,37856,37857,37858,0,
+		1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+		38010,38011,38012,38013,38014,38015,38016,38017,38018,38019,38020,38021,38022,38023,38024,38025,
+		38026,38027,38028,38029,38030,38031,38032,38033,38034,38035,38036,38037,38038,38039,38040,38041,
+		38042,38043,38044,38045,38046,38047,38048,38049,38050,38051,38052,38053,38054,38055,38056,38057,
+		38058,38059,38060,38061,38062,38063,38064,38065,38066,38067,38068,38069,38070,38071,38072,38073,
+		38074,38075,38076,38077,38078,38079,38080,38081,38082,38083,38084,38085,38086,38087,38088,38089,
+		38090,38091,38092,38093,38094,38095,38096,38097,38098,38099,38100,38101,38102,38103,38104,38105,
+		38106,38107,38108,38109,38110,38111,38112,38113,38114,38115,38116,38117,38118,38119,38120,38121,
+		38122,38123,38124,38125,38126,38127,38128,38129,38130,38131,38132,38133,38134,38135,38136,38137,
+		38138,38139,38140,38141,38142,38143,38144,38145,38146,38147,38148,38149,38150,38151,38152,38153,
+		38154,38155,38156,38157,38158,38159,38160,38161,38162,38163,38164,38165,38166,38167,38168,38169,
+		38170,38171,38172,38173,38174,38175,38176,38177,38178,38179,38180,38181,38182,38183,38184,38185,
+		38186,38187,38188,38189,38190,38191,38192,38193,38194,38195,38196,38197,38198,38199,38200,38201,
+		38202,38203,38204,38205,38206,38207,38208,38209,38210,38211,38212,38213,38214,38215,38216,38217,
+		38218,38219,38220,38221,38222,38223,38224,38225,38226,38227,38228,38229,38230,38231,38232,38233,
+		38234,38235,38236,38237,38238,38239,38240,38241,38242,38243,38244,38245,38246,38247,38248,38249,
+		38250,38251,38252,38253,38254,38255,38256,38257,38258,38259,38260,38261,38262,38263,38264,38265,
+		38266,38267,38268,38269,38270,38271,38272,38273,38274,38275,38276,38277,38278,38279,38280,38281,
+		38282,38283,38284,38285,38286,38287,38288,38289,38290,38291,38292,38293,38294,38295,38296,38297,
+		38298,38299,38300,38301,38302,38303,38304,38305,38306,38307,38308,38309,38310,38311,38312,38313,
+		38314,38315,38316,38317,38318,38319,38320,38321,38322,38323,38324,38325,38326,38327,38328,38329,
+		38330,38331,38332,38333,38334,38335,38336,38337,38338,38339,38340,38341,38342,38343,38344,38345,
+		38346,38347,38348,38349,38350,38351,38352,38353,38354,38355,38356,38357,38358,38359,38360,38361,
+		38362,38363,38364,38365,38366,38367,38368,38369,38370,38371,38372,38373,38374,38375,38376,38377,
+		38378,38379,38380,38381,38382,38383,38384,38385,38386,38387,38388,38389,38390,38391,38392,38393,
+		38394,38395,38396,38397,38398,38399,38400,38401,38402,38403,38404,38405,38406,38407,38408,38409,
+		38410,38411,38412,38413,38414,38415,38416,38417,38418,38419,38420,38421,38422,38423,38424,38425,
+		38426,38427,38428,38429,38430,38431,38432,38433,38434,38435,38436,38437,38438,38439,38440,38441,
+		38442,38443,38444,38445,38446,38447,38448,38449,38450,38451,38452,38453,38454,38455,38456,38457,
+		38458,38459,38460,38461,38462,38463,38464,38465,38466,38467,38468,38469,38470,38471,38472,38473,
+		38474,38475,38476,38477,38478,38479,38480,38481,38482,38483,38484,38485,38486,38487,38488,38489,
+		38490,38491,38492,38493,38494,38495,38496,38497,38498,38499,38500,38501,38502,38503,38504,38505,
+		38506,38507,38508,38509,38510,38511,38512,38513,38514,38515,38516,38517,38518,38519,38520,38521,
+		38522,38523,38524,38525,38526,38527,38528,38529,38530,38531,38532,38533,38534,38535,38536,38537,
+		38538,38539,38540,38541,38542,38543,38544,38545,38546,38547,38548,38549,38550,38551,38552,38553,
+		38554,38555,38556,38557,38558,38559,38560,38561,38562,38563,38564,38565,38566,38567,38568,38569,
+		38570,38571,38572,38573,38574,38575,38576,38577,38578,38579,38580,38581,38582,38583,38584,38585,
+		38586,38587,38588,38589,38590,38591,38592,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		28318,28319,28320,28321,28322,28323,28324,28325,28326,28327,28328,28329,28330,28331,28332,28333,
+		28334,28335,28336,28337,28338,28339,28340,28341,28342,28343,28344,28345,28346,28347,28348,28349,
+		28350,28351,28352,28353,28354,28355,28356,28357,28358,28359,28360,28361,28362,28363,28364,28365,
+		28366,28367,28368,28369,28370,28371,28372,28373,28374,28375,28376,28377,28378,28379,28380,28381,
+		28382,28383,28384,28385,28386,28387,28388,28389,28390,28391,28392,28393,28394,28395,28396,28397,
+		28398,28399,28400,28401,28402,28403,28404,28405,28406,28407,28408,28409,28410,28411,28412,28413,
+		28414,28415,28416,28417,28418,28419,28420,28421,28422,28423,28424,28425,28426,28427,28428,28429,
+		28430,28431,28432,28433,28434,28435,28436,28437,28438,28439,28440,28441,28442,28443,28444,28445,
+		28446,28447,28448,28449,28450,28451,28452,28453,28454,28455,28456,28457,28458,28459,28460,28461,
+		28462,28463,28464,28465,28466,28467,28468,28469,28470,28471,28472,28473,28474,28475,28476,28477,
+		28478,28479,28480,28481,28482,28483,28484,28485,28486,28487,28488,28489,28490,28491,28492,28493,
+		28494,28495,28496,28497,28498,28499,28500,28501,28502,28503,28504,28505,28506,28507,28508,28509,
+		28510,28511,28512,28513,28514,28515,28516,28517,28518,28519,28520,28521,28522,28523,28524,28525,
+		28526,28527,28528,28529,28530,28531,28532,28533,28534,28535,28536,28537,28538,28539,28540,28541,
+		28542,28543,28544,28545,28546,28547,28548,28549,28550,28551,28552,28553,28554,28555,28556,28557,
+		28558,28559,28560,28561,28562,28563,28564,28565,28566,28567,28568,28569,28570,28571,28572,28573,
+		28574,28575,28576,28577,28578,28579,28580,28581,28582,28583,28584,28585,28586,28587,28588,28589,
+		28590,28591,28592,28593,28594,28595,28596,28597,28598,28599,28600,28601,28602,28603,28604,28605,
+		28606,28607,28608,28609,28610,28611,28612,28613,28614,28615,28616,28617,28618,28619,28620,28621,
+		28622,28623,28624,28625,28626,28627,28628,28629,28630,28631,28632,28633,28634,28635,28636,28637,
+		28638,28639,28640,28641,28642,28643,28644,28645,28646,28647,28648,28649,28650,28651,28652,28653,
+		28654,28655,28656,28657,28658,28659,28660,28661,28662,28663,28664,28665,28666,28667,28668,28669,
+		28670,28671,28672,28673,28674,28675,28676,28677,28678,28679,28680,28681,28682,28683,28684,28685,
+		28686,28687,28688,28689,28690,28691,28692,28693,28694,28695,28696,28697,28698,28699,28700,28701,
+		28702,28703,28704,28705,28706,28707,28708,28709,28710,28711,28712,28713,28714,28715,28716,28717,
+		28718,28719,28720,28721,28722,28723,28724,28725,28726,28727,28728,28729,28730,28731,28732,28733,
+		28734,28735,28736,28737,28738,28739,28740,28741,28742,28743,28744,28745,28746,28747,28748,28749,
+		28750,28751,28752,28753,28754,28755,28756,28757,28758,28759,28760,28761,28762,28763,28764,28765,
+		28766,28767,28768,28769,28770,28771,28772,28773,28774,28775,28776,28777,28778,28779,28780,28781,
+		28782,28783,28784,28785,28786,28787,28788,28789,28790,28791,28792,28793,28794,28795,28796,28797,
+		28798,28799,28800,28801,28802,28803,28804,28805,28806,28807,28808,28809,28810,28811,28812,28813,
+		28814,28815,28816,28817,28818,28819,28820,28821,28822,28823,28824,28825,28826,28827,28828,28829,
+		28830,28831,28832,28833,28834,28835,28836,28837,28838,28839,28840,28841,28842,28843,28844,28845,
+		28846,28847,28848,28849,28850,28851,28852,28853,28854,28855,28856,28857,28858,28859,28860,28861,
+		28862,28863,28864,28865,28866,28867,28868,28869,28870,28871,28872,28873,28874,28875,28876,28877,
+		28878,28879,28880,28881,28882,28883,28884,28885,28886,0,0,0,0,0,0,0,
+		34470,34471,34472,34473,34474,34475,34476,34477,34478,34479,34480,34481,34482,34483,34484,34485,
+		34486,34487,34488,34489,34490,34491,34492,34493,34494,34495,34496,34497,34498,34499,34500,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,4482,4483,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		28887,28888,28889,28890,28891,28892,28893,28894,28895,28896,28897,28898,28899,28900,28901,28902,
+		28903,28904,28905,28906,28907,28908,28909,28910,28911,28912,28913,28914,28915,28916,0,0,
+		8419,8421,8423,8425,8427,4484,0,0,0,0,0,0,0,0,0,0,
+		33665,33666,33667,33668,33669,33670,33671,33672,33673,33674,33675,33676,33677,33678,33679,33680,
+		33681,33682,33683,33684,33685,33686,33687,33688,33689,33690,33691,33692,33693,33694,33695,33696,
+		33697,33698,33699,33700,33701,33702,33703,33704,33705,33706,33707,33708,33709,33710,33711,33712,
+		8545,8547,8549,8551,8553,8555,8557,4485,4486,4487,4488,4489,4490,4491,4492,4493,
+		33713,33714,8626,8627,4494,4495,0,0,0,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,4496,4497,4498,4499,4500,
+		4501,4502,0,33715,33716,33717,33718,33719,33720,33721,33722,33723,33724,33725,33726,33727,
+		33728,33729,33730,33731,33732,33733,33734,33735,0,0,0,0,0,33736,33737,33738,
+		33739,33740,33741,33742,33743,33744,33745,33746,33747,33748,33749,33750,33751,33752,33753,33754,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		29115,29118,29121,29124,29127,29130,29133,29136,29139,29142,29145,29148,29151,29154,29157,29160,
+		29163,29166,29169,29172,29175,29178,29181,29184,29187,29190,29193,29196,29199,29202,29205,29208,
+		29114,29117,29120,29123,29126,29129,29132,29135,29138,29141,29144,29147,29150,29153,29156,29159,
+		29162,29165,29168,29171,29174,29177,29180,29183,29186,29189,29192,29195,29198,29201,29204,29207,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,4503,4504,4505,4506,4507,4508,
+		4509,4510,4511,4512,8785,9262,9523,4513,4514,4515,4516,0,0,0,0,0,
+		33358,33359,33360,33361,33363,33366,33364,33367,33368,33369,33370,33371,33372,33373,33375,33376,
+		33378,33381,33382,33379,33383,33384,33385,33386,33387,33388,33389,33390,33391,33392,33393,33394,
+		33395,33396,33397,33398,33401,33399,33402,33403,33404,33405,33406,33407,33408,33409,33410,33411,
+		33412,33413,33414,33416,33418,33419,33420,33421,33422,33423,33425,33426,33427,33428,33431,33429,
+		33432,33433,33434,33435,33436,33362,33417,33415,33374,33424,33377,0,0,0,0,33441,
+		33437,33438,33439,33440,33442,33443,33444,33445,33446,33448,33449,33450,33451,33453,33454,33455,
+		33456,33458,33459,33460,33461,33462,33464,33465,33466,33467,33468,33469,33470,33471,33474,33475,
+		33476,33477,33478,33480,33481,33484,33485,33486,33487,33488,33489,33490,33491,33492,33493,33472,
+		33479,33447,33483,33452,33457,33482,33463,33473,0,0,0,0,0,0,0,33494,
+		33495,33496,33497,33498,33499,33500,33501,33502,33503,33504,33505,33506,33507,33508,33509,33510,
+		8632,8633,4517,8634,1,0,0,0,0,0,0,0,0,0,0,0,
+		8579,8581,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		30404,31753,31740,31741,31742,31743,31744,31745,31746,31747,31748,31749,31750,31751,31752,31754,
+		31755,31756,31757,31758,31759,31760,31761,31762,31763,31764,31765,31766,31767,31768,31769,31770,
+		31771,31772,31773,31774,31775,31776,31777,31778,31779,31780,31781,31782,31783,31784,31785,31786,
+		31787,31788,31789,31790,31791,31792,31793,31794,31795,31796,31797,31798,31799,31800,31801,31802,
+		31803,31804,31805,31806,31807,31808,31809,31810,31811,31812,31813,31814,31815,31816,31817,31818,
+		31819,31820,31821,31822,31823,31824,31825,31826,31827,31828,31829,31830,31831,31832,31833,31834,
+		31835,31836,31837,31838,31839,31840,31841,31842,31843,31844,31845,31846,31847,31848,31849,31850,
+		31851,31852,31853,31854,31855,31856,31857,31858,31859,31860,31861,31862,31863,31864,31865,31866,
+		31867,31868,31869,31870,31871,31872,31873,31874,31875,31876,31877,31878,31879,31880,31881,31882,
+		31883,31884,31885,31886,31887,31888,31889,31890,31891,31892,31893,31894,31895,31896,31897,31898,
+		31899,31900,31901,31902,31903,31904,31905,31906,31907,31908,31909,31910,31911,31912,31913,31914,
+		31915,31916,31917,31918,31919,31920,31921,31922,31923,31924,31925,31926,31927,31928,31929,31930,
+		31931,31932,31933,31934,31935,31936,31937,31938,31939,31940,31941,31942,31943,31944,31945,31946,
+		31947,31948,31949,31950,31951,31952,31953,31954,31955,31956,31957,31958,31959,31960,31961,31962,
+		31963,31964,31965,31966,31967,31968,31969,31970,31971,31972,31973,31974,31975,31976,31977,31978,
+		31979,31980,31981,31982,31983,31984,31985,31986,31987,31988,31989,31990,31991,31992,31993,31994,
+		31995,31996,31997,31998,31999,32000,32001,32002,32003,32004,32005,32006,32007,32008,32009,32010,
+		32011,32012,32013,32014,32015,32016,32017,32018,32019,32020,32021,32022,32023,32024,32025,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		31688,31702,31716,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,31692,31706,31720,31734,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		34184,34185,34186,34187,34188,34189,34190,34191,34192,34193,34194,34195,34196,34197,34198,34199,
+		34200,34201,34202,34203,34204,34205,34206,34207,34208,34209,34210,34211,34212,34213,34214,34215,
+		34216,34217,34218,34219,34220,34221,34222,34223,34224,34225,34226,34227,34228,34229,34230,34231,
+		34232,34233,34234,34235,34236,34237,34238,34239,34240,34241,34242,34243,34244,34245,34246,34247,
+		34248,34249,34250,34251,34252,34253,34254,34255,34256,34257,34258,34259,34260,34261,34262,34263,
+		34264,34265,34266,34267,34268,34269,34270,34271,34272,34273,34274,34275,34276,34277,34278,34279,
+		34280,34281,34282,34283,34284,34285,34286,34287,34288,34289,34290,0,0,0,0,0,
+		34291,34292,34293,34294,34295,34296,34297,34298,34299,34300,34301,34302,34303,0,0,0,
+		34304,34305,34306,34307,34308,34309,34310,34311,34312,0,0,0,0,0,0,0,
+		34313,34314,34315,34316,34317,34318,34319,34320,34321,34322,0,0,4518,8085,8089,4519,
+		1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		4520,4521,4522,4523,4524,4525,4526,4527,4528,4529,4530,4531,4532,4533,4534,4535,
+		4536,4537,4538,4539,4540,4541,4542,4543,4544,4545,4546,4547,4548,4549,4550,4551,
+		4552,4553,4554,4555,4556,4557,4558,4559,4560,4561,4562,4563,4564,4565,4566,4567,
+		4568,4569,4570,4571,4572,4573,4574,4575,4576,4577,4578,4579,4580,4581,4582,4583,
+		4584,4585,4586,4587,4588,4589,4590,4591,4592,4593,4594,4595,4596,4597,4598,4599,
+		4600,4601,4602,4603,4604,4605,4606,4607,4608,4609,4610,4611,4612,4613,4614,4615,
+		4616,4617,4618,4619,4620,4621,4622,4623,4624,4625,4626,4627,4628,4629,4630,4631,
+		4632,4633,4634,4635,4636,4637,4638,4639,4640,4641,4642,4643,4644,4645,4646,4647,
+		4648,4649,4650,4651,4652,4653,4654,4655,4656,4657,4658,4659,4660,4661,4662,4663,
+		4664,4665,4666,4667,4668,4669,4670,4671,4672,4673,4674,4675,4676,4677,4678,4679,
+		4680,4681,4682,4683,4684,4685,4686,4687,4688,4689,4690,4691,4692,4693,4694,4695,
+		4696,4697,4698,4699,4700,4701,4702,4703,4704,4705,4706,4707,4708,4709,4710,4711,
+		4712,4713,4714,4715,4716,4717,4718,4719,4720,4721,4722,4723,4724,4725,4726,4727,
+		4728,4729,4730,4731,4732,4733,4734,4735,4736,4737,4738,4739,4740,4741,4742,4743,
+		4744,4745,4746,4747,4748,4749,4750,4751,4752,4753,4754,4755,4756,4757,4758,4759,
+		4760,4761,4762,4763,4764,4765,0,0,0,0,0,0,0,0,0,0,
+		4766,4767,4768,4769,4770,4771,4772,4773,4774,4775,4776,4777,4778,4779,4780,4781,
+		4782,4783,4784,4785,4786,4787,4788,4789,4790,4791,4792,4793,4794,4795,4796,4797,
+		4798,4799,4800,4801,4802,4803,4804,0,0,4805,4806,4807,4808,4809,4810,4811,
+		4812,4813,4814,4815,4816,4817,4818,4819,4820,4821,4822,4823,4824,4825,4826,4827,
+		4828,4829,4830,4831,4832,4833,4834,4835,4836,4837,4838,4839,4840,4841,4842,4843,
+		4844,4845,4846,4847,4848,4849,4850,4851,4852,4853,4854,4855,4856,4857,4858,4861,
+		4864,4864,4864,4864,4864,1,1,1,1,1,4869,4870,4871,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,4872,4873,1,1,1,1,1,1,1,4874,4875,4876,4877,
+		4878,4879,4880,4881,4882,4883,4884,4885,4886,4887,4888,4889,4890,4891,4892,4893,
+		4894,4895,4896,4897,4898,4899,4900,4901,4902,4903,1,1,1,1,4904,4905,
+		4906,4907,4908,4909,4910,4911,4912,4913,4914,4915,4916,4917,4920,4923,4928,4923,
+		4928,4933,4934,4935,4936,4937,4938,4939,4940,4941,4942,4943,4944,4945,4946,4947,
+		4948,4949,4950,4951,4952,4953,4954,4955,4956,4957,4958,4959,4960,4961,4962,4963,
+		4964,4965,4966,4967,4968,4969,4970,4971,4972,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		4973,4974,4975,4976,4977,4978,4979,4980,4981,4982,4983,4984,4985,4986,4987,4988,
+		4989,4990,4991,4992,4993,4994,4995,4996,4997,4998,4999,5000,5001,5002,5003,5004,
+		5005,5006,5007,5008,5009,5010,5011,5012,5013,5014,5015,5016,5017,5018,5019,5020,
+		5021,5022,5023,5024,5025,5026,5027,5028,5029,5030,5031,5032,5033,5034,5035,5036,
+		5037,5038,1,1,1,5039,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,5040,5041,5042,5043,5044,5045,
+		5046,5047,5048,5049,0,0,0,0,0,0,0,0,0,0,0,0,
+		5050,5051,5052,5053,5054,5055,5056,5057,5058,5059,5060,5061,5062,5063,5064,5065,
+		5066,5067,5068,5069,5070,5071,5072,5073,5074,5075,5076,5077,5078,5079,5080,5081,
+		5082,5083,5084,5085,5086,5087,5088,5089,5090,5091,5092,5093,5094,5095,5096,5097,
+		5098,5099,5100,5101,5102,5103,5104,5105,5106,5107,5108,5109,5110,5111,5112,5113,
+		5114,5115,5116,5117,5118,5119,5120,5121,5122,5123,5124,5125,5126,5127,5128,5129,
+		5130,5131,5132,5133,5134,5135,5136,0,0,0,0,0,0,0,0,0,
+		8754,9235,9496,9626,9725,9796,9855,9920,9977,5137,5138,5139,5140,5141,5142,5143,
+		5144,5145,8754,9235,9496,9626,9725,8754,9725,0,0,0,0,0,0,0,
+		10051,10532,10624,10803,11005,11309,11417,11570,11745,11982,12043,12221,12441,12629,12817,13276,
+		13412,13459,13664,13890,14053,14419,14548,14652,14729,14842,10037,10518,10604,10787,10991,11291,
+		11403,11556,11729,11968,12029,12204,12425,12615,12803,13262,13398,13445,13644,13876,14039,14403,
+		14534,14636,14715,14828,10051,10532,10624,10803,11005,11309,11417,11570,11745,11982,12043,12221,
+		12441,12629,12817,13276,13412,13459,13664,13890,14053,14419,14548,14652,14729,14842,10037,10518,
+		10604,10787,10991,11291,11403,0,11729,11968,12029,12204,12425,12615,12803,13262,13398,13445,
+		13644,13876,14039,14403,14534,14636,14715,14828,10051,10532,10624,10803,11005,11309,11417,11570,
+		11745,11982,12043,12221,12441,12629,12817,13276,13412,13459,13664,13890,14053,14419,14548,14652,
+		14729,14842,10037,10518,10604,10787,10991,11291,11403,11556,11729,11968,12029,12204,12425,12615,
+		12803,13262,13398,13445,13644,13876,14039,14403,14534,14636,14715,14828,10051,0,10624,10803,
+		0,0,11417,0,0,11982,12043,0,0,12629,12817,13276,13412,0,13664,13890,
+		14053,14419,14548,14652,14729,14842,10037,10518,10604,10787,0,11291,0,11556,11729,11968,
+		12029,12204,12425,12615,0,13262,13398,13445,13644,13876,14039,14403,14534,14636,14715,14828,
+		10051,10532,10624,10803,11005,11309,11417,11570,11745,11982,12043,12221,12441,12629,12817,13276,
+		13412,13459,13664,13890,14053,14419,14548,14652,14729,14842,10037,10518,10604,10787,10991,11291,
+		11403,11556,11729,11968,12029,12204,12425,12615,12803,13262,13398,13445,13644,13876,14039,14403,
+		14534,14636,14715,14828,10051,10532,0,10803,11005,11309,11417,0,0,11982,12043,12221,
+		12441,12629,12817,13276,13412,0,13664,13890,14053,14419,14548,14652,14729,0,10037,10518,
+		10604,10787,10991,11291,11403,11556,11729,11968,12029,12204,12425,12615,12803,13262,13398,13445,
+		13644,13876,14039,14403,14534,14636,14715,14828,10051,10532,0,10803,11005,11309,11417,0,
+		11745,11982,12043,12221,12441,0,12817,0,0,0,13664,13890,14053,14419,14548,14652,
+		14729,0,10037,10518,10604,10787,10991,11291,11403,11556,11729,11968,12029,12204,12425,12615,
+		12803,13262,13398,13445,13644,13876,14039,14403,14534,14636,14715,14828,10051,10532,10624,10803,
+		11005,11309,11417,11570,11745,11982,12043,12221,12441,12629,12817,13276,13412,13459,13664,13890,
+		14053,14419,14548,14652,14729,14842,10037,10518,10604,10787,10991,11291,11403,11556,11729,11968,
+		12029,12204,12425,12615,12803,13262,13398,13445,13644,13876,14039,14403,14534,14636,14715,14828,
+		12441,12629,12817,13276,13412,13459,13664,13890,14053,14419,14548,14652,14729,14842,10037,10518,
+		10604,10787,10991,11291,11403,11556,11729,11968,12029,12204,12425,12615,12803,13262,13398,13445,
+		14729,14842,10037,10518,10604,10787,10991,11291,11403,11556,11729,11968,12029,12204,12425,12615,
+		12803,13262,13398,13445,13644,13876,14039,14403,14534,14636,14715,14828,10051,10532,10624,10803,
+		11005,11309,11417,11570,11745,11982,12043,12221,12441,12629,12817,13276,13412,13459,13664,13890,
+		14053,14419,14548,14652,14729,14842,10037,10518,10604,10787,10991,11291,11403,11556,11729,11968,
+		12029,12204,12425,12615,12803,13262,13398,13445,13644,13876,14039,14403,14534,14636,14715,14828,
+		10051,10532,10624,10803,11005,11309,11417,11570,11745,11982,12043,12221,12441,12629,12817,13276,
+		14534,14636,14715,14828,11929,12003,0,0,15039,15293,15304,15316,15327,15419,15429,15671,
+		15682,15827,15846,15856,15895,15902,15909,15990,16009,15671,16034,16052,16061,16189,16200,16211,
+		16219,5146,15035,15289,15300,15312,15323,15415,15425,15665,15678,15823,15842,15852,15891,15898,
+		15905,15986,16005,16028,16028,16048,16055,16185,16196,16207,16215,5148,15323,15665,15823,16185,
+		16005,15986,15039,15293,15304,15316,15327,15419,15429,15671,15682,15827,15846,15856,15895,15902,
+		15909,15990,16009,15671,16034,16052,16061,16189,16200,16211,16219,5146,15035,15289,15300,15312,
+		15323,15415,15425,15665,15678,15823,15842,15852,15891,15898,15905,15986,16005,16028,16028,16048,
+		16055,16185,16196,16207,16215,5148,15323,15665,15823,16185,16005,15986,15039,15293,15304,15316,
+		15327,15419,15429,15671,15682,15827,15846,15856,15895,15902,15909,15990,16009,15671,16034,16052,
+		16061,16189,16200,16211,16219,5146,15035,15289,15300,15312,15323,15415,15425,15665,15678,15823,
+		15842,15852,15891,15898,15905,15986,16005,16028,16028,16048,16055,16185,16196,16207,16215,5148,
+		15323,15665,15823,16185,16005,15986,15039,15293,15304,15316,15327,15419,15429,15671,15682,15827,
+		15846,15856,15895,15902,15909,15990,16009,15671,16034,16052,16061,16189,16200,16211,16219,5146,
+		15035,15289,15300,15312,15323,15415,15425,15665,15678,15823,15842,15852,15891,15898,15905,15986,
+		16005,16028,16028,16048,16055,16185,16196,16207,16215,5148,15323,15665,15823,16185,16005,15986,
+		15039,15293,15304,15316,15327,15419,15429,15671,15682,15827,15846,15856,15895,15902,15909,15990,
+		16009,15671,16034,16052,16061,16189,16200,16211,16219,5146,15035,15289,15300,15312,15323,15415,
+		15425,15665,15678,15823,15842,15852,15891,15898,15905,15986,16005,16028,16028,16048,16055,16185,
+		16196,16207,16215,5148,15323,15665,15823,16185,16005,15986,15406,15402,0,0,8734,8773,
+		9254,9515,9645,9744,9815,9874,9939,9996,8734,8773,9254,9515,9645,9744,9815,9874,
+		9939,9996,8734,8773,9254,9515,9645,9744,9815,9874,9939,9996,8734,8773,9254,9515,
+		9645,9744,9815,9874,9939,9996,8734,8773,9254,9515,9645,9744,9815,9874,9939,9996,
+		5150,5151,5152,5153,5154,5155,5156,5157,5158,5159,5160,5161,5162,5163,5164,5165,
+		5166,5167,5168,5169,5170,5171,5172,5173,5174,5175,5176,5177,5178,5179,5180,5181,
+		5182,5183,5184,5185,5186,5187,5188,5189,5190,5191,5192,5193,5194,5195,5196,5197,
+		5198,5199,5200,5201,5202,5203,5204,5205,5206,5207,5208,5209,5210,5211,5212,5213,
+		5214,5215,5216,5217,5218,5219,5220,5221,5222,5223,5224,5225,5226,5227,5228,5229,
+		5230,5231,5232,5233,5234,5235,5236,5237,5238,5239,5240,5241,5242,5243,5244,5245,
+		5246,5247,5248,5249,5250,5251,5252,5253,5254,5255,5256,5257,5258,5259,5260,5261,
+		5262,5263,5264,5265,5266,5267,5268,5269,5270,5271,5272,5273,5274,5275,5276,5277,
+		5278,5279,5280,5281,5282,5283,5284,5285,5286,5287,5288,5289,5290,5291,5292,5293,
+		5294,5295,5296,5297,5298,5299,5300,5301,5302,5303,5304,5305,5306,5307,5308,5309,
+		5310,5311,5312,5313,5314,5315,5316,5317,5318,5319,5320,5321,5322,5323,5324,5325,
+		5326,5327,5328,5329,5330,5331,5332,5333,5334,5335,5336,5337,5338,5339,5340,5341,
+		5342,5343,5344,5345,5346,5347,5348,5349,5350,5351,5352,5353,5354,5355,5356,5357,
+		5358,5359,5360,5361,5362,5363,5364,5365,5366,5367,5368,5369,5370,5371,5372,5373,
+		5374,5375,5376,5377,5378,5379,5380,5381,5382,5383,5384,5385,5386,5387,5388,5389,
+		5390,5391,5392,5393,5394,5395,5396,5397,5398,5399,5400,5401,5402,5403,5404,5405,
+		5406,5407,5408,5409,5410,5411,5412,5413,5414,5415,5416,5417,5418,5419,5420,5421,
+		5422,5423,5424,5425,5426,5427,5428,5429,5430,5431,5432,5433,5434,5435,5436,5437,
+		5438,5439,5440,5441,5442,5443,5444,5445,5446,5447,5448,5449,5450,5451,5452,5453,
+		5454,5455,5456,5457,5458,5459,5460,5461,5462,5463,5464,5465,5466,5467,5468,5469,
+		5470,5471,5472,5473,5474,5475,5476,5477,5478,5479,5480,5481,5482,5483,5484,5485,
+		5486,5487,5488,5489,5490,5491,5492,5493,5494,5495,5496,5497,5498,5499,5500,5501,
+		5502,5503,5504,5505,5506,5507,5508,5509,5510,5511,5512,5513,5514,5515,5516,5517,
+		5518,5519,5520,5521,5522,5523,5524,5525,5526,5527,5528,5529,5530,5531,5532,5533,
+		5534,5535,5536,5537,5538,5539,5540,5541,5542,5543,5544,5545,5546,5547,5548,5549,
+		5550,5551,5552,5553,5554,5555,5556,5557,5558,5559,5560,5561,5562,5563,5564,5565,
+		5566,5567,5568,5569,5570,5571,5572,5573,5574,5575,5576,5577,5578,5579,5580,5581,
+		5582,5583,5584,5585,5586,5587,5588,5589,5590,5591,5592,5593,5594,5595,5596,5597,
+		5598,5599,5600,5601,5602,5603,5604,5605,5606,5607,5608,5609,5610,5611,5612,5613,
+		5614,5615,5616,5617,5618,5619,5620,5621,5622,5623,5624,5625,5626,5627,5628,5629,
+		5630,5631,5632,5633,5634,5635,5636,5637,5638,5639,5640,5641,5642,5643,5644,5645,
+		5646,5647,5648,5649,5650,5651,5652,5653,5654,5655,5656,5657,5658,5659,5660,5661,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,5662,5663,5664,5665,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,5666,5667,5668,
+		5669,5670,5671,5672,5673,1,5674,5675,5676,5677,5678,5679,5680,5681,5682,5683,
+		5684,5685,5686,5687,1,5688,5689,5690,5691,5692,5693,5694,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,
+		0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		17395,17400,17405,17410,17415,17420,17425,0,17433,17438,17443,17448,17453,17458,17463,17468,
+		17473,17478,17483,17488,17493,17498,17503,17508,17513,0,0,17524,17529,17534,17539,17544,
+		17549,17554,0,17562,17567,0,17575,17580,17585,17590,17595,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		33755,33756,33757,33758,33759,33760,33761,33762,33763,33764,33765,33766,33767,33768,33769,33770,
+		33771,33772,33773,33774,33775,33776,33777,33778,33779,33780,33781,33782,33783,33784,33785,33786,
+		33787,33788,33789,33790,33791,33792,33793,33794,33795,33796,33797,33798,33799,0,0,0,
+		8553,8545,8549,8551,8555,8557,8547,33800,33801,33802,33803,33804,8628,8629,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,33805,5695,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		33806,33807,33808,33809,33810,33811,33812,33813,33814,33815,33816,33817,33818,33819,33820,33821,
+		33822,33823,33824,33825,33826,33827,33828,33829,33830,33831,33832,33833,33834,33835,33836,33837,
+		33838,33839,33840,33841,33842,33843,33844,33845,33846,33847,33848,33849,8559,8561,8563,8565,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,0,8686,
+		28917,28918,28919,28920,28921,28922,28923,28924,28925,28926,28927,28928,28929,28930,28931,28932,
+		28933,28934,28935,28936,28937,28938,28939,28940,28941,28942,28943,28944,28945,28946,28947,28948,
+		28949,28950,28951,28952,28953,28954,28955,28956,28957,28958,28959,28960,28961,28962,28963,28964,
+		28965,28966,28967,28968,28969,28970,28971,28972,28973,28974,28975,28976,28977,28978,28979,28980,
+		28981,28982,28983,28984,28985,28986,28987,28988,28989,28990,28991,28992,28993,28994,28995,28996,
+		28997,28998,28999,29000,29001,29002,29003,29004,29005,29006,29007,29008,29009,29010,29011,29012,
+		29013,29014,29015,29016,29017,29018,29019,29020,29021,29022,29023,29024,29025,29026,29027,29028,
+		29029,29030,29031,29032,29033,29034,29035,29036,29037,29038,29039,29040,29041,29042,29043,29044,
+		29045,29046,29047,29048,29049,29050,29051,29052,29053,29054,29055,29056,29057,29058,29059,29060,
+		29061,29062,29063,29064,29065,29066,29067,29068,29069,29070,29071,29072,29073,29074,29075,29076,
+		29077,29078,29079,29080,29081,29082,29083,29084,29085,29086,29087,29088,29089,29090,29091,29092,
+		29093,29094,29095,29096,29097,29098,29099,29100,29101,29102,29103,29104,29105,29106,29107,29108,
+		29109,29110,29111,29112,29113,0,0,8754,9235,9496,9626,9725,9796,9855,9920,9977,
+		1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+		29211,29214,29217,29220,29223,29226,29229,29232,29235,29238,29241,29244,29247,29250,29253,29256,
+		29259,29262,29265,29268,29271,29274,29277,29280,29283,29286,29289,29292,29295,29298,29301,29304,
+		29307,29310,29210,29213,29216,29219,29222,29225,29228,29231,29234,29237,29240,29243,29246,29249,
+		29252,29255,29258,29261,29264,29267,29270,29273,29276,29279,29282,29285,29288,29291,29294,29297,
+		29300,29303,29306,29309,8429,8429,8429,8433,8435,8437,8431,29312,0,0,0,0,
+		8721,8754,9235,9496,9626,9725,9796,9855,9920,9977,0,0,0,0,5696,5697,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,8754,9235,9496,9626,9725,9796,9855,9920,9977,5698,5699,5700,5701,5702,5703,
+		5704,5705,5706,5707,5708,5709,5710,5711,5712,5713,5714,5715,5716,5717,5718,5719,
+		5720,5721,5722,5723,5724,5725,5726,5727,5728,5729,5730,5731,5732,5733,5734,5735,
+		5736,5737,5738,8754,9235,9496,9626,9725,9796,9855,9920,9977,5739,5740,5741,5742,
+		8714,8785,9262,5743,5744,0,0,0,0,0,0,0,0,0,0,0,
+		0,8754,9235,9496,9626,9725,9796,9855,9920,9977,5745,5746,5747,5748,5749,5750,
+		5751,5752,5753,5754,5755,5756,5757,5758,5759,5760,5761,5762,5763,5764,5765,5766,
+		5767,5768,5769,5770,5771,5772,5773,5774,5775,5776,5777,5778,5779,5780,5781,9262,
+		9526,9653,9752,9823,9882,9947,10004,5782,5783,5784,5785,5786,5787,5788,0,0,
+		18491,18529,18938,19191,0,21054,19265,19074,19848,21138,20285,20455,20649,20789,19297,19944,
+		20099,19612,20207,19238,19448,18672,18843,19135,19198,19753,19919,20031,18526,20942,20176,20204,
+		0,18529,18938,0,20965,0,0,19074,0,21138,20285,20455,20649,20789,19297,19944,
+		20099,19612,20207,0,19448,18672,18843,19135,0,19753,0,20031,0,0,0,0,
+		0,0,18938,0,0,0,0,19074,0,21138,0,20455,0,20789,19297,19944,
+		0,19612,20207,0,19448,0,0,19135,0,19753,0,20031,0,20942,0,20204,
+		0,18529,18938,0,20965,0,0,19074,19848,21138,20285,0,20649,20789,19297,19944,
+		20099,19612,20207,0,19448,18672,18843,19135,0,19753,19919,20031,18526,0,20176,0,
+		18491,18529,18938,19191,20965,21054,19265,19074,19848,21138,0,20455,20649,20789,19297,19944,
+		20099,19612,20207,19238,19448,18672,18843,19135,19198,19753,19919,20031,0,0,0,0,
+		0,18529,18938,19191,0,21054,19265,19074,19848,21138,0,20455,20649,20789,19297,19944,
+		20099,19612,20207,19238,19448,18672,18843,19135,19198,19753,19919,20031,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		5789,5790,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		5791,5792,5793,5794,5795,5796,5797,5798,5799,5800,5801,5802,5803,5804,5805,5806,
+		5807,5808,5809,5810,5811,5812,5813,5814,5815,5816,5817,5818,5819,5820,5821,5822,
+		5823,5824,5825,5826,5827,5828,5829,5830,5831,5832,5833,5834,0,0,0,0,
+		5835,5836,5837,5838,5839,5840,5841,5842,5843,5844,5845,5846,5847,5848,5849,5850,
+		5851,5852,5853,5854,5855,5856,5857,5858,5859,5860,5861,5862,5863,5864,5865,5866,
+		5867,5868,5869,5870,5871,5872,5873,5874,5875,5876,5877,5878,5879,5880,5881,5882,
+		5883,5884,5885,5886,5887,5888,5889,5890,5891,5892,5893,5894,5895,5896,5897,5898,
+		5899,5900,5901,5902,5903,5904,5905,5906,5907,5908,5909,5910,5911,5912,5913,5914,
+		5915,5916,5917,5918,5919,5920,5921,5922,5923,5924,5925,5926,5927,5928,5929,5930,
+		5931,5932,5933,5934,0,0,0,0,0,0,0,0,0,0,0,0,
+		5935,5936,5937,5938,5939,5940,5941,5942,5943,5944,5945,5946,5947,5948,5949,0,
+		0,5950,5951,5952,5953,5954,5955,5956,5957,5958,5959,5960,5961,5962,5963,5964,
+		0,5965,5966,5967,5968,5969,5970,5971,5972,5973,5974,5975,5976,5977,5978,5979,
+		0,5980,5981,5982,5983,5984,5985,5986,5987,5988,5989,5990,5991,5992,5993,5994,
+		5995,5996,5997,5998,5999,6000,6001,6002,6003,6004,6005,6006,6007,6008,6009,6010,
+		6011,6012,6013,6014,6015,6016,0,0,0,0,0,0,0,0,0,0,
+		8726,8730,8769,9250,9511,9641,9740,9811,9870,9935,9992,8736,8736,6017,6018,6019,
+		10045,10526,10618,10797,10999,11303,11411,11564,11739,11976,12037,12215,12435,12623,12811,13270,
+		13406,13453,13652,13884,14047,14413,14542,14646,14723,14836,13658,10626,13461,10692,14609,6020,
+		10059,10538,10630,10811,11013,11315,11423,11578,11753,11990,12051,12229,12449,12637,12825,13284,
+		13416,13467,13672,13898,14061,14427,14554,14660,14735,14848,11683,12574,13782,13806,13338,14605,
+		10053,10534,10626,10805,11007,11311,11419,11572,11747,11984,12045,12223,12443,12631,12819,13278,
+		13414,13461,13666,13892,14055,14421,14550,14654,14731,14844,12492,12496,12548,6021,6022,6023,
+		10059,10538,10630,10811,11013,11315,11423,11578,11753,11990,12051,12229,12449,12637,12825,13284,
+		13416,13467,13672,13898,14061,14427,14554,14660,14735,14848,13284,11868,13308,13778,10336,14605,
+		10894,10708,10740,11370,11872,12714,12724,13185,13796,14335,14491,9604,9464,9460,9703,9955,
+		9760,9890,9324,9831,8905,10809,11647,11651,11661,12332,13786,14329,14485,6024,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,6025,6026,6027,6028,6029,6030,6031,6032,6033,6034,
+		6035,6036,6037,6038,6039,6040,6041,6042,6043,6044,6045,6046,6047,6048,6049,6050,
+		31348,30722,30744,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		40413,39861,39421,30944,38817,39753,42715,39781,38837,40675,41291,40605,39187,40235,39063,40613,
+		39167,42029,41541,42823,39721,39489,41191,40437,40481,38613,38657,43001,40065,38705,39453,40469,
+		42879,40429,41847,41907,39461,41159,40769,40747,41561,39195,39573,43063,0,0,0,0,
+		40801,38641,38801,39885,41275,40421,41647,39247,40573,0,0,0,0,0,0,0,
+		40239,39441,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		6051,6052,6053,6054,6055,6056,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		6057,6058,6059,6060,6061,6062,6063,6064,6065,6066,6067,6068,6069,6070,6071,6072,
+		6073,6074,6075,6076,6077,6078,6079,6080,6081,6082,6083,6084,6085,6086,6087,6088,
+		6089,6090,6091,6092,6093,6094,6095,6096,6097,6098,6099,6100,6101,6102,6103,6104,
+		6105,6106,6107,6108,6109,6110,6111,6112,6113,6114,6115,6116,6117,6118,6119,6120,
+		6121,6122,6123,6124,6125,6126,6127,6128,6129,6130,6131,6132,6133,6134,6135,6136,
+		6137,6138,6139,6140,6141,6142,6143,6144,6145,6146,6147,6148,6149,6150,6151,6152,
+		6153,6154,6155,6156,6157,6158,6159,6160,6161,6162,6163,6164,6165,6166,6167,6168,
+		6169,6170,6171,6172,6173,6174,6175,6176,6177,6178,6179,6180,6181,6182,6183,6184,
+		6185,6186,6187,6188,6189,6190,6191,6192,6193,6194,6195,6196,6197,6198,6199,6200,
+		6201,6202,6203,6204,6205,6206,6207,6208,6209,6210,6211,6212,6213,6214,6215,6216,
+		6217,6218,6219,6220,6221,6222,6223,6224,6225,6226,6227,6228,6229,6230,6231,6232,
+		6233,6234,6235,6236,6237,6238,6239,6240,6241,6242,6243,6244,6245,6246,6247,6248,
+		6249,6250,6251,6252,6253,6254,6255,6256,6257,6258,6259,6260,6261,6262,6263,6264,
+		6265,6266,6267,6268,6269,6270,6271,6272,6273,6274,6275,6276,6277,6278,6279,6280,
+		6281,6282,6283,6284,6285,6286,6287,6288,6289,6290,6291,6292,6293,6294,6295,6296,
+		6297,6298,6299,6300,6301,6302,6303,6304,6305,6306,6307,6308,6309,6310,6311,6312,
+		6313,6314,6315,6316,6317,6318,6319,6320,6321,6322,6323,6324,6325,6326,6327,6328,
+		6329,6330,6331,6332,6333,6334,6335,6336,6337,6338,6339,6340,6341,6342,6343,6344,
+		6345,6346,6347,6348,6349,6350,6351,6352,6353,6354,6355,6356,6357,6358,6359,6360,
+		6361,6362,6363,6364,6365,6366,6367,6368,6369,6370,6371,6372,6373,6374,6375,6376,
+		6377,6378,6379,6380,6381,6382,6383,6384,6385,6386,6387,6388,6389,6390,6391,6392,
+		6393,6394,6395,6396,6397,6398,6399,6400,6401,6402,6403,6404,6405,6406,6407,6408,
+		6409,6410,6411,6412,6413,6414,6415,6416,6417,6418,6419,6420,6421,6422,6423,6424,
+		6425,6426,6427,6428,6429,6430,6431,6432,6433,6434,6435,6436,6437,6438,6439,6440,
+		6441,6442,6443,6444,6445,6446,6447,6448,6449,6450,6451,6452,6453,6454,6455,6456,
+		6457,6458,6459,6460,6461,6462,6463,6464,6465,6466,6467,6468,6469,6470,6471,6472,
+		6473,6474,6475,6476,6477,6478,6479,6480,6481,6482,6483,6484,6485,6486,6487,6488,
+		6489,6490,6491,6492,6493,6494,6495,6496,6497,6498,6499,6500,6501,6502,6503,6504,
+		6505,6506,6507,6508,6509,6510,6511,6512,6513,6514,6515,6516,6517,6518,6519,6520,
+		6521,6522,6523,6524,6525,6526,6527,6528,6529,6530,6531,6532,6533,6534,6535,6536,
+		6537,6538,6539,6540,6541,6542,6543,6544,6545,6546,6547,6548,6549,6550,6551,6552,
+		6553,6554,6555,6556,6557,6558,6559,6560,6561,6562,6563,6564,6565,6566,6567,6568,
+		6569,6570,6571,6572,6573,6574,6575,6576,6577,6578,6579,6580,6581,6582,6583,6584,
+		6585,6586,6587,6588,6589,6590,6591,6592,6593,6594,6595,6596,6597,6598,6599,6600,
+		6601,6602,6603,6604,6605,6606,6607,6608,6609,6610,6611,6612,6613,6614,6615,6616,
+		6617,6618,6619,6620,6621,6622,6623,6624,6625,6626,6627,6628,6629,6630,6631,6632,
+		6633,6634,6635,6636,6637,6638,6639,6640,6641,6642,6643,6644,6645,6646,6647,6648,
+		6649,6650,6651,6652,6653,6654,6655,6656,6657,6658,6659,6660,6661,6662,6663,6664,
+		6665,6666,6667,6668,6669,6670,6671,6672,6673,6674,6675,6676,6677,6678,6679,6680,
+		6681,6682,6683,6684,6685,6686,6687,6688,6689,6690,6691,6692,6693,6694,6695,6696,
+		6697,6698,6699,6700,6701,6702,6703,6704,6705,6706,6707,6708,6709,6710,6711,6712,
+		6713,6714,6715,6716,6717,6718,6719,6720,6721,6722,6723,6724,6725,6726,6727,6728,
+		6729,6730,6731,6732,6733,6734,6735,6736,6737,6738,6739,6740,6741,6742,6743,6744,
+		6745,6746,6747,6748,6749,6750,6751,6752,6753,6754,6755,6756,6757,6758,6759,6760,
+		6761,6762,6763,6764,6765,6766,6767,6768,6769,6770,6771,6772,6773,6774,6775,6776,
+		6777,6778,6779,6780,6781,6782,6783,6784,6785,6786,6787,6788,6789,6790,6791,6792,
+		6793,6794,6795,6796,6797,6798,6799,6800,6801,6802,6803,6804,6805,6806,6807,6808,
+		6809,6810,6811,6812,6813,6814,6815,6816,6817,6818,6819,6820,6821,6822,6823,6824,
+		6825,6826,6827,6828,6829,6830,6831,6832,6833,6834,6835,6836,6837,6838,6839,6840,
+		6841,6842,6843,6844,6845,6846,6847,6848,6849,6850,6851,6852,6853,6854,6855,6856,
+		6857,6858,6859,6860,6861,6862,6863,6864,6865,6866,6867,6868,6869,6870,6871,6872,
+		6873,6874,6875,6876,6877,6878,6879,6880,6881,6882,6883,6884,6885,6886,6887,6888,
+		6889,6890,6891,6892,6893,6894,6895,6896,6897,6898,6899,6900,6901,6902,6903,6904,
+		6905,6906,6907,6908,6909,6910,6911,6912,6913,6914,6915,6916,6917,6918,6919,6920,
+		6921,6922,6923,6924,6925,6926,6927,6928,6929,6930,6931,6932,6933,6934,6935,6936,
+		6937,6938,6939,6940,6941,6942,6943,6944,6945,6946,6947,6948,6949,6950,6951,6952,
+		6953,6954,6955,6956,6957,6958,6959,6960,6961,6962,6963,6964,6965,6966,6967,6968,
+		6969,6970,6971,6972,6973,6974,6975,6976,6977,6978,6979,6980,6981,6982,6983,6984,
+		6985,6986,6987,6988,6989,6990,6991,6992,6993,6994,6995,6996,6997,6998,6999,7000,
+		7001,7002,7003,7004,7005,7006,7007,7008,7009,7010,7011,7012,7013,7014,7015,7016,
+		7017,7018,7019,7020,7021,7022,7023,7024,7025,7026,7027,7028,7029,7030,7031,7032,
+		7033,7034,7035,7036,7037,7038,7039,7040,0,0,0,0,0,0,0,0,
+		7041,7042,7043,7044,7045,7046,7047,7048,7049,7050,7051,7052,7053,0,0,0,
+		7054,7055,7056,7057,7058,7059,7060,7061,7062,7063,7064,7065,7066,0,0,0,
+		7067,7068,7069,7070,7071,7072,7073,7074,7075,7076,7077,7078,7079,7080,7081,7082,
+		7083,7084,7085,7086,7087,7088,7089,7090,7091,7092,7093,7094,7095,7096,7097,7098,
+		7099,7100,7101,7102,7103,7104,7105,7106,7107,7108,7109,7110,7111,7112,7113,7114,
+		7115,7116,7117,7118,7119,7120,7121,7122,7123,7124,7125,7126,7127,7128,7129,7130,
+		7131,7132,7133,7134,7135,7136,7137,7138,7139,7140,7141,7142,7143,7144,7145,7146,
+		7147,7148,7149,7150,7151,7152,7153,7154,7155,7156,7157,7158,7159,7160,7161,7162,
+		7163,7164,7165,7166,7167,7168,7169,7170,7171,7172,7173,7174,7175,7176,7177,7178,
+		7179,7180,7181,7182,0,0,0,0,0,0,0,0,0,0,0,0,
+		7183,7184,7185,7186,7187,7188,7189,7190,7191,7192,7193,7194,7195,7196,7197,7198,
+		7199,7200,7201,7202,7203,7204,7205,7206,7207,7208,7209,7210,7211,7212,7213,7214,
+		7215,7216,7217,7218,7219,7220,7221,7222,7223,7224,7225,7226,7227,7228,7229,7230,
+		7231,7232,7233,7234,7235,7236,7237,7238,7239,7240,7241,7242,7243,7244,7245,7246,
+		7247,7248,7249,7250,7251,7252,7253,7254,7255,7256,7257,7258,7259,7260,7261,7262,
+		7263,7264,7265,7266,7267,7268,7269,7270,7271,0,0,0,0,0,0,0,
+		7272,7273,7274,7275,7276,7277,7278,7279,7280,7281,7282,7283,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		7284,7285,7286,7287,7288,7289,7290,7291,7292,7293,7294,7295,0,0,0,0,
+		7296,7297,7298,7299,7300,7301,7302,7303,7304,7305,7306,7307,7308,7309,7310,7311,
+		7312,7313,7314,7315,7316,7317,7318,7319,7320,7321,7322,7323,7324,7325,7326,7327,
+		7328,7329,7330,7331,7332,7333,7334,7335,7336,7337,7338,7339,7340,7341,7342,7343,
+		7344,7345,7346,7347,7348,7349,7350,7351,0,0,0,0,0,0,0,0,
+		7352,7353,7354,7355,7356,7357,7358,7359,7360,7361,0,0,0,0,0,0,
+		7362,7363,7364,7365,7366,7367,7368,7369,7370,7371,7372,7373,7374,7375,7376,7377,
+		7378,7379,7380,7381,7382,7383,7384,7385,7386,7387,7388,7389,7390,7391,7392,7393,
+		7394,7395,7396,7397,7398,7399,7400,7401,0,0,0,0,0,0,0,0,
+		7402,7403,7404,7405,7406,7407,7408,7409,7410,7411,7412,7413,7414,7415,7416,7417,
+		7418,7419,7420,7421,7422,7423,7424,7425,7426,7427,7428,7429,7430,7431,0,0,
+		7432,7433,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		7434,7435,7436,7437,7438,7439,7440,7441,7442,7443,7444,7445,7446,7447,7448,7449,
+		7450,7451,7452,7453,7454,7455,7456,7457,7458,7459,7460,7461,7462,7463,7464,7465,
+		7466,7467,7468,7469,7470,7471,7472,7473,7474,7475,7476,7477,7478,7479,7480,7481,
+		7482,7483,7484,7485,7486,7487,7488,7489,7490,7491,7492,7493,7494,7495,7496,7497,
+		7498,7499,7500,7501,7502,7503,7504,7505,7506,7507,7508,7509,7510,7511,7512,7513,
+		7514,7515,7516,7517,7518,7519,7520,7521,7522,7523,7524,7525,7526,7527,7528,7529,
+		7530,7531,7532,7533,7534,7535,7536,7537,7538,7539,7540,7541,7542,7543,7544,7545,
+		7546,7547,7548,7549,7550,7551,7552,7553,7554,0,7555,7556,7557,7558,7559,7560,
+		7561,7562,7563,7564,7565,7566,7567,7568,7569,7570,7571,7572,7573,7574,7575,7576,
+		7577,7578,7579,7580,7581,7582,7583,7584,7585,7586,7587,7588,7589,7590,7591,7592,
+		7593,7594,7595,7596,7597,7598,7599,7600,7601,7602,7603,7604,7605,7606,7607,7608,
+		7609,7610,7611,7612,7613,7614,7615,7616,7617,7618,7619,7620,7621,7622,7623,7624,
+		7625,7626,7627,7628,7629,7630,7631,7632,7633,7634,7635,7636,0,7637,7638,7639,
+		7640,7641,7642,7643,7644,7645,7646,7647,7648,7649,7650,7651,7652,7653,7654,7655,
+		7656,7657,7658,7659,7660,7661,7662,7663,7664,7665,7666,7667,7668,7669,7670,7671,
+		7672,7673,7674,7675,7676,7677,7678,7679,7680,7681,7682,7683,7684,7685,7686,7687,
+		7688,7689,7690,7691,7692,7693,7694,7695,7696,7697,7698,7699,7700,7701,7702,7703,
+		7704,7705,7706,7707,7708,7709,7710,7711,7712,7713,7714,7715,7716,7717,7718,7719,
+		7720,7721,7722,7723,7724,7725,7726,7727,7728,7729,7730,7731,7732,7733,7734,7735,
+		7736,7737,7738,7739,7740,7741,7742,7743,7744,7745,7746,7747,7748,7749,7750,7751,
+		7752,7753,7754,7755,7756,7757,7758,7759,7760,7761,7762,7763,7764,7765,7766,7767,
+		7768,7769,7770,7771,0,0,0,0,0,0,0,0,0,0,0,0,
+		7772,7773,7774,7775,7776,7777,7778,7779,7780,7781,7782,7783,7784,7785,0,0,
+		7786,7787,7788,7789,7790,0,0,0,7791,7792,7793,0,0,0,0,0,
+		7794,7795,7796,7797,7798,7799,7800,0,0,0,0,0,0,0,0,0,
+		7801,7802,7803,7804,7805,7806,7807,7808,7809,7810,7811,7812,7813,7814,7815,7816,
+		7817,7818,7819,7820,7821,7822,7823,7824,7825,0,0,0,0,0,0,0,
+		7826,7827,7828,7829,7830,7831,7832,0,0,0,0,0,0,0,0,0,
+		7833,7834,7835,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		7836,7837,7838,7839,7840,7841,7842,0,0,0,0,0,0,0,0,0,
+		7843,7844,7845,7846,7847,7848,7849,7850,7851,7852,7853,7854,7855,7856,7857,7858,
+		7859,7860,7861,7862,7863,7864,7865,7866,7867,7868,7869,7870,7871,7872,7873,7874,
+		7875,7876,7877,7878,7879,7880,7881,7882,7883,7884,7885,7886,7887,7888,7889,7890,
+		7891,7892,7893,7894,7895,7896,7897,7898,7899,7900,7901,7902,7903,7904,7905,7906,
+		7907,7908,7909,7910,7911,7912,7913,7914,7915,7916,7917,7918,7919,7920,7921,7922,
+		7923,7924,7925,7926,7927,7928,7929,7930,7931,7932,7933,7934,7935,7936,7937,7938,
+		7939,7940,7941,7942,7943,7944,7945,7946,7947,7948,7949,7950,7951,7952,7953,7954,
+		7955,7956,7957,7958,7959,7960,7961,7962,7963,7964,7965,7966,7967,7968,7969,7970,
+		7971,7972,7973,7974,7975,7976,7977,7978,7979,7980,7981,7982,7983,7984,7985,7986,
+		7987,7988,7989,0,7990,7991,7992,7993,7994,7995,7996,7997,7998,7999,8000,8001,
+		8002,8003,8004,8005,8006,8007,8008,8009,8010,8011,8012,8013,8014,8015,8016,8017,
+		8018,8019,8020,8021,8022,8023,8024,8025,8026,8027,8028,8029,8030,8031,8032,8033,
+		8034,8035,8036,8037,8038,8039,8040,8041,8042,8043,8044,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		8734,8773,9254,9515,9645,9744,9815,9874,9939,9996,0,0,0,0,0,0,
+		38731,38723,38739,44079,38909,38925,38929,38937,38945,38949,38961,38953,43811,44095,38981,38985,
+		38989,39041,44083,43815,38997,39059,44091,39079,39087,38861,39095,39099,44471,39133,39155,43823,
+		39179,39183,39191,39199,43827,39235,39239,39259,39271,39275,39279,39287,39331,39335,39351,39379,
+		39387,39391,39391,39391,44107,41255,39417,39425,44111,39437,39445,39457,39513,39485,39497,39501,
+		39517,39525,39529,39537,39545,39549,39549,39557,39565,39569,39581,39629,39589,39633,39593,39601,
+		39159,39717,39661,39665,39669,39657,39677,39673,39697,44115,39725,39729,39737,39749,39761,39801,
+		44119,44123,39821,39825,39829,39817,39837,43831,43835,39845,39853,39853,44127,39897,39901,39905,
+		39913,44131,39921,39925,40207,39945,43839,39977,39993,40009,40005,44139,40017,44143,40029,40025,
+		40033,40049,40053,43843,40077,40085,40089,40093,43847,44147,43851,40129,40133,40137,40145,44511,
+		40169,44155,44155,42317,40189,40189,43855,44183,44351,40215,40223,43859,40243,40269,40273,40281,
+		40297,43867,43863,40301,44159,40305,40325,40329,40333,40329,40345,40349,40365,40357,40361,40369,
+		40373,40377,40389,40393,40433,40441,40457,40477,44171,40473,40461,40485,40493,40513,44175,40521,
+		40509,40501,43871,40529,40537,40545,40533,43875,40565,40581,44179,40637,40723,40687,43887,40699,
+		43883,43879,39067,39071,40727,40703,42251,43987,40773,40777,40781,40821,40813,44199,43891,40841,
+		40829,40881,40889,44207,40893,40849,40901,43895,40905,40909,40913,40925,44211,40933,43899,40945,
+		44215,40949,43903,40961,40983,40995,40999,44219,44135,44223,41055,44227,41067,41075,41059,41087,
+		41103,41119,41107,41111,41123,41127,44231,41099,41151,41155,43907,41175,41171,44235,41143,41203,
+		44239,44243,41207,41227,41223,41219,43911,41231,41263,41259,41271,44087,41295,44247,41307,44255,
+		41327,41349,41369,44259,41403,41407,44263,44267,41439,41455,43915,41465,43919,43919,41489,41493,
+		41501,41505,41517,43923,41545,44271,41573,44275,41585,44151,41607,44279,44283,44287,43927,43931,
+		41685,44295,44291,44299,44303,41693,41697,41697,41705,43939,41709,43943,43947,44311,41729,41737,
+		41749,43951,44315,41807,44319,44323,41859,41883,43955,41891,41895,41899,44327,44331,44331,41927,
+		43959,44335,41953,41957,43963,44339,41985,43967,42001,41993,42013,44347,42037,43971,42049,42057,
+		42073,43975,44355,44359,43979,44363,42127,44367,42155,42171,42187,44371,44375,42207,44379,42215,
+		44187,43983,42255,42259,43991,42263,39841,44383,44387,44191,44195,42317,42321,42957,43995,42381,
+		42377,42385,39219,42389,42393,42397,42405,44391,42401,42409,42429,42433,42413,42437,42457,42477,
+		42425,42445,42449,42453,44395,44403,44399,43999,42485,42489,42497,44419,42501,44407,44003,44007,
+		44411,44415,44011,42537,42541,42545,42549,42561,42557,42569,42565,42581,42573,42577,42585,44015,
+		42593,42597,44019,42617,42621,44423,42641,42645,44023,42657,43819,44427,44431,44027,44031,42723,
+		42747,42775,42795,44435,42827,42831,42863,42883,44443,44099,42901,42897,42909,44103,42925,42937,
+		44447,44451,43031,43043,43051,44455,43055,43119,43131,43135,43127,43147,43151,44459,43175,44035,
+		43183,44463,44039,43253,40037,43283,44467,44475,44043,44047,43327,44479,44051,44483,43355,43355,
+		43363,44487,43409,44055,43425,43447,43455,43463,44059,44491,43493,43527,43543,44063,44067,43547,
+		44495,44071,44499,44503,44507,43601,44075,43629,43641,43649,43657,43665,43673,44515,0,0,
+		0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+	};
+
+	template<class T> const boost::uint16_t collation_data<T>::collation_pool[46295] = {
+		0,57344,0,25089,25090,25091,25092,25093,25097,25191,25373,25516,25517,25513,25366,25384,
+		25385,25505,26214,25123,25101,25214,25510,25152,25146,26218,26219,26220,25197,25504,25386,25511,
+		25387,25783,25099,25780,25388,26222,25389,26224,25094,64257,521,25192,26223,25498,25787,26066,
+		25382,26221,26068,25784,25898,26215,25781,25500,25235,25790,25383,25198,26217,26216,25797,25799,
+		25800,25801,25802,25803,25804,25805,25806,25807,25808,25809,25810,25811,25812,25813,25814,25815,
+		25816,25817,25820,25821,25785,25786,25788,25791,25782,25789,25822,25823,25824,25825,25826,25827,
+		25828,25829,25830,25831,25832,25833,25834,25835,25836,25837,25838,25839,25840,25841,25842,25843,
+		25844,25845,25846,25847,25848,25849,25798,1211,57861,0,26209,25899,25572,25573,25193,25130,
+		25200,25574,25153,25102,25900,25901,25575,25576,25577,25578,25579,25580,26237,26239,25902,25520,
+		25522,25131,25132,25905,25906,25147,25154,25201,25518,25133,25134,25508,25216,25907,25908,25293,
+		25217,25218,25155,25156,25157,25158,25159,25160,25202,25581,25582,25583,25584,25926,25294,25135,
+		25194,25161,25162,25163,25164,25165,25166,25167,25168,25169,25170,25171,25172,25173,25174,25175,
+		25585,25238,25239,25600,32086,32087,32088,32089,32090,32091,25927,25605,25606,25607,25928,32092,
+		32093,32094,32095,32096,32097,32104,32105,32106,25929,25930,25931,25932,25933,25934,25935,25608,
+		25961,25609,25962,32128,32129,32130,32131,32132,32133,32134,32135,32136,32137,32138,32139,32140,
+		32141,32142,32143,25963,25610,25611,25612,25613,25971,25972,25973,25616,25617,25618,25619,25620,
+		25621,25622,25625,64257,1049,25626,25627,25628,25629,25630,25631,25974,25183,25975,25976,25977,
+		25978,25979,25980,25981,25982,25983,25984,25985,25986,25390,25391,25392,25393,25632,25987,25988,
+		25989,25990,25991,25992,25993,25994,25995,25996,25997,25998,25999,26000,26001,26002,25623,25624,
+		25633,25634,25635,26003,26004,26005,26006,25636,25637,25249,25250,25659,25660,25661,25662,26009,
+		26010,25295,25296,25176,25219,25177,25178,25179,25180,25203,25297,32144,32145,32146,32147,32148,
+		32149,32150,32151,32152,32153,32154,25850,25851,25852,25853,25854,25855,25856,25857,25858,25859,
+		25103,26007,25222,58369,521,25394,25395,25187,25188,25189,25246,25247,25251,25252,25184,25663,
+		25664,25665,25586,25215,25136,25220,25181,25182,25105,25106,25137,25221,26008,25195,25204,26015,
+		26016,26017,26018,26019,26020,26021,26022,26023,26024,26025,26026,26027,26028,26029,26030,26031,
+		26032,26033,26034,26035,26036,26037,26038,26039,26040,26041,26042,26043,26044,26045,26046,25298,
+		25299,25666,25667,25668,25669,25670,25671,25672,25253,25254,25255,25256,25673,25674,25300,25301,
+		25223,25185,25257,25258,25104,26047,26048,26049,26050,26051,26052,26053,26054,26055,26056,26057,
+		26058,26059,26060,26061,26062,26063,26064,26065,25686,25687,25688,25689,25242,25243,25656,25657,
+		25658,25291,25292,25675,25676,25677,25678,25679,25680,25681,25682,25792,25794,1211,57867,0,
+		1216,57862,0,1216,57861,0,1216,57867,0,1217,57862,0,1217,57861,0,1217,
+		57867,0,1211,57862,0,25793,25107,64257,531,25108,25109,25110,25111,25492,25100,25367,
+		25368,25369,25370,25374,25375,25376,25377,25523,25524,25529,25530,58369,638,50177,638,58369,
+		638,50177,638,50177,638,58369,638,25531,25095,25096,25519,25521,25535,50177,959,58369,
+		959,50177,959,50177,959,58369,959,25536,50177,960,58369,960,50177,960,50177,960,
+		58369,960,25539,25371,25372,25540,50177,615,58369,615,25212,25098,25541,25543,25545,25546,
+		25532,26230,25396,25397,50177,621,58369,621,50177,621,58369,615,50177,615,58369,621,
+		25514,25501,25533,25534,25506,25148,25544,25507,26226,25114,25542,25337,25338,50177,959,50177,
+		959,50177,959,58369,959,25339,25340,25341,25342,25343,25344,25345,62465,1638,62465,1649,
+		62465,1643,62465,808,62465,809,62721,1638,62721,1649,62721,1643,62721,808,62721,809,
+		26070,26071,26072,26073,26074,26075,26076,26077,26078,26079,26080,26081,26082,58625,1637,26083,
+		26084,26085,26086,26087,26369,26088,26089,32155,32156,32157,32158,32159,32160,26090,26091,26092,
+		26094,26093,26095,26096,26097,26098,26099,26100,26101,1516,57872,0,1517,57872,0,26102,
+		26103,26104,26105,26106,26107,26108,26109,26110,26111,26112,26113,26114,26115,26116,26117,26118,
+		26119,1520,57872,0,26120,26121,26122,26123,26124,26125,26126,26127,26128,26129,26130,26131,
+		26132,26133,26134,26135,26136,26137,26138,26139,26140,26141,26142,26143,26144,26145,26146,26147,
+		26148,26149,1574,57872,0,1578,57872,0,1576,57872,0,26150,26151,26152,26153,26154,
+		26155,26156,26157,26158,26159,26160,26161,26162,26163,26164,26165,26166,26167,26168,26169,26170,
+		26171,26172,26173,26174,26175,26176,26177,26178,26179,26180,26181,26182,26183,26184,26185,26186,
+		26187,26188,26189,26190,26191,26192,26193,26194,26195,26196,26197,26198,26199,26200,26201,1625,
+		57872,0,26202,26203,26204,26205,1629,57872,0,26206,26207,1631,57872,0,26208,26210,
+		26211,26212,26213,26225,26227,26228,26229,26231,26232,26233,26234,26235,26236,26238,26240,26241,
+		26242,26243,26244,26245,26246,1670,57872,0,26247,1671,57872,0,26248,26249,26250,26251,
+		26252,50177,1676,58369,1676,50177,1676,50177,1676,58369,1676,26253,50177,1677,58369,1677,
+		50177,1677,50177,1677,58369,1677,26254,26255,26256,26257,26258,26259,26260,26261,26262,26263,
+		26264,26265,26266,26267,26268,26269,1689,57872,0,26270,26271,1695,57872,0,26272,26273,
+		1696,57872,0,26274,1698,57872,0,26275,26276,26277,26278,26279,26280,26281,26282,26283,
+		26284,26285,26286,26287,26288,26289,26290,26291,26292,26293,26294,26295,26296,1643,57872,0,
+		26297,1721,57872,0,26298,26299,26300,26301,26302,26303,26304,26305,26306,26307,1702,57872,
+		0,1642,57872,0,1644,57872,0,1723,57872,0,1724,57872,0,26308,26309,1732,
+		57872,0,1733,57872,0,26310,26311,1734,57872,0,1735,57872,0,26312,26313,26314,
+		26315,26316,26317,1736,57872,0,1737,57872,0,26318,26319,1742,57872,0,1743,57872,
+		0,26320,26321,1744,57872,0,1745,57872,0,26322,26323,26324,26325,26326,26327,26328,
+		26329,26330,26331,26332,26333,26334,26335,26336,26337,26338,26339,26340,26341,26342,26343,26344,
+		26345,26346,26347,26348,26349,26350,26351,26352,26353,26354,26355,1770,57872,0,1776,57872,
+		0,1777,57872,0,1779,57872,0,26356,26357,26358,26359,26360,26361,26362,26363,26364,
+		26365,26366,26367,26368,26370,26371,26372,26373,26374,26375,26376,26377,26378,26379,26380,26381,
+		26382,26383,26384,26385,26386,26387,26388,26389,26390,26391,26392,26393,26394,26395,26396,26397,
+		26398,26399,26400,26401,26402,26403,26404,1738,57872,0,1739,57872,0,1753,57872,0,
+		1754,57872,0,26405,26406,26407,26408,26409,26410,1782,57872,0,1783,57872,0,1784,
+		57872,0,1785,57872,0,26411,26412,26413,26414,26415,26416,26417,26418,26419,26420,26421,
+		26422,26423,26424,26425,26426,26427,26428,26429,26430,26431,26432,26433,26434,26435,26436,25398,
+		25399,25400,25401,26437,26438,26439,26440,26441,26442,26443,26444,26445,26446,26447,26448,26449,
+		26450,26451,26452,26453,26454,26455,26456,26457,26458,26459,26460,26461,26462,26463,26464,26465,
+		25472,25473,26466,26467,26468,26469,26470,26471,26472,26473,26474,26475,26476,26477,26478,26479,
+		26480,26481,26482,26483,26484,26485,26486,26487,26488,26489,26490,26491,26492,26493,26494,26495,
+		26496,26497,26498,26499,26500,26501,26502,26503,26504,26505,26506,26507,26508,26509,26510,26511,
+		26512,26513,26514,26515,26516,26517,26518,26519,26520,26521,26522,26523,26524,26525,26526,26527,
+		26528,26529,26530,26531,26532,26533,26534,26535,26536,26537,26538,26539,26540,26541,26542,26543,
+		26544,26545,26546,26547,26548,26549,26550,26551,26552,26553,26554,26555,26556,26557,26558,26559,
+		26560,26561,26562,26563,26564,26565,26566,26567,26568,26569,26570,26571,26572,26573,26574,26575,
+		26576,26577,26578,26579,26580,26581,26582,26583,26584,26585,26586,26587,26588,26589,26590,26591,
+		26592,26593,26594,26595,26596,26597,26598,26599,26600,26601,26602,26603,26604,26605,26606,26607,
+		26608,26609,26610,26611,26612,26613,26614,26615,26616,26617,26618,26619,26620,26621,26622,26623,
+		26624,26625,26626,26627,26628,26629,26630,26631,26632,26633,26634,26635,26636,26637,26638,26639,
+		26640,26641,26642,26643,26644,26645,26646,26647,26648,26649,26650,26651,26652,26653,26654,26655,
+		26656,26657,26658,26659,26660,26661,26662,26663,26664,26665,26666,26667,26668,26669,26670,26671,
+		26672,26673,26674,26675,26676,26677,26678,26679,26680,26681,26682,26683,26684,26685,26686,26687,
+		26688,26689,26690,26691,26692,26693,26694,26695,26696,26697,26698,26699,26700,26701,26702,26703,
+		26704,26705,26706,26707,26708,26709,26710,26711,26712,26713,26714,26715,26716,26717,26718,26719,
+		26720,26721,26722,26723,26724,26725,26726,26727,26728,26729,26730,26731,26732,26733,26734,26735,
+		26736,26737,26738,26739,26740,26741,26742,26743,26744,26745,26746,26747,26748,26749,26750,26751,
+		26752,26753,26754,26755,26756,26757,26758,26759,26760,26761,26762,26763,26764,26765,26766,26767,
+		26768,26769,26770,26771,26772,26773,26774,26775,26776,26777,26778,26779,26780,26781,26782,26783,
+		26784,26785,26786,26787,26788,26789,26790,26791,26792,26793,26794,26795,26796,26797,26798,26799,
+		26800,26801,26802,26803,26804,26805,26806,26807,26808,26809,26810,26811,26812,26813,26814,26815,
+		26816,26817,26818,26819,26820,26821,26822,26823,26824,26825,26826,26827,26828,26829,26830,26831,
+		26832,26833,26834,26835,26836,26837,26838,26839,26840,26841,26842,26843,26844,26845,26846,26847,
+		26848,26849,26850,26851,26852,26853,26854,26855,26856,26857,26858,26859,26860,26861,26862,26863,
+		26864,26865,26866,26867,26868,26869,26870,26871,26872,26873,26874,26875,26876,26877,26878,26879,
+		26880,26881,26882,26883,26884,26885,26886,26887,26888,26889,26890,26891,26892,26893,26894,26895,
+		26896,26897,26898,26899,26900,26901,26902,26903,26904,26905,26906,26907,26908,26909,26910,26911,
+		26912,26913,26914,26915,26916,26917,26918,26919,26920,26921,26922,26923,26924,26925,26926,26927,
+		26928,26929,26930,26931,26932,26933,26934,26935,26936,26937,26938,26939,26940,26941,26942,26943,
+		26944,26945,26946,26947,26948,26949,26950,26951,26952,26953,26954,26955,26956,26957,26958,26959,
+		26960,26961,26962,26963,26964,26965,26966,26967,26968,26969,26970,26971,26972,26973,26974,26975,
+		26976,26977,26978,26979,26980,26981,26982,26983,26984,27187,27188,27189,27190,27191,27192,27193,
+		27194,27195,27196,27197,27198,27199,27200,27201,27202,27203,27204,27205,27206,27207,27208,27209,
+		27210,27211,27212,27213,27214,27215,27216,27217,27218,27219,27220,27221,27222,27223,27224,27225,
+		27226,27227,27228,27229,27230,27231,27232,27233,27234,28654,28655,28656,28657,28658,28659,28660,
+		28661,27235,27236,27237,27238,27239,27240,27241,27242,27243,27244,27245,27246,27247,27248,27249,
+		27250,27251,27252,27253,27254,27255,27256,27257,27258,27259,27260,27261,27262,27263,27264,27265,
+		27266,27267,27268,27269,27270,27271,27272,27273,27274,27275,27276,27277,27278,27279,27280,27281,
+		27282,27283,27284,27285,27286,27287,29249,29250,29251,27288,27289,27290,27291,27292,27293,27294,
+		27295,27296,27297,27298,27299,27300,27301,27302,27303,27304,27305,27306,27307,27308,27309,27310,
+		27311,27312,27313,28648,28649,28650,28651,28652,28653,27314,27315,27316,27317,27318,27319,27320,
+		27321,27322,27323,27324,27325,27326,27327,27328,27329,27330,27331,27332,27333,27334,27335,27336,
+		27337,27338,27339,27340,27341,27342,27343,27344,27345,27346,27347,27348,27349,27350,27351,27352,
+		27353,27354,27355,27356,27357,27358,27359,27360,27361,27362,27363,27364,27365,27366,27367,27368,
+		27369,27370,27371,27372,27373,27374,27375,27376,27377,27378,27379,27380,27381,27382,27383,27384,
+		27385,27386,27387,27388,27389,27390,27391,27392,27393,27394,27395,27396,27397,27398,27399,27400,
+		27401,27402,27403,27404,27405,27406,27407,27408,27409,27410,27411,27412,27413,27414,27415,27416,
+		27417,27418,27419,27420,27421,27422,27423,27424,27425,27452,27453,27454,27455,27456,27457,27458,
+		27459,27460,27461,27462,27463,27464,27465,27466,27467,27468,27469,27470,27471,27472,27473,27474,
+		27475,27476,27477,27478,27479,27480,27481,27482,27483,27484,27487,27488,27489,27490,27491,27492,
+		27493,27494,27495,27496,27497,27498,27499,27500,27501,27502,27503,27504,27505,27506,27507,27508,
+		27509,27510,27511,27512,27513,27514,27515,27516,27517,27518,27519,27520,27521,27522,27523,27524,
+		27525,27526,27527,27528,27529,27530,27531,27532,27533,27534,27535,27536,27537,27538,27539,27540,
+		27541,27542,27543,27544,27545,27546,27547,27548,27549,27550,27551,27552,27553,27554,27555,27556,
+		27557,25438,25439,25440,25441,25442,25443,25444,25445,25446,25447,25448,25449,25450,25451,27558,
+		27559,27560,27561,27562,27563,27564,27565,27566,27567,27568,27569,27570,27571,27572,27573,27574,
+		27575,27576,27577,27578,27579,27580,27581,27582,27583,27584,27585,27586,27587,27588,27589,27590,
+		27591,27592,27593,27594,27595,27596,27597,27598,27599,27600,27601,27602,27603,27604,27605,27606,
+		25426,25427,27607,27608,27609,27610,27611,27612,27613,27614,27615,27616,27617,27618,27619,27620,
+		27621,27622,27623,27624,27625,27626,27627,27628,27629,27630,27631,27632,27633,27634,27635,27636,
+		27637,25428,25429,25430,25431,25432,25433,25434,25435,25436,25437,27638,27639,27640,27641,27642,
+		27643,27644,27645,27646,27647,27648,27649,27650,27651,27652,27653,28392,28393,28394,28395,28396,
+		28397,28398,28399,28400,28401,28402,28403,28404,28405,28406,28407,28408,28409,28410,28411,28412,
+		28413,28414,28415,28416,28417,28418,28419,28420,28421,28422,28423,28424,28425,28426,28427,28428,
+		28429,28430,28431,28432,28433,28434,28435,28436,28437,28438,28439,28440,28441,28442,28443,28444,
+		28445,28446,28447,28448,28449,28450,28451,28452,28453,28454,28455,28456,28457,28458,28459,28460,
+		28461,28462,28463,28464,28465,28466,28467,28468,28469,28470,28471,28472,28473,28474,28475,28476,
+		28477,28478,28479,28480,28481,28482,28483,28484,28485,28486,28487,28488,28489,28490,28491,28492,
+		28493,28494,28495,28496,28497,28498,28499,28500,28501,28502,28503,28504,28505,28506,28507,28508,
+		28509,28510,28511,28512,28513,28514,28515,28516,28517,28518,28519,28520,28521,28522,28523,28524,
+		28525,28526,28527,28528,28529,28530,28531,28532,28533,28534,28535,28536,28537,28538,28539,28540,
+		28541,28542,28543,28544,28545,28546,28547,28548,28549,28550,28551,28552,28553,28554,28555,28556,
+		28557,28558,28559,28560,28561,28562,28563,28564,28565,28566,28567,28568,28569,28570,28571,28572,
+		28573,28574,28575,28576,28577,28578,28579,28580,28581,28582,28583,28584,28585,28586,28587,28588,
+		28589,28590,28591,28592,28593,28594,28595,28596,28597,28598,28599,28600,28601,28602,28603,28604,
+		28605,28606,28607,28608,28609,28610,28611,28612,28613,28614,28615,28616,28617,28618,28619,28620,
+		28621,28622,28623,28624,28625,28626,28627,28628,28629,28630,28631,28632,28633,28634,28635,28636,
+		28637,28638,28639,28640,28641,28642,28643,28644,28645,28646,28647,27654,27655,27656,27657,27658,
+		27659,27660,27661,27662,27663,27664,27665,27666,27667,27668,27669,27670,27671,27672,27673,27674,
+		27675,27676,27677,27678,27679,27680,27681,27682,27683,27684,27685,27686,27687,27688,27689,27690,
+		27691,27692,27693,27694,27695,27696,27697,27698,27699,27700,27701,27702,27703,27704,27705,27706,
+		27707,27708,27709,27710,27711,27712,27713,27714,27715,27716,27717,27718,27719,27720,27721,27722,
+		27723,27724,27725,27726,27727,27728,27729,27730,27731,27732,27733,27734,27735,27736,27737,27738,
+		27739,27740,27741,27742,27743,27744,27745,27746,27747,27748,27749,27750,27751,27752,27753,27754,
+		27755,27756,27757,27758,27759,27760,27761,27762,27763,27764,27765,27766,27767,27768,27769,27770,
+		27771,27772,27773,27774,27775,27776,27777,27778,27779,27780,27781,27782,27783,27784,25404,25405,
+		25406,25407,25408,25409,25410,25411,25412,25413,25414,25415,25416,25417,25418,25419,25420,25421,
+		25422,25423,25424,25425,27785,27786,27787,27788,27789,27790,27791,27792,27793,27794,27795,27796,
+		27797,27798,27799,27800,27801,27802,27803,27804,27805,27806,27807,27808,27809,27810,27811,27812,
+		27813,27814,27815,27816,27817,27818,27819,27820,27821,27822,27823,27824,27825,27826,27827,27828,
+		27829,27830,27831,27832,27833,27834,27835,27836,27837,27838,27839,27840,27841,27842,27843,27844,
+		27845,27846,27847,25494,25495,25496,25497,27848,27849,27850,27851,27852,27853,27854,27855,27856,
+		27857,27858,27859,27860,27861,27862,27863,27864,27865,27866,27867,27868,27869,27870,27871,27872,
+		27873,27874,27875,27876,27877,27878,27879,25402,25403,27880,27881,27882,27883,27884,27885,27886,
+		27887,27888,27889,27890,27891,27892,27893,50177,1676,50177,1676,50177,1676,58369,1676,27894,
+		27895,27896,27897,27898,27899,27900,27901,27902,27903,27904,27905,27906,27907,27908,27909,27910,
+		27911,27912,27913,27914,27915,27916,27917,27918,27919,27920,27921,27922,27923,27924,27925,27926,
+		27927,27928,27929,27930,27931,27932,27933,27934,27935,27936,27937,27938,27939,27940,27941,27942,
+		27943,27944,27945,27946,27947,27948,27949,27950,27951,27952,27953,27954,27955,27956,27957,27958,
+		27959,27960,27961,27962,27963,27964,27965,27966,27967,27968,27969,27970,27971,27972,27973,27974,
+		27975,27976,27977,27978,27979,27980,27981,27982,27983,27984,27985,27986,27987,27988,27989,27990,
+		27991,27992,27993,27994,27995,27996,50177,576,50177,576,58369,1643,50177,1643,58369,1643,
+		50177,1643,50177,1643,58369,1643,27997,27998,27999,28000,28001,28002,28003,28004,28005,28006,
+		28007,28008,28009,28010,28011,28012,28013,28014,28015,28016,28017,28018,28019,28020,28021,28022,
+		28023,28024,28025,28026,28027,28028,28029,28030,28031,28032,28033,28034,28035,28036,28037,28038,
+		28039,28040,28041,28042,28043,28044,28045,28046,28047,28048,28049,28050,28051,28052,28053,28054,
+		28055,28056,28057,28058,28059,28060,28061,28062,28063,28064,28065,28066,28067,28068,28069,28070,
+		28071,28072,28073,28074,28075,28076,28077,28078,28079,28080,28081,28082,28083,28084,28085,28086,
+		28087,28088,28089,28090,28091,28092,28093,28094,28095,28096,28097,3522,57872,0,28098,28099,
+		28100,28101,28102,28103,28104,28105,28106,28107,28108,28109,28110,28111,28112,28113,28114,28115,
+		28116,28117,28118,28119,28120,28121,28122,28123,28124,28125,28126,28127,28128,28129,28130,28131,
+		28132,28133,28134,28135,28136,28137,28138,28139,28140,28141,28142,28143,28144,28145,28146,28147,
+		28148,28149,28150,28151,28152,28153,28154,28155,28156,28157,28158,28159,28160,28161,28162,28163,
+		28164,28165,28166,28167,28168,28169,28170,28171,28172,28173,28174,28175,28176,28177,28178,28179,
+		28180,28181,28182,28183,28184,28185,28186,28187,28188,28189,28190,28191,28192,28193,28194,28195,
+		28196,28197,28198,28199,28200,28201,28202,28203,28204,28205,28206,28207,28208,28209,28210,28211,
+		28212,28213,28214,28215,28216,28217,28218,28219,28220,28221,28222,28223,28224,28225,28226,28227,
+		28228,28229,28230,28231,28232,28233,28234,28235,28236,28237,28238,28239,28240,28241,28242,28243,
+		28244,28245,28246,28247,28248,28249,28250,28251,28252,28253,28254,28255,28256,28257,28258,28259,
+		28260,28261,28262,28263,28264,28265,28266,28267,28268,28269,28270,28271,28272,28273,28274,28275,
+		28276,28277,28278,28279,28280,28281,28282,28283,28284,28285,28286,28287,28288,28289,28290,28291,
+		28292,28293,28294,28295,28296,28297,28298,28299,28300,28301,28302,28303,28304,28305,28306,28307,
+		28308,28309,28310,28311,28312,28313,28314,28315,28316,28317,28318,28319,28320,28321,28322,28323,
+		28324,28325,28326,28327,28328,28329,28330,28331,28332,28333,28334,28335,28336,28337,28338,28339,
+		28340,28341,28342,28343,28344,28345,28346,28347,28348,28349,28350,28351,28352,28353,28354,28355,
+		28356,28357,28358,28359,28360,28361,28362,28363,28364,28365,28366,28367,28368,28369,28370,28371,
+		28372,28373,28374,28375,28376,28377,28378,28379,28380,28381,28382,28383,28384,28385,28386,28387,
+		28388,28389,28390,28391,25224,25205,25206,25351,32183,25225,25352,25683,25547,25548,25452,25453,
+		25454,25455,25549,25550,25551,25456,25457,25552,25458,25459,25553,25554,25555,25556,25557,25558,
+		25559,25560,25561,25116,25213,25353,25562,25563,25460,25461,25564,25565,25462,25463,25464,25465,
+		25466,25467,25468,25469,25470,25471,25346,25347,25348,25349,25199,25226,25236,25125,25237,25124,
+		25149,25525,25526,25527,25499,25112,25113,25227,25350,25493,25503,25117,25126,25378,25115,25566,
+		25567,25568,25569,25570,25151,25512,25528,25127,25502,25128,25129,27485,27486,25515,32027,32028,
+		32029,32030,32031,32032,32033,32034,32035,32036,32037,32038,58113,521,25142,25234,25537,32075,
+		25474,25475,25476,25477,25478,25479,25480,25481,32076,32077,25482,25483,25484,25485,25486,25487,
+		25488,25489,25118,25379,25380,25381,32078,25119,58369,7500,32079,25538,32080,32081,25795,25796,
+		25120,25121,32082,32083,32039,32040,32041,32042,32043,32044,32045,32046,32047,32048,32049,32050,
+		32051,32052,32053,32054,32055,32056,32057,32058,32059,32060,32061,32062,32063,32064,32065,32066,
+		32067,32068,32069,32070,32071,32072,32073,32074,32084,28662,28663,28664,28665,28666,28667,28668,
+		28669,28670,28671,28672,28673,28674,28675,28676,28677,28678,28679,28680,28681,28682,28683,28684,
+		28685,28686,28687,28688,28689,28690,28691,28692,28693,28694,28695,28696,28697,28698,28699,28700,
+		28701,28702,28703,28704,28705,28706,28707,28708,28709,28710,28711,28712,28713,28714,28715,28716,
+		28717,28718,28719,28720,28721,28722,28723,28724,28725,28813,28814,28815,28816,28817,28818,28819,
+		28820,28821,28822,28823,28824,28825,28826,28827,28828,28829,28830,28831,28832,28833,28834,28835,
+		28836,28837,28838,28839,28840,28841,28842,28843,28844,28845,28846,28847,28848,28849,28850,28851,
+		28852,28853,28854,28855,28856,28857,28858,28859,28860,28861,28862,28863,28864,28865,28866,28867,
+		25138,25228,25139,25229,25207,25509,25571,25312,25230,25190,25140,25150,25208,25860,25861,25862,
+		25863,25864,25865,25866,25867,25868,25869,25870,25871,25872,25873,25874,25875,25876,25877,25878,
+		25879,25880,25881,25882,25883,25884,25885,25886,25887,25888,25889,25890,25891,25892,25893,25894,
+		25895,25896,25964,25965,25966,25967,32098,32099,32100,32101,32102,32103,25968,25969,25970,25684,
+		25685,25244,25245,25240,25241,25601,25602,25603,25604,25690,25248,25313,25302,25303,25304,25305,
+		25306,25307,25186,25259,25260,25308,25309,25310,25311,25691,25692,25693,25261,25262,25263,26011,
+		26012,26013,25614,25615,25264,25209,25897,25818,25819,25265,58625,1638,25910,25911,25912,25913,
+		25914,25915,25916,25917,25918,25919,25920,25921,25922,25923,25924,25925,25490,25491,25909,62977,
+		547,62977,566,62977,658,62977,576,62977,570,62977,615,62977,621,62977,908,62977,
+		909,54785,638,54785,638,62977,638,54785,638,62977,638,62977,534,62977,533,62977,
+		523,62977,808,62977,809,62977,812,62977,813,62977,906,62977,907,62977,904,62977,
+		905,62977,898,62977,899,62977,896,62977,897,62977,900,62977,901,62977,902,62977,
+		903,25143,25144,62977,810,62977,811,58369,522,58369,523,61185,547,61185,566,61185,
+		638,61185,570,61185,576,61185,621,61185,615,61185,534,61185,808,61185,809,61185,
+		812,61185,813,61185,906,61185,907,61185,940,61185,937,61185,929,61185,1638,61185,
+		525,61185,1642,61185,1644,61185,1643,61185,935,61185,941,61185,928,58113,615,58113,
+		797,58113,940,58113,941,58113,937,58113,790,58113,808,58113,809,58113,929,58113,
+		1638,58113,547,58113,525,58113,638,58113,934,58113,576,58113,570,58113,1642,58113,
+		1643,58113,1644,58113,621,58113,928,58113,810,58113,935,58113,811,58113,1207,58113,
+		523,58113,1204,58113,812,58113,1646,58113,813,58113,1648,58113,830,58113,831,61953,
+		658,61953,900,61953,901,61953,566,61953,545,58113,1645,58113,1208,58113,1647,61953,
+		2155,61953,1516,61953,1518,61953,1517,61953,1519,61953,2313,61953,2356,32085,25355,25356,
+		25357,32190,32191,32192,32193,32194,32195,32196,32197,32198,32199,32200,32201,32202,32203,32204,
+		32205,32206,32207,32208,32209,32210,32211,32212,32213,32214,32215,32216,32217,32218,32219,32220,
+		32221,32222,32223,32224,32225,28868,28869,28870,28871,28872,28873,28874,28875,28876,32226,32227,
+		32228,32229,32230,32231,32232,32233,32234,32235,32236,32237,32238,32239,32240,32241,32242,32243,
+		32244,32245,32246,32247,32248,32249,32250,32251,32252,32253,32254,32255,32256,32257,32258,32259,
+		32260,32261,32262,32263,32264,32265,32266,32267,32268,32269,28877,28878,28879,28880,28881,28882,
+		28883,28884,28885,28886,28887,28888,28889,28890,28891,28892,28893,32270,28894,28895,28896,28897,
+		28898,28899,28900,28901,28902,28903,28904,28905,28906,28907,28908,28909,28910,28911,28912,28913,
+		28914,28915,28916,28917,28918,28919,28920,28921,28922,28923,28924,28925,28926,28927,28928,28929,
+		28930,28931,28932,28933,28934,28935,28936,28937,28938,28939,28940,28941,28942,28943,28944,28945,
+		28946,28947,28948,28949,28950,28951,28952,28953,28954,28955,32271,32272,32273,32274,32275,32276,
+		32277,32278,32279,32280,32281,32282,32283,32284,32285,32286,32287,32288,32184,32185,25358,25359,
+		32289,32290,32291,25694,25314,32307,32308,32309,32310,32311,28956,28957,32292,32293,32294,32295,
+		32296,32297,32298,32299,32304,32305,32306,25360,25354,32555,32544,32501,32502,32503,32504,32505,
+		32506,32507,32508,32509,32510,32511,32512,32513,32514,32515,32516,32517,32518,32519,32520,32521,
+		32522,32523,32524,32525,32526,32527,32528,32529,32530,32531,32532,32533,32534,32535,32536,32537,
+		32538,32539,32540,32541,32542,32543,32545,32546,32547,32548,32549,32550,32551,32552,32553,32554,
+		32350,32351,32352,32353,32354,25700,25701,25702,25703,25704,25705,25266,25267,25706,32300,32301,
+		32302,32303,32312,32313,32314,25711,25712,25713,25714,25715,25716,25717,25710,25315,25316,25317,
+		25318,25319,25320,32315,32316,32317,32318,32319,32320,32321,32322,25718,25719,25720,25721,32323,
+		32324,32325,32186,32187,32188,32189,32161,32162,32163,32164,32165,32166,32167,32168,32169,32170,
+		32171,32172,32173,32174,32175,32176,32177,32178,32179,32180,32181,32182,25122,32326,32327,32328,
+		32329,32330,32331,32332,32333,25321,25322,25323,25324,25325,32334,32335,32336,25268,25269,25695,
+		25696,25697,25698,25699,32339,32340,32341,32342,32343,32344,32345,32346,32347,32348,32349,25722,
+		25723,25326,25327,25270,25271,25328,25272,25273,25210,25724,25725,25274,25275,25727,25329,25726,
+		25728,25729,25330,25331,32365,32366,32367,32368,32369,32370,32371,32372,32373,32374,32375,25276,
+		25277,25730,25731,25732,25733,25332,25278,25279,25734,25736,25737,25735,25738,25739,25740,25741,
+		25280,25281,25742,25743,25744,25745,25746,25747,25748,25749,25750,25751,25752,25753,25754,25755,
+		25756,25757,25758,25759,25760,25761,25282,25283,25762,25587,25588,25589,25590,25591,25592,25593,
+		25594,25595,25596,25597,25598,25599,32337,32338,25284,25285,25333,26014,25763,32376,32377,32378,
+		32379,32380,32381,32382,32383,32384,25286,25764,25334,25765,25638,25639,25640,25641,25642,25643,
+		25644,25645,25646,25647,25648,25649,25650,25651,25652,25653,25287,25288,25707,25708,25709,32355,
+		32356,32357,32358,32359,32360,32361,32362,32363,32364,25654,25655,25335,25336,32107,32108,32109,
+		32110,32111,32112,32113,32114,32115,32116,32117,32118,32119,32120,32121,32122,32123,32124,32125,
+		32126,32127,25936,25937,25938,25939,25940,25941,25942,25943,25944,25945,25946,25947,25948,25949,
+		25950,25951,25952,25953,25954,25955,25956,25957,25958,25959,25960,25766,32556,32557,32558,32559,
+		32560,32561,32562,32563,32564,32565,32566,32567,32568,32569,32570,32571,32572,25361,25362,25363,
+		25364,25365,25289,25290,25231,25767,25768,25769,25770,25771,28958,28959,28960,28961,25772,28962,
+		32385,32386,32387,32388,32389,32390,32391,32392,32393,32394,32395,32396,32397,32398,32399,32400,
+		32401,25141,25232,25773,25774,25145,29460,25233,28964,28965,28966,28967,28968,28969,28970,28971,
+		28972,28973,28974,28975,28976,28977,28978,28979,28980,28981,28982,28983,28984,28985,28986,28987,
+		28988,28989,28990,28991,28992,28993,28994,28995,28996,28997,28998,28999,29000,29001,29002,29003,
+		29004,29005,29006,29007,29008,29009,29010,29011,29012,29013,29014,29015,29016,29017,29018,29019,
+		29020,29021,29022,29023,29024,29025,29026,29027,29028,29029,29030,29031,29032,29033,29034,29035,
+		29036,29037,29038,29039,29040,29041,29042,29043,29044,29045,29046,29047,29048,29049,29050,29051,
+		29052,29053,29054,29055,29056,29057,29058,29059,29060,29061,29062,29063,29064,29065,29066,29067,
+		29068,29069,29070,29071,29072,29073,29074,29075,29076,29077,29078,29079,29080,29081,29082,29083,
+		29084,29085,29086,29087,29088,29089,29090,29091,29092,29093,29094,29095,29096,29097,29098,29099,
+		29100,29101,29102,29103,29104,29105,29106,29107,29108,29109,29110,29111,29112,29113,29114,29115,
+		29116,29117,29118,29119,29120,29121,29122,29123,29124,29125,29126,29127,29128,29129,29130,29131,
+		29132,29133,29134,29135,29136,29137,29138,29139,29140,29141,29142,29143,29144,29145,29146,29147,
+		29148,29149,29150,29151,29152,29153,29154,29155,29156,29157,29158,29159,29160,29161,29162,29163,
+		29164,29165,29166,29167,29168,29169,29170,29171,29172,29173,29174,29175,29176,29177,29178,29179,
+		29180,29181,29182,29183,29184,29185,29186,29187,29188,29189,29190,29191,29192,29193,29194,29195,
+		29196,29197,29198,29199,29200,29201,29202,29203,29204,29205,29206,29207,29208,29209,29210,29211,
+		29212,29213,29214,29215,29216,29217,29218,29219,29220,29221,29222,29223,29224,29225,29226,29227,
+		29228,29229,29230,29231,29232,29233,29234,29235,29236,29237,29238,29239,29240,29241,29242,29243,
+		29244,29245,29246,29247,29248,29268,29252,29253,29254,29255,29256,29257,29258,29259,29260,29261,
+		29262,29263,29264,29265,29266,29267,29269,29270,29271,29272,29273,29274,29275,29276,29277,29278,
+		29279,29280,29281,29282,29283,29284,29285,29286,29287,29288,29289,29290,29291,29292,29293,29294,
+		29295,29296,29297,29298,29299,29300,29301,29302,29303,29304,4722,57344,0,4723,57344,0,
+		4723,49152,0,57344,0,29305,29306,29307,29308,29309,29310,29311,29312,29313,29314,29315,
+		29316,29317,29318,29319,29320,29321,29322,29323,29324,29325,29326,29327,29328,29329,29330,29331,
+		29332,29333,29334,29335,29336,29337,29338,29339,29340,29341,29342,29343,29344,29345,29346,29347,
+		29348,29349,29350,29351,29352,4775,57344,0,4776,57344,0,4775,49152,0,57344,0,
+		4776,49152,0,57344,0,29353,29354,29355,29356,29357,29358,29359,29360,29361,29362,29363,
+		29364,29365,29366,29367,29368,29369,29370,29371,29372,29373,29374,29375,29376,29377,29378,29379,
+		29380,29381,29382,29383,29384,29385,29386,29387,29388,29389,29390,29391,29392,29393,29394,29395,
+		29396,29397,29398,29399,29400,29401,29402,29403,29404,29405,29406,29407,29408,29409,29410,29411,
+		29412,29413,29414,29415,29416,29417,29418,29419,29420,29421,29422,29423,29424,29425,29426,29427,
+		29428,29429,29430,29431,29432,29433,29434,29435,29436,29437,29438,29439,29440,29441,29442,29443,
+		29444,29445,29446,29447,29448,29449,29450,29451,29452,29453,29454,29455,29456,29457,29458,29459,
+		32402,32403,32404,32405,32406,32407,32408,32409,32410,32411,28726,28727,28728,28729,28730,28731,
+		28732,28733,28734,28735,28736,28737,28738,28739,28740,28741,28742,28743,28744,28745,28746,28747,
+		28748,28749,28750,28751,28752,28753,28754,28755,28756,28757,28758,28759,28760,28761,28762,28763,
+		28764,28765,28766,28767,28768,28769,28770,28771,28772,28773,28774,28775,28776,28777,28778,28779,
+		28780,28781,28782,28783,28784,28785,28786,28787,28788,28789,28790,28791,28792,28793,28794,28795,
+		28796,28797,28798,28799,28800,28801,28802,28803,28804,28805,28806,28807,28808,28809,28810,28811,
+		28812,32573,32574,32575,32576,32577,32578,32579,32580,32581,58625,1628,58625,1624,31487,31488,
+		31489,31490,31491,31492,31493,31494,31495,31496,31497,31498,31499,31500,31501,31502,31503,31504,
+		31505,31506,31507,31508,31509,31510,31511,31512,31513,31514,31515,31516,31517,31518,31519,31520,
+		31521,31522,31523,31524,31525,31526,31527,31528,31529,31530,31531,31532,31533,31534,31535,31536,
+		31537,31538,31539,31540,31541,31542,31543,31544,31545,31546,31547,31548,31549,31550,31551,31552,
+		31553,31554,31555,31556,31557,31558,31559,31560,31561,31562,31563,31564,31565,31566,31567,31568,
+		31569,31570,31571,31572,31573,31574,31575,31576,31577,31578,31579,31580,31581,31582,31583,31584,
+		31585,31586,31587,31588,31589,31590,31591,31592,31593,31594,31595,31596,31597,31598,31599,31600,
+		31601,31602,31603,31604,31605,31606,31607,31608,31609,31610,31611,31612,31613,31614,31615,31616,
+		31617,31618,31619,31620,31621,31622,31623,31624,31625,31626,31627,31628,31629,31630,31631,31632,
+		31633,31634,31635,31636,31637,31638,31639,31640,31641,31642,31643,31644,31645,31646,31647,31648,
+		31649,31650,31651,31652,31653,31654,31655,31656,31657,31658,31659,31660,31661,31662,31663,31664,
+		31665,31666,31667,31668,31669,31670,31671,31672,31673,31674,31675,31676,31677,31678,31679,31680,
+		31681,31682,31683,31684,31685,31686,31687,31688,31689,31690,31691,31692,31693,31694,31695,31696,
+		31697,31698,31699,31700,31701,31702,31703,31704,31705,31706,31707,31708,31709,31710,31711,31712,
+		31713,31714,31715,31716,31717,31718,31719,31720,31721,31722,31723,31724,31725,31726,31727,31728,
+		31729,31730,31731,31732,31733,31734,31735,31736,31737,31738,31739,31740,31741,31742,31743,31744,
+		31745,31746,31747,31748,31749,31750,31751,31752,31753,31754,31755,31756,31757,31758,31759,31760,
+		31761,31762,31763,31764,31765,31766,31767,31768,31769,31770,31771,31772,31773,31774,31775,31776,
+		31777,31778,31779,31780,31781,31782,31783,31784,31785,31786,31787,31788,31789,31790,31791,31792,
+		31793,31794,31795,31796,31797,31798,31799,31800,31801,31802,31803,31804,31805,31806,31807,31808,
+		31809,31810,31811,31812,31813,31814,31815,31816,31817,31818,31819,31820,31821,31822,31823,31824,
+		31825,31826,31827,31828,31829,31830,31831,31832,31833,31834,31835,31836,31837,31838,31839,31840,
+		31841,31842,31843,31844,31845,31846,31847,31848,31849,31850,31851,31852,31853,31854,31855,31856,
+		31857,31858,31859,31860,31861,31862,31863,31864,31865,31866,31867,31868,31869,31870,31871,31872,
+		31873,31874,31875,31876,31877,31878,31879,31880,31881,31882,31883,31884,31885,31886,31887,31888,
+		31889,31890,31891,31892,31893,31894,31895,31896,31897,31898,31899,31900,31901,31902,31903,31904,
+		31905,31906,31907,31908,31909,31910,31911,31912,31913,31914,31915,31916,31917,31918,31919,31920,
+		31921,31922,31923,31924,31925,31926,31927,31928,31929,31930,31931,31932,31933,31934,31935,31936,
+		31937,31938,31939,31940,31941,31942,31943,31944,31945,31946,31947,31948,31949,31950,31951,31952,
+		31953,31954,31955,31956,31957,31958,31959,31960,31961,31962,31963,31964,31965,31966,31967,31968,
+		31969,31970,31971,31972,31973,31974,31975,31976,31977,31978,31979,31980,31981,31982,31983,31984,
+		31985,31986,31987,31988,31989,31990,31991,31992,31993,31994,31995,31996,31997,31998,31999,32000,
+		32001,32002,32003,32004,32005,32006,32007,32008,32009,32010,32011,32012,32013,32014,32015,32016,
+		32017,32018,32019,32020,32021,32022,32023,32024,32025,32026,25775,25776,25777,25778,25779,28963,
+		25196,25211,32412,32413,32414,32415,32416,32417,32418,32419,32420,32421,32422,32423,32424,32425,
+		32426,32427,32428,32429,32430,32431,32432,32433,32434,32435,32436,32437,32438,32439,32440,32441,
+		32442,32443,32444,32445,32446,32447,32448,32449,32450,32451,32452,29461,32453,32454,32455,32456,
+		32457,32458,32459,32460,32461,32462,32463,32464,32465,32466,32467,32468,32469,32470,32471,32472,
+		32473,32474,32475,32476,32477,32478,32479,32480,32481,32482,32483,32484,32485,32486,32487,32488,
+		32489,32490,32491,32492,32493,29462,32494,32495,32496,32497,32498,32499,32500,25903,25904,29463,
+		29464,29465,29466,29467,29468,29469,29470,29471,29472,29473,29474,29475,29476,29477,29478,29479,
+		29480,29481,29482,29483,29484,29485,29486,29487,29488,29489,29490,29491,29492,29493,29494,29495,
+		29496,29497,29498,29499,29500,29501,29502,29503,29504,29505,29506,29507,29508,29509,29510,29511,
+		29512,29513,29514,29515,29516,29517,29518,29519,29520,29521,29522,29523,29524,29525,29526,29527,
+		29528,29529,29530,29531,29532,29533,29534,29535,29536,29537,29538,29539,29540,29541,29542,29543,
+		29544,29545,29546,29547,29548,29549,29550,29551,29552,29553,29554,29555,29556,29557,29558,29559,
+		29560,29561,29562,29563,29564,29565,29566,29567,29568,29569,29570,29571,29572,29573,29574,29575,
+		29576,29577,29578,29579,29580,29581,29582,29583,29584,29585,29586,29587,29588,29589,29590,29591,
+		29592,29593,29594,29595,29596,29597,29598,29599,29600,29601,29602,29603,29604,29605,29606,29607,
+		29608,29609,29610,29611,29612,29613,29614,29615,29616,29617,29618,29619,29620,29621,29622,29623,
+		29624,29625,29626,29627,29628,29629,29630,29631,29632,29633,29634,29635,29636,29637,29638,29639,
+		29640,29641,29642,29643,29644,29645,29646,29647,29648,29649,29650,29651,29652,29653,29654,29655,
+		29656,29657,29658,29659,29660,29661,29662,29663,29664,29665,29666,29667,29668,29669,29670,29671,
+		29672,29673,29674,29675,29676,29677,29678,29679,29680,29681,29682,29683,29684,29685,29686,29687,
+		29688,29787,29788,29789,26067,29790,29791,29792,26069,27426,27427,27428,27429,27430,27431,27432,
+		27433,27434,27435,27436,27437,27438,27439,27440,27441,27442,27443,27444,27445,27446,27447,27448,
+		27449,27450,27451,29793,29794,29795,29796,29797,29798,29799,29800,29801,29802,29803,29804,29805,
+		29806,29807,29808,29809,29810,29811,29812,29813,29814,29815,29816,29817,29818,29819,29820,29821,
+		29822,29823,29824,29825,29826,29827,29828,29829,29830,29831,29832,29833,29834,29835,29836,29837,
+		29838,29839,29840,29841,29842,29843,29844,29845,29846,29847,29848,29849,29850,29851,29852,29853,
+		29854,29855,29856,29857,29858,29859,29860,29861,29862,29863,29864,29865,29866,29867,29868,29869,
+		29870,29871,29872,29873,29874,29875,29876,29877,29878,29879,29880,29881,29882,29883,29884,29885,
+		29886,29887,29888,29889,29890,29891,29892,29893,29894,29895,29896,29897,29898,29899,29900,29901,
+		29902,29903,29904,29905,29906,29907,29908,29909,29910,29911,29912,29913,29914,29915,29916,29917,
+		29918,29919,29920,29921,29922,29923,29924,29925,29926,29927,29928,29929,29930,29931,29932,29933,
+		29934,29935,29936,29937,29938,29939,29940,29941,29942,29943,29944,29945,29946,29947,29948,29949,
+		29950,29951,29952,29953,29954,29955,29956,29957,29958,29959,29960,29961,29962,29963,29964,29965,
+		29966,29967,29968,29969,29970,29971,29972,29973,29974,29975,29976,29977,29978,29979,29980,29981,
+		29982,29983,29984,29985,29986,29987,29988,29989,29990,29991,29992,29993,29994,29995,29996,29997,
+		29998,29999,30000,30001,30002,30003,30004,30005,30006,30007,30008,30009,30010,30011,30012,30013,
+		30014,30015,30016,30017,30018,30019,30020,30021,30022,30023,30024,30025,30026,30027,30028,30029,
+		30030,30031,30032,30033,30034,30035,30036,30037,30038,30039,30040,30041,30042,30043,30044,30045,
+		30046,30047,30048,30049,30050,30051,30052,30053,30054,30055,30056,30057,30058,30059,30060,30061,
+		30062,30063,30064,30065,30066,30067,30068,30069,30070,30071,30072,30073,30074,30075,30076,30077,
+		30078,30079,30080,30081,30082,30083,30084,30085,30086,30087,30088,30089,30090,30091,30092,30093,
+		30094,30095,30096,30097,30098,30099,30100,30101,30102,30103,30104,30105,30106,30107,30108,30109,
+		30110,30111,30112,30113,30114,30115,30116,30117,30118,30119,30120,30121,30122,30123,30124,30125,
+		30126,30127,30128,30129,30130,30131,30132,30133,30134,30135,30136,30137,30138,30139,30140,30141,
+		30142,30143,30144,30145,30146,30147,30148,30149,30150,30151,30152,30153,30154,30155,30156,30157,
+		30158,30159,30160,30161,30162,30163,30164,30165,30166,30167,30168,30169,30170,30171,30172,30173,
+		30174,30175,30176,30177,30178,30179,30180,30181,30182,30183,30184,30185,30186,30187,30188,30189,
+		30190,30191,30192,30193,30194,30195,30196,30197,30198,30199,30200,30201,30202,30203,30204,30205,
+		30206,30207,30208,30209,30210,30211,30212,30213,30214,30215,30216,30217,30218,30219,30220,30221,
+		30222,30223,30224,30225,30226,30227,30228,30229,30230,30231,30232,30233,30234,30235,30236,30237,
+		30238,30239,30240,30241,30242,30243,30244,30245,30246,30247,30248,30249,30250,30251,30252,30253,
+		30254,30255,30256,30257,30258,30259,30260,30261,30262,30263,30264,30265,30266,30267,30268,30269,
+		30270,30271,30272,30273,30274,30275,30276,30277,30278,30279,30280,30281,30282,30283,30284,30285,
+		30286,30287,30288,30289,30290,30291,30292,30293,30294,30295,30296,30297,30298,30299,30300,30301,
+		30302,30303,30304,30305,30306,30307,30308,30309,30310,30311,30312,30313,30314,30315,30316,30317,
+		30318,30319,30320,30321,30322,30323,30324,30325,30326,30327,30328,30329,30330,30331,30332,30333,
+		30334,30335,30336,30337,30338,30339,30340,30341,30342,30343,30344,30345,30346,30347,30348,30349,
+		30350,30351,30352,30353,30354,30355,30356,30357,30358,30359,30360,30361,30362,30363,30364,30365,
+		30366,30367,30368,30369,30370,30371,30372,30373,30374,30375,30376,30377,30378,30379,30380,30381,
+		30382,30383,30384,30385,30386,30387,30388,30389,30390,30391,30392,30393,30394,30395,30396,30397,
+		30398,30399,30400,30401,30402,30403,30404,30405,30406,30407,30408,30409,30410,30411,30412,30413,
+		30414,30415,30416,30417,30418,30419,30420,30421,30422,30423,30424,30425,30426,30427,30428,30429,
+		30430,30431,30432,30433,30434,30435,30436,30437,30438,30439,30440,30441,30442,30443,30444,30445,
+		30446,30447,30448,30449,30450,30451,30452,30453,30454,30455,30456,30457,30458,30459,30460,30461,
+		30462,30463,30464,30465,30466,30467,30468,30469,30470,30471,30472,30473,30474,30475,30476,30477,
+		30478,30479,30480,30481,30482,30483,30484,30485,30486,30487,30488,30489,30490,30491,30492,30493,
+		30494,30495,30496,30497,30498,30499,30500,30501,30502,30503,30504,30505,30506,30507,30508,30509,
+		30510,30511,30512,30513,30514,30515,30516,30517,30518,30519,30520,30521,30522,30523,30524,30525,
+		30526,30527,30528,30529,30530,30531,30532,30533,30534,30535,30536,30537,30538,30539,30540,30541,
+		30542,30543,30544,30545,30546,30547,30548,30549,30550,30551,30552,30553,30554,30555,30556,30557,
+		30558,30559,30560,30561,30562,30563,30564,30565,30566,30878,30879,30880,30881,30882,30883,30884,
+		30885,30886,30887,30888,30889,30890,30891,30892,30893,30894,30895,30896,30897,30898,30899,30900,
+		30901,30902,30903,30904,30905,30906,30907,30908,30909,30910,30911,30912,30913,30914,30915,30916,
+		30917,30918,30919,30920,30921,30922,30923,30924,30925,30926,30927,30928,30929,30930,30931,30932,
+		30933,30934,30935,30936,30937,30938,30939,30940,30941,30942,30943,30944,30945,30946,30947,30948,
+		30949,30950,30951,30952,30953,30954,30955,30956,30957,30958,30959,30960,30961,30962,30963,30964,
+		30965,30966,30967,30968,30969,30970,30971,30972,30973,30974,30975,30976,30977,30978,30979,30980,
+		30981,30982,30983,30984,30985,30986,30987,30988,30989,30990,30991,30992,30993,30994,30995,30996,
+		30997,30998,30999,31000,31001,31002,31003,31004,31005,31006,31007,31008,31009,31010,31011,31012,
+		31013,31014,31015,31016,31017,31018,31019,31020,31021,31022,31023,31024,31025,31026,31027,31028,
+		31029,31030,31031,31032,31033,31034,31035,31036,31037,31038,31039,31040,31041,31042,31043,31044,
+		31045,31046,31047,31048,31049,31050,31051,31052,31053,31054,31055,31056,31057,31058,31059,31060,
+		31061,31062,31063,31064,31065,31066,31067,31068,31069,31070,31071,31072,31073,31074,31075,31076,
+		31077,31078,31079,31080,31081,31082,31083,31084,31085,31086,31087,31088,31089,31090,31091,31092,
+		31093,31094,31095,31096,31097,31098,31099,31100,31101,31102,31103,31104,31105,31106,31107,31108,
+		31109,31110,31111,31112,31113,31114,31115,31116,31117,31118,31119,31120,31121,31122,31123,31124,
+		31125,31126,31127,31128,31129,31130,31131,31132,31133,31134,31135,31136,31137,31138,31139,31140,
+		31141,31142,31143,31144,31145,31146,31147,31148,31149,31150,31151,31152,31153,31154,31155,31156,
+		31157,31158,31159,31160,31161,31162,31163,31164,31165,31166,31167,31168,31169,31170,31171,31172,
+		31173,31174,31175,31176,31177,31178,31179,31180,31181,31182,31183,31184,31185,31186,31187,31188,
+		31189,31190,31191,31192,31193,31194,31195,31196,31197,31198,31199,31200,31201,31202,31203,31204,
+		31205,31206,31207,31208,31209,31210,31211,31212,31213,31214,31215,31216,31217,31218,31219,31220,
+		31221,31222,31223,31224,31225,31226,31227,31228,31229,31230,31231,31232,31233,31234,31235,31236,
+		31237,31238,31239,31240,31241,31242,31243,31244,31245,31246,31247,31248,31249,31250,31251,31252,
+		31253,31254,31255,31256,31257,31258,31259,31260,31261,31262,31263,31264,31265,31266,31267,31268,
+		31269,31270,31271,31272,31273,31274,31275,31276,31277,31278,31279,31280,31281,31282,31283,31284,
+		31285,31286,31287,31288,31289,31290,31291,31292,31293,31294,31295,31296,31297,31298,31299,31300,
+		31301,31302,31303,31304,31305,31306,31307,31308,31309,31310,31311,31312,31313,31314,31315,31316,
+		31317,31318,31319,31320,31321,31322,31323,31324,31325,31326,31327,31328,31329,31330,31331,31332,
+		31333,31334,31335,31336,31337,31338,31339,31340,31341,31342,31343,31344,31345,31346,31347,31348,
+		31349,31350,31351,31352,31353,31354,31355,31356,31357,31358,31359,31360,31361,31362,31363,31364,
+		31365,31366,31367,31368,31369,31370,31371,31372,31373,31374,31375,31376,31377,31378,31379,31380,
+		31381,31382,31383,31384,31385,31386,31387,31388,31389,31390,31391,31392,31393,31394,31395,31396,
+		31397,31398,31399,31400,31401,31402,31403,31404,31405,31406,31407,31408,31409,31410,31411,31412,
+		31413,31414,31415,31416,31417,31418,31419,31420,31421,31422,31423,31424,31425,31426,31427,31428,
+		31429,31430,31431,31432,31433,31434,31435,31436,31437,31438,31439,31440,31441,31442,31443,31444,
+		31445,31446,31447,31448,31449,31450,31451,31452,31453,31454,31455,31456,31457,31458,31459,31460,
+		31461,31462,31463,31464,31465,31466,31467,31468,31469,31470,31471,31472,31473,31474,31475,31476,
+		31477,31478,31479,31480,31481,31482,31483,31484,31485,31486,30567,30568,30569,30570,30571,30572,
+		30573,30574,30575,30576,30577,30578,30579,30580,30581,30582,30583,30584,30585,30586,30587,30588,
+		30589,30590,30591,30592,30593,30594,30595,30596,30597,30598,30599,30600,30601,30602,30603,30604,
+		30605,30606,30607,30608,30609,30610,30611,30612,30613,30614,30615,30616,30617,30618,30619,30620,
+		30621,30622,30623,30624,30625,30626,30627,30628,30629,30630,30631,30632,30633,30634,30635,30636,
+		30637,30638,30639,30640,30641,30642,30643,30644,30645,30646,30647,30648,30649,30650,30651,30652,
+		30653,30654,30655,30656,30657,30658,30659,30660,30661,30662,30663,30664,30665,30666,30667,30668,
+		30669,30670,30671,30672,30673,30674,30675,30676,30677,30678,30679,30680,30681,30682,30683,30684,
+		30685,30686,30687,30688,30689,30690,30691,30692,30693,30694,30695,30696,30697,30698,30699,30700,
+		30701,30702,30703,30704,30705,30706,30707,30708,30709,30710,30711,30712,30713,30714,30715,30716,
+		30717,30718,30719,30720,30721,30722,30723,30724,30725,30726,30727,30728,30729,30730,30731,30732,
+		30733,30734,30735,30736,30737,30738,30739,30740,30741,30742,30743,30744,30745,30746,30747,30748,
+		30749,30750,30751,30752,30753,30754,30755,30756,30757,30758,30759,30760,30761,30762,30763,30764,
+		30765,30766,30767,30768,30769,30770,30771,30772,30773,30774,30775,30776,30777,30778,30779,30780,
+		30781,30782,30783,30784,30785,30786,30787,30788,30789,30790,30791,30792,30793,30794,30795,30796,
+		30797,30798,30799,30800,30801,30802,30803,30804,30805,30806,30807,30808,30809,30810,30811,30812,
+		30813,30814,30815,30816,30817,30818,30819,30820,29689,29690,29691,29692,29693,29694,29695,29696,
+		29697,29698,29699,29700,29701,29702,29703,29704,29705,29706,29707,29708,29709,29710,29711,29712,
+		29713,29714,29715,29716,29717,29718,29719,29720,29721,29722,29723,29724,29725,29726,29727,29728,
+		29729,29730,29731,29732,29733,29734,29735,29736,29737,29738,29739,29740,29741,29742,29743,29744,
+		29745,29746,29747,29748,29749,29750,29751,29752,29753,29754,29755,29756,29757,29758,29759,29760,
+		29761,29762,29763,29764,29765,29766,29767,29768,29769,29770,29771,29772,29773,29774,29775,29776,
+		29777,29778,29779,29780,29781,29782,29783,29784,29785,29786,30821,30822,30823,30824,30825,30826,
+		30827,30828,30829,30830,30831,30832,30833,30834,30835,30836,30837,30838,30839,30840,30841,30842,
+		30843,30844,30845,30846,30847,30848,30849,30850,30851,30852,30853,30854,30855,30856,30857,30858,
+		30859,30860,30861,30862,30863,30864,30865,30866,30867,30868,30869,30870,30871,30872,30873,30874,
+		30875,30876,30877,26985,26986,26987,26988,26989,26990,26991,26992,26993,26994,26995,26996,26997,
+		26998,26999,27000,27001,27002,27003,27004,27005,27006,27007,27008,27009,27010,27011,27012,27013,
+		27014,27015,27016,27017,27018,27019,27020,27021,27022,27023,27024,27025,27026,27027,27028,27029,
+		27030,27031,27032,27033,27034,27035,27036,27037,27038,27039,27040,27041,27042,27043,27044,27045,
+		27046,27047,27048,27049,27050,27051,27052,27053,27054,27055,27056,27057,27058,27059,27060,27061,
+		27062,27063,27064,27065,27066,27067,27068,27069,27070,27071,27072,27073,27074,27075,27076,27077,
+		27078,27079,27080,27081,27082,27083,27084,27085,27086,27087,27088,27089,27090,27091,27092,27093,
+		27094,27095,27096,27097,27098,27099,27100,27101,27102,27103,27104,27105,27106,27107,27108,27109,
+		27110,27111,27112,27113,27114,27115,27116,27117,27118,27119,27120,27121,27122,27123,27124,27125,
+		27126,27127,27128,27129,27130,27131,27132,27133,27134,27135,27136,27137,27138,27139,27140,27141,
+		27142,27143,27144,27145,27146,27147,27148,27149,27150,27151,27152,27153,27154,27155,27156,27157,
+		27158,27159,27160,27161,27162,27163,27164,27165,27166,27167,27168,27169,27170,27171,27172,27173,
+		27174,27175,27176,27177,27178,27179,27180,27181,27182,27183,27184,27185,27186,57858,0,57859,
+		0,57860,0,57861,0,57862,0,57863,0,57864,0,57865,0,57866,0,57867,
+		0,57868,0,49676,0,57861,0,57869,0,57870,0,57871,0,57872,0,57873,
+		0,57874,0,57875,0,57876,0,57877,0,57878,0,57879,0,57880,0,61976,
+		0,57881,0,61977,0,57882,0,57883,0,57884,0,57885,0,57886,0,57887,
+		0,57888,0,57889,0,57890,0,57891,0,57892,0,57893,0,57894,0,57895,
+		0,57896,0,57897,0,57898,0,57899,0,57900,0,57901,0,57902,0,57903,
+		0,57904,0,57905,0,57906,0,57907,0,57908,0,57909,0,57910,0,57911,
+		0,57912,0,57913,0,57914,0,57915,0,57916,0,57917,0,57918,0,57919,
+		0,57920,0,57921,0,57922,0,57923,0,57924,0,57925,0,57926,0,57927,
+		0,57928,0,57929,0,57930,0,57931,0,57932,0,57933,0,57934,0,63566,
+		0,64078,0,57935,0,57936,0,57937,0,64081,0,55889,0,64097,0,57938,
+		0,57939,0,57940,0,64084,0,55892,0,64097,0,57941,0,57942,0,57943,
+		0,63575,0,64087,0,55383,0,63585,0,55895,0,64097,0,57944,0,57945,
+		0,57946,0,57947,0,63579,0,64091,0,55387,0,63585,0,55899,0,64097,
+		0,57948,0,57949,0,57950,0,63582,0,64094,0,55390,0,63585,0,55902,
+		0,64097,0,57951,0,57952,0,57953,0,63585,0,64097,0,55905,0,64121,
+		0,57954,0,63586,0,64098,0,57955,0,57956,0,57957,0,57958,0,57959,
+		0,57960,0,57961,0,57962,0,57963,0,57964,0,57965,0,57966,0,57967,
+		0,57968,0,57969,0,57970,0,57971,0,57972,0,57973,0,57974,0,57975,
+		0,57976,0,57977,0,57978,0,57979,0,57980,0,57981,0,57982,0,57983,
+		0,57984,0,57985,0,57986,0,57987,0,57988,0,57989,0,57990,0,57991,
+		0,57992,0,57993,0,57994,0,57995,0,57996,0,57997,0,57998,0,57999,
+		0,58000,0,58001,0,58002,0,58003,0,58004,0,58005,0,58006,0,58007,
+		0,58008,0,58009,0,58010,0,58011,0,58012,0,58013,0,58014,0,58015,
+		0,58016,0,58017,0,58018,0,58019,0,58020,0,58021,0,58022,0,58023,
+		0,58024,0,58025,0,58026,0,58027,0,58028,0,58029,0,58030,0,58031,
+		0,58032,0,58033,0,58034,0,58035,0,58036,0,58037,0,58038,0,58039,
+		0,58040,0,58041,0,58042,0,49151,58043,0,58044,0,58045,0,58046,0,
+		58047,0,58048,0,49151,58049,0,58050,0,58051,0,58052,0,58053,0,58054,
+		0,58055,0,58056,0,58057,0,58058,0,58059,0,58060,0,58061,0,58062,
+		0,58063,0,58064,0,58065,0,58066,0,58067,0,58068,0,58069,0,58070,
+		0,58071,0,58072,0,58073,0,58074,0,58075,0,58076,0,58077,0,58078,
+		0,58079,0,58080,0,58081,0,58082,0,58083,0,58084,0,58085,0,58086,
+		0,58087,0,58088,0,58089,0,58090,0,58091,0,58092,0,58093,0,58094,
+		0,58095,0,58096,0,58097,0,58098,0,58099,0,58100,0,58101,0,58102,
+		0,58103,0,58104,0,32582,32583,32584,32585,32586,32587,32588,32589,32590,32591,32592,
+		32593,32594,32595,32596,32597,32598,32599,32600,32601,32602,32603,32604,8028,57880,0,32605,
+		8029,57880,0,32606,32607,8031,57880,0,32608,61953,8032,32609,8033,57880,0,32610,
+		32611,58113,8035,32612,58113,8036,61185,8036,32613,58113,8037,32614,58113,8038,32615,32616,
+		32617,32618,32619,32620,32621,32622,32623,32624,32625,32626,32627,32628,32629,32630,32631,32632,
+		32633,32634,32635,32636,32637,32638,32639,32640,58113,8064,32641,32642,32643,32644,32645,32646,
+		32647,32648,32649,32650,32651,32652,32653,32654,32655,32656,32657,32658,32659,32660,32661,32662,
+		32663,32664,58113,8088,58369,8088,50177,8088,58369,638,50177,8088,58369,547,58625,8088,
+		58881,8088,62465,8088,62721,8088,56833,8088,56833,1654,65025,8091,50177,8088,50177,64320,
+		57344,61625,32665,58113,8089,58369,8089,50177,808,50177,8089,58369,809,50177,8089,58369,
+		638,50177,8089,58369,547,58625,8089,58881,8089,62465,8089,62721,8089,56833,8089,65025,
+		1654,50177,8089,58617,0,50177,808,50177,8089,50177,8088,58369,809,50177,8089,50177,
+		8088,58369,638,50689,8089,58881,8088,50177,8089,50177,8088,50177,64320,57344,58853,50177,
+		8089,50177,8088,50177,64320,57344,59144,50177,8089,50177,8088,50177,64320,57344,61625,50177,
+		808,50177,8089,50177,8089,58369,809,50177,8089,50177,8089,58369,638,50689,8089,58881,
+		8089,56833,8089,56833,1654,56833,8089,65025,8088,50177,8089,50177,8089,50177,64320,57344,
+		58853,50177,8089,50177,8089,50177,64320,57344,59144,50177,8089,50177,8089,50177,64320,57344,
+		61625,50177,808,50177,8089,50177,8090,58369,809,50177,8089,50177,8090,58369,638,50689,
+		8089,58881,8090,56833,8089,56833,1654,65025,8090,56321,8089,56321,8090,56321,8088,64769,
+		8555,50177,8089,50177,8090,50177,64320,57344,58853,50177,8089,50177,8090,50177,64320,57344,
+		59144,50177,8089,50177,8090,50177,64320,57344,61625,50177,808,50177,8089,50177,8091,58369,
+		809,50177,8089,50177,8091,58369,638,50689,8089,58881,8091,56833,8089,56833,1654,65025,
+		8091,50177,8089,50177,8091,50177,64320,57344,58853,50177,8089,50177,8091,50177,64320,57344,
+		61625,50177,808,50177,8089,50177,8092,58369,809,50177,8089,50177,8092,58369,638,50689,
+		8089,58881,8092,56833,8089,56833,1654,65025,8092,50177,8089,50177,8092,50177,64320,57344,
+		58853,50177,8089,50177,8092,50177,64320,57344,61625,50177,808,50177,8089,50177,8093,58369,
+		809,50177,8089,50177,8093,58369,638,50689,8089,58881,8093,56833,8089,56833,1654,65025,
+		8093,50177,8089,50177,8093,50177,64320,57344,58853,50177,8089,50177,8093,50177,64320,57344,
+		61625,50177,808,50177,8089,50177,8094,58369,809,50177,8089,50177,8094,58369,638,50689,
+		8089,58881,8094,56833,8089,56833,1654,65025,8094,50177,8089,50177,8094,50177,64320,57344,
+		58853,50177,8089,50177,8094,50177,64320,57344,61625,50177,808,50177,8089,50177,8095,58369,
+		809,50177,8089,50177,8095,58369,638,50689,8089,58881,8095,56833,8089,56833,1654,65025,
+		8095,50177,8089,50177,8095,50177,64320,57344,58853,50177,8089,50177,8095,50177,64320,57344,
+		61625,50177,808,50177,8089,50177,8096,58369,809,50177,8089,50177,8096,58369,638,50689,
+		8089,58881,8096,56833,8089,56833,1654,65025,8096,50177,8089,50177,8096,50177,64320,57344,
+		58853,50177,8089,50177,8096,50177,64320,57344,61625,50177,808,50177,8089,50177,8097,58369,
+		809,50177,8089,50177,8097,58369,638,50689,8089,58881,8097,56833,8089,56833,1654,65025,
+		8097,50177,8089,50177,8097,50177,64320,57344,58853,50177,8089,50177,8097,50177,64320,57344,
+		61625,50177,8089,50177,64320,57344,58853,50177,8089,50177,64320,57344,59144,50177,8089,50177,
+		64320,57344,61625,32666,58113,8090,58369,8090,50177,808,50177,8090,58369,809,50177,8090,
+		58369,638,50177,8090,58369,547,58625,8090,58881,8090,62465,8090,62721,8090,50177,8090,
+		58617,0,50177,808,50177,8090,50177,8088,58369,809,50177,8090,50177,8088,58369,638,
+		50689,8090,58881,8088,50177,8090,50177,8088,50177,64320,57344,58853,50177,8090,50177,8088,
+		50177,64320,57344,61625,50689,8090,58881,8089,50177,8090,50177,8089,50177,64320,57344,58853,
+		50177,8090,50177,8089,50177,64320,57344,61625,50689,8090,58881,8090,56321,8090,56321,8090,
+		56321,638,64513,8090,50177,8090,50177,8090,50177,64320,57344,58853,50177,8090,50177,8090,
+		50177,64320,57344,61625,50689,8090,58881,8091,56833,8090,56833,1654,65025,8091,50177,8090,
+		50177,8091,50177,64320,57344,58853,50177,8090,50177,8091,50177,64320,57344,61625,50689,8090,
+		58881,8092,50177,8090,50177,8092,50177,64320,57344,58853,50177,8090,50177,8092,50177,64320,
+		57344,61625,50689,8090,58881,8093,56833,8090,56833,1654,65025,8093,50177,8090,50177,8093,
+		50177,64320,57344,58853,50689,8090,58881,8094,50177,8090,50177,8094,50177,64320,57344,58853,
+		50689,8090,58881,8095,50177,8090,50177,8095,50177,64320,57344,58853,50689,8090,58881,8096,
+		50177,8090,50177,8096,50177,64320,57344,58853,50689,8090,58881,8097,50177,8090,50177,8097,
+		50177,64320,57344,58853,56321,8090,64769,8388,56321,8090,56321,8472,56321,8171,56321,521,
+		56577,8658,56321,8150,64513,8595,50177,8090,50177,64320,57344,58853,50177,8090,50177,64320,
+		57344,59144,50177,8090,50177,64320,57344,61625,32667,58113,8091,58369,8091,50177,808,50177,
+		8091,58369,809,50177,8091,58369,638,50177,8091,58369,547,58625,8091,58881,8091,62465,
+		8091,62721,8091,8091,58105,0,50177,8091,58617,0,50689,8091,58881,8088,50177,8091,
+		50177,8088,50177,64320,57344,58853,50689,8091,58881,8089,50177,8091,50177,8089,50177,64320,
+		57344,58853,50689,8091,58881,8090,50689,8091,58881,8091,50689,8091,58881,8092,56833,8091,
+		56833,1654,65025,8092,50689,8091,58881,8093,56833,8091,56833,1654,65025,8093,50689,8091,
+		58881,8094,50689,8091,58881,8095,50689,8091,58881,8096,56833,8091,56833,1654,65025,8096,
+		50689,8091,58881,8097,56321,8091,64769,8171,50177,8091,50177,64320,57344,58853,50177,8091,
+		50177,64320,57344,59144,50177,8091,50177,64320,57344,61625,32668,58113,8092,58369,8092,50177,
+		808,50177,8092,58369,809,50177,8092,58369,638,50177,8092,58369,547,58625,8092,58881,
+		8092,62465,8092,62721,8092,50177,8092,58617,0,50689,8092,58881,8088,50689,8092,58881,
+		8089,50689,8092,58881,8090,50689,8092,58881,8091,50689,8092,58881,8092,50689,8092,58881,
+		8093,56833,8092,56833,1654,65025,8093,50689,8092,58881,8094,50689,8092,58881,8095,50689,
+		8092,58881,8096,50689,8092,58881,8097,56321,8092,64769,8388,50177,8092,50177,64320,57344,
+		58853,50177,8092,50177,64320,57344,59144,50177,8092,50177,64320,57344,61625,32669,58113,8093,
+		58369,8093,50177,808,50177,8093,58369,809,50177,8093,58369,638,50177,8093,58369,547,
+		58625,8093,58881,8093,62465,8093,62721,8093,50177,8093,58617,0,50689,8093,58881,8088,
+		56321,8093,56321,638,64513,8089,56833,8093,56833,1654,65025,8094,56833,8093,56833,1654,
+		65025,8096,50177,8093,50177,64320,57344,58853,50177,8093,50177,64320,57344,59144,50177,8093,
+		50177,64320,57344,61625,32670,58113,8094,58369,8094,50177,808,50177,8094,58369,809,50177,
+		8094,58369,638,50177,8094,58369,547,58625,8094,58881,8094,62465,8094,62721,8094,50177,
+		8094,58617,0,50689,8094,58881,8088,56321,8094,56321,8088,64769,8555,50177,8094,50177,
+		64320,57344,58853,50177,8094,50177,64320,57344,59144,50177,8094,50177,64320,57344,61625,32671,
+		58113,8095,58369,8095,50177,808,50177,8095,58369,809,50177,8095,58369,638,50177,8095,
+		58369,547,58625,8095,58881,8095,62465,8095,62721,8095,50177,8095,58617,0,50689,8095,
+		58881,8088,56321,8095,56321,638,64513,8089,56833,8095,56833,1654,65025,8096,50177,8095,
+		50177,64320,57344,58853,50177,8095,50177,64320,57344,59144,50177,8095,50177,64320,57344,61625,
+		32672,58113,8096,58369,8096,50177,808,50177,8096,58369,809,50177,8096,58369,638,50177,
+		8096,58369,547,58625,8096,58881,8096,62465,8096,62721,8096,50177,8096,58617,0,50689,
+		8096,58881,8088,56321,8096,64769,8388,50177,8096,50177,64320,57344,58853,50177,8096,50177,
+		64320,57344,59144,50177,8096,50177,64320,57344,61625,32673,58113,8097,58369,8097,50177,808,
+		50177,8097,58369,809,50177,8097,58369,638,50177,8097,58369,547,58625,8097,58881,8097,
+		62465,8097,62721,8097,50177,8097,58617,0,50177,8097,50177,64320,57344,58853,50177,8097,
+		50177,64320,57344,59144,50177,8097,50177,64320,57344,61625,32674,58113,8098,58369,8098,50177,
+		808,50177,8098,58369,809,58625,8098,58881,8098,59393,8098,59649,8098,50177,808,51713,
+		8098,58369,809,60161,8098,60417,8098,62465,8098,62721,8098,64769,8098,8098,57861,0,
+		51201,8098,57861,0,8098,57862,0,51201,8098,57862,0,8098,57863,0,51201,8098,
+		57863,0,8098,49671,0,57861,0,51201,8098,49671,0,57861,0,8098,49671,0,
+		57862,0,51201,8098,49671,0,57862,0,8098,49671,0,57870,0,51201,8098,49671,
+		0,57870,0,8098,49671,0,57884,0,51201,8098,49671,0,57884,0,8098,57864,
+		0,51201,8098,57864,0,8098,49672,0,57861,0,51201,8098,49672,0,57861,0,
+		8098,49672,0,57862,0,51201,8098,49672,0,57862,0,8098,49672,0,57870,0,
+		51201,8098,49672,0,57870,0,8098,49672,0,57884,0,51201,8098,49672,0,57884,
+		0,8098,57865,0,51201,8098,57865,0,8098,57866,0,51201,8098,57866,0,8098,
+		49674,0,57861,0,51201,8098,49674,0,57861,0,8098,57868,0,50177,8098,58380,
+		0,51201,8098,57868,0,51713,8098,58380,0,8098,49676,0,57875,0,51201,8098,
+		49676,0,57875,0,8098,57870,0,51201,8098,57870,0,8098,57871,0,51201,8098,
+		57871,0,8098,49679,0,57875,0,51201,8098,49679,0,57875,0,8098,57874,0,
+		51201,8098,57874,0,8098,57875,0,51201,8098,57875,0,8098,57884,0,51201,8098,
+		57884,0,8098,57885,0,51201,8098,57885,0,8098,57887,0,51201,8098,57887,0,
+		8098,57891,0,51201,8098,57891,0,8098,49699,0,57863,0,51201,8098,49699,0,
+		57863,0,8098,49699,0,57864,0,51201,8098,49699,0,57864,0,8098,57893,0,
+		51201,8098,57893,0,50177,8098,58617,0,50177,8098,58369,8098,51713,8098,59905,8098,
+		56577,8098,64769,8124,50177,8098,50177,934,58369,8150,50177,8098,50425,0,58369,8199,
+		51713,8098,50425,0,59905,8199,54273,8098,54521,0,62465,8199,50177,8098,50425,0,
+		50177,8199,57861,0,51713,8098,50425,0,51713,8199,57861,0,50177,8098,50425,0,
+		50177,8199,57875,0,51713,8098,50425,0,51713,8199,57875,0,56321,8098,56321,638,
+		56321,8457,64513,638,56577,8098,56321,1653,64513,8457,50177,8098,58369,8508,51713,8098,
+		59905,8508,50177,8098,50177,934,58369,8658,51713,8098,50177,934,59905,8658,50177,8098,
+		58369,8727,51713,8098,59905,8727,56577,8098,64769,8727,50177,8098,58369,8775,51713,8098,
+		59905,8775,50177,8098,50425,0,58369,8775,51713,8098,50425,0,59905,8775,50177,8098,
+		58369,8816,51713,8098,59905,8816,50177,8098,58369,8933,32678,32679,59393,8103,32680,32681,
+		59393,8105,32682,32683,62465,8107,32684,32685,59393,8109,62465,8109,32689,58369,8113,59393,
+		8113,62465,8113,32693,32694,32695,59393,8119,62465,8119,32699,32700,58113,8124,58369,8124,
+		50177,808,50177,8124,58369,809,58625,8124,58881,8124,59393,8124,59649,8124,50177,808,
+		51713,8124,58369,809,60161,8124,60417,8124,62465,8124,64769,8124,8124,57871,0,51201,
+		8124,57871,0,8124,57891,0,51201,8124,57891,0,8124,57898,0,51201,8124,57898,
+		0,56321,8124,56321,8098,64513,8595,56577,8124,64513,8576,32704,32708,59393,8132,32712,
+		32713,32714,32715,59393,8139,32716,32717,59393,8141,32721,59393,8145,32725,58369,8149,59393,
+		8149,32726,58113,8150,58369,8150,50177,808,50177,8150,58369,809,58625,8150,58881,8150,
+		59393,8150,59649,8150,50177,1322,59905,8150,59905,8150,50177,808,51713,8150,58369,809,
+		60161,8150,60417,8150,62465,8150,64769,8150,8150,57861,0,51201,8150,57861,0,8150,
+		57864,0,51201,8150,57864,0,8150,57865,0,51201,8150,57865,0,8150,57871,0,
+		51201,8150,57871,0,8150,57873,0,50177,8150,58385,0,51201,8150,57873,0,8150,
+		49681,0,57861,0,51201,8150,49681,0,57861,0,56321,8150,56321,8098,64513,8406,
+		56321,8150,64513,8150,52225,8150,60417,8171,56321,8150,64513,8171,56577,8150,56321,1653,
+		56321,8388,64513,8273,56577,8150,64769,8406,56321,8150,64513,8457,56321,8150,56321,8457,
+		64513,8090,56321,8150,56321,8457,64513,8091,50177,8150,50177,934,58369,8508,56577,8150,
+		56321,8508,64513,638,56577,8150,56577,8508,56577,8508,64769,8406,50177,8150,50177,934,
+		58369,8727,32730,32731,59393,8155,32735,59393,8159,32736,59393,8160,32737,59393,8161,32741,
+		62465,8165,32745,59393,8169,32746,59393,8170,32747,58113,8171,58369,8171,50177,808,50177,
+		8171,58369,809,58625,8171,58881,8171,59393,8171,59649,8171,59905,8171,50177,808,51713,
+		8171,58369,809,60161,8171,60417,8171,62465,8171,64513,8171,64769,8171,8171,57865,0,
+		51201,8171,57865,0,8171,57871,0,51201,8171,57871,0,8171,57873,0,51201,8171,
+		57873,0,8171,57882,0,51201,8171,57882,0,8171,57891,0,51201,8171,57891,0,
+		8171,57895,0,51201,8171,57895,0,8171,57898,0,51201,8171,57898,0,50177,8171,
+		58617,0,51713,8171,58617,0,54273,8171,62713,0,50177,8171,58618,0,51713,8171,
+		58618,0,56321,8171,64513,8098,50177,8171,58369,8124,56321,8171,64769,8124,56577,8171,
+		64769,8363,56321,8171,64513,8406,56321,8171,64513,8457,56321,8171,56321,8457,64513,8090,
+		56321,8171,56321,8457,64513,8091,50177,8171,58369,8838,51713,8171,58369,8838,51713,8171,
+		59905,8838,50177,8171,50177,8838,58377,0,51713,8171,50177,8838,58377,0,51713,8171,
+		51713,8838,58377,0,50177,8171,58369,8853,50177,8171,58369,8857,50177,8171,58369,8867,
+		32751,32752,32753,59393,8177,32754,32755,32756,59393,8180,32760,59393,8184,32764,32765,59393,
+		8189,32769,32773,32774,32775,58113,8199,58369,8199,50177,808,50177,8199,58369,809,58625,
+		8199,58881,8199,59393,8199,59649,8199,50177,808,51713,8199,58369,809,60161,8199,60417,
+		8199,62465,8199,62721,8199,64769,8199,8199,57861,0,51201,8199,57861,0,8199,57862,
+		0,51201,8199,57862,0,8199,57863,0,51201,8199,57863,0,8199,57864,0,51201,
+		8199,57864,0,8199,49672,0,57861,0,51201,8199,49672,0,57861,0,8199,49672,
+		0,57862,0,51201,8199,49672,0,57862,0,8199,49672,0,57870,0,51201,8199,
+		49672,0,57870,0,8199,49672,0,57884,0,51201,8199,49672,0,57884,0,8199,
+		57865,0,51201,8199,57865,0,8199,57868,0,51201,8199,57868,0,8199,57870,0,
+		51201,8199,57870,0,8199,57871,0,51201,8199,57871,0,8199,57873,0,51201,8199,
+		57873,0,8199,49681,0,57863,0,51201,8199,49681,0,57863,0,8199,57874,0,
+		51201,8199,57874,0,8199,57875,0,51201,8199,57875,0,8199,49683,0,57861,0,
+		51201,8199,49683,0,57861,0,8199,49683,0,57862,0,51201,8199,49683,0,57862,
+		0,8199,57884,0,51201,8199,57884,0,8199,57885,0,51201,8199,57885,0,8199,
+		57887,0,51201,8199,57887,0,8199,57891,0,51201,8199,57891,0,8199,49699,0,
+		57864,0,51201,8199,49699,0,57864,0,8199,57895,0,51201,8199,57895,0,8199,
+		57897,0,51201,8199,57897,0,56321,8199,56321,8595,64513,8273,56321,8199,64769,8775,
+		32779,32780,32781,32782,59393,8206,32786,32787,32788,32789,59393,8213,64769,8213,32793,32794,
+		58369,8218,59393,8218,62465,8218,62721,8218,32798,32799,59393,8223,59905,8223,62465,8223,
+		32803,32804,32808,32812,59393,8236,62465,8236,32816,32817,62465,8241,32818,32822,32826,32830,
+		32834,58113,8258,58369,8258,50177,808,50177,8258,58369,809,58625,8258,58881,8258,59393,
+		8258,59649,8258,50177,1322,59905,8258,50177,808,51713,8258,58369,809,60161,8258,60417,
+		8258,62465,8258,64769,8258,8258,57871,0,51201,8258,57871,0,50177,8258,58618,0,
+		51713,8258,58618,0,51713,8258,51713,8098,59905,8804,50177,8258,58369,8258,50177,8258,
+		50177,8258,58369,8336,50177,8258,50177,8258,58369,8406,50177,8258,58369,8336,50177,8258,
+		58369,8406,56321,8258,64513,8457,50177,8258,58369,8503,56577,8258,56577,8595,56577,8199,
+		64769,8199,32838,32839,32840,59393,8264,32841,32842,32843,59393,8267,32847,59393,8271,32848,
+		32849,58113,8273,58369,8273,50177,808,50177,8273,58369,809,58625,8273,58881,8273,59393,
+		8273,59649,8273,50177,808,51713,8273,58369,809,60161,8273,60417,8273,62465,8273,64769,
+		8273,8273,57861,0,51201,8273,57861,0,8273,57863,0,51201,8273,57863,0,8273,
+		57864,0,51201,8273,57864,0,8273,57865,0,51201,8273,57865,0,8273,57871,0,
+		51201,8273,57871,0,8273,57873,0,51201,8273,57873,0,8273,57875,0,51201,8273,
+		57875,0,50177,8273,58390,0,51713,8273,58390,0,50177,8273,58618,0,51713,8273,
+		58618,0,56321,8273,56321,8098,64513,8406,56577,8273,64769,8124,56577,8273,56577,8309,
+		64513,8838,56577,8273,56577,8555,64513,8098,56577,8273,64513,8816,32853,59393,8277,62465,
+		8277,32857,32858,58369,8282,32862,59393,8286,32866,32867,59393,8291,32871,32875,32876,59393,
+		8300,32877,59393,8301,62465,8301,32881,59393,8305,32885,58113,8309,58369,8309,50177,808,
+		50177,8309,58369,809,58625,8309,58881,8309,59393,8309,59649,8309,50177,808,51713,8309,
+		58369,809,60161,8309,60417,8309,62465,8309,62721,8309,64769,8309,8309,57864,0,51201,
+		8309,57864,0,8309,57865,0,51201,8309,57865,0,8309,57868,0,51201,8309,57868,
+		0,8309,57871,0,51201,8309,57871,0,8309,57873,0,51201,8309,57873,0,8309,
+		57882,0,51201,8309,57882,0,54273,8309,62490,0,8309,57891,0,51201,8309,57891,
+		0,8309,57896,0,51201,8309,57896,0,8309,57898,0,56321,8309,64513,8098,56577,
+		8309,64513,8150,56577,8309,56321,8171,64769,8595,56577,8309,64513,8273,56577,8309,56321,
+		8336,56321,521,56577,8595,56321,8199,64513,8658,56577,8309,64769,8555,56321,8309,56577,
+		8555,64513,8098,56577,8309,64769,8775,56577,8309,64513,8838,32889,32893,59393,8317,32897,
+		32898,59393,8322,62465,8322,32902,59393,8326,32903,59393,8327,32904,59393,8328,32905,59393,
+		8329,62465,8329,32906,32910,32911,32912,58113,8336,58369,8336,50177,808,50177,8336,58369,
+		809,58625,8336,58881,8336,59393,8336,59649,8336,59905,8336,50177,808,51713,8336,58369,
+		809,60161,8336,60417,8336,62465,8336,62721,8336,64769,8336,8336,57861,0,51201,8336,
+		57861,0,8336,57862,0,51201,8336,57862,0,8336,57863,0,51201,8336,57863,0,
+		8336,57864,0,51201,8336,57864,0,8336,57865,0,51201,8336,57865,0,8336,57868,
+		0,51201,8336,57868,0,8336,49676,0,57861,0,51201,8336,49676,0,57861,0,
+		8336,57870,0,51201,8336,57870,0,51201,8336,57871,0,8336,57874,0,51201,8336,
+		57874,0,8336,57875,0,51201,8336,57875,0,8336,57884,0,51201,8336,57884,0,
+		8336,57885,0,51201,8336,57885,0,8336,57887,0,51201,8336,57887,0,8336,57891,
+		0,51201,8336,57891,0,8336,57897,0,51201,8336,57897,0,56577,8336,64769,8150,
+		56577,8336,64769,8171,50177,8336,58369,8336,51713,8336,59905,8336,50177,8336,50177,8336,
+		58369,8336,51713,8336,51713,8336,59905,8336,50177,8336,58369,8363,51713,8336,59905,8363,
+		56321,8336,64513,8472,56577,8336,64769,8727,50177,8336,58369,8775,51713,8336,59905,8775,
+		50177,8336,58369,8804,51713,8336,59905,8804,32916,58625,8340,32920,59393,8344,62465,8344,
+		32924,32925,32926,62465,8350,32927,59393,8351,62465,8351,32931,62465,8355,32932,32933,59393,
+		8357,32934,59393,8358,62465,8358,32938,32939,58113,8363,50177,808,50177,8363,58369,809,
+		58625,8363,58881,8363,59393,8363,59649,8363,50177,808,51713,8363,58369,809,60161,8363,
+		60417,8363,62465,8363,62721,8363,64769,8363,8363,57864,0,51201,8363,57864,0,8363,
+		57865,0,32943,58625,8367,32947,32948,59393,8372,32952,59393,8376,62465,8376,32956,62465,
+		8380,32960,32964,58113,8388,58369,8388,50177,808,50177,8388,58369,809,58625,8388,58881,
+		8388,59393,8388,59649,8388,50177,808,51713,8388,58369,809,60161,8388,60417,8388,62465,
+		8388,62721,8388,64769,8388,8388,57861,0,51201,8388,57861,0,8388,57865,0,51201,
+		8388,57865,0,8388,57873,0,51201,8388,57873,0,50177,8388,58390,0,51713,8388,
+		58390,0,8388,57891,0,51201,8388,57891,0,8388,57898,0,51201,8388,57898,0,
+		56321,8388,64769,8098,56577,8388,64769,8124,56321,8388,56321,8150,56321,8098,64513,8406,
+		56321,8388,64513,8273,56321,8388,56577,8309,64513,8838,56577,8388,64769,8388,56321,8388,
+		64513,8406,56321,8388,64513,8457,56577,8388,64769,8457,56321,8388,56321,8457,64513,8090,
+		56321,8388,56321,8457,64513,8091,56321,8388,56577,8555,64513,8098,56321,8388,64513,8695,
+		56321,8388,64769,8775,56321,8388,64769,8793,56321,8388,64769,9030,32968,32969,32970,59393,
+		8394,32974,59393,8398,32975,59393,8399,32976,59393,8400,32977,59393,8401,32978,59393,8402,
+		49151,32982,58113,8406,58369,8406,50177,808,50177,8406,58369,809,58625,8406,58881,8406,
+		49151,59393,8406,59649,8406,59905,8406,50177,808,51713,8406,58369,809,60161,8406,60417,
+		8406,62465,8406,62721,8406,64769,8406,8406,57861,0,51201,8406,57861,0,8406,57865,
+		0,51201,8406,57865,0,8406,57873,0,51201,8406,57873,0,8406,57882,0,51201,
+		8406,57882,0,8406,57891,0,51201,8406,57891,0,8406,49699,0,57875,0,51201,
+		8406,49699,0,57875,0,8406,57895,0,51201,8406,57895,0,8406,57898,0,51201,
+		8406,57898,0,8406,58105,0,51201,8406,58105,0,50177,8406,58369,8363,51713,8406,
+		58369,8363,51713,8406,59905,8363,50177,8406,58369,8406,51713,8406,59905,8406,56321,8406,
+		64513,8457,56321,8406,64513,8472,56321,8406,56321,8508,64513,8273,56577,8406,56321,8508,
+		56321,8658,56321,8658,56321,8406,56321,8199,56321,8658,64513,8658,50177,8406,58369,8658,
+		56577,8406,56577,8695,64769,8171,56321,8406,64513,8804,50177,8406,58369,8838,32986,58369,
+		8410,62465,8410,32990,59393,8414,32991,32992,59393,8416,32993,59393,8417,32997,59393,8421,
+		32998,59393,8422,62465,8422,33002,58369,8426,33003,33004,59393,8428,33008,62465,8432,33009,
+		62465,8433,33010,62465,8434,33014,33015,33019,33020,33024,59393,8448,33025,33029,33033,58113,
+		8457,58369,8457,50177,808,50177,8457,58369,809,58625,8457,58881,8457,59393,8457,59649,
+		8457,59905,8457,50177,808,51713,8457,58369,809,60161,8457,60417,8457,62465,8457,62721,
+		8457,64769,8457,8457,57861,0,51201,8457,57861,0,8457,57871,0,51201,8457,57871,
+		0,8457,57891,0,51201,8457,57891,0,56321,8457,64513,8090,56321,8457,64513,8091,
+		56321,8457,64769,8098,56321,8457,64513,8124,56577,8457,64769,8124,54273,8457,62465,8150,
+		54273,8457,62465,8171,56321,8457,64513,8273,56577,8457,56577,8309,64513,8838,56321,8457,
+		56321,8336,64513,8406,56321,8457,64513,8406,56321,8457,64513,8457,56321,8457,56321,8457,
+		64513,8090,56321,8457,56321,8457,64513,8091,56321,8457,56321,8508,64513,8406,56577,8457,
+		56577,8555,64513,8098,54273,8457,62465,8595,56321,8457,56321,1653,64513,8658,56321,8457,
+		64513,8658,56321,8457,56321,1653,56321,8658,64513,8090,56321,8457,64769,8775,56577,8457,
+		64769,8775,56321,8457,64769,8793,56577,8457,64769,8793,56577,8457,64769,9030,33037,58369,
+		8461,33038,33039,33040,59393,8464,62465,8464,33044,33045,33046,33047,33048,58113,8472,58369,
+		8472,50177,808,50177,8472,58369,809,58625,8472,58881,8472,59393,8472,59649,8472,50177,
+		808,51713,8472,58369,809,60161,8472,60417,8472,62465,8472,62721,8472,64769,8472,8472,
+		57861,0,51201,8472,57861,0,8472,57862,0,51201,8472,57862,0,8472,57865,0,
+		51201,8472,57865,0,8472,57870,0,51201,8472,57870,0,8472,57871,0,51201,8472,
+		57871,0,8472,57873,0,51201,8472,57873,0,50177,8472,58390,0,51713,8472,58390,
+		0,8472,57891,0,51201,8472,57891,0,8472,57895,0,51201,8472,57895,0,8472,
+		57898,0,51201,8472,57898,0,56321,8472,64769,8098,56577,8472,56577,8199,64769,8793,
+		56321,8472,64769,8258,56577,8472,64769,8273,50177,8472,58369,8363,51713,8472,58369,8363,
+		51713,8472,59905,8363,56321,8472,64513,8457,51713,8472,58369,8508,56321,8472,64513,8658,
+		56321,8472,64769,8775,56321,8472,64769,8793,33052,58369,8476,62465,8476,33056,33057,33058,
+		33059,59393,8483,62465,8483,33063,59393,8487,33067,59393,8491,33068,33069,62465,8493,33073,
+		33077,33078,33079,59393,8503,62465,8503,33083,33084,58113,8508,58369,8508,50177,808,50177,
+		8508,58369,809,58625,8508,58881,8508,59393,8508,59649,8508,50177,808,51713,8508,58369,
+		809,60161,8508,60417,8508,62465,8508,62721,8508,64769,8508,8508,57861,0,51201,8508,
+		57861,0,8508,57862,0,51201,8508,57862,0,8508,57863,0,51201,8508,57863,0,
+		8508,57864,0,51201,8508,57864,0,8508,49672,0,57861,0,51201,8508,49672,0,
+		57861,0,8508,49672,0,57862,0,51201,8508,49672,0,57862,0,8508,49672,0,
+		57870,0,51201,8508,49672,0,57870,0,8508,49672,0,57884,0,51201,8508,49672,
+		0,57884,0,8508,57865,0,51201,8508,57865,0,8508,57868,0,50177,8508,58380,
+		0,51201,8508,57868,0,51713,8508,58380,0,8508,49676,0,57875,0,51201,8508,
+		49676,0,57875,0,8508,57869,0,51201,8508,57869,0,8508,57870,0,51201,8508,
+		57870,0,8508,49678,0,57861,0,51201,8508,49678,0,57861,0,8508,49678,0,
+		57868,0,51201,8508,49678,0,57868,0,8508,49678,0,57875,0,51201,8508,49678,
+		0,57875,0,8508,57871,0,51201,8508,57871,0,8508,49679,0,57875,0,51201,
+		8508,49679,0,57875,0,8508,57872,0,51201,8508,57872,0,8508,49680,0,57861,
+		0,51201,8508,49680,0,57861,0,8508,57874,0,51201,8508,57874,0,8508,49682,
+		0,57875,0,51201,8508,49682,0,57875,0,8508,57875,0,51201,8508,57875,0,
+		8508,49683,0,57861,0,51201,8508,49683,0,57861,0,8508,49683,0,57862,0,
+		51201,8508,49683,0,57862,0,50177,8508,58389,0,8508,57884,0,51201,8508,57884,
+		0,8508,57885,0,51201,8508,57885,0,8508,57887,0,51201,8508,57887,0,8508,
+		57888,0,51201,8508,57888,0,8508,49696,0,57861,0,51201,8508,49696,0,57861,
+		0,8508,49696,0,57862,0,51201,8508,49696,0,57862,0,8508,49696,0,57870,
+		0,51201,8508,49696,0,57870,0,8508,49696,0,57884,0,51201,8508,49696,0,
+		57884,0,8508,49696,0,57891,0,51201,8508,49696,0,57891,0,8508,57891,0,
+		51201,8508,57891,0,8508,49699,0,57864,0,51201,8508,49699,0,57864,0,50177,
+		8508,50425,0,58369,8199,51713,8508,50425,0,59905,8199,54273,8508,54521,0,62465,
+		8199,56577,8508,64769,8388,50177,8508,58369,8508,51713,8508,59905,8508,56321,8508,64769,
+		8775,33088,33089,33090,33091,33095,33096,33097,33098,33099,33100,33101,33102,33103,59393,8527,
+		62465,8527,33107,33108,33109,33110,33111,33112,59393,8536,33113,62465,8537,33114,62465,8538,
+		33115,33116,59393,8540,62465,8540,33120,59393,8544,33121,33125,59393,8549,33126,59393,8550,
+		64769,8550,33130,33131,58113,8555,58369,8555,50177,808,50177,8555,58369,809,58625,8555,
+		58881,8555,59393,8555,59649,8555,50177,808,51713,8555,58369,809,60161,8555,60417,8555,
+		62465,8555,62721,8555,64769,8555,8555,57861,0,51201,8555,57861,0,8555,57871,0,
+		51201,8555,57871,0,56321,8555,64769,8098,56577,8555,64513,8098,56577,8555,64769,8098,
+		56321,8555,64513,8150,56321,8555,64769,8258,56577,8555,64769,8309,56321,8555,56321,638,
+		56321,8457,64513,638,56577,8555,56577,8555,64769,8457,56577,8555,56577,8555,64769,8775,
+		56577,8555,64769,8595,56321,8555,64513,8658,56577,8555,56577,8695,64769,8199,56321,8555,
+		64769,8775,56321,8555,64769,8793,33135,33136,59393,8560,33137,59393,8561,33138,33139,33140,
+		59393,8564,33144,59393,8568,33145,59393,8569,33146,33147,62465,8571,33151,33152,58113,8576,
+		50177,808,50177,8576,58369,809,58625,8576,58881,8576,59393,8576,59649,8576,50177,808,
+		51713,8576,58369,809,60161,8576,60417,8576,64769,8576,50177,8576,58369,8555,33156,33157,
+		59393,8581,33158,59393,8582,33159,33163,59393,8587,33167,33171,58113,8595,58369,8595,50177,
+		808,50177,8595,58369,809,58625,8595,58881,8595,59393,8595,59649,8595,50177,808,51713,
+		8595,58369,809,60161,8595,60417,8595,62465,8595,62721,8595,64769,8595,8595,57861,0,
+		51201,8595,57861,0,8595,57865,0,51201,8595,57865,0,8595,57871,0,51201,8595,
+		57871,0,8595,57873,0,51201,8595,57873,0,50177,8595,58390,0,51713,8595,58390,
+		0,8595,57885,0,51201,8595,57885,0,8595,57887,0,51201,8595,57887,0,8595,
+		57891,0,51201,8595,57891,0,8595,49699,0,57875,0,51201,8595,49699,0,57875,
+		0,8595,57898,0,51201,8595,57898,0,50177,8595,58618,0,51713,8595,58618,0,
+		56321,8595,56321,8098,64513,8171,56321,8595,56321,8098,56321,8171,56321,1653,64513,8658,
+		56321,8595,56321,8098,56321,8171,56321,1653,56321,8658,64513,8090,51713,8595,58369,8658,
+		33175,33176,58369,8600,59393,8600,33180,33181,58369,8605,59393,8605,33182,33183,59393,8607,
+		33187,33188,62465,8612,33192,33193,33197,33198,62465,8622,33202,33203,33207,59393,8631,33211,
+		33212,33216,33217,33221,33222,33223,33224,33225,33226,62465,8650,33230,33231,33232,33233,59393,
+		8657,33234,58113,8658,58369,8658,50177,808,50177,8658,58369,809,58625,8658,58881,8658,
+		59393,8658,59649,8658,50177,808,51713,8658,58369,809,50177,906,51713,8658,58369,907,
+		60161,8658,60417,8658,62465,8658,62721,8658,64769,8658,8658,57861,0,51201,8658,57861,
+		0,8658,49669,0,57871,0,51201,8658,49669,0,57871,0,8658,57864,0,51201,
+		8658,57864,0,8658,57865,0,51201,8658,57865,0,8658,49673,0,57871,0,51201,
+		8658,49673,0,57871,0,8658,57871,0,51201,8658,57871,0,8658,57873,0,51201,
+		8658,57873,0,50177,8658,58390,0,51713,8658,58390,0,8658,57891,0,51201,8658,
+		57891,0,8658,49699,0,57871,0,51201,8658,49699,0,57871,0,8658,57894,0,
+		51201,8658,57894,0,50177,8658,58618,0,51713,8658,58618,0,50177,8658,50426,0,
+		57871,0,56577,8658,64769,8098,56577,8658,64769,8171,56577,8658,56577,8309,64769,8775,
+		54273,8658,62465,8457,56577,8658,56577,8508,64769,8658,56321,8658,64513,8595,56577,8658,
+		64769,8658,50177,8658,50425,0,58369,8658,51713,8658,50425,0,59905,8658,50177,8658,
+		58369,8695,50177,8658,50426,0,58369,8695,56577,8658,64513,8775,33238,33239,59393,8663,
+		33240,33241,33242,59393,8666,62465,8666,33246,59393,8670,33250,33251,33252,58369,8676,59393,
+		8676,62465,8676,33256,33257,33258,33262,33266,33267,33271,58113,8695,58369,8695,50177,808,
+		50177,8695,58369,809,58625,8695,58881,8695,59393,8695,59649,8695,50177,808,51713,8695,
+		58369,809,60161,8695,60417,8695,62465,8695,62721,8695,64769,8695,8695,57865,0,51201,
+		8695,57865,0,8695,57868,0,8695,57871,0,51201,8695,57871,0,8695,57873,0,
+		51201,8695,57873,0,8695,57891,0,51201,8695,57891,0,8695,57894,0,51201,8695,
+		57894,0,8695,57895,0,51201,8695,57895,0,8695,57898,0,51201,8695,57898,0,
+		50177,8695,58618,0,51713,8695,58618,0,50177,8695,58369,8165,51713,8695,51713,8199,
+		59905,8406,50177,8695,50425,0,58369,8309,56577,8695,56577,8309,64513,8838,54273,8695,
+		62465,8457,50177,8695,58369,8658,50177,8695,58369,8666,50177,8695,58369,8676,50177,8695,
+		58369,8838,51713,8695,58369,8838,33275,33276,59393,8700,33280,59393,8704,33281,33282,62465,
+		8706,33286,59393,8710,33290,59393,8714,33294,33298,33299,59393,8723,33303,58113,8727,58369,
+		8727,50177,808,50177,8727,58369,809,58625,8727,58881,8727,59393,8727,59649,8727,50177,
+		808,51713,8727,58369,809,60161,8727,60417,8727,62465,8727,62721,8727,64769,8727,8727,
+		57861,0,51201,8727,57861,0,8727,57862,0,51201,8727,57862,0,8727,57863,0,
+		51201,8727,57863,0,8727,57864,0,51201,8727,57864,0,8727,57865,0,51201,8727,
+		57865,0,8727,57866,0,51201,8727,57866,0,8727,57868,0,50177,8727,58380,0,
+		51201,8727,57868,0,51713,8727,58380,0,8727,49676,0,57861,0,51201,8727,49676,
+		0,57861,0,8727,49676,0,57862,0,51201,8727,49676,0,57862,0,8727,49676,
+		0,57865,0,51201,8727,49676,0,57865,0,8727,49676,0,57875,0,51201,8727,
+		49676,0,57875,0,8727,57869,0,51201,8727,57869,0,8727,57870,0,51201,8727,
+		57870,0,8727,49678,0,57861,0,51201,8727,49678,0,57861,0,8727,57874,0,
+		51201,8727,57874,0,8727,57875,0,51201,8727,57875,0,8727,49683,0,57868,0,
+		51201,8727,49683,0,57868,0,50177,8727,58389,0,8727,57884,0,51201,8727,57884,
+		0,8727,57885,0,51201,8727,57885,0,8727,57887,0,51201,8727,57887,0,8727,
+		57888,0,51201,8727,57888,0,8727,49696,0,57861,0,51201,8727,49696,0,57861,
+		0,8727,49696,0,57862,0,51201,8727,49696,0,57862,0,8727,49696,0,57870,
+		0,51201,8727,49696,0,57870,0,8727,49696,0,57884,0,51201,8727,49696,0,
+		57884,0,8727,49696,0,57891,0,51201,8727,49696,0,57891,0,8727,57891,0,
+		51201,8727,57891,0,8727,57892,0,51201,8727,57892,0,8727,57895,0,51201,8727,
+		57895,0,8727,57897,0,51201,8727,57897,0,56577,8727,56577,8309,64769,8171,56577,
+		8727,56577,8555,64513,615,33307,62465,8731,33308,33309,62465,8733,33310,33311,33312,33313,
+		33314,59393,8738,62465,8738,33318,33319,59393,8743,33320,33321,33322,62465,8746,33323,59393,
+		8747,33324,59393,8748,62465,8748,33328,33332,33336,59393,8760,62465,8760,33340,33341,33342,
+		62465,8766,33346,59393,8770,62465,8770,33350,33351,58113,8775,58369,8775,50177,808,50177,
+		8775,58369,809,58625,8775,58881,8775,59393,8775,59649,8775,59905,8775,50177,808,51713,
+		8775,58369,809,60161,8775,60417,8775,62465,8775,62721,8775,64769,8775,8775,57870,0,
+		51201,8775,57870,0,8775,57891,0,51201,8775,57891,0,50177,8775,58369,8336,51713,
+		8775,59905,8336,50177,8775,50177,8336,58369,8336,51713,8775,51713,8336,59905,8336,50177,
+		8775,50177,8336,50177,8336,58369,8336,51713,8775,51713,8336,51713,8336,59905,8336,56577,
+		8775,56321,1653,64513,8457,56577,8775,56577,8508,64769,8171,56577,8775,64769,8658,50177,
+		8775,58369,8816,51713,8775,59905,8816,33355,33356,59393,8780,33357,33358,59393,8782,62465,
+		8782,33362,33363,33364,59393,8788,33365,59393,8789,62465,8789,33369,58113,8793,58369,8793,
+		50177,808,50177,8793,58369,809,58625,8793,58881,8793,59393,8793,59649,8793,50177,808,
+		51713,8793,58369,809,60161,8793,60417,8793,62465,8793,64769,8793,8793,57861,0,51201,
+		8793,57861,0,8793,57862,0,51201,8793,57862,0,8793,57864,0,51201,8793,57864,
+		0,8793,57866,0,8793,57868,0,51201,8793,57868,0,8793,57871,0,51201,8793,
+		57871,0,8793,57891,0,51201,8793,57891,0,56577,8793,64513,8124,56577,8793,64769,
+		8150,52225,8793,60417,8838,33373,33374,59393,8798,33375,59393,8799,33376,58369,8800,62465,
+		8800,33380,58113,8804,58369,8804,50177,808,50177,8804,58369,809,58625,8804,58881,8804,
+		59393,8804,59649,8804,59905,8804,50177,808,51713,8804,58369,809,60161,8804,60417,8804,
+		62465,8804,62721,8804,64769,8804,8804,57868,0,51201,8804,57868,0,8804,57871,0,
+		51201,8804,57871,0,50177,8804,58369,8336,51713,8804,59905,8336,50177,8804,50177,8336,
+		58369,8336,51713,8804,51713,8336,59905,8336,33384,33385,33386,33387,33388,33389,59393,8813,
+		33390,33391,33392,58113,8816,50177,808,50177,8816,58369,809,58625,8816,58881,8816,59393,
+		8816,59649,8816,50177,808,51713,8816,58369,809,60161,8816,60417,8816,62465,8816,64769,
+		8816,8816,57861,0,51201,8816,57861,0,8816,57862,0,51201,8816,57862,0,8816,
+		57864,0,51201,8816,57864,0,8816,57866,0,8816,57868,0,51201,8816,57868,0,
+		8816,57870,0,51201,8816,57870,0,8816,57871,0,51201,8816,57871,0,8816,57875,
+		0,51201,8816,57875,0,8816,57884,0,51201,8816,57884,0,8816,57891,0,51201,
+		8816,57891,0,33396,33400,59393,8824,33404,59393,8828,33408,59393,8832,33409,33410,59393,
+		8834,33414,58113,8838,58369,8838,50177,808,50177,8838,58369,809,58625,8838,58881,8838,
+		59393,8838,59649,8838,50177,808,51713,8838,58369,809,60161,8838,60417,8838,62465,8838,
+		64769,8838,8838,57861,0,51201,8838,57861,0,8838,57864,0,51201,8838,57864,0,
+		8838,57865,0,51201,8838,57865,0,8838,57871,0,51201,8838,57871,0,8838,57891,
+		0,51201,8838,57891,0,8838,57898,0,51201,8838,57898,0,50177,8838,58369,8793,
+		33418,33419,59393,8843,33423,33424,59393,8848,33425,59393,8849,33429,62465,8853,33433,62465,
+		8857,33437,59393,8861,33441,59393,8865,33442,59393,8866,33443,59393,8867,62465,8867,8867,
+		57865,0,51201,8867,57865,0,33447,33448,59393,8872,33452,33453,33457,33461,59393,8885,
+		33465,59393,8889,33466,59393,8890,33467,59393,8891,33471,59393,8895,33472,33473,33474,33475,
+		59393,8899,33476,59393,8900,33477,58369,8901,59393,8901,62465,8901,33478,33479,33483,59393,
+		8907,33484,59393,8908,33485,59393,8909,33486,59393,8910,33490,59393,8914,33494,59393,8918,
+		33498,33502,59393,8926,33506,33507,50177,8931,58369,8472,33508,33509,33510,59393,8934,33511,
+		59393,8935,33512,33513,62465,8937,33517,33518,33519,33520,62465,8944,33521,59393,8945,33522,
+		33526,33530,33534,33538,33542,33546,33550,33554,33558,33562,33566,58625,8990,59393,8990,60161,
+		8990,8990,57859,0,51201,8990,57859,0,8990,49667,0,57861,0,51201,8990,49667,
+		0,57861,0,8990,49667,0,49669,0,57901,0,51201,8990,49667,0,49669,0,
+		57901,0,8990,49667,0,57862,0,51201,8990,49667,0,57862,0,8990,49667,0,
+		49670,0,57901,0,51201,8990,49667,0,49670,0,57901,0,8990,49667,0,57867,
+		0,51201,8990,49667,0,57867,0,8990,49667,0,49675,0,57901,0,51201,8990,
+		49667,0,49675,0,57901,0,8990,49667,0,57901,0,51201,8990,49667,0,57901,
+		0,8990,57860,0,51201,8990,57860,0,8990,49668,0,57861,0,51201,8990,49668,
+		0,57861,0,8990,49668,0,49669,0,57901,0,51201,8990,49668,0,49669,0,
+		57901,0,8990,49668,0,57862,0,51201,8990,49668,0,57862,0,8990,49668,0,
+		49670,0,57901,0,51201,8990,49668,0,49670,0,57901,0,8990,49668,0,57867,
+		0,51201,8990,49668,0,57867,0,8990,49668,0,49675,0,57901,0,51201,8990,
+		49668,0,49675,0,57901,0,8990,49668,0,57901,0,51201,8990,49668,0,57901,
+		0,8990,57861,0,51201,8990,57861,0,8990,49669,0,57901,0,8990,57862,0,
+		51201,8990,57862,0,8990,49670,0,57901,0,8990,57863,0,51201,8990,57863,0,
+		8990,57867,0,8990,49675,0,57901,0,8990,57875,0,51201,8990,57875,0,8990,
+		57901,0,51201,8990,57901,0,33567,58369,8991,58625,8991,59393,8991,60161,8991,62465,
+		8991,62721,8991,33568,58625,8992,59393,8992,60161,8992,62465,8992,62721,8992,33569,33570,
+		58625,8994,59393,8994,60161,8994,62465,8994,33571,58369,8995,58625,8995,59393,8995,60161,
+		8995,8995,57859,0,51201,8995,57859,0,8995,49667,0,57861,0,51201,8995,49667,
+		0,57861,0,8995,49667,0,57862,0,51201,8995,49667,0,57862,0,8995,57860,
+		0,51201,8995,57860,0,8995,49668,0,57861,0,51201,8995,49668,0,57861,0,
+		8995,49668,0,57862,0,51201,8995,49668,0,57862,0,8995,57861,0,51201,8995,
+		57861,0,8995,57862,0,51201,8995,57862,0,33572,58625,8996,59393,8996,60161,8996,
+		33573,59393,8997,33574,59393,8998,33575,58625,8999,59393,8999,60161,8999,33576,59393,9000,
+		33577,58625,9001,59393,9001,60161,9001,9001,57859,0,51201,9001,57859,0,9001,49667,
+		0,57861,0,51201,9001,49667,0,57861,0,9001,49667,0,49669,0,57901,0,
+		51201,9001,49667,0,49669,0,57901,0,9001,49667,0,57862,0,51201,9001,49667,
+		0,57862,0,9001,49667,0,49670,0,57901,0,51201,9001,49667,0,49670,0,
+		57901,0,9001,49667,0,57867,0,51201,9001,49667,0,57867,0,9001,49667,0,
+		49675,0,57901,0,51201,9001,49667,0,49675,0,57901,0,9001,49667,0,57901,
+		0,51201,9001,49667,0,57901,0,9001,57860,0,51201,9001,57860,0,9001,49668,
+		0,57861,0,51201,9001,49668,0,57861,0,9001,49668,0,49669,0,57901,0,
+		51201,9001,49668,0,49669,0,57901,0,9001,49668,0,57862,0,51201,9001,49668,
+		0,57862,0,9001,49668,0,49670,0,57901,0,51201,9001,49668,0,49670,0,
+		57901,0,9001,49668,0,57867,0,51201,9001,49668,0,57867,0,9001,49668,0,
+		49675,0,57901,0,51201,9001,49668,0,49675,0,57901,0,9001,49668,0,57901,
+		0,51201,9001,49668,0,57901,0,9001,57861,0,51201,9001,57861,0,9001,49669,
+		0,57901,0,9001,57862,0,51201,9001,57862,0,9001,49670,0,57901,0,9001,
+		57867,0,9001,49675,0,57901,0,9001,57901,0,51201,9001,57901,0,33578,58369,
+		9002,58625,9002,59393,9002,59905,9002,60161,9002,62465,9002,33579,58369,9003,58625,9003,
+		59393,9003,60161,9003,9003,57859,0,51201,9003,57859,0,9003,49667,0,57861,0,
+		51201,9003,49667,0,57861,0,9003,49667,0,57862,0,51201,9003,49667,0,57862,
+		0,9003,49667,0,57867,0,51201,9003,49667,0,57867,0,9003,57860,0,51201,
+		9003,57860,0,9003,49668,0,57861,0,51201,9003,49668,0,57861,0,9003,49668,
+		0,57862,0,51201,9003,49668,0,57862,0,9003,49668,0,57867,0,51201,9003,
+		49668,0,57867,0,9003,57861,0,51201,9003,57861,0,9003,57862,0,51201,9003,
+		57862,0,9003,57863,0,51201,9003,57863,0,9003,57867,0,9003,57868,0,51201,
+		9003,57868,0,9003,49676,0,57861,0,9003,49676,0,57862,0,9003,49676,0,
+		57867,0,9003,57875,0,51201,9003,57875,0,33580,59393,9004,33581,58369,9005,58625,
+		9005,59393,9005,60161,9005,50177,9005,50177,8990,58369,9003,51713,9005,50177,8990,58369,
+		9003,33582,58625,9006,59393,9006,60161,9006,33583,33584,58369,9008,58625,9008,59393,9008,
+		60161,9008,56321,9008,64769,8098,56321,9008,64769,8258,56321,9008,64513,8273,56321,9008,
+		64513,8406,56321,9008,64513,8457,56321,9008,64513,8658,56321,9008,64769,8775,56321,9008,
+		64769,8793,33585,58625,9009,59393,9009,60161,9009,33586,58625,9010,59393,9010,60161,9010,
+		33587,58625,9011,59393,9011,60161,9011,9011,57859,0,51201,9011,57859,0,9011,49667,
+		0,57861,0,51201,9011,49667,0,57861,0,9011,49667,0,57862,0,51201,9011,
+		49667,0,57862,0,9011,57860,0,51201,9011,57860,0,9011,49668,0,57861,0,
+		51201,9011,49668,0,57861,0,9011,49668,0,57862,0,51201,9011,49668,0,57862,
+		0,9011,57861,0,51201,9011,57861,0,9011,57862,0,51201,9011,57862,0,33588,
+		58369,9012,58625,9012,59393,9012,60161,9012,33589,33590,59393,9014,33591,59393,9015,33592,
+		59393,9016,33593,58369,9017,58625,9017,59393,9017,60161,9017,62721,9017,9017,57859,0,
+		9017,57860,0,51201,9017,57860,0,33594,33595,33596,58369,9020,58625,9020,59393,9020,
+		59905,9020,60161,9020,63745,9020,33597,59393,9021,33598,59393,9022,33599,59393,9023,33600,
+		58625,9024,59393,9024,60161,9024,33601,58625,9025,59393,9025,59905,9025,60161,9025,9025,
+		57859,0,9025,49667,0,57861,0,9025,49667,0,57862,0,9025,49667,0,57867,
+		0,9025,57860,0,51201,9025,57860,0,9025,49668,0,57861,0,51201,9025,49668,
+		0,57861,0,9025,49668,0,57862,0,51201,9025,49668,0,57862,0,9025,49668,
+		0,57867,0,51201,9025,49668,0,57867,0,9025,57861,0,51201,9025,57861,0,
+		51713,9025,57861,0,9025,57862,0,51201,9025,57862,0,9025,57863,0,51201,9025,
+		57863,0,9025,57867,0,9025,57868,0,51201,9025,57868,0,51713,9025,57868,0,
+		9025,49676,0,57861,0,9025,49676,0,57862,0,9025,49676,0,57867,0,9025,
+		57875,0,51201,9025,57875,0,33602,58369,9026,58625,9026,59393,9026,60161,9026,62465,
+		9026,62721,9026,33603,58625,9027,59393,9027,60161,9027,62465,9027,62721,9027,33604,58625,
+		9028,59393,9028,60161,9028,33605,33606,58625,9030,59393,9030,60161,9030,9030,57859,0,
+		51201,9030,57859,0,9030,49667,0,57861,0,51201,9030,49667,0,57861,0,9030,
+		49667,0,49669,0,57901,0,51201,9030,49667,0,49669,0,57901,0,9030,49667,
+		0,57862,0,51201,9030,49667,0,57862,0,9030,49667,0,49670,0,57901,0,
+		51201,9030,49667,0,49670,0,57901,0,9030,49667,0,57867,0,51201,9030,49667,
+		0,57867,0,9030,49667,0,49675,0,57901,0,51201,9030,49667,0,49675,0,
+		57901,0,9030,49667,0,57901,0,51201,9030,49667,0,57901,0,9030,57860,0,
+		51201,9030,57860,0,9030,49668,0,57861,0,51201,9030,49668,0,57861,0,9030,
+		49668,0,49669,0,57901,0,51201,9030,49668,0,49669,0,57901,0,9030,49668,
+		0,57862,0,51201,9030,49668,0,57862,0,9030,49668,0,49670,0,57901,0,
+		51201,9030,49668,0,49670,0,57901,0,9030,49668,0,57867,0,51201,9030,49668,
+		0,57867,0,9030,49668,0,49675,0,57901,0,51201,9030,49668,0,49675,0,
+		57901,0,9030,49668,0,57901,0,51201,9030,49668,0,57901,0,9030,57861,0,
+		51201,9030,57861,0,9030,49669,0,57901,0,9030,57862,0,51201,9030,57862,0,
+		9030,49670,0,57901,0,9030,57867,0,9030,49675,0,57901,0,9030,57901,0,
+		51201,9030,57901,0,33607,33608,59393,9032,33609,59393,9033,33610,59393,9034,33611,59393,
+		9035,33612,59393,9036,33613,59393,9037,33614,59393,9038,33615,59393,9039,33616,59393,9040,
+		33617,59393,9041,33618,59393,9042,33619,59393,9043,33620,59393,9044,33621,59393,9045,33622,
+		59393,9046,50177,9046,50177,9035,58369,9045,33623,59393,9047,33624,59393,9048,33625,59393,
+		9049,33626,59393,9050,33627,59393,9051,33628,59393,9052,33629,59393,9053,33630,59393,9054,
+		33631,59393,9055,33632,59393,9056,33633,59393,9057,33634,59393,9058,33635,59393,9059,33636,
+		59393,9060,33637,59393,9061,33638,59393,9062,33639,59393,9063,33640,59393,9064,33641,59393,
+		9065,33642,59393,9066,33643,59393,9067,33644,59393,9068,33645,59393,9069,33646,59393,9070,
+		33647,59393,9071,33648,59393,9072,33649,59393,9073,33650,59393,9074,33651,59393,9075,33652,
+		59393,9076,33653,59393,9077,33654,59393,9078,33655,59393,9079,33656,59393,9080,33657,59393,
+		9081,33658,59393,9082,33659,59393,9083,33660,59393,9084,33661,59393,9085,33662,59393,9086,
+		33663,59393,9087,33664,59393,9088,33665,59393,9089,33666,59393,9090,33667,59393,9091,33668,
+		59393,9092,33669,59393,9093,33670,59393,9094,33671,58369,9095,59393,9095,9095,57863,0,
+		51201,9095,57863,0,9095,57868,0,51201,9095,57868,0,33675,59393,9099,9099,57868,
+		0,51201,9099,57868,0,33679,59393,9103,33683,58369,9107,59393,9107,33687,58369,9111,
+		59393,9111,33691,58369,9115,59393,9115,9115,57861,0,51201,9115,57861,0,50177,9115,
+		58618,0,51713,9115,58618,0,33695,59393,9119,33699,59393,9123,33703,59393,9127,33707,
+		59393,9131,33711,58369,9135,59393,9135,33715,59393,9139,33716,59393,9140,33717,59393,9141,
+		33721,59393,9145,33722,59393,9146,33723,59393,9147,33727,58369,9151,59393,9151,9151,57862,
+		0,51201,9151,57862,0,9151,57863,0,51201,9151,57863,0,9151,57868,0,51201,
+		9151,57868,0,33731,58369,9155,59393,9155,33735,58369,9159,59393,9159,9159,57863,0,
+		51201,9159,57863,0,9159,57868,0,51201,9159,57868,0,33739,59393,9163,33740,59393,
+		9164,33741,59393,9165,33745,58369,9169,59393,9169,9169,57868,0,51201,9169,57868,0,
+		33749,59393,9173,33750,59393,9174,33751,59393,9175,33752,59393,9176,33753,59393,9177,33757,
+		59393,9181,33758,59393,9182,33762,59393,9186,33763,59393,9187,33764,59393,9188,49151,33765,
+		58369,9189,49151,59393,9189,9189,57862,0,51201,9189,57862,0,9189,57868,0,51201,
+		9189,57868,0,9189,57875,0,51201,9189,57875,0,33769,59393,9193,33773,59393,9197,
+		9197,57868,0,50177,9197,58380,0,51201,9197,57868,0,33777,59393,9201,33778,59393,
+		9202,33782,59393,9206,33786,58369,9210,59393,9210,33787,58369,9211,59393,9211,9211,57861,
+		0,51201,9211,57861,0,33791,59393,9215,33795,59393,9219,33799,59393,9223,33803,59393,
+		9227,33807,59393,9231,33811,59393,9235,33812,59393,9236,33813,58369,9237,59393,9237,33817,
+		33818,59393,9242,33822,59393,9246,33823,59393,9247,33824,59393,9248,33825,59393,9249,33829,
+		59393,9253,33830,59393,9254,33831,59393,9255,33832,58369,9256,59393,9256,33836,59393,9260,
+		33840,59393,9264,33841,58369,9265,59393,9265,62465,9265,33845,59393,9269,33846,59393,9270,
+		33850,59393,9274,33854,59393,9278,33858,59393,9282,33859,59393,9283,33863,59393,9287,33867,
+		59393,9291,33868,58369,9292,59393,9292,59905,9292,9292,57868,0,51201,9292,57868,0,
+		33872,59393,9296,9296,57868,0,51201,9296,57868,0,33876,58369,9300,59393,9300,33880,
+		59393,9304,33881,59393,9305,33885,59393,9309,33889,58369,9313,59393,9313,33893,59393,9317,
+		33897,59393,9321,33898,58369,9322,59393,9322,50177,9322,58369,9331,33902,59393,9326,33903,
+		59393,9327,33907,58369,9331,59393,9331,33911,59393,9335,33912,59393,9336,33913,59393,9337,
+		33917,59393,9341,33918,59393,9342,33922,58369,9346,59393,9346,9346,57863,0,51201,9346,
+		57863,0,9346,57868,0,51201,9346,57868,0,9346,57869,0,51201,9346,57869,0,
+		9346,57875,0,51201,9346,57875,0,33926,59393,9350,33930,59393,9354,33934,58369,9358,
+		59393,9358,33935,59393,9359,33939,58369,9363,59393,9363,33943,58369,9367,59393,9367,33947,
+		59393,9371,33951,59393,9375,33955,59393,9379,33959,59393,9383,33963,59393,9387,33964,59393,
+		9388,33965,58369,9389,59393,9389,33969,59393,9393,33973,59393,9397,33974,59393,9398,33978,
+		59393,9402,33982,58369,9406,59393,9406,33986,59393,9410,33987,59393,9411,33988,59393,9412,
+		33992,59393,9416,33993,58369,9417,59393,9417,9417,57868,0,51201,9417,57868,0,33997,
+		59393,9421,33998,59393,9422,33999,59393,9423,34003,59393,9427,34007,59393,9431,34011,59393,
+		9435,34012,59393,9436,34016,59393,9440,34020,59393,9444,34024,58369,9448,59393,9448,34028,
+		59393,9452,34029,58369,9453,59393,9453,34033,59393,9457,34034,34035,34036,58369,9460,59393,
+		9460,62465,9460,34040,59393,9464,34041,58369,9465,59393,9465,9465,57868,0,51201,9465,
+		57868,0,34045,58369,9469,59393,9469,62465,9469,34049,59393,9473,34053,58369,9477,59393,
+		9477,34057,59393,9481,34058,59393,9482,9482,57868,0,51201,9482,57868,0,34062,58369,
+		9486,59393,9486,34066,59393,9490,34067,58369,9491,59393,9491,34068,59393,9492,34072,59393,
+		9496,34073,58369,9497,59393,9497,34077,58369,9501,59393,9501,34081,59393,9505,34082,58369,
+		9506,59393,9506,34086,59393,9510,34087,59393,9511,34091,59393,9515,34092,58369,9516,59393,
+		9516,34096,59393,9520,34100,59393,9524,34104,58369,9528,59393,9528,34108,59393,9532,9532,
+		57885,0,51201,9532,57885,0,34112,59393,9536,34113,59393,9537,34117,59393,9541,34118,
+		59393,9542,34122,58369,9546,59393,9546,34123,58369,9547,59393,9547,34124,58369,9548,59393,
+		9548,34125,58369,9549,59393,9549,34126,58369,9550,59393,9550,34127,58369,9551,59393,9551,
+		34128,58369,9552,59393,9552,34129,59393,9553,34130,58369,9554,59393,9554,34131,58369,9555,
+		59393,9555,34132,58369,9556,59393,9556,34133,58369,9557,59393,9557,34134,58369,9558,59393,
+		9558,34135,58369,9559,59393,9559,34136,58369,9560,59393,9560,34137,58369,9561,59393,9561,
+		34138,58369,9562,59393,9562,34139,58369,9563,59393,9563,34140,58369,9564,59393,9564,34141,
+		58369,9565,59393,9565,34142,58369,9566,59393,9566,34143,58369,9567,59393,9567,34144,58369,
+		9568,59393,9568,34145,58369,9569,59393,9569,34146,58369,9570,59393,9570,34147,59393,9571,
+		34148,59393,9572,34149,58369,9573,59393,9573,34150,58369,9574,59393,9574,34151,58369,9575,
+		59393,9575,34152,58369,9576,59393,9576,34153,58369,9577,59393,9577,34154,58369,9578,59393,
+		9578,34155,58369,9579,59393,9579,34156,59393,9580,34157,58369,9581,59393,9581,34158,58369,
+		9582,59393,9582,34159,59393,9583,34160,58369,9584,59393,9584,34161,58369,9585,59393,9585,
+		34162,58369,9586,59393,9586,34163,58369,9587,59393,9587,34164,58369,9588,59393,9588,34165,
+		59393,9589,34166,59393,9590,34167,59393,9591,34168,59393,9592,34169,58369,9593,34170,34171,
+		34172,58369,9596,34173,34174,34175,34176,58369,9600,34177,34178,34179,34180,34181,34182,58369,
+		9606,34183,34184,34185,34186,58369,9610,34187,34188,34189,34190,34191,34192,34193,34194,34195,
+		34196,34197,34198,34199,34200,34201,34202,34203,34204,34205,34206,34207,59393,9631,34208,59393,
+		9632,34209,59393,9633,34210,59393,9634,34211,59393,9635,34212,59393,9636,34213,59393,9637,
+		34214,59393,9638,34215,59393,9639,34216,59393,9640,34217,59393,9641,34218,59393,9642,34219,
+		59393,9643,34220,59393,9644,34221,59393,9645,34222,59393,9646,34223,59393,9647,34224,59393,
+		9648,34225,59393,9649,34226,59393,9650,34227,59393,9651,34228,59393,9652,34229,59393,9653,
+		34230,59393,9654,34231,59393,9655,34232,59393,9656,34233,59393,9657,62465,9657,34234,59393,
+		9658,34235,59393,9659,34236,59393,9660,34237,59393,9661,34238,59393,9662,34239,59393,9663,
+		34240,59393,9664,34241,59393,9665,34242,59393,9666,34243,59393,9667,34244,59393,9668,34245,
+		59393,9669,34246,59393,9670,34247,59393,9671,34248,59393,9672,34249,59393,9673,34250,59393,
+		9674,34251,59393,9675,34252,59393,9676,34253,59393,9677,34254,59393,9678,34255,59393,9679,
+		34256,59393,9680,34257,59393,9681,34258,59393,9682,34259,59393,9683,34260,59393,9684,34261,
+		59393,9685,34262,59393,9686,34263,59393,9687,34264,59393,9688,34265,59393,9689,34266,59393,
+		9690,34267,59393,9691,34268,59393,9692,34269,59393,9693,34270,59393,9694,34271,59393,9695,
+		34272,59393,9696,34273,59393,9697,34274,59393,9698,34275,59393,9699,34276,59393,9700,34277,
+		59393,9701,34278,59393,9702,34279,59393,9703,34280,59393,9704,34281,59393,9705,34282,59393,
+		9706,34283,59393,9707,34284,59393,9708,34285,59393,9709,34286,59393,9710,34287,59393,9711,
+		34288,59393,9712,34289,59393,9713,34290,59393,9714,34291,59393,9715,34292,59393,9716,34293,
+		59393,9717,34294,34295,59393,9719,34296,59393,9720,34297,59393,9721,34298,59393,9722,50177,
+		9722,58369,9752,34299,59393,9723,34300,59393,9724,34301,59393,9725,34302,59393,9726,34303,
+		59393,9727,34304,59393,9728,34305,59393,9729,34306,59393,9730,34307,59393,9731,34308,59393,
+		9732,34309,59393,9733,34310,59393,9734,34311,59393,9735,34312,59393,9736,34313,59393,9737,
+		50177,9737,58369,9722,50177,9737,58369,9728,50177,9737,58369,9730,50177,9737,58369,9740,
+		34314,59393,9738,34315,34316,59393,9740,34317,59393,9741,34318,59393,9742,34319,59393,9743,
+		34320,59393,9744,34321,59393,9745,34322,59393,9746,34323,59393,9747,34324,59393,9748,50177,
+		9748,58369,9740,34325,59393,9749,34326,59393,9750,34327,59393,9751,34328,59393,9752,34329,
+		59393,9753,34330,59393,9754,34331,59393,9755,34332,59393,9756,34333,34334,58369,9758,58625,
+		9758,9758,57914,0,9758,57915,0,9758,57920,0,50177,9758,58369,9769,34335,58369,
+		9759,9759,57920,0,9759,57921,0,34336,58369,9760,9760,57920,0,34337,58369,9761,
+		58625,9761,9761,57920,0,34338,58625,9762,9762,57920,0,34339,9763,57916,0,9763,
+		57920,0,50177,9763,58369,9763,50177,9763,58369,9767,34340,9764,57920,0,34341,34342,
+		9766,57920,0,34343,9767,57911,0,9767,57920,0,50177,9767,50177,9762,50177,9763,
+		58369,9762,50177,9767,58369,9767,50177,9767,50177,9767,57914,0,34344,58625,9768,63745,
+		9768,9768,57920,0,55553,9768,57920,0,9768,57921,0,34345,58625,9769,9769,57920,
+		0,34346,58625,9770,63745,9770,9770,57920,0,34347,63745,9771,9771,57920,0,34348,
+		9772,57920,0,34349,58625,9773,34350,63745,9774,9774,57920,0,55553,9774,57920,0,
+		9774,57921,0,34351,63745,9775,9775,57920,0,34352,9776,57920,0,34353,58625,9777,
+		9777,57920,0,34354,9778,57918,0,9778,57919,0,9778,57920,0,9778,49728,0,
+		57918,0,9778,49728,0,57919,0,34355,58625,9779,9779,57920,0,34356,34357,34358,
+		34359,34360,34361,34362,34363,34364,34365,34366,34367,34368,34369,34370,34371,34372,34373,34374,
+		34375,34376,34377,34378,34379,34380,34381,34382,34383,34384,34385,34386,34387,34388,34389,34390,
+		34391,34392,34393,34394,34395,34396,34397,34398,34399,34400,34401,34402,34403,34404,58369,9828,
+		64001,9828,50177,9828,58618,0,34405,63745,9829,64001,9829,34406,63745,9830,64001,9830,
+		34407,34408,63745,9832,64001,9832,34409,63745,9833,64001,9833,34410,63745,9834,64001,9834,
+		34411,34412,34413,34414,63233,9838,63489,9838,63745,9838,64001,9838,55553,9838,63745,9842,
+		55809,9838,64001,9842,55041,9838,63233,9871,55809,9838,64001,9871,55041,9838,63233,9881,
+		55809,9838,64001,9881,55041,9838,63233,9882,55553,9838,63745,9907,55553,9838,63745,9908,
+		55041,9838,63233,10004,55297,9838,63489,10004,55553,9838,63745,10004,55809,9838,64001,10004,
+		55553,9838,63745,10008,55041,9838,63233,10018,55297,9838,63489,10018,55553,9838,63745,10023,
+		55809,9838,64001,10023,55553,9838,63745,10024,55809,9838,64001,10024,55553,9838,63745,10027,
+		55809,9838,64001,10027,55553,9838,63745,10028,55809,9838,64001,10028,55553,9838,63745,10029,
+		55809,9838,64001,10029,55041,9838,63233,10038,55553,9838,63745,10038,55809,9838,64001,10038,
+		55553,9838,63745,10039,55809,9838,64001,10039,55041,9838,63233,10043,55553,9838,63745,10043,
+		55809,9838,64001,10043,34415,34416,34417,49151,34418,58369,9842,58625,9842,63745,9842,64001,
+		9842,55553,9842,63822,0,55809,9842,64078,0,50177,9842,58369,9828,55809,9842,55809,
+		9974,55809,9844,64001,9907,55809,9842,55809,9996,55809,9996,64001,10018,34419,58625,9843,
+		34420,58625,9844,63233,9844,63489,9844,63745,9844,64001,9844,55041,9844,63233,9871,55809,
+		9844,64001,9871,55041,9844,63233,9881,55809,9844,64001,9881,55553,9844,55553,9881,63745,
+		10039,55041,9844,63233,9882,55809,9844,64001,9882,55553,9844,55553,9882,63745,10039,55553,
+		9844,63745,9907,55553,9844,63745,9908,55041,9844,63233,10004,55297,9844,63489,10004,55553,
+		9844,63745,10004,55809,9844,64001,10004,55553,9844,63745,10008,55041,9844,63233,10018,55297,
+		9844,63489,10018,55553,9844,63745,10038,55809,9844,64001,10038,55553,9844,63745,10039,55809,
+		9844,64001,10039,34421,63233,9845,63489,9845,63745,9845,64001,9845,34422,63233,9846,63489,
+		9846,63745,9846,64001,9846,34423,63233,9847,63489,9847,63745,9847,64001,9847,34424,34425,
+		34426,34427,34428,34429,34430,34431,34432,34433,34434,34435,34436,63745,9860,64001,9860,34437,
+		58625,9861,63233,9861,63489,9861,63745,9861,64001,9861,55041,9861,63233,9871,55809,9861,
+		64001,9871,55041,9861,55041,9871,63233,10004,55553,9861,55553,9871,63745,10038,55553,9861,
+		55553,9871,63745,10039,55041,9861,63233,9881,55809,9861,64001,9881,55041,9861,55041,9881,
+		63233,9871,55553,9861,55553,9881,63745,9871,55041,9861,55041,9881,63233,10004,55041,9861,
+		63233,9882,55809,9861,64001,9882,55041,9861,55041,9882,63233,10004,55553,9861,55553,9882,
+		63745,10038,55553,9861,55553,9882,63745,10039,55553,9861,63745,9907,55553,9861,63745,9908,
+		55041,9861,63233,10004,55297,9861,63489,10004,55553,9861,63745,10004,55809,9861,64001,10004,
+		55041,9861,55041,10004,63233,9871,55041,9861,55041,10004,63233,9881,55041,9861,55041,10004,
+		63233,9882,55553,9861,55553,10004,63745,10038,55553,9861,55553,10004,63745,10039,55553,9861,
+		63745,10008,55041,9861,63233,10018,55297,9861,63489,10018,55553,9861,63745,10038,55809,9861,
+		64001,10038,55553,9861,63745,10039,55809,9861,64001,10039,34438,58625,9862,63233,9862,63489,
+		9862,63745,9862,64001,9862,55809,9862,64001,9871,55553,9862,63745,9907,55553,9862,63745,
+		9908,55041,9862,63233,10004,55297,9862,63489,10004,55553,9862,63745,10004,55809,9862,64001,
+		10004,55553,9862,63745,10008,55297,9862,63489,10018,55553,9862,63745,10038,55809,9862,64001,
+		10038,55553,9862,63745,10039,55809,9862,64001,10039,34439,63233,9863,63489,9863,63745,9863,
+		64001,9863,34440,63233,9864,63489,9864,63745,9864,64001,9864,34441,34442,34443,63233,9867,
+		63489,9867,63745,9867,64001,9867,34444,34445,34446,34447,58625,9871,63233,9871,63489,9871,
+		63745,9871,64001,9871,55041,9871,63233,9881,55809,9871,64001,9881,55553,9871,55553,9881,
+		63745,10038,55553,9871,55553,9881,63745,10039,55809,9871,55809,9996,55809,521,55809,9871,
+		55809,9996,55809,9842,55809,9996,64001,10018,55041,9871,63233,10004,55809,9871,64001,10004,
+		55041,9871,55041,10004,63233,9881,55553,9871,55553,10004,63745,9881,55553,9871,55553,10004,
+		63745,10038,55553,9871,55553,10004,63745,10039,55553,9871,63745,10038,55809,9871,64001,10038,
+		55553,9871,63745,10039,55809,9871,64001,10039,34448,63233,9872,63489,9872,63745,9872,64001,
+		9872,34449,63233,9873,63489,9873,63745,9873,64001,9873,34450,63233,9874,63489,9874,63745,
+		9874,64001,9874,34451,34452,63233,9876,63489,9876,63745,9876,64001,9876,34453,34454,34455,
+		34456,34457,58625,9881,63233,9881,63489,9881,63745,9881,64001,9881,55041,9881,63233,9871,
+		55809,9881,64001,9871,55553,9881,55553,9871,63745,10039,55041,9881,63233,10004,55809,9881,
+		64001,10004,55553,9881,55553,10004,63745,10038,55553,9881,55553,10004,63745,10039,55553,9881,
+		63745,10038,55809,9881,64001,10038,55553,9881,63745,10039,55809,9881,64001,10039,34458,58625,
+		9882,63233,9882,63489,9882,63745,9882,64001,9882,55041,9882,63233,9871,55809,9882,64001,
+		9871,55809,9882,64001,9881,55041,9882,63233,10004,55809,9882,64001,10004,55553,9882,63745,
+		10038,55809,9882,64001,10038,55553,9882,63745,10039,55809,9882,64001,10039,34459,34460,34461,
+		34462,34463,34464,34465,34466,34467,34468,58625,9892,63745,9892,64001,9892,34469,58625,9893,
+		63745,9893,64001,9893,55809,9893,64121,0,34470,63745,9894,64001,9894,34471,34472,34473,
+		34474,63745,9898,64001,9898,34475,63745,9899,64001,9899,34476,34477,63745,9901,64001,9901,
+		34478,34479,34480,34481,34482,34483,58625,9907,63745,9907,64001,9907,55809,9907,64121,0,
+		55809,9907,55809,9926,55809,10024,64001,9996,55809,9907,55809,10040,55809,9842,64001,9996,
+		34484,58625,9908,63745,9908,64001,9908,34485,63745,9909,64001,9909,34486,34487,34488,34489,
+		34490,34491,34492,63745,9916,64001,9916,34493,34494,34495,34496,34497,34498,34499,34500,34501,
+		34502,58625,9926,63233,9926,63489,9926,63745,9926,64001,9926,55041,9926,63233,9871,55297,
+		9926,63489,9871,55809,9926,64001,9871,55041,9926,55041,9871,63233,9881,55553,9926,55553,
+		9871,63745,10038,55041,9926,63233,9881,55297,9926,63489,9881,55809,9926,64001,9881,55041,
+		9926,55041,9881,63233,9871,55041,9926,63233,9882,55297,9926,63489,9882,55809,9926,64001,
+		9882,55553,9926,55553,9882,63745,10038,55553,9926,55553,9882,63745,10039,55553,9926,63745,
+		9907,55809,9926,64001,9907,55041,9926,63233,10004,55297,9926,63489,10004,55809,9926,64001,
+		10004,55041,9926,55041,10004,63233,9871,55041,9926,55041,10004,63233,9881,55553,9926,55553,
+		10004,63745,9881,55041,9926,55041,10004,63233,10004,55553,9926,55553,10004,63745,10004,55041,
+		9926,63233,10018,55297,9926,63489,10018,55553,9926,63745,10038,55809,9926,64001,10038,55553,
+		9926,63745,10039,55809,9926,64001,10039,34503,58625,9927,63233,9927,63489,9927,63745,9927,
+		64001,9927,55041,9927,63233,9871,55297,9927,63489,9871,55553,9927,63745,9871,55809,9927,
+		64001,9871,55553,9927,55553,9871,63745,10039,55041,9927,63233,9881,55297,9927,63489,9881,
+		55553,9927,63745,9881,55809,9927,64001,9881,55041,9927,55041,9881,63233,10004,55553,9927,
+		55553,9881,63745,10004,55553,9927,55553,9881,63745,10039,55041,9927,63233,9882,55297,9927,
+		63489,9882,55553,9927,63745,9882,55809,9927,64001,9882,55553,9927,63745,9907,55809,9927,
+		64001,9907,55041,9927,63233,10004,55297,9927,63489,10004,55553,9927,63745,10004,55809,9927,
+		64001,10004,55041,9927,55041,10004,63233,9882,55553,9927,55553,10004,63745,9882,55041,9927,
+		55041,10004,63233,10004,55553,9927,55553,10004,63745,10004,55041,9927,63233,10018,55297,9927,
+		63489,10018,55553,9927,63745,10038,55809,9927,64001,10038,55553,9927,63745,10039,55809,9927,
+		64001,10039,34504,34505,34506,34507,34508,34509,34510,34511,34512,34513,58625,9937,63233,9937,
+		63489,9937,63745,9937,64001,9937,55041,9937,63233,9881,55809,9937,64001,9881,55041,9937,
+		55041,9881,63233,9881,55553,9937,55553,9881,63745,9881,55553,9937,55553,9881,63745,10039,
+		55041,9937,63233,9882,55553,9937,63745,9907,55809,9937,64001,9907,55809,9937,55809,9996,
+		55809,9947,64001,10004,55809,9937,55809,9996,64001,10038,55809,9937,55809,9996,55809,10038,
+		55809,521,55809,9842,55809,9996,55809,9996,55809,10018,55809,521,55809,9947,55809,9996,
+		55809,10039,55809,10018,55809,521,55809,10024,55809,9926,55809,9996,64001,10004,55809,9937,
+		55809,9996,64001,10053,55041,9937,63233,10004,55809,9937,64001,10004,55041,9937,55041,10004,
+		63233,10004,55553,9937,55553,10004,63745,10004,55553,9937,63745,10038,55809,9937,64001,10038,
+		55553,9937,63745,10039,55809,9937,64001,10039,34514,58625,9938,63233,9938,63489,9938,63745,
+		9938,64001,9938,55041,9938,63233,9871,55809,9938,64001,9871,55041,9938,63233,9881,55809,
+		9938,64001,9881,55553,9938,55553,9881,63745,10038,55553,9938,55553,9881,63745,10039,55041,
+		9938,63233,9882,55809,9938,64001,9882,55041,9938,55041,9882,63233,10004,55553,9938,55553,
+		9882,63745,10004,55553,9938,63745,9907,55809,9938,64001,9907,55041,9938,63233,10004,55809,
+		9938,64001,10004,55553,9938,63745,10038,55809,9938,64001,10038,55553,9938,63745,10039,55809,
+		9938,64001,10039,34515,34516,34517,34518,34519,58625,9943,63233,9943,63489,9943,63745,9943,
+		64001,9943,55041,9943,63233,9881,55809,9943,64001,9881,55041,9943,63233,10004,55297,9943,
+		63489,10004,55809,9943,64001,10004,55041,9943,55041,10004,63233,9881,55553,9943,55553,10004,
+		63745,9881,55041,9943,55041,10004,63233,10004,55553,9943,55553,10004,63745,10039,55553,9943,
+		63745,10038,55809,9943,64001,10038,55553,9943,63745,10039,55809,9943,64001,10039,34520,58625,
+		9944,63233,9944,63489,9944,63745,9944,64001,9944,55041,9944,63233,10004,55297,9944,63489,
+		10004,55809,9944,64001,10004,34521,34522,34523,58625,9947,63233,9947,63489,9947,63745,9947,
+		64001,9947,55041,9947,63233,9871,55809,9947,64001,9871,55041,9947,55041,9871,63233,10004,
+		55553,9947,55553,9871,63745,10004,55809,9947,55809,9996,55809,10039,64001,10018,55041,9947,
+		63233,10004,55809,9947,64001,10004,55041,9947,55041,10004,63233,10004,55553,9947,55553,10004,
+		63745,10004,55553,9947,55553,10004,63745,10038,55553,9947,55553,10004,63745,10039,55553,9947,
+		63745,10038,55809,9947,64001,10038,55553,9947,63745,10039,55809,9947,64001,10039,34524,58625,
+		9948,63233,9948,63489,9948,63745,9948,64001,9948,55041,9948,63233,9871,55809,9948,64001,
+		9871,55041,9948,63233,10004,55809,9948,64001,10004,55553,9948,55553,10004,63745,10004,55553,
+		9948,55553,10004,63745,10038,55553,9948,55553,10004,63745,10039,55553,9948,63745,10038,55809,
+		9948,64001,10038,55553,9948,63745,10039,55809,9948,64001,10039,34525,34526,34527,34528,34529,
+		34530,34531,34532,58625,9956,63233,9956,63489,9956,63745,9956,64001,9956,55041,9956,63233,
+		9871,55809,9956,64001,9871,55041,9956,63233,9881,55809,9956,64001,9881,55041,9956,63233,
+		9882,55809,9956,64001,9882,55041,9956,55041,9882,63233,10004,55553,9956,55553,9882,63745,
+		10004,55041,9956,63233,10004,55809,9956,64001,10004,55553,9956,55553,10004,63745,10039,55553,
+		9956,63745,10038,55809,9956,64001,10038,55553,9956,63745,10039,55809,9956,64001,10039,34533,
+		58625,9957,34534,34535,34536,34537,63233,9961,63489,9961,63745,9961,64001,9961,34538,34539,
+		34540,63233,9964,63489,9964,63745,9964,64001,9964,34541,34542,34543,58625,9967,34544,58625,
+		9968,63233,9968,63489,9968,63745,9968,64001,9968,55041,9968,63233,9881,55809,9968,64001,
+		9881,55809,9968,55809,9996,64001,10053,55041,9968,63233,10004,55809,9968,64001,10004,55041,
+		9968,55041,10004,63233,9881,55553,9968,55553,10004,63745,9881,55553,9968,55553,10004,63745,
+		10004,55553,9968,55553,10004,63745,10039,55553,9968,63745,10038,55809,9968,64001,10038,55553,
+		9968,63745,10039,55809,9968,64001,10039,34545,34546,34547,34548,34549,34550,58625,9974,63233,
+		9974,63489,9974,63745,9974,64001,9974,55553,9974,63745,9842,55809,9974,64001,9842,55041,
+		9974,63233,9871,55809,9974,64001,9871,55041,9974,63233,9881,55809,9974,64001,9881,55041,
+		9974,63233,9882,55809,9974,64001,9882,55041,9974,63233,9996,55297,9974,63489,9996,55553,
+		9974,63745,9996,55809,9974,64001,9996,55041,9974,63233,10004,55297,9974,63489,10004,55553,
+		9974,63745,10004,55809,9974,64001,10004,55041,9974,55041,10004,63233,10004,55553,9974,55553,
+		10004,63745,10004,55553,9974,55553,10004,63745,10039,55553,9974,63745,10038,55809,9974,64001,
+		10038,55553,9974,63745,10039,55809,9974,64001,10039,34551,63233,9975,63489,9975,63745,9975,
+		64001,9975,34552,34553,34554,34555,34556,63233,9980,63489,9980,63745,9980,64001,9980,34557,
+		34558,34559,63233,9983,63489,9983,63745,9983,64001,9983,34560,34561,34562,63233,9986,63489,
+		9986,63745,9986,64001,9986,34563,34564,63233,9988,63489,9988,63745,9988,64001,9988,34565,
+		34566,34567,34568,34569,34570,34571,34572,58625,9996,63233,9996,63489,9996,63745,9996,64001,
+		9996,55553,9996,63745,9829,55809,9996,64001,9829,55553,9996,63745,9830,55809,9996,64001,
+		9830,55553,9996,63745,9834,55809,9996,64001,9834,55553,9996,63745,9842,55809,9996,64001,
+		9842,55041,9996,63233,9871,55809,9996,64001,9871,55041,9996,55041,9871,63233,9871,55553,
+		9996,55553,9871,63745,9871,55041,9996,55041,9871,63233,10004,55553,9996,55553,9871,63745,
+		10004,55553,9996,55553,9871,63745,10039,55041,9996,63233,9881,55809,9996,64001,9881,55041,
+		9996,55041,9881,63233,10004,55553,9996,55553,9881,63745,10004,55553,9996,55553,9881,63745,
+		10038,55553,9996,55553,9881,63745,10039,55041,9996,63233,9882,55809,9996,64001,9882,55041,
+		9996,55041,9882,63233,10004,55553,9996,55553,9882,63745,10004,55041,9996,63233,10004,55297,
+		9996,63489,10004,55553,9996,63745,10004,55809,9996,64001,10004,55041,9996,55041,10004,63233,
+		9881,55553,9996,55553,10004,63745,9881,55553,9996,55553,10004,63745,10039,55041,9996,63233,
+		10018,55553,9996,63745,10038,55809,9996,64001,10038,55553,9996,63745,10039,55809,9996,64001,
+		10039,34573,34574,34575,34576,34577,34578,34579,34580,58625,10004,63233,10004,63489,10004,63745,
+		10004,64001,10004,50177,10004,58618,0,55553,10004,63745,9842,55041,10004,63233,9871,55809,
+		10004,64001,9871,55041,10004,55041,9871,63233,9881,55041,10004,55041,9871,63233,9882,55041,
+		10004,55041,9871,63233,10004,55553,10004,55553,9871,63745,10039,55041,10004,63233,9881,55809,
+		10004,64001,9881,55041,10004,55041,9881,63233,9871,55041,10004,55041,9881,63233,10004,55809,
+		10004,55809,9881,55809,10004,64001,9892,55553,10004,55553,9881,63745,10039,55041,10004,63233,
+		9882,55809,10004,64001,9882,55041,10004,55041,9882,63233,9871,55041,10004,55041,9882,63233,
+		10004,55553,10004,55553,9882,63745,10039,55041,10004,63233,10004,55553,10004,63745,10004,55809,
+		10004,64001,10004,55553,10004,55553,10004,63745,10039,55809,10004,64001,10038,55809,10004,64001,
+		10039,34581,34582,34583,34584,58625,10008,63233,10008,63489,10008,63745,10008,64001,10008,55041,
+		10008,63233,9871,55809,10008,64001,9871,55041,10008,55041,9871,63233,9881,55553,10008,55553,
+		9871,63745,9881,55041,10008,55041,9871,63233,10004,55553,10008,55553,9871,63745,10004,55553,
+		10008,55553,9871,63745,10038,55553,10008,55553,9871,63745,10039,55041,10008,63233,9881,55809,
+		10008,64001,9881,55041,10008,55041,9881,63233,10004,55553,10008,55553,9881,63745,10038,55553,
+		10008,55553,9881,63745,10039,55041,10008,63233,9882,55809,10008,64001,9882,55553,10008,63745,
+		9907,55553,10008,63745,9908,55041,10008,63233,10004,55297,10008,63489,10004,55553,10008,63745,
+		10004,55809,10008,64001,10004,55553,10008,55553,10004,63745,10038,55553,10008,55553,10004,63745,
+		10039,55553,10008,63745,10008,55041,10008,63233,10018,55297,10008,63489,10018,55553,10008,63745,
+		10038,55809,10008,64001,10038,55553,10008,63745,10039,55809,10008,64001,10039,34585,58625,10009,
+		63745,10009,64001,10009,34586,34587,63233,10011,63489,10011,63745,10011,64001,10011,34588,34589,
+		34590,34591,34592,34593,34594,58625,10018,63233,10018,63489,10018,63745,10018,64001,10018,55041,
+		10018,63353,0,55041,10018,63233,9871,55809,10018,64001,9871,55041,10018,63233,10004,55809,
+		10018,64001,10004,55041,10018,55041,10004,63233,9871,55041,10018,55041,10004,63233,10004,55809,
+		10018,64001,10038,55809,10018,64001,10039,34595,63233,10019,63489,10019,63745,10019,64001,10019,
+		34596,63233,10020,63489,10020,63745,10020,64001,10020,10020,57956,0,34597,34598,34599,10023,
+		57956,0,55553,10023,63844,0,55809,10023,64100,0,49151,34600,58369,10024,58625,10024,
+		63745,10024,64001,10024,50177,10024,58369,9828,55809,10024,55809,9926,55809,9996,64001,10004,
+		34601,34602,63745,10026,64001,10026,34603,63745,10027,64001,10027,34604,63745,10028,64001,10028,
+		50177,10028,58369,9828,55809,10028,64001,9828,34605,63745,10029,64001,10029,34606,63745,10030,
+		64001,10030,34607,34608,63745,10032,64001,10032,34609,34610,34611,34612,34613,34614,63233,10038,
+		63489,10038,63745,10038,64001,10038,55553,10038,63865,0,55809,10038,64121,0,49151,34615,
+		58369,10039,58625,10039,63233,10039,63489,10039,63745,10039,64001,10039,50177,10039,58369,9828,
+		55041,10039,63233,9871,55809,10039,64001,9871,55553,10039,55553,9871,63745,10039,55041,10039,
+		63233,9881,55809,10039,64001,9881,55553,10039,55553,9881,63745,10039,55041,10039,63233,9882,
+		55809,10039,64001,9882,55553,10039,63745,9907,55553,10039,63745,9908,55041,10039,63233,10004,
+		55297,10039,63489,10004,55553,10039,63745,10004,55809,10039,64001,10004,55041,10039,55041,10004,
+		63233,10004,55553,10039,55553,10004,63745,10004,55553,10039,55553,10004,63745,10039,55553,10039,
+		63745,10008,55041,10039,63233,10018,55297,10039,63489,10018,55553,10039,63745,10038,55809,10039,
+		64001,10038,55553,10039,63745,10039,55809,10039,64001,10039,34616,63233,10040,63489,10040,63745,
+		10040,64001,10040,34617,34618,34619,63233,10043,63489,10043,63745,10043,64001,10043,34620,34621,
+		34622,34623,34624,34625,34626,34627,34628,34629,63745,10053,64001,10053,10053,57956,0,55553,
+		10053,63844,0,55809,10053,64100,0,34630,34631,34632,34633,50177,10057,58619,0,34634,
+		50177,10058,58618,0,50177,10058,58619,0,34635,34636,50177,10060,58619,0,34637,34638,
+		34639,34640,34641,34642,50177,10066,58618,0,34643,34644,34645,34646,34647,34648,34649,34650,
+		63745,10074,34651,34652,50177,10076,58618,0,34653,34654,34655,34656,34657,34658,34659,34660,
+		34661,34662,34663,34664,34665,34666,34667,34668,34669,34670,34671,34672,34673,34674,34675,34676,
+		34677,34678,34679,34680,34681,34682,34683,34684,34685,34686,34687,34688,34689,34690,34691,34692,
+		34693,34694,34695,34696,34697,34698,34699,34700,34701,34702,34703,34704,34705,34706,34707,34708,
+		34709,34710,34711,34712,34713,34714,34715,34716,34717,34718,34719,34720,34721,34722,34723,34724,
+		34725,34726,34727,34728,34729,34730,34731,34732,34733,34734,34735,34736,34737,34738,34739,34740,
+		34741,34742,34743,34744,34745,34746,34747,34748,34749,34750,34751,34752,34753,34754,34755,34756,
+		34757,50177,10181,58617,0,34758,50177,10182,58617,0,34759,34760,50177,10184,58617,0,
+		34761,34762,34763,34764,34765,34766,34767,34768,34769,34770,34771,34772,34773,34774,34775,34776,
+		34777,34778,34779,34780,34781,34782,34783,34784,34785,34786,34787,34788,34789,34790,34791,34792,
+		34793,34794,34795,34796,34797,34798,34799,34800,34801,34802,34803,34804,34805,34806,34807,34808,
+		34809,34810,34811,34812,34813,34814,34815,34816,34817,34818,34819,34820,34821,34822,34823,34824,
+		34825,34826,34827,34828,34829,34830,34831,34832,34833,34834,34835,34836,34837,34838,34839,34840,
+		34841,34842,34843,34844,34845,34846,34847,34848,34849,34850,34851,34852,34853,34854,34855,34856,
+		34857,34858,34859,34860,34861,34862,34863,34864,34865,34866,34867,34868,34869,34870,34871,34872,
+		34873,34874,34875,34876,34877,34878,34879,34880,34881,34882,34883,34884,34885,34886,34887,34888,
+		34889,34890,34891,34892,34893,34894,34895,34896,34897,34898,34899,34900,34901,34902,34903,34904,
+		34905,34906,34907,34908,34909,34910,34911,34912,34913,34914,34915,34916,34917,34918,34919,34920,
+		34921,34922,34923,34924,34925,34926,34927,34928,34929,34930,34931,34932,34933,34934,34935,34936,
+		34937,34938,34939,34940,34941,34942,34943,34944,34945,34946,34947,34948,34949,34950,34951,34952,
+		34953,34954,34955,34956,34957,34958,34959,34960,34961,34962,34963,34964,34965,34966,34967,34968,
+		34969,34970,34971,34972,34973,34974,34975,34976,34977,34978,34979,34980,34981,34982,34983,34984,
+		34985,34986,34987,34988,34989,34990,34991,34992,34993,34994,34995,34996,34997,34998,34999,35000,
+		35001,35002,35003,35004,35005,35006,35007,35008,35009,35010,35011,35012,35013,35014,35015,35016,
+		35017,35018,35019,35020,35021,35022,35023,35024,35025,35026,35027,35028,35029,35030,35031,35032,
+		35033,35034,35035,35036,35037,35038,35039,35040,35041,35042,35043,35044,35045,35046,35047,35048,
+		35049,35050,35051,35052,35053,35054,35055,35056,35057,35058,35059,35060,35061,35062,35063,35064,
+		35065,35066,35067,35068,35069,35070,35071,35072,35073,35074,35075,35076,35077,35078,35079,35080,
+		35081,35082,35083,35084,35085,35086,35087,35088,35089,35090,35091,35092,35093,35094,35095,35096,
+		35097,35098,35099,35100,35101,35102,35103,35104,35105,35106,35107,35108,35109,35110,35111,35112,
+		35113,35114,35115,35116,35117,35118,35119,35120,35121,35122,35123,35124,35125,35126,35127,35128,
+		35129,35130,35131,35132,35133,35134,35135,35136,35137,35138,35139,35140,35141,35142,35143,35144,
+		35145,35146,35147,35148,35149,35150,35151,35152,35153,35154,35155,35156,35157,35158,35159,35160,
+		35161,35162,35163,35164,35165,35166,35167,35168,35169,35170,35171,35172,35173,35174,35175,35176,
+		35177,35178,35179,35180,35181,35182,35183,35184,35185,35186,35187,35188,35189,35190,35191,35192,
+		35193,35194,35195,35196,35197,35198,35199,35200,35201,35202,35203,35204,35205,35206,35207,35208,
+		35209,35210,35211,35212,35213,35214,35215,35216,35217,35218,35219,35220,35221,35222,35223,35224,
+		35225,35226,35227,35228,35229,35230,35231,35232,35233,35234,35235,35236,35237,35238,35239,35240,
+		35241,35242,35243,35244,35245,35246,35247,35248,35249,35250,35251,35252,35253,35254,35255,35256,
+		35257,35258,35259,35260,35261,35262,35263,35264,35265,35266,35267,35268,35269,35270,35271,35272,
+		35273,35274,35275,35276,35277,35278,35279,35280,35281,35282,35283,35284,35285,35286,35287,35288,
+		35289,35290,35291,35292,35293,35294,35295,35296,35297,35298,35299,35300,35301,35302,35303,35304,
+		35305,35306,35307,35308,35309,35310,35311,35312,35313,35314,35315,10739,58019,0,35316,10740,
+		58019,0,35317,10741,58019,0,35318,35319,35320,35321,35322,35323,10747,58019,0,35324,
+		35325,35326,35327,35328,35329,35330,35331,10755,58019,0,35332,35333,10757,58019,0,35334,
+		35335,35336,35337,35338,35339,10763,58019,0,35340,35341,10765,58019,0,35342,35343,35344,
+		35345,35346,10770,58019,0,35347,35348,10772,58019,0,35349,35350,10774,58019,0,35351,
+		35352,35353,35354,35355,35356,35357,35358,58369,10782,35359,35360,35361,58369,10785,35362,35363,
+		35364,35365,35366,35367,35368,35369,35370,35371,35372,35373,35374,35375,35376,35377,35378,35379,
+		35380,35381,35382,35383,35384,35385,35386,35387,35388,35389,35390,35391,35392,35393,35394,35395,
+		35396,35397,35398,35399,35400,35401,35402,35403,35404,35405,35406,35407,35408,35409,35410,35411,
+		35412,35413,35414,35415,35416,10840,58019,0,35417,10841,58019,0,35418,35419,50177,10843,
+		58369,10876,35420,35421,35422,35423,35424,35425,35426,35427,35428,35429,10853,58019,0,35430,
+		35431,35432,35433,35434,35435,35436,35437,35438,35439,35440,35441,35442,35443,35444,35445,35446,
+		35447,49151,35448,35449,35450,35451,35452,35453,35454,35455,35456,35457,35458,35459,35460,35461,
+		35462,35463,35464,35465,35466,35467,35468,10892,58019,0,35469,35470,35471,35472,10896,58019,
+		0,35473,10897,58019,0,35474,35475,35476,35477,35478,10902,58019,0,35479,35480,35481,
+		35482,35483,35484,35485,35486,35487,35488,35489,35490,35491,35492,10916,58019,0,35493,35494,
+		35495,35496,35497,35498,35499,10923,58019,0,35500,35501,35502,35503,35504,35505,35506,35507,
+		35508,35509,35510,35511,35512,35513,35514,35515,35516,35517,35518,35519,35520,35521,35522,35523,
+		35524,35525,35526,35527,35528,35529,35530,35531,35532,35533,35534,35535,35536,35537,35538,35539,
+		35540,35541,35542,35543,35544,35545,35546,35547,35548,35549,35550,35551,35552,35553,35554,35555,
+		35556,35557,35558,35559,35560,35561,35562,35563,35564,35565,35566,35567,35568,35569,35570,35571,
+		35572,35573,35574,35575,35576,35577,35578,35579,35580,35581,35582,35583,35584,35585,35586,35587,
+		35588,35589,35590,35591,35592,35593,35594,35595,35596,35597,35598,35599,35600,35601,35602,35603,
+		35604,35605,35606,35607,11031,58019,0,35608,11032,58019,0,35609,35610,35611,35612,35613,
+		35614,35615,35616,35617,35618,35619,35620,35621,35622,35623,35624,35625,35626,35627,35628,35629,
+		35630,35631,35632,35633,35634,35635,35636,35637,35638,35639,35640,49151,35641,35642,35643,35644,
+		35645,35646,35647,35648,35649,35650,35651,35652,35653,35654,35655,35656,35657,49151,35658,35659,
+		35660,35661,35662,35663,35664,35665,35666,35667,35668,35669,35670,35671,35672,35673,35674,35675,
+		35676,35677,35678,35679,35680,35681,35682,35683,35684,35685,35686,35687,35688,35689,49151,35690,
+		49151,35691,35692,35693,35694,35695,35696,35697,35698,35699,35700,35701,35702,35703,35704,35705,
+		35706,35707,35708,35709,35710,35711,35712,35713,35714,35715,35716,35717,35718,35719,35720,35721,
+		35722,35723,35724,35725,35726,35727,35728,35729,35730,35731,35732,35733,35734,35735,35736,35737,
+		35738,35739,35740,35741,35742,35743,35744,35745,35746,35747,35748,35749,35750,35751,35752,35753,
+		35754,35755,35756,35757,35758,35759,35760,35761,35762,49151,35763,35764,35765,35766,35767,35768,
+		35769,35770,35771,35772,35773,35774,35775,35776,35777,35778,35779,35780,35781,35782,35783,35784,
+		35785,35786,35787,35788,35789,35790,35791,35792,35793,35794,35795,35796,35797,35798,35799,35800,
+		35801,35802,35803,35804,35805,35806,35807,35808,35809,35810,35811,35812,35813,35814,35815,35816,
+		35817,35818,35819,35820,35821,35822,35823,35824,35825,35826,35827,35828,49151,35829,35830,35831,
+		35832,35833,35834,35835,35836,49151,35837,35838,35839,49151,35840,35841,35842,35843,35844,35845,
+		35846,35847,35848,35849,35850,35851,35852,35853,35854,35855,35856,35857,35858,35859,35860,35861,
+		35862,35863,50177,11287,58369,11343,35864,35865,35866,35867,35868,35869,35870,35871,35872,35873,
+		35874,35875,35876,35877,50177,11301,58369,11343,35878,35879,35880,35881,35882,50177,11306,58369,
+		11343,35883,35884,35885,35886,35887,35888,50177,11312,58369,11343,35889,50177,11313,58369,11343,
+		35890,50177,11314,58369,11343,35891,50177,11315,58369,11343,35892,35893,35894,35895,35896,35897,
+		50177,11321,58369,11343,35898,50177,11322,58369,11343,35899,35900,35901,35902,35903,35904,35905,
+		35906,35907,35908,35909,35910,35911,49151,35912,49151,35913,35914,35915,35916,35917,35918,35919,
+		58369,11343,35920,35921,35922,35923,35924,35925,35926,35927,35928,35929,35930,35931,35932,35933,
+		35934,35935,35936,35937,35938,35939,35940,35941,35942,35943,35944,35945,35946,35947,35948,35949,
+		35950,35951,35952,35953,35954,35955,35956,35957,35958,35959,35960,35961,35962,35963,35964,35965,
+		35966,35967,35968,35969,35970,35971,35972,35973,35974,35975,35976,35977,35978,35979,35980,35981,
+		35982,35983,35984,35985,35986,35987,35988,35989,49151,35990,35991,35992,49151,35993,35994,35995,
+		35996,35997,35998,35999,36000,36001,36002,36003,36004,36005,36006,36007,36008,36009,36010,36011,
+		36012,36013,36014,36015,36016,36017,36018,36019,36020,36021,36022,36023,36024,36025,36026,36027,
+		36028,36029,36030,36031,36032,36033,36034,36035,36036,36037,36038,36039,36040,36041,36042,36043,
+		36044,36045,36046,36047,36048,36049,36050,36051,36052,36053,36054,36055,36056,36057,36058,36059,
+		36060,36061,36062,36063,36064,36065,36066,36067,36068,36069,36070,36071,36072,36073,36074,36075,
+		36076,36077,36078,36079,36080,36081,36082,36083,36084,36085,36086,36087,36088,36089,36090,36091,
+		36092,36093,36094,36095,36096,36097,36098,36099,36100,36101,36102,36103,36104,36105,36106,36107,
+		36108,36109,36110,36111,36112,36113,36114,36115,36116,36117,36118,36119,36120,36121,36122,36123,
+		36124,36125,36126,36127,36128,36129,36130,36131,36132,36133,36134,36135,36136,36137,36138,36139,
+		36140,36141,36142,36143,36144,36145,36146,36147,36148,36149,36150,36151,36152,36153,36154,36155,
+		36156,36157,36158,36159,36160,36161,36162,36163,36164,36165,36166,36167,36168,36169,36170,36171,
+		36172,36173,36174,36175,36176,36177,36178,36179,36180,36181,36182,36183,36184,36185,36186,36187,
+		36188,36189,11613,58019,0,36190,11614,58019,0,36191,36192,36193,36194,36195,36196,36197,
+		36198,36199,11623,58019,0,36200,36201,36202,36203,36204,36205,36206,36207,36208,36209,36210,
+		36211,36212,36213,36214,36215,36216,36217,36218,36219,36220,36221,36222,36223,36224,36225,36226,
+		36227,36228,36229,36230,36231,36232,36233,36234,36235,36236,36237,36238,36239,36240,36241,36242,
+		36243,36244,36245,36246,36247,36248,36249,36250,36251,36252,36253,36254,36255,36256,36257,36258,
+		36259,36260,36261,36262,36263,36264,36265,36266,36267,36268,36269,36270,36271,36272,36273,36274,
+		36275,36276,36277,36278,36279,36280,36281,36282,36283,36284,36285,36286,36287,36288,36289,36290,
+		36291,36292,36293,36294,36295,36296,36297,36298,36299,36300,36301,36302,36303,36304,36305,36306,
+		36307,36308,36309,36310,36311,36312,36313,36314,36315,36316,36317,36318,36319,36320,36321,36322,
+		36323,36324,36325,36326,36327,36328,36329,36330,36331,36332,36333,36334,36335,36336,36337,36338,
+		36339,36340,36341,36342,36343,36344,36345,36346,36347,36348,36349,36350,36351,36352,36353,36354,
+		36355,36356,36357,36358,36359,36360,36361,36362,36363,36364,36365,36366,36367,36368,36369,36370,
+		36371,36372,36373,36374,36375,36376,36377,36378,36379,36380,36381,36382,36383,36384,36385,36386,
+		36387,36388,36389,36390,36391,36392,36393,36394,36395,36396,36397,36398,36399,36400,36401,36402,
+		36403,36404,36405,36406,36407,36408,36409,36410,36411,36412,36413,36414,36415,36416,36417,36418,
+		36419,36420,36421,36422,36423,36424,36425,36426,36427,36428,36429,36430,36431,36432,36433,36434,
+		36435,36436,36437,36438,36439,36440,36441,36442,36443,36444,36445,36446,36447,36448,36449,36450,
+		36451,36452,36453,36454,36455,36456,36457,36458,36459,36460,36461,36462,36463,36464,36465,36466,
+		36467,36468,36469,36470,36471,36472,36473,36474,36475,36476,36477,36478,36479,36480,36481,36482,
+		36483,36484,36485,36486,36487,36488,36489,36490,36491,36492,36493,36494,36495,36496,36497,36498,
+		36499,36500,36501,36502,36503,36504,36505,36506,36507,36508,36509,36510,36511,36512,36513,36514,
+		36515,36516,36517,36518,36519,36520,36521,36522,36523,36524,36525,36526,36527,36528,36529,36530,
+		49151,36531,36532,36533,36534,36535,36536,36537,36538,36539,36540,36541,36542,36543,36544,36545,
+		36546,36547,36548,36549,36550,36551,36552,36553,36554,36555,36556,36557,36558,36559,36560,36561,
+		36562,36563,36564,36565,36566,36567,36568,36569,36570,36571,36572,36573,36574,36575,36576,36577,
+		36578,36579,36580,36581,36582,36583,36584,36585,36586,36587,36588,36589,36590,36591,36592,36593,
+		36594,36595,36596,36597,36598,36599,36600,36601,36602,36603,36604,36605,36606,36607,36608,36609,
+		36610,36611,36612,36613,36614,36615,36616,36617,36618,36619,36620,36621,36622,36623,36624,36625,
+		36626,36627,36628,36629,36630,36631,36632,36633,36634,36635,36636,36637,36638,36639,36640,36641,
+		36642,36643,36644,36645,36646,36647,36648,36649,36650,36651,36652,36653,36654,36655,36656,36657,
+		36658,36659,36660,36661,36662,36663,36664,36665,36666,36667,36668,36669,36670,36671,49151,36672,
+		36673,36674,36675,36676,36677,36678,36679,36680,36681,50177,12105,58617,0,50177,12105,58618,
+		0,36682,50177,12106,58617,0,36683,50177,12107,58617,0,36684,36685,36686,36687,36688,
+		36689,36690,36691,36692,36693,36694,36695,36696,36697,36698,36699,36700,36701,36702,36703,36704,
+		36705,36706,36707,36708,36709,36710,36711,36712,36713,36714,36715,36716,36717,36718,36719,36720,
+		36721,36722,36723,36724,36725,36726,36727,36728,36729,50177,12153,58617,0,36730,50177,12154,
+		58617,0,36731,36732,49151,36733,49151,36734,36735,36736,36737,36738,36739,36740,36741,36742,
+		36743,36744,36745,36746,36747,36748,36749,36750,36751,36752,36753,36754,36755,36756,36757,36758,
+		36759,36760,36761,36762,36763,36764,36765,36766,36767,36768,36769,36770,36771,36772,36773,36774,
+		36775,36776,36777,36778,36779,36780,36781,36782,36783,36784,36785,36786,36787,36788,36789,36790,
+		36791,36792,36793,36794,36795,36796,36797,36798,36799,36800,36801,36802,36803,36804,36805,36806,
+		36807,36808,36809,36810,36811,36812,36813,36814,36815,36816,36817,36818,36819,36820,36821,36822,
+		36823,36824,36825,36826,36827,36828,36829,36830,36831,36832,36833,36834,36835,36836,36837,36838,
+		36839,36840,36841,36842,36843,36844,36845,36846,36847,36848,36849,36850,36851,36852,36853,36854,
+		36855,36856,36857,36858,36859,36860,36861,36862,36863,36864,36865,36866,36867,36868,36869,36870,
+		36871,36872,36873,36874,36875,36876,36877,36878,36879,36880,36881,36882,36883,36884,36885,36886,
+		36887,36888,36889,36890,36891,36892,36893,36894,36895,36896,36897,36898,36899,36900,36901,36902,
+		36903,36904,36905,49151,36906,36907,36908,36909,36910,36911,36912,36913,36914,36915,36916,36917,
+		36918,36919,36920,36921,36922,36923,36924,36925,36926,36927,36928,36929,36930,36931,36932,36933,
+		36934,36935,36936,36937,36938,36939,36940,36941,36942,36943,36944,36945,36946,36947,36948,36949,
+		36950,36951,36952,36953,36954,36955,36956,36957,36958,36959,36960,36961,36962,36963,36964,36965,
+		36966,36967,36968,36969,36970,36971,36972,36973,36974,36975,36976,36977,36978,36979,36980,36981,
+		36982,36983,36984,36985,36986,36987,36988,36989,36990,36991,36992,36993,36994,36995,36996,36997,
+		36998,36999,37000,37001,37002,37003,37004,37005,37006,37007,37008,37009,37010,37011,37012,37013,
+		37014,37015,37016,37017,37018,37019,37020,37021,37022,37023,37024,37025,37026,37027,37028,37029,
+		37030,37031,37032,37033,50177,12457,58617,0,37034,37035,37036,50177,12460,58617,0,37037,
+		37038,37039,37040,37041,37042,37043,37044,37045,37046,37047,37048,37049,50177,12473,58617,0,
+		37050,37051,37052,37053,37054,37055,37056,37057,37058,37059,37060,37061,37062,37063,37064,37065,
+		37066,37067,37068,37069,37070,37071,37072,37073,37074,37075,37076,37077,37078,37079,37080,37081,
+		37082,37083,37084,37085,37086,37087,37088,37089,37090,37091,37092,37093,37094,37095,37096,37097,
+		37098,37099,37100,37101,37102,37103,37104,63233,12528,63745,12528,37105,37106,37107,37108,37109,
+		37110,37111,37112,37113,37114,37115,37116,37117,37118,37119,37120,37121,37122,37123,37124,37125,
+		37126,37127,37128,37129,37130,37131,37132,37133,37134,37135,37136,37137,37138,37139,37140,37141,
+		37142,37143,37144,37145,37146,37147,37148,37149,37150,37151,37152,37153,37154,37155,37156,37157,
+		37158,37159,37160,37161,37162,37163,37164,37165,37166,37167,37168,37169,37170,37171,37172,37173,
+		37174,37175,37176,37177,37178,58369,12602,37179,37180,37181,37182,37183,37184,37185,63745,12609,
+		37186,37187,37188,37189,37190,37191,37192,37193,37194,37195,37196,37197,37198,37199,37200,37201,
+		37202,63745,12626,37203,37204,37205,37206,37207,37208,37209,37210,37211,37212,37213,37214,37215,
+		37216,37217,37218,37219,37220,37221,37222,37223,37224,37225,37226,37227,37228,37229,37230,37231,
+		37232,37233,37234,37235,37236,37237,37238,37239,37240,37241,37242,37243,37244,37245,37246,37247,
+		37248,37249,37250,37251,37252,37253,37254,37255,37256,37257,37258,37259,37260,37261,37262,37263,
+		37264,37265,37266,37267,37268,37269,37270,37271,37272,37273,37274,37275,37276,37277,37278,37279,
+		37280,37281,37282,37283,37284,37285,37286,37287,37288,37289,37290,37291,37292,37293,37294,37295,
+		37296,37297,37298,37299,37300,37301,37302,37303,37304,37305,37306,37307,37308,37309,37310,37311,
+		37312,37313,37314,37315,37316,37317,37318,37319,37320,37321,37322,37323,37324,37325,37326,37327,
+		37328,37329,37330,37331,37332,37333,37334,37335,37336,37337,37338,37339,37340,37341,37342,37343,
+		37344,37345,37346,37347,37348,37349,37350,37351,37352,37353,37354,37355,37356,37357,37358,37359,
+		37360,37361,37362,37363,37364,37365,37366,37367,37368,37369,37370,37371,37372,37373,37374,37375,
+		37376,37377,37378,37379,37380,37381,37382,37383,37384,37385,37386,37387,37388,37389,37390,37391,
+		37392,37393,37394,37395,37396,37397,37398,37399,37400,37401,37402,37403,37404,37405,37406,37407,
+		37408,37409,37410,37411,37412,37413,37414,37415,37416,37417,37418,37419,37420,37421,37422,37423,
+		37424,37425,37426,37427,37428,37429,37430,37431,37432,37433,37434,37435,37436,37437,37438,37439,
+		37440,37441,37442,37443,37444,37445,37446,37447,37448,37449,37450,37451,37452,37453,37454,37455,
+		37456,49151,37457,49151,37458,49151,37459,49151,37460,49151,37461,37462,37463,37464,37465,37466,
+		37467,37468,37469,37470,37471,37472,37473,37474,37475,37476,37477,37478,37479,37480,37481,37482,
+		37483,37484,37485,37486,37487,37488,37489,37490,37491,37492,37493,37494,37495,37496,37497,37498,
+		37499,37500,37501,37502,50177,12926,58369,12911,50177,12926,58369,12919,37503,37504,37505,37506,
+		37507,37508,37509,37510,37511,37512,37513,37514,37515,37516,37517,37518,37519,37520,49151,37521,
+		49151,37522,49151,37523,49151,37524,49151,37525,37526,37527,37528,37529,37530,37531,37532,37533,
+		37534,37535,37536,37537,37538,37539,37540,37541,37542,37543,37544,37545,37546,37547,37548,37549,
+		37550,37551,37552,37553,37554,37555,37556,37557,37558,37559,37560,37561,37562,37563,37564,37565,
+		37566,37567,37568,37569,37570,37571,37572,37573,37574,37575,37576,37577,37578,49151,37579,49151,
+		37580,37581,37582,49151,37583,37584,49151,37585,49151,37586,37587,37588,37589,37590,37591,37592,
+		37593,13017,37658,37594,13018,37658,37595,37596,37597,37598,13022,37662,37599,13023,37662,37600,
+		37601,37602,37603,37604,37605,37606,37607,37608,37609,37610,37611,37612,37613,37614,13038,37662,
+		37615,13039,37662,37616,37617,37618,37619,37620,37621,37622,13046,37662,37623,13047,37662,37624,
+		37625,37626,37627,37628,37629,37630,13054,37662,37631,13055,37662,37632,37633,37634,37635,37636,
+		37637,37638,13062,37662,37639,13063,37662,37640,37641,50177,13065,58618,0,37642,37643,37644,
+		37645,37646,37647,37648,37649,50177,13073,58618,0,37650,50177,13074,58618,0,49151,37651,
+		50177,13075,58618,0,37652,37653,49151,37654,37655,37656,37657,37658,37659,37660,37661,37662,
+		37663,50177,13087,50177,13110,58533,0,37664,37665,37666,37667,37668,37669,37670,37671,37672,
+		49151,37673,37674,37675,37676,37677,37678,37679,37680,37681,37682,37683,37684,37685,37686,37687,
+		37688,37689,37690,37691,37692,37693,37694,37695,37696,37697,37698,37699,37700,37701,37702,37703,
+		37704,37705,37706,37707,37708,37709,37710,37711,37712,37713,37714,37715,37716,37717,37718,37719,
+		37720,37721,63745,13145,37722,63233,13146,63745,13146,37723,63745,13147,37724,63745,13148,37725,
+		37726,37727,37728,37729,37730,37731,37732,37733,37734,37735,37736,37737,37738,37739,37740,37741,
+		37742,37743,37744,37745,37746,37747,37748,37749,37750,37751,37752,37753,37754,63745,13178,37755,
+		37756,63745,13180,37757,37758,37759,63745,13183,37760,37761,37762,37763,37764,37765,37766,37767,
+		37768,37769,37770,63745,13194,37771,37772,37773,37774,63745,13198,37775,63745,13199,37776,37777,
+		37778,37779,63745,13203,37780,37781,37782,37783,37784,37785,63745,13209,37786,37787,63233,13211,
+		63745,13211,37788,63233,13212,63745,13212,37789,37790,63233,13214,63745,13214,37791,37792,63233,
+		13216,63745,13216,37793,37794,37795,37796,37797,37798,37799,37800,37801,37802,37803,37804,37805,
+		37806,37807,37808,37809,37810,37811,37812,37813,37814,37815,37816,37817,37818,37819,37820,37821,
+		37822,37823,37824,37825,37826,37827,37828,37829,37830,37831,37832,37833,37834,37835,37836,37837,
+		37838,37839,37840,37841,37842,37843,37844,37845,37846,37847,37848,37849,37850,37851,37852,37853,
+		37854,37855,37856,37857,37858,37859,37860,37861,37862,37863,37864,37865,37866,37867,37868,37869,
+		37870,37871,37872,37873,37874,37875,37876,37877,37878,37879,37880,37881,37882,37883,37884,37885,
+		37886,37887,37888,37889,37890,37891,37892,37893,37894,37895,37896,37897,37898,37899,37900,37901,
+		37902,37903,37904,37905,37906,37907,37908,37909,37910,37911,37912,37913,37914,37915,37916,37917,
+		37918,37919,37920,37921,37922,37923,37924,37925,37926,37927,37928,37929,37930,37931,37932,37933,
+		37934,37935,37936,37937,37938,37939,37940,37941,37942,37943,37944,37945,37946,37947,37948,37949,
+		37950,37951,37952,37953,37954,37955,37956,37957,37958,37959,37960,37961,37962,37963,37964,37965,
+		37966,37967,37968,37969,37970,37971,37972,37973,37974,37975,37976,37977,37978,37979,37980,50177,
+		13404,58369,13434,37981,37982,37983,50177,13407,58369,13435,37984,37985,37986,37987,37988,37989,
+		37990,37991,37992,37993,37994,37995,37996,37997,37998,37999,38000,38001,38002,38003,38004,38005,
+		38006,38007,38008,38009,38010,38011,38012,38013,38014,38015,38016,38017,38018,38019,38020,38021,
+		38022,38023,38024,38025,38026,38027,38028,38029,38030,38031,38032,38033,38034,38035,38036,38037,
+		38038,38039,38040,38041,38042,38043,38044,38045,38046,38047,38048,38049,38050,38051,38052,38053,
+		38054,38055,38056,38057,38058,38059,38060,38061,38062,38063,38064,38065,38066,38067,38068,38069,
+		38070,38071,38072,38073,38074,38075,38076,38077,38078,38079,38080,38081,38082,38083,38084,38085,
+		38086,38087,38088,38089,38090,38091,38092,38093,38094,38095,38096,38097,38098,38099,38100,38101,
+		38102,38103,38104,38105,38106,38107,38108,38109,38110,38111,38112,38113,38114,38115,38116,38117,
+		38118,38119,38120,38121,38122,38123,38124,38125,38126,38127,38128,38129,38130,38131,38132,38133,
+		38134,38135,38136,38137,38138,38139,38140,38141,38142,38143,38144,38145,38146,38147,38148,38149,
+		38150,38151,38152,58369,13576,38153,58369,13577,38154,58369,13578,38155,58369,13579,38156,58369,
+		13580,38157,58369,13581,38158,58369,13582,38159,38160,38161,58369,13585,38162,58369,13586,38163,
+		58369,13587,38164,58369,13588,38165,58369,13589,38166,38167,58369,13591,38168,38169,38170,38171,
+		38172,38173,38174,58369,13598,38175,38176,58369,13600,38177,58369,13601,38178,58369,13602,38179,
+		38180,38181,38182,38183,38184,38185,38186,38187,38188,38189,38190,38191,38192,38193,38194,38195,
+		38196,38197,38198,38199,38200,38201,38202,38203,38204,38205,38206,38207,38208,38209,38210,38211,
+		38212,38213,38214,38215,38216,38217,38218,38219,38220,38221,38222,38223,38224,38225,38226,38227,
+		38228,38229,38230,38231,38232,38233,38234,38235,38236,38237,38238,38239,38240,38241,38242,38243,
+		38244,38245,38246,38247,38248,38249,38250,38251,38252,38253,38254,38255,38256,38257,38258,38259,
+		38260,38261,38262,38263,38264,38265,38266,38267,38268,38269,38270,38271,38272,38273,38274,38275,
+		38276,38277,38278,38279,38280,38281,38282,38283,38284,38285,38286,38287,38288,38289,38290,38291,
+		38292,38293,38294,38295,38296,38297,38298,38299,38300,38301,38302,38303,38304,38305,38306,38307,
+		38308,38309,38310,38311,38312,38313,38314,38315,38316,38317,38318,38319,38320,38321,38322,38323,
+		38324,38325,38326,38327,38328,38329,38330,38331,38332,38333,38334,38335,38336,38337,38338,38339,
+		38340,38341,38342,38343,38344,38345,50177,13769,50177,13826,58369,13769,38346,38347,38348,38349,
+		38350,38351,38352,38353,38354,38355,38356,38357,38358,38359,38360,38361,38362,38363,49151,38364,
+		38365,38366,38367,38368,38369,38370,38371,38372,38373,38374,58369,13798,38375,38376,38377,38378,
+		38379,38380,38381,38382,38383,38384,38385,38386,38387,38388,38389,38390,38391,38392,38393,38394,
+		38395,38396,38397,38398,38399,38400,38401,38402,38403,38404,38405,38406,38407,38408,38409,38410,
+		38411,38412,38413,38414,38415,38416,38417,38418,38419,38420,38421,38422,38423,38424,38425,38426,
+		38427,38428,38429,38430,38431,38432,38433,38434,38435,38436,38437,38438,38439,38440,38441,38442,
+		38443,38444,38445,38446,38447,38448,38449,38450,38451,38452,38453,38454,38455,38456,38457,38458,
+		38459,38460,38461,38462,38463,38464,38465,38466,38467,38468,38469,38470,38471,38472,38473,38474,
+		38475,38476,38477,38478,38479,38480,38481,38482,38483,38484,38485,38486,38487,38488,38489,38490,
+		38491,38492,38493,38494,38495,38496,38497,38498,38499,38500,38501,38502,38503,38504,38505,38506,
+		38507,38508,38509,38510,49151,38511,49151,38512,38513,38514,38515,38516,38517,38518,38519,38520,
+		38521,38522,38523,38524,38525,38526,38527,38528,38529,38530,38531,38532,38533,38534,38535,38536,
+		38537,38538,38539,38540,38541,38542,38543,38544,38545,38546,38547,38548,38549,38550,38551,38552,
+		38553,38554,38555,38556,38557,38558,38559,38560,38561,38562,38563,38564,38565,38566,38567,38568,
+		38569,38570,38571,38572,38573,38574,38575,38576,38577,38578,38579,38580,38581,38582,38583,38584,
+		38585,38586,38587,38588,38589,38590,38591,38592,38593,38594,38595,38596,38597,38598,38599,38600,
+		38601,38602,38603,38604,38605,38606,38607,38608,38609,38610,38611,38612,38613,38614,38615,38616,
+		38617,38618,38619,38620,38621,38622,38623,38624,38625,38626,38627,38628,38629,38630,38631,38632,
+		38633,38634,38635,38636,38637,38638,38639,38640,38641,38642,38643,38644,38645,38646,38647,38648,
+		38649,38650,50177,14074,58369,14096,50177,14074,50177,14096,58369,14107,38651,38652,38653,38654,
+		38655,38656,38657,38658,38659,38660,38661,38662,38663,38664,38665,38666,38667,38668,38669,38670,
+		49151,38671,49151,38672,49151,38673,38674,38675,49151,38676,38677,38678,38679,38680,38681,38682,
+		38683,38684,38685,38686,38687,38688,38689,38690,38691,38692,38693,38694,38695,38696,38697,38698,
+		58369,14122,38699,38700,38701,38702,38703,38704,38705,38706,38707,38708,38709,38710,38711,38712,
+		38713,38714,38715,38716,38717,38718,38719,58369,14143,38720,38721,38722,38723,38724,38725,38726,
+		38727,38728,38729,38730,50177,14154,50177,14192,58369,14154,38731,38732,38733,38734,38735,38736,
+		38737,38738,38739,38740,38741,38742,38743,38744,38745,38746,38747,38748,38749,38750,38751,38752,
+		38753,38754,58369,14178,38755,38756,38757,38758,38759,38760,38761,38762,38763,38764,38765,38766,
+		38767,38768,38769,38770,38771,38772,38773,38774,38775,38776,38777,38778,38779,38780,38781,38782,
+		38783,38784,38785,38786,38787,38788,38789,38790,38791,38792,38793,38794,38795,38796,38797,38798,
+		38799,38800,38801,38802,38803,38804,38805,38806,38807,38808,38809,38810,38811,38812,38813,38814,
+		38815,38816,38817,38818,38819,38820,38821,38822,38823,38824,38825,38826,38827,38828,38829,38830,
+		38831,38832,38833,38834,38835,38836,38837,49151,38838,38839,49151,38840,38841,49151,38842,38843,
+		49151,38844,38845,49151,38846,38847,38848,38849,49151,38850,38851,38852,38853,38854,38855,38856,
+		38857,38858,38859,38860,38861,38862,38863,38864,38865,38866,38867,38868,38869,38870,38871,38872,
+		38873,38874,38875,38876,38877,38878,38879,38880,38881,38882,38883,38884,38885,38886,38887,38888,
+		38889,38890,38891,38892,38893,38894,38895,38896,49151,38897,38898,49151,38899,38900,49151,38901,
+		49151,38902,38903,38904,49151,38905,38906,38907,38908,38909,38910,38911,38912,38913,38914,38915,
+		38916,38917,38918,38919,38920,38921,38922,38923,38924,38925,38926,38927,38928,38929,38930,38931,
+		38932,38933,38934,38935,38936,38937,38938,38939,38940,38941,38942,38943,38944,38945,38946,38947,
+		38948,58369,14372,38949,38950,38951,38952,38953,38954,38955,38956,58369,14380,38957,38958,38959,
+		38960,38961,38962,38963,38964,38965,38966,38967,38968,38969,38970,38971,38972,38973,38974,38975,
+		38976,38977,38978,38979,38980,38981,38982,38983,38984,38985,38986,38987,38988,38989,38990,38991,
+		38992,38993,38994,38995,38996,38997,38998,38999,39000,39001,39002,39003,39004,39005,39006,39007,
+		39008,39009,39010,39011,39012,39013,39014,39015,39016,39017,39018,39019,39020,39021,39022,39023,
+		39024,39025,39026,39027,39028,39029,39030,39031,39032,39033,39034,39035,39036,39037,39038,39039,
+		39040,39041,39042,39043,39044,39045,39046,39047,39048,39049,39050,39051,39052,39053,39054,39055,
+		39056,39057,39058,39059,39060,39061,39062,39063,39064,39065,39066,39067,39068,39069,39070,39071,
+		39072,39073,39074,39075,39076,39077,39078,39079,39080,39081,39082,39083,39084,39085,39086,39087,
+		39088,39089,39090,39091,39092,39093,39094,39095,39096,39097,39098,39099,39100,39101,39102,39103,
+		39104,39105,39106,39107,39108,39109,39110,39111,39112,39113,39114,39115,39116,39117,39118,39119,
+		39120,39121,39122,39123,39124,39125,39126,39127,39128,39129,39130,39131,39132,39133,39134,59393,
+		14558,39135,59393,14559,39136,59393,14560,39137,59393,14561,39138,59393,14562,39139,59393,14563,
+		39140,59393,14564,39141,59393,14565,39142,59393,14566,39143,59393,14567,39144,59393,14568,39145,
+		59393,14569,39146,59393,14570,39147,59393,14571,39148,59393,14572,39149,59393,14573,39150,59393,
+		14574,39151,59393,14575,39152,59393,14576,39153,59393,14577,39154,59393,14578,39155,59393,14579,
+		39156,59393,14580,39157,59393,14581,39158,59393,14582,39159,59393,14583,39160,59393,14584,39161,
+		59393,14585,39162,59393,14586,39163,59393,14587,39164,59393,14588,39165,59393,14589,39166,59393,
+		14590,39167,59393,14591,39168,59393,14592,39169,59393,14593,39170,59393,14594,39171,59393,14595,
+		39172,59393,14596,39173,59393,14597,39174,59393,14598,39175,59393,14599,39176,59393,14600,39177,
+		59393,14601,39178,59393,14602,39179,59393,14603,39180,59393,14604,39181,59393,14605,39182,59393,
+		14606,39183,59393,14607,39184,59393,14608,39185,59393,14609,39186,59393,14610,39187,59393,14611,
+		39188,59393,14612,39189,59393,14613,39190,59393,14614,39191,59393,14615,39192,59393,14616,39193,
+		59393,14617,39194,59393,14618,39195,59393,14619,39196,59393,14620,39197,59393,14621,39198,59393,
+		14622,39199,59393,14623,39200,59393,14624,39201,59393,14625,39202,59393,14626,39203,59393,14627,
+		39204,59393,14628,39205,59393,14629,39206,59393,14630,39207,59393,14631,39208,59393,14632,39209,
+		59393,14633,39210,59393,14634,39211,59393,14635,39212,59393,14636,39213,59393,14637,39214,59393,
+		14638,39215,59393,14639,39216,59393,14640,39217,59393,14641,39218,59393,14642,39219,59393,14643,
+		39220,59393,14644,39221,59393,14645,39222,59393,14646,39223,59393,14647,39224,59393,14648,39225,
+		59393,14649,39226,59393,14650,39227,59393,14651,39228,59393,14652,39229,59393,14653,39230,59393,
+		14654,39231,59393,14655,39232,59393,14656,39233,59393,14657,39234,59393,14658,39235,59393,14659,
+		39236,59393,14660,39237,59393,14661,39238,59393,14662,39239,59393,14663,39240,59393,14664,39241,
+		59393,14665,39242,59393,14666,39243,59393,14667,39244,59393,14668,39245,59393,14669,39246,59393,
+		14670,39247,59393,14671,39248,59393,14672,39249,59393,14673,39250,59393,14674,39251,59393,14675,
+		39252,59393,14676,39253,59393,14677,39254,59393,14678,39255,59393,14679,39256,39257,39258,39259,
+		39260,39261,39262,39263,39264,39265,39266,39267,39268,39269,39270,39271,39272,39273,39274,39275,
+		39276,39277,39278,39279,39280,39281,39282,39283,39284,39285,39286,39287,39288,39289,39290,39291,
+		39292,39293,39294,39295,39296,39297,39298,39299,39300,39301,39302,39303,39304,39305,39306,39307,
+		39308,39309,39310,39311,39312,39313,39314,39315,39316,39317,39318,39319,39320,39321,39322,39323,
+		39324,39325,39326,39327,39328,39329,39330,39331,39332,39333,39334,39335,39336,39337,39338,39339,
+		39340,39341,39342,39343,39344,39345,39346,39347,39348,39349,39350,39351,39352,39353,39354,39355,
+		39356,39357,39358,39359,39360,39361,39362,39363,39364,39365,39366,39367,39368,39369,39370,39371,
+		39372,39373,39374,39375,39376,39377,39378,39379,39380,39381,39382,39383,39384,39385,39386,39387,
+		39388,39389,39390,39391,39392,39393,39394,39395,39396,39397,39398,39399,39400,39401,39402,39403,
+		39404,39405,39406,39407,39408,39409,39410,39411,39412,39413,39414,39415,39416,39417,39418,39419,
+		39420,39421,39422,39423,39424,39425,39426,39427,39428,39429,39430,39431,39432,39433,39434,39435,
+		39436,39437,39438,39439,39440,39441,39442,39443,39444,39445,39446,39447,39448,39449,39450,39451,
+		39452,39453,39454,39455,39456,39457,39458,39459,39460,39461,39462,39463,39464,39465,39466,39467,
+		39468,39469,39470,39471,39472,39473,39474,39475,39476,39477,39478,39479,39480,39481,39482,39483,
+		39484,39485,39486,39487,39488,39489,39490,39491,39492,39493,39494,39495,39496,39497,39498,39499,
+		39500,39501,39502,39503,39504,39505,39506,39507,39508,39509,39510,39511,39512,39513,39514,39515,
+		39516,39517,39518,39519,39520,39521,39522,39523,39524,39525,39526,39527,39528,39529,39530,39531,
+		39532,39533,39534,39535,39536,39537,39538,39539,39540,39541,39542,39543,39544,39545,39546,39547,
+		39548,39549,39550,39551,39552,39553,39554,39555,39556,39557,39558,39559,39560,39561,39562,39563,
+		39564,39565,39566,39567,39568,39569,39570,39571,39572,39573,39574,39575,39576,39577,39578,39579,
+		39580,39581,39582,39583,39584,39585,39586,39587,39588,39589,39590,39591,39592,39593,39594,39595,
+		39596,39597,39598,39599,39600,39601,39602,39603,39604,39605,39606,39607,39608,39609,39610,39611,
+		39612,39613,39614,39615,39616,39617,39618,39619,39620,39621,39622,39623,39624,39625,39626,39627,
+		39628,39629,39630,39631,39632,39633,39634,39635,39636,39637,39638,39639,39640,39641,39642,39643,
+		39644,39645,39646,39647,39648,39649,39650,39651,39652,39653,39654,39655,39656,39657,39658,39659,
+		39660,39661,39662,39663,39664,39665,39666,39667,39668,39669,39670,39671,39672,39673,39674,39675,
+		39676,39677,39678,39679,39680,39681,39682,39683,39684,39685,39686,39687,39688,39689,39690,39691,
+		39692,39693,39694,39695,39696,39697,39698,39699,39700,39701,39702,39703,39704,39705,39706,39707,
+		39708,39709,39710,39711,39712,39713,39714,39715,39716,39717,39718,39719,39720,39721,39722,39723,
+		39724,39725,39726,39727,39728,39729,39730,39731,39732,39733,39734,39735,39736,39737,39738,39739,
+		39740,39741,39742,39743,39744,39745,39746,39747,39748,39749,39750,39751,39752,39753,39754,39755,
+		39756,39757,39758,39759,39760,39761,39762,39763,39764,39765,39766,39767,39768,39769,39770,39771,
+		39772,39773,39774,39775,39776,39777,39778,39779,39780,39781,39782,39783,39784,39785,39786,39787,
+		39788,39789,39790,39791,39792,39793,39794,39795,39796,39797,39798,39799,39800,39801,39802,39803,
+		39804,39805,39806,39807,39808,39809,39810,39811,39812,39813,39814,39815,39816,39817,39818,39819,
+		39820,39821,39822,39823,39824,39825,39826,39827,39828,39829,39830,39831,39832,39833,39834,39835,
+		39836,39837,39838,39839,39840,39841,39842,39843,39844,39845,39846,39847,39848,39849,39850,39851,
+		39852,39853,39854,39855,39856,39857,39858,39859,39860,39861,39862,39863,39864,39865,39866,39867,
+		39868,39869,39870,39871,39872,39873,39874,39875,39876,39877,39878,39879,39880,39881,39882,39883,
+		39884,39885,39886,39887,39888,39889,39890,39891,39892,39893,39894,39895,39896,39897,39898,39899,
+		39900,39901,39902,39903,39904,39905,39906,39907,39908,39909,39910,39911,39912,39913,39914,39915,
+		39916,39917,39918,39919,39920,39921,39922,39923,39924,39925,39926,39927,39928,39929,39930,39931,
+		39932,39933,39934,39935,39936,39937,39938,39939,39940,39941,39942,39943,39944,39945,39946,39947,
+		39948,39949,39950,39951,39952,39953,39954,39955,39956,39957,39958,39959,39960,39961,39962,39963,
+		39964,39965,39966,39967,39968,39969,39970,39971,39972,39973,39974,39975,39976,39977,39978,39979,
+		39980,39981,39982,39983,39984,39985,39986,39987,39988,39989,50177,15413,58617,0,39990,50177,
+		15414,58617,0,50177,15414,58618,0,39991,50177,15415,58617,0,50177,15415,58369,15415,
+		39992,50177,15416,58617,0,50177,15416,58618,0,50177,15416,58619,0,50177,15416,58620,
+		0,39993,39994,39995,39996,39997,50177,15421,58617,0,50177,15421,58618,0,50177,15421,
+		58619,0,50177,15421,58620,0,39998,39999,40000,50177,15424,58617,0,40001,50177,15425,
+		58617,0,50177,15425,58618,0,50177,15425,58619,0,40002,50177,15426,58617,0,50177,
+		15426,58618,0,40003,50177,15427,58617,0,40004,40005,50177,15429,58617,0,40006,50177,
+		15430,58617,0,50177,15430,58369,15441,40007,40008,50177,15432,58617,0,40009,40010,50177,
+		15434,58617,0,50177,15434,58618,0,50177,15434,58619,0,50177,15434,58620,0,50177,
+		15434,58621,0,40011,40012,50177,15436,58617,0,50177,15436,58618,0,40013,50177,15437,
+		58617,0,50177,15437,58618,0,40014,40015,40016,50177,15440,58617,0,50177,15440,58618,
+		0,50177,15440,50425,0,50177,15440,58617,0,40017,50177,15441,58617,0,40018,50177,
+		15442,58617,0,40019,40020,40021,40022,40023,40024,40025,40026,40027,40028,40029,40030,40031,
+		40032,40033,40034,50177,15458,58617,0,50177,15458,58618,0,40035,59393,15459,50177,15459,
+		58617,0,51713,15459,58617,0,40036,59393,15460,40037,59393,15461,40038,59393,15462,40039,
+		59393,15463,40040,59393,15464,40041,59393,15465,40042,59393,15466,40043,59393,15467,50177,15467,
+		58617,0,51713,15467,58617,0,50177,15467,58618,0,51713,15467,58618,0,40044,59393,
+		15468,40045,59393,15469,40046,59393,15470,40047,59393,15471,40048,59393,15472,50177,15472,58617,
+		0,51713,15472,58617,0,40049,59393,15473,40050,59393,15474,40051,59393,15475,40052,59393,
+		15476,40053,59393,15477,40054,59393,15478,40055,59393,15479,40056,59393,15480,40057,59393,15481,
+		40058,59393,15482,50177,15482,58617,0,51713,15482,58617,0,40059,59393,15483,50177,15483,
+		58617,0,51713,15483,58617,0,50177,15483,58618,0,51713,15483,58618,0,40060,59393,
+		15484,40061,59393,15485,40062,59393,15486,50177,15486,58617,0,51713,15486,58617,0,40063,
+		59393,15487,40064,59393,15488,40065,59393,15489,40066,59393,15490,40067,59393,15491,40068,59393,
+		15492,40069,59393,15493,50177,15493,58617,0,51713,15493,58617,0,40070,59393,15494,50177,
+		15494,58617,0,51713,15494,58617,0,40071,59393,15495,40072,59393,15496,40073,59393,15497,
+		40074,59393,15498,40075,59393,15499,40076,50177,15500,58617,0,40077,40078,50177,15502,58617,
+		0,40079,40080,40081,50177,15505,58617,0,40082,50177,15506,58617,0,40083,50177,15507,
+		58617,0,40084,50177,15508,58617,0,40085,50177,15509,58617,0,40086,50177,15510,58617,
+		0,40087,40088,50177,15512,58617,0,40089,50177,15513,58617,0,40090,50177,15514,58617,
+		0,40091,50177,15515,58617,0,40092,50177,15516,58617,0,40093,50177,15517,58617,0,
+		40094,40095,40096,40097,40098,50177,15522,58617,0,40099,50177,15523,58617,0,40100,50177,
+		15524,58617,0,40101,50177,15525,58617,0,40102,40103,50177,15527,58617,0,40104,40105,
+		40106,40107,50177,15531,58617,0,40108,50177,15532,58617,0,40109,50177,15533,58617,0,
+		40110,50177,15534,58617,0,40111,50177,15535,58617,0,40112,40113,40114,40115,50177,15539,
+		58617,0,40116,50177,15540,58617,0,40117,50177,15541,58617,0,40118,50177,15542,58617,
+		0,40119,40120,40121,40122,40123,40124,40125,40126,40127,40128,40129,40130,40131,40132,40133,
+		50177,15557,58369,15812,40134,40135,40136,40137,40138,40139,40140,40141,40142,40143,40144,40145,
+		40146,40147,40148,40149,40150,40151,50177,15575,58369,15812,40152,40153,40154,40155,40156,40157,
+		40158,40159,40160,40161,40162,40163,40164,40165,40166,40167,40168,40169,40170,40171,40172,50177,
+		15596,58369,15812,40173,40174,40175,40176,40177,40178,40179,40180,40181,40182,40183,40184,40185,
+		40186,40187,40188,40189,40190,40191,40192,50177,15616,58369,15813,40193,40194,40195,40196,40197,
+		40198,40199,40200,40201,40202,40203,50177,15627,58369,15812,40204,40205,40206,40207,40208,40209,
+		58369,15633,50177,15633,58369,15813,40210,40211,50177,15635,58369,15813,40212,40213,40214,40215,
+		40216,40217,50177,15641,58369,15812,40218,40219,40220,40221,40222,40223,40224,40225,40226,40227,
+		58369,15651,40228,40229,40230,40231,58369,15655,40232,40233,40234,40235,40236,40237,40238,40239,
+		40240,40241,40242,40243,40244,40245,40246,40247,40248,40249,40250,40251,40252,40253,40254,50177,
+		15678,58369,15812,40255,40256,58369,15680,40257,40258,40259,40260,40261,40262,40263,40264,40265,
+		40266,40267,40268,40269,40270,40271,40272,40273,40274,40275,40276,40277,40278,40279,40280,40281,
+		40282,40283,40284,40285,40286,40287,40288,40289,40290,40291,40292,40293,40294,40295,40296,40297,
+		40298,40299,40300,40301,50177,15725,58369,15812,40302,40303,40304,40305,40306,40307,40308,40309,
+		40310,40311,40312,40313,40314,40315,40316,40317,40318,40319,40320,40321,40322,40323,40324,50177,
+		15748,58369,15812,40325,40326,40327,40328,40329,40330,58369,15754,50177,15754,58369,15813,40331,
+		40332,40333,40334,40335,40336,40337,50177,15761,58369,15812,40338,40339,40340,40341,40342,40343,
+		40344,40345,40346,40347,40348,40349,40350,40351,40352,40353,40354,40355,40356,40357,40358,40359,
+		40360,40361,40362,40363,40364,40365,40366,40367,40368,40369,40370,40371,40372,40373,40374,40375,
+		40376,40377,40378,40379,40380,40381,40382,40383,40384,40385,40386,40387,40388,40389,40390,40391,
+		40392,40393,40394,40395,40396,40397,40398,40399,40400,40401,40402,40403,40404,40405,40406,40407,
+		40408,40409,40410,40411,40412,40413,40414,40415,40416,40417,40418,40419,40420,40421,40422,40423,
+		40424,40425,40426,40427,40428,40429,40430,40431,40432,40433,40434,40435,40436,40437,40438,40439,
+		40440,40441,40442,40443,40444,40445,40446,40447,40448,40449,40450,40451,40452,40453,40454,40455,
+		40456,40457,40458,40459,40460,40461,40462,40463,40464,40465,40466,40467,40468,40469,40470,40471,
+		40472,40473,40474,40475,40476,40477,40478,40479,40480,40481,40482,40483,40484,40485,40486,40487,
+		40488,40489,40490,40491,40492,40493,40494,40495,40496,40497,40498,40499,40500,40501,40502,40503,
+		40504,40505,40506,40507,40508,40509,40510,40511,40512,40513,40514,40515,40516,40517,40518,40519,
+		40520,40521,40522,40523,40524,40525,40526,40527,40528,40529,40530,40531,40532,40533,40534,40535,
+		40536,40537,40538,40539,40540,40541,40542,40543,40544,40545,40546,40547,40548,40549,40550,40551,
+		40552,40553,40554,40555,40556,40557,40558,40559,40560,40561,40562,40563,40564,40565,40566,40567,
+		40568,40569,40570,40571,40572,40573,40574,40575,40576,40577,40578,40579,40580,40581,40582,40583,
+		40584,40585,40586,40587,40588,40589,40590,40591,40592,40593,40594,40595,40596,40597,40598,40599,
+		40600,40601,40602,40603,40604,40605,40606,40607,40608,40609,40610,40611,40612,40613,40614,40615,
+		40616,40617,40618,40619,40620,40621,40622,40623,40624,40625,40626,40627,40628,40629,40630,40631,
+		40632,40633,40634,40635,40636,40637,40638,40639,40640,40641,40642,40643,40644,40645,40646,40647,
+		40648,40649,40650,40651,40652,40653,40654,40655,40656,40657,40658,40659,40660,40661,40662,40663,
+		40664,40665,40666,40667,40668,40669,40670,40671,40672,40673,40674,40675,40676,40677,40678,40679,
+		40680,40681,40682,40683,40684,40685,40686,40687,40688,40689,40690,40691,40692,40693,40694,40695,
+		40696,40697,40698,40699,40700,40701,40702,40703,40704,40705,40706,40707,40708,40709,40710,40711,
+		40712,40713,40714,40715,40716,40717,40718,40719,40720,40721,40722,40723,40724,40725,40726,40727,
+		40728,40729,40730,40731,40732,40733,40734,40735,40736,40737,40738,40739,40740,40741,40742,40743,
+		40744,40745,40746,40747,40748,40749,40750,40751,40752,40753,40754,40755,40756,40757,40758,40759,
+		40760,40761,40762,40763,40764,40765,40766,40767,40768,40769,40770,40771,40772,40773,40774,40775,
+		40776,40777,40778,40779,40780,40781,40782,40783,40784,40785,40786,40787,40788,40789,40790,40791,
+		40792,40793,40794,40795,40796,40797,40798,40799,40800,40801,40802,40803,40804,40805,40806,40807,
+		40808,40809,40810,40811,40812,40813,40814,40815,40816,40817,40818,40819,40820,40821,40822,40823,
+		40824,40825,40826,40827,40828,40829,40830,40831,40832,40833,40834,40835,40836,40837,40838,40839,
+		40840,40841,40842,40843,40844,40845,40846,40847,40848,40849,40850,40851,40852,40853,40854,40855,
+		40856,40857,40858,40859,40860,40861,40862,40863,40864,40865,40866,40867,40868,40869,40870,40871,
+		40872,40873,40874,40875,40876,40877,40878,40879,40880,40881,40882,40883,40884,40885,40886,40887,
+		40888,40889,40890,40891,40892,40893,40894,40895,40896,40897,40898,40899,40900,40901,40902,40903,
+		40904,40905,40906,40907,40908,40909,40910,40911,40912,40913,40914,40915,40916,40917,40918,40919,
+		40920,40921,40922,40923,40924,40925,40926,40927,40928,40929,40930,40931,40932,40933,40934,40935,
+		40936,40937,40938,40939,40940,40941,40942,40943,40944,40945,40946,40947,40948,40949,40950,40951,
+		40952,40953,40954,40955,40956,40957,40958,40959,40960,40961,40962,40963,40964,40965,40966,40967,
+		40968,40969,40970,40971,40972,40973,40974,40975,40976,40977,40978,40979,40980,40981,40982,40983,
+		40984,40985,40986,40987,40988,40989,40990,40991,40992,40993,40994,40995,40996,40997,40998,40999,
+		41000,41001,41002,41003,41004,41005,41006,41007,41008,41009,41010,41011,41012,41013,41014,41015,
+		41016,41017,41018,41019,41020,41021,41022,41023,41024,41025,41026,41027,41028,41029,41030,41031,
+		41032,41033,41034,41035,41036,41037,41038,41039,41040,41041,41042,41043,41044,41045,41046,41047,
+		41048,41049,41050,41051,41052,41053,41054,41055,41056,41057,41058,41059,41060,41061,41062,41063,
+		41064,41065,41066,41067,41068,41069,41070,41071,41072,41073,41074,41075,41076,41077,41078,41079,
+		41080,41081,41082,41083,41084,41085,41086,41087,41088,41089,41090,41091,41092,41093,41094,41095,
+		41096,41097,41098,41099,41100,41101,41102,41103,41104,41105,41106,41107,41108,41109,41110,41111,
+		41112,41113,41114,41115,41116,41117,41118,41119,41120,41121,41122,41123,41124,41125,41126,41127,
+		41128,41129,41130,41131,41132,41133,41134,41135,41136,41137,41138,41139,41140,41141,41142,41143,
+		41144,41145,41146,41147,41148,41149,41150,41151,41152,41153,41154,41155,41156,41157,41158,41159,
+		41160,41161,41162,41163,41164,41165,41166,41167,41168,41169,41170,41171,41172,41173,41174,41175,
+		41176,41177,41178,41179,41180,41181,41182,41183,41184,41185,41186,41187,41188,41189,41190,41191,
+		41192,41193,41194,41195,41196,41197,41198,41199,41200,41201,41202,41203,41204,41205,41206,41207,
+		41208,41209,41210,41211,41212,41213,41214,41215,41216,41217,41218,41219,41220,41221,41222,41223,
+		41224,41225,41226,41227,41228,41229,41230,41231,41232,41233,41234,41235,41236,41237,41238,41239,
+		41240,41241,41242,41243,41244,41245,41246,41247,41248,41249,41250,41251,41252,41253,41254,41255,
+		41256,41257,41258,41259,41260,41261,41262,41263,41264,41265,41266,59393,16690,41267,59393,16691,
+		41268,59393,16692,41269,59393,16693,41270,59393,16694,41271,59393,16695,41272,59393,16696,41273,
+		59393,16697,41274,59393,16698,41275,59393,16699,41276,59393,16700,41277,59393,16701,41278,59393,
+		16702,41279,59393,16703,41280,59393,16704,41281,59393,16705,41282,59393,16706,41283,59393,16707,
+		41284,59393,16708,41285,59393,16709,41286,59393,16710,41287,59393,16711,41288,59393,16712,41289,
+		59393,16713,41290,59393,16714,41291,59393,16715,41292,59393,16716,41293,59393,16717,41294,59393,
+		16718,41295,59393,16719,41296,59393,16720,41297,59393,16721,41298,59393,16722,41299,59393,16723,
+		41300,59393,16724,41301,59393,16725,41302,59393,16726,41303,59393,16727,41304,59393,16728,41305,
+		59393,16729,41306,59393,16730,41307,59393,16731,41308,59393,16732,41309,59393,16733,41310,59393,
+		16734,41311,59393,16735,41312,59393,16736,41313,59393,16737,41314,59393,16738,41315,59393,16739,
+		41316,59393,16740,41317,59393,16741,41318,59393,16742,41319,59393,16743,41320,59393,16744,41321,
+		59393,16745,41322,59393,16746,41323,59393,16747,41324,59393,16748,41325,59393,16749,41326,59393,
+		16750,41327,59393,16751,41328,59393,16752,41329,59393,16753,41330,59393,16754,41331,59393,16755,
+		41332,41333,58369,16757,50177,808,50177,16757,58369,809,58881,16757,61953,16757,50177,808,
+		50177,16757,50177,16883,58369,809,50689,16757,58881,16883,41334,58369,16758,61953,16758,41335,
+		58369,16759,50177,808,50177,16759,58369,809,58881,16759,61953,16759,50177,808,50177,16759,
+		50177,16883,58369,809,50689,16759,58881,16883,41336,58369,16760,50177,808,50177,16760,58369,
+		809,58881,16760,61953,16760,50177,808,50177,16760,50177,16883,58369,809,50689,16760,58881,
+		16883,41337,58369,16761,61953,16761,41338,58369,16762,50177,808,50177,16762,58369,809,58881,
+		16762,61953,16762,50177,808,50177,16762,50177,16883,58369,809,50689,16762,58881,16883,41339,
+		58369,16763,50177,808,50177,16763,58369,809,58881,16763,61953,16763,50177,808,50177,16763,
+		50177,16883,58369,809,50689,16763,58881,16883,41340,58369,16764,50177,808,50177,16764,58369,
+		809,58881,16764,61953,16764,50177,808,50177,16764,50177,16883,58369,809,50689,16764,58881,
+		16883,41341,58369,16765,61953,16765,41342,58369,16766,50177,808,50177,16766,58369,809,58881,
+		16766,61953,16766,50177,808,50177,16766,50177,16883,58369,809,50689,16766,58881,16883,41343,
+		58369,16767,61953,16767,41344,58369,16768,50177,808,50177,16768,58369,809,58881,16768,61953,
+		16768,50177,808,50177,16768,50177,16883,58369,809,50689,16768,58881,16883,50177,808,50177,
+		16768,50177,16891,50177,16769,50177,16887,50177,16980,58369,809,50177,808,50177,16768,50177,
+		16891,50177,16775,50177,16896,58369,809,50689,16768,58881,16896,41345,58369,16769,50177,808,
+		50177,16769,58369,809,58881,16769,61953,16769,50177,808,50177,16769,50177,16883,58369,809,
+		50689,16769,58881,16883,50177,808,50177,16769,50177,16896,58369,809,50689,16769,50689,16896,
+		50689,16768,58881,16902,41346,58369,16770,61953,16770,41347,58369,16771,50177,808,50177,16771,
+		58369,809,58881,16771,61953,16771,50177,808,50177,16771,50177,16883,58369,809,50689,16771,
+		58881,16883,50689,16771,50689,16883,50689,16992,50689,16757,58881,16891,41348,58369,16772,50177,
+		808,50177,16772,58369,809,58881,16772,61953,16772,50177,808,50177,16772,50177,16883,58369,
+		809,50689,16772,58881,16883,41349,58369,16773,50177,808,50177,16773,58369,809,58881,16773,
+		61953,16773,50177,808,50177,16773,50177,16883,58369,809,50689,16773,58881,16883,41350,58369,
+		16774,50177,808,50177,16774,58369,809,58881,16774,61953,16774,50177,808,50177,16774,50177,
+		16883,58369,809,50689,16774,58881,16883,41351,58369,16775,50177,808,50177,16775,58369,809,
+		58881,16775,61953,16775,50177,808,50177,16775,50177,16883,58369,809,50689,16775,58881,16883,
+		41352,41353,58369,16777,41354,58369,16778,41355,41356,41357,41358,41359,58369,16783,61953,16783,
+		41360,41361,58369,16785,41362,58369,16786,41363,58369,16787,41364,41365,58369,16789,41366,58369,
+		16790,61953,16790,41367,58369,16791,41368,58369,16792,41369,41370,41371,41372,58369,16796,41373,
+		41374,58369,16798,41375,41376,58369,16800,41377,58369,16801,41378,58369,16802,41379,58369,16803,
+		41380,58369,16804,41381,41382,41383,58369,16807,41384,41385,41386,41387,58369,16811,41388,41389,
+		41390,41391,41392,41393,41394,41395,41396,41397,58369,16821,41398,41399,41400,41401,41402,41403,
+		41404,58369,16828,41405,41406,41407,41408,41409,58369,16833,41410,41411,41412,41413,41414,41415,
+		41416,41417,41418,41419,41420,58369,16844,41421,58369,16845,41422,58369,16846,41423,41424,41425,
+		41426,41427,41428,41429,41430,41431,41432,41433,41434,41435,41436,41437,41438,41439,41440,41441,
+		41442,41443,41444,41445,41446,41447,41448,41449,41450,41451,41452,41453,41454,41455,41456,41457,
+		41458,58369,16882,61953,16882,41459,58369,16883,61953,16883,41460,58369,16884,61953,16884,41461,
+		58369,16885,61953,16885,41462,58369,16886,61953,16886,41463,58369,16887,61953,16887,41464,58369,
+		16888,61953,16888,41465,58369,16889,61953,16889,41466,58369,16890,61953,16890,41467,58369,16891,
+		61953,16891,41468,58369,16892,61953,16892,41469,58369,16893,61953,16893,41470,58369,16894,61953,
+		16894,41471,58369,16895,61953,16895,41472,58369,16896,61953,16896,41473,58369,16897,61953,16897,
+		41474,58369,16898,61953,16898,41475,58369,16899,61953,16899,41476,58369,16900,61953,16900,41477,
+		58369,16901,61953,16901,41478,58369,16902,61953,16902,41479,58369,16903,61953,16903,41480,41481,
+		41482,41483,41484,41485,41486,41487,41488,41489,41490,41491,41492,41493,41494,58369,16918,41495,
+		58369,16919,41496,41497,41498,58369,16922,41499,41500,41501,41502,41503,41504,41505,41506,41507,
+		58369,16931,41508,58369,16932,41509,41510,58369,16934,41511,41512,41513,41514,41515,41516,41517,
+		41518,41519,41520,58369,16944,41521,41522,41523,58369,16947,41524,41525,41526,41527,41528,41529,
+		41530,41531,41532,41533,41534,41535,41536,41537,41538,41539,41540,41541,41542,41543,41544,41545,
+		41546,41547,41548,41549,41550,41551,41552,41553,41554,41555,58369,16979,61953,16979,41556,41557,
+		58369,16981,61953,16981,41558,58369,16982,61953,16982,41559,41560,41561,58369,16985,61953,16985,
+		41562,58369,16986,61953,16986,41563,58369,16987,61953,16987,41564,58369,16988,61953,16988,41565,
+		58369,16989,61953,16989,41566,58369,16990,61953,16990,41567,41568,41569,41570,41571,41572,41573,
+		41574,41575,41576,41577,41578,41579,41580,41581,41582,41583,41584,58369,17008,41585,58369,17009,
+		41586,41587,41588,41589,58369,17013,41590,41591,58369,17015,41592,41593,41594,41595,41596,58369,
+		17020,41597,41598,41599,41600,58369,17024,41601,41602,58369,17026,41603,41604,41605,41606,58369,
+		17030,41607,41608,58369,17032,41609,41610,41611,41612,41613,41614,41615,41616,41617,41618,41619,
+		41620,41621,41622,41623,41624,41625,41626,58369,17050,41627,58369,17051,41628,41629,41630,41631,
+		41632,41633,41634,41635,41636,41637,41638,41639,41640,41641,41642,41643,41644,41645,41646,41647,
+		41648,41649,41650,41651,41652,41653,41654,41655,41656,41657,41658,41659,41660,41661,41662,41663,
+		41664,41665,41666,41667,41668,41669,41670,41671,41672,41673,41674,41675,41676,41677,41678,41679,
+		41680,41681,41682,41683,41684,41685,41686,41687,41688,41689,60673,17114,60929,17114,61185,17114,
+		61441,17114,61697,17114,61953,17114,62209,17114,56321,17114,56321,8032,64513,17155,56321,17114,
+		56321,17140,56345,0,56321,8032,64513,17134,56321,17114,56321,17155,56321,17142,64513,17114,
+		56321,17114,56321,17162,56321,17143,56345,0,64513,17114,60673,17115,60929,17115,61185,17115,
+		61441,17115,61697,17115,61953,17115,62209,17115,56321,17115,56321,17136,56321,17162,56321,17122,
+		64536,0,56321,17115,56321,17162,64513,17131,60673,17116,60929,17116,61185,17116,61441,17116,
+		61697,17116,61953,17116,62209,17116,52737,17116,57880,0,53505,17116,57880,0,56321,17116,
+		56321,17119,64513,17162,61697,17117,60673,17118,60929,17118,61185,17118,61441,17118,61697,17118,
+		61953,17118,62209,17118,56321,17118,56321,8032,56321,17120,64513,8032,56321,17118,56321,17127,
+		56321,17122,56321,8032,56321,17134,64536,0,60673,17119,60929,17119,61185,17119,61441,17119,
+		61697,17119,61953,17119,62209,17119,56321,17119,56321,8032,64513,17147,56321,17119,56321,17162,
+		64513,17127,60673,17120,60929,17120,61185,17120,61697,17120,61953,17120,62209,17120,52737,17120,
+		57880,0,53505,17120,57880,0,56321,17120,56321,17115,64513,17154,56321,17120,56321,17153,
+		56321,17132,64513,17134,56321,17120,56321,17157,56321,17154,64513,8032,56321,17120,56344,0,
+		56321,17157,64513,17162,56321,17120,56344,0,56321,17162,64513,17145,60929,17121,61697,17121,
+		61953,17121,62209,17121,52737,17121,57880,0,53505,17121,57880,0,56321,17121,56344,0,
+		56321,17120,64536,0,56321,17121,56344,0,56321,17136,64513,8032,56321,17121,56321,17151,
+		56321,17154,64513,8032,56321,17121,56344,0,56321,17155,56321,17130,56344,0,64513,8032,
+		56321,17121,64513,17157,56321,17121,56321,17157,56321,17122,56344,0,56321,17153,64513,17147,
+		56321,17121,56321,17157,56321,17148,56321,8032,56321,17134,64513,17155,56321,17121,56321,17157,
+		56321,17158,56321,17132,64513,17134,60929,17122,61185,17122,61697,17122,61953,17122,62209,17122,
+		52737,17122,57880,0,53505,17122,57880,0,56321,17122,56344,0,56321,17153,64513,17147,
+		56321,17122,56344,0,56321,17153,56321,17147,56321,17134,64513,17162,56321,17122,56321,17155,
+		56321,17128,56344,0,56321,17115,64513,17157,56321,17122,56321,17157,56321,8032,64513,17138,
+		60673,17123,60929,17123,61185,17123,61697,17123,61953,17123,62209,17123,52737,17123,57880,0,
+		53505,17123,57880,0,56321,17123,56321,8032,64513,17127,60929,17124,61697,17124,61953,17124,
+		62209,17124,52737,17124,57880,0,53505,17124,57880,0,56321,17124,56321,8032,56321,17144,
+		64537,0,56321,17124,64513,17124,54785,17124,62977,17134,56321,17124,56321,17155,64513,17135,
+		60929,17125,61697,17125,61953,17125,62209,17125,64513,17125,52737,17125,57880,0,53505,17125,
+		57880,0,56321,17125,56321,17115,56321,17122,64513,17155,56321,17125,56321,17162,56321,17131,
+		56321,8032,64513,17147,60929,17126,61185,17126,61697,17126,61953,17126,62209,17126,52737,17126,
+		57880,0,53505,17126,57880,0,50177,17126,58369,17148,56321,17126,56321,17154,56321,17162,
+		56321,17122,64536,0,60929,17127,61185,17127,61697,17127,61953,17127,62209,17127,52737,17127,
+		57880,0,53505,17127,57880,0,60929,17128,61697,17128,61953,17128,62209,17128,52737,17128,
+		57880,0,53505,17128,57880,0,56321,17128,56321,17162,64513,17131,56321,17128,56321,17162,
+		64513,17134,60929,17129,61697,17129,61953,17129,62209,17129,52737,17129,57880,0,53505,17129,
+		57880,0,60929,17130,61697,17130,61953,17130,62209,17130,52737,17130,57880,0,53505,17130,
+		57880,0,56321,17130,56344,0,56321,8032,64513,17127,60929,17131,61697,17131,61953,17131,
+		62209,17131,52737,17131,57880,0,53505,17131,57880,0,60673,17132,60929,17132,61185,17132,
+		61441,17132,61697,17132,61953,17132,62209,17132,52737,17132,57880,0,53505,17132,57880,0,
+		60929,17133,61697,17133,61953,17133,62209,17133,52737,17133,57880,0,53505,17133,57880,0,
+		56321,17133,64536,0,56321,17133,56344,0,64513,17126,60929,17134,61185,17134,61697,17134,
+		61953,17134,62209,17134,52737,17134,57880,0,53505,17134,57880,0,56321,17134,56344,0,
+		64513,17155,56321,17134,64513,17162,60929,17135,61697,17135,61953,17135,62209,17135,56321,17135,
+		64513,17139,60929,17136,61697,17136,61953,17136,62209,17136,60929,17137,61185,17137,61697,17137,
+		61953,17137,62209,17137,60929,17138,61697,17138,61953,17138,62209,17138,60929,17139,61697,17139,
+		61953,17139,62209,17139,56321,17139,56321,17132,64513,17134,60929,17140,61185,17140,61697,17140,
+		61953,17140,62209,17140,52737,17140,57880,0,53505,17140,57880,0,52737,17140,57881,0,
+		53505,17140,57881,0,56321,17140,56345,0,56321,8032,56321,17128,56321,17162,64513,17134,
+		56321,17140,56345,0,56321,8032,64513,17132,56321,17140,56344,0,56321,8032,56321,17156,
+		64513,17155,56321,17140,56321,17115,64513,17132,60929,17141,61185,17141,61697,17141,61953,17141,
+		62209,17141,52737,17141,57880,0,53505,17141,57880,0,52737,17141,57881,0,53505,17141,
+		57881,0,56321,17141,56345,0,56321,17114,56321,17127,56321,17134,64513,17155,56321,17141,
+		56345,0,56321,17122,64513,17155,56321,17141,56345,0,64513,17124,56321,17141,56344,0,
+		64513,17155,60929,17142,61185,17142,61697,17142,61953,17142,62209,17142,52737,17142,57880,0,
+		53505,17142,57880,0,52737,17142,57881,0,53505,17142,57881,0,56321,17142,56321,17114,
+		56321,17153,56321,17132,56321,17134,64536,0,56321,17142,56321,17115,56321,8032,64513,17134,
+		56321,17142,56344,0,56321,17132,56321,17126,56321,17118,64513,17155,56321,17142,56321,17153,
+		64513,17162,60929,17143,61185,17143,61697,17143,61953,17143,62209,17143,52737,17143,57880,0,
+		53505,17143,57880,0,52737,17143,57881,0,53505,17143,57881,0,56321,17143,56345,0,
+		56321,8032,56321,17126,64536,0,56321,17143,56344,0,56321,8032,64513,17130,56321,17143,
+		56321,17122,56321,17130,56321,8032,64513,17155,56321,17143,56345,0,64513,17129,56321,17143,
+		56345,0,56321,17136,64513,17141,56321,17143,56321,17155,64513,17132,56321,17143,56345,0,
+		56321,17162,64513,17127,60929,17144,61185,17144,61697,17144,61953,17144,62209,17144,52737,17144,
+		57880,0,53505,17144,57880,0,52737,17144,57881,0,53505,17144,57881,0,56321,17144,
+		56321,8032,64513,17155,56321,17144,56321,8032,64513,17162,56321,17144,56345,0,56321,17115,
+		56321,17162,64513,17134,56321,17144,64513,17120,56321,17144,56344,0,56321,17155,64513,17134,
+		56321,17144,64513,17162,56321,17144,56345,0,56321,17162,56321,17134,64536,0,60929,17145,
+		61697,17145,61953,17145,62209,17145,56321,17145,56321,17115,56321,17122,64513,17157,56321,17145,
+		56321,17115,64513,17155,50177,17145,58369,17127,56321,17145,56321,17132,64513,17140,56321,17145,
+		56321,17155,64513,17122,56321,17145,56321,17162,56321,17126,56321,17152,64513,17162,60929,17146,
+		61697,17146,61953,17146,62209,17146,56321,17146,56321,17122,56321,17157,64513,17162,56321,17146,
+		64513,17154,56321,17146,56321,17154,56321,17140,56344,0,56321,8032,64513,17155,60929,17147,
+		61185,17147,61697,17147,61953,17147,62209,17147,60929,17148,61697,17148,61953,17148,62209,17148,
+		56321,17148,56321,8032,56321,17134,64513,17155,56321,17148,56321,17120,64536,0,56321,17148,
+		56321,17120,56344,0,56321,17134,64513,17162,60929,17149,61697,17149,61953,17149,62209,17149,
+		60673,17150,60929,17150,61185,17150,61441,17150,61697,17150,61953,17150,62209,17150,56321,17150,
+		56321,8032,56321,17134,64536,0,56321,17150,56321,8032,64513,17155,60673,17151,60929,17151,
+		61185,17151,61441,17151,61697,17151,61953,17151,62209,17151,56321,17151,56321,17114,64513,17162,
+		60673,17152,60929,17152,61185,17152,61441,17152,61697,17152,61953,17152,62209,17152,54785,17152,
+		62977,17154,60929,17153,61185,17153,61697,17153,61953,17153,62209,17153,60929,17154,61185,17154,
+		61697,17154,61953,17154,62209,17154,56321,17154,56321,17132,56321,17134,64513,17155,56321,17154,
+		64513,17153,60929,17155,61185,17155,61697,17155,61953,17155,62209,17155,56321,17155,56321,8032,
+		56321,17142,56344,0,64513,17155,56321,17155,56321,17141,56345,0,64513,8032,60929,17156,
+		61185,17156,61697,17156,61953,17156,62209,17156,56321,17156,64513,17147,56321,17156,56321,17162,
+		56321,17134,56321,17123,56344,0,64513,17162,60929,17157,61185,17157,61697,17157,61953,17157,
+		62209,17157,60673,17158,60929,17158,61185,17158,61697,17158,61953,17158,62209,17158,53505,17158,
+		57880,0,56321,17158,56321,17132,64513,17134,60673,17159,60929,17159,61185,17159,61697,17159,
+		62209,17159,53505,17159,57880,0,60673,17160,60929,17160,61185,17160,61697,17160,62209,17160,
+		53505,17160,57880,0,60673,17161,60929,17161,61185,17161,61697,17161,61953,17161,62209,17161,
+		53505,17161,57880,0,60929,17162,61185,17162,61697,17162,61953,17162,41739,41740,41741,41742,
+		41743,41744,41745,41746,41747,41748,41749,41750,41751,41752,41753,41754,41755,41756,41757,41758,
+		41759,41760,41761,41762,41763,41764,41765,41766,41767,41768,41769,41770,41771,41772,41773,41774,
+		41775,41776,41777,41778,41779,41780,41781,41782,41783,41784,41785,41786,41787,41788,41789,41790,
+		41791,41792,41793,41794,41795,41796,41797,41798,41799,41800,41801,41802,41803,41804,41805,41806,
+		41807,41808,41809,41810,41811,41812,41813,41814,41815,41816,41817,41818,41819,41820,41821,41822,
+		41823,41824,41825,41826,41827,41828,41829,41830,41831,41832,41833,41834,41835,41836,41837,41838,
+		41839,41840,41841,41842,41843,41844,41845,41846,41847,41848,41849,41850,41851,41852,41853,41854,
+		41855,41856,41857,41858,41859,41860,41861,41862,41863,41864,41865,41866,41867,41868,41869,41870,
+		41871,41872,41873,41874,41875,41876,41877,41878,41879,41880,41881,41882,41883,41884,41885,41886,
+		41887,41888,41889,41890,41891,41892,41893,41894,41895,41896,41897,41898,41899,41900,41901,41902,
+		41903,41904,41905,41906,41907,41908,41909,41910,41911,41912,41913,41914,41915,41916,41917,41918,
+		41919,41920,41921,41922,41923,41924,41925,41926,41927,41928,41929,41930,41931,41932,41933,41934,
+		41935,41936,41937,41938,41939,41940,41941,41942,41943,41944,41945,41946,41947,41948,41949,41950,
+		41951,41952,41953,41954,41955,41956,41957,41958,41959,41960,41961,41962,41963,41964,41965,41966,
+		41967,41968,41969,41970,41971,41972,41973,41974,41975,41976,41977,41978,41979,41980,41981,41982,
+		41983,41984,41985,41986,41987,41988,41989,41990,41991,41992,41993,41994,41995,41996,41997,41998,
+		41999,42000,42001,42002,42003,42004,42005,42006,42007,42008,42009,42010,42011,42012,42013,42014,
+		42015,42016,42017,42018,42019,42020,42021,42022,42023,42024,42025,50177,17449,58618,0,42026,
+		63745,17450,42027,42028,42029,42030,42031,42032,63745,17456,42033,42034,42035,42036,63745,17460,
+		50177,17460,58618,0,42037,63745,17461,42038,42039,42040,63745,17464,42041,50177,17465,58618,
+		0,42042,42043,42044,42045,42046,42047,42048,42049,42050,42051,50177,17475,58618,0,42052,
+		42053,42054,42055,42056,42057,50177,17481,58618,0,42058,50177,17482,58618,0,42059,42060,
+		58369,17484,42061,42062,50177,17486,58618,0,42063,50177,17487,58618,0,42064,42065,50177,
+		17489,58618,0,42066,42067,42068,42069,42070,42071,42072,42073,42074,42075,50177,17499,58618,
+		0,54785,17499,63226,0,42076,50177,17500,58618,0,50177,17500,58619,0,42077,42078,
+		42079,42080,42081,42082,42083,42084,42085,42086,42087,42088,42089,42090,42091,42092,42093,42094,
+		42095,42096,42097,42098,42099,42100,42101,42102,42103,42104,42105,42106,42107,42108,42109,42110,
+		42111,42112,42113,42114,42115,42116,42117,42118,42119,42120,42121,42122,42123,42124,42125,42126,
+		42127,42128,42129,42130,42131,42132,42133,42134,42135,42136,42137,42138,42139,42140,42141,42142,
+		42143,42144,42145,42146,42147,42148,42149,42150,42151,42152,42153,42154,42155,42156,42157,42158,
+		42159,42160,42161,42162,42163,42164,42165,42166,42167,42168,42169,42170,42171,42172,42173,42174,
+		42175,42176,42177,42178,42179,42180,42181,42182,42183,42184,42185,42186,42187,42188,42189,42190,
+		42191,42192,42193,42194,42195,42196,42197,42198,42199,42200,42201,42202,42203,42204,42205,42206,
+		42207,42208,42209,42210,42211,42212,42213,42214,42215,42216,42217,42218,42219,42220,42221,42222,
+		42223,42224,42225,42226,42227,42228,42229,42230,42231,42232,42233,42234,42235,42236,42237,42238,
+		42239,42240,42241,42242,42243,42244,42245,42246,42247,42248,42249,42250,42251,42252,42253,42254,
+		42255,42256,42257,42258,42259,42260,42261,42262,42263,42264,42265,42266,42267,42268,42269,42270,
+		42271,42272,42273,42274,42275,42276,42277,42278,42279,42280,42281,42282,42283,42284,42285,42286,
+		42287,42288,42289,42290,42291,42292,42293,42294,42295,42296,42297,42298,42299,42300,42301,42302,
+		42303,42304,42305,42306,42307,42308,42309,42310,42311,42312,42313,42314,42315,42316,42317,42318,
+		42319,42320,42321,42322,42323,42324,42325,42326,42327,42328,42329,42330,42331,42332,42333,42334,
+		42335,42336,42337,42338,42339,42340,42341,42342,42343,42344,42345,42346,42347,42348,42349,42350,
+		42351,42352,42353,42354,42355,42356,42357,42358,42359,42360,42361,42362,42363,42364,42365,42366,
+		42367,42368,42369,42370,42371,42372,42373,42374,42375,42376,42377,42378,42379,42380,42381,42382,
+		42383,42384,42385,42386,42387,42388,42389,42390,42391,42392,42393,42394,42395,42396,42397,42398,
+		42399,42400,42401,42402,42403,42404,42405,42406,42407,42408,42409,42410,42411,42412,42413,42414,
+		42415,42416,42417,42418,42419,42420,42421,42422,42423,42424,42425,42426,42427,42428,42429,42430,
+		42431,42432,42433,42434,42435,42436,42437,42438,42439,42440,42441,42442,42443,42444,42445,42446,
+		42447,42448,42449,42450,42451,42452,42453,42454,42455,42456,42457,42458,42459,42460,42461,42462,
+		42463,42464,42465,42466,42467,42468,42469,42470,42471,42472,42473,42474,42475,42476,42477,42478,
+		42479,42480,42481,42482,42483,42484,42485,42486,42487,42488,42489,42490,42491,42492,42493,42494,
+		42495,42496,42497,42498,42499,42500,42501,42502,42503,42504,42505,42506,42507,42508,42509,42510,
+		42511,42512,42513,42514,42515,42516,42517,42518,42519,42520,42521,42522,42523,42524,42525,42526,
+		42527,42528,42529,42530,42531,42532,42533,42534,42535,42536,42537,42538,42539,42540,42541,42542,
+		42543,42544,42545,42546,42547,42548,42549,42550,42551,42552,42553,42554,42555,42556,42557,42558,
+		42559,42560,42561,42562,42563,42564,42565,42566,42567,42568,42569,42570,42571,42572,42573,42574,
+		42575,42576,42577,42578,42579,42580,42581,42582,42583,42584,42585,42586,42587,42588,42589,42590,
+		42591,42592,42593,42594,42595,42596,42597,42598,42599,42600,42601,42602,42603,42604,42605,42606,
+		42607,42608,42609,42610,42611,42612,42613,42614,42615,42616,42617,42618,42619,42620,42621,42622,
+		42623,42624,42625,42626,42627,42628,42629,42630,42631,42632,42633,42634,42635,42636,42637,42638,
+		42639,42640,42641,42642,42643,42644,42645,42646,42647,42648,42649,42650,42651,42652,42653,42654,
+		42655,42656,42657,42658,42659,42660,42661,42662,42663,42664,42665,42666,42667,42668,42669,42670,
+		42671,42672,42673,42674,42675,42676,42677,42678,42679,42680,42681,42682,42683,42684,42685,42686,
+		42687,42688,42689,42690,42691,42692,42693,42694,42695,42696,42697,42698,42699,42700,42701,42702,
+		42703,42704,42705,42706,42707,42708,42709,42710,42711,42712,42713,42714,42715,42716,42717,42718,
+		42719,42720,42721,42722,42723,42724,42725,42726,42727,42728,42729,42730,42731,42732,42733,42734,
+		42735,42736,42737,42738,42739,42740,42741,42742,42743,42744,42745,42746,42747,42748,42749,42750,
+		42751,42752,42753,42754,42755,42756,42757,42758,42759,42760,42761,42762,42763,42764,42765,42766,
+		42767,42768,42769,42770,42771,42772,42773,42774,42775,42776,42777,42778,42779,42780,42781,42782,
+		42783,42784,42785,42786,42787,42788,42789,42790,42791,42792,42793,42794,42795,42796,42797,42798,
+		42799,42800,42801,42802,42803,42804,42805,42806,42807,42808,42809,42810,42811,42812,42813,42814,
+		42815,42816,42817,42818,42819,42820,42821,42822,42823,42824,42825,42826,42827,42828,42829,42830,
+		42831,42832,42833,42834,42835,42836,42837,42838,42839,42840,42841,42842,42843,42844,42845,42846,
+		42847,42848,42849,42850,42851,42852,42853,42854,42855,42856,42857,42858,42859,42860,42861,42862,
+		42863,42864,42865,42866,42867,42868,42869,42870,42871,42872,42873,42874,42875,42876,42877,42878,
+		42879,42880,42881,42882,42883,42884,42885,42886,42887,42888,42889,42890,42891,42892,42893,42894,
+		42895,42896,42897,42898,42899,42900,42901,42902,42903,42904,42905,42906,42907,42908,42909,42910,
+		42911,42912,42913,42914,42915,42916,42917,42918,42919,42920,42921,42922,42923,42924,42925,42926,
+		42927,42928,42929,42930,42931,42932,42933,42934,42935,42936,42937,42938,42939,42940,42941,42942,
+		42943,42944,42945,42946,42947,42948,42949,42950,42951,42952,42953,42954,42955,42956,42957,42958,
+		42959,42960,42961,42962,42963,42964,42965,42966,42967,42968,42969,42970,42971,42972,42973,42974,
+		42975,42976,42977,42978,42979,42980,42981,42982,42983,42984,42985,42986,42987,42988,42989,42990,
+		42991,42992,42993,42994,42995,42996,42997,42998,42999,43000,43001,43002,43003,43004,43005,43006,
+		43007,43008,43009,43010,43011,43012,43013,43014,43015,43016,43017,43018,43019,43020,43021,43022,
+		43023,43024,43025,43026,43027,43028,43029,43030,43031,43032,43033,43034,43035,43036,43037,43038,
+		43039,43040,43041,43042,43043,43044,43045,43046,43047,43048,43049,43050,43051,43052,43053,43054,
+		43055,43056,43057,43058,43059,43060,43061,43062,43063,43064,43065,43066,43067,43068,43069,43070,
+		43071,43072,43073,43074,43075,43076,43077,43078,43079,43080,43081,43082,43083,43084,43085,43086,
+		43087,43088,43089,43090,43091,43092,43093,43094,43095,43096,43097,43098,43099,43100,43101,43102,
+		43103,43104,43105,43106,43107,43108,43109,43110,43111,43112,43113,43114,43115,43116,43117,43118,
+		43119,43120,43121,43122,43123,43124,43125,43126,43127,43128,43129,43130,43131,43132,43133,43134,
+		43135,43136,43137,43138,43139,43140,43141,43142,43143,43144,43145,43146,43147,43148,43149,43150,
+		43151,43152,43153,43154,43155,43156,43157,43158,43159,43160,43161,43162,43163,43164,43165,43166,
+		43167,43168,43169,43170,43171,43172,43173,43174,43175,43176,43177,43178,43179,43180,43181,43182,
+		43183,43184,43185,43186,43187,43188,43189,43190,43191,43192,43193,43194,43195,43196,43197,43198,
+		43199,43200,43201,43202,43203,43204,43205,43206,43207,43208,43209,43210,43211,43212,43213,43214,
+		43215,43216,43217,43218,43219,43220,43221,43222,43223,43224,43225,43226,43227,43228,43229,43230,
+		43231,43232,43233,43234,43235,43236,43237,43238,43239,43240,43241,43242,43243,43244,43245,43246,
+		43247,43248,43249,43250,43251,43252,43253,43254,43255,43256,43257,43258,43259,43260,43261,43262,
+		43263,43264,43265,43266,43267,43268,43269,43270,43271,43272,43273,43274,43275,43276,43277,43278,
+		43279,43280,43281,43282,43283,43284,43285,43286,43287,43288,43289,43290,43291,43292,43293,43294,
+		43295,43296,43297,43298,58369,18722,43299,43300,43301,43302,43303,43304,43305,43306,43307,43308,
+		43309,43310,43311,58369,18735,43312,43313,43314,43315,43316,43317,43318,43319,43320,43321,43322,
+		43323,43324,43325,43326,43327,43328,43329,58369,18753,43330,43331,43332,43333,43334,43335,43336,
+		43337,43338,43339,43340,43341,43342,43343,43344,43345,43346,43347,43348,43349,43350,43351,43352,
+		43353,43354,43355,43356,43357,58369,18781,43358,43359,43360,43361,43362,43363,43364,43365,43366,
+		43367,43368,43369,43370,43371,43372,43373,43374,43375,43376,43377,43378,43379,43380,43381,43382,
+		43383,43384,43385,43386,43387,43388,43389,43390,43391,43392,43393,43394,43395,43396,43397,43398,
+		43399,43400,43401,43402,43403,43404,43405,43406,43407,43408,43409,43410,43411,43412,43413,43414,
+		43415,43416,43417,43418,43419,43420,43421,43422,43423,43424,43425,43426,43427,43428,43429,43430,
+		43431,43432,43433,43434,43435,43436,43437,43438,43439,59393,18863,43440,59393,18864,43441,59393,
+		18865,43442,59393,18866,43443,59393,18867,43444,59393,18868,43445,59393,18869,43446,59393,18870,
+		43447,59393,18871,43448,59393,18872,43449,59393,18873,43450,59393,18874,43451,59393,18875,43452,
+		59393,18876,43453,59393,18877,43454,59393,18878,43455,59393,18879,43456,59393,18880,43457,59393,
+		18881,43458,59393,18882,43459,59393,18883,43460,59393,18884,43461,59393,18885,43462,59393,18886,
+		43463,59393,18887,43464,59393,18888,43465,59393,18889,43466,59393,18890,43467,59393,18891,43468,
+		59393,18892,43469,59393,18893,43470,59393,18894,43471,43472,43473,43474,43475,43476,43477,43478,
+		43479,43480,43481,43482,43483,43484,43485,43486,43487,43488,43489,43490,43491,43492,43493,43494,
+		43495,43496,43497,43498,43499,43500,43501,43502,43503,43504,43505,43506,43507,43508,43509,43510,
+		43511,43512,43513,43514,43515,43516,43517,43518,43519,43520,43521,43522,43523,43524,43525,43526,
+		43527,43528,43529,43530,43531,43532,43533,43534,43535,43536,43537,43538,43539,43540,43541,43542,
+		43543,43544,43545,43546,43547,43548,43549,43550,43551,43552,43553,43554,43555,43556,43557,43558,
+		43559,43560,43561,43562,43563,43564,43565,43566,43567,43568,43569,43570,43571,43572,43573,43574,
+		43575,43576,43577,43578,43579,43580,43581,43582,43583,43584,43585,43586,43587,43588,43589,43590,
+		43591,43592,43593,43594,43595,43596,43597,43598,43599,43600,43601,43602,43603,43604,43605,43606,
+		43607,43608,43609,43610,43611,43612,43613,43614,43615,43616,43617,43618,43619,43620,43621,43622,
+		43623,43624,43625,43626,43627,43628,43629,43630,43631,43632,43633,43634,43635,43636,43637,43638,
+		43639,43640,43641,43642,43643,43644,43645,43646,43647,43648,43649,43650,43651,43652,43653,43654,
+		43655,43656,43657,43658,43659,43660,43661,43662,43663,43664,43665,43666,43667,43668,43669,43670,
+		43671,43672,43673,43674,43675,43676,43677,43678,43679,43680,43681,43682,43683,43684,43685,43686,
+		43687,43688,43689,43690,43691,43692,43693,43694,43695,43696,43697,43698,43699,43700,43701,43702,
+		43703,43704,43705,43706,43707,43708,43709,43710,43711,43712,43713,43714,43715,43716,43717,43718,
+		43719,43720,43721,43722,43723,43724,43725,43726,43727,43728,43729,43730,43731,43732,43733,43734,
+		43735,43736,43737,43738,43739,43740,43741,43742,43743,43744,43745,43746,43747,43748,43749,43750,
+		43751,43752,43753,43754,43755,43756,43757,43758,43759,43760,43761,43762,43763,43764,43765,43766,
+		43767,43768,43769,43770,43771,43772,43773,43774,43775,43776,43777,43778,43779,43780,43781,43782,
+		43783,43784,43785,43786,43787,43788,43789,43790,43791,43792,43793,43794,43795,43796,43797,43798,
+		43799,43800,43801,43802,43803,43804,43805,43806,43807,43808,43809,43810,43811,43812,43813,43814,
+		43815,43816,43817,43818,43819,43820,43821,43822,43823,43824,43825,43826,43827,43828,43829,43830,
+		43831,43832,43833,43834,43835,43836,43837,43838,43839,43840,43841,43842,43843,43844,43845,43846,
+		43847,43848,43849,43850,43851,43852,43853,43854,43855,43856,43857,43858,43859,43860,43861,43862,
+		43863,43864,43865,43866,43867,43868,43869,43870,43871,43872,43873,43874,43875,43876,43877,43878,
+		43879,59393,19303,43880,59393,19304,43881,59393,19305,43882,59393,19306,43883,59393,19307,43884,
+		59393,19308,43885,59393,19309,43886,59393,19310,43887,59393,19311,43888,59393,19312,43889,59393,
+		19313,43890,59393,19314,43891,59393,19315,43892,59393,19316,43893,59393,19317,43894,59393,19318,
+		43895,59393,19319,43896,59393,19320,43897,59393,19321,43898,59393,19322,43899,59393,19323,43900,
+		59393,19324,43901,59393,19325,43902,59393,19326,43903,59393,19327,43904,59393,19328,43905,59393,
+		19329,43906,59393,19330,43907,59393,19331,43908,59393,19332,43909,59393,19333,43910,59393,19334,
+		43911,59393,19335,43912,59393,19336,43913,59393,19337,43914,59393,19338,43915,59393,19339,43916,
+		59393,19340,43917,59393,19341,43918,59393,19342,43919,43920,43921,43922,43923,43924,43925,43926,
+		43927,43928,43929,43930,43931,43932,43933,43934,43935,43936,43937,43938,43939,43940,43941,43942,
+		43943,43944,43945,43946,43947,43948,43949,43950,43951,43952,43953,43954,43955,43956,43957,43958,
+		43959,43960,43961,43962,43963,43964,43965,43966,43967,43968,43969,43970,43971,43972,43973,43974,
+		43975,43976,43977,43978,43979,43980,43981,43982,43983,43984,43985,43986,43987,43988,43989,43990,
+		43991,43992,43993,43994,43995,43996,43997,43998,43999,44000,44001,44002,44003,44004,44005,44006,
+		44007,44008,44009,44010,44011,44012,44013,44014,44015,44016,44017,44018,44019,44020,44021,44022,
+		44023,44024,44025,44026,44027,44028,44029,44030,44031,44032,44033,44034,44035,44036,44037,44038,
+		44039,44040,44041,44042,44043,44044,44045,44046,44047,44048,44049,44050,44051,44052,44053,44054,
+		44055,44056,44057,44058,44059,44060,44061,44062,44063,44064,44065,44066,44067,44068,44069,44070,
+		44071,44072,44073,44074,44075,44076,44077,44078,44079,44080,44081,44082,44083,44084,44085,44086,
+		44087,44088,44089,44090,44091,44092,44093,44094,44095,44096,44097,44098,44099,44100,44101,44102,
+		44103,44104,44105,44106,44107,44108,44109,44110,44111,44112,44113,44114,44115,44116,44117,44118,
+		44119,44120,44121,44122,44123,44124,44125,44126,44127,44128,44129,44130,44131,44132,44133,44134,
+		44135,44136,44137,44138,44139,44140,44141,44142,44143,44144,44145,44146,44147,44148,44149,44150,
+		44151,44152,44153,44154,44155,44156,44157,44158,44159,44160,44161,44162,44163,44164,44165,44166,
+		44167,44168,44169,44170,44171,44172,44173,44174,44175,44176,44177,44178,44179,44180,44181,44182,
+		44183,44184,44185,44186,44187,44188,44189,44190,44191,44192,44193,44194,44195,44196,44197,44198,
+		44199,44200,44201,44202,44203,44204,44205,44206,44207,44208,44209,44210,44211,44212,44213,44214,
+		44215,44216,44217,44218,44219,44220,44221,44222,44223,44224,44225,44226,44227,44228,44229,44230,
+		44231,44232,44233,44234,44235,44236,44237,44238,44239,44240,44241,44242,44243,44244,44245,44246,
+		44247,44248,44249,44250,44251,44252,44253,44254,44255,44256,44257,44258,44259,44260,44261,44262,
+		44263,44264,44265,44266,44267,44268,44269,44270,44271,44272,44273,44274,44275,44276,44277,44278,
+		44279,44280,44281,44282,44283,44284,44285,44286,44287,44288,44289,44290,44291,44292,44293,44294,
+		44295,44296,44297,44298,44299,44300,44301,44302,44303,44304,44305,44306,44307,44308,44309,44310,
+		44311,44312,44313,44314,44315,44316,44317,44318,44319,44320,44321,44322,44323,44324,44325,44326,
+		44327,44328,44329,44330,44331,44332,44333,44334,44335,44336,44337,44338,44339,44340,44341,44342,
+		44343,44344,44345,44346,44347,44348,44349,44350,44351,44352,44353,44354,44355,44356,44357,44358,
+		44359,44360,44361,44362,44363,44364,44365,44366,44367,44368,44369,44370,44371,44372,44373,44374,
+		44375,44376,44377,44378,44379,44380,44381,44382,44383,44384,44385,44386,44387,44388,44389,44390,
+		44391,44392,44393,44394,44395,44396,44397,44398,44399,44400,44401,44402,44403,44404,44405,44406,
+		44407,44408,44409,44410,44411,44412,44413,44414,44415,44416,44417,44418,44419,44420,44421,44422,
+		44423,44424,44425,44426,44427,44428,44429,44430,44431,44432,44433,44434,44435,44436,44437,44438,
+		44439,44440,44441,44442,44443,44444,44445,44446,44447,44448,44449,44450,44451,44452,44453,44454,
+		44455,44456,44457,44458,44459,44460,44461,44462,44463,44464,44465,44466,44467,44468,44469,44470,
+		44471,44472,44473,44474,44475,44476,44477,44478,44479,44480,44481,44482,44483,44484,44485,44486,
+		44487,44488,44489,44490,44491,44492,44493,44494,44495,44496,44497,44498,44499,44500,44501,44502,
+		44503,44504,44505,44506,44507,44508,44509,44510,44511,44512,44513,44514,44515,44516,44517,44518,
+		44519,44520,44521,44522,44523,44524,44525,44526,44527,44528,44529,44530,44531,44532,44533,44534,
+		44535,44536,44537,44538,44539,44540,44541,44542,44543,44544,44545,44546,44547,44548,44549,44550,
+		44551,44552,44553,44554,44555,44556,44557,44558,44559,44560,44561,44562,44563,44564,44565,44566,
+		44567,44568,44569,44570,44571,44572,44573,44574,44575,44576,44577,44578,44579,44580,44581,44582,
+		44583,44584,44585,44586,44587,44588,44589,44590,44591,44592,44593,44594,44595,44596,44597,44598,
+		44599,44600,44601,44602,44603,44604,44605,44606,44607,44608,44609,44610,44611,44612,44613,44614,
+		44615,44616,44617,44618,44619,44620,44621,44622,44623,44624,44625,44626,44627,44628,44629,44630,
+		44631,44632,44633,44634,44635,44636,44637,44638,44639,44640,44641,44642,44643,44644,44645,44646,
+		44647,44648,44649,44650,44651,44652,44653,44654,44655,44656,44657,44658,44659,44660,44661,44662,
+		44663,44664,44665,44666,44667,44668,44669,44670,44671,44672,44673,44674,44675,44676,44677,44678,
+		44679,44680,44681,44682,44683,44684,44685,44686,44687,44688,44689,44690,44691,44692,44693,44694,
+		44695,44696,44697,44698,44699,44700,44701,44702,44703,44704,44705,44706,44707,44708,44709,44710,
+		44711,44712,44713,44714,44715,44716,44717,44718,44719,44720,44721,44722,44723,44724,44725,44726,
+		44727,44728,44729,44730,44731,44732,44733,44734,44735,44736,44737,44738,44739,44740,44741,44742,
+		44743,44744,44745,44746,44747,44748,44749,44750,44751,44752,44753,44754,44755,44756,44757,44758,
+		44759,44760,44761,44762,44763,44764,44765,44766,44767,44768,44769,44770,44771,44772,44773,44774,
+		44775,44776,44777,44778,44779,44780,44781,44782,44783,44784,44785,44786,44787,44788,44789,44790,
+		44791,44792,44793,44794,44795,44796,44797,44798,44799,44800,44801,44802,44803,44804,44805,44806,
+		44807,44808,44809,44810,44811,44812,44813,44814,44815,44816,44817,44818,44819,44820,44821,44822,
+		44823,44824,44825,44826,44827,44828,44829,44830,44831,44832,44833,44834,44835,44836,44837,44838,
+		44839,44840,44841,44842,44843,44844,44845,44846,44847,44848,44849,44850,44851,44852,44853,44854,
+		44855,44856,44857,44858,44859,44860,44861,44862,44863,44864,44865,44866,44867,44868,44869,44870,
+		44871,44872,44873,44874,44875,44876,44877,44878,44879,44880,44881,44882,44883,44884,44885,44886,
+		44887,44888,44889,44890,44891,44892,44893,44894,44895,44896,44897,44898,44899,44900,44901,44902,
+		44903,44904,44905,44906,44907,44908,44909,44910,44911,44912,44913,44914,44915,44916,44917,44918,
+		44919,44920,44921,44922,44923,44924,44925,44926,44927,44928,44929,44930,44931,44932,44933,44934,
+		44935,44936,44937,44938,44939,44940,44941,44942,44943,44944,44945,44946,44947,44948,44949,44950,
+		44951,44952,44953,44954,44955,44956,44957,44958,44959,44960,44961,44962,44963,44964,44965,44966,
+		44967,44968,44969,44970,44971,44972,44973,44974,44975,44976,44977,44978,44979,44980,44981,44982,
+		44983,44984,44985,44986,44987,44988,44989,44990,44991,44992,44993,44994,50177,20418,58617,0,
+		44995,44996,44997,44998,44999,45000,45001,45002,45003,45004,45005,45006,45007,45008,45009,45010,
+		45011,45012,45013,45014,45015,63745,20439,45016,45017,45018,45019,45020,45021,45022,45023,45024,
+		63745,20448,45025,63745,20449,45026,45027,45028,63745,20452,45029,45030,45031,45032,45033,63745,
+		20457,45034,63745,20458,45035,63745,20459,45036,63745,20460,45037,63745,20461,45038,45039,45040,
+		45041,45042,45043,45044,63745,20468,45045,45046,45047,45048,45049,45050,45051,45052,45053,45054,
+		45055,45056,45057,45058,45059,45060,45061,45062,45063,45064,45065,45066,45067,45068,45069,45070,
+		45071,45072,45073,45074,45075,45076,45077,45078,45079,45080,45081,45082,45083,45084,45085,45086,
+		45087,45088,45089,45090,45091,45092,45093,45094,45095,45096,45097,45098,45099,45100,45101,45102,
+		45103,45104,45105,45106,45107,45108,45109,45110,45111,45112,45113,45114,45115,45116,45117,45118,
+		45119,45120,45121,45122,45123,45124,45125,45126,45127,45128,45129,45130,45131,45132,45133,45134,
+		45135,45136,45137,45138,45139,45140,45141,45142,45143,45144,45145,45146,45147,45148,45149,45150,
+		45151,45152,45153,45154,50177,20578,58369,20581,45155,45156,45157,45158,45159,45160,45161,45162,
+		45163,45164,45165,45166,45167,45168,45169,45170,45171,45172,45173,45174,45175,45176,45177,50177,
+		20601,58618,0,45178,45179,45180,45181,45182,45183,45184,45185,45186,45187,45188,45189,45190,
+		45191,45192,45193,45194,45195,45196,45197,45198,45199,45200,45201,45202,45203,45204,45205,45206,
+		63745,20630,45207,63745,20631,45208,45209,63745,20633,45210,45211,45212,45213,45214,45215,45216,
+		45217,63745,20641,50177,20641,58618,0,45218,45219,50177,20643,58618,0,50177,20643,58369,
+		20646,45220,45221,63745,20645,50177,20645,58618,0,45222,45223,45224,63745,20648,50177,20648,
+		58618,0,45225,45226,45227,45228,45229,45230,45231,45232,45233,45234,45235,45236,45237,45238,
+		45239,45240,45241,45242,50177,20666,58618,0,45243,45244,45245,45246,45247,45248,45249,45250,
+		45251,45252,45253,45254,45255,45256,45257,45258,45259,45260,45261,45262,45263,45264,45265,45266,
+		45267,45268,45269,45270,45271,45272,45273,45274,45275,45276,45277,45278,45279,45280,45281,45282,
+		45283,45284,45285,45286,45287,45288,45289,45290,45291,45292,45293,45294,45295,45296,45297,45298,
+		45299,45300,45301,45302,45303,45304,45305,45306,45307,45308,45309,45310,45311,45312,45313,45314,
+		45315,45316,45317,45318,45319,45320,45321,45322,45323,45324,45325,45326,45327,45328,45329,45330,
+		45331,45332,45333,45334,45335,45336,45337,45338,45339,45340,45341,45342,45343,45344,45345,45346,
+		45347,45348,45349,45350,45351,45352,45353,45354,45355,45356,45357,45358,45359,45360,45361,45362,
+		45363,45364,45365,45366,45367,45368,45369,45370,45371,45372,45373,45374,45375,45376,45377,45378,
+		45379,45380,45381,45382,45383,45384,45385,45386,45387,45388,45389,45390,45391,45392,45393,45394,
+		45395,45396,45397,45398,45399,45400,45401,45402,45403,45404,45405,45406,45407,45408,45409,45410,
+		45411,45412,45413,45414,45415,45416,45417,45418,45419,45420,45421,45422,45423,45424,45425,45426,
+		45427,45428,45429,45430,45431,45432,45433,45434,45435,45436,45437,45438,45439,45440,45441,45442,
+		45443,45444,45445,45446,45447,45448,45449,45450,45451,45452,45453,45454,45455,45456,45457,45458,
+		45459,45460,45461,45462,45463,45464,45465,45466,45467,45468,45469,45470,45471,45472,45473,45474,
+		45475,45476,45477,45478,45479,45480,45481,45482,45483,45484,45485,45486,45487,45488,45489,45490,
+		45491,45492,45493,45494,45495,45496,45497,45498,45499,45500,45501,45502,45503,45504,45505,45506,
+		45507,45508,45509,45510,45511,45512,45513,45514,45515,45516,45517,45518,45519,45520,45521,45522,
+		45523,45524,45525,45526,45527,45528,45529,45530,45531,45532,45533,45534,45535,45536,45537,45538,
+		45539,45540,45541,45542,45543,45544,45545,45546,45547,45548,45549,45550,45551,45552,45553,45554,
+		45555,45556,45557,45558,45559,45560,45561,45562,45563,45564,45565,45566,45567,45568,45569,45570,
+		45571,45572,45573,45574,45575,45576,45577,45578,45579,45580,45581,45582,45583,45584,45585,45586,
+		45587,45588,45589,45590,45591,45592,45593,45594,45595,45596,45597,45598,45599,45600,45601,45602,
+		45603,45604,45605,45606,45607,45608,45609,45610,45611,45612,45613,45614,45615,45616,45617,45618,
+		45619,45620,45621,45622,45623,45624,45625,45626,45627,45628,45629,45630,45631,45632,45633,45634,
+		45635,45636,45637,45638,45639,45640,45641,45642,45643,45644,45645,45646,45647,45648,45649,45650,
+		45651,45652,45653,45654,45655,45656,45657,45658,45659,45660,45661,45662,45663,45664,45665,45666,
+		45667,45668,45669,45670,45671,45672,45673,45674,45675,45676,45677,45678,45679,45680,45681,45682,
+		45683,45684,45685,45686,45687,45688,45689,45690,45691,45692,45693,45694,45695,45696,45697,45698,
+		45699,45700,45701,45702,45703,45704,45705,45706,45707,45708,45709,45710,45711,45712,45713,45714,
+		45715,45716,45717,45718,45719,45720,45721,45722,45723,45724,45725,45726,45727,45728,45729,45730,
+		45731,45732,45733,45734,45735,45736,45737,45738,45739,45740,45741,45742,45743,45744,45745,45746,
+		45747,45748,45749,45750,45751,45752,45753,45754,45755,45756,45757,45758,45759,45760,45761,45762,
+		45763,45764,45765,45766,45767,45768,45769,45770,45771,45772,45773,45774,45775,45776,45777,45778,
+		45779,45780,45781,45782,45783,45784,45785,45786,45787,45788,45789,45790,45791,45792,45793,45794,
+		45795,45796,45797,45798,45799,45800,45801,45802,45803,45804,45805,45806,45807,45808,45809,45810,
+		45811,45812,45813,45814,45815,45816,45817,45818,45819,45820,45821,45822,45823,45824,45825,45826,
+		45827,45828,45829,45830,45831,45832,45833,45834,45835,45836,45837,45838,45839,45840,45841,45842,
+		45843,45844,45845,45846,45847,45848,45849,45850,45851,45852,45853,45854,45855,45856,45857,45858,
+		45859,45860,45861,45862,45863,45864,45865,45866,45867,45868,45869,45870,45871,45872,45873,45874,
+		45875,45876,45877,45878,45879,45880,45881,45882,45883,45884,45885,45886,45887,45888,45889,45890,
+		45891,45892,45893,45894,45895,45896,45897,45898,45899,45900,45901,45902,45903,45904,45905,45906,
+		45907,45908,45909,45910,45911,45912,45913,45914,45915,45916,45917,45918,45919,45920,45921,45922,
+		45923,45924,45925,45926,45927,45928,45929,45930,45931,45932,45933,45934,45935,45936,45937,45938,
+		45939,45940,45941,45942,45943,45944,45945,45946,45947,45948,45949,45950,45951,45952,45953,45954,
+		45955,45956,45957,45958,45959,45960,45961,45962,45963,45964,45965,45966,45967,45968,45969,45970,
+		45971,45972,45973,45974,45975,45976,45977,45978,45979,45980,45981,45982,45983,45984,45985,45986,
+		45987,45988,45989,45990,45991,45992,45993,45994,45995,45996,45997,45998,45999,46000,46001,46002,
+		46003,46004,46005,46006,46007,46008,46009,46010,46011,46012,46013,46014,46015,46016,46017,46018,
+		46019,46020,46021,46022,46023,46024,46025,46026,46027,46028,46029,46030,46031,46032,46033,46034,
+		46035,46036,46037,46038,46039,46040,46041,46042,46043,46044,46045,46046,46047,46048,46049,46050,
+		46051,46052,46053,46054,46055,46056,46057,46058,46059,46060,46061,46062,46063,46064,46065,46066,
+		46067,46068,46069,46070,46071,46072,46073,46074,46075,46076,46077,46078,46079,46080,46081,46082,
+		46083,46084,46085,46086,46087,46088,46089,46090,46091,46092,46093,46094,46095,46096,46097,46098,
+		46099,46100,46101,46102,46103,46104,46105,46106,46107,46108,46109,46110,46111,46112,46113,46114,
+		46115,46116,46117,46118,46119,46120,46121,46122,46123,46124,46125,46126,46127,46128,46129,46130,
+		46131,46132,46133,46134,46135,46136,46137,46138,46139,46140,46141,46142,46143,46144,46145,46146,
+		46147,46148,46149,46150,46151,46152,46153,46154,46155,46156,46157,46158,46159,46160,46161,46162,
+		46163,46164,46165,46166,46167,46168,46169,46170,46171,46172,46173,46174,46175,46176,46177,46178,
+		46179,46180,46181,46182,46183,46184,46185,46186,46187,46188,46189,46190,46191,46192,46193,46194,
+		46195,46196,46197,46198,46199,46200,46201,46202,46203,46204,46205,46206,46207,46208,46209,46210,
+		46211,46212,46213,46214,46215,46216,46217,46218,46219,46220,46221,46222,46223,46224,46225,46226,
+		46227,46228,46229,46230,46231,46232,46233,46234,46235,46236,46237,46238,46239,46240,46241,46242,
+		46243,46244,46245,46246,46247,46248,46249,46250,46251,46252,46253,46254,46255,46256,46257,46258,
+		46259,46260,46261,46262,46263,46264,46265,46266,46267,46268,46269,46270,46271,46272,46273,46274,
+		46275,46276,46277,46278,46279,46280,46281,46282,46283,46284,46285,46286,46287,46288,46289,46290,
+		46291,46292,46293,46294,46295,46296,46297,46298,46299,46300,46301,46302,46303,46304,46305,46306,
+		46307,46308,46309,46310,46311,46312,46313,46314,46315,46316,46317,46318,46319,46320,46321,46322,
+		46323,46324,46325,46326,46327,46328,46329,46330,46331,46332,46333,46334,46335,46336,46337,46338,
+		46339,46340,46341,46342,46343,46344,46345,46346,46347,46348,46349,46350,46351,46352,46353,46354,
+		46355,46356,46357,46358,46359,46360,46361,46362,46363,46364,46365,46366,46367,46368,46369,46370,
+		46371,46372,46373,46374,46375,46376,46377,46378,46379,46380,46381,46382,46383,46384,46385,46386,
+		46387,46388,46389,46390,46391,46392,46393,46394,46395,46396,46397,46398,46399,46400,46401,46402,
+		46403,46404,46405,46406,46407,46408,46409,46410,46411,46412,46413,46414,46415,46416,46417,46418,
+		46419,46420,46421,46422,46423,46424,46425,46426,46427,46428,46429,46430,46431,46432,46433,46434,
+		46435,46436,46437,46438,46439,46440,46441,46442,46443,46444,46445,46446,46447,46448,46449,46450,
+		46451,46452,46453,46454,46455,46456,46457,46458,46459,46460,46461,46462,46463,46464,46465,46466,
+		46467,46468,46469,46470,46471,46472,46473,46474,46475,46476,46477,46478,46479,46480,46481,46482,
+		46483,46484,46485,46486,46487,46488,46489,46490,46491,46492,46493,46494,46495,46496,46497,46498,
+		46499,46500,46501,46502,46503,46504,46505,46506,46507,46508,46509,46510,46511,46512,46513,46514,
+		46515,46516,46517,46518,46519,46520,46521,46522,46523,46524,46525,46526,46527,46528,46529,46530,
+		46531,46532,46533,46534,46535,46536,46537,46538,46539,46540,46541,46542,46543,46544,46545,46546,
+		46547,46548,46549,46550,46551,46552,46553,46554,46555,46556,46557,46558,46559,46560,46561,46562,
+		46563,46564,46565,46566,46567,46568,46569,46570,46571,46572,46573,46574,46575,46576,46577,46578,
+		46579,46580,46581,46582,46583,46584,46585,46586,46587,46588,46589,46590,46591,46592,46593,46594,
+		46595,46596,46597,46598,46599,46600,46601,46602,46603,46604,46605,46606,46607,46608,46609,46610,
+		46611,46612,46613,46614,46615,46616,46617,46618,46619,46620,46621,46622,46623,46624,46625,46626,
+		46627,46628,46629,46630,46631,46632,46633,46634,46635,46636,46637,46638,46639,46640,46641,46642,
+		46643,46644,46645,46646,46647,46648,46649,46650,46651,46652,46653,46654,46655,46656,46657,46658,
+		46659,46660,46661,46662,46663,46664,46665,46666,46667,46668,46669,46670,46671,46672,46673,46674,
+		46675,46676,46677,46678,46679,46680,46681,46682,46683,46684,46685,46686,46687,46688,46689,46690,
+		46691,46692,46693,46694,46695,46696,46697,46698,46699,46700,46701,46702,46703,46704,46705,46706,
+		46707,46708,46709,46710,46711,46712,46713,46714,46715,46716,46717,46718,46719,46720,46721,46722,
+		46723,46724,46725,46726,46727,46728,46729,46730,46731,46732,46733,46734,46735,46736,46737,46738,
+		46739,46740,46741,46742,46743,46744,46745,46746,46747,46748,46749,46750,46751,46752,46753,46754,
+		46755,46756,46757,46758,46759,46760,46761,46762,46763,46764,46765,46766,46767,46768,46769,46770,
+		46771,46772,46773,46774,46775,46776,46777,46778,46779,46780,46781,46782,46783,46784,46785,46786,
+		46787,46788,46789,46790,46791,46792,46793,46794,46795,46796,46797,46798,46799,46800,46801,46802,
+		46803,46804,46805,46806,46807,46808,46809,46810,46811,46812,46813,46814,46815,46816,46817,46818,
+		46819,46820,46821,46822,46823,46824,46825,46826,46827,46828,46829,46830,46831,46832,46833,46834,
+		46835,46836,46837,46838,46839,46840,46841,46842,46843,46844,46845,46846,46847,46848,46849,46850,
+		46851,46852,46853,46854,46855,46856,46857,46858,46859,46860,46861,46862,46863,46864,46865,46866,
+		46867,46868,46869,46870,46871,46872,46873,46874,46875,46876,46877,46878,46879,46880,46881,46882,
+		46883,46884,46885,46886,46887,46888,46889,46890,46891,46892,46893,46894,46895,46896,46897,46898,
+		46899,46900,46901,46902,46903,46904,46905,46906,46907,46908,46909,46910,46911,46912,46913,46914,
+		46915,46916,46917,46918,46919,46920,46921,46922,46923,46924,46925,46926,46927,46928,46929,46930,
+		46931,46932,46933,46934,46935,46936,46937,46938,46939,46940,46941,46942,46943,46944,46945,46946,
+		46947,46948,46949,46950,46951,46952,46953,46954,46955,46956,46957,46958,46959,46960,46961,46962,
+		46963,46964,46965,46966,46967,46968,46969,46970,46971,46972,46973,46974,46975,46976,46977,46978,
+		46979,46980,46981,46982,46983,46984,46985,46986,46987,46988,46989,46990,46991,46992,46993,46994,
+		46995,46996,46997,46998,46999,47000,47001,47002,47003,47004,47005,47006,47007,47008,47009,47010,
+		47011,47012,47013,47014,47015,47016,47017,47018,47019,47020,47021,47022,47023,47024,47025,47026,
+		47027,47028,47029,47030,47031,47032,47033,47034,47035,47036,47037,47038,47039,47040,47041,47042,
+		47043,47044,47045,47046,47047,47048,47049,47050,47051,47052,47053,47054,47055,47056,47057,47058,
+		47059,47060,47061,47062,47063,47064,47065,47066,47067,47068,47069,47070,47071,47072,47073,47074,
+		47075,47076,47077,47078,47079,47080,47081,47082,47083,47084,47085,47086,47087,47088,47089,47090,
+		47091,47092,47093,47094,47095,47096,47097,47098,47099,47100,47101,47102,47103,47104,47105,47106,
+		47107,47108,47109,47110,47111,47112,47113,47114,47115,47116,47117,47118,47119,47120,47121,47122,
+		47123,47124,47125,47126,47127,47128,47129,47130,47131,47132,47133,47134,47135,47136,47137,47138,
+		47139,47140,47141,47142,47143,47144,47145,47146,47147,47148,47149,47150,47151,47152,47153,47154,
+		47155,47156,47157,47158,47159,47160,47161,47162,47163,47164,47165,47166,47167,47168,47169,47170,
+		47171,47172,47173,47174,47175,47176,47177,47178,47179,47180,47181,47182,47183,47184,47185,47186,
+		47187,47188,47189,47190,47191,47192,47193,47194,47195,47196,47197,47198,47199,47200,47201,47202,
+		47203,47204,47205,47206,47207,47208,47209,47210,47211,47212,47213,47214,47215,47216,47217,47218,
+		47219,47220,47221,47222,47223,47224,47225,47226,47227,47228,47229,47230,47231,47232,47233,47234,
+		47235,47236,47237,47238,47239,47240,47241,47242,47243,47244,47245,47246,47247,47248,47249,47250,
+		47251,47252,47253,47254,47255,47256,47257,47258,47259,47260,47261,47262,47263,47264,47265,47266,
+		47267,47268,47269,47270,47271,47272,47273,47274,47275,47276,47277,47278,47279,47280,47281,47282,
+		47283,47284,47285,47286,47287,47288,47289,47290,47291,47292,47293,47294,47295,47296,47297,47298,
+		47299,47300,47301,47302,47303,47304,47305,47306,47307,47308,47309,47310,47311,47312,47313,47314,
+		47315,47316,47317,47318,47319,47320,47321,47322,47323,47324,47325,47326,47327,47328,47329,47330,
+		47331,47332,47333,47334,47335,47336,47337,47338,47339,47340,47341,47342,47343,47344,47345,47346,
+		47347,47348,47349,47350,47351,47352,47353,47354,47355,47356,47357,47358,47359,47360,47361,47362,
+		47363,47364,47365,47366,47367,47368,47369,47370,47371,47372,47373,47374,47375,47376,47377,47378,
+		47379,47380,47381,47382,47383,47384,47385,47386,47387,47388,47389,47390,47391,47392,47393,47394,
+		47395,47396,47397,47398,47399,47400,47401,47402,47403,47404,47405,47406,47407,47408,47409,47410,
+		47411,47412,47413,47414,47415,47416,47417,47418,47419,47420,47421,47422,47423,47424,47425,47426,
+		47427,47428,47429,47430,47431,47432,47433,47434,47435,47436,47437,47438,47439,47440,47441,47442,
+		47443,47444,47445,47446,47447,47448,47449,47450,47451,47452,47453,47454,47455,47456,47457,47458,
+		47459,47460,47461,47462,47463,47464,47465,47466,47467,47468,47469,47470,47471,47472,47473,47474,
+		47475,47476,47477,47478,47479,47480,47481,47482,47483,47484,47485,47486,47487,47488,47489,47490,
+		47491,47492,47493,47494,47495,47496,47497,47498,47499,47500,47501,47502,47503,47504,47505,47506,
+		47507,47508,47509,47510,47511,47512,47513,47514,47515,47516,47517,47518,47519,47520,47521,47522,
+		47523,47524,47525,47526,47527,47528,47529,47530,47531,47532,47533,47534,47535,47536,47537,47538,
+		47539,47540,47541,47542,47543,47544,47545,47546,47547,47548,47549,47550,47551,47552,47553,47554,
+		47555,47556,47557,47558,47559,47560,47561,47562,47563,47564,47565,47566,47567,47568,47569,47570,
+		47571,47572,47573,47574,50177,22998,58617,0,47575,50177,22999,58617,0,47576,50177,23000,
+		58617,0,47577,50177,23001,58617,0,47578,50177,23002,58617,0,47579,50177,23003,58617,
+		0,47580,50177,23004,58617,0,50177,23004,58618,0,47581,50177,23005,58617,0,47582,
+		50177,23006,58617,0,47583,50177,23007,58617,0,50177,23007,58618,0,47584,50177,23008,
+		58617,0,50177,23008,58618,0,47585,50177,23009,58617,0,50177,23009,58618,0,47586,
+		50177,23010,58617,0,47587,50177,23011,58617,0,47588,50177,23012,58617,0,47589,50177,
+		23013,58617,0,50177,23013,58618,0,50177,23013,58619,0,47590,50177,23014,58617,0,
+		47591,50177,23015,58617,0,47592,50177,23016,58617,0,47593,50177,23017,58617,0,50177,
+		23017,58618,0,47594,50177,23018,58617,0,50177,23018,58618,0,47595,50177,23019,58617,
+		0,47596,50177,23020,58617,0,47597,47598,47599,47600,47601,47602,47603,47604,47605,47606,
+		47607,47608,47609,47610,47611,47612,47613,47614,47615,47616,47617,47618,47619,47620,47621,47622,
+		47623,47624,47625,47626,47627,47628,47629,47630,47631,47632,47633,47634,47635,47636,47637,47638,
+		47639,47640,47641,47642,47643,47644,47645,47646,47647,47648,47649,47650,47651,47652,47653,47654,
+		47655,47656,47657,47658,47659,47660,47661,47662,47663,47664,47665,47666,47667,47668,47669,47670,
+		47671,47672,47673,47674,47675,47676,47677,47678,47679,47680,47681,47682,47683,47684,47685,47686,
+		47687,47688,47689,47690,47691,47692,47693,47694,47695,47696,47697,47698,47699,47700,47701,47702,
+		47703,47704,47705,47706,47707,47708,47709,47710,47711,47712,47713,47714,47715,47716,47717,47718,
+		47719,47720,47721,47722,47723,47724,47725,47726,47727,47728,47729,47730,47731,47732,47733,47734,
+		47735,47736,47737,47738,47739,47740,47741,47742,47743,47744,47745,47746,47747,47748,47749,47750,
+		47751,47752,47753,47754,47755,47756,47757,47758,47759,47760,47761,47762,47763,47764,47765,47766,
+		47767,47768,47769,47770,47771,47772,47773,47774,47775,47776,47777,47778,47779,47780,47781,47782,
+		47783,47784,47785,47786,47787,47788,47789,47790,47791,47792,47793,47794,47795,47796,47797,47798,
+		47799,47800,47801,47802,47803,47804,47805,47806,47807,47808,47809,47810,47811,47812,47813,47814,
+		47815,47816,47817,47818,47819,47820,47821,47822,47823,47824,47825,47826,47827,47828,47829,47830,
+		47831,47832,47833,47834,47835,47836,47837,47838,47839,47840,47841,47842,47843,47844,47845,47846,
+		47847,47848,47849,47850,47851,47852,47853,47854,47855,47856,47857,47858,47859,47860,47861,47862,
+		47863,47864,47865,47866,47867,47868,47869,47870,47871,47872,47873,47874,47875,47876,47877,47878,
+		47879,47880,47881,47882,47883,47884,47885,47886,47887,47888,47889,47890,47891,47892,47893,47894,
+		47895,47896,47897,47898,47899,47900,47901,47902,47903,47904,47905,47906,47907,47908,47909,47910,
+		47911,47912,47913,47914,47915,47916,47917,47918,47919,47920,47921,47922,47923,47924,47925,47926,
+		47927,47928,47929,47930,47931,47932,47933,47934,47935,47936,47937,47938,47939,47940,47941,47942,
+		47943,47944,47945,47946,47947,47948,47949,47950,47951,47952,47953,47954,47955,47956,47957,47958,
+		47959,47960,47961,47962,47963,47964,47965,47966,47967,47968,47969,47970,47971,47972,47973,47974,
+		47975,47976,47977,47978,47979,47980,47981,47982,47983,47984,47985,47986,47987,47988,47989,47990,
+		47991,47992,47993,47994,47995,47996,47997,47998,47999,48000,48001,48002,48003,48004,48005,48006,
+		48007,48008,48009,48010,48011,48012,48013,48014,48015,48016,48017,48018,48019,48020,48021,48022,
+		48023,48024,48025,48026,48027,48028,48029,48030,48031,48032,48033,48034,48035,48036,48037,48038,
+		48039,48040,48041,48042,48043,48044,48045,48046,48047,48048,48049,48050,48051,48052,48053,48054,
+		48055,48056,48057,48058,48059,48060,48061,48062,48063,48064,48065,48066,48067,48068,48069,48070,
+		48071,48072,48073,48074,48075,48076,48077,48078,48079,48080,48081,48082,48083,48084,48085,48086,
+		48087,48088,48089,48090,48091,48092,48093,48094,48095,48096,48097,48098,48099,48100,48101,48102,
+		48103,48104,48105,48106,48107,48108,48109,48110,48111,48112,48113,48114,48115,48116,48117,48118,
+		48119,48120,48121,48122,48123,48124,48125,48126,48127,48128,48129,48130,48131,48132,48133,48134,
+		48135,48136,48137,48138,48139,48140,48141,48142,48143,48144,48145,48146,48147,48148,48149,48150,
+		48151,48152,48153,48154,48155,48156,48157,48158,48159,48160,48161,48162,48163,48164,48165,48166,
+		48167,48168,48169,48170,48171,48172,48173,48174,48175,48176,48177,48178,48179,48180,48181,48182,
+		48183,50177,64320,57344,52736,50177,808,50177,64320,49152,52736,58369,809,50689,64320,57344,
+		52736,54273,64320,57344,52736,56321,64320,57344,52736,54273,64320,57344,52737,50177,808,50177,
+		64320,49152,52739,58369,809,50689,64320,57344,52739,50177,808,50177,64320,49152,52745,58369,
+		809,50177,906,50177,64320,49152,52745,58369,907,50689,64320,57344,52745,54273,64320,57344,
+		52745,56321,64320,57344,52745,50689,64320,57344,52746,54273,64320,57344,52746,50689,64320,57344,
+		52747,54273,64320,57344,52747,49665,64320,57344,52749,54273,64320,57344,52761,49665,64320,57344,
+		52774,50177,64320,57344,52776,50177,64320,57344,52780,50689,64320,57344,52781,54273,64320,57344,
+		52781,56321,64320,57344,52781,49665,64320,57344,52786,50177,64320,57344,52790,50177,64320,49152,
+		52790,58617,0,49665,64320,57344,52792,49665,64320,57344,52793,49665,64320,57344,52797,50177,
+		64320,57344,52799,49665,64320,57344,52801,50177,64320,57344,52825,54273,64320,57344,52825,50177,
+		64320,49152,52825,58617,0,50177,64320,57344,52826,50177,64320,57344,52827,50177,808,50177,
+		64320,49152,52829,58369,809,50689,64320,57344,52829,49665,64320,57344,52866,50177,64320,57344,
+		52869,49665,64320,57344,52870,50177,64320,57344,52876,50177,808,50177,64320,49152,52876,58369,
+		809,50177,906,50177,64320,49152,52876,58369,907,50689,64320,57344,52876,54273,64320,57344,
+		52876,56321,64320,57344,52876,50177,808,50177,64320,49152,52884,58369,809,50689,64320,57344,
+		52884,50177,64320,57344,52896,56321,64320,57344,52900,49665,64320,57344,52910,50177,64320,57344,
+		52922,54273,64320,57344,52922,50177,64320,57344,52923,49665,64320,57344,52928,49665,64320,57344,
+		52940,50177,808,50177,64320,49152,52963,58369,809,49665,64320,57344,52964,56321,64320,49152,
+		52964,56321,64320,57344,54412,50177,808,50177,64320,49152,52993,58369,809,50689,64320,57344,
+		52993,50177,808,50177,64320,49152,53009,58369,809,50689,64320,57344,53009,49665,64320,57344,
+		53088,49665,64320,57344,53120,49665,64320,57344,53126,49665,64320,57344,53131,49665,64320,57344,
+		53166,49665,64320,57344,53179,49665,64320,57344,53183,49665,64320,57344,53250,49665,64320,57344,
+		53291,49665,64320,57344,53370,49665,64320,57344,53401,49665,64320,57344,53455,49665,64320,57344,
+		53466,49665,64320,57344,53479,50689,64320,57344,53546,50177,64320,57344,53567,49665,64320,57344,
+		53568,49665,64320,57344,53573,49665,64320,57344,53581,49665,64320,57344,53588,49665,64320,57344,
+		53604,50177,64320,57344,53605,49665,64320,57344,53607,49665,64320,57344,53608,49665,64320,57344,
+		53609,50177,64320,57344,53611,50177,808,50177,64320,49152,53611,58369,809,50689,64320,57344,
+		53611,49665,64320,57344,53613,50177,808,50177,64320,49152,53613,58369,809,50689,64320,57344,
+		53613,49665,64320,57344,53623,49665,64320,57344,53632,50177,64320,57344,53634,50177,64320,49152,
+		53634,58617,0,49665,64320,57344,53645,56321,64320,57344,53645,49665,64320,57344,53650,49665,
+		64320,57344,53653,50177,64320,57344,53654,49665,64320,57344,53655,50689,64320,57344,53657,49665,
+		64320,57344,53668,50177,64320,57344,53675,49665,64320,57344,53676,49665,64320,57344,53685,49665,
+		64320,57344,53687,49665,64320,57344,53705,49665,64320,57344,53708,49665,64320,57344,53724,49665,
+		64320,57344,53726,50177,64320,57344,53728,50177,64320,49152,53728,58617,0,49665,64320,57344,
+		53749,50177,64320,57344,53749,50177,64320,57344,53760,50177,64320,49152,53760,58617,0,50177,
+		64320,57344,53762,49665,64320,57344,53763,49665,64320,57344,53767,49665,64320,57344,53783,56321,
+		64320,57344,53789,49665,64320,57344,53801,49665,64320,57344,53818,49665,64320,57344,53819,49665,
+		64320,57344,53830,56321,64320,57344,53837,49665,64320,57344,53874,56321,64320,57344,53874,49665,
+		64320,57344,53879,49665,64320,57344,53897,49665,64320,57344,53915,50177,64320,57344,53915,49665,
+		64320,57344,53923,49665,64320,57344,53939,50177,808,50177,64320,49152,53940,58369,809,50689,
+		64320,57344,53940,49665,64320,57344,53959,49665,64320,57344,53961,49665,64320,57344,53970,50177,
+		906,50177,64320,49152,53981,58369,907,49665,64320,57344,53982,49665,64320,57344,53988,49665,
+		64320,57344,54005,50177,64320,57344,54009,49665,64320,57344,54010,49665,64320,57344,54021,49665,
+		64320,57344,54022,50177,64320,57344,54037,49665,64320,57344,54039,50177,64320,57344,54042,50177,
+		64320,57344,54072,50689,64320,57344,54075,49665,64320,57344,54079,50177,64320,57344,54081,50177,
+		808,50177,64320,49152,54081,58369,809,50689,64320,57344,54081,50177,64320,57344,54084,50177,
+		64320,57344,54085,49665,64320,57344,54089,49665,64320,57344,54097,50177,808,50177,64320,49152,
+		54100,58369,809,50689,64320,57344,54100,49665,64320,57344,54106,50177,64320,57344,54108,50177,
+		64320,49152,54108,58617,0,50177,64320,57344,54121,50177,64320,49152,54121,58617,0,50689,
+		64320,57344,54128,49665,64320,57344,54131,49665,64320,57344,54133,49665,64320,57344,54141,49665,
+		64320,57344,54143,50177,64320,57344,54146,50177,64320,49152,54146,58617,0,50177,64320,57344,
+		54198,49665,64320,57344,54211,50177,64320,57344,54216,49665,64320,57344,54218,56321,64320,57344,
+		54220,49665,64320,57344,54239,50177,64320,57344,54243,49665,64320,57344,54245,49665,64320,57344,
+		54251,50689,64320,57344,54255,49665,64320,57344,54257,50689,64320,57344,54259,56321,64320,57344,
+		54259,49665,64320,57344,54278,56321,64320,57344,54280,50177,808,50177,64320,49152,54285,58369,
+		809,50689,64320,57344,54285,49665,64320,57344,54287,49665,64320,57344,54301,49665,64320,57344,
+		54328,56321,64320,57344,54329,49665,64320,57344,54338,49665,64320,57344,54344,49665,64320,57344,
+		54376,50177,808,50177,64320,49152,54396,58369,809,49665,64320,57344,54430,49665,64320,57344,
+		54434,49665,64320,57344,54461,49665,64320,57344,54518,49665,64320,57344,54544,50689,64320,57344,
+		54607,49665,64320,57344,54611,49665,64320,57344,54613,49665,64320,57344,54627,49665,64320,57344,
+		54660,49665,64320,57344,54663,49665,64320,57344,54681,49665,64320,57344,54685,49665,64320,57344,
+		54699,49665,64320,57344,54707,56321,64320,57344,54710,49665,64320,57344,54720,49665,64320,57344,
+		54722,49665,64320,57344,54754,49665,64320,57344,54790,49665,64320,57344,54865,49665,64320,57344,
+		54888,49665,64320,57344,54900,50177,64320,57344,54999,50177,808,50177,64320,49152,55003,58369,
+		809,50689,64320,57344,55003,54273,64320,57344,55003,49665,64320,57344,55033,49665,64320,57344,
+		55062,49665,64320,57344,55063,50177,64320,57344,55071,50177,808,50177,64320,49152,55071,58369,
+		809,50689,64320,57344,55071,54273,64320,57344,55088,49665,64320,57344,55179,49665,64320,57344,
+		55246,49665,64320,57344,55284,49665,64320,57344,55309,49665,64320,57344,55345,49665,64320,57344,
+		55346,49665,64320,57344,55360,49665,64320,57344,55386,49665,64320,57344,55390,49665,64320,57344,
+		55464,49665,64320,57344,55468,49665,64320,57344,55475,49665,64320,57344,55512,49665,64320,57344,
+		55519,50177,64320,57344,55531,49665,64320,57344,55534,56321,64320,57344,55536,49665,64320,57344,
+		55538,49665,64320,57344,55543,50177,64320,57344,55554,49665,64320,57344,55558,50177,64320,57344,
+		55562,50177,64320,57344,55573,49665,64320,57344,55578,56321,64320,57344,55578,50689,64320,57344,
+		55580,49665,64320,57344,55586,50177,64320,57344,55591,56321,64320,49152,55591,56321,64320,57344,
+		60259,54273,64320,57344,55593,56321,64320,57344,55593,49665,64320,57344,55620,49665,64320,57344,
+		55624,49665,64320,57344,55633,49665,64320,57344,55636,49665,64320,57344,55650,49665,64320,57344,
+		55667,50177,64320,57344,55667,50689,64320,57344,55667,49665,64320,57344,55768,49665,64320,57344,
+		55788,49665,64320,57344,55835,49665,64320,57344,55847,49665,64320,57344,55906,49665,64320,57344,
+		55910,49665,64320,57344,55989,49665,64320,57344,56072,49665,64320,57344,56104,49665,64320,57344,
+		56126,50177,64320,57344,56144,56321,64320,57344,56151,50177,808,50177,64320,49152,56166,58369,
+		809,50689,64320,57344,56166,50177,64320,57344,56192,49665,64320,57344,56197,50177,906,50177,
+		64320,49152,56201,58369,907,50689,64320,57344,56215,49665,64320,57344,56259,49665,64320,57344,
+		56280,49665,64320,57344,56295,49665,64320,57344,56302,49665,64320,57344,56307,50177,64320,57344,
+		56312,49665,64320,57344,56319,49665,64320,57344,56326,50177,64320,57344,56335,50177,64320,49152,
+		56335,58617,0,50177,64320,49152,56335,58618,0,49665,64320,57344,56354,50177,64320,57344,
+		56354,50177,64320,49152,56354,58617,0,50177,64320,57344,56355,50177,64320,49152,56355,58617,
+		0,50177,64320,57344,56376,49665,64320,57344,56383,49665,64320,57344,56416,49665,64320,57344,
+		56418,49665,64320,57344,56420,49665,64320,57344,56421,49665,64320,57344,56430,50177,64320,57344,
+		56430,50177,64320,57344,56433,49665,64320,57344,56461,49665,64320,57344,56512,49665,64320,57344,
+		56601,49665,64320,57344,56643,49665,64320,57344,56656,49665,64320,57344,56683,49665,64320,57344,
+		56686,49665,64320,57344,56700,49665,64320,57344,56754,49665,64320,57344,56762,50177,64320,57344,
+		56795,49665,64320,57344,56801,49665,64320,57344,56802,50177,64320,57344,56805,50689,64320,57344,
+		56806,56321,64320,57344,56806,50177,64320,57344,56817,50177,64320,57344,56819,49665,64320,57344,
+		56829,50177,64320,57344,56830,49665,64320,57344,56872,49665,64320,57344,56893,49665,64320,57344,
+		56937,50177,64320,57344,56946,56321,64320,49152,56947,56321,64320,57344,57872,49665,64320,57344,
+		56948,50177,64320,57344,56954,50689,64320,57344,56956,50177,64320,57344,56959,49665,64320,57344,
+		56998,49665,64320,57344,57008,49665,64320,57344,57011,49665,64320,57344,57014,49665,64320,57344,
+		57033,49665,64320,57344,57034,49665,64320,57344,57042,49665,64320,57344,57043,49665,64320,57344,
+		57049,49665,64320,57344,57068,50177,64320,57344,57076,49665,64320,57344,57086,50177,64320,57344,
+		57086,49665,64320,57344,57092,50177,64320,57344,57099,50177,64320,57344,57107,49665,64320,57344,
+		57122,50177,64320,57344,57168,50177,64320,49152,57168,58617,0,50177,64320,57344,57169,49665,
+		64320,57344,57171,50177,64320,57344,57185,49665,64320,57344,57186,49665,64320,57344,57193,49665,
+		64320,57344,57195,50177,64320,57344,57203,49665,64320,57344,57227,56321,64320,57344,57228,50689,
+		64320,57344,57239,49665,64320,57344,57242,49665,64320,57344,57257,49665,64320,57344,57261,50177,
+		64320,57344,57283,50177,64320,49152,57283,58617,0,50177,64320,57344,57284,49665,64320,57344,
+		57293,49665,64320,57344,57303,49665,64320,57344,57333,49665,64320,57344,57337,49665,64320,57344,
+		57362,49665,64320,57344,57372,49665,64320,57344,57461,49665,64320,57344,57473,49665,64320,57344,
+		57492,49665,64320,57344,57543,49665,64320,57344,57560,49665,64320,57344,57569,49665,64320,57344,
+		57608,49665,64320,57344,57668,49665,64320,57344,57672,49665,64320,57344,57676,49665,64320,57344,
+		57678,49665,64320,57344,57696,49665,64320,57344,57704,49665,64320,57344,57722,49665,64320,57344,
+		57742,49665,64320,57344,57744,49665,64320,57344,57764,49665,64320,57344,57775,49665,64320,57344,
+		57778,49665,64320,57344,57822,49665,64320,57344,57842,49665,64320,57344,57846,49665,64320,57344,
+		57856,50177,64320,57344,57864,49665,64320,57344,57872,49665,64320,57344,57883,49665,64320,57344,
+		57902,49665,64320,57344,57908,50177,64320,57344,57910,50177,64320,57344,57931,56321,64320,57344,
+		57931,50177,64320,57344,57932,50177,906,50177,64320,49152,57939,58369,907,56321,64320,57344,
+		57939,49665,64320,57344,57949,56321,64320,57344,58005,49665,64320,57344,58033,49665,64320,57344,
+		58057,49665,64320,57344,58063,49665,64320,57344,58067,49665,64320,57344,58068,49665,64320,57344,
+		58108,49665,64320,57344,58110,56321,64320,57344,58119,49665,64320,57344,58173,49665,64320,57344,
+		58192,56321,64320,57344,58197,49665,64320,57344,58216,49665,64320,57344,58235,49665,64320,57344,
+		58243,49665,64320,57344,58272,49665,64320,57344,58281,49665,64320,57344,58308,49665,64320,57344,
+		58309,49665,64320,57344,58340,49665,64320,57344,58396,49665,64320,57344,58402,49665,64320,57344,
+		58450,49665,64320,57344,58473,49665,64320,57344,58487,49665,64320,57344,58494,49665,64320,57344,
+		58522,49665,64320,57344,58525,49665,64320,57344,58564,50177,64320,57344,58671,50177,64320,57344,
+		58676,50177,64320,57344,58677,49665,64320,57344,58703,49665,64320,57344,58710,50177,906,50177,
+		64320,49152,58711,58369,907,49665,64320,57344,58732,49665,64320,57344,58744,50177,64320,57344,
+		58759,50689,64320,57344,58759,50177,64320,57344,58775,49665,64320,57344,58777,56321,64320,57344,
+		58777,50177,64320,57344,58788,56321,64320,57344,58800,50177,64320,57344,58809,49665,64320,57344,
+		58821,50177,64320,57344,58848,50177,64320,57344,58849,49665,64320,57344,58850,49665,64320,57344,
+		58851,50177,64320,57344,58853,50177,808,50177,64320,49152,58853,58369,809,50689,64320,57344,
+		58853,50177,64320,49152,58853,58617,0,56321,64320,49152,58894,56321,64320,57344,60603,49665,
+		64320,57344,58899,56321,64320,57344,58912,56321,64320,49152,58925,56321,64320,57344,54412,49665,
+		64320,57344,58953,49665,64320,57344,58996,49665,64320,57344,59016,49665,64320,57344,59025,49665,
+		64320,57344,59036,49665,64320,57344,59060,49665,64320,57344,59078,50177,64320,57344,59120,49665,
+		64320,57344,59124,49665,64320,57344,59128,49665,64320,57344,59136,50177,64320,57344,59144,50177,
+		808,50177,64320,49152,59144,58369,809,50689,64320,57344,59144,56321,64320,57344,59144,50177,
+		64320,49152,59144,58617,0,50177,808,50177,64320,49152,59145,58369,809,50689,64320,57344,
+		59145,56321,64320,57344,59145,49665,64320,57344,59159,49665,64320,57344,59163,49665,64320,57344,
+		59169,50177,64320,57344,59176,50177,808,50177,64320,49152,59176,58369,809,50689,64320,57344,
+		59176,50177,906,50177,64320,49152,59180,58369,907,49665,64320,57344,59214,49665,64320,57344,
+		59219,49665,64320,57344,59222,49665,64320,57344,59230,49665,64320,57344,59259,49665,64320,57344,
+		59269,49665,64320,57344,59287,49665,64320,57344,59379,49665,64320,57344,59386,49665,64320,57344,
+		59415,49665,64320,57344,59423,50177,808,50177,64320,49152,59434,58369,809,50689,64320,57344,
+		59434,56321,64320,49152,59434,56321,64320,49152,57103,56321,64320,49152,53018,56321,64320,57344,
+		63806,49665,64320,57344,59474,49665,64320,57344,59521,49665,64320,57344,59525,49665,64320,57344,
+		59534,49665,64320,57344,59560,49665,64320,57344,59668,49665,64320,57344,59714,49665,64320,57344,
+		59811,49665,64320,57344,59882,49665,64320,57344,59906,49665,64320,57344,59923,49665,64320,57344,
+		60072,49665,64320,57344,60115,49665,64320,57344,60123,49665,64320,57344,60164,50177,64320,57344,
+		60192,49665,64320,57344,60193,49665,64320,57344,60244,50177,64320,57344,60258,50689,64320,57344,
+		60259,49665,64320,57344,60274,49665,64320,57344,60279,49665,64320,57344,60281,50177,64320,57344,
+		60281,50177,64320,49152,60282,58617,0,49665,64320,57344,60319,49665,64320,57344,60334,50177,
+		64320,57344,60339,49665,64320,57344,60346,49665,64320,57344,60347,50177,64320,57344,60363,50177,
+		64320,57344,60365,50177,64320,57344,60372,50177,64320,57344,60379,50177,64320,57344,60431,50177,
+		64320,57344,60433,50177,64320,57344,60436,50177,64320,57344,60468,50177,808,50177,64320,49152,
+		60468,58369,809,50689,64320,57344,60468,50177,64320,57344,60469,50177,64320,57344,60474,49665,
+		64320,57344,60494,49665,64320,57344,60519,49665,64320,57344,60552,49665,64320,57344,60607,49665,
+		64320,57344,60620,49665,64320,57344,60621,49665,64320,57344,60645,50689,64320,57344,60648,49665,
+		64320,57344,60694,49665,64320,57344,60699,49665,64320,57344,60702,49665,64320,57344,60724,49665,
+		64320,57344,60734,49665,64320,57344,60737,49665,64320,57344,60777,49665,64320,57344,60778,49665,
+		64320,57344,60791,49665,64320,57344,60792,49665,64320,57344,60805,49665,64320,57344,60875,49665,
+		64320,57344,60890,49665,64320,57344,60906,49665,64320,57344,60921,49665,64320,57344,60954,49665,
+		64320,57344,60975,49665,64320,57344,61038,56321,64320,57344,61056,49665,64320,57344,61084,49665,
+		64320,57344,61114,49665,64320,57344,61127,49665,64320,57344,61131,49665,64320,57344,61137,49665,
+		64320,57344,61147,49665,64320,57344,61199,56321,64320,57344,61204,49665,64320,57344,61218,49665,
+		64320,57344,61219,49665,64320,57344,61294,49665,64320,57344,61382,49665,64320,57344,61419,49665,
+		64320,57344,61438,49665,64320,57344,61467,49665,64320,57344,61470,49665,64320,57344,61497,49665,
+		64320,57344,61514,50177,64320,57344,61547,50177,808,50177,64320,49152,61547,58369,809,50689,
+		64320,57344,61547,50177,64320,57344,61548,49665,64320,57344,61552,49665,64320,57344,61559,49665,
+		64320,57344,61565,49665,64320,57344,61593,49665,64320,57344,61613,50177,906,50177,64320,49152,
+		61625,58369,907,49665,64320,57344,61640,49665,64320,57344,61657,56321,64320,57344,61729,49665,
+		64320,57344,61765,49665,64320,57344,61769,49665,64320,57344,61806,49665,64320,57344,61852,49665,
+		64320,57344,61902,49665,64320,57344,61904,49665,64320,57344,61968,49665,64320,57344,61979,49665,
+		64320,57344,61992,50177,64320,57344,61994,49665,64320,57344,61995,50177,64320,57344,61995,50177,
+		64320,49152,61995,58617,0,49665,64320,57344,62005,50177,64320,57344,62006,50177,64320,57344,
+		62011,50177,64320,57344,62015,50177,64320,57344,62023,49665,64320,57344,62032,50177,64320,57344,
+		62041,50177,64320,57344,62043,50177,64320,49152,62043,58617,0,49665,64320,57344,62050,50177,
+		808,50177,64320,49152,62073,58369,809,50689,64320,57344,62073,49665,64320,57344,62080,49665,
+		64320,57344,62101,50177,64320,57344,62124,50177,64320,57344,62125,49665,64320,57344,62127,49665,
+		64320,57344,62144,49665,64320,57344,62204,49665,64320,57344,62250,49665,64320,57344,62325,49665,
+		64320,57344,62330,50177,64320,57344,62340,49665,64320,57344,62343,50177,64320,57344,62345,49665,
+		64320,57344,62347,50177,64320,49152,62347,58617,0,49665,64320,57344,62373,49665,64320,57344,
+		62386,49665,64320,57344,62430,49665,64320,57344,62470,49665,64320,57344,62473,49665,64320,57344,
+		62498,49665,64320,57344,62535,49665,64320,57344,62556,49665,64320,57344,62569,49665,64320,57344,
+		62577,49665,64320,57344,62597,49665,64320,57344,62601,49665,64320,57344,62616,49665,64320,57344,
+		62666,50177,64320,57344,62684,50177,64320,57344,62694,49665,64320,57344,62726,50177,64320,57344,
+		62744,50177,64320,57344,62751,56321,64320,57344,62751,49665,64320,57344,62756,50177,64320,57344,
+		62760,50177,64320,57344,62768,54273,64320,57344,62770,56321,64320,57344,62771,50689,64320,57344,
+		62775,49665,64320,57344,62779,49665,64320,57344,62782,49665,64320,57344,62809,49665,64320,57344,
+		62821,49665,64320,57344,62832,50177,64320,57344,62859,50177,64320,49152,62859,58617,0,50177,
+		64320,57344,62866,49665,64320,57344,62946,49665,64320,57344,62992,49665,64320,57344,63005,49665,
+		64320,57344,63007,49665,64320,57344,63042,49665,64320,57344,63081,50177,64320,57344,63094,50177,
+		64320,57344,63101,50177,64320,57344,63150,50177,64320,57344,63167,49665,64320,57344,63178,50177,
+		906,50177,64320,49152,63191,58369,907,49665,64320,57344,63195,50177,808,50177,64320,49152,
+		63203,58369,809,50689,64320,57344,63203,49665,64320,57344,63207,50177,64320,57344,63214,50177,
+		64320,49152,63214,58617,0,49665,64320,57344,63220,49665,64320,57344,63233,49665,64320,57344,
+		63262,49665,64320,57344,63263,49665,64320,57344,63296,49665,64320,57344,63306,49665,64320,57344,
+		63371,49665,64320,57344,63399,50177,64320,57344,63451,50177,64320,57344,63458,50177,64320,57344,
+		63475,49665,64320,57344,63566,49665,64320,57344,63595,49665,64320,57344,63628,49665,64320,57344,
+		63633,49665,64320,57344,63690,49665,64320,57344,63692,49665,64320,57344,63739,49665,64320,57344,
+		63786,50177,64320,57344,63802,50177,64320,49152,63802,58617,0,50177,64320,57344,63803,49665,
+		64320,57344,63804,49665,64320,57344,63806,50177,808,50177,64320,49152,63806,58369,809,50689,
+		64320,57344,63806,49665,64320,57344,63816,49665,64320,57344,63817,49665,64320,57344,63824,49665,
+		64320,57344,63830,49665,64320,57344,63837,50177,808,50177,64320,49152,63837,58369,809,50689,
+		64320,57344,63837,49665,64320,57344,63838,49665,64320,57344,63845,50177,808,50177,64320,49152,
+		63853,58369,809,49665,64320,57344,63871,56321,64320,57344,63873,49665,64320,57344,63885,49665,
+		64320,57344,63886,49665,64320,57344,63887,49665,64320,57344,63918,50177,64320,57344,63928,50177,
+		64320,57344,63934,49665,64320,57344,63946,50689,64320,57344,63960,49665,64320,57344,63979,49665,
+		64320,57344,64028,49665,64320,57344,64064,49665,64320,57344,64074,49665,64320,57344,64079,50177,
+		64320,57344,64116,56321,64320,57344,64122,49665,64320,57344,64129,49665,64320,57344,64177,49665,
+		64320,57344,64203,50177,64320,57344,64203,49665,64320,57344,64238,50177,64320,57344,64249,50177,
+		64320,49152,64249,58617,0,49665,64320,57344,64288,50689,64320,57344,64399,49665,64320,57344,
+		64448,49665,64320,57344,64454,49665,64320,57344,64457,49665,64320,57344,64574,49665,64320,57344,
+		64608,50177,64320,57344,64627,49665,64320,57344,64635,49665,64320,57344,64658,49665,64320,57344,
+		64702,49665,64320,57344,64722,49665,64320,57344,64726,49665,64320,57344,64739,49665,64320,57344,
+		64743,49665,64320,57344,64744,50177,64320,57344,64760,50177,64320,57344,64761,49665,64320,57344,
+		64768,49665,64320,57344,64784,49665,64320,57344,64802,49665,64320,57344,64815,56321,64320,57344,
+		64834,49665,64320,57344,64859,49665,64320,57344,64867,49665,64320,57344,64928,49665,64320,57344,
+		64958,49665,64320,57344,64967,49665,64320,57344,65012,49665,64320,57344,65026,49665,64320,57344,
+		65033,49665,64320,57344,65079,49665,64320,57344,65089,49665,64320,57344,65093,50177,64320,57344,
+		65183,50177,64320,57344,65334,49665,64320,57344,65342,50177,64320,57344,65361,50177,64320,57344,
+		65362,50177,64320,49152,65362,58617,0,50177,64320,57344,65363,50177,64320,49152,65363,58617,
+		0,50177,64320,49152,65363,58618,0,49665,64320,57344,65394,49665,64320,57344,65401,49665,
+		64320,57344,65402,49665,64320,57344,65413,50177,64320,57344,65418,50177,64320,49152,65418,58617,
+		0,50177,64320,49152,65418,58618,0,50177,64320,57344,65419,49665,64320,57344,65429,49665,
+		64320,57344,65434,49665,64320,57344,65469,50177,64320,57344,65469,49665,64320,57344,65530,49665,
+		64321,57344,32769,50177,64321,57344,32769,50177,64321,57344,32770,49665,64321,57344,32773,50177,
+		64321,57344,32780,50177,64321,57344,32786,50177,64321,57344,32819,49665,64321,57344,32838,49665,
+		64321,57344,32864,49665,64321,57344,32879,49665,64321,57344,32880,49665,64321,57344,32894,50177,
+		64321,57344,32895,50177,64321,49152,32895,58617,0,50177,64321,57344,32896,50177,64321,57344,
+		32905,50177,64321,49152,32905,58617,0,49665,64321,57344,32907,49665,64321,57344,32941,49665,
+		64321,57344,32946,49665,64321,57344,33027,49665,64321,57344,33086,49665,64321,57344,33240,50177,
+		64321,57344,33251,49665,64321,57344,33256,50177,64321,57344,33258,50177,808,50177,64321,49152,
+		33258,58369,809,49665,64321,57344,33261,50177,64321,57344,33267,50177,808,50177,64321,49152,
+		33267,58369,809,50177,64321,57344,33276,50177,64321,49152,33276,58617,0,49665,64321,57344,
+		33281,49665,64321,57344,33284,50177,64321,57344,33292,49665,64321,57344,33304,50177,64321,57344,
+		33307,50177,64321,57344,33311,50177,64321,57344,33390,49665,64321,57344,33391,50177,64321,57344,
+		33394,50177,64321,57344,33400,49665,64321,57344,33401,50177,64321,57344,33401,50177,64321,49152,
+		33401,58617,0,50177,64321,49152,33401,58618,0,49665,64321,57344,33419,49665,64321,57344,
+		33425,49665,64321,57344,33437,49665,64321,57344,33457,49665,64321,57344,33459,49665,64321,57344,
+		33469,49665,64321,57344,33509,49665,64321,57344,33510,49665,64321,57344,33565,49665,64321,57344,
+		33571,49665,64321,57344,33590,49665,64321,57344,33618,49665,64321,57344,33619,49665,64321,57344,
+		33635,49665,64321,57344,33709,49665,64321,57344,33725,49665,64321,57344,33737,49665,64321,57344,
+		33738,49665,64321,57344,33740,49665,64321,57344,33756,49665,64321,57344,33767,49665,64321,57344,
+		33775,49665,64321,57344,33777,49665,64321,57344,33853,49665,64321,57344,33865,49665,64321,57344,
+		33879,49665,64321,57344,34030,49665,64321,57344,34033,49665,64321,57344,34035,49665,64321,57344,
+		34044,49665,64321,57344,34070,49665,64321,57344,34148,49665,64321,57344,34253,49665,64321,57344,
+		34298,49665,64321,57344,34310,49665,64321,57344,34322,49665,64321,57344,34349,49665,64321,57344,
+		34367,50177,64321,57344,34381,50177,64321,57344,34382,49665,64321,57344,34384,49665,64321,57344,
+		34396,49665,64321,57344,34407,49665,64321,57344,34409,50177,64321,57344,34411,49665,64321,57344,
+		34440,49665,64321,57344,34473,49665,64321,57344,34530,49665,64321,57344,34574,49665,64321,57344,
+		34600,49665,64321,57344,34667,49665,64321,57344,34681,49665,64321,57344,34694,49665,64321,57344,
+		34746,49665,64321,57344,34785,49665,64321,57344,34817,49665,64321,57344,34847,50177,64321,57344,
+		34880,49665,64321,57344,34892,50177,64321,57344,34892,49665,64321,57344,34912,49665,64321,57344,
+		34915,50177,64321,57344,34915,50177,64321,57344,34916,49665,64321,57344,35010,49665,64321,57344,
+		35023,49665,64321,57344,35031,49665,64321,57344,35038,49665,64321,57344,35041,49665,64321,57344,
+		35064,49665,64321,57344,35066,49665,64321,57344,35088,49665,64321,57344,35137,49665,64321,57344,
+		35172,50177,64321,57344,35198,50177,64321,57344,35199,50177,64321,57344,35200,49665,64321,57344,
+		35206,49665,64321,57344,35211,50177,64321,57344,35211,49665,64321,57344,35222,50177,64321,57344,
+		35265,50177,64321,57344,35282,50177,64321,49152,35282,58617,0,56321,64321,57344,35299,50177,
+		64321,57344,35328,49665,64321,57344,35488,49665,64321,57344,35498,49665,64321,57344,35519,49665,
+		64321,57344,35531,49665,64321,57344,35538,49665,64321,57344,35542,49665,64321,57344,35565,49665,
+		64321,57344,35576,49665,64321,57344,35582,49665,64321,57344,35585,49665,64321,57344,35641,49665,
+		64321,57344,35672,49665,64321,57344,35712,49665,64321,57344,35722,50177,64321,57344,35744,50177,
+		64321,57344,35895,50177,64321,57344,35910,49665,64321,57344,35912,49665,64321,57344,35925,50177,
+		64321,57344,35925,50177,64321,57344,35960,50177,64321,57344,35997,50177,808,50177,64321,49152,
+		36001,58369,809,50689,64321,57344,36001,56321,64321,57344,36009,49665,64321,57344,36011,49665,
+		64321,57344,36033,49665,64321,57344,36034,50177,808,50177,64321,49152,36039,58369,809,50689,
+		64321,57344,36039,49665,64321,57344,36040,49665,64321,57344,36051,49665,64321,57344,36104,49665,
+		64321,57344,36123,50177,64321,57344,36125,50177,64321,57344,36196,50177,64321,57344,36208,56321,
+		64321,57344,36208,49665,64321,57344,36215,50177,64321,57344,36275,50177,64321,49152,36275,58617,
+		0,49665,64321,57344,36284,49665,64321,57344,36299,49665,64321,57344,36335,49665,64321,57344,
+		36336,50177,64321,57344,36523,49665,64321,57344,36554,50177,64321,57344,36554,49665,64321,57344,
+		36564,49665,64321,57344,36646,49665,64321,57344,36650,49665,64321,57344,36664,49665,64321,57344,
+		36667,49665,64321,57344,36706,50177,64321,57344,36710,50177,64321,57344,36763,49665,64321,57344,
+		36766,49665,64321,57344,36784,50177,64321,57344,36784,50177,64321,57344,36789,49665,64321,57344,
+		36790,50177,64321,57344,36790,50177,64321,49152,36790,58617,0,50177,64321,49152,36790,58618,
+		0,49665,64321,57344,36899,49665,64321,57344,36920,56321,64321,57344,36938,50689,64321,57344,
+		36969,49665,64321,57344,36978,49665,64321,57344,36988,49665,64321,57344,37007,50177,64321,57344,
+		37009,50177,64321,49152,37009,58617,0,49665,64321,57344,37012,49665,64321,57344,37070,49665,
+		64321,57344,37086,49665,64321,57344,37105,49665,64321,57344,37117,49665,64321,57344,37137,49665,
+		64321,57344,37147,50177,64321,57344,37193,56321,64321,57344,37197,49665,64321,57344,37226,49665,
+		64321,57344,37273,49665,64321,57344,37300,50177,64321,57344,37318,49665,64321,57344,37324,50177,
+		64321,57344,37324,49665,64321,57344,37327,49665,64321,57344,37329,50177,64321,57344,37329,50177,
+		808,50177,64321,49152,37329,58369,809,50689,64321,57344,37329,49665,64321,57344,37428,49665,
+		64321,57344,37432,49665,64321,57344,37494,49665,64321,57344,37500,49665,64321,57344,37591,49665,
+		64321,57344,37592,49665,64321,57344,37636,49665,64321,57344,37706,49665,64321,57344,37881,49665,
+		64321,57344,37909,50177,64321,57344,38021,50177,64321,57344,38263,50177,64321,57344,38264,50177,
+		64321,57344,38271,50177,64321,57344,38272,49665,64321,57344,38283,49665,64321,57344,38317,49665,
+		64321,57344,38327,50177,64321,57344,38376,50177,64321,57344,38428,50177,64321,49152,38428,58617,
+		0,50177,64321,57344,38429,49665,64321,57344,38446,49665,64321,57344,38475,49665,64321,57344,
+		38477,49665,64321,57344,38517,49665,64321,57344,38520,49665,64321,57344,38524,49665,64321,57344,
+		38534,49665,64321,57344,38563,50177,64321,57344,38582,49665,64321,57344,38583,49665,64321,57344,
+		38584,50177,64321,57344,38585,49665,64321,57344,38595,49665,64321,57344,38626,49665,64321,57344,
+		38627,50177,64321,57344,38632,50177,64321,49152,38632,58617,0,49665,64321,57344,38646,49665,
+		64321,57344,38647,49665,64321,57344,38691,49665,64321,57344,38706,49665,64321,57344,38728,50177,
+		64321,57344,38737,50177,64321,57344,38738,49665,64321,57344,38742,50177,64321,57344,38750,50177,
+		64321,57344,38754,50177,64321,57344,38761,50177,64321,57344,38859,49665,64321,57344,38875,49665,
+		64321,57344,38880,50177,64321,57344,38886,50177,64321,57344,38893,50177,64321,57344,38899,49665,
+		64321,57344,38911,50177,64321,57344,38913,50689,64321,57344,38917,49665,64321,57344,38923,49665,
+		64321,57344,38936,49665,64321,57344,38953,49665,64321,57344,38971,49665,64321,57344,39006,50177,
+		64321,57344,39029,50177,64321,57344,39080,50177,64321,57344,39118,50177,64321,57344,39131,50177,
+		64321,57344,39134,50177,64321,57344,39135,50177,64321,57344,39136,50177,64321,49152,39136,58617,
+		0,49665,64321,57344,39138,49665,64321,57344,39151,49665,64321,57344,39164,49665,64321,57344,
+		39208,49665,64321,57344,39209,50177,64321,57344,39267,50177,64321,57344,39318,50177,64321,49152,
+		39318,58617,0,50177,64321,57344,39321,49665,64321,57344,39335,50177,64321,57344,39340,49665,
+		64321,57344,39362,49665,64321,57344,39409,49665,64321,57344,39422,49665,64321,57344,39530,50177,
+		64321,57344,39532,50177,64321,57344,39592,50177,64321,49152,39592,58617,0,50177,64321,57344,
+		39640,50177,64321,57344,39647,49665,64321,57344,39698,50177,64321,57344,39717,50177,64321,57344,
+		39727,50177,64321,57344,39730,50177,64321,57344,39740,50177,64321,49152,39740,58617,0,50177,
+		64321,57344,39770,49665,64321,57344,39791,49665,64321,57344,40000,49665,64321,57344,40023,50177,
+		64321,57344,40060,50177,64321,57344,40165,49665,64321,57344,40189,49665,64321,57344,40295,49665,
+		64321,57344,40372,49665,64321,57344,40442,49665,64321,57344,40478,50177,64321,57344,40479,50177,
+		64321,57344,40565,50177,64321,49152,40565,58617,0,49665,64321,57344,40575,50177,64321,57344,
+		40575,49665,64321,57344,40599,49665,64321,57344,40607,50177,64321,57344,40613,50177,64321,57344,
+		40614,49665,64321,57344,40635,50177,64321,57344,40635,50177,64321,57344,40643,50177,64321,57344,
+		40644,50177,64321,57344,40653,49665,64321,57344,40654,50177,64321,57344,40657,49665,64321,57344,
+		40697,50177,64321,57344,40697,50177,64321,57344,40701,49665,64321,57344,40702,50177,64321,57344,
+		40702,49665,64321,57344,40709,50177,64321,57344,40718,49665,64321,57344,40719,50177,64321,57344,
+		40723,49665,64321,57344,40726,50177,64321,57344,40736,49665,64321,57344,40763,50177,64321,57344,
+		40763,49665,64321,57344,40771,50177,64321,57344,40778,50177,64321,49152,40778,58617,0,50177,
+		64321,57344,40784,50177,64321,57344,40786,50177,64321,49152,40786,58617,0,50177,64321,57344,
+		40831,49665,64321,57344,40845,50177,64321,57344,40845,50177,64321,49152,40845,58617,0,49665,
+		64321,57344,40846,50177,64321,57344,40857,49665,64321,57344,40860,50177,64321,57344,40860,50177,
+		64321,49152,40860,58617,0,50177,64321,49152,40860,58618,0,50177,64321,57344,40863,50177,
+		64321,57344,40864,49665,64321,57344,64014,49665,64321,57344,64015,49665,64321,57344,64017,49665,
+		64321,57344,64019,49665,64321,57344,64020,49665,64321,57344,64031,49665,64321,57344,64033,49665,
+		64321,57344,64035,49665,64321,57344,64036,49665,64321,57344,64039,49665,64321,57344,64040,49665,
+		64321,57344,64041,49665,64384,57344,46238,49665,64384,57344,46265,49665,64384,57344,46267,49665,
+		64384,57344,46303,49665,64384,57344,46357,49665,64384,57344,46830,49665,64384,57344,46844,49665,
+		64384,57344,46977,49665,64384,57344,47151,49665,64384,57344,47202,49665,64384,57344,47228,49665,
+		64384,57344,47303,49665,64384,57344,47331,49665,64384,57344,47388,49665,64384,57344,47418,49665,
+		64384,57344,47662,49665,64384,57344,47724,49665,64384,57344,47844,49665,64384,57344,47880,49665,
+		64384,57344,47897,49665,64384,57344,47945,49665,64384,57344,48029,49665,64384,57344,48152,49665,
+		64384,57344,48206,49665,64384,57344,48435,49665,64384,57344,48534,49665,64384,57344,48812,49665,
+		64384,57344,48824,49665,64384,57344,48923,49665,64384,57344,49148,49665,64384,57344,49160,49665,
+		64384,57344,49176,49665,64384,57344,49209,49665,64384,57344,49222,49665,64384,57344,49302,49665,
+		64384,57344,49379,49665,64384,57344,49455,49665,64384,57344,49666,49665,64384,57344,49703,49665,
+		64384,57344,49824,49665,64384,57344,49921,49665,64384,57344,49972,49665,64384,57344,50009,49665,
+		64384,57344,50133,49665,64384,57344,50137,49665,64384,57344,50187,49665,64384,57344,50283,49665,
+		64384,57344,50475,49665,64384,57344,50525,49665,64384,57344,50529,49665,64384,57344,50539,49665,
+		64384,57344,50647,49665,64384,57344,50681,49665,64384,57344,50741,49665,64384,57344,50878,49665,
+		64384,57344,50887,49665,64384,57344,51605,49665,64384,57344,51686,49665,64384,57344,51822,49665,
+		64384,57344,51830,49665,64384,57344,51890,49665,64384,57344,52019,49665,64384,57344,52174,49665,
+		64384,57344,52430,49665,64384,57344,52461,49665,64384,57344,52472,49665,64384,57344,52566,49665,
+		64388,57344,33058,49665,64388,57344,34076,49665,64388,57344,34085,49665,64388,57344,34123,49665,
+		64388,57344,34362,49665,64388,57344,34820,49665,64388,57344,35038,49665,64388,57344,35372,49665,
+		64388,57344,35683,49665,64388,57344,38116,49665,64388,57344,38568,49665,64388,57344,38634,49665,
+		64388,57344,39368,49665,64388,57344,39704,49665,64388,57344,40203,49665,64388,57344,40420,49665,
+		64388,57344,40422,49665,64388,57344,41347,49665,64388,57344,41375,49665,64388,57344,41777,49665,
+		64388,57344,42708,49665,64388,57344,43076,49665,64388,57344,43082,49665,64388,57344,43788,49665,
+		64388,57344,44017,49665,64388,57344,45066,49665,64388,57344,45752,49665,64388,57344,45919,49665,
+		64388,57344,45971,49665,64388,57344,45980,49665,64388,57344,46019,49665,64388,57344,46037,49665,
+		64388,57344,46189,49665,64388,57344,46755,49665,64388,57344,47271,49665,64388,57344,47757,49665,
+		64388,57344,47866,49665,64388,57344,48316,49665,64388,57344,48414,49665,64388,57344,48849,49665,
+		64388,57344,48990,49665,64388,57344,49038,49665,64388,57344,49763,49665,64388,57344,49902,49665,
+		64388,57344,50091,49665,64388,57344,50696,49665,64388,57344,50997,49665,64388,57344,51220,49665,
+		64388,57344,52278,49665,64388,57344,52370,49665,64388,57344,53153,49665,64388,57344,53176,49665,
+		64388,57344,53316,49665,64388,57344,53490,49665,64388,57344,53491,49665,64388,57344,53529,49665,
+		64388,57344,53555,49665,64388,57344,53833,49665,64388,57344,54301,49665,64388,57344,54822,49665,
+		64388,57344,54938,49665,64388,57344,54981,49665,64388,57344,55676,49665,64388,57344,55975,49665,
+		64388,57344,56235,49665,64388,57344,56448,49665,64388,57344,56528,49665,64388,57344,57222,49665,
+		64388,57344,57818,49665,64388,57344,57896,49665,64388,57344,57927,49665,64388,57344,58073,49665,
+		64388,57344,58174,49665,64388,57344,58586,49665,64388,57344,58659,49665,64388,57344,58792,49665,
+		64388,57344,59303,49665,64388,57344,59317,49665,64388,57344,60220,49665,64388,57344,60470,49665,
+		64388,57344,60629,49665,64388,57344,60779,49665,64388,57344,61228,49665,64388,57344,61361,49665,
+		64388,57344,61650,49665,64388,57344,62410,49665,64388,57344,63079,49665,64388,57344,63662,49665,
+		64388,57344,63846,49665,64388,57344,64680,49665,64388,57344,65235,49665,64388,57344,65327,49665,
+		64389,57344,34258,49665,64389,57344,34285,49665,64389,57344,34606,49665,64389,57344,35834,49665,
+		64389,57344,36215,49665,64389,57344,37189,49665,64389,57344,37343,49665,64389,57344,37402,49665,
+		64389,57344,37898,49665,64389,57344,38038,49665,64389,57344,38326,49665,64389,57344,39728,49665,
+		64389,57344,41166,49665,64389,57344,41221,49665,64389,57344,41486,49665,64389,57344,41617,49665,
+		64389,57344,41874,49665,64389,57344,42496,57857,65533,35840,35993,12823,37457,12824,37457,12825,
+		37457,12826,37457,12827,37457,12828,37457,12829,37457,12830,37457,12831,37457,12832,37457,12833,
+		37457,12834,37457,12835,37457,12836,37457,12837,37457,12838,37457,12839,37457,12840,37457,12841,
+		37457,12842,37457,12843,37457,12844,37457,12845,37457,12846,37457,12847,37457,12848,37457,12849,
+		37457,12850,37457,12851,37457,12852,37457,12853,37457,12854,37457,12855,37457,12856,37457,12857,
+		37457,12858,37457,12859,37457,12860,37457,12861,37457,12862,37457,12863,37457,12864,37457,12865,
+		37457,12866,37457,12867,37457,12868,37457,12823,37458,12824,37458,12825,37458,12826,37458,12827,
+		37458,12828,37458,12829,37458,12830,37458,12831,37458,12832,37458,12833,37458,12834,37458,12835,
+		37458,12836,37458,12837,37458,12838,37458,12839,37458,12840,37458,12841,37458,12842,37458,12843,
+		37458,12844,37458,12845,37458,12846,37458,12847,37458,12848,37458,12849,37458,12850,37458,12851,
+		37458,12852,37458,12853,37458,12854,37458,12855,37458,12856,37458,12857,37458,12858,37458,12859,
+		37458,12860,37458,12861,37458,12862,37458,12863,37458,12864,37458,12865,37458,12866,37458,12867,
+		37458,12868,37458,12823,37459,12824,37459,12825,37459,12826,37459,12827,37459,12828,37459,12829,
+		37459,12830,37459,12831,37459,12832,37459,12833,37459,12834,37459,12835,37459,12836,37459,12837,
+		37459,12838,37459,12839,37459,12840,37459,12841,37459,12842,37459,12843,37459,12844,37459,12845,
+		37459,12846,37459,12847,37459,12848,37459,12849,37459,12850,37459,12851,37459,12852,37459,12853,
+		37459,12854,37459,12855,37459,12856,37459,12857,37459,12858,37459,12859,37459,12860,37459,12861,
+		37459,12862,37459,12863,37459,12864,37459,12865,37459,12866,37459,12867,37459,12868,37459,12823,
+		37460,12824,37460,12825,37460,12826,37460,12827,37460,12828,37460,12829,37460,12830,37460,12831,
+		37460,12832,37460,12833,37460,12834,37460,12835,37460,12836,37460,12837,37460,12838,37460,12839,
+		37460,12840,37460,12841,37460,12842,37460,12843,37460,12844,37460,12845,37460,12846,37460,12847,
+		37460,12848,37460,12849,37460,12850,37460,12851,37460,12852,37460,12853,37460,12854,37460,12855,
+		37460,12856,37460,12857,37460,12858,37460,12859,37460,12860,37460,12861,37460,12862,37460,12863,
+		37460,12864,37460,12865,37460,12866,37460,12867,37460,12868,37460,12823,37461,12824,37461,12825,
+		37461,12826,37461,12827,37461,12828,37461,12829,37461,12830,37461,12831,37461,12832,37461,12833,
+		37461,12834,37461,12835,37461,12836,37461,12837,37461,12838,37461,12839,37461,12840,37461,12841,
+		37461,12842,37461,12843,37461,12844,37461,12845,37461,12846,37461,12847,37461,12848,37461,12849,
+		37461,12850,37461,12851,37461,12852,37461,12853,37461,12854,37461,12855,37461,12856,37461,12857,
+		37461,12858,37461,12859,37461,12860,37461,12861,37461,12862,37461,12863,37461,12864,37461,12865,
+		37461,12866,37461,12867,37461,12868,37461,12888,37521,12889,37521,12890,37521,12891,37521,12892,
+		37521,12893,37521,12894,37521,12896,37521,12897,37521,12900,37521,12898,37521,12901,37521,12902,
+		37521,12903,37521,12904,37521,12905,37521,12906,37521,12907,37521,12908,37521,12909,37521,12910,
+		37521,12911,37521,12912,37521,12913,37521,12914,37521,12915,37521,12916,37521,12917,37521,12918,
+		37521,12919,37521,12920,37521,12921,37521,12922,37521,12923,37521,12924,37521,12925,37521,12895,
+		37521,12926,37521,12927,37521,12928,37521,12929,37521,50177,12926,50177,12911,37521,50177,12926,
+		50177,12919,37521,12887,37521,12899,37521,12888,37522,12889,37522,12890,37522,12891,37522,12892,
+		37522,12893,37522,12894,37522,12896,37522,12897,37522,12900,37522,12898,37522,12901,37522,12902,
+		37522,12903,37522,12904,37522,12905,37522,12906,37522,12907,37522,12908,37522,12909,37522,12910,
+		37522,12911,37522,12912,37522,12913,37522,12914,37522,12915,37522,12916,37522,12917,37522,12918,
+		37522,12919,37522,12920,37522,12921,37522,12922,37522,12923,37522,12924,37522,12925,37522,12895,
+		37522,12926,37522,12927,37522,12928,37522,12929,37522,50177,12926,50177,12911,37522,50177,12926,
+		50177,12919,37522,12887,37522,12899,37522,12888,37523,12889,37523,12890,37523,12891,37523,12892,
+		37523,12893,37523,12894,37523,12896,37523,12897,37523,12900,37523,12898,37523,12901,37523,12902,
+		37523,12903,37523,12904,37523,12905,37523,12906,37523,12907,37523,12908,37523,12909,37523,12910,
+		37523,12911,37523,12912,37523,12913,37523,12914,37523,12915,37523,12916,37523,12917,37523,12918,
+		37523,12919,37523,12920,37523,12921,37523,12922,37523,12923,37523,12924,37523,12925,37523,12895,
+		37523,12926,37523,12927,37523,12928,37523,12929,37523,50177,12926,50177,12911,37523,50177,12926,
+		50177,12919,37523,12887,37523,12899,37523,12888,37524,12889,37524,12890,37524,12891,37524,12892,
+		37524,12893,37524,12894,37524,12896,37524,12897,37524,12900,37524,12898,37524,12901,37524,12902,
+		37524,12903,37524,12904,37524,12905,37524,12906,37524,12907,37524,12908,37524,12909,37524,12910,
+		37524,12911,37524,12912,37524,12913,37524,12914,37524,12915,37524,12916,37524,12917,37524,12918,
+		37524,12919,37524,12920,37524,12921,37524,12922,37524,12923,37524,12924,37524,12925,37524,12895,
+		37524,12926,37524,12927,37524,12928,37524,12929,37524,50177,12926,50177,12911,37524,50177,12926,
+		50177,12919,37524,12887,37524,12899,37524,12888,37525,12889,37525,12890,37525,12891,37525,12892,
+		37525,12893,37525,12894,37525,12896,37525,12897,37525,12900,37525,12898,37525,12901,37525,12902,
+		37525,12903,37525,12904,37525,12905,37525,12906,37525,12907,37525,12908,37525,12909,37525,12910,
+		37525,12911,37525,12912,37525,12913,37525,12914,37525,12915,37525,12916,37525,12917,37525,12918,
+		37525,12919,37525,12920,37525,12921,37525,12922,37525,12923,37525,12924,37525,12925,37525,12895,
+		37525,12926,37525,12927,37525,12928,37525,12929,37525,50177,12926,50177,12911,37525,50177,12926,
+		50177,12919,37525,12887,37525,12899,37525,14046,38671,14047,38671,14048,38671,14049,38671,14050,
+		38671,14051,38671,14052,38671,14053,38671,14054,38671,14055,38671,14056,38671,14057,38671,14058,
+		38671,14059,38671,14060,38671,14061,38671,14062,38671,14063,38671,14064,38671,14065,38671,14066,
+		38671,14067,38671,14068,38671,14069,38671,14070,38671,14071,38671,14072,38671,14073,38671,14074,
+		38671,14075,38671,14076,38671,14077,38671,14078,38671,14079,38671,14080,38671,14081,38671,14082,
+		38671,14083,38671,14084,38671,14085,38671,14086,38671,14087,38671,14088,38671,14089,38671,14046,
+		38672,14047,38672,14048,38672,14049,38672,14050,38672,14051,38672,14052,38672,14053,38672,14054,
+		38672,14055,38672,14056,38672,14057,38672,14058,38672,14059,38672,14060,38672,14061,38672,14062,
+		38672,14063,38672,14064,38672,14065,38672,14066,38672,14067,38672,14068,38672,14069,38672,14070,
+		38672,14071,38672,14072,38672,14073,38672,14074,38672,14075,38672,14076,38672,14077,38672,14078,
+		38672,14079,38672,14080,38672,14081,38672,14082,38672,14083,38672,14084,38672,14085,38672,14086,
+		38672,14087,38672,14088,38672,14089,38672,14046,38673,14047,38673,14048,38673,14049,38673,14050,
+		38673,14051,38673,14052,38673,14053,38673,14054,38673,14055,38673,14056,38673,14057,38673,14058,
+		38673,14059,38673,14060,38673,14061,38673,14062,38673,14063,38673,14064,38673,14065,38673,14066,
+		38673,14067,38673,14068,38673,14069,38673,14070,38673,14071,38673,14072,38673,14073,38673,14074,
+		38673,14075,38673,14076,38673,14077,38673,14078,38673,14079,38673,14080,38673,14081,38673,14082,
+		38673,14083,38673,14084,38673,14085,38673,14086,38673,14087,38673,14088,38673,14089,38673,14046,
+		38676,14047,38676,14048,38676,14049,38676,14050,38676,14051,38676,14052,38676,14053,38676,14054,
+		38676,14055,38676,14056,38676,14057,38676,14058,38676,14059,38676,14060,38676,14061,38676,14062,
+		38676,14063,38676,14064,38676,14065,38676,14066,38676,14067,38676,14068,38676,14069,38676,14070,
+		38676,14071,38676,14072,38676,14073,38676,14074,38676,14075,38676,14076,38676,14077,38676,14078,
+		38676,14079,38676,14080,38676,14081,38676,14082,38676,14083,38676,14084,38676,14085,38676,14086,
+		38676,14087,38676,14088,38676,14089,38676,12950,37579,12951,37579,12952,37579,12953,37579,12954,
+		37579,12955,37579,12956,37579,12957,37579,12958,37579,12959,37579,12960,37579,12961,37579,12962,
+		37579,12963,37579,12964,37579,12965,37579,12966,37579,12967,37579,12968,37579,12969,37579,12970,
+		37579,12971,37579,12972,37579,12973,37579,12974,37579,12975,37579,12976,37579,12977,37579,12978,
+		37579,12979,37579,12980,37579,12981,37579,12982,37579,12983,37579,12984,37579,12985,37579,12986,
+		37579,12987,37579,12988,37579,12989,37579,12990,37579,12991,37579,12992,37579,12993,37579,12994,
+		37579,12995,37579,12996,37579,12997,37579,12950,37580,12951,37580,12952,37580,12953,37580,12954,
+		37580,12955,37580,12956,37580,12957,37580,12958,37580,12959,37580,12960,37580,12961,37580,12962,
+		37580,12963,37580,12964,37580,12965,37580,12966,37580,12967,37580,12968,37580,12969,37580,12970,
+		37580,12971,37580,12972,37580,12973,37580,12974,37580,12975,37580,12976,37580,12977,37580,12978,
+		37580,12979,37580,12980,37580,12981,37580,12982,37580,12983,37580,12984,37580,12985,37580,12986,
+		37580,12987,37580,12988,37580,12989,37580,12990,37580,12991,37580,12992,37580,12993,37580,12994,
+		37580,12995,37580,12996,37580,12997,37580,12950,37583,12951,37583,12952,37583,12953,37583,12954,
+		37583,12955,37583,12956,37583,12957,37583,12958,37583,12959,37583,12960,37583,12961,37583,12962,
+		37583,12963,37583,12964,37583,12965,37583,12966,37583,12967,37583,12968,37583,12969,37583,12970,
+		37583,12971,37583,12972,37583,12973,37583,12974,37583,12975,37583,12976,37583,12977,37583,12978,
+		37583,12979,37583,12980,37583,12981,37583,12982,37583,12983,37583,12984,37583,12985,37583,12986,
+		37583,12987,37583,12988,37583,12989,37583,12990,37583,12991,37583,12992,37583,12993,37583,12994,
+		37583,12995,37583,12996,37583,12997,37583,12950,37585,12951,37585,12952,37585,12953,37585,12954,
+		37585,12955,37585,12956,37585,12957,37585,12958,37585,12959,37585,12960,37585,12961,37585,12962,
+		37585,12963,37585,12964,37585,12965,37585,12966,37585,12967,37585,12968,37585,12969,37585,12970,
+		37585,12971,37585,12972,37585,12973,37585,12974,37585,12975,37585,12976,37585,12977,37585,12978,
+		37585,12979,37585,12980,37585,12981,37585,12982,37585,12983,37585,12984,37585,12985,37585,12986,
+		37585,12987,37585,12988,37585,12989,37585,12990,37585,12991,37585,12992,37585,12993,37585,12994,
+		37585,12995,37585,12996,37585,12997,37585,12950,37586,12951,37586,12952,37586,12953,37586,12954,
+		37586,12955,37586,12956,37586,12957,37586,12958,37586,12959,37586,12960,37586,12961,37586,12962,
+		37586,12963,37586,12964,37586,12965,37586,12966,37586,12967,37586,12968,37586,12969,37586,12970,
+		37586,12971,37586,12972,37586,12973,37586,12974,37586,12975,37586,12976,37586,12977,37586,12978,
+		37586,12979,37586,12980,37586,12981,37586,12982,37586,12983,37586,12984,37586,12985,37586,12986,
+		37586,12987,37586,12988,37586,12989,37586,12990,37586,12991,37586,12992,37586,12993,37586,12994,
+		37586,12995,37586,12996,37586,12997,37586
+	};
+
+	template<class T> const boost::uint32_t collation_data<T>::contraction_chars[2817] = {
+		76,183,0,76,903,0,108,183,0,108,903,0,
+		1048,774,0,1080,774,0,1575,1619,0,1575,1620,0,
+		1575,1621,0,1608,1620,0,1610,1620,0,2503,2494,0,
+		2503,2519,0,2887,2878,0,2887,2902,0,2887,2903,0,
+		2962,3031,0,3014,3006,0,3014,3031,0,3015,3006,0,
+		3142,3158,0,3263,3285,0,3270,3266,0,3270,3266,3285,
+		3270,3285,0,3270,3286,0,3274,3285,0,3398,3390,0,
+		3398,3415,0,3399,3390,0,3545,3530,0,3545,3535,0,
+		3545,3535,3530,3545,3551,0,3548,3530,0,3648,3585,0,
+		3648,3586,0,3648,3587,0,3648,3588,0,3648,3589,0,
+		3648,3590,0,3648,3591,0,3648,3592,0,3648,3593,0,
+		3648,3594,0,3648,3595,0,3648,3596,0,3648,3597,0,
+		3648,3598,0,3648,3599,0,3648,3600,0,3648,3601,0,
+		3648,3602,0,3648,3603,0,3648,3604,0,3648,3605,0,
+		3648,3606,0,3648,3607,0,3648,3608,0,3648,3609,0,
+		3648,3610,0,3648,3611,0,3648,3612,0,3648,3613,0,
+		3648,3614,0,3648,3615,0,3648,3616,0,3648,3617,0,
+		3648,3618,0,3648,3619,0,3648,3620,0,3648,3621,0,
+		3648,3622,0,3648,3623,0,3648,3624,0,3648,3625,0,
+		3648,3626,0,3648,3627,0,3648,3628,0,3648,3629,0,
+		3648,3630,0,3649,3585,0,3649,3586,0,3649,3587,0,
+		3649,3588,0,3649,3589,0,3649,3590,0,3649,3591,0,
+		3649,3592,0,3649,3593,0,3649,3594,0,3649,3595,0,
+		3649,3596,0,3649,3597,0,3649,3598,0,3649,3599,0,
+		3649,3600,0,3649,3601,0,3649,3602,0,3649,3603,0,
+		3649,3604,0,3649,3605,0,3649,3606,0,3649,3607,0,
+		3649,3608,0,3649,3609,0,3649,3610,0,3649,3611,0,
+		3649,3612,0,3649,3613,0,3649,3614,0,3649,3615,0,
+		3649,3616,0,3649,3617,0,3649,3618,0,3649,3619,0,
+		3649,3620,0,3649,3621,0,3649,3622,0,3649,3623,0,
+		3649,3624,0,3649,3625,0,3649,3626,0,3649,3627,0,
+		3649,3628,0,3649,3629,0,3649,3630,0,3650,3585,0,
+		3650,3586,0,3650,3587,0,3650,3588,0,3650,3589,0,
+		3650,3590,0,3650,3591,0,3650,3592,0,3650,3593,0,
+		3650,3594,0,3650,3595,0,3650,3596,0,3650,3597,0,
+		3650,3598,0,3650,3599,0,3650,3600,0,3650,3601,0,
+		3650,3602,0,3650,3603,0,3650,3604,0,3650,3605,0,
+		3650,3606,0,3650,3607,0,3650,3608,0,3650,3609,0,
+		3650,3610,0,3650,3611,0,3650,3612,0,3650,3613,0,
+		3650,3614,0,3650,3615,0,3650,3616,0,3650,3617,0,
+		3650,3618,0,3650,3619,0,3650,3620,0,3650,3621,0,
+		3650,3622,0,3650,3623,0,3650,3624,0,3650,3625,0,
+		3650,3626,0,3650,3627,0,3650,3628,0,3650,3629,0,
+		3650,3630,0,3651,3585,0,3651,3586,0,3651,3587,0,
+		3651,3588,0,3651,3589,0,3651,3590,0,3651,3591,0,
+		3651,3592,0,3651,3593,0,3651,3594,0,3651,3595,0,
+		3651,3596,0,3651,3597,0,3651,3598,0,3651,3599,0,
+		3651,3600,0,3651,3601,0,3651,3602,0,3651,3603,0,
+		3651,3604,0,3651,3605,0,3651,3606,0,3651,3607,0,
+		3651,3608,0,3651,3609,0,3651,3610,0,3651,3611,0,
+		3651,3612,0,3651,3613,0,3651,3614,0,3651,3615,0,
+		3651,3616,0,3651,3617,0,3651,3618,0,3651,3619,0,
+		3651,3620,0,3651,3621,0,3651,3622,0,3651,3623,0,
+		3651,3624,0,3651,3625,0,3651,3626,0,3651,3627,0,
+		3651,3628,0,3651,3629,0,3651,3630,0,3652,3585,0,
+		3652,3586,0,3652,3587,0,3652,3588,0,3652,3589,0,
+		3652,3590,0,3652,3591,0,3652,3592,0,3652,3593,0,
+		3652,3594,0,3652,3595,0,3652,3596,0,3652,3597,0,
+		3652,3598,0,3652,3599,0,3652,3600,0,3652,3601,0,
+		3652,3602,0,3652,3603,0,3652,3604,0,3652,3605,0,
+		3652,3606,0,3652,3607,0,3652,3608,0,3652,3609,0,
+		3652,3610,0,3652,3611,0,3652,3612,0,3652,3613,0,
+		3652,3614,0,3652,3615,0,3652,3616,0,3652,3617,0,
+		3652,3618,0,3652,3619,0,3652,3620,0,3652,3621,0,
+		3652,3622,0,3652,3623,0,3652,3624,0,3652,3625,0,
+		3652,3626,0,3652,3627,0,3652,3628,0,3652,3629,0,
+		3652,3630,0,3661,3634,0,3776,3713,0,3776,3714,0,
+		3776,3716,0,3776,3718,0,3776,3719,0,3776,3720,0,
+		3776,3721,0,3776,3722,0,3776,3724,0,3776,3725,0,
+		3776,3726,0,3776,3727,0,3776,3728,0,3776,3729,0,
+		3776,3730,0,3776,3731,0,3776,3732,0,3776,3733,0,
+		3776,3734,0,3776,3735,0,3776,3736,0,3776,3737,0,
+		3776,3738,0,3776,3739,0,3776,3740,0,3776,3741,0,
+		3776,3742,0,3776,3743,0,3776,3744,0,3776,3745,0,
+		3776,3746,0,3776,3747,0,3776,3749,0,3776,3751,0,
+		3776,3752,0,3776,3753,0,3776,3754,0,3776,3755,0,
+		3776,3756,0,3776,3757,0,3776,3758,0,3776,3804,0,
+		3776,3805,0,3776,3806,0,3776,3807,0,3777,3713,0,
+		3777,3714,0,3777,3716,0,3777,3718,0,3777,3719,0,
+		3777,3720,0,3777,3721,0,3777,3722,0,3777,3724,0,
+		3777,3725,0,3777,3726,0,3777,3727,0,3777,3728,0,
+		3777,3729,0,3777,3730,0,3777,3731,0,3777,3732,0,
+		3777,3733,0,3777,3734,0,3777,3735,0,3777,3736,0,
+		3777,3737,0,3777,3738,0,3777,3739,0,3777,3740,0,
+		3777,3741,0,3777,3742,0,3777,3743,0,3777,3744,0,
+		3777,3745,0,3777,3746,0,3777,3747,0,3777,3749,0,
+		3777,3751,0,3777,3752,0,3777,3753,0,3777,3754,0,
+		3777,3755,0,3777,3756,0,3777,3757,0,3777,3758,0,
+		3777,3804,0,3777,3805,0,3777,3806,0,3777,3807,0,
+		3778,3713,0,3778,3714,0,3778,3716,0,3778,3718,0,
+		3778,3719,0,3778,3720,0,3778,3721,0,3778,3722,0,
+		3778,3724,0,3778,3725,0,3778,3726,0,3778,3727,0,
+		3778,3728,0,3778,3729,0,3778,3730,0,3778,3731,0,
+		3778,3732,0,3778,3733,0,3778,3734,0,3778,3735,0,
+		3778,3736,0,3778,3737,0,3778,3738,0,3778,3739,0,
+		3778,3740,0,3778,3741,0,3778,3742,0,3778,3743,0,
+		3778,3744,0,3778,3745,0,3778,3746,0,3778,3747,0,
+		3778,3749,0,3778,3751,0,3778,3752,0,3778,3753,0,
+		3778,3754,0,3778,3755,0,3778,3756,0,3778,3757,0,
+		3778,3758,0,3778,3804,0,3778,3805,0,3778,3806,0,
+		3778,3807,0,3779,3713,0,3779,3714,0,3779,3716,0,
+		3779,3718,0,3779,3719,0,3779,3720,0,3779,3721,0,
+		3779,3722,0,3779,3724,0,3779,3725,0,3779,3726,0,
+		3779,3727,0,3779,3728,0,3779,3729,0,3779,3730,0,
+		3779,3731,0,3779,3732,0,3779,3733,0,3779,3734,0,
+		3779,3735,0,3779,3736,0,3779,3737,0,3779,3738,0,
+		3779,3739,0,3779,3740,0,3779,3741,0,3779,3742,0,
+		3779,3743,0,3779,3744,0,3779,3745,0,3779,3746,0,
+		3779,3747,0,3779,3749,0,3779,3751,0,3779,3752,0,
+		3779,3753,0,3779,3754,0,3779,3755,0,3779,3756,0,
+		3779,3757,0,3779,3758,0,3779,3804,0,3779,3805,0,
+		3779,3806,0,3779,3807,0,3780,3713,0,3780,3714,0,
+		3780,3716,0,3780,3718,0,3780,3719,0,3780,3720,0,
+		3780,3721,0,3780,3722,0,3780,3724,0,3780,3725,0,
+		3780,3726,0,3780,3727,0,3780,3728,0,3780,3729,0,
+		3780,3730,0,3780,3731,0,3780,3732,0,3780,3733,0,
+		3780,3734,0,3780,3735,0,3780,3736,0,3780,3737,0,
+		3780,3738,0,3780,3739,0,3780,3740,0,3780,3741,0,
+		3780,3742,0,3780,3743,0,3780,3744,0,3780,3745,0,
+		3780,3746,0,3780,3747,0,3780,3749,0,3780,3751,0,
+		3780,3752,0,3780,3753,0,3780,3754,0,3780,3755,0,
+		3780,3756,0,3780,3757,0,3780,3758,0,3780,3804,0,
+		3780,3805,0,3780,3806,0,3780,3807,0,3789,3762,0,
+		3953,3954,0,3953,3956,0,3953,3968,0,4018,3953,3968,
+		4018,3968,0,4018,3969,0,4019,3953,3968,4019,3968,0,
+		4019,3969,0,4133,4142,0,6581,6528,0,6581,6529,0,
+		6581,6530,0,6581,6531,0,6581,6532,0,6581,6533,0,
+		6581,6534,0,6581,6535,0,6581,6536,0,6581,6537,0,
+		6581,6538,0,6581,6539,0,6581,6540,0,6581,6541,0,
+		6581,6542,0,6581,6543,0,6581,6544,0,6581,6545,0,
+		6581,6546,0,6581,6547,0,6581,6548,0,6581,6549,0,
+		6581,6550,0,6581,6551,0,6581,6552,0,6581,6553,0,
+		6581,6554,0,6581,6555,0,6581,6556,0,6581,6557,0,
+		6581,6558,0,6581,6559,0,6581,6560,0,6581,6561,0,
+		6581,6562,0,6581,6563,0,6581,6564,0,6581,6565,0,
+		6581,6566,0,6581,6567,0,6581,6568,0,6581,6569,0,
+		6581,6570,0,6581,6571,0,6582,6528,0,6582,6529,0,
+		6582,6530,0,6582,6531,0,6582,6532,0,6582,6533,0,
+		6582,6534,0,6582,6535,0,6582,6536,0,6582,6537,0,
+		6582,6538,0,6582,6539,0,6582,6540,0,6582,6541,0,
+		6582,6542,0,6582,6543,0,6582,6544,0,6582,6545,0,
+		6582,6546,0,6582,6547,0,6582,6548,0,6582,6549,0,
+		6582,6550,0,6582,6551,0,6582,6552,0,6582,6553,0,
+		6582,6554,0,6582,6555,0,6582,6556,0,6582,6557,0,
+		6582,6558,0,6582,6559,0,6582,6560,0,6582,6561,0,
+		6582,6562,0,6582,6563,0,6582,6564,0,6582,6565,0,
+		6582,6566,0,6582,6567,0,6582,6568,0,6582,6569,0,
+		6582,6570,0,6582,6571,0,6583,6528,0,6583,6529,0,
+		6583,6530,0,6583,6531,0,6583,6532,0,6583,6533,0,
+		6583,6534,0,6583,6535,0,6583,6536,0,6583,6537,0,
+		6583,6538,0,6583,6539,0,6583,6540,0,6583,6541,0,
+		6583,6542,0,6583,6543,0,6583,6544,0,6583,6545,0,
+		6583,6546,0,6583,6547,0,6583,6548,0,6583,6549,0,
+		6583,6550,0,6583,6551,0,6583,6552,0,6583,6553,0,
+		6583,6554,0,6583,6555,0,6583,6556,0,6583,6557,0,
+		6583,6558,0,6583,6559,0,6583,6560,0,6583,6561,0,
+		6583,6562,0,6583,6563,0,6583,6564,0,6583,6565,0,
+		6583,6566,0,6583,6567,0,6583,6568,0,6583,6569,0,
+		6583,6570,0,6583,6571,0,6586,6528,0,6586,6529,0,
+		6586,6530,0,6586,6531,0,6586,6532,0,6586,6533,0,
+		6586,6534,0,6586,6535,0,6586,6536,0,6586,6537,0,
+		6586,6538,0,6586,6539,0,6586,6540,0,6586,6541,0,
+		6586,6542,0,6586,6543,0,6586,6544,0,6586,6545,0,
+		6586,6546,0,6586,6547,0,6586,6548,0,6586,6549,0,
+		6586,6550,0,6586,6551,0,6586,6552,0,6586,6553,0,
+		6586,6554,0,6586,6555,0,6586,6556,0,6586,6557,0,
+		6586,6558,0,6586,6559,0,6586,6560,0,6586,6561,0,
+		6586,6562,0,6586,6563,0,6586,6564,0,6586,6565,0,
+		6586,6566,0,6586,6567,0,6586,6568,0,6586,6569,0,
+		6586,6570,0,6586,6571,0,6917,6965,0,6919,6965,0,
+		6921,6965,0,6923,6965,0,6925,6965,0,6929,6965,0,
+		6970,6965,0,6972,6965,0,6974,6965,0,6975,6965,0,
+		6978,6965,0,43701,43648,0,43701,43649,0,43701,43650,0,
+		43701,43651,0,43701,43652,0,43701,43653,0,43701,43654,0,
+		43701,43655,0,43701,43656,0,43701,43657,0,43701,43658,0,
+		43701,43659,0,43701,43660,0,43701,43661,0,43701,43662,0,
+		43701,43663,0,43701,43664,0,43701,43665,0,43701,43666,0,
+		43701,43667,0,43701,43668,0,43701,43669,0,43701,43670,0,
+		43701,43671,0,43701,43672,0,43701,43673,0,43701,43674,0,
+		43701,43675,0,43701,43676,0,43701,43677,0,43701,43678,0,
+		43701,43679,0,43701,43680,0,43701,43681,0,43701,43682,0,
+		43701,43683,0,43701,43684,0,43701,43685,0,43701,43686,0,
+		43701,43687,0,43701,43688,0,43701,43689,0,43701,43690,0,
+		43701,43691,0,43701,43692,0,43701,43693,0,43701,43694,0,
+		43701,43695,0,43702,43648,0,43702,43649,0,43702,43650,0,
+		43702,43651,0,43702,43652,0,43702,43653,0,43702,43654,0,
+		43702,43655,0,43702,43656,0,43702,43657,0,43702,43658,0,
+		43702,43659,0,43702,43660,0,43702,43661,0,43702,43662,0,
+		43702,43663,0,43702,43664,0,43702,43665,0,43702,43666,0,
+		43702,43667,0,43702,43668,0,43702,43669,0,43702,43670,0,
+		43702,43671,0,43702,43672,0,43702,43673,0,43702,43674,0,
+		43702,43675,0,43702,43676,0,43702,43677,0,43702,43678,0,
+		43702,43679,0,43702,43680,0,43702,43681,0,43702,43682,0,
+		43702,43683,0,43702,43684,0,43702,43685,0,43702,43686,0,
+		43702,43687,0,43702,43688,0,43702,43689,0,43702,43690,0,
+		43702,43691,0,43702,43692,0,43702,43693,0,43702,43694,0,
+		43702,43695,0,43705,43648,0,43705,43649,0,43705,43650,0,
+		43705,43651,0,43705,43652,0,43705,43653,0,43705,43654,0,
+		43705,43655,0,43705,43656,0,43705,43657,0,43705,43658,0,
+		43705,43659,0,43705,43660,0,43705,43661,0,43705,43662,0,
+		43705,43663,0,43705,43664,0,43705,43665,0,43705,43666,0,
+		43705,43667,0,43705,43668,0,43705,43669,0,43705,43670,0,
+		43705,43671,0,43705,43672,0,43705,43673,0,43705,43674,0,
+		43705,43675,0,43705,43676,0,43705,43677,0,43705,43678,0,
+		43705,43679,0,43705,43680,0,43705,43681,0,43705,43682,0,
+		43705,43683,0,43705,43684,0,43705,43685,0,43705,43686,0,
+		43705,43687,0,43705,43688,0,43705,43689,0,43705,43690,0,
+		43705,43691,0,43705,43692,0,43705,43693,0,43705,43694,0,
+		43705,43695,0,43707,43648,0,43707,43649,0,43707,43650,0,
+		43707,43651,0,43707,43652,0,43707,43653,0,43707,43654,0,
+		43707,43655,0,43707,43656,0,43707,43657,0,43707,43658,0,
+		43707,43659,0,43707,43660,0,43707,43661,0,43707,43662,0,
+		43707,43663,0,43707,43664,0,43707,43665,0,43707,43666,0,
+		43707,43667,0,43707,43668,0,43707,43669,0,43707,43670,0,
+		43707,43671,0,43707,43672,0,43707,43673,0,43707,43674,0,
+		43707,43675,0,43707,43676,0,43707,43677,0,43707,43678,0,
+		43707,43679,0,43707,43680,0,43707,43681,0,43707,43682,0,
+		43707,43683,0,43707,43684,0,43707,43685,0,43707,43686,0,
+		43707,43687,0,43707,43688,0,43707,43689,0,43707,43690,0,
+		43707,43691,0,43707,43692,0,43707,43693,0,43707,43694,0,
+		43707,43695,0,43708,43648,0,43708,43649,0,43708,43650,0,
+		43708,43651,0,43708,43652,0,43708,43653,0,43708,43654,0,
+		43708,43655,0,43708,43656,0,43708,43657,0,43708,43658,0,
+		43708,43659,0,43708,43660,0,43708,43661,0,43708,43662,0,
+		43708,43663,0,43708,43664,0,43708,43665,0,43708,43666,0,
+		43708,43667,0,43708,43668,0,43708,43669,0,43708,43670,0,
+		43708,43671,0,43708,43672,0,43708,43673,0,43708,43674,0,
+		43708,43675,0,43708,43676,0,43708,43677,0,43708,43678,0,
+		43708,43679,0,43708,43680,0,43708,43681,0,43708,43682,0,
+		43708,43683,0,43708,43684,0,43708,43685,0,43708,43686,0,
+		43708,43687,0,43708,43688,0,43708,43689,0,43708,43690,0,
+		43708,43691,0,43708,43692,0,43708,43693,0,43708,43694,0,
+		43708,43695,0,69937,69927,0,69938,69927,0,70471,70462,0,
+		70471,70487,0,70841,70832,0,70841,70842,0,70841,70845,0,
+		71096,71087,0,71097,71087,0,71989,71984,0
+	};
+
+	template<class T> const boost::uint16_t collation_data<T>::contraction_offset[939] = {
+		12294,12294,12291,12291,16895,16894,18310,18315,18331,18326,18339,22212,22213,22430,22429,22431,
+		22448,22483,22485,22484,22556,22622,44521,22635,22631,22632,22635,22747,22749,22748,22826,44522,
+		22830,22831,22830,44523,44525,44527,44529,44531,44533,44535,44537,44539,44541,44543,44545,44547,
+		44549,44551,44553,44555,44557,44559,44561,44563,44565,44567,44569,44571,44573,44575,44577,44579,
+		44581,44583,44585,44587,44589,44591,44593,44595,44597,44599,44601,44603,44605,44607,44609,44611,
+		44613,44615,44617,44619,44621,44623,44625,44627,44629,44631,44633,44635,44637,44639,44641,44643,
+		44645,44647,44649,44651,44653,44655,44657,44659,44661,44663,44665,44667,44669,44671,44673,44675,
+		44677,44679,44681,44683,44685,44687,44689,44691,44693,44695,44697,44699,44701,44703,44705,44707,
+		44709,44711,44713,44715,44717,44719,44721,44723,44725,44727,44729,44731,44733,44735,44737,44739,
+		44741,44743,44745,44747,44749,44751,44753,44755,44757,44759,44761,44763,44765,44767,44769,44771,
+		44773,44775,44777,44779,44781,44783,44785,44787,44789,44791,44793,44795,44797,44799,44801,44803,
+		44805,44807,44809,44811,44813,44815,44817,44819,44821,44823,44825,44827,44829,44831,44833,44835,
+		44837,44839,44841,44843,44845,44847,44849,44851,44853,44855,44857,44859,44861,44863,44865,44867,
+		44869,44871,44873,44875,44877,44879,44881,44883,44885,44887,44889,44891,44893,44895,44897,44899,
+		44901,44903,44905,44907,44909,44911,44913,44915,44917,44919,44921,44923,44925,44927,44929,44931,
+		44933,44935,44937,44939,44941,44943,44945,44947,44949,44951,44953,44955,44957,44959,44961,44963,
+		44965,44967,44969,44971,44973,44975,44977,44979,44981,24345,44983,44985,44987,44989,44991,44993,
+		44995,44997,44999,45001,45003,45005,45007,45009,45011,45013,45015,45017,45019,45021,45023,45025,
+		45027,45029,45031,45033,45035,45037,45039,45041,45043,45045,45047,45049,45051,45053,45055,45057,
+		45059,45061,45063,45065,45070,45075,45077,45079,45081,45083,45085,45087,45089,45091,45093,45095,
+		45097,45099,45101,45103,45105,45107,45109,45111,45113,45115,45117,45119,45121,45123,45125,45127,
+		45129,45131,45133,45135,45137,45139,45141,45143,45145,45147,45149,45151,45153,45155,45157,45159,
+		45161,45166,45171,45173,45175,45177,45179,45181,45183,45185,45187,45189,45191,45193,45195,45197,
+		45199,45201,45203,45205,45207,45209,45211,45213,45215,45217,45219,45221,45223,45225,45227,45229,
+		45231,45233,45235,45237,45239,45241,45243,45245,45247,45249,45251,45253,45255,45257,45262,45267,
+		45269,45271,45273,45275,45277,45279,45281,45283,45285,45287,45289,45291,45293,45295,45297,45299,
+		45301,45303,45305,45307,45309,45311,45313,45315,45317,45319,45321,45323,45325,45327,45329,45331,
+		45333,45335,45337,45339,45341,45343,45345,45347,45349,45351,45353,45358,45363,45365,45367,45369,
+		45371,45373,45375,45377,45379,45381,45383,45385,45387,45389,45391,45393,45395,45397,45399,45401,
+		45403,45405,45407,45409,45411,45413,45415,45417,45419,45421,45423,45425,45427,45429,45431,45433,
+		45435,45437,45439,45441,45443,45445,45447,45449,45454,45459,45461,24419,24643,24647,24645,24649,
+		24648,24649,24651,24650,24651,25424,45463,45465,45467,45469,45471,45473,45475,45477,45479,45481,
+		45483,45485,45487,45489,45491,45493,45495,45497,45499,45501,45503,45505,45507,45509,45511,45513,
+		45515,45517,45519,45521,45523,45525,45527,45529,45531,45533,45535,45537,45539,45541,45543,45545,
+		45547,45549,45551,45553,45555,45557,45559,45561,45563,45565,45567,45569,45571,45573,45575,45577,
+		45579,45581,45583,45585,45587,45589,45591,45593,45595,45597,45599,45601,45603,45605,45607,45609,
+		45611,45613,45615,45617,45619,45621,45623,45625,45627,45629,45631,45633,45635,45637,45639,45641,
+		45643,45645,45647,45649,45651,45653,45655,45657,45659,45661,45663,45665,45667,45669,45671,45673,
+		45675,45677,45679,45681,45683,45685,45687,45689,45691,45693,45695,45697,45699,45701,45703,45705,
+		45707,45709,45711,45713,45715,45717,45719,45721,45723,45725,45727,45729,45731,45733,45735,45737,
+		45739,45741,45743,45745,45747,45749,45751,45753,45755,45757,45759,45761,45763,45765,45767,45769,
+		45771,45773,45775,45777,45779,45781,45783,45785,45787,45789,45791,45793,45795,45797,45799,45801,
+		45803,45805,45807,45809,45811,45813,25929,25932,25935,25938,25941,25946,25994,25997,26002,26003,
+		26006,45815,45817,45819,45821,45823,45825,45827,45829,45831,45833,45835,45837,45839,45841,45843,
+		45845,45847,45849,45851,45853,45855,45857,45859,45861,45863,45865,45867,45869,45871,45873,45875,
+		45877,45879,45881,45883,45885,45887,45889,45891,45893,45895,45897,45899,45901,45903,45905,45907,
+		45909,45911,45913,45915,45917,45919,45921,45923,45925,45927,45929,45931,45933,45935,45937,45939,
+		45941,45943,45945,45947,45949,45951,45953,45955,45957,45959,45961,45963,45965,45967,45969,45971,
+		45973,45975,45977,45979,45981,45983,45985,45987,45989,45991,45993,45995,45997,45999,46001,46003,
+		46005,46007,46009,46011,46013,46015,46017,46019,46021,46023,46025,46027,46029,46031,46033,46035,
+		46037,46039,46041,46043,46045,46047,46049,46051,46053,46055,46057,46059,46061,46063,46065,46067,
+		46069,46071,46073,46075,46077,46079,46081,46083,46085,46087,46089,46091,46093,46095,46097,46099,
+		46101,46103,46105,46107,46109,46111,46113,46115,46117,46119,46121,46123,46125,46127,46129,46131,
+		46133,46135,46137,46139,46141,46143,46145,46147,46149,46151,46153,46155,46157,46159,46161,46163,
+		46165,46167,46169,46171,46173,46175,46177,46179,46181,46183,46185,46187,46189,46191,46193,46195,
+		46197,46199,46201,46203,46205,46207,46209,46211,46213,46215,46217,46219,46221,46223,46225,46227,
+		46229,46231,46233,46235,46237,46239,46241,46243,46245,46247,46249,46251,46253,46255,46257,46259,
+		46261,46263,46265,46267,46269,46271,46273,46275,46277,46279,46281,46283,46285,46287,46289,46291,
+		46293,25569,25570,23379,23380,23522,23521,23524,23608,23609,23782
+	};
+
+	template<class T> const boost::uint32_t collation_data<T>::implicit_first[4] = {
+		94208,101632,110960,101120
+	};
+
+	template<class T> const boost::uint32_t collation_data<T>::implicit_last[4] = {
+		101119,101775,111359,101631
+	};
+
+	template<class T> const boost::uint16_t collation_data<T>::implicit_base[4] = {
+		64256,64256,64257,64258
+	};
+
+	template<class T> const boost::uint32_t collation_data<T>::ideograph_first[15] = {
+		13312,19968,64014,64017,64019,64031,64033,64035,64039,131072,173824,177984,178208,183984,196608
+	};
+
+	template<class T> const boost::uint32_t collation_data<T>::ideograph_last[15] = {
+		19903,40959,64015,64017,64020,64031,64033,64036,64041,173791,177976,178205,183969,191456,201546
+	};
+
+	template<class T> const boost::uint8_t collation_data<T>::ideograph_core[15] = {
+		0,1,1,1,1,1,1,1,1,0,0,0,0,0,0
+	};
+
+	// Offset of the character's collation elements in collation_pool, or 0 if it has implicit weights.
+	inline boost::uint16_t collation_offset(boost::uint32_t cp)
+	{
+		if(cp >= 0xE0400) // Everything from here on has the same value.
+			return 0;
+
+		return collation_data<>::collation_offset_stage3[(collation_data<>::collation_offset_stage2[(collation_data<>::collation_offset_stage1[cp >> 10] << 5) + ((cp >> 5) & 0x1F)] << 5) + (cp & 0x1F)];
+	}
+}
+
+#endif
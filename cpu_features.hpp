@@ -0,0 +1,171 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_CPU_FEATURES_HPP
+#define BOOST_UNICODE_CPU_FEATURES_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include "utf8_count.hpp"
+
+// BOOST_UNICODE_HAS_CPU_DISPATCH is defined where the compiler can build AVX2 and
+// AVX-512 code into functions of their own (marked BOOST_UNICODE_TARGET) without
+// the rest of the program needing those instructions, so one binary can pick them
+// at run time.
+#if defined(BOOST_UNICODE_HAS_SSE2) && (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#define BOOST_UNICODE_HAS_CPU_DISPATCH
+#define BOOST_UNICODE_TARGET(features) __attribute__((target(features)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(BOOST_UNICODE_HAS_SSE2) && defined(_MSC_VER) && _MSC_VER >= 1912
+#define BOOST_UNICODE_HAS_CPU_DISPATCH
+#define BOOST_UNICODE_TARGET(features)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace unicode
+{
+	//================================================================================
+	// Choosing between implementations of the bulk conversion kernels at run time.
+	// The best tier the CPU (and the compiler) supports is found once, with cpuid, the
+	// first time it's needed. Setting the environment variable BOOST_UNICODE_CPU to
+	// scalar, sse2, avx2 or avx512 caps it, so slower tiers can be tested on a fast
+	// machine. Tiers the machine doesn't have are never used.
+	//================================================================================
+
+	enum cpu_tier
+	{
+		cpu_tier_scalar, // Plain C++
+		cpu_tier_sse2, // 16 bytes at a time
+		cpu_tier_avx2, // 32 bytes at a time
+		cpu_tier_avx512 // 64 bytes at a time (AVX-512 F and BW)
+	};
+
+	inline const char* cpu_tier_name(int tier)
+	{
+		static const char* names[4] = { "scalar", "sse2", "avx2", "avx512" };
+		return tier >= cpu_tier_scalar && tier <= cpu_tier_avx512 ? names[tier] : "unknown";
+	}
+
+	// The tier called name, or -1.
+	inline int find_cpu_tier(const char* name)
+	{
+		for(int tier = cpu_tier_scalar; tier <= cpu_tier_avx512; ++tier)
+		{
+			if(std::strcmp(name, cpu_tier_name(tier)) == 0)
+				return tier;
+		}
+
+		return -1;
+	}
+
+#ifdef BOOST_UNICODE_HAS_CPU_DISPATCH
+	inline void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4])
+	{
+#ifdef _MSC_VER
+		int r[4];
+		__cpuidex(r, (int)leaf, (int)subleaf);
+
+		for(int i=0; i < 4; ++i)
+			regs[i] = (unsigned)r[i];
+#else
+		__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+	}
+
+	// Which register states the OS saves (XCR0).
+	inline boost::uint64_t xgetbv0()
+	{
+#ifdef _MSC_VER
+		return _xgetbv(0);
+#else
+		unsigned lo, hi;
+		__asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+		return (boost::uint64_t)hi << 32 | lo;
+#endif
+	}
+#endif
+
+	// The best tier this machine supports, ignoring BOOST_UNICODE_CPU.
+	inline int detect_cpu_tier()
+	{
+		int tier = cpu_tier_scalar;
+
+#ifdef BOOST_UNICODE_HAS_SSE2
+		tier = cpu_tier_sse2; // The rest of the library already needs it.
+#endif
+
+#ifdef BOOST_UNICODE_HAS_CPU_DISPATCH
+		unsigned regs[4];
+		cpuid(0, 0, regs);
+
+		if(regs[0] < 7)
+			return tier;
+
+		cpuid(1, 0, regs);
+
+		// AVX needs the OS to save the YMM registers (and AVX-512 the ZMM ones) too.
+		bool osxsave = (regs[2] & 1 << 27) != 0, avx = (regs[2] & 1 << 28) != 0;
+
+		if(!osxsave || !avx)
+			return tier;
+
+		boost::uint64_t xcr0 = xgetbv0();
+		cpuid(7, 0, regs);
+
+		if((xcr0 & 0x06) == 0x06 && (regs[1] & 1 << 5))
+			tier = cpu_tier_avx2;
+
+		if(tier == cpu_tier_avx2 && (xcr0 & 0xE6) == 0xE6 && (regs[1] & 1 << 16) && (regs[1] & 1u << 30))
+			tier = cpu_tier_avx512;
+#endif
+
+		return tier;
+	}
+
+	// The best tier this machine supports, capped by BOOST_UNICODE_CPU.
+	inline int find_available_cpu_tier()
+	{
+		int found = detect_cpu_tier();
+		const char* env = std::getenv("BOOST_UNICODE_CPU");
+		int cap = env ? find_cpu_tier(env) : -1;
+
+		return cap >= 0 && cap < found ? cap : found;
+	}
+
+	// The tier found the first time this is called. The static is initialized just
+	// once even if several threads get here at the same time (C++11 guarantees it, and
+	// GCC, Clang and Visual C++ 2015 and later do it in any mode).
+	inline int available_cpu_tier()
+	{
+		static const int tier = find_available_cpu_tier();
+		return tier;
+	}
+
+	// The tier in use. It's the available one unless set_cpu_tier() says otherwise.
+	inline int& current_cpu_tier()
+	{
+		static int tier = -1;
+		return tier;
+	}
+
+	inline int cpu_tier()
+	{
+		int tier = current_cpu_tier();
+		return tier >= 0 ? tier : available_cpu_tier();
+	}
+
+	// Use a slower tier (e.g. to compare them). Tiers above the available one are
+	// capped to it. Returns the tier now in use. This isn't synchronized, so it's not
+	// for use while other threads are converting.
+	inline int set_cpu_tier(int tier)
+	{
+		current_cpu_tier() = tier < available_cpu_tier() ? tier : available_cpu_tier();
+		return current_cpu_tier();
+	}
+}
+
+#endif
@@ -0,0 +1,218 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_DISPLAY_WIDTH_HPP
+#define BOOST_UNICODE_DISPLAY_WIDTH_HPP
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include "display_width_tables.hpp"
+#include "grapheme.hpp"
+#include "utf8_count.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// How many columns text takes in a terminal or other fixed width display, going by
+	// East_Asian_Width (see UAX #11, http://www.unicode.org/reports/tr11/). Widths are
+	// worked out per user-perceived character, so an accented letter, a flag or an
+	// emoji sequence joined by ZWJs is as wide as it looks rather than the sum of its
+	// parts. Characters whose East_Asian_Width is ambiguous (e.g. Greek and Cyrillic
+	// letters, box drawing) are narrow unless cjk is set, for text shown in an East
+	// Asian context. Control characters take no columns.
+	//================================================================================
+
+	// Columns a character takes on its own: 0, 1 or 2.
+	inline unsigned char_width(boost::uint32_t cp, bool cjk=false)
+	{
+		if(cp < 0x7F)
+			return cp >= 0x20;
+
+		unsigned w = display_width_property(cp);
+		return w == width_ambiguous ? 1 + cjk : w;
+	}
+
+	// The width of a cluster that has come to width with the characters before cp in it,
+	// once cp is added.
+	inline unsigned extend_cluster_width(unsigned width, boost::uint32_t cp, bool cjk=false)
+	{
+		if(width == 0)
+			return char_width(cp, cjk); // After a prepended character, or marks with nothing to go on.
+
+		if(width == 1 && (cp == 0xFE0F || (cp >= 0x1F1E6 && cp <= 0x1F1FF)))
+			return 2; // Emoji presentation selector, or the second regional indicator of a flag.
+
+		return width;
+	}
+
+	// Number of columns code points [first, last) take.
+	template<class iterator>
+	std::size_t display_width(iterator first, iterator last, bool cjk=false)
+	{
+		std::size_t ret = 0;
+		unsigned cluster = 0; // Width of the cluster so far.
+		grapheme_state state;
+
+		for(; first != last; ++first)
+		{
+			boost::uint32_t cp = *first;
+
+			if(grapheme_break_before(state, grapheme_break_property(cp)))
+			{
+				ret += cluster;
+				cluster = char_width(cp, cjk);
+			}
+			else
+				cluster = extend_cluster_width(cluster, cp, cjk);
+		}
+
+		return ret + cluster;
+	}
+
+	//--------------------------------------------------------------------------------
+	// The same for well-formed UTF-8 in memory. Printable ASCII is counted 16 bytes at a
+	// time without being decoded.
+	//--------------------------------------------------------------------------------
+
+	// How many bytes from p (up to 15) are printable ASCII followed by more printable ASCII?
+	// Each of those is a cluster of its own, one column wide.
+	inline std::size_t printable_ascii_run(const boost::uint8_t* p, const boost::uint8_t* last)
+	{
+#ifdef BOOST_UNICODE_HAS_SSE2
+		if(last - p >= 16)
+		{
+			// 0x20-0x7E are the bytes that are greater than 0x1F and less than 0x7F as signed bytes.
+			__m128i x = _mm_loadu_si128((const __m128i*)p);
+			__m128i printable = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8(0x1F)), _mm_cmplt_epi8(x, _mm_set1_epi8(0x7F)));
+
+			if(_mm_movemask_epi8(printable) == 0xFFFF)
+				return 15; // The last one could have a combining mark after it.
+		}
+#endif
+
+		return 0;
+	}
+
+	// Width of the cluster that starts at p, moving p to the end of it.
+	inline unsigned next_cluster_width(const boost::uint8_t*& p, const boost::uint8_t* last, bool cjk=false)
+	{
+		// ASCII followed by ASCII (or the end) is a cluster of its own, except for CR LF.
+		if(*p < 0x80 && (p + 1 == last || p[1] < 0x80))
+		{
+			boost::uint8_t b = *p++;
+
+			if(b == '\r' && p != last && *p == '\n')
+				++p;
+
+			return b >= 0x20 && b < 0x7F;
+		}
+
+		grapheme_state state;
+		boost::uint32_t cp = utf8_next(p);
+		grapheme_break_before(state, grapheme_break_property(cp));
+		unsigned ret = char_width(cp, cjk);
+
+		while(p != last)
+		{
+			const boost::uint8_t* q = p;
+			cp = utf8_next(q);
+
+			if(grapheme_break_before(state, grapheme_break_property(cp)))
+				break;
+
+			ret = extend_cluster_width(ret, cp, cjk);
+			p = q;
+		}
+
+		return ret;
+	}
+
+	// Number of columns [first, last) takes.
+	inline std::size_t display_width_utf8(const boost::uint8_t* first, const boost::uint8_t* last, bool cjk=false)
+	{
+		std::size_t ret = 0;
+
+		while(first != last)
+		{
+			std::size_t n = printable_ascii_run(first, last);
+
+			if(n)
+			{
+				ret += n;
+				first += n;
+			}
+			else
+				ret += next_cluster_width(first, last, cjk);
+		}
+
+		return ret;
+	}
+
+	// The end of the longest run of whole clusters from first that fits in columns, e.g.
+	// to cut text off at the edge of a terminal. Nothing after that is looked at. width
+	// is set to the number of columns the run takes.
+	inline const boost::uint8_t* truncate_to_width_utf8(const boost::uint8_t* first, const boost::uint8_t* last,
+		std::size_t columns, std::size_t& width, bool cjk=false)
+	{
+		width = 0;
+
+		while(first != last)
+		{
+			std::size_t n = printable_ascii_run(first, last);
+
+			if(n && columns - width >= n)
+			{
+				width += n;
+				first += n;
+				continue;
+			}
+
+			const boost::uint8_t* p = first;
+			unsigned w = next_cluster_width(p, last, cjk);
+
+			if(w > columns - width)
+				break;
+
+			width += w;
+			first = p;
+		}
+
+		return first;
+	}
+
+	inline const boost::uint8_t* truncate_to_width_utf8(const boost::uint8_t* first, const boost::uint8_t* last,
+		std::size_t columns, bool cjk=false)
+	{
+		std::size_t width;
+		return truncate_to_width_utf8(first, last, columns, width, cjk);
+	}
+
+	// Number of columns s takes (a basic_ustring converts to a view, so this works for both).
+	inline std::size_t display_width(const ustring_view& s, bool cjk=false)
+	{
+		return display_width_utf8(s.data(), s.data() + s.bytes(), cjk);
+	}
+
+	// A view of as many whole user-perceived characters from the start of s as fit in
+	// columns. Only the part that fits is looked at.
+	inline ustring_view truncate_to_width(const ustring_view& s, std::size_t columns, bool cjk=false)
+	{
+		return ustring_view(s.data(), truncate_to_width_utf8(s.data(), s.data() + s.bytes(), columns, cjk) - s.data());
+	}
+
+	// A copy of as many whole user-perceived characters from the start of s as fit in columns.
+	template<class tpl_enc, class tpl_dec>
+	basic_ustring<tpl_enc, tpl_dec> truncate_to_width(const basic_ustring<tpl_enc, tpl_dec>& s, std::size_t columns, bool cjk=false)
+	{
+		ustring_view v = truncate_to_width(ustring_view(s), columns, cjk);
+
+		basic_ustring<tpl_enc, tpl_dec> ret;
+		ret.append_utf8(v.data(), v.bytes(), v.size());
+		return ret;
+	}
+}
+
+#endif
@@ -0,0 +1,619 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tables for display widths (see display_width.hpp).
+// Generated by tools/ucdgen.py from the Unicode Character Database 14.0.0. Don't edit.
+// Tables: 11376 bytes.
+
+#ifndef BOOST_UNICODE_DISPLAY_WIDTH_TABLES_HPP
+#define BOOST_UNICODE_DISPLAY_WIDTH_TABLES_HPP
+
+#include <boost/cstdint.hpp>
+
+namespace unicode
+{
+	enum display_width_class
+	{
+		width_zero, // Combining marks, format and control characters, line and paragraph separators, and conjoining jamo after the first
+		width_narrow, // Everything else
+		width_wide, // East Asian Width W or F
+		width_ambiguous // East Asian Width A: narrow, or wide in East Asian text
+	};
+
+	// The tables are static members of a class template so that they're only
+	// stored once however many translation units include this.
+	template<class T=void>
+	struct display_width_data
+	{
+		static const boost::uint8_t display_width_property_stage1[2176];
+		static const boost::uint16_t display_width_property_stage2[2336];
+		static const boost::uint8_t display_width_property_stage3[4528];
+	};
+
+	template<class T> const boost::uint8_t display_width_data<T>::display_width_property_stage1[2176] = {
+		0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,10,
+		15,16,17,18,10,19,20,21,22,23,24,24,24,24,24,24,
+		24,24,24,24,24,24,25,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,26,27,28,29,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,30,10,10,10,10,
+		31,31,31,31,31,31,31,31,31,31,31,31,32,33,10,34,
+		35,36,10,10,10,37,38,39,40,41,42,43,44,45,46,47,
+		10,10,10,10,10,10,10,10,10,10,48,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,49,10,50,24,24,24,24,24,24,24,24,
+		24,24,24,51,24,24,52,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,53,54,55,10,10,10,10,56,10,
+		10,10,10,10,10,10,10,57,58,59,10,10,10,60,10,10,
+		61,62,10,10,63,10,10,10,64,65,66,67,68,69,10,10,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,70,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,70,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		71,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,72,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,72
+	};
+
+	template<class T> const boost::uint16_t display_width_data<T>::display_width_property_stage2[2336] = {
+		0,0,1,1,1,1,1,2,0,0,3,4,5,6,7,8,
+		9,10,11,12,13,14,11,1,1,1,1,1,15,16,1,1,
+		1,1,1,1,1,9,9,1,1,1,1,1,17,18,1,1,
+		0,0,0,0,0,0,0,1,1,19,20,19,20,1,1,1,
+		9,21,21,21,21,9,1,1,22,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,23,0,24,25,1,1,1,
+		26,27,1,1,28,0,1,29,1,1,1,1,1,30,31,1,
+		2,32,1,0,33,1,1,1,1,1,34,29,1,1,28,35,
+		1,36,37,1,1,38,1,1,1,39,1,1,40,0,0,0,
+		41,1,1,42,43,44,45,1,32,1,1,46,47,1,45,48,
+		49,1,1,46,50,32,1,51,49,1,1,46,52,1,45,40,
+		32,1,1,53,47,54,45,1,55,1,1,1,56,1,1,1,
+		57,1,1,58,59,54,45,1,32,1,1,53,60,1,45,1,
+		61,1,1,62,47,1,45,1,32,1,1,1,63,64,1,1,
+		1,1,1,65,66,1,1,1,1,1,1,67,68,1,1,1,
+		1,69,1,70,1,1,1,71,72,73,0,74,75,1,1,1,
+		1,1,76,77,1,78,29,79,80,81,1,1,1,1,1,1,
+		82,82,82,82,82,82,0,0,0,0,0,0,0,0,0,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,76,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,83,1,45,1,45,1,45,1,1,1,84,85,35,1,1,
+		28,1,1,1,1,1,1,1,54,1,86,1,1,1,1,1,
+		1,1,87,88,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,89,1,1,1,90,91,92,1,1,1,0,93,1,1,1,
+		94,1,1,95,55,1,28,94,61,1,96,1,1,1,97,61,
+		1,1,98,99,1,1,1,1,1,1,1,1,1,100,101,102,
+		1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,
+		28,103,104,105,1,1,106,107,108,1,109,1,1,0,0,29,
+		110,111,112,1,1,113,114,115,116,115,1,117,1,118,119,1,
+		120,121,122,123,124,125,126,1,127,128,129,130,1,1,1,1,
+		1,131,132,1,1,1,1,1,1,1,1,1,1,1,133,134,
+		1,1,1,1,1,1,21,21,21,21,21,21,21,21,135,21,
+		21,21,21,21,114,21,21,136,21,137,20,138,139,140,141,142,
+		143,144,1,1,145,146,147,148,1,149,150,151,152,153,154,155,
+		156,1,157,158,159,160,1,161,1,162,1,163,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,164,1,1,1,165,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,61,
+		1,1,1,1,1,1,1,2,1,1,1,1,1,1,0,0,
+		1,1,1,1,1,1,1,1,82,166,82,82,82,82,82,146,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,167,1,168,
+		82,82,169,170,171,82,82,82,82,172,82,82,82,82,82,82,
+		173,82,82,171,82,82,82,82,170,82,82,82,82,82,146,82,
+		82,170,82,82,174,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,82,1,1,1,1,
+		82,82,82,82,82,82,82,82,175,82,82,82,176,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,2,177,1,178,1,1,1,1,1,61,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		179,1,180,1,1,1,1,1,1,1,1,1,181,1,0,182,
+		1,1,183,1,184,61,82,175,41,1,1,185,1,1,186,1,
+		1,1,187,188,189,1,1,46,1,1,1,190,32,1,191,75,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,192,1,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,146,0,0,0,0,0,
+		21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+		21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+		21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		1,48,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		0,193,0,82,82,194,195,1,1,1,1,1,1,1,1,2,
+		171,82,82,82,82,82,196,1,1,1,1,1,1,1,176,197,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,81,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,29,1,
+		1,1,1,1,1,1,1,198,1,1,1,1,1,1,1,1,
+		199,1,1,200,1,1,1,1,1,1,1,1,1,1,54,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,201,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,62,1,1,1,1,1,
+		1,1,1,1,34,29,1,1,202,1,1,1,1,1,1,1,
+		32,1,1,203,204,1,1,205,61,1,1,206,207,1,1,1,
+		41,1,208,209,1,1,1,210,61,1,1,211,212,1,1,1,
+		1,1,2,213,1,1,1,1,1,1,1,1,1,2,214,1,
+		61,1,1,62,29,1,215,209,1,1,1,1,1,1,1,1,
+		1,1,1,203,64,48,1,1,1,1,1,216,217,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,218,29,191,1,1,
+		1,1,1,219,29,1,1,1,1,1,220,221,1,1,1,1,
+		1,76,222,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,2,223,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,224,210,1,1,1,1,1,1,1,1,225,29,1,
+		226,1,1,227,228,229,1,1,40,230,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,231,1,1,1,1,1,232,233,234,1,1,1,1,
+		1,1,1,235,221,1,1,1,1,236,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,237,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,238,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,209,
+		1,1,1,204,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,2,1,1,1,2,41,1,1,1,1,239,240,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,241,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,167,1,1,
+		242,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,243,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,244,1,1,244,245,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,168,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,246,94,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		0,0,247,0,204,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,248,249,250,1,251,1,1,1,1,1,
+		1,1,1,1,83,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		0,0,0,252,0,0,74,186,253,28,23,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		254,255,256,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,204,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,48,1,1,1,98,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,204,1,1,
+		1,1,1,1,257,1,1,1,1,1,1,1,1,1,1,1,
+		258,1,1,1,1,1,1,1,1,1,1,1,148,1,1,1,
+		259,21,260,21,21,21,115,21,261,262,263,1,1,1,1,1,
+		244,82,82,168,242,240,167,1,1,1,1,1,1,1,1,1,
+		82,82,264,265,82,82,82,266,82,146,82,82,267,146,82,268,
+		82,82,82,170,269,82,82,82,82,82,82,82,82,82,82,270,
+		82,82,82,271,272,82,241,273,1,274,258,1,1,1,1,275,
+		82,82,82,82,82,1,1,1,82,82,82,82,276,277,164,278,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,168,196,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		279,82,82,280,265,82,82,82,82,82,82,82,82,82,82,82,
+		1,1,1,1,1,1,1,281,176,82,175,282,167,193,241,176,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,271,
+		32,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+		21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,260
+	};
+
+	template<class T> const boost::uint8_t display_width_data<T>::display_width_property_stage3[4528] = {
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+		1,3,1,1,3,1,1,3,3,1,3,1,1,3,3,1,
+		3,3,3,3,3,1,3,3,3,3,3,1,3,3,3,3,
+		1,1,1,1,1,1,3,1,1,1,1,1,1,1,1,1,
+		3,1,1,1,1,1,1,3,3,1,1,1,1,1,3,3,
+		3,3,1,1,1,1,3,1,3,3,3,1,3,3,1,1,
+		3,1,3,3,1,1,1,3,3,3,3,1,3,1,3,1,
+		1,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,3,1,3,1,1,1,1,1,1,1,3,1,1,1,1,
+		1,1,1,1,1,1,3,3,1,1,1,3,1,1,1,1,
+		1,3,3,3,1,1,1,1,3,1,1,1,1,1,1,3,
+		3,3,3,1,3,1,1,1,3,3,3,3,1,3,1,1,
+		1,1,3,3,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,1,
+		3,1,3,1,3,1,3,1,3,1,3,1,3,1,1,1,
+		1,1,1,1,3,1,1,3,1,3,3,3,1,3,1,1,
+		3,1,1,1,1,1,1,1,3,3,3,3,1,3,1,3,
+		1,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,1,3,3,3,3,3,3,3,1,1,1,1,1,1,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		1,1,1,0,0,0,0,0,0,0,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+		1,0,0,1,0,0,1,0,1,1,1,1,1,1,1,1,
+		0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+		0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+		0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,
+		0,0,0,0,0,1,1,0,0,1,0,0,0,0,1,1,
+		1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,
+		1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,1,1,1,1,1,1,1,1,1,0,1,1,
+		1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,
+		0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,1,
+		1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,
+		0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+		1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,
+		0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,0,1,0,1,1,1,
+		1,0,0,0,0,0,0,0,0,1,1,1,1,0,1,1,
+		1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+		1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,
+		1,0,0,0,0,1,1,1,1,1,1,1,1,0,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,
+		1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,1,1,1,1,0,0,1,1,0,0,0,1,1,
+		0,0,1,1,1,0,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,1,0,0,1,1,1,1,0,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,
+		1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,
+		1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,
+		0,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,0,1,0,0,
+		0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,1,
+		1,1,1,1,1,1,0,1,1,1,1,1,0,0,1,1,
+		0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,
+		1,1,0,0,0,1,0,1,1,1,1,1,1,1,1,1,
+		1,0,1,1,0,0,0,0,0,0,0,1,1,1,1,1,
+		1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,
+		1,0,1,1,0,0,0,0,0,0,0,0,0,1,1,1,
+		1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,
+		1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,
+		1,1,1,1,1,0,1,0,1,0,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,
+		0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+		1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,
+		0,1,0,0,0,0,0,0,1,0,0,1,1,0,0,1,
+		1,1,1,1,1,1,1,1,0,0,1,1,1,1,0,0,
+		1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,0,1,1,0,0,1,1,1,1,1,1,0,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,
+		1,1,1,1,1,1,0,1,1,0,0,0,0,0,0,0,
+		1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,
+		0,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,
+		1,1,0,1,1,1,1,1,1,0,0,0,1,1,1,1,
+		1,1,1,1,1,1,1,0,0,1,1,0,1,1,1,1,
+		1,1,1,1,1,1,0,1,0,0,0,0,0,0,0,1,
+		0,1,0,1,1,0,0,0,0,0,0,0,0,1,1,1,
+		1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,0,1,0,0,0,0,0,1,0,1,1,1,
+		1,1,0,0,0,0,1,1,0,0,1,0,0,0,1,1,
+		1,1,1,1,1,1,0,1,0,0,1,1,1,0,1,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,
+		0,0,0,0,1,1,0,0,1,1,1,1,1,1,1,1,
+		0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,1,0,0,0,0,0,0,0,1,1,1,1,0,1,1,
+		1,1,1,1,0,1,1,1,0,0,1,1,1,1,1,1,
+		3,1,1,3,3,3,3,1,3,3,1,1,3,3,1,1,
+		3,3,3,1,3,3,3,3,0,0,0,0,0,0,0,1,
+		3,1,3,3,1,3,1,1,1,1,1,3,1,1,3,1,
+		0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+		1,1,1,1,3,1,1,1,1,1,1,1,1,1,1,3,
+		1,3,3,3,3,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,3,1,1,1,
+		1,1,1,3,1,3,1,1,1,3,1,1,1,1,1,1,
+		1,1,1,3,1,1,3,1,1,1,1,1,1,1,1,1,
+		1,3,3,1,1,1,3,1,1,1,1,3,1,1,1,1,
+		1,1,1,3,3,1,1,1,1,1,1,3,3,3,3,1,
+		3,3,3,3,3,3,3,3,3,3,3,3,1,1,1,1,
+		3,3,3,3,3,3,3,3,3,3,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,3,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,3,3,1,1,1,1,1,1,
+		1,1,3,1,3,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,3,1,1,1,1,1,1,1,1,
+		3,1,3,3,1,1,1,3,3,1,1,3,1,1,1,3,
+		1,3,1,1,1,3,1,1,1,1,3,1,1,3,3,3,
+		3,1,1,3,1,3,1,3,3,3,3,3,3,1,3,1,
+		1,1,1,1,3,3,3,3,1,1,1,1,3,3,1,1,
+		1,1,1,1,1,1,1,1,3,1,1,1,3,1,1,1,
+		1,1,3,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		3,3,1,1,3,3,3,3,1,1,3,3,1,1,3,3,
+		1,1,3,3,1,1,3,3,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,3,1,1,1,3,1,1,1,1,1,1,
+		1,1,1,1,1,3,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,
+		1,1,3,1,1,1,1,1,1,1,2,2,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,
+		2,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,
+		3,3,3,3,3,3,3,3,3,3,1,3,3,3,3,3,
+		3,3,3,3,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,3,3,3,3,1,1,1,1,1,1,1,1,1,1,
+		1,1,3,3,1,1,3,3,1,1,1,1,3,3,1,1,
+		3,3,1,1,1,1,3,3,3,1,1,3,1,1,3,3,
+		3,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,3,3,3,3,1,1,1,1,1,1,1,1,1,3,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,
+		1,1,1,1,1,3,3,1,1,3,1,1,1,1,3,3,
+		1,1,1,1,2,2,1,1,1,1,1,1,3,1,3,1,
+		3,1,3,1,1,1,1,1,2,2,2,2,2,2,2,2,
+		2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
+		3,3,1,3,3,3,1,3,3,3,3,1,3,3,1,3,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+		1,1,1,2,1,1,1,1,1,1,1,1,1,1,3,3,
+		1,2,1,1,1,1,1,1,1,1,2,2,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,3,
+		1,1,1,1,2,2,3,3,3,3,3,3,3,3,2,3,
+		3,3,3,3,2,3,3,3,3,3,3,3,3,3,3,3,
+		3,3,1,3,1,1,1,1,3,3,2,3,3,3,3,3,
+		3,3,2,2,3,2,3,3,3,3,2,3,3,2,3,3,
+		1,1,1,1,1,2,1,1,1,1,2,2,1,1,1,1,
+		1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,3,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,2,1,2,1,
+		1,1,1,2,2,2,1,2,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,3,3,3,3,3,3,3,3,3,3,
+		1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,
+		2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+		1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,
+		2,1,1,1,1,2,3,3,3,3,1,1,1,1,1,1,
+		2,2,2,2,2,2,2,2,2,2,1,2,2,2,2,2,
+		2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+		2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,
+		2,2,2,2,2,2,2,2,2,2,0,0,0,0,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+		1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,1,1,0,0,2,2,2,2,2,
+		1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,
+		2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,
+		0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+		1,1,0,1,1,1,0,1,1,1,1,0,1,1,1,1,
+		1,1,1,1,1,0,0,1,1,1,1,1,0,1,1,1,
+		1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,
+		0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+		1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,
+		1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+		1,1,1,0,1,1,0,0,0,0,1,1,0,0,1,1,
+		1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,
+		1,0,0,1,1,0,0,1,1,1,1,1,1,1,1,1,
+		1,1,1,0,1,1,1,1,1,1,1,1,0,1,1,1,
+		0,1,0,0,0,1,1,0,0,1,1,1,1,1,0,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,
+		1,1,1,1,1,0,1,1,0,1,1,1,1,0,1,1,
+		2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,
+		2,2,2,1,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,1,2,2,2,2,1,1,1,1,
+		2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,0,0,0,1,3,1,1,
+		1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,
+		1,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,
+		1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,0,
+		1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,
+		1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+		0,1,1,0,0,1,1,1,1,1,1,1,1,1,1,0,
+		1,1,1,0,0,0,0,1,1,0,0,1,1,0,1,1,
+		1,1,0,1,1,1,1,1,1,1,1,1,1,0,1,1,
+		1,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,
+		0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,0,
+		0,0,1,1,0,1,0,0,1,1,1,1,1,1,0,1,
+		1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,1,
+		1,1,1,1,1,1,0,0,0,0,0,0,0,1,1,1,
+		1,1,1,0,0,0,0,0,0,1,0,1,1,1,1,0,
+		0,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,0,0,0,0,1,1,1,1,1,1,0,0,1,0,
+		1,1,1,0,0,0,0,0,0,0,0,1,1,0,1,0,
+		1,1,1,1,1,1,1,1,1,1,1,0,1,0,1,1,
+		0,0,0,0,0,0,1,0,1,1,1,1,1,1,1,1,
+		1,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,
+		0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,1,
+		1,1,1,1,0,0,0,0,1,1,0,0,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,
+		1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,1,
+		1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,
+		0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,
+		0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,
+		1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,
+		0,1,0,0,1,0,0,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,1,1,1,0,1,0,0,1,0,
+		0,0,1,1,1,0,1,0,1,1,1,1,1,1,1,1,
+		1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,
+		0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,
+		2,2,2,2,0,1,1,1,1,1,1,1,1,1,1,1,
+		2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
+		2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,
+		2,2,2,2,1,2,2,2,2,2,2,2,1,2,2,1,
+		2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
+		1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,1,
+		1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,1,1,0,0,0,0,0,0,0,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,
+		0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,
+		1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,
+		0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,
+		0,0,1,0,0,1,0,0,0,0,0,1,1,1,1,1,
+		1,1,1,1,0,0,0,0,0,0,0,1,1,1,1,1,
+		1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,
+		3,3,3,3,3,3,3,3,3,3,3,1,1,1,1,1,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,1,1,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,2,3,
+		3,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,1,1,1,
+		2,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,
+		2,2,2,2,2,2,1,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,1,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,2,
+		2,1,1,1,2,1,1,1,2,2,2,2,2,2,2,2,
+		2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,
+		1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,
+		1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,
+		2,2,2,2,2,2,1,1,1,1,1,1,2,1,1,1,
+		2,2,2,1,1,2,2,2,1,1,1,1,1,2,2,2,
+		1,1,1,1,2,2,2,2,2,2,2,2,2,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,1,2,2,2,2,
+		2,2,2,2,2,1,1,1,2,2,2,2,2,1,1,1,
+		2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1
+	};
+
+	// display_width_class of a character.
+	inline boost::uint8_t display_width_property(boost::uint32_t cp)
+	{
+		if(cp >= 0x110000) // Everything from here on has the same value.
+			return 1;
+
+		return display_width_data<>::display_width_property_stage3[(display_width_data<>::display_width_property_stage2[(display_width_data<>::display_width_property_stage1[cp >> 9] << 5) + ((cp >> 4) & 0x1F)] << 4) + (cp & 0xF)];
+	}
+}
+
+#endif
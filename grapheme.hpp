@@ -0,0 +1,388 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_GRAPHEME_HPP
+#define BOOST_UNICODE_GRAPHEME_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "grapheme_break_tables.hpp"
+#include "utf8_count.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Extended grapheme clusters: what a user thinks of as one character, e.g. "e"
+	// followed by a combining accent, a Hangul syllable made of jamo, or a flag made of
+	// two regional indicators (see UAX #29, http://www.unicode.org/reports/tr29/).
+	// Two ASCII characters in a row are always in different clusters (except CR LF),
+	// so ASCII doesn't have to be looked up at all.
+	//================================================================================
+
+	// What has to be remembered about the characters before the next one.
+	struct grapheme_state
+	{
+		int prev; // grapheme_break of the last character, or -1 at the start.
+		int regional_indicators; // Number of regional indicators in a row up to the last character.
+		int emoji; // 1 after an extended pictographic and Extends, 2 once a ZWJ follows those.
+
+		grapheme_state() : prev(-1), regional_indicators(0), emoji(0)
+		{
+		}
+	};
+
+	// Is there a cluster boundary between the characters so far and one with grapheme_break
+	// next? Updates state to include the character.
+	inline bool grapheme_break_before(grapheme_state& state, int next)
+	{
+		int prev = state.prev;
+		bool ret;
+
+		if(prev < 0)
+			ret = true; // GB1
+		else if(prev == gb_cr && next == gb_lf)
+			ret = false; // GB3
+		else if(prev == gb_cr || prev == gb_lf || prev == gb_control || next == gb_cr || next == gb_lf || next == gb_control)
+			ret = true; // GB4, GB5
+		else if(prev == gb_l && (next == gb_l || next == gb_v || next == gb_lv || next == gb_lvt))
+			ret = false; // GB6
+		else if((prev == gb_lv || prev == gb_v) && (next == gb_v || next == gb_t))
+			ret = false; // GB7
+		else if((prev == gb_lvt || prev == gb_t) && next == gb_t)
+			ret = false; // GB8
+		else if(next == gb_extend || next == gb_zwj || next == gb_spacing_mark || prev == gb_prepend)
+			ret = false; // GB9, GB9a, GB9b
+		else if(next == gb_extended_pictographic && state.emoji == 2)
+			ret = false; // GB11
+		else if(next == gb_regional_indicator && state.regional_indicators % 2)
+			ret = false; // GB12, GB13
+		else
+			ret = true; // GB999
+
+		if(next == gb_extended_pictographic)
+			state.emoji = 1;
+		else if(state.emoji == 1 && next == gb_zwj)
+			state.emoji = 2;
+		else if(state.emoji != 1 || next != gb_extend)
+			state.emoji = 0;
+
+		state.regional_indicators = next == gb_regional_indicator ? state.regional_indicators + 1 : 0;
+		state.prev = next;
+		return ret;
+	}
+
+	// The end of the cluster that starts at p, in well-formed UTF-8.
+	inline const boost::uint8_t* next_grapheme(const boost::uint8_t* p, const boost::uint8_t* last)
+	{
+		if(p == last)
+			return last;
+
+		// ASCII followed by ASCII (or the end) is a cluster of its own, except for CR LF.
+		if(*p < 0x80 && (p + 1 == last || p[1] < 0x80))
+			return p + 1 + (p[0] == '\r' && p + 1 != last && p[1] == '\n');
+
+		grapheme_state state;
+		grapheme_break_before(state, grapheme_break_property(utf8_next(p)));
+
+		while(p != last)
+		{
+			const boost::uint8_t* q = p;
+
+			if(grapheme_break_before(state, grapheme_break_property(utf8_next(q))))
+				break;
+
+			p = q;
+		}
+
+		return p;
+	}
+
+	// Start of the character before p.
+	inline const boost::uint8_t* utf8_prior(const boost::uint8_t* p)
+	{
+		do
+		{
+			--p;
+		}
+		while((*p & 0xC0) == 0x80);
+
+		return p;
+	}
+
+	// Is there a cluster boundary before p, which is the start of a character in the
+	// text starting at first? Looks no further back than it has to.
+	inline bool is_grapheme_boundary(const boost::uint8_t* first, const boost::uint8_t* p)
+	{
+		if(p == first)
+			return true;
+
+		const boost::uint8_t* q = utf8_prior(p);
+
+		if(*q < 0x80 && *p < 0x80)
+			return !(*q == '\r' && *p == '\n');
+
+		const boost::uint8_t* tmp = p;
+		int next = grapheme_break_property(utf8_next(tmp));
+		tmp = q;
+		int prev = grapheme_break_property(utf8_next(tmp));
+
+		// Only GB11 and GB12/13 depend on more than the two characters either side.
+		grapheme_state state;
+
+		if(prev == gb_zwj && next == gb_extended_pictographic)
+		{
+			// Look for an extended pictographic before Extends before the ZWJ.
+			while(q != first)
+			{
+				q = utf8_prior(q);
+				tmp = q;
+				int c = grapheme_break_property(utf8_next(tmp));
+
+				if(c == gb_extended_pictographic)
+					state.emoji = 2;
+
+				if(c != gb_extend)
+					break;
+			}
+		}
+		else if(prev == gb_regional_indicator && next == gb_regional_indicator)
+		{
+			// Count the regional indicators in a row before p.
+			state.regional_indicators = 1;
+
+			while(q != first)
+			{
+				q = utf8_prior(q);
+				tmp = q;
+
+				if(grapheme_break_property(utf8_next(tmp)) != gb_regional_indicator)
+					break;
+
+				++state.regional_indicators;
+			}
+		}
+
+		state.prev = prev;
+		return grapheme_break_before(state, next);
+	}
+
+	// The start of the cluster that ends at p.
+	inline const boost::uint8_t* prior_grapheme(const boost::uint8_t* first, const boost::uint8_t* p)
+	{
+		if(p == first)
+			return first;
+
+		p = utf8_prior(p);
+
+		while(!is_grapheme_boundary(first, p))
+			p = utf8_prior(p);
+
+		return p;
+	}
+
+	// Number of clusters in [first, last).
+	inline std::size_t grapheme_count(const boost::uint8_t* first, const boost::uint8_t* last)
+	{
+		std::size_t ret = 0;
+
+		for(; first != last; ++ret)
+			first = next_grapheme(first, last);
+
+		return ret;
+	}
+
+	// Skip up to qty clusters from first. qty is reduced by the number of clusters skipped.
+	inline const boost::uint8_t* advance_graphemes(const boost::uint8_t* first, const boost::uint8_t* last, std::size_t& qty)
+	{
+		for(; qty && first != last; --qty)
+			first = next_grapheme(first, last);
+
+		return first;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Iterating over the clusters of UTF-8 in memory (a basic_ustring or ustring_view).
+	//--------------------------------------------------------------------------------
+
+	class grapheme_iterator
+	{
+	public:
+		grapheme_iterator() : first(0), last(0), ptr(0), next(0)
+		{
+		}
+
+		// An iterator at p (which has to be a cluster boundary) in the text [_first, _last).
+		grapheme_iterator(const boost::uint8_t* _first, const boost::uint8_t* _last, const boost::uint8_t* p)
+			: first(_first), last(_last), ptr(p), next(0)
+		{
+		}
+
+		bool operator==(const grapheme_iterator& op) const
+		{
+			return ptr == op.ptr;
+		}
+
+		bool operator!=(const grapheme_iterator& op) const
+		{
+			return ptr != op.ptr;
+		}
+
+		grapheme_iterator& operator++()
+		{
+			ptr = end_of_cluster();
+			next = 0;
+			return *this;
+		}
+
+		grapheme_iterator operator++(int)
+		{
+			grapheme_iterator tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		grapheme_iterator& operator--()
+		{
+			next = ptr;
+			ptr = prior_grapheme(first, ptr);
+			return *this;
+		}
+
+		grapheme_iterator operator--(int)
+		{
+			grapheme_iterator tmp = *this;
+			--*this;
+			return tmp;
+		}
+
+		// First byte of the cluster.
+		const boost::uint8_t* base() const
+		{
+			return ptr;
+		}
+
+		// One past the last byte of the cluster.
+		const boost::uint8_t* end_of_cluster() const
+		{
+			if(!next)
+				next = next_grapheme(ptr, last);
+
+			return next;
+		}
+
+		// Number of bytes in the cluster.
+		std::size_t bytes() const
+		{
+			return end_of_cluster() - ptr;
+		}
+
+	private:
+		const boost::uint8_t* first;
+		const boost::uint8_t* last;
+		const boost::uint8_t* ptr; // Start of the current cluster.
+		mutable const boost::uint8_t* next; // End of the current cluster, or 0 if it hasn't been found yet.
+	};
+
+	// Iterators over the clusters of s (a basic_ustring converts to a view, and the
+	// iterators point into its data).
+	inline grapheme_iterator grapheme_begin(const ustring_view& s)
+	{
+		return grapheme_iterator(s.data(), s.data() + s.bytes(), s.data());
+	}
+
+	inline grapheme_iterator grapheme_end(const ustring_view& s)
+	{
+		return grapheme_iterator(s.data(), s.data() + s.bytes(), s.data() + s.bytes());
+	}
+
+	// Number of user-perceived characters in s. Unlike size(), this has to look at the whole text.
+	inline int grapheme_count(const ustring_view& s)
+	{
+		return (int)grapheme_count(s.data(), s.data() + s.bytes());
+	}
+
+	// A view of qty clusters of s starting at the pos'th, e.g. to truncate text for
+	// display without cutting an accent off its letter. pos may be the number of
+	// clusters, and the view stops at the end if fewer than qty clusters follow pos.
+	inline ustring_view substr_graphemes(const ustring_view& s, int pos, int qty)
+	{
+		assert(pos >= 0 && qty >= 0);
+
+		const boost::uint8_t* last = s.data() + s.bytes();
+		std::size_t n = pos;
+		const boost::uint8_t* b = advance_graphemes(s.data(), last, n);
+		assert(n == 0); // Otherwise pos was past the end.
+		n = qty;
+		return ustring_view(b, advance_graphemes(b, last, n) - b);
+	}
+
+	// A view of the cluster at g.
+	inline ustring_view segment_view(const grapheme_iterator& g)
+	{
+		return ustring_view(g.base(), g.bytes());
+	}
+
+	//--------------------------------------------------------------------------------
+	// Reading clusters from a Unicode input stream (a uistream, or anything else with a
+	// get() that returns code points and EOF at the end).
+	//--------------------------------------------------------------------------------
+
+	template<class stream_type>
+	class grapheme_reader
+	{
+	public:
+		grapheme_reader(stream_type* _s) : s(_s), ahead(-2)
+		{
+		}
+
+		// Read the next cluster into cluster (replacing what was there). Returns false at the end.
+		bool next(std::vector<boost::uint32_t>& cluster)
+		{
+			cluster.clear();
+
+			boost::int_fast32_t ch = ahead != -2 ? ahead : s->get();
+			ahead = -2;
+
+			if(ch == EOF)
+				return false;
+
+			cluster.push_back(ch);
+			boost::int_fast32_t following = s->get();
+
+			// ASCII followed by ASCII (or the end) is a cluster of its own, except for CR LF.
+			if(ch < 0x80 && following < 0x80 && !(ch == '\r' && following == '\n'))
+			{
+				ahead = following;
+				return true;
+			}
+
+			grapheme_state state;
+			grapheme_break_before(state, grapheme_break_property(ch));
+			ch = following;
+
+			for(;;)
+			{
+				if(ch == EOF || grapheme_break_before(state, grapheme_break_property(ch)))
+				{
+					ahead = ch;
+					return true;
+				}
+
+				cluster.push_back(ch);
+				ch = s->get();
+			}
+		}
+
+	private:
+		stream_type* s;
+		boost::int_fast32_t ahead; // A character already read that starts the next cluster, -2 if there isn't one, or EOF.
+	};
+}
+
+#endif
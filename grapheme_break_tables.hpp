@@ -0,0 +1,584 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tables for grapheme clusters (see grapheme.hpp).
+// Generated by tools/ucdgen.py from the Unicode Character Database 14.0.0. Don't edit.
+// Tables: 10568 bytes.
+
+#ifndef BOOST_UNICODE_GRAPHEME_BREAK_TABLES_HPP
+#define BOOST_UNICODE_GRAPHEME_BREAK_TABLES_HPP
+
+#include <boost/cstdint.hpp>
+
+namespace unicode
+{
+	enum grapheme_break
+	{
+		gb_other, // Other
+		gb_cr, // CR
+		gb_lf, // LF
+		gb_control, // Control
+		gb_extend, // Extend
+		gb_zwj, // ZWJ
+		gb_regional_indicator, // Regional Indicator
+		gb_prepend, // Prepend
+		gb_spacing_mark, // Spacing Mark
+		gb_l, // L
+		gb_v, // V
+		gb_t, // T
+		gb_lv, // LV
+		gb_lvt, // LVT
+		gb_extended_pictographic // Extended Pictographic
+	};
+
+	// The tables are static members of a class template so that they're only
+	// stored once however many translation units include this.
+	template<class T=void>
+	struct grapheme_break_data
+	{
+		static const boost::uint8_t grapheme_break_property_stage1[1800];
+		static const boost::uint16_t grapheme_break_property_stage2[2272];
+		static const boost::uint8_t grapheme_break_property_stage3[4224];
+	};
+
+	template<class T> const boost::uint8_t grapheme_break_data<T>::grapheme_break_property_stage1[1800] = {
+		0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,10,
+		15,16,17,18,19,20,21,10,22,23,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,24,25,26,27,28,29,30,31,32,33,27,28,29,
+		30,31,32,33,27,28,29,30,31,32,33,34,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,35,10,36,
+		37,38,10,10,10,39,40,41,42,43,44,45,46,47,48,49,
+		10,10,10,10,10,10,10,10,10,10,50,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,51,10,52,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,53,10,
+		10,10,10,10,10,10,10,54,55,56,10,10,10,57,10,10,
+		58,59,10,10,60,10,10,10,61,62,63,64,65,66,67,68,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		69,70,70,70,70,70,70,70
+	};
+
+	template<class T> const boost::uint16_t grapheme_break_data<T>::grapheme_break_property_stage2[2272] = {
+		0,1,2,2,2,2,2,3,1,1,4,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		5,5,5,5,5,5,5,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,6,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,7,5,8,9,2,2,2,
+		10,11,2,2,12,5,2,13,2,2,2,2,2,14,15,2,
+		16,17,2,5,18,2,2,2,2,2,19,13,2,2,12,20,
+		2,21,22,2,2,23,2,2,2,24,2,2,25,5,26,5,
+		27,2,2,28,29,30,31,2,32,2,2,33,34,35,31,36,
+		37,2,2,38,39,17,2,40,37,2,2,38,41,2,31,25,
+		32,2,2,42,34,43,31,2,44,2,2,45,46,35,2,2,
+		47,2,2,42,48,49,31,2,32,2,2,50,51,49,31,2,
+		52,2,2,53,54,35,31,2,32,2,2,2,55,56,2,57,
+		2,2,2,58,59,2,2,2,2,2,2,60,61,2,2,2,
+		2,62,2,63,2,2,2,64,65,66,5,67,68,2,2,2,
+		2,2,69,70,2,71,13,72,73,74,2,2,2,2,2,2,
+		75,75,75,75,75,75,76,76,76,76,77,78,78,78,78,78,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,69,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,79,2,80,2,31,2,31,2,2,2,81,82,20,2,2,
+		83,2,2,2,2,2,2,2,49,2,84,2,2,2,2,2,
+		2,2,85,86,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,87,2,2,2,88,89,90,2,2,2,5,91,2,2,2,
+		92,2,2,93,94,2,12,95,96,2,97,2,2,2,98,52,
+		2,2,99,100,2,2,2,2,2,2,2,2,2,101,102,103,
+		2,2,2,2,2,2,2,2,2,2,2,2,5,5,5,5,
+		104,2,105,106,107,2,1,2,2,2,2,2,2,5,5,13,
+		2,2,108,107,2,2,2,2,2,109,110,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,111,112,2,2,2,2,2,112,2,2,2,113,2,114,115,
+		2,2,2,2,2,2,2,2,2,2,2,2,108,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,111,116,117,2,2,118,
+		119,120,121,121,121,121,121,121,122,121,121,121,121,121,121,121,
+		123,124,125,126,127,128,129,2,2,130,131,132,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,133,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		130,134,2,2,2,135,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,136,137,
+		2,2,2,2,2,2,2,136,2,2,2,2,2,2,5,5,
+		2,2,25,138,2,2,2,2,2,139,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,140,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,136,141,2,142,2,2,2,2,2,137,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		143,2,144,2,2,2,2,2,145,2,2,146,147,2,5,148,
+		2,2,149,2,150,52,75,151,27,2,2,152,153,2,154,2,
+		2,2,155,156,157,2,2,158,2,2,2,159,17,2,160,161,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,162,2,
+		163,164,165,166,165,167,165,163,164,165,166,165,167,165,163,164,
+		165,166,165,167,165,163,164,165,166,165,167,165,163,164,165,166,
+		165,167,165,163,164,165,166,165,167,165,163,164,165,166,165,167,
+		165,163,164,165,166,165,167,165,163,164,165,166,165,167,165,163,
+		164,165,166,165,167,165,163,164,165,166,165,167,165,163,164,165,
+		166,165,167,165,163,164,165,166,165,167,165,163,164,165,166,165,
+		167,165,163,164,165,166,165,167,165,163,164,165,166,165,167,165,
+		163,164,165,166,165,167,165,163,164,165,166,165,167,165,163,164,
+		165,166,165,167,165,163,164,165,166,165,167,165,163,164,165,166,
+		165,167,165,163,164,165,166,165,167,165,163,164,165,166,165,167,
+		165,163,164,165,166,165,167,165,163,164,165,166,165,167,165,163,
+		164,165,166,165,167,165,163,164,165,166,165,167,165,163,164,165,
+		166,165,167,165,163,164,165,166,165,167,165,163,164,165,166,165,
+		167,165,163,164,165,166,165,167,165,163,164,165,166,165,167,165,
+		163,164,165,166,165,167,165,163,164,165,166,165,167,165,163,164,
+		165,166,165,167,165,163,164,165,166,165,168,76,169,78,78,170,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,36,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		5,2,5,2,2,2,2,2,2,2,2,2,2,2,2,3,
+		2,2,2,2,2,2,2,2,2,142,2,2,2,2,2,171,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,74,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,13,2,
+		2,2,2,2,2,2,2,172,2,2,2,2,2,2,2,2,
+		173,2,2,174,2,2,2,2,2,2,2,2,2,2,49,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,175,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,176,2,2,2,2,2,
+		2,2,2,2,19,13,2,2,177,2,2,2,2,2,2,2,
+		178,2,2,179,180,2,2,181,96,2,2,182,183,2,2,2,
+		184,2,185,186,187,2,2,188,96,2,2,189,190,2,2,2,
+		2,2,191,192,2,2,2,2,2,2,2,2,2,136,193,2,
+		52,2,2,53,194,35,195,186,2,2,2,2,2,2,2,2,
+		2,2,2,196,197,36,2,2,2,2,2,198,199,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,136,200,13,201,2,2,
+		2,2,2,202,13,2,2,2,2,2,203,204,2,2,2,2,
+		2,69,205,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,191,206,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,207,208,2,2,2,2,2,2,2,2,209,210,2,
+		211,2,2,212,35,213,2,2,214,215,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,216,217,2,2,2,2,2,218,219,220,2,2,2,2,
+		2,2,2,221,222,2,2,2,223,224,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,225,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,226,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,186,
+		2,2,2,180,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,136,227,228,228,229,184,2,2,2,2,230,145,
+		2,2,2,2,2,2,2,2,2,231,232,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		5,5,233,5,180,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,234,235,236,2,237,2,2,2,2,2,
+		2,2,2,2,238,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		5,5,5,239,5,5,67,154,230,12,7,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		240,241,242,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,180,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,36,2,2,2,243,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,180,2,2,
+		2,2,2,2,244,2,2,2,2,2,2,2,2,2,2,2,
+		121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+		245,2,113,2,2,2,246,247,248,249,245,121,121,121,250,251,
+		252,253,113,254,114,121,121,121,121,121,121,121,121,121,121,121,
+		121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,255,
+		121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+		121,121,121,256,257,121,121,121,121,121,121,121,121,121,121,121,
+		121,121,121,121,121,2,2,2,121,121,121,121,121,121,121,121,
+		2,2,2,2,2,2,2,258,2,2,2,2,2,259,121,121,
+		246,2,2,2,260,261,2,2,260,2,262,121,121,121,121,121,
+		246,121,121,263,119,121,121,121,121,121,121,121,121,121,121,121,
+		121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+		121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+		121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+		121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+		121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,256,
+		1,1,5,5,5,5,5,5,1,1,1,1,1,1,1,1,
+		5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+	};
+
+	template<class T> const boost::uint8_t grapheme_break_data<T>::grapheme_break_property_stage3[4224] = {
+		3,3,3,3,3,3,3,3,3,3,2,3,3,1,3,3,
+		3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+		0,0,0,0,0,0,0,0,0,14,0,0,0,3,14,0,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		0,0,0,4,4,4,4,4,4,4,0,0,0,0,0,0,
+		0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,0,4,
+		0,4,4,0,4,4,0,4,0,0,0,0,0,0,0,0,
+		7,7,7,7,7,7,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,4,4,4,4,4,4,4,4,0,3,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,4,4,4,4,4,
+		4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,4,4,4,4,4,4,4,7,0,4,
+		4,4,4,4,4,0,0,4,4,0,4,4,4,4,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
+		0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,4,4,4,4,4,4,4,4,0,0,0,0,0,
+		0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,0,0,0,0,0,0,0,0,0,4,0,0,
+		0,0,0,0,0,0,4,4,4,4,0,4,4,4,4,4,
+		4,4,4,4,0,4,4,4,0,4,4,4,4,4,0,0,
+		0,0,0,0,0,0,0,0,0,4,4,4,0,0,0,0,
+		7,7,0,0,0,0,0,0,4,4,4,4,4,4,4,4,
+		0,0,0,0,0,0,0,0,0,0,4,4,4,4,4,4,
+		4,4,7,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,8,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,4,8,4,0,8,8,
+		8,4,4,4,4,4,4,4,4,8,8,8,8,4,8,8,
+		0,4,4,4,4,4,4,4,0,0,0,0,0,0,0,0,
+		0,0,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,4,8,8,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,4,0,4,8,
+		8,4,4,4,4,0,0,8,8,0,0,8,8,4,0,0,
+		0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+		0,4,4,8,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,4,0,8,8,
+		8,4,4,0,0,0,0,4,4,0,0,4,4,4,0,0,
+		4,4,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+		8,4,4,4,4,4,0,4,4,8,0,8,8,4,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,4,0,4,4,
+		0,0,0,0,0,4,4,4,0,0,0,0,0,0,0,0,
+		0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,8,
+		4,8,8,0,0,0,8,8,8,0,8,8,8,4,0,0,
+		4,8,8,8,4,0,0,0,0,0,0,0,0,0,0,0,
+		4,8,8,8,8,0,4,4,4,0,4,4,4,4,0,0,
+		0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,4,0,8,4,
+		8,8,4,8,8,0,4,8,8,0,8,8,4,4,0,0,
+		4,4,8,8,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,4,4,0,4,8,
+		8,4,4,4,4,0,8,8,8,0,8,8,8,4,7,0,
+		0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,
+		8,8,4,4,4,0,4,0,8,8,8,8,8,8,8,4,
+		0,0,8,8,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,4,0,8,4,4,4,4,4,4,4,0,0,0,0,0,
+		0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,0,
+		0,4,0,8,4,4,4,4,4,4,4,4,4,0,0,0,
+		0,0,0,0,0,0,0,0,4,4,4,4,4,4,0,0,
+		0,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,
+		0,0,0,0,0,4,0,4,0,4,0,0,0,0,8,8,
+		0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,8,
+		4,4,4,4,4,0,4,4,0,0,0,0,0,4,4,4,
+		4,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,0,
+		0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,4,
+		4,8,4,4,4,4,4,4,0,4,4,8,8,4,4,0,
+		0,0,0,0,0,0,8,8,4,4,0,0,0,0,4,4,
+		0,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,4,0,8,4,4,0,0,0,0,0,0,4,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,
+		11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+		0,0,4,4,4,8,0,0,0,0,0,0,0,0,0,0,
+		0,0,4,4,8,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,4,4,8,4,4,4,4,4,4,4,8,8,
+		8,8,8,8,8,8,4,8,8,4,4,4,4,4,4,4,
+		0,0,0,0,0,0,0,0,0,0,0,4,4,4,3,4,
+		0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,
+		4,4,4,8,8,8,8,4,4,8,8,8,0,0,0,0,
+		8,8,4,8,8,8,8,8,8,4,4,4,0,0,0,0,
+		0,0,0,0,0,0,0,4,4,8,8,4,0,0,0,0,
+		0,0,0,0,0,8,4,8,4,4,4,4,4,4,4,0,
+		4,0,4,0,0,4,4,4,4,4,4,4,4,8,8,8,
+		8,8,8,4,4,4,4,4,4,4,4,4,4,0,0,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,0,
+		4,4,4,4,8,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,4,4,4,4,4,4,4,8,4,8,8,8,
+		8,8,4,8,8,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,8,4,4,4,4,8,8,4,4,8,4,4,4,0,0,
+		0,0,0,0,0,0,4,8,4,4,8,8,8,4,8,4,
+		0,0,0,0,8,8,8,8,8,8,8,8,4,4,4,4,
+		4,4,4,4,8,8,4,4,0,0,0,0,0,0,0,0,
+		4,4,4,0,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,8,4,4,4,4,4,4,4,0,0,0,0,4,0,0,
+		0,0,0,0,4,0,0,8,4,4,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,3,4,5,3,3,
+		0,0,0,0,0,0,0,0,3,3,3,3,3,3,3,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,
+		0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,
+		0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,14,14,14,14,14,14,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,14,14,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,14,14,0,0,0,0,
+		0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,
+		0,0,0,0,0,0,0,0,0,14,14,14,14,14,14,14,
+		14,14,14,14,0,0,0,0,14,14,14,0,0,0,0,0,
+		0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,
+		14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,14,14,14,14,0,
+		14,14,14,14,14,14,0,14,14,14,14,14,14,14,14,14,
+		14,14,14,0,14,14,14,14,14,14,14,14,14,14,14,14,
+		14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+		14,14,14,14,14,14,0,0,0,0,0,0,0,0,0,0,
+		14,14,14,14,14,14,0,0,14,14,14,14,14,14,14,14,
+		14,14,14,0,14,0,14,0,0,0,0,0,0,14,0,0,
+		0,14,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+		0,0,0,14,14,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,14,0,0,14,0,0,0,0,14,0,14,0,
+		0,0,0,14,14,14,0,14,0,0,0,0,0,0,0,0,
+		0,0,0,14,14,14,14,14,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,14,14,14,0,0,0,0,0,0,0,0,
+		0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,
+		0,0,0,0,14,14,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,14,14,0,0,0,
+		14,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,
+		4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		14,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,
+		0,0,0,0,0,0,0,0,0,4,4,0,0,0,0,0,
+		0,0,0,0,0,0,0,14,0,14,0,0,0,0,0,0,
+		4,4,4,0,4,4,4,4,4,4,4,4,4,4,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,
+		0,0,4,0,0,0,4,0,0,0,0,4,0,0,0,0,
+		0,0,0,8,8,4,4,8,0,0,0,0,4,0,0,0,
+		8,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,8,8,8,8,8,8,8,8,8,8,8,8,
+		8,8,8,8,4,4,0,0,0,0,0,0,0,0,0,0,
+		4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,4,
+		0,0,0,0,0,0,4,4,4,4,4,4,4,4,0,0,
+		0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,0,0,0,
+		0,0,0,4,8,8,4,4,4,4,8,8,4,4,8,8,
+		8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,4,4,4,4,4,4,8,
+		8,4,4,8,8,4,4,0,0,0,0,0,0,0,0,0,
+		0,0,0,4,0,0,0,0,0,0,0,0,4,8,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,
+		4,0,4,4,4,0,0,4,4,0,0,0,0,0,4,4,
+		0,0,0,0,0,0,0,0,0,0,0,8,4,4,8,8,
+		0,0,0,0,0,8,4,0,0,0,0,0,0,0,0,0,
+		0,0,0,8,8,4,8,8,4,8,8,0,8,4,0,0,
+		12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,12,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,12,13,13,13,13,13,13,13,
+		13,13,13,13,12,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,0,0,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,0,0,0,0,11,11,11,11,11,
+		11,11,11,11,11,11,11,11,11,11,11,11,0,0,0,0,
+		3,3,3,3,3,3,3,3,3,3,3,3,0,0,0,0,
+		0,0,0,0,0,0,4,4,4,4,4,0,0,0,0,0,
+		0,4,4,4,0,4,4,0,0,0,0,0,4,4,4,4,
+		0,0,0,0,0,0,0,0,4,4,4,0,0,0,0,4,
+		0,0,0,0,4,4,4,4,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,4,4,0,0,0,
+		0,0,4,4,4,4,0,0,0,0,0,0,0,0,0,0,
+		8,4,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,0,0,0,0,0,0,0,0,0,
+		4,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,
+		8,8,8,4,4,4,4,8,8,4,4,0,0,7,0,0,
+		0,0,4,0,0,0,0,0,0,0,0,0,0,7,0,0,
+		4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,4,4,4,4,4,8,4,4,4,
+		4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,8,8,0,0,0,0,0,0,0,0,0,
+		0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,8,8,8,4,4,4,4,4,4,4,4,4,8,
+		8,0,7,7,0,0,0,0,0,4,4,4,4,0,8,4,
+		0,0,0,0,0,0,0,0,0,0,0,0,8,8,8,4,
+		4,4,8,8,4,8,4,4,0,0,0,0,0,0,4,0,
+		8,8,8,4,4,4,4,4,4,4,4,0,0,0,0,0,
+		4,8,8,8,8,0,0,8,8,0,0,8,8,8,0,0,
+		0,0,8,8,0,0,4,4,4,4,4,4,4,0,0,0,
+		0,0,0,0,0,8,8,8,4,4,4,4,4,4,4,4,
+		8,8,4,4,4,8,4,0,0,0,0,0,0,0,0,0,
+		4,8,8,4,4,4,4,4,4,8,4,8,8,4,8,4,
+		4,8,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		8,8,4,4,4,4,0,0,8,8,8,8,4,4,8,4,
+		0,0,0,0,0,0,0,0,0,0,0,0,4,4,0,0,
+		8,8,8,4,4,4,4,4,4,4,4,8,8,4,8,4,
+		0,0,0,0,0,0,0,0,0,0,0,4,8,4,8,8,
+		4,4,4,4,4,4,8,4,0,0,0,0,0,0,0,0,
+		0,0,4,4,4,4,8,4,4,4,4,4,0,0,0,0,
+		4,4,4,4,4,4,4,4,8,4,4,0,0,0,0,0,
+		4,8,8,8,8,8,0,8,8,0,0,4,4,8,4,7,
+		8,7,8,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,8,8,8,4,4,4,4,0,0,4,4,8,8,8,8,
+		4,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,
+		0,4,4,4,4,4,4,4,4,4,4,0,0,0,0,0,
+		0,0,0,4,4,4,4,4,4,8,7,4,4,4,4,0,
+		0,4,4,4,4,4,4,8,8,4,4,4,0,0,0,0,
+		0,0,0,0,7,7,7,7,7,7,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,8,4,4,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,
+		4,4,4,4,4,4,4,0,4,4,4,4,4,4,8,4,
+		0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,0,8,4,4,4,4,4,4,
+		4,8,4,4,8,4,4,0,0,0,0,0,0,0,0,0,
+		0,4,4,4,4,4,4,0,0,0,4,0,4,4,0,4,
+		4,4,4,4,4,4,7,4,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,8,8,8,8,8,0,
+		4,4,0,8,8,4,8,4,0,0,0,0,0,0,0,0,
+		0,0,0,4,4,8,8,0,0,0,0,0,0,0,0,0,
+		3,3,3,3,3,3,3,3,3,0,0,0,0,0,0,0,
+		0,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+		8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+		8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,4,
+		0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,0,
+		3,3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,
+		0,0,0,0,0,4,8,4,4,4,0,0,0,8,4,4,
+		4,4,4,3,3,3,3,3,3,3,3,4,4,4,4,4,
+		4,4,4,0,0,4,4,4,4,4,4,4,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,4,4,4,4,0,0,
+		0,0,4,4,4,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,4,4,4,4,0,0,0,0,4,4,4,4,4,
+		4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,0,0,4,4,4,4,4,
+		4,4,0,4,4,0,4,4,4,4,4,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,4,4,4,4,
+		0,0,0,0,4,4,4,4,4,4,4,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,14,14,14,
+		0,0,0,0,0,0,0,0,0,0,0,0,14,14,14,14,
+		14,14,0,0,0,0,0,0,0,0,0,0,0,0,14,14,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,
+		0,14,14,14,14,14,14,14,14,14,14,0,0,0,0,0,
+		14,14,14,14,14,14,6,6,6,6,6,6,6,6,6,6,
+		6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+		0,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+		0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,
+		0,0,14,14,14,14,14,14,14,14,14,0,14,14,14,14,
+		14,14,14,14,14,14,14,14,14,14,14,4,4,4,4,4,
+		14,14,14,14,14,14,14,14,14,14,14,14,14,14,0,0,
+		0,0,0,0,0,0,14,14,14,14,14,14,14,14,14,14,
+		0,0,0,0,14,14,14,14,14,14,14,14,14,14,14,14,
+		0,0,0,0,0,14,14,14,14,14,14,14,14,14,14,14,
+		0,0,0,0,0,0,0,0,14,14,14,14,14,14,14,14,
+		0,0,0,0,0,0,0,0,0,0,14,14,14,14,14,14,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,14,
+		14,14,14,14,14,14,14,14,14,14,14,0,14,14,14,14
+	};
+
+	// Grapheme_Cluster_Break (or extended pictographic) of a character.
+	inline boost::uint8_t grapheme_break_property(boost::uint32_t cp)
+	{
+		if(cp >= 0xE1000) // Everything from here on has the same value.
+			return 0;
+
+		return grapheme_break_data<>::grapheme_break_property_stage3[(grapheme_break_data<>::grapheme_break_property_stage2[(grapheme_break_data<>::grapheme_break_property_stage1[cp >> 9] << 5) + ((cp >> 4) & 0x1F)] << 4) + (cp & 0xF)];
+	}
+}
+
+#endif
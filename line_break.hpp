@@ -0,0 +1,434 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_LINE_BREAK_HPP
+#define BOOST_UNICODE_LINE_BREAK_HPP
+
+#include <cstddef>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "line_break_tables.hpp"
+#include "break_source.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Line breaking (see UAX #14, http://www.unicode.org/reports/tr14/). Text is cut
+	// at the places a line may be wrapped, or must be (after a line break character),
+	// so each piece ends with the spaces after it, e.g. "Hello, " "world." Numbers are
+	// kept together as in example 7 of section 8.2, like the test data of UAX #14 and
+	// most implementations do, so "$(12.50)" isn't broken. Letters, digits and
+	// underscores never have a break between them, so runs of them in ASCII are skipped
+	// 16 bytes at a time without looking anything up.
+	//================================================================================
+
+	const int line_break_class_mask = 0x3F;
+
+	inline bool is_line_alphabetic(int lb)
+	{
+		return lb == lb_al || lb == lb_hl;
+	}
+
+	inline bool is_jamo(int lb)
+	{
+		return lb == lb_jl || lb == lb_jv || lb == lb_jt || lb == lb_h2 || lb == lb_h3;
+	}
+
+	// Line_Break of the nth character after the next one in src, skipping the combining
+	// marks that rule LB9 attaches to the one before, or -1 at the end.
+	template<class source_type>
+	int peek_line_break(source_type& src, std::size_t n)
+	{
+		for(;;)
+		{
+			boost::int_fast32_t c = src.peek(n++);
+
+			if(c < 0)
+				return -1;
+
+			int lb = line_break_property(c) & line_break_class_mask;
+
+			if(lb != lb_cm && lb != lb_zwj)
+				return lb;
+		}
+	}
+
+	// What has to be remembered about the characters before the next one. Characters
+	// that rule LB9 attaches to the one before them don't count.
+	struct line_break_state
+	{
+		int prev; // line_break_property() of the last character, with its flags.
+		int before_prev; // Line_Break of the one before it, or -1.
+		int before_spaces; // Line_Break of the last one that wasn't SP.
+		int last; // Line_Break of the last character, even if it was attached to the one before.
+		int regional_indicators; // Number of regional indicators in a row up to prev.
+		int number; // 1 after NU (NU | SY | IS)*, and 2 after that followed by CL or CP (LB25).
+	};
+
+	// Is there no break opportunity before a character with line_break_property() next
+	// (LB11 to LB30b)?
+	template<class source_type>
+	bool line_continues(const line_break_state& state, int next, source_type& src)
+	{
+		typedef line_break_data<> data;
+
+		int p = state.prev & line_break_class_mask;
+		int n = next & line_break_class_mask;
+
+		if(n == lb_wj || p == lb_wj)
+			return true; // LB11
+		if(p == lb_gl)
+			return true; // LB12
+		if(n == lb_gl && p != lb_sp && p != lb_ba && p != lb_hy)
+			return true; // LB12a
+		if(n == lb_cl || n == lb_cp || n == lb_ex || n == lb_is || n == lb_sy)
+			return true; // LB13
+		if(state.before_spaces == lb_op)
+			return true; // LB14
+		if(state.before_spaces == lb_qu && n == lb_op)
+			return true; // LB15
+		if((state.before_spaces == lb_cl || state.before_spaces == lb_cp) && n == lb_ns)
+			return true; // LB16
+		if(state.before_spaces == lb_b2 && n == lb_b2)
+			return true; // LB17
+		if(p == lb_sp)
+			return false; // LB18
+		if(n == lb_qu || p == lb_qu)
+			return true; // LB19
+		if(n == lb_cb || p == lb_cb)
+			return false; // LB20
+		if(n == lb_ba || n == lb_hy || n == lb_ns || p == lb_bb)
+			return true; // LB21
+		if(state.before_prev == lb_hl && (p == lb_hy || p == lb_ba))
+			return true; // LB21a
+		if(p == lb_sy && n == lb_hl)
+			return true; // LB21b
+		if(n == lb_in)
+			return true; // LB22
+		if((is_line_alphabetic(p) && n == lb_nu) || (p == lb_nu && is_line_alphabetic(n)))
+			return true; // LB23
+		if((p == lb_pr && (n == lb_id || n == lb_eb || n == lb_em)) || ((p == lb_id || p == lb_eb || p == lb_em) && n == lb_po))
+			return true; // LB23a
+		if(((p == lb_pr || p == lb_po) && is_line_alphabetic(n)) || (is_line_alphabetic(p) && (n == lb_pr || n == lb_po)))
+			return true; // LB24
+
+		// LB25: (PR | PO) x (OP | HY)? NU, (OP | HY) x NU, NU (NU | SY | IS)* x (NU | SY | IS | CL | CP)
+		// and NU (NU | SY | IS)* (CL | CP)? x (PO | PR).
+		if((p == lb_pr || p == lb_po) && (n == lb_nu || ((n == lb_op || n == lb_hy) && peek_line_break(src, 1) == lb_nu)))
+			return true;
+		if((p == lb_op || p == lb_hy) && n == lb_nu)
+			return true;
+		if(state.number == 1 && n == lb_nu)
+			return true;
+		if(state.number && (n == lb_po || n == lb_pr))
+			return true;
+
+		if((p == lb_jl && (n == lb_jl || n == lb_jv || n == lb_h2 || n == lb_h3))
+			|| ((p == lb_jv || p == lb_h2) && (n == lb_jv || n == lb_jt))
+			|| ((p == lb_jt || p == lb_h3) && n == lb_jt))
+			return true; // LB26
+		if((is_jamo(p) && n == lb_po) || (p == lb_pr && is_jamo(n)))
+			return true; // LB27
+		if(is_line_alphabetic(p) && is_line_alphabetic(n))
+			return true; // LB28
+		if(p == lb_is && is_line_alphabetic(n))
+			return true; // LB29
+		if(((is_line_alphabetic(p) || p == lb_nu) && n == lb_op && !(next & data::east_asian_flag))
+			|| (p == lb_cp && !(state.prev & data::east_asian_flag) && (is_line_alphabetic(n) || n == lb_nu)))
+			return true; // LB30
+		if(p == lb_ri && n == lb_ri && state.regional_indicators % 2)
+			return true; // LB30a
+		if((p == lb_eb || (state.prev & data::pictographic_flag)) && n == lb_em)
+			return true; // LB30b
+
+		return false; // LB31
+	}
+
+	// Take the characters from src up to the next break opportunity. Returns true if
+	// the break is mandatory (after a line break character), false if it's only allowed
+	// or it's the end of the text.
+	template<class source_type>
+	bool take_line(source_type& src)
+	{
+		boost::int_fast32_t c = src.peek(0);
+
+		if(c < 0)
+			return false;
+
+		src.take();
+
+		line_break_state state;
+		state.prev = line_break_property(c);
+		state.last = state.prev & line_break_class_mask;
+		state.before_prev = -1;
+
+		switch(state.last)
+		{
+		case lb_cr:
+			if(src.peek(0) == '\n')
+				src.take(); // LB5
+			// Fall through.
+		case lb_bk:
+		case lb_lf:
+		case lb_nl:
+			return true; // LB4, LB5
+		case lb_cm:
+		case lb_zwj:
+			state.prev = lb_al; // LB10
+			break;
+		default:
+			break;
+		}
+
+		state.before_spaces = state.prev & line_break_class_mask;
+		state.regional_indicators = state.prev == lb_ri;
+		state.number = state.prev == lb_nu;
+
+		for(;;)
+		{
+			int p = state.prev & line_break_class_mask;
+
+			if(p == lb_al || p == lb_hl || p == lb_nu)
+			{
+				boost::uint32_t b = 0, l = 0;
+				std::size_t n = src.skip_ascii_word(b, l);
+
+				if(n)
+				{
+					state.before_prev = n > 1 ? line_break_property(b) : p;
+					state.prev = state.last = state.before_spaces = line_break_property(l);
+					state.regional_indicators = 0;
+					state.number = state.prev == lb_nu;
+				}
+			}
+
+			c = src.peek(0);
+
+			if(c < 0)
+				return false; // LB3
+
+			int next = line_break_property(c);
+			int n = next & line_break_class_mask;
+
+			if(n == lb_bk || n == lb_lf || n == lb_nl || n == lb_cr)
+			{
+				src.take(); // LB6
+
+				if(n == lb_cr && src.peek(0) == '\n')
+					src.take(); // LB5
+
+				return true; // LB4, LB5
+			}
+
+			// LB9 attaches combining marks to the character before them, and LB10 makes
+			// any others alphabetic.
+			p = state.prev & line_break_class_mask;
+			bool attached = (n == lb_cm || n == lb_zwj) && p != lb_sp && p != lb_zw;
+
+			if((n == lb_cm || n == lb_zwj) && !attached)
+				next = lb_al;
+
+			bool continues;
+
+			if(n == lb_sp || n == lb_zw)
+				continues = true; // LB7
+			else if(state.before_spaces == lb_zw)
+				continues = false; // LB8
+			else if(state.last == lb_zwj || attached)
+				continues = true; // LB8a, LB9
+			else
+				continues = line_continues(state, next, src);
+
+			if(!continues)
+				return false;
+
+			src.take();
+			state.last = n;
+
+			if(attached)
+				continue;
+
+			n = next & line_break_class_mask;
+
+			if(n == lb_nu)
+				state.number = 1;
+			else if(state.number == 1 && (n == lb_sy || n == lb_is))
+				state.number = 1;
+			else if(state.number == 1 && (n == lb_cl || n == lb_cp))
+				state.number = 2;
+			else
+				state.number = 0;
+
+			state.regional_indicators = n == lb_ri ? state.regional_indicators + 1 : 0;
+			state.before_prev = p;
+			state.prev = next;
+
+			if(n != lb_sp)
+				state.before_spaces = n;
+		}
+	}
+
+	// The end of the piece of a line that starts at p, in well-formed UTF-8: the next
+	// place it can be broken. mandatory is set if it has to be broken there.
+	inline const boost::uint8_t* next_line_break(const boost::uint8_t* p, const boost::uint8_t* last, bool& mandatory)
+	{
+		// The usual ASCII piece, a run of letters, digits and underscores followed by spaces
+		// and the next such run, can be found without looking anything up. Anything else
+		// goes the long way.
+		if(p != last && is_ascii_word(*p))
+		{
+			const boost::uint8_t* q = skip_ascii_word(p + 1, last);
+
+			if(q != last && *q == ' ')
+			{
+				do
+				{
+					++q;
+				}
+				while(q != last && *q == ' ');
+
+				if(q != last && is_ascii_word(*q))
+				{
+					mandatory = false;
+					return q;
+				}
+			}
+		}
+
+		utf8_break_source src(p, last);
+		mandatory = take_line(src);
+		return src.position();
+	}
+
+	inline const boost::uint8_t* next_line_break(const boost::uint8_t* p, const boost::uint8_t* last)
+	{
+		bool mandatory;
+		return next_line_break(p, last, mandatory);
+	}
+
+	//--------------------------------------------------------------------------------
+	// Iterating over the pieces of UTF-8 in memory (a basic_ustring or ustring_view)
+	// between break opportunities. Only forwards, like word_iterator.
+	//--------------------------------------------------------------------------------
+
+	class line_break_iterator
+	{
+	public:
+		line_break_iterator() : last(0), ptr(0), next(0), must_break(false)
+		{
+		}
+
+		// An iterator at p (which has to be a break opportunity) in text that ends at _last.
+		line_break_iterator(const boost::uint8_t* _last, const boost::uint8_t* p) : last(_last), ptr(p), next(0), must_break(false)
+		{
+		}
+
+		bool operator==(const line_break_iterator& op) const
+		{
+			return ptr == op.ptr;
+		}
+
+		bool operator!=(const line_break_iterator& op) const
+		{
+			return ptr != op.ptr;
+		}
+
+		line_break_iterator& operator++()
+		{
+			ptr = end_of_segment();
+			next = 0;
+			return *this;
+		}
+
+		line_break_iterator operator++(int)
+		{
+			line_break_iterator tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		// First byte of the piece.
+		const boost::uint8_t* base() const
+		{
+			return ptr;
+		}
+
+		// One past the last byte of the piece.
+		const boost::uint8_t* end_of_segment() const
+		{
+			if(!next)
+				next = next_line_break(ptr, last, must_break);
+
+			return next;
+		}
+
+		// Number of bytes in the piece.
+		std::size_t bytes() const
+		{
+			return end_of_segment() - ptr;
+		}
+
+		// Does the line have to be broken after the piece (because it ends with a line break)?
+		bool mandatory() const
+		{
+			end_of_segment();
+			return must_break;
+		}
+
+	private:
+		const boost::uint8_t* last;
+		const boost::uint8_t* ptr; // Start of the current piece.
+		mutable const boost::uint8_t* next; // End of the current piece, or 0 if it hasn't been found yet.
+		mutable bool must_break;
+	};
+
+	// Iterators over the pieces of s between places a line can be wrapped (a basic_ustring
+	// converts to a view, and the iterators point into its data).
+	inline line_break_iterator line_break_begin(const ustring_view& s)
+	{
+		return line_break_iterator(s.data() + s.bytes(), s.data());
+	}
+
+	inline line_break_iterator line_break_end(const ustring_view& s)
+	{
+		return line_break_iterator(s.data() + s.bytes(), s.data() + s.bytes());
+	}
+
+	// A view of the piece of a line at l.
+	inline ustring_view segment_view(const line_break_iterator& l)
+	{
+		return ustring_view(l.base(), l.bytes());
+	}
+
+	//--------------------------------------------------------------------------------
+	// Reading pieces from a Unicode input stream (a uistream, or anything else with a
+	// get() that returns code points and EOF at the end).
+	//--------------------------------------------------------------------------------
+
+	template<class stream_type>
+	class line_break_reader
+	{
+	public:
+		line_break_reader(stream_type* s) : src(s)
+		{
+		}
+
+		// Read the next piece into segment (replacing what was there), and set mandatory if
+		// the line has to be broken after it. Returns false at the end.
+		bool next(std::vector<boost::uint32_t>& segment, bool& mandatory)
+		{
+			segment.clear();
+			src.output(&segment);
+			mandatory = take_line(src);
+			return !segment.empty();
+		}
+
+	private:
+		stream_break_source<stream_type> src;
+	};
+}
+
+#endif
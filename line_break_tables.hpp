@@ -0,0 +1,783 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tables for line breaks (see line_break.hpp).
+// Generated by tools/ucdgen.py from the Unicode Character Database 14.0.0. Don't edit.
+// Tables: 13953 bytes.
+
+#ifndef BOOST_UNICODE_LINE_BREAK_TABLES_HPP
+#define BOOST_UNICODE_LINE_BREAK_TABLES_HPP
+
+#include <boost/cstdint.hpp>
+
+namespace unicode
+{
+	enum line_break
+	{
+		lb_al, // Alphabetic
+		lb_bk, // Mandatory Break
+		lb_cr, // Carriage Return
+		lb_lf, // Line Feed
+		lb_nl, // Next Line
+		lb_cm, // Combining Mark
+		lb_zwj, // ZWJ
+		lb_wj, // Word Joiner
+		lb_zw, // ZWSpace
+		lb_gl, // Glue
+		lb_sp, // Space
+		lb_b2, // Break Both
+		lb_ba, // Break After
+		lb_bb, // Break Before
+		lb_hy, // Hyphen
+		lb_cb, // Contingent Break
+		lb_cl, // Close Punctuation
+		lb_cp, // Close Parenthesis
+		lb_ex, // Exclamation
+		lb_in, // Inseparable
+		lb_ns, // Nonstarter
+		lb_op, // Open Punctuation
+		lb_qu, // Quotation
+		lb_is, // Infix Numeric
+		lb_nu, // Numeric
+		lb_po, // Postfix Numeric
+		lb_pr, // Prefix Numeric
+		lb_sy, // Break Symbols
+		lb_eb, // E Base
+		lb_em, // E Modifier
+		lb_h2, // H2
+		lb_h3, // H3
+		lb_hl, // Hebrew Letter
+		lb_id, // Ideographic
+		lb_jl, // JL
+		lb_jv, // JV
+		lb_jt, // JT
+		lb_ri // Regional Indicator
+	};
+
+	// The tables are static members of a class template so that they're only
+	// stored once however many translation units include this.
+	template<class T=void>
+	struct line_break_data
+	{
+		static const int east_asian_flag = 64;
+		static const int pictographic_flag = 128;
+		static const boost::uint8_t line_break_property_stage1[1793];
+		static const boost::uint16_t line_break_property_stage2[2880];
+		static const boost::uint8_t line_break_property_stage3[6400];
+	};
+
+	template<class T> const boost::uint8_t line_break_data<T>::line_break_property_stage1[1793] = {
+		0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+		16,17,18,19,20,18,21,22,23,24,25,25,25,25,25,25,
+		25,25,25,25,25,25,26,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		27,25,28,29,30,31,32,33,34,35,36,37,38,32,33,34,
+		35,36,37,38,32,33,34,35,36,37,38,39,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,40,41,42,43,
+		44,45,46,18,47,48,49,50,51,52,53,54,55,56,57,58,
+		18,18,59,18,18,18,18,18,18,60,61,18,18,18,18,18,
+		18,18,62,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,63,18,64,25,25,25,25,25,25,25,25,
+		25,25,25,65,25,66,67,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,68,69,18,18,18,18,70,18,
+		18,18,18,18,18,18,18,71,72,73,18,74,18,75,18,18,
+		76,77,18,18,78,18,79,18,80,81,82,83,84,85,86,87,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,88,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,88,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		89
+	};
+
+	template<class T> const boost::uint16_t line_break_data<T>::line_break_property_stage2[2880] = {
+		0,1,2,3,4,5,4,6,7,1,8,9,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,10,11,4,4,
+		1,1,1,1,12,13,14,15,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,16,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,17,18,1,19,20,21,22,23,
+		24,25,4,4,26,1,27,28,4,4,4,4,4,29,30,31,
+		4,32,4,1,33,4,4,4,4,4,34,28,31,4,26,35,
+		4,36,37,4,4,38,4,4,4,39,4,4,40,1,41,1,
+		42,4,4,43,1,44,45,4,46,4,4,47,48,49,50,51,
+		46,4,4,47,52,32,53,54,46,4,4,47,55,4,50,56,
+		46,4,4,47,48,57,50,4,58,4,4,59,60,49,53,61,
+		62,4,4,47,63,64,50,65,66,4,4,47,63,64,50,4,
+		42,4,4,67,63,49,50,68,46,4,4,4,69,70,53,71,
+		4,4,4,72,73,74,4,4,4,4,4,75,76,31,4,4,
+		77,78,31,79,4,4,4,80,81,82,1,83,84,85,4,4,
+		4,4,26,86,74,87,88,89,90,91,4,4,4,4,4,4,
+		92,92,92,92,92,92,93,93,93,93,94,95,95,95,95,95,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,96,97,4,4,4,4,4,4,4,4,4,
+		98,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,98,99,4,4,4,4,100,4,
+		4,101,4,102,4,71,4,71,4,4,4,103,1,104,31,4,
+		105,31,4,4,4,4,4,4,64,4,106,4,4,4,4,4,
+		4,4,107,107,108,4,4,4,4,4,4,4,4,31,4,4,
+		4,109,4,4,4,110,1,111,31,31,4,1,86,4,4,4,
+		62,4,4,103,62,112,113,114,115,4,116,31,4,4,34,42,
+		4,4,103,117,31,31,4,118,4,4,4,4,4,119,120,121,
+		4,4,4,4,4,4,4,4,4,4,4,4,1,1,1,1,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,122,
+		123,124,125,126,127,128,129,130,130,4,131,132,133,1,1,28,
+		134,135,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,136,4,4,4,4,4,4,4,4,4,4,4,4,137,4,
+		138,139,140,4,4,4,4,4,4,4,4,4,4,4,4,141,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		141,142,4,143,4,4,144,145,4,4,4,146,147,148,149,150,
+		151,4,4,4,4,152,153,154,4,4,4,4,155,4,156,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,157,158,4,4,4,138,4,159,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,160,161,
+		4,4,4,4,4,4,4,162,4,4,4,4,4,4,1,1,
+		163,164,165,166,167,168,4,4,169,170,169,169,169,169,169,141,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,171,4,172,
+		173,174,175,176,177,169,178,169,179,180,181,169,178,169,179,182,
+		183,169,169,184,169,169,169,169,185,169,169,169,169,169,141,186,
+		169,185,169,169,187,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,4,4,4,4,
+		169,188,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,189,169,169,169,190,4,4,118,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		191,4,31,4,4,4,160,192,4,59,4,4,4,4,4,193,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		194,4,195,196,4,4,4,197,198,4,4,103,199,31,1,200,
+		31,4,201,4,202,42,92,203,42,4,4,204,205,31,206,31,
+		4,4,207,208,209,210,4,211,4,4,4,212,32,4,26,213,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,214,31,
+		215,216,217,218,217,219,217,215,216,217,218,217,219,217,215,216,
+		217,218,217,219,217,215,216,217,218,217,219,217,215,216,217,218,
+		217,219,217,215,216,217,218,217,219,217,215,216,217,218,217,219,
+		217,215,216,217,218,217,219,217,215,216,217,218,217,219,217,215,
+		216,217,218,217,219,217,215,216,217,218,217,219,217,215,216,217,
+		218,217,219,217,215,216,217,218,217,219,217,215,216,217,218,217,
+		219,217,215,216,217,218,217,219,217,215,216,217,218,217,219,217,
+		215,216,217,218,217,219,217,215,216,217,218,217,219,217,215,216,
+		217,218,217,219,217,215,216,217,218,217,219,217,215,216,217,218,
+		217,219,217,215,216,217,218,217,219,217,215,216,217,218,217,219,
+		217,215,216,217,218,217,219,217,215,216,217,218,217,219,217,215,
+		216,217,218,217,219,217,215,216,217,218,217,219,217,215,216,217,
+		218,217,219,217,215,216,217,218,217,219,217,215,216,217,218,217,
+		219,217,215,216,217,218,217,219,217,215,216,217,218,217,219,217,
+		215,216,217,218,217,219,217,215,216,217,218,217,219,217,215,216,
+		217,218,217,219,217,215,216,217,218,217,220,93,221,95,95,222,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		4,223,224,225,226,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,227,4,4,4,4,4,4,4,4,4,4,4,228,
+		1,229,1,230,231,232,233,4,4,4,4,4,4,4,4,234,
+		235,236,169,237,169,238,239,240,169,241,169,185,242,243,244,245,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		246,4,4,4,4,4,4,4,4,4,4,4,4,4,4,247,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,28,4,
+		4,4,4,4,4,4,4,248,4,249,4,4,4,98,4,4,
+		4,4,4,4,4,4,4,4,4,4,31,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,250,4,4,4,4,4,4,4,4,4,4,
+		4,249,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		251,4,4,252,4,253,4,4,4,4,4,4,4,4,64,254,
+		4,4,4,255,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,256,31,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,257,4,4,4,4,4,
+		4,4,4,4,34,28,4,4,101,4,4,4,4,4,4,4,
+		115,4,4,39,258,4,53,259,115,4,4,260,261,4,4,31,
+		115,4,202,262,263,4,4,264,115,4,4,204,265,266,4,4,
+		4,4,267,268,4,4,4,4,4,4,269,4,4,160,33,31,
+		42,4,4,67,48,49,270,62,4,4,4,4,4,4,4,4,
+		4,4,4,271,272,273,4,4,4,4,4,1,42,31,4,4,
+		4,4,4,4,4,4,4,4,4,4,160,274,275,276,4,4,
+		4,4,4,1,277,31,278,4,4,4,26,279,31,4,4,4,
+		4,96,107,280,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,267,33,4,4,4,4,4,4,4,4,4,4,31,4,
+		4,4,4,281,282,31,4,4,4,4,4,4,4,283,284,4,
+		285,4,4,286,287,288,4,4,40,289,290,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,160,291,292,31,4,293,4,294,82,208,4,4,4,4,
+		4,4,4,295,296,31,4,4,297,298,31,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,299,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,300,301,249,
+		4,4,4,4,4,4,4,302,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,303,4,4,304,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,305,4,4,4,4,4,4,4,4,
+		4,4,4,306,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,307,4,4,4,
+		4,4,4,4,4,4,308,4,4,4,4,4,31,4,4,309,
+		4,4,4,310,311,31,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,312,4,4,4,4,4,4,
+		4,4,4,4,160,18,1,1,313,115,4,4,4,4,314,198,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,187,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		315,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,316,4,4,317,318,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,172,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,319,42,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		1,1,320,1,208,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,321,1,322,4,323,4,4,4,4,4,
+		4,4,4,4,324,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,325,326,326,326,
+		1,1,1,327,1,1,328,206,329,26,18,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		291,330,331,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,208,31,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,332,4,4,4,267,333,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,208,4,4,
+		4,4,4,4,334,335,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,228,301,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		169,169,336,169,169,169,169,169,169,337,338,339,339,339,169,340,
+		146,4,4,4,4,4,146,4,4,4,341,342,342,342,343,344,
+		345,169,169,336,346,347,340,342,342,342,342,342,342,342,342,342,
+		169,169,169,169,169,169,169,169,348,349,169,350,351,169,169,352,
+		169,169,169,169,353,354,355,356,357,358,359,360,169,169,169,169,
+		361,190,183,362,363,169,169,364,169,365,169,169,169,366,169,367,
+		169,169,169,169,368,4,4,369,169,169,370,371,372,373,374,374,
+		4,4,4,4,4,4,4,375,4,4,4,4,4,376,336,377,
+		378,4,4,4,379,380,4,4,379,4,381,347,342,342,342,342,
+		382,383,384,385,169,169,169,386,169,169,169,387,388,389,169,169,
+		4,4,4,4,4,375,390,391,392,169,374,393,394,395,396,397,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,31,
+		342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+		342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+		342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+		342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,398,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+		169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,399,
+		32,4,1,1,1,1,1,1,4,4,4,4,4,4,4,4,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4
+	};
+
+	template<class T> const boost::uint8_t line_break_data<T>::line_break_property_stage3[6400] = {
+		5,5,5,5,5,5,5,5,5,12,3,1,1,2,5,5,
+		5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+		10,18,22,0,26,25,0,22,21,17,0,26,23,14,23,27,
+		24,24,24,24,24,24,24,24,24,24,23,23,0,0,0,18,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,21,26,17,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,21,12,16,0,5,
+		5,5,5,5,5,4,5,5,5,5,5,5,5,5,5,5,
+		9,21,25,26,26,26,0,0,0,0,0,22,0,12,0,0,
+		25,26,0,0,13,0,0,0,0,0,0,22,0,0,0,21,
+		0,0,0,0,0,0,0,0,13,0,0,0,13,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,
+		5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,9,
+		5,5,5,5,5,5,5,5,5,5,5,5,9,9,9,9,
+		9,9,9,5,5,5,5,5,5,5,5,5,5,5,5,5,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,0,
+		0,0,0,5,5,5,5,5,5,5,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,23,12,0,0,0,0,26,
+		0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+		5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,5,
+		0,5,5,0,5,5,18,5,0,0,0,0,0,0,0,0,
+		32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+		32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,32,
+		32,32,32,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,25,25,25,23,23,0,0,
+		5,5,5,5,5,5,5,5,5,5,5,18,5,18,18,18,
+		0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,
+		24,24,24,24,24,24,24,24,24,24,25,24,24,0,0,0,
+		5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,18,0,5,5,5,5,5,5,5,0,0,5,
+		5,5,5,5,5,0,0,5,5,0,5,5,5,5,0,0,
+		24,24,24,24,24,24,24,24,24,24,0,0,0,0,0,0,
+		0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
+		0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,
+		5,5,5,5,0,0,0,0,23,18,0,0,0,5,26,26,
+		0,0,0,0,0,0,5,5,5,5,0,5,5,5,5,5,
+		5,5,5,5,0,5,5,5,0,5,5,5,5,5,0,0,
+		0,0,0,0,0,0,0,0,0,5,5,5,0,0,0,0,
+		0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+		0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+		5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+		5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,5,5,5,0,5,5,
+		0,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
+		0,0,5,5,12,12,24,24,24,24,24,24,24,24,24,24,
+		0,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,5,0,5,5,
+		5,5,5,5,5,0,0,5,5,0,0,5,5,5,0,0,
+		0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,
+		0,0,5,5,0,0,24,24,24,24,24,24,24,24,24,24,
+		0,0,25,25,0,0,0,0,0,25,0,26,0,0,5,0,
+		5,5,5,0,0,0,0,5,5,0,0,5,5,5,0,0,
+		0,0,0,0,0,0,24,24,24,24,24,24,24,24,24,24,
+		5,5,0,0,0,5,0,0,0,0,0,0,0,0,0,0,
+		5,5,5,5,5,5,0,5,5,5,0,5,5,5,0,0,
+		0,26,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+		0,0,0,0,0,5,5,5,0,0,0,0,0,0,0,0,
+		0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,
+		5,5,5,0,0,0,5,5,5,0,5,5,5,5,0,0,
+		0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,
+		5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,
+		5,5,5,5,5,0,5,5,5,0,5,5,5,5,0,0,
+		0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,
+		0,5,5,5,13,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,5,5,0,5,5,
+		0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,5,
+		5,5,5,5,5,0,5,0,5,5,5,5,5,5,5,5,
+		0,0,5,5,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,5,0,0,5,5,5,5,5,5,5,0,0,0,0,26,
+		0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,0,
+		24,24,24,24,24,24,24,24,24,24,12,12,0,0,0,0,
+		0,5,0,0,5,5,5,5,5,5,5,5,5,0,0,0,
+		0,0,0,0,0,0,0,0,5,5,5,5,5,5,0,0,
+		0,13,13,13,13,0,13,13,9,13,13,12,9,18,18,18,
+		18,18,9,0,18,0,0,0,5,5,0,0,0,0,0,0,
+		0,0,0,0,12,5,0,5,0,5,21,16,21,16,5,5,
+		0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+		5,5,5,5,5,12,5,5,0,0,0,0,0,5,5,5,
+		5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,
+		5,5,5,5,5,5,5,5,5,5,5,5,5,0,12,12,
+		0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,
+		13,13,12,13,0,0,0,0,0,9,9,0,0,0,0,0,
+		5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+		0,0,0,0,0,0,5,5,5,5,0,0,0,0,5,5,
+		5,0,5,5,5,0,0,5,5,5,5,5,5,5,0,0,
+		0,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,5,5,5,5,5,5,5,5,5,5,5,5,0,5,
+		24,24,24,24,24,24,24,24,24,24,5,5,5,5,0,0,
+		34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,36,36,36,36,36,36,36,36,
+		36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,
+		0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,21,16,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,12,12,12,0,0,
+		0,0,5,5,5,5,0,0,0,0,0,0,0,0,0,0,
+		0,0,5,5,5,12,12,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
+		5,5,5,5,12,12,20,0,12,0,12,26,0,5,0,0,
+		0,0,18,18,12,12,13,0,18,18,0,5,5,5,9,5,
+		0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,
+		5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
+		0,0,0,0,18,18,24,24,24,24,24,24,24,24,24,24,
+		0,0,0,0,0,0,0,5,5,5,5,5,0,0,0,0,
+		0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,0,
+		5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,5,
+		24,24,24,24,24,24,24,24,24,24,12,12,0,12,12,12,
+		12,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,
+		5,5,5,5,0,0,0,0,0,0,0,0,0,12,12,0,
+		5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+		5,5,5,5,5,5,5,5,0,0,0,12,12,12,12,12,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,12,
+		5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,
+		5,5,5,5,5,5,5,5,5,0,0,0,0,5,0,0,
+		0,0,0,0,5,0,0,5,5,5,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,
+		12,12,12,12,12,12,12,9,12,12,12,8,5,6,5,5,
+		12,9,12,12,11,0,0,0,22,22,21,22,22,22,21,22,
+		0,0,0,0,19,19,19,12,1,1,5,5,5,5,5,9,
+		25,25,25,25,25,25,25,25,0,22,22,0,20,20,0,0,
+		0,0,0,0,23,21,16,20,20,20,0,0,0,0,0,0,
+		0,0,0,0,0,0,12,0,12,12,12,12,0,12,12,12,
+		7,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,21,16,0,
+		26,26,26,26,26,26,26,25,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,25,26,26,26,26,25,26,26,25,26,
+		25,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		0,0,0,25,0,0,0,0,0,25,0,0,0,0,0,0,
+		0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,
+		0,0,26,26,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,
+		0,0,0,0,0,0,0,0,21,16,21,16,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,33,33,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,85,16,0,0,0,0,0,
+		33,33,33,33,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,33,33,0,0,33,0,33,33,33,28,33,33,
+		0,0,0,0,0,0,0,0,0,33,33,33,0,0,0,0,
+		0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,33,33,33,
+		33,33,33,33,33,33,33,33,33,0,0,0,0,33,0,33,
+		33,33,0,33,33,0,0,0,33,33,0,0,33,0,0,33,
+		33,33,0,0,0,0,0,0,0,0,33,0,0,0,0,0,
+		0,33,33,33,33,33,0,33,33,28,33,0,0,33,33,33,
+		33,33,33,33,33,0,0,0,33,33,28,28,28,28,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,22,22,22,22,22,
+		22,0,18,18,33,0,0,0,21,16,21,16,21,16,21,16,
+		21,16,21,16,21,16,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,21,16,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,21,16,21,16,21,16,21,16,21,16,
+		0,0,0,21,16,21,16,21,16,21,16,21,16,21,16,21,
+		16,21,16,21,16,21,16,21,16,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,21,16,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
+		5,5,0,0,0,0,0,0,0,18,12,12,12,0,18,12,
+		12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
+		22,22,22,22,22,22,22,22,22,22,22,22,22,22,12,12,
+		12,12,12,12,12,12,0,12,21,12,0,0,22,22,0,0,
+		22,22,21,16,21,16,21,16,21,16,12,12,12,12,18,0,
+		12,12,0,12,12,0,0,0,0,0,11,11,12,12,12,0,
+		12,12,21,12,12,12,12,12,12,12,12,0,12,0,12,12,
+		0,0,0,18,18,21,16,21,16,21,16,21,16,12,0,0,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,0,33,33,33,33,33,
+		33,33,33,33,33,33,0,0,0,0,0,0,0,0,0,0,
+		33,33,33,33,33,33,33,33,33,33,33,33,0,0,0,0,
+		12,16,16,33,33,20,33,33,85,16,85,16,85,16,85,16,
+		85,16,33,33,85,16,85,16,85,16,85,16,20,85,16,16,
+		33,33,33,33,33,33,33,33,33,33,5,5,5,5,5,5,
+		33,33,33,33,33,5,33,33,33,33,33,20,20,33,33,33,
+		0,20,33,20,33,20,33,20,33,20,33,33,33,33,33,33,
+		33,33,33,20,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,20,33,20,33,20,33,33,33,33,33,33,20,33,
+		33,33,33,33,33,20,20,0,0,5,5,20,20,20,20,33,
+		20,20,33,20,33,20,33,20,33,20,33,33,33,33,33,33,
+		33,33,33,33,33,20,20,33,33,33,33,20,20,20,20,33,
+		0,0,0,0,0,33,33,33,33,33,33,33,33,33,33,33,
+		0,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,0,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		33,33,33,33,33,33,33,33,0,0,0,0,0,0,0,0,
+		33,33,33,33,33,20,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,0,0,0,
+		33,33,33,33,33,33,33,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,12,18,12,
+		5,5,5,0,5,5,5,5,5,5,5,5,5,5,0,0,
+		5,5,0,12,12,12,12,12,0,0,0,0,0,0,0,0,
+		0,0,5,0,0,0,5,0,0,0,0,5,0,0,0,0,
+		0,0,0,5,5,5,5,5,0,0,0,0,5,0,0,0,
+		0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,
+		0,0,0,0,13,13,18,18,0,0,0,0,0,0,0,0,
+		5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		5,5,5,5,5,5,0,0,0,0,0,0,0,0,12,12,
+		5,5,0,0,0,0,0,0,0,0,0,0,13,0,0,5,
+		0,0,0,0,0,0,5,5,5,5,5,5,5,5,12,12,
+		0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+		34,34,34,34,34,34,34,34,34,34,34,34,34,0,0,0,
+		0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+		5,0,0,0,0,0,0,12,12,12,0,0,0,0,0,0,
+		0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+		5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
+		0,0,0,5,0,0,0,0,0,0,0,0,5,5,0,0,
+		24,24,24,24,24,24,24,24,24,24,0,0,0,12,12,12,
+		0,0,0,0,0,0,0,0,0,0,0,5,5,5,0,0,
+		5,0,5,5,5,0,0,5,5,0,0,0,0,0,5,5,
+		12,12,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+		0,0,0,5,5,5,5,5,5,5,5,12,5,5,0,0,
+		30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,
+		31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,0,0,0,0,0,0,0,0,0,0,0,0,
+		35,35,35,35,35,35,35,0,0,0,0,36,36,36,36,36,
+		36,36,36,36,36,36,36,36,36,36,36,36,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,32,5,32,
+		32,32,32,32,32,32,32,32,32,0,32,32,32,32,32,32,
+		32,32,32,32,32,32,32,0,32,32,32,32,32,0,32,0,
+		32,32,0,32,32,0,32,32,32,32,32,32,32,32,32,32,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,21,
+		0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,
+		23,16,16,23,23,18,18,85,16,19,0,0,0,0,0,0,
+		33,33,33,33,33,85,16,85,16,85,16,85,16,85,16,85,
+		16,85,16,85,16,33,33,85,16,33,33,33,33,33,33,33,
+		16,33,16,0,20,20,18,18,33,85,16,85,16,85,16,33,
+		33,33,33,33,33,33,33,0,33,26,25,33,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
+		0,18,33,33,26,25,33,33,85,16,33,33,16,33,16,33,
+		33,33,33,33,33,33,33,33,33,33,20,20,33,33,33,18,
+		33,33,33,33,33,33,33,33,33,33,33,85,33,16,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,85,33,16,33,85,
+		16,16,85,16,16,20,33,20,20,20,20,20,20,20,20,20,
+		20,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,20,20,
+		0,0,33,33,33,33,33,33,0,0,33,33,33,33,33,33,
+		0,0,33,33,33,33,33,33,0,0,33,33,33,0,0,0,
+		25,26,33,33,33,26,26,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,5,5,5,15,0,0,0,
+		12,12,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
+		0,0,0,0,0,0,5,5,5,5,5,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,
+		0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,
+		0,5,5,5,0,5,5,0,0,0,0,0,5,5,5,5,
+		0,0,0,0,0,0,0,0,5,5,5,0,0,0,0,5,
+		12,12,12,12,12,12,12,12,0,0,0,0,0,0,0,0,
+		12,12,12,12,12,12,19,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,12,12,12,12,12,12,12,
+		0,0,0,0,5,5,5,5,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,5,5,12,0,0,
+		5,5,5,5,5,5,5,12,12,0,0,0,0,0,0,0,
+		5,0,0,5,5,0,0,0,0,0,0,0,0,0,0,5,
+		5,5,5,5,5,5,5,5,5,5,5,0,0,0,12,12,
+		12,12,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		5,5,5,5,5,0,24,24,24,24,24,24,24,24,24,24,
+		12,12,12,12,0,5,5,0,0,0,0,0,0,0,0,0,
+		0,0,0,5,0,13,0,0,0,0,0,0,0,0,0,0,
+		5,0,0,0,0,12,12,0,12,5,5,5,5,0,5,5,
+		24,24,24,24,24,24,24,24,24,24,0,13,0,12,12,12,
+		0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
+		5,5,5,5,5,5,5,5,12,12,0,12,12,0,5,0,
+		0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,
+		0,0,5,5,0,0,5,5,5,5,5,5,5,0,0,0,
+		0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,
+		5,5,5,5,5,5,5,0,0,0,0,12,12,12,12,0,
+		24,24,24,24,24,24,24,24,24,24,12,12,0,0,5,0,
+		5,5,5,5,5,5,0,0,5,5,5,5,5,5,5,5,
+		5,13,12,12,18,18,0,0,0,12,12,12,12,12,12,12,
+		12,12,12,12,12,12,12,12,0,0,0,0,5,5,0,0,
+		5,12,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,0,0,0,
+		5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
+		24,24,24,24,24,24,24,24,24,24,0,0,12,12,12,0,
+		5,5,5,5,5,5,0,5,5,0,0,5,5,5,5,0,
+		5,0,5,5,12,12,12,0,0,0,0,0,0,0,0,0,
+		0,5,5,5,5,5,5,5,0,0,5,5,5,5,5,5,
+		5,0,13,0,5,0,0,0,0,0,0,0,0,0,0,0,
+		0,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
+		0,0,0,5,5,5,5,5,5,5,0,5,5,5,5,13,
+		0,12,12,12,12,13,0,5,0,0,0,0,0,0,0,0,
+		0,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
+		5,5,5,5,5,5,5,5,5,5,12,12,12,0,13,13,
+		13,12,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,5,
+		0,12,12,12,12,12,0,0,0,0,0,0,0,0,0,0,
+		13,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+		0,5,5,5,5,5,5,0,0,0,5,0,5,5,0,5,
+		5,5,5,5,5,5,0,5,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,0,
+		5,5,0,5,5,5,5,5,0,0,0,0,0,0,0,0,
+		0,0,0,5,5,5,5,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,25,25,25,
+		25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		12,12,12,12,12,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,21,21,21,16,16,16,0,0,
+		0,0,16,0,0,0,21,16,21,16,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,21,16,16,0,0,0,0,
+		9,9,9,9,9,9,9,21,16,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,16,
+		24,24,24,24,24,24,24,24,24,24,0,0,0,0,12,12,
+		5,5,5,5,5,12,0,0,0,0,0,0,0,0,0,0,
+		5,5,5,5,5,5,5,12,12,12,0,0,0,0,0,0,
+		0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,12,12,0,0,0,0,0,0,0,
+		5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,5,
+		20,20,20,20,9,0,0,0,0,0,0,0,0,0,0,0,
+		33,33,33,33,33,33,33,33,33,0,0,0,0,0,0,0,
+		33,33,33,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		20,20,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,20,20,20,20,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,12,
+		5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+		0,0,0,0,0,5,5,5,5,5,0,0,0,5,5,5,
+		5,5,5,0,0,5,5,5,5,5,5,5,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,5,5,5,5,0,0,
+		0,0,5,5,5,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		5,5,5,5,5,5,5,0,0,0,0,5,5,5,5,5,
+		5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
+		0,0,0,0,5,0,0,12,12,12,12,0,0,0,0,0,
+		5,5,5,5,5,5,5,5,5,0,0,5,5,5,5,5,
+		5,5,0,5,5,0,5,5,5,5,5,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,
+		24,24,24,24,24,24,24,24,24,24,0,0,0,0,0,26,
+		0,0,0,0,5,5,5,5,5,5,5,0,0,0,0,0,
+		24,24,24,24,24,24,24,24,24,24,0,0,0,0,21,21,
+		33,33,33,33,33,33,33,33,33,33,33,33,161,161,161,161,
+		33,33,33,33,161,161,161,161,161,161,161,161,161,161,161,161,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,161,
+		161,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,161,161,161,161,161,161,161,161,161,161,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,33,161,161,
+		161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+		161,161,161,161,161,161,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		33,33,33,161,161,161,161,161,161,161,161,161,161,161,161,161,
+		33,33,33,33,33,33,33,33,33,161,161,161,161,161,161,161,
+		33,33,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+		33,33,33,33,33,28,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,0,0,33,33,
+		33,33,33,33,33,0,0,33,33,33,33,33,0,33,33,33,
+		33,33,28,28,28,33,33,28,33,33,28,28,28,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,29,29,29,29,29,
+		33,33,28,28,33,33,28,28,28,28,28,28,28,28,28,28,
+		28,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,28,28,28,28,28,28,28,28,28,28,
+		28,28,28,28,28,28,28,28,28,33,33,33,28,33,33,33,
+		33,28,28,28,33,28,28,28,33,33,33,33,33,33,33,28,
+		33,28,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		0,33,0,33,0,33,33,33,33,33,28,33,33,33,33,0,
+		33,0,0,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		0,0,0,0,0,0,0,33,33,33,33,33,33,33,33,33,
+		33,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,33,33,33,33,33,33,
+		33,33,33,33,28,28,33,33,33,33,28,33,33,33,33,33,
+		28,33,33,33,33,28,28,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,0,0,0,0,0,0,0,0,33,33,33,33,
+		33,33,33,33,0,0,0,0,0,0,33,33,33,33,33,33,
+		33,33,33,33,33,28,28,28,33,33,33,28,28,28,28,28,
+		0,0,0,0,0,0,22,22,22,20,20,20,0,0,0,0,
+		33,33,33,28,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,28,28,28,33,33,33,33,33,33,33,33,33,
+		28,33,33,33,33,33,33,33,33,33,33,33,28,33,33,33,
+		33,33,33,33,33,33,33,33,161,161,161,161,161,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,161,161,161,
+		0,0,0,0,161,161,161,161,161,161,161,161,161,161,161,161,
+		0,0,0,0,0,33,33,33,33,161,161,161,161,161,161,161,
+		33,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+		0,0,0,0,0,0,0,0,0,0,0,0,161,161,161,161,
+		0,0,0,0,0,0,0,0,161,161,161,161,161,161,161,161,
+		0,0,0,0,0,0,0,0,0,0,161,161,161,161,161,161,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,161,161,
+		0,0,0,0,0,0,0,0,0,0,0,0,28,33,33,28,
+		33,33,33,33,33,33,33,33,28,28,28,28,28,28,28,28,
+		33,33,33,33,33,33,28,33,33,33,33,33,33,33,33,33,
+		28,28,28,28,28,28,28,28,28,28,33,33,28,28,28,33,
+		33,33,33,33,33,33,33,28,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,28,28,33,28,28,33,28,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,28,28,28,
+		33,28,28,28,28,28,28,28,28,28,28,28,28,28,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,161,161,
+		33,33,33,33,33,161,161,161,33,33,33,33,33,161,161,161,
+		33,33,33,33,33,33,33,161,161,161,161,161,161,161,161,161,
+		33,33,33,33,33,33,33,33,33,33,33,161,161,161,161,161,
+		33,33,33,28,28,28,161,161,161,161,161,161,161,161,161,161,
+		33,33,33,33,33,33,33,33,33,33,161,161,161,161,161,161,
+		33,33,33,33,33,33,33,33,161,161,161,161,161,161,161,161,
+		28,28,28,28,28,28,28,161,161,161,161,161,161,161,161,161,
+		161,161,161,161,161,161,161,161,161,161,161,161,161,161,0,0,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,0,0
+	};
+
+	// Line_Break of a character (resolved as by rule LB1), with east_asian_flag and pictographic_flag.
+	inline boost::uint8_t line_break_property(boost::uint32_t cp)
+	{
+		if(cp >= 0xE0200) // Everything from here on has the same value.
+			return 0;
+
+		return line_break_data<>::line_break_property_stage3[(line_break_data<>::line_break_property_stage2[(line_break_data<>::line_break_property_stage1[cp >> 9] << 5) + ((cp >> 4) & 0x1F)] << 4) + (cp & 0xF)];
+	}
+}
+
+#endif
@@ -0,0 +1,543 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_MULTI_BYTE_HPP
+#define BOOST_UNICODE_MULTI_BYTE_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <boost/cstdint.hpp>
+#include "ustream.hpp"
+#include "utf8_count.hpp"
+#include "multi_byte_tables.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Legacy multi-byte East Asian encodings: Shift_JIS, EUC-JP, GBK, GB18030 and Big5.
+	// All of them are ASCII up to 0x7F. Other characters are a lead byte (0x81 and up)
+	// and a trail byte (0x40 and up), except for Shift_JIS's half-width katakana, which
+	// are one byte, EUC-JP's JIS X 0212 characters, which are 0x8F and two more bytes,
+	// and GB18030's four byte sequences, whose second and fourth bytes are digits.
+	//
+	// A byte decodes to a character by itself, or to a row of 192 characters, one for
+	// each trail byte. Rows are shared where they're the same (e.g. most of GBK and
+	// GB18030). Characters are encoded by looking their high byte up in 256 entries per
+	// encoding, which pick a shared block of 256 sequences for the low byte. GB18030's
+	// four byte sequences are in order, so they're worked out from a table of ranges.
+	//
+	// The decoders and encoders work with the Unicode streams like the UTF ones. For
+	// converting whole blocks in memory there are multi_byte_to_utf8() and
+	// utf8_to_multi_byte(), which copy runs of ASCII 16 bytes at a time.
+	//================================================================================
+
+	typedef multi_byte_data<> multi_byte_tables;
+
+	// The character b is by itself in encoding, or 0xFFFF if it isn't one.
+	inline boost::uint16_t multi_byte_char(int encoding, boost::uint8_t b)
+	{
+		return multi_byte_tables::multi_byte_decode_single[(encoding << 8) + b];
+	}
+
+	// The character lead and trail are in encoding, or 0xFFFF if they aren't one.
+	inline boost::uint16_t multi_byte_char(int encoding, boost::uint8_t lead, boost::uint8_t trail)
+	{
+		boost::uint16_t row = multi_byte_tables::multi_byte_lead[(encoding << 8) + lead];
+
+		if(!row || trail < 0x40)
+			return 0xFFFF;
+
+		return multi_byte_tables::multi_byte_decode[row * 192 + trail - 0x40];
+	}
+
+	// Does a character start with b and carry on into the next byte?
+	inline bool multi_byte_is_lead(int encoding, boost::uint8_t b)
+	{
+		return multi_byte_tables::multi_byte_lead[(encoding << 8) + b] || (encoding == multi_byte_euc_jp && b == 0x8F);
+	}
+
+	// The JIS X 0212 character EUC-JP encodes as 0x8F b2 b3, or 0xFFFF.
+	inline boost::uint16_t jis_x_0212_char(boost::uint8_t b2, boost::uint8_t b3)
+	{
+		// The rows for the second byte come after the last encoding's.
+		return multi_byte_char(multi_byte_tables::multi_byte_count, b2, b3);
+	}
+
+	// The character a GB18030 four byte sequence stands for, or -1 if it isn't one.
+	inline boost::int_fast32_t gb18030_char(const boost::uint8_t* p)
+	{
+		if(p[0] < 0x81 || p[0] > 0xFE || p[1] < 0x30 || p[1] > 0x39 || p[2] < 0x81 || p[2] > 0xFE || p[3] < 0x30 || p[3] > 0x39)
+			return -1;
+
+		boost::int_fast32_t linear = (((p[0] - 0x81) * 10 + p[1] - 0x30) * 126 + p[2] - 0x81) * 10 + p[3] - 0x30;
+
+		if(linear < multi_byte_tables::gb18030_bmp_linear)
+		{
+			const boost::uint16_t* ranges = multi_byte_tables::gb18030_range_linear;
+			int i = (int)(std::upper_bound(ranges, ranges + multi_byte_tables::gb18030_range_count, linear) - ranges) - 1;
+			return multi_byte_tables::gb18030_range_code[i] + linear - ranges[i];
+		}
+
+		// Everything above the BMP follows on from 90 30 81 30.
+		linear -= 189000;
+
+		return linear >= 0 && linear < 0x100000 ? linear + 0x10000 : -1;
+	}
+
+	// Write the sequence for ch in encoding at out, which needs room for 4 bytes.
+	// Returns its size, or 0 if the encoding doesn't have ch.
+	inline int unicode_to_multi_byte(int encoding, boost::uint32_t ch, boost::uint8_t* out)
+	{
+		if(ch < 0x80)
+		{
+			*out = (boost::uint8_t)ch;
+			return 1;
+		}
+
+		boost::uint16_t seq = 0;
+
+		if(ch <= 0xFFFF)
+			seq = multi_byte_tables::multi_byte_encode[(multi_byte_tables::multi_byte_encode_index[(encoding << 8) + (ch >> 8)] << 8) + (ch & 0xFF)];
+
+		if(seq >= 0x8000)
+		{
+			out[0] = (boost::uint8_t)(seq >> 8);
+			out[1] = (boost::uint8_t)seq;
+			return 2;
+		}
+
+		if(seq >= 0x100) // JIS X 0212, without the top bits.
+		{
+			out[0] = 0x8F;
+			out[1] = (boost::uint8_t)(seq >> 8 | 0x80);
+			out[2] = (boost::uint8_t)(seq | 0x80);
+			return 3;
+		}
+
+		if(seq)
+		{
+			*out = (boost::uint8_t)seq;
+			return 1;
+		}
+
+		if(encoding != multi_byte_gb18030 || (ch >= 0xD800 && ch <= 0xDFFF) || ch > 0x10FFFF)
+			return 0;
+
+		// Everything else is a four byte sequence in GB18030.
+		boost::uint32_t linear;
+
+		if(ch <= 0xFFFF)
+		{
+			const boost::uint16_t* ranges = multi_byte_tables::gb18030_range_code;
+			int i = (int)(std::upper_bound(ranges, ranges + multi_byte_tables::gb18030_range_count, ch) - ranges) - 1;
+			linear = multi_byte_tables::gb18030_range_linear[i] + ch - ranges[i];
+		}
+		else
+		{
+			linear = ch - 0x10000 + 189000;
+		}
+
+		out[3] = (boost::uint8_t)(linear % 10 + 0x30);
+		linear /= 10;
+		out[2] = (boost::uint8_t)(linear % 126 + 0x81);
+		linear /= 126;
+		out[1] = (boost::uint8_t)(linear % 10 + 0x30);
+		out[0] = (boost::uint8_t)(linear / 10 + 0x81);
+		return 4;
+	}
+
+	// Decode the character at p in encoding, where p is before last. size is set to the
+	// number of bytes it takes. For malformed input, -1 is returned, and size is the
+	// number of bytes to skip, or 0 if the sequence is cut short by last.
+	inline boost::int_fast32_t multi_byte_next(int encoding, const boost::uint8_t* p, const boost::uint8_t* last, int& size)
+	{
+		boost::uint16_t ch = multi_byte_char(encoding, *p);
+		size = 1;
+
+		if(ch != 0xFFFF)
+			return ch;
+
+		if(!multi_byte_is_lead(encoding, *p))
+			return -1;
+
+		if(last - p < 2)
+		{
+			size = 0;
+			return -1;
+		}
+
+		if(encoding == multi_byte_gb18030 && p[1] >= 0x30 && p[1] <= 0x39)
+		{
+			// A malformed sequence is as much of one as there is.
+			size = 2;
+
+			if(size < last - p && p[2] >= 0x81 && p[2] <= 0xFE)
+			{
+				++size;
+
+				if(size < last - p && p[3] >= 0x30 && p[3] <= 0x39)
+					++size;
+			}
+
+			if(size == 4)
+				return gb18030_char(p);
+
+			if(size == last - p)
+				size = 0;
+
+			return -1;
+		}
+
+		if(encoding == multi_byte_euc_jp && p[0] == 0x8F)
+		{
+			if(p[1] < 0xA1)
+				return -1;
+
+			if(last - p < 3)
+			{
+				size = 0;
+				return -1;
+			}
+
+			ch = jis_x_0212_char(p[1], p[2]);
+			size = ch != 0xFFFF ? 3 : p[2] < 0x80 ? 2 : 3;
+			return ch != 0xFFFF ? ch : -1;
+		}
+
+		ch = multi_byte_char(encoding, p[0], p[1]);
+
+		// An ASCII trail byte is left to be a character by itself.
+		if(ch != 0xFFFF || p[1] >= 0x80)
+			size = 2;
+
+		return ch != 0xFFFF ? ch : -1;
+	}
+
+	// The encoding called name (e.g. "Shift_JIS", "EUC-JP", "GBK", "GB18030" or "Big5"), or -1.
+	inline int find_multi_byte_encoding(std::string name)
+	{
+		for(std::size_t i=0; i < name.size(); ++i)
+			name[i] = (char)std::tolower((unsigned char)name[i]);
+
+		if(name == "shift_jis" || name == "shift-jis" || name == "sjis" || name == "cp932" || name == "windows-31j")
+			return multi_byte_shift_jis;
+
+		if(name == "euc-jp" || name == "euc_jp" || name == "eucjp")
+			return multi_byte_euc_jp;
+
+		if(name == "gbk" || name == "cp936" || name == "gb2312")
+			return multi_byte_gbk;
+
+		if(name == "gb18030")
+			return multi_byte_gb18030;
+
+		if(name == "big5" || name == "cp950")
+			return multi_byte_big5;
+
+		return -1;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Stream decoder and encoder. The encoding is given at run time to the basic_
+	// classes, and as a template argument to the others, which is what the Unicode
+	// streams need. Lead and trail bytes overlap, so there's no telling where the
+	// character before the current one starts, and prevg() always fails.
+	//--------------------------------------------------------------------------------
+
+	template<class error_policy=replace_on_error>
+	class basic_multi_byte_decoder : public basic_decoder
+	{
+	public:
+		basic_multi_byte_decoder(std::istream* _is, int _encoding) : basic_decoder(_is), encoding(_encoding) {}
+
+		// Read until one character is decoded.
+		boost::int_fast32_t decode()
+		{
+			for(;;)
+			{
+				BOOST_UNICODE_STAT(refill());
+
+				int b = is->get();
+
+				if(b == EOF)
+					return EOF;
+
+				boost::int_fast32_t ch = multi_byte_char(encoding, (boost::uint8_t)b);
+
+				if(ch != 0xFFFF)
+				{
+					BOOST_UNICODE_STAT(count(1));
+					++bytes_decoded;
+					return ch;
+				}
+
+				int consumed = 1;
+				int t = multi_byte_is_lead(encoding, (boost::uint8_t)b) ? is->peek() : EOF;
+
+				if(t != EOF && encoding == multi_byte_gb18030 && t >= 0x30 && t <= 0x39)
+				{
+					// A malformed sequence is as much of one as there is.
+					boost::uint8_t seq[4] = { (boost::uint8_t)b, (boost::uint8_t)is->get() };
+					++consumed;
+
+					if((t = is->peek()) >= 0x81 && t <= 0xFE)
+					{
+						seq[consumed++] = (boost::uint8_t)is->get();
+
+						if((t = is->peek()) >= 0x30 && t <= 0x39)
+							seq[consumed++] = (boost::uint8_t)is->get();
+					}
+
+					if(consumed == 4 && (ch = gb18030_char(seq)) >= 0)
+					{
+						BOOST_UNICODE_STAT(count(4));
+						bytes_decoded += 4;
+						return ch;
+					}
+				}
+				else if(t != EOF && encoding == multi_byte_euc_jp && b == 0x8F)
+				{
+					if(t >= 0xA1)
+					{
+						is->get();
+						++consumed;
+						int t2 = is->peek();
+
+						if(t2 != EOF && (ch = jis_x_0212_char((boost::uint8_t)t, (boost::uint8_t)t2)) != 0xFFFF)
+						{
+							is->get();
+							BOOST_UNICODE_STAT(count(3));
+							bytes_decoded += 3;
+							return ch;
+						}
+
+						if(t2 >= 0x80)
+						{
+							is->get();
+							++consumed;
+						}
+					}
+				}
+				else if(t != EOF)
+				{
+					ch = multi_byte_char(encoding, (boost::uint8_t)b, (boost::uint8_t)t);
+
+					if(ch != 0xFFFF)
+					{
+						is->get();
+						BOOST_UNICODE_STAT(count(2));
+						bytes_decoded += 2;
+						return ch;
+					}
+
+					// An ASCII trail byte is left to be a character by itself.
+					if(t >= 0x80)
+					{
+						is->get();
+						++consumed;
+					}
+				}
+
+				boost::int_fast32_t ret = error_policy::handle(is, "Byte sequence not used in the encoding.", error(consumed));
+				BOOST_UNICODE_STAT(count_error(consumed, ret));
+
+				if(ret != skip_character)
+					return ret;
+			}
+		}
+
+		// Skip a character in an input stream.
+		bool nextg()
+		{
+			return decode() != EOF;
+		}
+
+		bool prevg()
+		{
+			return false;
+		}
+
+		int skipg(int qty)
+		{
+			int ret = 0;
+
+			for(; ret < qty && decode() != EOF; ++ret);
+
+			return ret;
+		}
+
+		// Only the beginning and end can be sought, plus going forward from them.
+		bool seekg(int off, std::ios_base::seekdir dir=std::ios_base::beg)
+		{
+			if(off < 0 || dir == std::ios_base::cur)
+				return false;
+
+			lost_position();
+			is->seekg(0, dir);
+			skipg(off);
+			return true;
+		}
+
+	private:
+		int encoding;
+	};
+
+	template<int tpl_encoding, class error_policy=replace_on_error>
+	class multi_byte_decoder : public basic_multi_byte_decoder<error_policy>
+	{
+	public:
+		multi_byte_decoder(std::istream* _is) : basic_multi_byte_decoder<error_policy>(_is, tpl_encoding) {}
+	};
+
+	class basic_multi_byte_encoder : public basic_encoder
+	{
+	public:
+		basic_multi_byte_encoder(std::ostream* _os, int _encoding, std::size_t buffer_size=default_buffer_size)
+			: basic_encoder(_os, buffer_size), encoding(_encoding) {}
+
+		// Encode a character and write it to the stream. Characters the encoding doesn't
+		// have are written as '?'.
+		void encode(boost::int_fast32_t ch)
+		{
+			BOOST_UNICODE_STAT(++counters.code_points_out);
+
+			boost::uint8_t* p = reserve(4);
+			int n = unicode_to_multi_byte(encoding, (boost::uint32_t)ch, p);
+
+			if(!n)
+				p[n++] = '?';
+
+			commit(p + n);
+		}
+
+	private:
+		int encoding;
+	};
+
+	template<int tpl_encoding>
+	class multi_byte_encoder : public basic_multi_byte_encoder
+	{
+	public:
+		multi_byte_encoder(std::ostream* _os, std::size_t buffer_size=basic_encoder::default_buffer_size)
+			: basic_multi_byte_encoder(_os, tpl_encoding, buffer_size) {}
+	};
+
+	// Decoders, encoders, codecs and streams for each encoding, e.g. shift_jis_decoder,
+	// shift_jis_uistream and shift_jis_uofstream.
+#define BOOST_UNICODE_MULTI_BYTE_TYPEDEFS(name) \
+	typedef multi_byte_decoder<multi_byte_##name> name##_decoder; \
+	typedef multi_byte_encoder<multi_byte_##name> name##_encoder; \
+	typedef specific_codec<name##_decoder, name##_encoder> name##_codec; \
+	typedef specific_uistream<name##_decoder> name##_uistream; \
+	typedef specific_uostream<name##_encoder> name##_uostream; \
+	typedef specific_ustream<name##_codec> name##_ustream; \
+	typedef specific_ufstream<name##_uistream, std::ifstream> name##_uifstream; \
+	typedef specific_ufstream<name##_uostream, std::ofstream> name##_uofstream; \
+	typedef specific_ufstream<name##_ustream, std::fstream> name##_ufstream;
+
+	BOOST_UNICODE_MULTI_BYTE_TYPEDEFS(shift_jis)
+	BOOST_UNICODE_MULTI_BYTE_TYPEDEFS(euc_jp)
+	BOOST_UNICODE_MULTI_BYTE_TYPEDEFS(gbk)
+	BOOST_UNICODE_MULTI_BYTE_TYPEDEFS(gb18030)
+	BOOST_UNICODE_MULTI_BYTE_TYPEDEFS(big5)
+
+#undef BOOST_UNICODE_MULTI_BYTE_TYPEDEFS
+
+	//--------------------------------------------------------------------------------
+	// Converting blocks in memory.
+	//--------------------------------------------------------------------------------
+
+	// The end of the last whole character in [first, last), so a block can be cut there
+	// and the rest carried over to the next one. Bytes below 0x30 are only ever ASCII
+	// characters, so the search starts after the last of them.
+	inline const boost::uint8_t* multi_byte_whole(int encoding, const boost::uint8_t* first, const boost::uint8_t* last)
+	{
+		const boost::uint8_t* p = last;
+
+		while(p != first && p[-1] >= 0x30)
+			--p;
+
+		while(p != last)
+		{
+			int size;
+			multi_byte_next(encoding, p, last, size);
+
+			if(!size)
+				break;
+
+			p += size;
+		}
+
+		return p;
+	}
+
+	// Decode [first, last) in encoding to UTF-8 at out, which needs room for 3 bytes per
+	// byte of input. Malformed sequences, including one cut short at the end, become
+	// U+FFFD. Returns the end of the output.
+	inline boost::uint8_t* multi_byte_to_utf8(int encoding, const boost::uint8_t* first, const boost::uint8_t* last, boost::uint8_t* out)
+	{
+		while(first != last)
+		{
+			std::size_t n = ascii_run(first, last);
+
+			if(n)
+			{
+				std::memcpy(out, first, n);
+				first += n;
+				out += n;
+				continue;
+			}
+
+			int size;
+			boost::int_fast32_t ch = multi_byte_next(encoding, first, last, size);
+
+			if(ch < 0)
+			{
+				ch = 0xFFFD;
+
+				if(!size)
+					size = (int)(last - first);
+			}
+
+			first += size;
+			out = utf8_put((boost::uint32_t)ch, out);
+		}
+
+		return out;
+	}
+
+	// Encode well-formed UTF-8 [first, last) in encoding at out, which needs room for
+	// 2 bytes per byte of input. Characters the encoding doesn't have are written as
+	// '?'. Returns the end of the output.
+	inline boost::uint8_t* utf8_to_multi_byte(int encoding, const boost::uint8_t* first, const boost::uint8_t* last, boost::uint8_t* out)
+	{
+		while(first != last)
+		{
+			std::size_t n = ascii_run(first, last);
+
+			if(n)
+			{
+				std::memcpy(out, first, n);
+				first += n;
+				out += n;
+				continue;
+			}
+
+			int size = unicode_to_multi_byte(encoding, utf8_next(first), out);
+
+			if(!size)
+				out[size++] = '?';
+
+			out += size;
+		}
+
+		return out;
+	}
+}
+
+#endif
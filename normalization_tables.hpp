@@ -0,0 +1,2034 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tables for normalization (see normalize.hpp).
+// Generated by tools/ucdgen.py from the Unicode Character Database 14.0.0. Don't edit.
+// Tables: 64454 bytes.
+
+#ifndef BOOST_UNICODE_NORMALIZATION_TABLES_HPP
+#define BOOST_UNICODE_NORMALIZATION_TABLES_HPP
+
+#include <boost/cstdint.hpp>
+
+namespace unicode
+{
+	// The tables are static members of a class template so that they're only
+	// stored once however many translation units include this.
+	template<class T=void>
+	struct normalization_data
+	{
+		static const boost::uint8_t normalization_props_stage1[763];
+		static const boost::uint16_t normalization_props_stage2[1552];
+		static const boost::uint16_t normalization_props_stage3[5152];
+		static const boost::uint8_t decomposition_offset_stage1[763];
+		static const boost::uint16_t decomposition_offset_stage2[1008];
+		static const boost::uint16_t decomposition_offset_stage3[7424];
+		static const int decomposition_length_mask = 31;
+		static const int decomposition_compatibility = 32;
+		static const int decomposition_compatibility_follows = 64;
+		static const boost::uint16_t decomposition_pool[10682];
+		static const int composition_count = 941;
+		static const boost::uint32_t composition_first[941];
+		static const boost::uint32_t composition_second[941];
+		static const boost::uint32_t composition_result[941];
+	};
+
+	template<class T> const boost::uint8_t normalization_data<T>::normalization_props_stage1[763] = {
+		0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+		16,17,18,19,18,18,18,20,21,22,23,24,25,26,27,28,
+		29,30,31,32,33,18,18,18,18,18,34,18,35,36,37,38,
+		39,40,41,42,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,43,44,45,46,47,48,49,49,49,49,
+		49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+		49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+		49,49,49,49,49,49,49,50,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,51,52,53,42,54,55,56,
+		18,57,58,59,18,18,18,60,18,18,61,18,18,62,63,64,
+		65,66,67,68,69,70,71,72,73,74,75,18,76,77,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,78,79,18,18,18,80,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,81,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,82,83,18,84,85,86,87,18,18,18,18,18,18,18,18,
+		88,79,89,18,18,18,18,18,90,91,18,18,18,18,92,18,
+		18,93,94,18,18,18,18,18,18,18,18,95,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+		18,18,18,18,18,18,18,18,51,51,96
+	};
+
+	template<class T> const boost::uint16_t normalization_data<T>::normalization_props_stage2[1552] = {
+		0,0,0,0,0,0,0,0,0,0,1,2,3,4,3,5,
+		6,7,8,9,10,11,8,12,0,0,13,14,15,16,17,18,
+		6,19,20,21,0,0,0,0,0,0,0,22,0,23,24,0,
+		25,26,27,28,29,30,31,32,33,14,34,14,35,36,0,37,
+		38,39,0,39,0,38,0,40,41,0,0,0,42,43,44,45,
+		0,0,0,0,0,0,0,0,46,47,48,49,50,0,0,0,
+		0,51,52,0,53,54,0,55,0,0,0,0,56,57,58,0,
+		0,59,0,60,61,0,0,0,0,0,0,0,0,0,62,63,
+		0,64,65,0,0,66,0,0,0,67,0,0,68,69,70,71,
+		0,0,39,72,73,74,0,0,0,0,0,75,76,77,0,78,
+		0,0,0,79,73,80,0,0,0,0,0,81,73,0,0,0,
+		0,0,0,75,82,83,0,0,0,84,0,85,86,87,0,0,
+		0,0,0,81,88,89,0,0,0,0,0,81,90,91,0,0,
+		0,0,0,92,86,87,0,0,0,0,0,0,93,94,0,0,
+		0,0,0,95,96,0,0,0,0,0,0,97,98,99,0,0,
+		100,101,0,102,103,104,105,106,107,103,104,105,108,0,0,0,
+		0,0,109,110,0,0,0,0,111,0,0,0,0,0,0,100,
+		0,0,0,0,0,0,112,113,0,0,114,115,116,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,117,0,0,0,0,0,0,0,0,0,0,
+		0,118,0,119,0,0,0,0,0,0,0,0,0,120,0,0,
+		0,0,0,0,0,0,0,0,0,0,121,0,0,0,0,0,
+		0,0,0,122,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,123,0,0,0,0,124,125,0,0,0,126,127,0,0,0,
+		128,129,0,130,131,0,132,133,0,0,134,0,0,0,135,136,
+		0,0,0,137,0,0,0,0,0,0,0,0,0,138,139,140,
+		0,0,141,142,143,144,145,146,0,147,144,144,148,149,150,151,
+		6,6,6,6,6,6,6,6,6,152,6,6,6,6,6,153,
+		6,154,6,6,154,155,6,156,6,6,6,157,158,159,160,161,
+		162,163,164,165,166,167,0,168,169,170,146,0,0,171,172,173,
+		174,175,176,177,178,144,144,144,179,180,181,0,182,0,0,0,
+		183,0,184,185,186,0,187,188,188,0,189,0,0,0,190,0,
+		0,0,191,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,144,144,144,144,144,144,144,144,145,0,
+		100,0,0,0,0,0,0,192,0,0,0,0,0,193,0,0,
+		0,0,0,0,0,0,0,99,0,0,0,0,0,0,194,195,
+		0,0,0,0,0,0,196,197,0,0,0,0,0,0,150,150,
+		0,0,0,0,0,0,0,0,0,196,0,0,0,0,0,198,
+		144,144,144,144,144,144,144,144,144,144,144,144,144,199,0,0,
+		185,0,200,201,202,203,204,205,0,206,202,203,204,205,0,207,
+		0,0,0,208,144,144,144,144,169,209,0,0,0,0,0,0,
+		144,169,144,144,210,144,144,169,144,144,144,144,144,144,144,144,
+		144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,
+		0,0,0,0,0,0,194,211,0,212,0,0,0,0,0,195,
+		0,0,0,0,0,0,0,185,0,0,0,0,0,0,0,213,
+		214,0,215,0,0,0,0,0,0,0,0,0,119,0,150,195,
+		0,0,216,0,0,217,0,0,0,0,0,218,124,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,219,220,0,0,214,
+		0,0,0,0,0,221,179,0,0,0,0,0,0,0,73,0,
+		6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+		6,6,6,6,6,6,6,6,6,6,21,0,0,0,0,0,
+		222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,
+		223,224,225,222,222,222,223,222,222,222,222,222,222,226,0,0,
+		227,228,229,230,231,144,144,144,144,144,144,232,0,233,144,144,
+		144,144,144,234,0,144,144,144,144,209,144,144,210,0,0,170,
+		0,235,236,144,237,238,239,240,144,144,144,144,144,144,144,170,
+		208,144,144,144,144,144,144,144,144,144,144,169,241,242,243,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,0,
+		0,0,0,0,0,0,0,245,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,246,144,144,247,0,0,0,0,
+		248,0,0,249,0,0,0,0,0,0,0,0,0,0,250,0,
+		0,0,251,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,252,0,0,0,0,0,
+		0,0,0,0,253,244,0,0,254,0,0,0,0,0,0,0,
+		0,0,0,0,214,0,0,255,0,256,257,258,0,0,0,0,
+		259,0,260,261,0,0,0,218,0,0,0,0,262,0,0,0,
+		0,0,0,263,0,0,0,0,0,0,0,0,0,0,264,0,
+		0,0,0,265,76,87,266,267,0,0,0,0,0,0,0,0,
+		0,0,0,0,268,78,0,0,0,0,0,269,270,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,271,272,273,0,0,0,
+		0,0,0,197,0,0,0,0,0,0,0,274,0,0,0,0,
+		0,0,275,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,276,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,277,218,0,0,0,0,0,0,0,0,0,124,0,
+		0,0,0,119,278,0,0,0,0,279,0,0,0,0,0,0,
+		0,0,0,197,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,280,0,0,0,0,278,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,281,
+		0,0,0,282,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,283,
+		0,0,0,0,0,0,0,0,0,284,0,0,0,0,0,0,
+		0,0,0,0,0,285,286,287,288,0,289,290,291,0,0,0,
+		0,0,0,0,292,0,0,0,0,0,0,0,0,0,0,0,
+		144,144,144,144,144,293,144,144,144,294,295,296,297,144,144,144,
+		298,299,144,300,301,302,144,144,144,144,144,144,144,144,144,144,
+		144,144,144,144,144,144,144,144,144,144,303,144,144,144,144,144,
+		144,144,144,144,144,144,144,144,144,144,144,144,304,144,144,144,
+		305,306,307,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,78,0,0,0,308,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,309,0,0,
+		0,0,0,0,310,0,0,0,0,0,0,0,0,0,0,0,
+		297,144,311,312,313,314,315,316,317,318,319,318,0,0,0,0,
+		145,144,169,144,144,0,320,0,0,185,0,0,0,0,0,0,
+		321,144,144,318,22,232,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,235,
+		222,223,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+	};
+
+	template<class T> const boost::uint16_t normalization_data<T>::normalization_props_stage3[5152] = {
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		9216,0,0,0,0,0,0,0,9216,0,9216,0,0,0,0,9216,
+		0,0,9216,9216,9216,9216,0,0,9216,9216,9216,0,9216,9216,9216,0,
+		12288,12288,12288,12288,12288,12288,0,12288,12288,12288,12288,12288,12288,12288,12288,12288,
+		0,12288,12288,12288,12288,12288,12288,0,0,12288,12288,12288,12288,12288,0,0,
+		0,12288,12288,12288,12288,12288,12288,0,0,12288,12288,12288,12288,12288,0,12288,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,
+		0,0,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,
+		12288,12288,12288,12288,12288,12288,0,0,12288,12288,12288,12288,12288,12288,12288,12288,
+		12288,0,9216,9216,12288,12288,12288,12288,0,12288,12288,12288,12288,12288,12288,9216,
+		9216,0,0,12288,12288,12288,12288,12288,12288,9216,0,0,12288,12288,12288,12288,
+		12288,12288,0,0,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,9216,
+		12288,12288,0,0,0,0,0,0,0,0,0,0,0,0,0,12288,
+		12288,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,12288,12288,12288,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,0,12288,12288,
+		12288,12288,12288,12288,0,0,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,
+		12288,9216,9216,9216,12288,12288,0,0,12288,12288,12288,12288,12288,12288,12288,12288,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,0,0,12288,12288,
+		0,0,0,0,0,0,12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,
+		12288,12288,12288,12288,0,0,0,0,0,0,0,0,0,0,0,0,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,9216,9216,9216,9216,9216,9216,0,0,
+		9216,9216,9216,9216,9216,0,0,0,0,0,0,0,0,0,0,0,
+		2790,2790,2790,2790,2790,230,2790,2790,2790,2790,2790,2790,2790,230,230,2790,
+		230,2790,230,2790,2790,232,220,220,220,220,232,2776,220,220,220,220,
+		220,202,202,2780,2780,2780,2780,2762,2762,220,220,220,220,2780,2780,220,
+		2780,2780,220,220,1,1,1,1,2561,220,220,220,220,230,230,230,
+		13798,13798,2790,13798,13798,2800,230,220,220,220,230,230,230,220,220,0,
+		230,230,230,220,220,220,220,230,232,220,220,230,233,234,234,233,
+		234,234,233,230,230,230,230,230,230,230,230,230,230,230,230,230,
+		0,0,0,0,13568,0,0,0,0,0,9216,0,0,0,13568,0,
+		0,0,0,0,9216,13312,12288,13568,12288,12288,12288,0,12288,0,12288,12288,
+		0,0,0,0,0,0,0,0,0,0,12288,12288,12288,12288,12288,12288,
+		0,0,0,0,0,0,0,0,0,0,12288,12288,12288,12288,12288,0,
+		9216,9216,9216,13312,13312,9216,9216,0,0,0,0,0,0,0,0,0,
+		9216,9216,9216,0,9216,9216,0,0,0,9216,0,0,0,0,0,0,
+		12288,12288,0,12288,0,0,0,12288,0,0,0,0,12288,12288,12288,0,
+		0,0,0,0,0,0,0,0,0,12288,0,0,0,0,0,0,
+		0,0,0,0,0,0,12288,12288,0,0,0,0,0,0,0,0,
+		0,0,0,230,230,230,230,230,0,0,0,0,0,0,0,0,
+		0,12288,12288,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		12288,12288,12288,12288,0,0,12288,12288,0,0,12288,12288,12288,12288,12288,12288,
+		0,0,12288,12288,12288,12288,12288,12288,0,0,12288,12288,12288,12288,12288,12288,
+		12288,12288,12288,12288,12288,12288,0,0,12288,12288,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,9216,0,0,0,0,0,0,0,0,
+		0,220,230,230,230,230,220,230,230,230,222,220,230,230,230,230,
+		230,230,220,220,220,220,220,220,230,230,220,230,230,222,228,230,
+		10,11,12,13,14,15,16,17,18,19,19,20,21,22,0,23,
+		0,24,25,0,230,220,0,18,0,0,0,0,0,0,0,0,
+		230,230,230,230,230,230,230,230,30,31,32,0,0,0,0,0,
+		0,0,12288,12288,12288,12288,12288,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,27,28,29,30,31,
+		32,33,34,2790,2790,2780,220,230,230,230,230,230,220,230,230,220,
+		35,0,0,0,0,9216,9216,9216,9216,0,0,0,0,0,0,0,
+		12288,0,12288,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,12288,0,0,230,230,230,230,230,230,230,0,0,230,
+		230,230,230,220,230,0,0,230,230,0,220,230,230,220,0,0,
+		0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		230,220,230,230,220,230,230,220,220,220,230,220,220,230,220,230,
+		230,230,220,230,220,230,220,230,220,230,230,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,
+		230,230,220,230,0,0,0,0,0,0,0,0,0,220,0,0,
+		0,0,0,0,0,0,230,230,230,230,0,230,230,230,230,230,
+		230,230,230,230,0,230,230,230,0,230,230,230,230,230,0,0,
+		0,0,0,0,0,0,0,0,0,220,220,220,0,0,0,0,
+		0,0,0,0,0,0,0,0,230,220,220,220,230,230,230,230,
+		0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,220,
+		220,220,220,220,230,230,230,230,230,230,230,230,230,230,230,230,
+		230,230,0,220,230,230,220,230,230,220,230,230,230,220,220,220,
+		27,28,29,230,230,230,220,230,230,220,220,230,230,230,230,230,
+		0,12288,0,0,12288,0,0,0,0,0,0,0,2567,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+		0,230,220,230,230,0,0,0,13568,13568,13568,13568,13568,13568,13568,13568,
+		0,0,0,0,0,0,0,0,0,0,0,0,7,0,2560,0,
+		0,0,0,0,0,0,0,0,0,0,0,12288,12288,9,0,0,
+		0,0,0,0,0,0,0,2560,0,0,0,0,13568,13568,0,13568,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,
+		0,0,0,13568,0,0,13568,0,0,0,0,0,7,0,0,0,
+		0,0,0,0,0,0,0,0,0,13568,13568,13568,0,0,13568,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
+		0,0,0,0,0,0,0,0,12288,0,0,12288,12288,9,0,0,
+		0,0,0,0,0,0,2560,2560,0,0,0,0,13568,13568,0,0,
+		0,0,0,0,12288,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,2560,0,
+		0,0,0,0,0,0,0,0,0,0,12288,12288,12288,9,0,0,
+		0,0,0,0,0,0,0,2560,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,12288,0,0,0,0,9,0,0,
+		0,0,0,0,0,84,2651,0,0,0,0,0,0,0,0,0,
+		12288,0,2560,0,0,0,0,12288,12288,0,12288,12288,0,9,0,0,
+		0,0,0,0,0,2560,2560,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,9,9,0,2560,0,
+		0,0,0,0,0,0,0,0,0,0,2569,0,0,0,0,2560,
+		0,0,0,0,0,0,0,0,0,0,12288,0,12288,12288,12288,2560,
+		0,0,0,9216,0,0,0,0,103,103,9,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,107,107,107,107,0,0,0,0,
+		0,0,0,9216,0,0,0,0,118,118,9,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,122,122,122,122,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,9216,9216,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,9216,0,0,0,
+		0,0,0,0,0,0,0,0,220,220,0,0,0,0,0,0,
+		0,0,0,0,0,220,0,220,0,216,0,0,0,0,0,0,
+		0,0,0,13568,0,0,0,0,0,0,0,0,0,13568,0,0,
+		0,0,13568,0,0,0,0,13568,0,0,0,0,13568,0,0,0,
+		0,0,0,0,0,0,0,0,0,13568,0,0,0,0,0,0,
+		0,129,130,13568,132,13568,13568,9216,13568,9216,130,130,130,130,0,0,
+		130,13568,230,230,9,0,230,230,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,220,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,12288,0,0,0,0,0,0,0,2560,0,
+		0,0,0,0,0,0,0,7,0,9,9,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,
+		0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+		2560,2560,2560,2560,2560,2560,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,2560,2560,2560,2560,2560,2560,2560,2560,
+		2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+		2560,2560,2560,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,
+		0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,9,0,0,0,0,0,0,0,0,0,0,230,0,0,
+		0,0,0,0,0,0,0,0,0,228,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,222,230,220,0,0,0,0,
+		0,0,0,0,0,0,0,230,220,0,0,0,0,0,0,0,
+		9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,230,230,230,230,230,230,230,230,0,0,220,
+		230,230,230,230,230,220,220,220,220,220,220,230,230,220,0,220,
+		220,230,230,220,220,230,230,230,230,230,220,230,230,230,230,0,
+		0,0,0,0,0,0,12288,0,12288,0,12288,0,12288,0,12288,0,
+		0,0,12288,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,7,2560,0,0,0,0,0,12288,0,12288,0,0,
+		12288,12288,0,12288,9,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,230,220,230,230,230,
+		230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,
+		0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,
+		0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,
+		230,230,230,0,1,220,220,220,220,220,230,230,220,220,220,220,
+		230,0,1,1,1,1,1,1,1,0,0,0,0,220,0,0,
+		0,0,0,0,230,0,0,0,230,230,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,9216,9216,9216,0,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,9216,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,9216,9216,9216,9216,9216,
+		230,230,220,230,230,230,230,230,230,230,220,230,230,234,214,220,
+		202,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+		230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+		230,230,230,230,230,230,232,228,228,220,218,230,233,220,230,220,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,9216,13312,0,0,0,0,
+		12288,12288,12288,12288,12288,12288,12288,12288,12288,12288,0,0,0,0,0,0,
+		12288,12288,12288,12288,12288,12288,0,0,12288,12288,12288,12288,12288,12288,0,0,
+		12288,12288,12288,12288,12288,12288,12288,12288,0,12288,0,12288,0,12288,0,12288,
+		12288,13568,12288,13568,12288,13568,12288,13568,12288,13568,12288,13568,12288,13568,0,0,
+		12288,12288,12288,12288,12288,0,12288,12288,12288,12288,12288,13568,12288,9216,13568,9216,
+		9216,13312,12288,12288,12288,0,12288,12288,12288,13568,12288,13568,12288,13312,13312,13312,
+		12288,12288,12288,13568,0,0,12288,12288,12288,12288,12288,13568,0,13312,13312,13312,
+		12288,12288,12288,13568,12288,12288,12288,12288,12288,12288,12288,13568,12288,13312,13568,13568,
+		0,0,12288,12288,12288,0,12288,12288,12288,13568,12288,13568,12288,13568,9216,0,
+		13568,13568,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,0,0,0,0,
+		0,9216,0,0,0,0,0,9216,0,0,0,0,0,0,0,0,
+		0,0,0,0,9216,9216,9216,0,0,0,0,0,0,0,0,9216,
+		0,0,0,9216,9216,0,9216,9216,0,0,0,0,9216,0,9216,0,
+		0,0,0,0,0,0,0,9216,9216,9216,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,9216,0,0,0,0,0,0,0,9216,
+		9216,9216,0,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,0,0,
+		230,230,1,1,230,230,230,230,1,1,1,230,230,0,0,0,
+		0,230,0,0,0,1,1,230,220,230,1,1,220,220,220,220,
+		230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		9216,9216,9216,9216,0,9216,9216,9216,0,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,0,9216,9216,0,0,9216,9216,9216,9216,9216,0,0,
+		9216,9216,9216,0,9216,0,13568,0,9216,0,13568,13568,9216,9216,0,9216,
+		9216,9216,0,9216,9216,9216,9216,9216,9216,9216,0,9216,9216,9216,9216,9216,
+		9216,0,0,0,0,9216,9216,9216,9216,9216,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,9216,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,12288,12288,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,12288,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,12288,12288,12288,
+		0,0,0,0,12288,0,0,0,0,12288,0,0,12288,0,0,0,
+		0,0,0,0,12288,0,12288,0,0,0,0,0,9216,9216,0,9216,
+		9216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,12288,0,0,12288,0,0,12288,0,12288,0,0,0,0,0,0,
+		12288,0,12288,0,0,0,0,0,0,0,0,0,0,12288,12288,12288,
+		12288,12288,0,0,12288,12288,0,0,12288,12288,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,12288,12288,12288,12288,
+		12288,12288,12288,12288,0,0,0,0,0,0,12288,12288,12288,12288,0,0,
+		0,0,0,0,0,0,0,0,0,13568,13568,0,0,0,0,0,
+		0,0,0,0,9216,9216,9216,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,13568,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,
+		230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9216,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+		0,0,0,9216,0,0,0,0,0,0,0,0,0,0,0,0,
+		9216,9216,9216,9216,9216,9216,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,218,228,232,222,224,224,
+		0,0,0,0,0,0,9216,0,9216,9216,9216,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,12288,0,12288,0,
+		12288,0,12288,0,12288,0,12288,0,12288,0,12288,0,12288,0,12288,0,
+		12288,0,12288,0,0,12288,0,12288,0,12288,0,0,0,0,0,0,
+		12288,12288,0,12288,12288,0,12288,12288,0,12288,12288,0,12288,12288,0,0,
+		0,0,0,0,12288,0,0,0,0,2568,2568,9216,9216,0,12288,9216,
+		0,0,0,0,12288,0,0,12288,12288,12288,12288,0,0,0,12288,9216,
+		0,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		0,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,0,0,0,0,0,0,0,0,
+		0,0,0,0,230,230,230,230,230,230,230,230,230,230,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,9216,9216,230,230,
+		0,0,9216,9216,9216,0,0,0,9216,9216,0,0,0,0,0,0,
+		0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,220,220,220,0,0,
+		0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+		230,0,230,230,220,0,0,230,230,0,0,0,0,0,230,230,
+		0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,9216,9216,9216,9216,
+		13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,
+		13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,0,0,
+		13568,0,13568,0,0,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,0,
+		13568,0,13568,0,0,13568,13568,0,0,0,13568,13568,13568,13568,13568,13568,
+		13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,0,0,0,0,0,0,
+		9216,9216,9216,9216,9216,9216,9216,0,0,0,0,0,0,0,0,0,
+		0,0,0,9216,9216,9216,9216,9216,0,0,0,0,0,13568,26,13568,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,13568,13568,13568,13568,13568,13568,
+		13568,13568,13568,13568,13568,13568,13568,0,13568,13568,13568,13568,13568,0,13568,0,
+		13568,13568,0,13568,13568,0,13568,13568,13568,13568,13568,13568,13568,13568,13568,9216,
+		9216,9216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,0,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,0,0,0,0,0,
+		230,230,230,230,230,230,230,220,220,220,220,220,220,220,230,230,
+		9216,9216,9216,9216,9216,0,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,0,9216,9216,9216,9216,0,0,0,0,
+		9216,9216,9216,0,9216,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		0,0,9216,9216,9216,9216,9216,9216,0,0,9216,9216,9216,9216,9216,9216,
+		0,0,9216,9216,9216,9216,9216,9216,0,0,9216,9216,9216,0,0,0,
+		9216,9216,9216,9216,9216,9216,9216,0,9216,9216,9216,9216,9216,9216,9216,0,
+		220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,230,230,230,230,230,0,0,0,0,0,
+		0,9216,9216,9216,9216,9216,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,230,
+		0,0,0,0,0,0,0,0,230,1,220,0,0,0,0,9,
+		0,0,0,0,0,230,220,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,230,230,230,230,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,230,230,0,0,0,
+		0,0,0,0,0,0,220,220,230,230,230,220,230,220,220,220,
+		0,0,230,220,230,220,0,0,0,0,0,0,0,0,0,0,
+		9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+		0,0,0,0,0,0,0,0,0,0,12288,0,12288,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,12288,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,9,2567,0,0,0,0,0,
+		230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,2560,0,0,0,0,0,0,12288,12288,
+		0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,
+		9,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,
+		0,0,0,0,0,9,7,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,7,9,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,7,7,0,2560,0,
+		0,0,0,0,0,0,230,230,230,230,230,230,230,0,0,0,
+		230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,9,0,0,0,7,0,0,0,0,0,0,0,0,0,
+		2560,0,0,0,0,0,0,0,0,0,2560,12288,12288,2560,12288,0,
+		0,0,9,7,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2560,
+		0,0,0,0,0,0,0,0,0,0,12288,12288,0,0,0,9,
+		7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,9,7,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,9,7,0,0,0,0,0,
+		2560,0,0,0,0,0,0,0,12288,0,0,0,0,9,9,0,
+		0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,
+		0,0,7,0,9,9,0,0,0,0,0,0,0,0,0,0,
+		1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,
+		230,230,230,230,230,230,230,0,0,0,0,0,0,0,0,0,
+		6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,13568,13568,
+		13568,13568,13568,13568,13568,216,216,1,1,1,0,0,0,226,216,216,
+		216,216,216,0,0,0,0,0,0,0,0,220,220,220,220,220,
+		220,220,220,0,0,230,230,230,230,230,220,220,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,230,230,230,230,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,13568,13568,13568,13568,13568,
+		13568,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,230,230,230,0,0,0,0,0,0,0,0,0,0,0,
+		9216,9216,9216,9216,9216,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,9216,9216,
+		0,0,9216,0,0,9216,9216,0,0,9216,9216,9216,9216,0,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,9216,0,9216,9216,9216,
+		9216,9216,9216,9216,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,0,9216,9216,9216,9216,0,0,9216,9216,9216,
+		9216,9216,9216,9216,9216,0,9216,9216,9216,9216,9216,9216,9216,0,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,9216,9216,9216,9216,0,
+		9216,9216,9216,9216,9216,0,9216,0,0,0,9216,9216,9216,9216,9216,9216,
+		9216,0,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,0,0,9216,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,0,9216,9216,
+		230,230,230,230,230,230,230,0,230,230,230,230,230,230,230,230,
+		230,230,230,230,230,230,230,230,230,0,0,230,230,230,230,230,
+		230,230,0,230,230,0,230,230,230,230,230,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,
+		220,220,220,220,220,220,220,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,230,230,230,230,230,230,7,0,0,0,0,0,
+		0,9216,9216,0,9216,0,0,9216,0,9216,9216,9216,9216,9216,9216,9216,
+		9216,9216,9216,0,9216,9216,9216,9216,0,9216,0,9216,0,0,0,0,
+		0,0,9216,0,0,0,0,9216,0,9216,0,9216,0,9216,9216,9216,
+		0,9216,9216,0,9216,0,0,9216,0,9216,0,9216,0,9216,0,9216,
+		0,9216,9216,0,9216,0,0,9216,9216,9216,9216,0,9216,9216,9216,9216,
+		9216,9216,9216,0,9216,9216,9216,9216,0,9216,9216,9216,9216,0,9216,0,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,9216,9216,9216,9216,9216,
+		9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,9216,0,0,0,0,
+		0,9216,9216,9216,0,9216,9216,9216,9216,9216,0,9216,9216,9216,9216,9216,
+		0,0,0,0,0,0,0,0,0,0,9216,9216,9216,0,0,0,
+		9216,9216,9216,0,0,0,0,0,0,0,0,0,0,0,0,0
+	};
+
+	template<class T> const boost::uint8_t normalization_data<T>::decomposition_offset_stage1[763] = {
+		0,1,2,3,4,5,6,7,7,8,9,10,11,12,13,14,
+		15,7,7,7,7,7,7,7,7,7,7,16,7,17,18,19,
+		20,21,22,23,24,7,7,7,7,7,25,7,26,27,28,29,
+		30,31,32,33,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,34,35,7,7,7,36,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,37,38,39,40,41,42,43,
+		7,7,7,7,7,7,7,44,7,7,7,7,7,7,7,7,
+		45,46,7,47,48,49,7,7,7,50,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,51,7,7,52,53,54,55,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,56,7,
+		7,57,58,7,7,7,7,7,7,7,7,59,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+		7,7,7,7,7,7,7,7,60,61,62
+	};
+
+	template<class T> const boost::uint16_t normalization_data<T>::decomposition_offset_stage2[1008] = {
+		0,0,0,0,0,0,0,0,0,0,1,2,3,4,5,6,
+		7,8,9,10,11,12,13,14,0,0,15,16,17,18,19,20,
+		21,22,23,24,0,0,0,0,0,0,0,25,0,26,27,0,
+		0,0,0,0,28,0,0,29,30,31,32,33,34,35,0,36,
+		37,38,0,39,0,40,0,41,0,0,0,0,42,43,44,45,
+		0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,
+		0,0,47,0,0,0,0,48,0,0,0,0,49,50,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,51,52,0,53,0,0,0,0,0,0,54,55,0,0,
+		0,0,0,56,0,57,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,58,59,0,0,0,60,0,0,61,0,0,0,
+		0,0,0,0,62,0,0,0,0,0,0,0,63,0,0,0,
+		0,0,0,0,64,0,0,0,0,0,0,0,0,65,0,0,
+		0,0,0,66,0,0,0,0,0,0,0,67,0,68,0,0,
+		69,0,0,0,70,71,72,73,74,75,76,77,0,0,0,0,
+		0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,79,
+		80,81,0,82,83,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,84,85,86,87,88,89,0,90,91,92,0,0,0,0,
+		93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,
+		109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,
+		125,126,127,128,129,130,0,131,132,133,134,0,0,0,0,0,
+		135,136,137,138,139,140,141,142,143,144,145,0,146,0,0,0,
+		147,0,148,149,150,0,151,152,153,0,154,0,0,0,155,0,
+		0,0,156,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,157,158,159,160,161,162,163,164,165,0,
+		166,0,0,0,0,0,0,167,0,0,0,0,0,168,0,0,
+		0,0,0,0,0,0,0,169,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,170,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,171,0,0,0,0,0,172,
+		173,174,175,176,177,178,179,180,181,182,183,184,185,186,0,0,
+		187,0,0,188,189,190,191,192,0,193,194,195,196,197,0,198,
+		0,0,0,199,200,201,202,203,204,205,0,0,0,0,0,0,
+		206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,
+		222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,
+		0,0,0,0,0,0,0,0,0,238,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,239,0,0,0,0,0,0,0,240,
+		0,0,0,0,0,241,242,0,0,0,0,0,0,0,0,0,
+		243,244,245,246,247,248,249,250,251,252,253,254,255,256,257,258,
+		259,260,261,262,263,264,265,266,267,268,269,270,271,272,0,0,
+		273,274,275,276,277,278,279,280,281,282,283,284,0,285,286,287,
+		288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,
+		304,305,306,307,0,308,309,310,311,312,313,314,315,0,0,316,
+		0,317,0,318,319,320,321,322,323,324,325,326,327,328,329,330,
+		331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,0,
+		0,0,0,0,0,0,0,0,346,347,348,349,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,350,351,0,0,0,0,0,
+		0,0,352,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,353,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,354,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,355,0,0,0,0,
+		0,0,0,356,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,357,358,0,0,0,0,359,360,0,0,0,
+		361,362,363,364,365,366,367,368,369,370,371,372,373,361,362,363,
+		374,375,376,377,378,379,380,381,382,383,361,362,363,364,365,376,
+		367,368,369,380,381,382,383,361,362,363,384,385,386,387,388,389,
+		390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,
+		406,407,408,409,410,411,412,413,414,415,416,415,0,0,0,0,
+		417,418,419,361,420,0,421,0,0,422,0,0,0,0,0,0,
+		423,424,425,426,427,428,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,429,
+		430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,
+		446,447,448,449,450,451,452,453,454,455,456,457,458,459,460,461,
+		462,463,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+	};
+
+	template<class T> const boost::uint16_t normalization_data<T>::decomposition_offset_stage3[7424] = {
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		1,0,0,0,0,0,0,0,3,0,6,0,0,0,0,8,
+		0,0,11,13,15,18,0,0,20,23,25,0,27,31,35,0,
+		39,42,45,48,51,54,0,57,60,63,66,69,72,75,78,81,
+		0,84,87,90,93,96,99,0,0,102,105,108,111,114,0,0,
+		117,120,123,126,129,132,0,135,138,141,144,147,150,153,156,159,
+		0,162,165,168,171,174,177,0,0,180,183,186,189,192,0,195,
+		198,201,204,207,210,213,216,219,222,225,228,231,234,237,240,243,
+		0,0,246,249,252,255,258,261,264,267,270,273,276,279,282,285,
+		288,291,294,297,300,303,0,0,306,309,312,315,318,321,324,327,
+		330,0,333,336,339,342,345,348,0,351,354,357,360,363,366,369,
+		372,0,0,375,378,381,384,387,390,393,0,0,396,399,402,405,
+		408,411,0,0,414,417,420,423,426,429,432,435,438,441,444,447,
+		450,453,456,459,462,465,0,0,468,471,474,477,480,483,486,489,
+		492,495,498,501,504,507,510,513,516,519,522,525,528,531,534,537,
+		539,542,0,0,0,0,0,0,0,0,0,0,0,0,0,545,
+		548,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,551,555,559,563,566,569,572,575,578,581,584,587,
+		590,593,596,599,602,605,609,613,617,621,625,629,633,0,637,641,
+		645,649,653,656,0,0,659,662,665,668,671,674,677,681,685,688,
+		691,694,697,700,703,706,0,0,709,712,715,719,723,726,729,732,
+		735,738,741,744,747,750,753,756,759,762,765,768,771,774,777,780,
+		783,786,789,792,795,798,801,804,807,810,813,816,0,0,819,822,
+		0,0,0,0,0,0,825,828,831,834,837,841,845,849,853,856,
+		859,863,867,870,0,0,0,0,0,0,0,0,0,0,0,0,
+		873,875,877,879,881,883,885,887,889,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,891,894,897,900,903,906,0,0,
+		909,911,537,913,915,0,0,0,0,0,0,0,0,0,0,0,
+		917,919,0,921,923,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,926,0,0,0,0,0,928,0,0,0,931,0,
+		0,0,0,0,15,933,940,943,945,948,951,0,954,0,957,960,
+		963,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,967,970,973,976,979,982,
+		985,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,989,992,995,998,1001,0,
+		1004,1006,1008,1010,1016,1022,1024,0,0,0,0,0,0,0,0,0,
+		1026,1028,1030,0,1032,1034,0,0,0,1036,0,0,0,0,0,0,
+		1038,1041,0,1044,0,0,0,1047,0,0,0,0,1050,1053,1056,0,
+		0,0,0,0,0,0,0,0,0,1059,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,1062,0,0,0,0,0,0,
+		1065,1068,0,1071,0,0,0,1074,0,0,0,0,1077,1080,1083,0,
+		0,0,0,0,0,0,1086,1089,0,0,0,0,0,0,0,0,
+		0,1092,1095,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		1098,1101,1104,1107,0,0,1110,1113,0,0,1116,1119,1122,1125,1128,1131,
+		0,0,1134,1137,1140,1143,1146,1149,0,0,1152,1155,1158,1161,1164,1167,
+		1170,1173,1176,1179,1182,1185,0,0,1188,1191,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,1194,0,0,0,0,0,0,0,0,
+		0,0,1197,1200,1203,1206,1209,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,1212,1215,1218,1221,0,0,0,0,0,0,0,
+		1224,0,1227,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,1230,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,1233,0,0,0,0,0,0,
+		0,1236,0,0,1239,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,1242,1245,1248,1251,1254,1257,1260,1263,
+		0,0,0,0,0,0,0,0,0,0,0,1266,1269,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,1272,1275,0,1278,
+		0,0,0,1281,0,0,1284,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,1287,1290,1293,0,0,1296,0,
+		0,0,0,0,0,0,0,0,1299,0,0,1302,1305,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,1308,1311,0,0,
+		0,0,0,0,1314,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,1317,1320,1323,0,0,0,
+		0,0,0,0,0,0,0,0,1326,0,0,0,0,0,0,0,
+		1329,0,0,0,0,0,0,1332,1335,0,1338,1341,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,1345,1348,1351,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,1354,0,1357,1360,1364,0,
+		0,0,0,1367,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,1370,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,1373,1376,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,1379,0,0,0,
+		0,0,0,1381,0,0,0,0,0,0,0,0,0,1384,0,0,
+		0,0,1387,0,0,0,0,1390,0,0,0,0,1393,0,0,0,
+		0,0,0,0,0,0,0,0,0,1396,0,0,0,0,0,0,
+		0,0,0,1399,0,1402,1405,1408,1412,1415,0,0,0,0,0,0,
+		0,1419,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,1422,0,0,0,0,0,0,0,0,0,1425,0,0,
+		0,0,1428,0,0,0,0,1431,0,0,0,0,1434,0,0,0,
+		0,0,0,0,0,0,0,0,0,1437,0,0,0,0,0,0,
+		0,0,0,0,0,0,1440,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,1443,0,0,0,
+		0,0,0,0,0,0,1445,0,1448,0,1451,0,1454,0,1457,0,
+		0,0,1460,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,1463,0,1466,0,0,
+		1469,1472,0,1475,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,1478,1480,1482,0,
+		1484,1486,1488,1490,1492,1494,1496,1498,1500,1502,1504,0,1506,1508,1510,1512,
+		1514,1516,1518,6,1520,1522,1524,1526,1528,1530,1532,1534,1536,1538,0,1540,
+		1542,1544,25,1546,1548,1550,1552,1554,1556,1558,1560,1562,1564,1004,1566,1568,
+		1022,1570,1572,879,1556,1562,1004,1566,1028,1022,1570,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,1574,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,1576,1578,1580,1582,1536,
+		1584,1586,1588,1590,1592,1594,1596,1598,1600,1602,1604,1606,1608,1610,1612,1614,
+		1616,1618,1620,1622,1624,1626,1628,1630,1632,1634,1636,1638,1640,1642,1644,1006,
+		1646,1649,1652,1655,1658,1661,1664,1667,1670,1674,1678,1681,1684,1687,1690,1693,
+		1696,1699,1702,1705,1708,1712,1716,1720,1724,1727,1730,1733,1736,1740,1744,1747,
+		1750,1753,1756,1759,1762,1765,1768,1771,1774,1777,1780,1783,1786,1789,1792,1796,
+		1800,1803,1806,1809,1812,1815,1818,1821,1824,1828,1832,1835,1838,1841,1844,1847,
+		1850,1853,1856,1859,1862,1865,1868,1871,1874,1877,1880,1883,1886,1890,1894,1898,
+		1902,1906,1910,1914,1918,1921,1924,1927,1930,1933,1936,1939,1942,1946,1950,1953,
+		1956,1959,1962,1965,1968,1972,1976,1980,1984,1988,1992,1995,1998,2001,2004,2007,
+		2010,2013,2016,2019,2022,2025,2028,2031,2034,2038,2042,2046,2050,2053,2056,2059,
+		2062,2065,2068,2071,2074,2077,2080,2083,2086,2089,2092,2095,2098,2101,2104,2107,
+		2110,2113,2116,2119,2122,2125,2128,2131,2134,2137,2140,2143,0,0,0,0,
+		2149,2152,2155,2158,2161,2165,2169,2173,2177,2181,2185,2189,2193,2197,2201,2205,
+		2209,2213,2217,2221,2225,2229,2233,2237,2241,2244,2247,2250,2253,2256,2259,2263,
+		2267,2271,2275,2279,2283,2287,2291,2295,2299,2302,2305,2308,2311,2314,2317,2320,
+		2323,2327,2331,2335,2339,2343,2347,2351,2355,2359,2363,2367,2371,2375,2379,2383,
+		2387,2391,2395,2399,2403,2406,2409,2412,2415,2419,2423,2427,2431,2435,2439,2443,
+		2447,2451,2455,2458,2461,2464,2467,2470,2473,2476,0,0,0,0,0,0,
+		2479,2482,2485,2489,2493,2497,2501,2505,2509,2512,2515,2519,2523,2527,2531,2535,
+		2539,2542,2545,2549,2553,2557,0,0,2561,2564,2567,2571,2575,2579,0,0,
+		2583,2586,2589,2593,2597,2601,2605,2609,2613,2616,2619,2623,2627,2631,2635,2639,
+		2643,2646,2649,2653,2657,2661,2665,2669,2673,2676,2679,2683,2687,2691,2695,2699,
+		2703,2706,2709,2713,2717,2721,0,0,2725,2728,2731,2735,2739,2743,0,0,
+		2747,2750,2753,2757,2761,2765,2769,2773,0,2777,0,2780,0,2784,0,2788,
+		2792,2795,2798,2802,2806,2810,2814,2818,2822,2825,2828,2832,2836,2840,2844,2848,
+		2852,973,2855,976,2858,979,2861,982,2864,995,2867,998,2870,1001,0,0,
+		2873,2877,2881,2886,2891,2896,2901,2906,2911,2915,2919,2924,2929,2934,2939,2944,
+		2949,2953,2957,2962,2967,2972,2977,2982,2987,2991,2995,3000,3005,3010,3015,3020,
+		3025,3029,3033,3038,3043,3048,3053,3058,3063,3067,3071,3076,3081,3086,3091,3096,
+		3101,3104,3107,3111,3114,0,3118,3121,3125,3128,3131,940,3134,3137,3140,3137,
+		3142,3145,3152,3156,3159,0,3163,3166,3170,945,3173,948,3176,3179,3186,3193,
+		3200,3203,3206,963,0,0,3210,3213,3217,3220,3223,951,0,3226,3233,3240,
+		3247,3250,3253,985,3257,3260,3263,3266,3270,3273,3276,957,3279,3282,933,3289,
+		0,0,3291,3295,3298,0,3302,3305,3309,954,3312,960,3315,3318,3323,0,
+		3326,3330,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+		0,3334,0,0,0,0,0,3336,0,0,0,0,0,0,0,0,
+		0,0,0,0,3339,3341,3344,0,0,0,0,0,0,0,0,1,
+		0,0,0,3348,3351,0,3355,3358,0,0,0,0,3362,0,3365,0,
+		0,0,0,0,0,0,0,3368,3371,3374,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,3377,0,0,0,0,0,0,0,1,
+		3382,1572,0,0,3384,3386,3388,3390,3392,3394,3396,3398,3400,3402,3404,3406,
+		3382,23,11,13,3384,3386,3388,3390,3392,3394,3396,3398,3400,3402,3404,0,
+		6,1530,25,913,1532,873,1540,911,1542,3406,1552,537,1554,0,0,0,
+		0,0,0,0,0,0,0,0,3408,0,0,0,0,0,0,0,
+		3411,3415,3419,3421,0,3424,3428,3432,0,3434,1538,1492,1492,1492,873,3437,
+		1494,1494,1500,911,0,1504,3439,0,0,1510,3442,1512,1512,1512,0,0,
+		3444,3447,3451,0,3454,0,3456,0,3454,0,3458,54,1482,3419,0,1530,
+		1486,3460,0,1502,25,3462,3464,3466,3468,1572,0,3470,1024,1566,3474,3476,
+		3478,0,0,0,0,1484,1528,1530,1572,877,0,0,0,0,0,0,
+		3480,3484,3488,3493,3497,3501,3505,3509,3513,3517,3521,3525,3529,3533,3537,3541,
+		1494,3544,3547,3551,3554,3556,3559,3563,3568,3571,3573,3576,1500,3419,1484,1502,
+		1572,3580,3583,3587,1562,3590,3593,3597,3602,913,3605,3608,911,1578,1528,1542,
+		0,0,0,0,0,0,0,0,0,3612,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,3616,3619,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,3622,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,3625,3628,3631,
+		0,0,0,0,3634,0,0,0,0,3637,0,0,3640,0,0,0,
+		0,0,0,0,3643,0,3646,0,0,0,0,0,3649,3652,0,3656,
+		3659,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,3663,0,0,3666,0,0,3669,0,3672,0,0,0,0,0,0,
+		3675,0,3678,0,0,0,0,0,0,0,0,0,0,3681,3684,3687,
+		3690,3693,0,0,3696,3699,0,0,3702,3705,0,0,0,0,0,0,
+		3708,3711,0,0,3714,3717,0,0,3720,3723,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,3726,3729,3732,3735,
+		3738,3741,3744,3747,0,0,0,0,0,0,3750,3753,3756,3759,0,0,
+		0,0,0,0,0,0,0,0,0,3762,3764,0,0,0,0,0,
+		23,11,13,3384,3386,3388,3390,3392,3394,3766,3769,3772,3775,3778,3781,3784,
+		3787,3790,3793,3796,3799,3803,3807,3811,3815,3819,3823,3827,3831,3835,3840,3845,
+		3850,3855,3860,3865,3870,3875,3880,3885,3890,3893,3896,3899,3902,3905,3908,3911,
+		3914,3917,3921,3925,3929,3933,3937,3941,3945,3949,3953,3957,3961,3965,3969,3973,
+		3977,3981,3985,3989,3993,3997,4001,4005,4009,4013,4017,4021,4025,4029,4033,4037,
+		4041,4045,4049,4053,4057,4061,1478,1482,3419,1484,1486,3460,1490,1492,1494,1496,
+		1498,1500,1502,1504,1506,1510,3442,1512,4065,1514,1516,3554,1518,3571,4067,3454,
+		6,1526,1578,1528,1530,1584,1538,873,1572,877,1540,911,1542,3406,25,1552,
+		4069,879,537,1554,1556,1562,887,913,889,1638,3382,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,4071,0,0,0,
+		0,0,0,0,4076,4080,4083,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,4087,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,877,3554,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4090,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4092,
+		0,0,0,4094,0,0,0,0,0,0,0,0,0,0,0,0,
+		4096,4098,4100,4102,4104,4106,4108,4110,4112,4114,4116,4118,4120,4122,4124,4126,
+		4128,4130,4132,4134,4136,4138,4140,4142,4144,4146,4148,4150,4152,4154,4156,4158,
+		4160,4162,4164,4166,4168,4170,4172,4174,4176,4178,4180,4182,4184,4186,4188,4190,
+		4192,4194,4196,4198,4200,4202,4204,4206,4208,4210,4212,4214,4216,4218,4220,4222,
+		4224,4226,4228,4230,4232,4234,4236,4238,4240,4242,4244,4246,4248,4250,4252,4254,
+		4256,4258,4260,4262,4264,4266,4268,4270,4272,4274,4276,4278,4280,4282,4284,4286,
+		4288,4290,4292,4294,4296,4298,4300,4302,4304,4306,4308,4310,4312,4314,4316,4318,
+		4320,4322,4324,4326,4328,4330,4332,4334,4336,4338,4340,4342,4344,4346,4348,4350,
+		4352,4354,4356,4358,4360,4362,4364,4366,4368,4370,4372,4374,4376,4378,4380,4382,
+		4384,4386,4388,4390,4392,4394,4396,4398,4400,4402,4404,4406,4408,4410,4412,4414,
+		4416,4418,4420,4422,4424,4426,4428,4430,4432,4434,4436,4438,4440,4442,4444,4446,
+		4448,4450,4452,4454,4456,4458,4460,4462,4464,4466,4468,4470,4472,4474,4476,4478,
+		4480,4482,4484,4486,4488,4490,4492,4494,4496,4498,4500,4502,4504,4506,4508,4510,
+		4512,4514,4516,4518,4520,4522,0,0,0,0,0,0,0,0,0,0,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,4524,0,4142,4526,4528,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,4530,0,4533,0,
+		4536,0,4539,0,4542,0,4545,0,4548,0,4551,0,4554,0,4557,0,
+		4560,0,4563,0,0,4566,0,4569,0,4572,0,0,0,0,0,0,
+		4575,4578,0,4581,4584,0,4587,4590,0,4593,4596,0,4599,4602,0,0,
+		0,0,0,0,4605,0,0,0,0,0,0,4608,4611,0,4614,4617,
+		0,0,0,0,0,0,0,0,0,0,0,0,4620,0,4623,0,
+		4626,0,4629,0,4632,0,4635,0,4638,0,4641,0,4644,0,4647,0,
+		4650,0,4653,0,0,4656,0,4659,0,4662,0,0,0,0,0,0,
+		4665,4668,0,4671,4674,0,4677,4680,0,4683,4686,0,4689,4692,0,0,
+		0,0,0,0,4695,0,0,4698,4701,4704,4707,0,0,0,4710,4713,
+		0,4716,4718,4720,4722,4724,4726,4728,4730,4732,4734,4736,4738,4740,4742,4744,
+		4746,4748,4750,4752,4754,4756,4758,4760,4762,4764,4766,4768,4770,4772,4774,4776,
+		4778,4780,4782,4784,4786,4788,4790,4792,4794,4796,4798,4800,4802,4804,4806,4808,
+		4810,4812,4814,4816,4818,4820,4822,4824,4826,4828,4830,4832,4834,4836,4838,4840,
+		4842,4844,4846,4848,4850,4852,4854,4856,4858,4860,4862,4864,4866,4868,4870,4872,
+		4874,4876,4878,4880,4882,4884,4886,4888,4890,4892,4894,4896,4898,4900,4902,0,
+		0,0,4096,4108,4904,4906,4908,4910,4912,4914,4104,4916,4918,4920,4922,4112,
+		4924,4928,4932,4936,4940,4944,4948,4952,4956,4960,4964,4968,4972,4976,4980,4985,
+		4990,4995,5000,5005,5010,5015,5020,5025,5030,5035,5040,5045,5050,5055,5063,0,
+		5070,5074,5078,5082,5086,5090,5094,5098,5102,5106,5110,5114,5118,5122,5126,5130,
+		5134,5138,5142,5146,5150,5154,5158,5162,5166,5170,5174,5178,5182,5186,5190,5194,
+		5198,5202,5206,5210,5214,5216,4228,5218,0,0,0,0,0,0,0,0,
+		5220,5224,5227,5230,5233,5236,5239,5242,5245,5248,5251,5254,5257,5260,5263,5266,
+		4716,4722,4728,4732,4748,4750,4756,4760,4762,4766,4768,4770,4772,4774,5269,5272,
+		5275,5278,5281,5284,5287,5290,5293,5296,5299,5302,5305,5308,5311,5317,5322,0,
+		4096,4108,4904,4906,5325,5327,5329,4118,5331,4142,4242,4266,4264,4244,4428,4158,
+		4238,5333,5335,5337,5339,5341,5343,5345,5347,5349,5351,4170,5353,5355,5357,5359,
+		5361,5363,5365,5367,4908,4910,4912,5369,5371,5373,5375,5377,5379,5381,5383,5385,
+		5387,5389,5392,5395,5398,5401,5404,5407,5410,5413,5416,5419,5422,5425,5428,5431,
+		5434,5437,5440,5443,5446,5449,5452,5455,5458,5461,5465,5469,5473,5476,5480,5483,
+		5487,5489,5491,5493,5495,5497,5499,5501,5503,5505,5507,5509,5511,5513,5515,5517,
+		5519,5521,5523,5525,5527,5529,5531,5533,5535,5537,5539,5541,5543,5545,5547,5549,
+		5551,5553,5555,5557,5559,5561,5563,5565,5567,5569,5571,5573,5575,5577,5579,5581,
+		5584,5590,5595,5601,5605,5611,5615,5619,5626,5631,5635,5639,5643,5648,5653,5658,
+		5663,5668,5673,5678,5685,5688,5695,5702,5708,5713,5720,5727,5732,5736,5740,5745,
+		5750,5756,5762,5766,5770,5775,5779,5783,5786,5789,5793,5797,5804,5809,5815,5822,
+		5827,5831,5835,5842,5847,5854,5858,5864,5868,5873,5877,5882,5888,5893,5899,5904,
+		5907,5913,5917,5921,5926,5930,5934,5938,5944,5949,5952,5959,5963,5969,5974,5979,
+		5983,5987,5992,5995,6000,6006,6009,6016,6020,6023,6026,6029,6032,6035,6038,6041,
+		6044,6047,6050,6054,6058,6062,6066,6070,6074,6078,6082,6086,6090,6094,6098,6102,
+		6106,6110,6114,6117,6120,6124,6127,6130,6133,6137,6141,6144,6147,6150,6153,6156,
+		6161,6164,6167,6170,6173,6176,6179,6182,6185,6189,6194,6197,6200,6203,6206,6209,
+		6212,6215,6219,6223,6227,6231,6234,6237,6240,6243,6246,6249,6252,6255,6258,6261,
+		6265,6269,6272,6276,6280,6284,6287,6291,6295,6300,6303,6307,6311,6315,6319,6325,
+		6332,6335,6338,6341,6344,6347,6350,6353,6356,6359,6362,6365,6368,6371,6374,6377,
+		6380,6383,6386,6391,6394,6397,6400,6405,6409,6412,6415,6418,6421,6424,6427,6430,
+		6433,6436,6439,6443,6446,6449,6453,6457,6460,6465,6469,6472,6475,6478,6481,6485,
+		6489,6492,6495,6498,6501,6504,6507,6510,6513,6516,6520,6524,6528,6532,6536,6540,
+		6544,6548,6552,6556,6560,6564,6568,6572,6576,6580,6584,6588,6592,6596,6600,6604,
+		0,0,0,0,0,0,0,0,0,0,0,0,6608,6610,0,0,
+		6612,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,3419,3460,3442,0,0,0,6614,6616,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,6618,6620,6622,6624,
+		0,0,0,0,0,0,0,0,0,6626,0,0,0,0,0,0,
+		6628,6630,6632,6634,6636,6638,6640,6642,6642,6644,6646,6648,6650,6652,6654,6656,
+		6658,6660,6662,6664,6666,6668,6670,6672,6674,6676,6678,6680,6682,6684,6686,6688,
+		6690,6692,6694,6696,6698,6700,6702,6704,6706,6708,6710,6712,6714,6716,6718,6720,
+		6722,6724,6726,6728,6730,6732,6734,6736,6738,6740,6742,6744,6746,6748,6750,6752,
+		6754,6756,6758,6760,6762,6764,6766,6768,6770,6772,6774,6776,6778,6780,6782,6784,
+		6786,6788,6790,6792,6794,6796,6798,6800,6802,6804,6806,6808,6666,6810,6812,6814,
+		6816,6818,6820,6822,6824,6826,6828,6830,6832,6834,6836,6838,6840,6842,6844,6846,
+		6848,6850,6852,6854,6856,6858,6860,6862,6864,6866,6868,6870,6872,6874,6876,6878,
+		6880,6882,6884,6886,6888,6890,6892,6894,6896,6898,6900,6902,6904,6906,6908,6910,
+		6912,6914,6916,6918,6920,6922,6924,6926,6928,6930,6932,6934,6936,6938,6940,6942,
+		6944,6846,6946,6948,6950,6952,6954,6956,6958,6960,6814,6962,6964,6966,6968,6970,
+		6972,6974,6976,6978,6980,6982,6984,6986,6988,6990,6992,6994,6996,6998,7000,6666,
+		7002,7004,7006,7008,7010,7012,7014,7016,7018,7020,7022,7024,7026,7028,7030,7032,
+		7034,7036,7038,7040,7042,7044,7046,7048,7050,7052,7054,6818,7056,7058,7060,7062,
+		7064,7066,7068,7070,7072,7074,7076,7078,7080,7082,7084,7086,7088,7090,7092,7094,
+		7096,7098,7100,7102,7104,7106,7108,7110,7112,7114,7116,7118,7120,7122,7124,7126,
+		7128,7130,7132,7134,7136,7138,7140,7142,7144,7146,7148,7150,7152,7154,0,0,
+		7156,0,7158,0,0,7160,7162,7164,7166,7168,7170,7172,7174,7176,7178,0,
+		7180,0,7182,0,0,7184,7186,0,0,0,7188,7190,7192,7194,7196,7198,
+		7200,7202,7204,7206,7208,7210,7212,7214,7216,7218,7220,7222,7224,7226,7228,7230,
+		7232,7234,7236,7238,7240,7242,7244,7246,7248,7250,7252,7254,7256,7258,7260,7262,
+		7264,7266,7268,7270,7272,7274,7276,6924,7278,7280,7282,7284,7286,7288,7288,7290,
+		7292,7294,7296,7298,7300,7302,7304,7184,7306,7308,7310,7312,7314,7317,0,0,
+		7319,7321,7323,7325,7327,7329,7331,7333,7212,7335,7337,7339,7156,7341,7343,7345,
+		7347,7349,7351,7353,7355,7357,7359,7361,7363,7230,7365,7232,7367,7369,7371,7373,
+		7375,7158,6708,7377,7379,7381,6848,7022,7383,7385,7246,7387,7248,7389,7391,7393,
+		7162,7395,7397,7399,7401,7403,7164,7405,7407,7409,7411,7413,7415,7276,7417,7419,
+		6924,7421,7284,7423,7425,7427,7429,7431,7294,7433,7182,7435,7296,6810,7437,7298,
+		7439,7302,7441,7443,7445,7447,7449,7306,7174,7451,7308,7453,7310,7455,6642,7457,
+		7460,7463,7466,7468,7470,7472,7475,7478,7481,7483,0,0,0,0,0,0,
+		7485,7488,7491,7494,7498,7502,7502,0,0,0,0,0,0,0,0,0,
+		0,0,0,7505,7508,7511,7514,7517,0,0,0,0,0,7520,0,7523,
+		7526,3462,3468,7528,7530,7532,7534,7536,7538,3396,7540,7543,7546,7550,7554,7557,
+		7560,7563,7566,7569,7572,7575,7578,0,7581,7584,7587,7590,7593,0,7596,0,
+		7599,7602,0,7605,7608,0,7611,7614,7617,7620,7623,7626,7629,7632,7635,7638,
+		7641,7641,7643,7643,7643,7643,7645,7645,7645,7645,7647,7647,7647,7647,7649,7649,
+		7649,7649,7651,7651,7651,7651,7653,7653,7653,7653,7655,7655,7655,7655,7657,7657,
+		7657,7657,7659,7659,7659,7659,7661,7661,7661,7661,7663,7663,7663,7663,7665,7665,
+		7665,7665,7667,7667,7669,7669,7671,7671,7673,7673,7675,7675,7677,7677,7679,7679,
+		7679,7679,7681,7681,7681,7681,7683,7683,7683,7683,7685,7685,7685,7685,7687,7687,
+		7689,7689,7689,7689,7691,7691,7694,7694,7694,7694,7696,7696,7696,7696,7698,7698,
+		7700,7700,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,7703,7703,7703,7703,7705,7705,7707,7707,7709,7709,1218,7711,7711,
+		7713,7713,7715,7715,7717,7717,7717,7717,7719,7719,7721,7721,7725,7725,7729,7729,
+		7733,7733,7737,7737,7741,7741,7745,7745,7745,7749,7749,7749,7753,7753,7753,7753,
+		7755,7759,7763,7749,7767,7771,7774,7777,7780,7783,7786,7789,7792,7795,7798,7801,
+		7804,7807,7810,7813,7816,7819,7822,7825,7828,7831,7834,7837,7840,7843,7846,7849,
+		7852,7855,7858,7861,7864,7867,7870,7873,7876,7879,7882,7885,7888,7891,7894,7897,
+		7900,7903,7906,7909,7912,7915,7918,7921,7924,7927,7930,7933,7936,7939,7942,7945,
+		7948,7951,7954,7957,7960,7963,7966,7969,7972,7975,7978,7981,7984,7987,7990,7993,
+		7996,7999,8002,8005,8008,8011,8014,8017,8020,8023,8026,8029,8032,8035,8038,8042,
+		8046,8050,8054,8058,8062,8066,7763,8070,7749,7767,8074,8077,7780,8080,7783,7786,
+		8083,8086,7798,8089,7801,7804,8092,8095,7810,8098,7813,7816,7903,7906,7915,7918,
+		7921,7933,7936,7939,7942,7954,7957,7960,8101,7972,8104,8107,7990,8110,7993,7996,
+		8035,8113,8116,8020,8119,8023,8026,7755,7759,8122,7763,8126,7771,7774,7777,7780,
+		8130,7789,7792,7795,7798,8133,7810,7819,7822,7825,7828,7831,7837,7840,7843,7846,
+		7849,7852,8136,7855,7858,7861,7864,7867,7870,7876,7879,7882,7885,7888,7891,7894,
+		7897,7900,7909,7912,7924,7927,7930,7933,7936,7945,7948,7951,7954,8139,7963,7966,
+		7969,7972,7981,7984,7987,7990,8142,7999,8002,8145,8011,8014,8017,8020,8148,7763,
+		8126,7780,8130,7798,8133,7810,8151,7849,8154,8157,8160,7933,7936,7954,7990,8142,
+		8020,8148,8163,8167,8171,8175,8178,8181,8184,8187,8190,8193,8196,8199,8202,8205,
+		8208,8211,8214,8217,8220,8223,8226,8229,8232,8235,8238,8241,8157,8244,8247,8250,
+		8253,8175,8178,8181,8184,8187,8190,8193,8196,8199,8202,8205,8208,8211,8214,8217,
+		8220,8223,8226,8229,8232,8235,8238,8241,8157,8244,8247,8250,8253,8235,8238,8241,
+		8157,8154,8160,7873,7840,7843,7846,8235,8238,8241,7873,7876,8256,8256,0,0,
+		8259,8263,8263,8267,8271,8275,8279,8283,8287,8287,8291,8295,8299,8303,8307,8311,
+		8311,8315,8319,8319,8323,8323,8327,8331,8331,8335,8339,8339,8343,8343,8347,8351,
+		8351,8355,8355,8359,8363,8367,8371,8371,8375,8379,8383,8387,8391,8391,8395,8399,
+		8403,8407,8411,8415,8415,8419,8419,8423,8423,8427,8431,8435,8439,8443,8447,8451,
+		0,0,8455,8459,8463,8467,8471,8475,8475,8479,8483,8487,8491,8491,8495,8499,
+		8503,8507,8511,8515,8519,8523,8527,8531,8535,8539,8543,8547,8551,8555,8559,8563,
+		8567,8571,8575,8579,8395,8403,8583,8587,8591,8595,8599,8603,8599,8591,8607,8611,
+		8615,8619,8623,8603,8367,8327,8627,8631,0,0,0,0,0,0,0,0,
+		8635,8639,8643,8648,8653,8658,8663,8668,8673,8678,8682,8701,8710,0,0,0,
+		8715,8717,8719,8721,8723,8725,8727,8729,8731,3344,0,0,0,0,0,0,
+		3341,8733,8735,8737,8737,3402,3404,8739,8741,8743,8745,8747,8749,8751,8753,8755,
+		8757,8759,8761,8763,8765,0,0,8767,8769,3365,3365,3365,3365,8737,8737,8737,
+		8715,8717,3339,0,8723,8721,8727,8725,8733,3402,3404,8739,8741,8743,8745,8771,
+		8773,8775,3396,8777,8779,8781,3400,0,8783,8785,8787,8789,0,0,0,0,
+		8791,8794,8797,0,8800,0,8803,8806,8809,8812,8815,8818,8821,8824,8827,8830,
+		8833,8835,8835,8838,8838,8841,8841,8844,8844,8847,8847,8847,8847,8850,8850,8852,
+		8852,8852,8852,8854,8854,8856,8856,8856,8856,8858,8858,8858,8858,8860,8860,8860,
+		8860,8862,8862,8862,8862,8864,8864,8864,8864,8866,8866,8868,8868,8870,8870,8872,
+		8872,8874,8874,8874,8874,8876,8876,8876,8876,8878,8878,8878,8878,8880,8880,8880,
+		8880,8882,8882,8882,8882,8884,8884,8884,8884,8886,8886,8886,8886,8888,8888,8888,
+		8888,8890,8890,8890,8890,8892,8892,8892,8892,8894,8894,8894,8894,8896,8896,8896,
+		8896,8898,8898,8898,8898,8900,8900,8900,8900,8902,8902,8902,8902,8904,8904,7719,
+		7719,8906,8906,8906,8906,8908,8908,8912,8912,8916,8916,8920,8920,0,0,0,
+		0,8725,8923,8771,8785,8787,8773,8925,3402,3404,8775,3396,8715,8777,3339,8927,
+		3382,23,11,13,3384,3386,3388,3390,3392,3394,8721,8723,8779,3400,8781,8727,
+		8789,1478,1482,3419,1484,1486,3460,1490,1492,1494,1496,1498,1500,1502,1504,1506,
+		1510,3442,1512,4065,1514,1516,3554,1518,3571,4067,3454,8767,8783,8769,8929,8737,
+		8931,6,1526,1578,1528,1530,1584,1538,873,1572,877,1540,911,1542,3406,25,
+		1552,4069,879,537,1554,1556,1562,887,913,889,1638,8739,8933,8741,8935,8937,
+		8939,8719,8759,8761,8717,8941,5579,8943,8945,8947,8949,8951,8953,8955,8957,8959,
+		8961,5487,5489,5491,5493,5495,5497,5499,5501,5503,5505,5507,5509,5511,5513,5515,
+		5517,5519,5521,5523,5525,5527,5529,5531,5533,5535,5537,5539,5541,5543,5545,5547,
+		5549,5551,5553,5555,5557,5559,5561,5563,5565,5567,5569,5571,5573,8963,8965,8967,
+		4818,4716,4718,4720,4722,4724,4726,4728,4730,4732,4734,4736,4738,4740,4742,4744,
+		4746,4748,4750,4752,4754,4756,4758,4760,4762,4764,4766,4768,4770,4772,4774,0,
+		0,0,4776,4778,4780,4782,4784,4786,0,0,4788,4790,4792,4794,4796,4798,
+		0,0,4800,4802,4804,4806,4808,4810,0,0,4812,4814,4816,0,0,0,
+		8969,8971,8973,8,8975,8977,8979,0,8981,8983,8985,8987,8989,8991,8993,0,
+		0,8995,8997,8999,9001,9003,0,9005,9007,9009,9011,9013,9015,9017,9019,9021,
+		9023,9025,9027,9029,9031,3437,9033,9035,9037,9039,9041,9043,9045,9048,9050,9052,
+		9055,9057,9060,9062,9064,4069,9066,9068,9071,9073,9075,9077,9079,9081,9083,9085,
+		9087,0,9089,9091,9093,9095,9097,9099,9101,9103,9106,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,9109,0,9114,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,9119,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,9124,9129,
+		0,0,0,0,0,0,0,0,0,0,0,9134,9139,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,9144,9149,0,9154,0,
+		0,0,0,0,0,0,0,0,0,0,9159,9164,0,0,0,0,
+		0,0,0,0,0,0,0,0,9169,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,9174,9179,
+		9184,9191,9198,9205,9212,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,9219,9224,9229,9236,9243,
+		9250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		1478,1482,3419,1484,1486,3460,1490,1492,1494,1496,1498,1500,1502,1504,1506,1510,
+		3442,1512,4065,1514,1516,3554,1518,3571,4067,3454,6,1526,1578,1528,1530,1584,
+		1538,873,1572,877,1540,911,1542,3406,25,1552,4069,879,537,1554,1556,1562,
+		887,913,889,1638,1478,1482,3419,1484,1486,3460,1490,1492,1494,1496,1498,1500,
+		1502,1504,1506,1510,3442,1512,4065,1514,1516,3554,1518,3571,4067,3454,6,1526,
+		1578,1528,1530,1584,1538,0,1572,877,1540,911,1542,3406,25,1552,4069,879,
+		537,1554,1556,1562,887,913,889,1638,1478,1482,3419,1484,1486,3460,1490,1492,
+		1494,1496,1498,1500,1502,1504,1506,1510,3442,1512,4065,1514,1516,3554,1518,3571,
+		4067,3454,6,1526,1578,1528,1530,1584,1538,873,1572,877,1540,911,1542,3406,
+		25,1552,4069,879,537,1554,1556,1562,887,913,889,1638,1478,0,3419,1484,
+		0,0,1490,0,0,1496,1498,0,0,1504,1506,1510,3442,0,4065,1514,
+		1516,3554,1518,3571,4067,3454,6,1526,1578,1528,0,1584,0,873,1572,877,
+		1540,911,1542,3406,0,1552,4069,879,537,1554,1556,1562,887,913,889,1638,
+		887,913,889,1638,1478,1482,0,1484,1486,3460,1490,0,0,1496,1498,1500,
+		1502,1504,1506,1510,3442,0,4065,1514,1516,3554,1518,3571,4067,0,6,1526,
+		1578,1528,1530,1584,1538,873,1572,877,1540,911,1542,3406,25,1552,4069,879,
+		537,1554,1556,1562,887,913,889,1638,1478,1482,0,1484,1486,3460,1490,0,
+		1494,1496,1498,1500,1502,0,1506,0,0,0,4065,1514,1516,3554,1518,3571,
+		4067,0,6,1526,1578,1528,1530,1584,1538,873,1572,877,1540,911,1542,3406,
+		25,1552,4069,879,537,1554,1556,1562,887,913,889,1638,1478,1482,3419,1484,
+		1486,3460,1490,1492,1494,1496,1498,1500,1502,1504,1506,1510,3442,1512,4065,1514,
+		1516,3554,1518,3571,4067,3454,6,1526,1578,1528,1530,1584,1538,873,1572,877,
+		1540,911,1542,3406,25,1552,4069,879,537,1554,1556,1562,887,913,889,1638,
+		887,913,889,1638,9257,9259,0,0,9261,9263,3474,9265,9267,9269,9271,1032,
+		9273,9275,9277,9279,9281,9283,9285,3476,9287,1032,1036,9289,1008,9291,9293,9295,
+		9297,9299,9301,1004,1566,1568,1034,9303,9305,1006,9307,1026,9309,18,9311,9313,
+		9315,1024,1028,1030,9317,9319,9321,1022,1570,9323,9325,9327,1034,1006,1026,1022,
+		1028,1024,9261,9263,3474,9265,9267,9269,9271,1032,9273,9275,9277,9279,9281,9283,
+		9285,3476,9287,1032,1036,9289,1008,9291,9293,9295,9297,9299,9301,1004,1566,1568,
+		1034,9303,9305,1006,9307,1026,9309,18,9311,9313,9315,1024,1028,1030,9317,9319,
+		9321,1022,1570,9323,9325,9327,1034,1006,1026,1022,1028,1024,9261,9263,3474,9265,
+		9267,9269,9271,1032,9273,9275,9277,9279,9281,9283,9285,3476,9287,1032,1036,9289,
+		1008,9291,9293,9295,9297,9299,9301,1004,1566,1568,1034,9303,9305,1006,9307,1026,
+		9309,18,9311,9313,9315,1024,1028,1030,9317,9319,9321,1022,1570,9323,9325,9327,
+		1034,1006,1026,1022,1028,1024,9261,9263,3474,9265,9267,9269,9271,1032,9273,9275,
+		9277,9279,9281,9283,9285,3476,9287,1032,1036,9289,1008,9291,9293,9295,9297,9299,
+		9301,1004,1566,1568,1034,9303,9305,1006,9307,1026,9309,18,9311,9313,9315,1024,
+		1028,1030,9317,9319,9321,1022,1570,9323,9325,9327,1034,1006,1026,1022,1028,1024,
+		9261,9263,3474,9265,9267,9269,9271,1032,9273,9275,9277,9279,9281,9283,9285,3476,
+		9287,1032,1036,9289,1008,9291,9293,9295,9297,9299,9301,1004,1566,1568,1034,9303,
+		9305,1006,9307,1026,9309,18,9311,9313,9315,1024,1028,1030,9317,9319,9321,1022,
+		1570,9323,9325,9327,1034,1006,1026,1022,1028,1024,9329,9331,0,0,3382,23,
+		11,13,3384,3386,3388,3390,3392,3394,3382,23,11,13,3384,3386,3388,3390,
+		3392,3394,3382,23,11,13,3384,3386,3388,3390,3392,3394,3382,23,11,13,
+		3384,3386,3388,3390,3392,3394,3382,23,11,13,3384,3386,3388,3390,3392,3394,
+		8850,8852,8860,8866,0,8904,8872,8862,8882,8906,8894,8896,8898,8900,8874,8886,
+		8890,8878,8892,8870,8876,8856,8858,8864,8868,8880,8884,8888,9333,7687,9335,9337,
+		0,8852,8860,0,8902,0,0,8862,0,8906,8894,8896,8898,8900,8874,8886,
+		8890,8878,8892,0,8876,8856,8858,8864,0,8880,0,8888,0,0,0,0,
+		0,0,8860,0,0,0,0,8862,0,8906,0,8896,0,8900,8874,8886,
+		0,8878,8892,0,8876,0,0,8864,0,8880,0,8888,0,7687,0,9337,
+		0,8852,8860,0,8902,0,0,8862,8882,8906,8894,0,8898,8900,8874,8886,
+		8890,8878,8892,0,8876,8856,8858,8864,0,8880,8884,8888,9333,0,9335,0,
+		8850,8852,8860,8866,8902,8904,8872,8862,8882,8906,0,8896,8898,8900,8874,8886,
+		8890,8878,8892,8870,8876,8856,8858,8864,8868,8880,8884,8888,0,0,0,0,
+		0,8852,8860,8866,0,8904,8872,8862,8882,8906,0,8896,8898,8900,8874,8886,
+		9339,9342,9345,9348,9351,9354,9357,9360,9363,9366,9369,0,0,0,0,0,
+		9372,9376,9380,9384,9388,9392,9396,9400,9404,9408,9412,9416,9420,9424,9428,9432,
+		9436,9440,9444,9448,9452,9456,9460,9464,9468,9472,9476,3419,1512,9480,9483,0,
+		3442,1512,4065,1514,1516,3554,1518,3571,4067,3454,9486,6359,9489,9492,9495,9499,
+		0,0,0,0,0,0,0,0,0,0,9502,9505,9508,0,0,0,
+		9511,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		9514,9517,5507,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		4222,9520,9522,9524,4108,9527,9529,4920,9531,9533,9535,9537,9539,9541,9543,9545,
+		9547,9549,4294,9551,9553,9555,9557,9559,9561,4096,4904,9563,5369,4910,5371,9565,
+		4406,9567,9569,9571,9573,9575,5335,4242,9577,9579,9581,9583,0,0,0,0,
+		9585,9589,9593,9597,9601,9605,9609,9613,9617,0,0,0,0,0,0,0,
+		9621,9623,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		3382,23,11,13,3384,3386,3388,3390,3392,3394,0,0,0,0,0,0,
+		9625,9627,9629,9631,9634,7200,9636,9638,9640,9642,7202,9644,9646,9648,7204,9651,
+		9653,9655,9657,9660,9662,9664,9666,9669,9671,9673,9675,7321,9677,9680,9682,9684,
+		9686,9688,9690,9692,9694,7331,7206,7208,7333,9696,9698,6822,9700,7210,9702,9704,
+		9706,9708,9708,9708,9710,9713,9715,9717,9719,9722,9724,9726,9728,9730,9732,9734,
+		9736,9738,9740,9742,9744,9746,9746,7337,9748,9750,9752,9754,7214,9756,9758,9760,
+		7128,9762,9764,9766,9768,9770,9772,9774,9776,9778,9781,9783,9785,9787,9789,9791,
+		9793,9796,9799,9801,9803,9805,9807,9809,9811,9813,9815,9815,9817,9820,9822,6814,
+		9824,9826,9829,9831,9833,9835,9837,9839,7224,9841,9843,9845,9848,9850,9853,9855,
+		9857,9859,9861,9863,9865,9867,9869,9871,9873,9875,9878,9880,9882,9884,6706,9886,
+		9889,9891,9891,9894,9896,9896,9898,9900,9903,9906,9908,9910,9912,9914,9916,9918,
+		9920,9922,9924,7226,9926,9929,9931,9933,7361,9933,9935,7230,9937,9939,9941,9943,
+		7232,6652,9945,9947,9949,9951,9953,9955,9957,9960,9962,9964,9966,9968,9970,9973,
+		9975,9977,9979,9981,9983,9985,9987,9989,7234,9991,9993,9996,9998,10000,10002,7238,
+		10004,10006,10008,10010,10012,10014,10016,10018,6708,7377,10020,10022,10024,10026,10029,10031,
+		10033,10035,7240,10037,10040,10042,10044,7466,10046,10048,10050,10052,10054,10057,10059,10061,
+		10063,10066,10068,10070,10072,6848,10074,10076,10079,10082,10085,10087,10090,10092,10094,10096,
+		10098,7242,7022,10100,10102,10104,10106,10109,10111,10113,10115,7385,10117,10119,10122,10124,
+		10126,10129,10132,10134,7387,10136,10138,10140,10142,10144,10146,10148,10151,10153,10156,10158,
+		10161,7391,10163,10165,10168,10170,10172,10175,10178,10180,10182,10184,10186,10186,10188,10190,
+		7395,10192,10194,10196,10198,10200,10203,10205,6820,10208,10211,10213,10216,10219,10222,10224,
+		7407,10226,10229,10232,10235,10238,10240,10240,7409,7470,10242,10244,10246,10248,10251,6744,
+		7413,10253,10255,7264,10258,10261,7172,10264,10266,7272,10268,10270,10272,10275,10275,10278,
+		10280,10282,10285,10287,10289,10291,10294,10296,10298,10300,10302,10304,10307,10309,10311,10313,
+		10315,10317,10319,10322,10325,10327,10330,10332,10335,10337,7284,10339,10342,10345,10347,10350,
+		10352,10355,10357,10359,10361,10363,10365,10367,10370,10373,10376,9894,10379,10381,10383,10385,
+		10387,10389,10391,10393,10395,10397,10399,10401,6856,10404,10406,10408,10410,10412,10414,7290,
+		10416,10418,10420,10422,10424,10427,10430,10433,10435,10437,10439,10441,10444,10446,10449,10451,
+		10453,10456,10459,10461,6734,10463,10465,10467,10469,10471,10473,7427,10475,10477,10479,10481,
+		10483,10485,10487,10489,10491,10493,10496,10498,10500,10502,10504,10506,10509,10512,10514,10516,
+		7437,7439,10518,10520,10523,10525,10527,10529,10531,10534,10537,10539,10541,10543,10546,7441,
+		10548,10551,10554,10556,10558,10560,10563,10565,10567,10569,10571,10573,10575,10577,10580,10582,
+		10584,10586,10589,10591,10593,10595,10597,10600,10603,10605,10607,10609,10612,10614,7453,7453,
+		10617,10619,10622,10624,10626,10628,10630,10632,10634,10636,7455,10639,10641,10643,10645,10647,
+		10649,10652,10654,10657,10660,10663,10665,10667,10669,10671,10673,10675,10677,10679,0,0
+	};
+
+	template<class T> const boost::uint16_t normalization_data<T>::decomposition_pool[10682] = {
+		0,33,32,34,32,776,33,97,34,32,772,33,50,33,51,34,
+		32,769,33,956,34,32,807,33,49,33,111,35,49,8260,52,35,
+		49,8260,50,35,51,8260,52,2,65,768,2,65,769,2,65,770,
+		2,65,771,2,65,776,2,65,778,2,67,807,2,69,768,2,
+		69,769,2,69,770,2,69,776,2,73,768,2,73,769,2,73,
+		770,2,73,776,2,78,771,2,79,768,2,79,769,2,79,770,
+		2,79,771,2,79,776,2,85,768,2,85,769,2,85,770,2,
+		85,776,2,89,769,2,97,768,2,97,769,2,97,770,2,97,
+		771,2,97,776,2,97,778,2,99,807,2,101,768,2,101,769,
+		2,101,770,2,101,776,2,105,768,2,105,769,2,105,770,2,
+		105,776,2,110,771,2,111,768,2,111,769,2,111,770,2,111,
+		771,2,111,776,2,117,768,2,117,769,2,117,770,2,117,776,
+		2,121,769,2,121,776,2,65,772,2,97,772,2,65,774,2,
+		97,774,2,65,808,2,97,808,2,67,769,2,99,769,2,67,
+		770,2,99,770,2,67,775,2,99,775,2,67,780,2,99,780,
+		2,68,780,2,100,780,2,69,772,2,101,772,2,69,774,2,
+		101,774,2,69,775,2,101,775,2,69,808,2,101,808,2,69,
+		780,2,101,780,2,71,770,2,103,770,2,71,774,2,103,774,
+		2,71,775,2,103,775,2,71,807,2,103,807,2,72,770,2,
+		104,770,2,73,771,2,105,771,2,73,772,2,105,772,2,73,
+		774,2,105,774,2,73,808,2,105,808,2,73,775,34,73,74,
+		34,105,106,2,74,770,2,106,770,2,75,807,2,107,807,2,
+		76,769,2,108,769,2,76,807,2,108,807,2,76,780,2,108,
+		780,34,76,183,34,108,183,2,78,769,2,110,769,2,78,807,
+		2,110,807,2,78,780,2,110,780,34,700,110,2,79,772,2,
+		111,772,2,79,774,2,111,774,2,79,779,2,111,779,2,82,
+		769,2,114,769,2,82,807,2,114,807,2,82,780,2,114,780,
+		2,83,769,2,115,769,2,83,770,2,115,770,2,83,807,2,
+		115,807,2,83,780,2,115,780,2,84,807,2,116,807,2,84,
+		780,2,116,780,2,85,771,2,117,771,2,85,772,2,117,772,
+		2,85,774,2,117,774,2,85,778,2,117,778,2,85,779,2,
+		117,779,2,85,808,2,117,808,2,87,770,2,119,770,2,89,
+		770,2,121,770,2,89,776,2,90,769,2,122,769,2,90,775,
+		2,122,775,2,90,780,2,122,780,33,115,2,79,795,2,111,
+		795,2,85,795,2,117,795,35,68,90,780,35,68,122,780,35,
+		100,122,780,34,76,74,34,76,106,34,108,106,34,78,74,34,
+		78,106,34,110,106,2,65,780,2,97,780,2,73,780,2,105,
+		780,2,79,780,2,111,780,2,85,780,2,117,780,3,85,776,
+		772,3,117,776,772,3,85,776,769,3,117,776,769,3,85,776,
+		780,3,117,776,780,3,85,776,768,3,117,776,768,3,65,776,
+		772,3,97,776,772,3,65,775,772,3,97,775,772,2,198,772,
+		2,230,772,2,71,780,2,103,780,2,75,780,2,107,780,2,
+		79,808,2,111,808,3,79,808,772,3,111,808,772,2,439,780,
+		2,658,780,2,106,780,34,68,90,34,68,122,34,100,122,2,
+		71,769,2,103,769,2,78,768,2,110,768,3,65,778,769,3,
+		97,778,769,2,198,769,2,230,769,2,216,769,2,248,769,2,
+		65,783,2,97,783,2,65,785,2,97,785,2,69,783,2,101,
+		783,2,69,785,2,101,785,2,73,783,2,105,783,2,73,785,
+		2,105,785,2,79,783,2,111,783,2,79,785,2,111,785,2,
+		82,783,2,114,783,2,82,785,2,114,785,2,85,783,2,117,
+		783,2,85,785,2,117,785,2,83,806,2,115,806,2,84,806,
+		2,116,806,2,72,780,2,104,780,2,65,775,2,97,775,2,
+		69,807,2,101,807,3,79,776,772,3,111,776,772,3,79,771,
+		772,3,111,771,772,2,79,775,2,111,775,3,79,775,772,3,
+		111,775,772,2,89,772,2,121,772,33,104,33,614,33,106,33,
+		114,33,633,33,635,33,641,33,119,33,121,34,32,774,34,32,
+		775,34,32,778,34,32,808,34,32,771,34,32,779,33,611,33,
+		108,33,120,33,661,1,768,1,769,1,787,2,776,769,1,697,
+		34,32,837,1,59,66,168,769,35,32,776,769,2,913,769,1,
+		183,2,917,769,2,919,769,2,921,769,2,927,769,2,933,769,
+		2,937,769,3,953,776,769,2,921,776,2,933,776,2,945,769,
+		2,949,769,2,951,769,2,953,769,3,965,776,769,2,953,776,
+		2,965,776,2,959,769,2,965,769,2,969,769,33,946,33,952,
+		33,933,66,978,769,34,933,769,66,978,776,34,933,776,33,966,
+		33,960,33,954,33,961,33,962,33,920,33,949,33,931,2,1045,
+		768,2,1045,776,2,1043,769,2,1030,776,2,1050,769,2,1048,768,
+		2,1059,774,2,1048,774,2,1080,774,2,1077,768,2,1077,776,2,
+		1075,769,2,1110,776,2,1082,769,2,1080,768,2,1091,774,2,1140,
+		783,2,1141,783,2,1046,774,2,1078,774,2,1040,774,2,1072,774,
+		2,1040,776,2,1072,776,2,1045,774,2,1077,774,2,1240,776,2,
+		1241,776,2,1046,776,2,1078,776,2,1047,776,2,1079,776,2,1048,
+		772,2,1080,772,2,1048,776,2,1080,776,2,1054,776,2,1086,776,
+		2,1256,776,2,1257,776,2,1069,776,2,1101,776,2,1059,772,2,
+		1091,772,2,1059,776,2,1091,776,2,1059,779,2,1091,779,2,1063,
+		776,2,1095,776,2,1067,776,2,1099,776,34,1381,1410,2,1575,1619,
+		2,1575,1620,2,1608,1620,2,1575,1621,2,1610,1620,34,1575,1652,34,
+		1608,1652,34,1735,1652,34,1610,1652,2,1749,1620,2,1729,1620,2,1746,
+		1620,2,2344,2364,2,2352,2364,2,2355,2364,2,2325,2364,2,2326,2364,
+		2,2327,2364,2,2332,2364,2,2337,2364,2,2338,2364,2,2347,2364,2,
+		2351,2364,2,2503,2494,2,2503,2519,2,2465,2492,2,2466,2492,2,2479,
+		2492,2,2610,2620,2,2616,2620,2,2582,2620,2,2583,2620,2,2588,2620,
+		2,2603,2620,2,2887,2902,2,2887,2878,2,2887,2903,2,2849,2876,2,
+		2850,2876,2,2962,3031,2,3014,3006,2,3015,3006,2,3014,3031,2,3142,
+		3158,2,3263,3285,2,3270,3285,2,3270,3286,2,3270,3266,3,3270,3266,
+		3285,2,3398,3390,2,3399,3390,2,3398,3415,2,3545,3530,2,3545,3535,
+		3,3545,3535,3530,2,3545,3551,34,3661,3634,34,3789,3762,34,3755,3737,
+		34,3755,3745,33,3851,2,3906,4023,2,3916,4023,2,3921,4023,2,3926,
+		4023,2,3931,4023,2,3904,4021,2,3953,3954,2,3953,3956,2,4018,3968,
+		35,4018,3953,3968,2,4019,3968,35,4019,3953,3968,2,3953,3968,2,3986,
+		4023,2,3996,4023,2,4001,4023,2,4006,4023,2,4011,4023,2,3984,4021,
+		2,4133,4142,33,4316,2,6917,6965,2,6919,6965,2,6921,6965,2,6923,
+		6965,2,6925,6965,2,6929,6965,2,6970,6965,2,6972,6965,2,6974,6965,
+		2,6975,6965,2,6978,6965,33,65,33,198,33,66,33,68,33,69,
+		33,398,33,71,33,72,33,73,33,74,33,75,33,76,33,77,
+		33,78,33,79,33,546,33,80,33,82,33,84,33,85,33,87,
+		33,592,33,593,33,7426,33,98,33,100,33,101,33,601,33,603,
+		33,604,33,103,33,107,33,109,33,331,33,596,33,7446,33,7447,
+		33,112,33,116,33,117,33,7453,33,623,33,118,33,7461,33,947,
+		33,948,33,967,33,105,33,1085,33,594,33,99,33,597,33,240,
+		33,102,33,607,33,609,33,613,33,616,33,617,33,618,33,7547,
+		33,669,33,621,33,7557,33,671,33,625,33,624,33,626,33,627,
+		33,628,33,629,33,632,33,642,33,643,33,427,33,649,33,650,
+		33,7452,33,651,33,652,33,122,33,656,33,657,33,658,2,65,
+		805,2,97,805,2,66,775,2,98,775,2,66,803,2,98,803,
+		2,66,817,2,98,817,3,67,807,769,3,99,807,769,2,68,
+		775,2,100,775,2,68,803,2,100,803,2,68,817,2,100,817,
+		2,68,807,2,100,807,2,68,813,2,100,813,3,69,772,768,
+		3,101,772,768,3,69,772,769,3,101,772,769,2,69,813,2,
+		101,813,2,69,816,2,101,816,3,69,807,774,3,101,807,774,
+		2,70,775,2,102,775,2,71,772,2,103,772,2,72,775,2,
+		104,775,2,72,803,2,104,803,2,72,776,2,104,776,2,72,
+		807,2,104,807,2,72,814,2,104,814,2,73,816,2,105,816,
+		3,73,776,769,3,105,776,769,2,75,769,2,107,769,2,75,
+		803,2,107,803,2,75,817,2,107,817,2,76,803,2,108,803,
+		3,76,803,772,3,108,803,772,2,76,817,2,108,817,2,76,
+		813,2,108,813,2,77,769,2,109,769,2,77,775,2,109,775,
+		2,77,803,2,109,803,2,78,775,2,110,775,2,78,803,2,
+		110,803,2,78,817,2,110,817,2,78,813,2,110,813,3,79,
+		771,769,3,111,771,769,3,79,771,776,3,111,771,776,3,79,
+		772,768,3,111,772,768,3,79,772,769,3,111,772,769,2,80,
+		769,2,112,769,2,80,775,2,112,775,2,82,775,2,114,775,
+		2,82,803,2,114,803,3,82,803,772,3,114,803,772,2,82,
+		817,2,114,817,2,83,775,2,115,775,2,83,803,2,115,803,
+		3,83,769,775,3,115,769,775,3,83,780,775,3,115,780,775,
+		3,83,803,775,3,115,803,775,2,84,775,2,116,775,2,84,
+		803,2,116,803,2,84,817,2,116,817,2,84,813,2,116,813,
+		2,85,804,2,117,804,2,85,816,2,117,816,2,85,813,2,
+		117,813,3,85,771,769,3,117,771,769,3,85,772,776,3,117,
+		772,776,2,86,771,2,118,771,2,86,803,2,118,803,2,87,
+		768,2,119,768,2,87,769,2,119,769,2,87,776,2,119,776,
+		2,87,775,2,119,775,2,87,803,2,119,803,2,88,775,2,
+		120,775,2,88,776,2,120,776,2,89,775,2,121,775,2,90,
+		770,2,122,770,2,90,803,2,122,803,2,90,817,2,122,817,
+		2,104,817,2,116,776,2,119,778,2,121,778,34,97,702,66,
+		383,775,34,115,775,2,65,803,2,97,803,2,65,777,2,97,
+		777,3,65,770,769,3,97,770,769,3,65,770,768,3,97,770,
+		768,3,65,770,777,3,97,770,777,3,65,770,771,3,97,770,
+		771,3,65,803,770,3,97,803,770,3,65,774,769,3,97,774,
+		769,3,65,774,768,3,97,774,768,3,65,774,777,3,97,774,
+		777,3,65,774,771,3,97,774,771,3,65,803,774,3,97,803,
+		774,2,69,803,2,101,803,2,69,777,2,101,777,2,69,771,
+		2,101,771,3,69,770,769,3,101,770,769,3,69,770,768,3,
+		101,770,768,3,69,770,777,3,101,770,777,3,69,770,771,3,
+		101,770,771,3,69,803,770,3,101,803,770,2,73,777,2,105,
+		777,2,73,803,2,105,803,2,79,803,2,111,803,2,79,777,
+		2,111,777,3,79,770,769,3,111,770,769,3,79,770,768,3,
+		111,770,768,3,79,770,777,3,111,770,777,3,79,770,771,3,
+		111,770,771,3,79,803,770,3,111,803,770,3,79,795,769,3,
+		111,795,769,3,79,795,768,3,111,795,768,3,79,795,777,3,
+		111,795,777,3,79,795,771,3,111,795,771,3,79,795,803,3,
+		111,795,803,2,85,803,2,117,803,2,85,777,2,117,777,3,
+		85,795,769,3,117,795,769,3,85,795,768,3,117,795,768,3,
+		85,795,777,3,117,795,777,3,85,795,771,3,117,795,771,3,
+		85,795,803,3,117,795,803,2,89,768,2,121,768,2,89,803,
+		2,121,803,2,89,777,2,121,777,2,89,771,2,121,771,2,
+		945,787,2,945,788,3,945,787,768,3,945,788,768,3,945,787,
+		769,3,945,788,769,3,945,787,834,3,945,788,834,2,913,787,
+		2,913,788,3,913,787,768,3,913,788,768,3,913,787,769,3,
+		913,788,769,3,913,787,834,3,913,788,834,2,949,787,2,949,
+		788,3,949,787,768,3,949,788,768,3,949,787,769,3,949,788,
+		769,2,917,787,2,917,788,3,917,787,768,3,917,788,768,3,
+		917,787,769,3,917,788,769,2,951,787,2,951,788,3,951,787,
+		768,3,951,788,768,3,951,787,769,3,951,788,769,3,951,787,
+		834,3,951,788,834,2,919,787,2,919,788,3,919,787,768,3,
+		919,788,768,3,919,787,769,3,919,788,769,3,919,787,834,3,
+		919,788,834,2,953,787,2,953,788,3,953,787,768,3,953,788,
+		768,3,953,787,769,3,953,788,769,3,953,787,834,3,953,788,
+		834,2,921,787,2,921,788,3,921,787,768,3,921,788,768,3,
+		921,787,769,3,921,788,769,3,921,787,834,3,921,788,834,2,
+		959,787,2,959,788,3,959,787,768,3,959,788,768,3,959,787,
+		769,3,959,788,769,2,927,787,2,927,788,3,927,787,768,3,
+		927,788,768,3,927,787,769,3,927,788,769,2,965,787,2,965,
+		788,3,965,787,768,3,965,788,768,3,965,787,769,3,965,788,
+		769,3,965,787,834,3,965,788,834,2,933,788,3,933,788,768,
+		3,933,788,769,3,933,788,834,2,969,787,2,969,788,3,969,
+		787,768,3,969,788,768,3,969,787,769,3,969,788,769,3,969,
+		787,834,3,969,788,834,2,937,787,2,937,788,3,937,787,768,
+		3,937,788,768,3,937,787,769,3,937,788,769,3,937,787,834,
+		3,937,788,834,2,945,768,2,949,768,2,951,768,2,953,768,
+		2,959,768,2,965,768,2,969,768,3,945,787,837,3,945,788,
+		837,4,945,787,768,837,4,945,788,768,837,4,945,787,769,837,
+		4,945,788,769,837,4,945,787,834,837,4,945,788,834,837,3,
+		913,787,837,3,913,788,837,4,913,787,768,837,4,913,788,768,
+		837,4,913,787,769,837,4,913,788,769,837,4,913,787,834,837,
+		4,913,788,834,837,3,951,787,837,3,951,788,837,4,951,787,
+		768,837,4,951,788,768,837,4,951,787,769,837,4,951,788,769,
+		837,4,951,787,834,837,4,951,788,834,837,3,919,787,837,3,
+		919,788,837,4,919,787,768,837,4,919,788,768,837,4,919,787,
+		769,837,4,919,788,769,837,4,919,787,834,837,4,919,788,834,
+		837,3,969,787,837,3,969,788,837,4,969,787,768,837,4,969,
+		788,768,837,4,969,787,769,837,4,969,788,769,837,4,969,787,
+		834,837,4,969,788,834,837,3,937,787,837,3,937,788,837,4,
+		937,787,768,837,4,937,788,768,837,4,937,787,769,837,4,937,
+		788,769,837,4,937,787,834,837,4,937,788,834,837,2,945,774,
+		2,945,772,3,945,768,837,2,945,837,3,945,769,837,2,945,
+		834,3,945,834,837,2,913,774,2,913,772,2,913,768,2,913,
+		837,34,32,787,1,953,34,32,834,66,168,834,35,32,776,834,
+		3,951,768,837,2,951,837,3,951,769,837,2,951,834,3,951,
+		834,837,2,917,768,2,919,768,2,919,837,66,8127,768,35,32,
+		787,768,66,8127,769,35,32,787,769,66,8127,834,35,32,787,834,
+		2,953,774,2,953,772,3,953,776,768,2,953,834,3,953,776,
+		834,2,921,774,2,921,772,2,921,768,66,8190,768,35,32,788,
+		768,66,8190,769,35,32,788,769,66,8190,834,35,32,788,834,2,
+		965,774,2,965,772,3,965,776,768,2,961,787,2,961,788,2,
+		965,834,3,965,776,834,2,933,774,2,933,772,2,933,768,2,
+		929,788,66,168,768,35,32,776,768,1,96,3,969,768,837,2,
+		969,837,3,969,769,837,2,969,834,3,969,834,837,2,927,768,
+		2,937,768,2,937,837,65,180,34,32,769,34,32,788,65,8194,
+		33,32,65,8195,33,32,33,8208,34,32,819,33,46,34,46,46,
+		35,46,46,46,34,8242,8242,35,8242,8242,8242,34,8245,8245,35,8245,
+		8245,8245,34,33,33,34,32,773,34,63,63,34,63,33,34,33,
+		63,36,8242,8242,8242,8242,33,48,33,52,33,53,33,54,33,55,
+		33,56,33,57,33,43,33,8722,33,61,33,40,33,41,33,110,
+		34,82,115,35,97,47,99,35,97,47,115,33,67,34,176,67,
+		35,99,47,111,35,99,47,117,33,400,34,176,70,33,295,34,
+		78,111,33,81,34,83,77,35,84,69,76,34,84,77,33,90,
+		1,937,1,75,33,70,33,1488,33,1489,33,1490,33,1491,35,70,
+		65,88,33,915,33,928,33,8721,35,49,8260,55,35,49,8260,57,
+		36,49,8260,49,48,35,49,8260,51,35,50,8260,51,35,49,8260,
+		53,35,50,8260,53,35,51,8260,53,35,52,8260,53,35,49,8260,
+		54,35,53,8260,54,35,49,8260,56,35,51,8260,56,35,53,8260,
+		56,35,55,8260,56,34,49,8260,34,73,73,35,73,73,73,34,
+		73,86,33,86,34,86,73,35,86,73,73,36,86,73,73,73,
+		34,73,88,33,88,34,88,73,35,88,73,73,34,105,105,35,
+		105,105,105,34,105,118,34,118,105,35,118,105,105,36,118,105,
+		105,105,34,105,120,34,120,105,35,120,105,105,35,48,8260,51,
+		2,8592,824,2,8594,824,2,8596,824,2,8656,824,2,8660,824,2,
+		8658,824,2,8707,824,2,8712,824,2,8715,824,2,8739,824,2,8741,
+		824,34,8747,8747,35,8747,8747,8747,34,8750,8750,35,8750,8750,8750,2,
+		8764,824,2,8771,824,2,8773,824,2,8776,824,2,61,824,2,8801,
+		824,2,8781,824,2,60,824,2,62,824,2,8804,824,2,8805,824,
+		2,8818,824,2,8819,824,2,8822,824,2,8823,824,2,8826,824,2,
+		8827,824,2,8834,824,2,8835,824,2,8838,824,2,8839,824,2,8866,
+		824,2,8872,824,2,8873,824,2,8875,824,2,8828,824,2,8829,824,
+		2,8849,824,2,8850,824,2,8882,824,2,8883,824,2,8884,824,2,
+		8885,824,1,12296,1,12297,34,49,48,34,49,49,34,49,50,34,
+		49,51,34,49,52,34,49,53,34,49,54,34,49,55,34,49,
+		56,34,49,57,34,50,48,35,40,49,41,35,40,50,41,35,
+		40,51,41,35,40,52,41,35,40,53,41,35,40,54,41,35,
+		40,55,41,35,40,56,41,35,40,57,41,36,40,49,48,41,
+		36,40,49,49,41,36,40,49,50,41,36,40,49,51,41,36,
+		40,49,52,41,36,40,49,53,41,36,40,49,54,41,36,40,
+		49,55,41,36,40,49,56,41,36,40,49,57,41,36,40,50,
+		48,41,34,49,46,34,50,46,34,51,46,34,52,46,34,53,
+		46,34,54,46,34,55,46,34,56,46,34,57,46,35,49,48,
+		46,35,49,49,46,35,49,50,46,35,49,51,46,35,49,52,
+		46,35,49,53,46,35,49,54,46,35,49,55,46,35,49,56,
+		46,35,49,57,46,35,50,48,46,35,40,97,41,35,40,98,
+		41,35,40,99,41,35,40,100,41,35,40,101,41,35,40,102,
+		41,35,40,103,41,35,40,104,41,35,40,105,41,35,40,106,
+		41,35,40,107,41,35,40,108,41,35,40,109,41,35,40,110,
+		41,35,40,111,41,35,40,112,41,35,40,113,41,35,40,114,
+		41,35,40,115,41,35,40,116,41,35,40,117,41,35,40,118,
+		41,35,40,119,41,35,40,120,41,35,40,121,41,35,40,122,
+		41,33,83,33,89,33,113,36,8747,8747,8747,8747,35,58,58,61,
+		34,61,61,35,61,61,61,2,10973,824,33,11617,33,27597,33,40863,
+		33,19968,33,20008,33,20022,33,20031,33,20057,33,20101,33,20108,33,20128,
+		33,20154,33,20799,33,20837,33,20843,33,20866,33,20886,33,20907,33,20960,
+		33,20981,33,20992,33,21147,33,21241,33,21269,33,21274,33,21304,33,21313,
+		33,21340,33,21353,33,21378,33,21430,33,21448,33,21475,33,22231,33,22303,
+		33,22763,33,22786,33,22794,33,22805,33,22823,33,22899,33,23376,33,23424,
+		33,23544,33,23567,33,23586,33,23608,33,23662,33,23665,33,24027,33,24037,
+		33,24049,33,24062,33,24178,33,24186,33,24191,33,24308,33,24318,33,24331,
+		33,24339,33,24400,33,24417,33,24435,33,24515,33,25096,33,25142,33,25163,
+		33,25903,33,25908,33,25991,33,26007,33,26020,33,26041,33,26080,33,26085,
+		33,26352,33,26376,33,26408,33,27424,33,27490,33,27513,33,27571,33,27595,
+		33,27604,33,27611,33,27663,33,27668,33,27700,33,28779,33,29226,33,29238,
+		33,29243,33,29247,33,29255,33,29273,33,29275,33,29356,33,29572,33,29577,
+		33,29916,33,29926,33,29976,33,29983,33,29992,33,30000,33,30091,33,30098,
+		33,30326,33,30333,33,30382,33,30399,33,30446,33,30683,33,30690,33,30707,
+		33,31034,33,31160,33,31166,33,31348,33,31435,33,31481,33,31859,33,31992,
+		33,32566,33,32593,33,32650,33,32701,33,32769,33,32780,33,32786,33,32819,
+		33,32895,33,32905,33,33251,33,33258,33,33267,33,33276,33,33292,33,33307,
+		33,33311,33,33390,33,33394,33,33400,33,34381,33,34411,33,34880,33,34892,
+		33,34915,33,35198,33,35211,33,35282,33,35328,33,35895,33,35910,33,35925,
+		33,35960,33,35997,33,36196,33,36208,33,36275,33,36523,33,36554,33,36763,
+		33,36784,33,36789,33,37009,33,37193,33,37318,33,37324,33,37329,33,38263,
+		33,38272,33,38428,33,38582,33,38585,33,38632,33,38737,33,38750,33,38754,
+		33,38761,33,38859,33,38893,33,38899,33,38913,33,39080,33,39131,33,39135,
+		33,39318,33,39321,33,39340,33,39592,33,39640,33,39647,33,39717,33,39727,
+		33,39730,33,39740,33,39770,33,40165,33,40565,33,40575,33,40613,33,40635,
+		33,40643,33,40653,33,40657,33,40697,33,40701,33,40718,33,40723,33,40736,
+		33,40763,33,40778,33,40786,33,40845,33,40860,33,40864,33,12306,33,21316,
+		33,21317,2,12363,12441,2,12365,12441,2,12367,12441,2,12369,12441,2,12371,
+		12441,2,12373,12441,2,12375,12441,2,12377,12441,2,12379,12441,2,12381,12441,
+		2,12383,12441,2,12385,12441,2,12388,12441,2,12390,12441,2,12392,12441,2,
+		12399,12441,2,12399,12442,2,12402,12441,2,12402,12442,2,12405,12441,2,12405,
+		12442,2,12408,12441,2,12408,12442,2,12411,12441,2,12411,12442,2,12358,12441,
+		34,32,12441,34,32,12442,2,12445,12441,34,12424,12426,2,12459,12441,2,
+		12461,12441,2,12463,12441,2,12465,12441,2,12467,12441,2,12469,12441,2,12471,
+		12441,2,12473,12441,2,12475,12441,2,12477,12441,2,12479,12441,2,12481,12441,
+		2,12484,12441,2,12486,12441,2,12488,12441,2,12495,12441,2,12495,12442,2,
+		12498,12441,2,12498,12442,2,12501,12441,2,12501,12442,2,12504,12441,2,12504,
+		12442,2,12507,12441,2,12507,12442,2,12454,12441,2,12527,12441,2,12528,12441,
+		2,12529,12441,2,12530,12441,2,12541,12441,34,12467,12488,33,4352,33,4353,
+		33,4522,33,4354,33,4524,33,4525,33,4355,33,4356,33,4357,33,4528,
+		33,4529,33,4530,33,4531,33,4532,33,4533,33,4378,33,4358,33,4359,
+		33,4360,33,4385,33,4361,33,4362,33,4363,33,4364,33,4365,33,4366,
+		33,4367,33,4368,33,4369,33,4370,33,4449,33,4450,33,4451,33,4452,
+		33,4453,33,4454,33,4455,33,4456,33,4457,33,4458,33,4459,33,4460,
+		33,4461,33,4462,33,4463,33,4464,33,4465,33,4466,33,4467,33,4468,
+		33,4469,33,4448,33,4372,33,4373,33,4551,33,4552,33,4556,33,4558,
+		33,4563,33,4567,33,4569,33,4380,33,4573,33,4575,33,4381,33,4382,
+		33,4384,33,4386,33,4387,33,4391,33,4393,33,4395,33,4396,33,4397,
+		33,4398,33,4399,33,4402,33,4406,33,4416,33,4423,33,4428,33,4593,
+		33,4594,33,4439,33,4440,33,4441,33,4484,33,4485,33,4488,33,4497,
+		33,4498,33,4500,33,4510,33,4513,33,19977,33,22235,33,19978,33,20013,
+		33,19979,33,30002,33,19993,33,19969,33,22825,33,22320,35,40,4352,41,
+		35,40,4354,41,35,40,4355,41,35,40,4357,41,35,40,4358,41,
+		35,40,4359,41,35,40,4361,41,35,40,4363,41,35,40,4364,41,
+		35,40,4366,41,35,40,4367,41,35,40,4368,41,35,40,4369,41,
+		35,40,4370,41,36,40,4352,4449,41,36,40,4354,4449,41,36,40,
+		4355,4449,41,36,40,4357,4449,41,36,40,4358,4449,41,36,40,4359,
+		4449,41,36,40,4361,4449,41,36,40,4363,4449,41,36,40,4364,4449,
+		41,36,40,4366,4449,41,36,40,4367,4449,41,36,40,4368,4449,41,
+		36,40,4369,4449,41,36,40,4370,4449,41,36,40,4364,4462,41,39,
+		40,4363,4457,4364,4453,4523,41,38,40,4363,4457,4370,4462,41,35,40,
+		19968,41,35,40,20108,41,35,40,19977,41,35,40,22235,41,35,40,
+		20116,41,35,40,20845,41,35,40,19971,41,35,40,20843,41,35,40,
+		20061,41,35,40,21313,41,35,40,26376,41,35,40,28779,41,35,40,
+		27700,41,35,40,26408,41,35,40,37329,41,35,40,22303,41,35,40,
+		26085,41,35,40,26666,41,35,40,26377,41,35,40,31038,41,35,40,
+		21517,41,35,40,29305,41,35,40,36001,41,35,40,31069,41,35,40,
+		21172,41,35,40,20195,41,35,40,21628,41,35,40,23398,41,35,40,
+		30435,41,35,40,20225,41,35,40,36039,41,35,40,21332,41,35,40,
+		31085,41,35,40,20241,41,35,40,33258,41,35,40,33267,41,33,21839,
+		33,24188,33,31631,35,80,84,69,34,50,49,34,50,50,34,50,
+		51,34,50,52,34,50,53,34,50,54,34,50,55,34,50,56,
+		34,50,57,34,51,48,34,51,49,34,51,50,34,51,51,34,
+		51,52,34,51,53,34,4352,4449,34,4354,4449,34,4355,4449,34,4357,
+		4449,34,4358,4449,34,4359,4449,34,4361,4449,34,4363,4449,34,4364,4449,
+		34,4366,4449,34,4367,4449,34,4368,4449,34,4369,4449,34,4370,4449,37,
+		4366,4449,4535,4352,4457,36,4364,4462,4363,4468,34,4363,4462,33,20116,33,
+		20845,33,19971,33,20061,33,26666,33,26377,33,31038,33,21517,33,29305,33,
+		36001,33,31069,33,21172,33,31192,33,30007,33,36969,33,20778,33,21360,33,
+		27880,33,38917,33,20241,33,20889,33,27491,33,24038,33,21491,33,21307,33,
+		23447,33,23398,33,30435,33,20225,33,36039,33,21332,33,22812,34,51,54,
+		34,51,55,34,51,56,34,51,57,34,52,48,34,52,49,34,
+		52,50,34,52,51,34,52,52,34,52,53,34,52,54,34,52,
+		55,34,52,56,34,52,57,34,53,48,34,49,26376,34,50,26376,
+		34,51,26376,34,52,26376,34,53,26376,34,54,26376,34,55,26376,34,
+		56,26376,34,57,26376,35,49,48,26376,35,49,49,26376,35,49,50,
+		26376,34,72,103,35,101,114,103,34,101,86,35,76,84,68,33,
+		12450,33,12452,33,12454,33,12456,33,12458,33,12459,33,12461,33,12463,33,
+		12465,33,12467,33,12469,33,12471,33,12473,33,12475,33,12477,33,12479,33,
+		12481,33,12484,33,12486,33,12488,33,12490,33,12491,33,12492,33,12493,33,
+		12494,33,12495,33,12498,33,12501,33,12504,33,12507,33,12510,33,12511,33,
+		12512,33,12513,33,12514,33,12516,33,12518,33,12520,33,12521,33,12522,33,
+		12523,33,12524,33,12525,33,12527,33,12528,33,12529,33,12530,34,20196,21644,
+		37,12450,12495,12442,12540,12488,36,12450,12523,12501,12449,37,12450,12531,12504,12442,
+		12450,35,12450,12540,12523,37,12452,12491,12531,12463,12441,35,12452,12531,12481,35,
+		12454,12457,12531,38,12456,12473,12463,12540,12488,12441,36,12456,12540,12459,12540,35,
+		12458,12531,12473,35,12458,12540,12512,35,12459,12452,12522,36,12459,12521,12483,12488,
+		36,12459,12525,12522,12540,36,12459,12441,12525,12531,36,12459,12441,12531,12510,36,
+		12461,12441,12459,12441,36,12461,12441,12491,12540,36,12461,12517,12522,12540,38,12461,
+		12441,12523,12479,12441,12540,34,12461,12525,38,12461,12525,12463,12441,12521,12512,38,
+		12461,12525,12513,12540,12488,12523,37,12461,12525,12527,12483,12488,36,12463,12441,12521,
+		12512,38,12463,12441,12521,12512,12488,12531,38,12463,12523,12475,12441,12452,12525,36,
+		12463,12525,12540,12493,35,12465,12540,12473,35,12467,12523,12490,36,12467,12540,12507,
+		12442,36,12469,12452,12463,12523,37,12469,12531,12481,12540,12512,37,12471,12522,12531,
+		12463,12441,35,12475,12531,12481,35,12475,12531,12488,36,12479,12441,12540,12473,35,
+		12486,12441,12471,35,12488,12441,12523,34,12488,12531,34,12490,12494,35,12494,12483,
+		12488,35,12495,12452,12484,38,12495,12442,12540,12475,12531,12488,36,12495,12442,12540,
+		12484,37,12495,12441,12540,12524,12523,38,12498,12442,12450,12473,12488,12523,36,12498,
+		12442,12463,12523,35,12498,12442,12467,35,12498,12441,12523,38,12501,12449,12521,12483,
+		12488,12441,36,12501,12451,12540,12488,38,12501,12441,12483,12471,12455,12523,35,12501,
+		12521,12531,37,12504,12463,12479,12540,12523,35,12504,12442,12477,36,12504,12442,12491,
+		12498,35,12504,12523,12484,36,12504,12442,12531,12473,37,12504,12442,12540,12471,12441,
+		36,12504,12441,12540,12479,37,12507,12442,12452,12531,12488,36,12507,12441,12523,12488,
+		34,12507,12531,37,12507,12442,12531,12488,12441,35,12507,12540,12523,35,12507,12540,
+		12531,36,12510,12452,12463,12525,35,12510,12452,12523,35,12510,12483,12495,35,12510,
+		12523,12463,37,12510,12531,12471,12519,12531,36,12511,12463,12525,12531,34,12511,12522,
+		38,12511,12522,12495,12441,12540,12523,35,12513,12459,12441,37,12513,12459,12441,12488,
+		12531,36,12513,12540,12488,12523,36,12516,12540,12488,12441,35,12516,12540,12523,35,
+		12518,12450,12531,36,12522,12483,12488,12523,34,12522,12521,36,12523,12498,12442,12540,
+		37,12523,12540,12501,12441,12523,34,12524,12512,38,12524,12531,12488,12465,12441,12531,
+		35,12527,12483,12488,34,48,28857,34,49,28857,34,50,28857,34,51,28857,
+		34,52,28857,34,53,28857,34,54,28857,34,55,28857,34,56,28857,34,
+		57,28857,35,49,48,28857,35,49,49,28857,35,49,50,28857,35,49,
+		51,28857,35,49,52,28857,35,49,53,28857,35,49,54,28857,35,49,
+		55,28857,35,49,56,28857,35,49,57,28857,35,50,48,28857,35,50,
+		49,28857,35,50,50,28857,35,50,51,28857,35,50,52,28857,35,104,
+		80,97,34,100,97,34,65,85,35,98,97,114,34,111,86,34,
+		112,99,34,100,109,35,100,109,50,35,100,109,51,34,73,85,
+		34,24179,25104,34,26157,21644,34,22823,27491,34,26126,27835,36,26666,24335,20250,
+		31038,34,112,65,34,110,65,34,956,65,34,109,65,34,107,65,
+		34,75,66,34,77,66,34,71,66,35,99,97,108,36,107,99,
+		97,108,34,112,70,34,110,70,34,956,70,34,956,103,34,109,
+		103,34,107,103,34,72,122,35,107,72,122,35,77,72,122,35,
+		71,72,122,35,84,72,122,34,956,108,34,109,108,34,100,108,
+		34,107,108,34,102,109,34,110,109,34,956,109,34,109,109,34,
+		99,109,34,107,109,35,109,109,50,35,99,109,50,34,109,50,
+		35,107,109,50,35,109,109,51,35,99,109,51,34,109,51,35,
+		107,109,51,35,109,8725,115,36,109,8725,115,50,34,80,97,35,
+		107,80,97,35,77,80,97,35,71,80,97,35,114,97,100,37,
+		114,97,100,8725,115,38,114,97,100,8725,115,50,34,112,115,34,
+		110,115,34,956,115,34,109,115,34,112,86,34,110,86,34,956,
+		86,34,109,86,34,107,86,34,77,86,34,112,87,34,110,87,
+		34,956,87,34,109,87,34,107,87,34,77,87,34,107,937,34,
+		77,937,36,97,46,109,46,34,66,113,34,99,99,34,99,100,
+		36,67,8725,107,103,35,67,111,46,34,100,66,34,71,121,34,
+		104,97,34,72,80,34,105,110,34,75,75,34,75,77,34,107,
+		116,34,108,109,34,108,110,35,108,111,103,34,108,120,34,109,
+		98,35,109,105,108,35,109,111,108,34,80,72,36,112,46,109,
+		46,35,80,80,77,34,80,82,34,115,114,34,83,118,34,87,
+		98,35,86,8725,109,35,65,8725,109,34,49,26085,34,50,26085,34,
+		51,26085,34,52,26085,34,53,26085,34,54,26085,34,55,26085,34,56,
+		26085,34,57,26085,35,49,48,26085,35,49,49,26085,35,49,50,26085,
+		35,49,51,26085,35,49,52,26085,35,49,53,26085,35,49,54,26085,
+		35,49,55,26085,35,49,56,26085,35,49,57,26085,35,50,48,26085,
+		35,50,49,26085,35,50,50,26085,35,50,51,26085,35,50,52,26085,
+		35,50,53,26085,35,50,54,26085,35,50,55,26085,35,50,56,26085,
+		35,50,57,26085,35,51,48,26085,35,51,49,26085,35,103,97,108,
+		33,1098,33,1100,33,42863,33,294,33,339,33,42791,33,43831,33,619,
+		33,43858,33,653,1,35912,1,26356,1,36554,1,36040,1,28369,1,20018,
+		1,21477,1,40860,1,22865,1,37329,1,21895,1,22856,1,25078,1,30313,
+		1,32645,1,34367,1,34746,1,35064,1,37007,1,27138,1,27931,1,28889,
+		1,29662,1,33853,1,37226,1,39409,1,20098,1,21365,1,27396,1,29211,
+		1,34349,1,40478,1,23888,1,28651,1,34253,1,35172,1,25289,1,33240,
+		1,34847,1,24266,1,26391,1,28010,1,29436,1,37070,1,20358,1,20919,
+		1,21214,1,25796,1,27347,1,29200,1,30439,1,32769,1,34310,1,34396,
+		1,36335,1,38706,1,39791,1,40442,1,30860,1,31103,1,32160,1,33737,
+		1,37636,1,40575,1,35542,1,22751,1,24324,1,31840,1,32894,1,29282,
+		1,30922,1,36034,1,38647,1,22744,1,23650,1,27155,1,28122,1,28431,
+		1,32047,1,32311,1,38475,1,21202,1,32907,1,20956,1,20940,1,31260,
+		1,32190,1,33777,1,38517,1,35712,1,25295,1,35582,1,20025,1,23527,
+		1,24594,1,29575,1,30064,1,21271,1,30971,1,20415,1,24489,1,19981,
+		1,27852,1,25976,1,32034,1,21443,1,22622,1,30465,1,33865,1,35498,
+		1,27578,1,36784,1,27784,1,25342,1,33509,1,25504,1,30053,1,20142,
+		1,20841,1,20937,1,26753,1,31975,1,33391,1,35538,1,37327,1,21237,
+		1,21570,1,22899,1,24300,1,26053,1,28670,1,31018,1,38317,1,39530,
+		1,40599,1,40654,1,21147,1,26310,1,27511,1,36706,1,24180,1,24976,
+		1,25088,1,25754,1,28451,1,29001,1,29833,1,31178,1,32244,1,32879,
+		1,36646,1,34030,1,36899,1,37706,1,21015,1,21155,1,21693,1,28872,
+		1,35010,1,24265,1,24565,1,25467,1,27566,1,31806,1,29557,1,20196,
+		1,22265,1,23994,1,24604,1,29618,1,29801,1,32666,1,32838,1,37428,
+		1,38646,1,38728,1,38936,1,20363,1,31150,1,37300,1,38584,1,24801,
+		1,20102,1,20698,1,23534,1,23615,1,26009,1,29134,1,30274,1,34044,
+		1,36988,1,40845,1,26248,1,38446,1,21129,1,26491,1,26611,1,27969,
+		1,28316,1,29705,1,30041,1,30827,1,32016,1,39006,1,20845,1,25134,
+		1,38520,1,20523,1,23833,1,28138,1,36650,1,24459,1,24900,1,26647,
+		1,38534,1,21033,1,21519,1,23653,1,26131,1,26446,1,26792,1,27877,
+		1,29702,1,30178,1,32633,1,35023,1,35041,1,37324,1,38626,1,21311,
+		1,28346,1,21533,1,29136,1,29848,1,34298,1,38563,1,40023,1,40607,
+		1,26519,1,28107,1,33256,1,31435,1,31520,1,31890,1,29376,1,28825,
+		1,35672,1,20160,1,33590,1,21050,1,20999,1,24230,1,25299,1,31958,
+		1,23429,1,27934,1,26292,1,36667,1,34892,1,38477,1,35211,1,24275,
+		1,20800,1,21952,1,22618,1,26228,1,20958,1,29482,1,30410,1,31036,
+		1,31070,1,31077,1,31119,1,38742,1,31934,1,32701,1,34322,1,35576,
+		1,36920,1,37117,1,39151,1,39164,1,39208,1,40372,1,37086,1,38583,
+		1,20398,1,20711,1,20813,1,21193,1,21220,1,21329,1,21917,1,22022,
+		1,22120,1,22592,1,22696,1,23652,1,23662,1,24724,1,24936,1,24974,
+		1,25074,1,25935,1,26082,1,26257,1,26757,1,28023,1,28186,1,28450,
+		1,29038,1,29227,1,29730,1,30865,1,31038,1,31049,1,31048,1,31056,
+		1,31062,1,31069,1,31117,1,31118,1,31296,1,31361,1,31680,1,32265,
+		1,32321,1,32626,1,32773,1,33261,1,33401,1,33879,1,35088,1,35222,
+		1,35585,1,35641,1,36051,1,36104,1,36790,1,38627,1,38911,1,38971,
+		1,24693,2,55376,57070,1,33304,1,20006,1,20917,1,20840,1,20352,1,
+		20805,1,20864,1,21191,1,21242,1,21845,1,21913,1,21986,1,22707,1,
+		22852,1,22868,1,23138,1,23336,1,24274,1,24281,1,24425,1,24493,1,
+		24792,1,24910,1,24840,1,24928,1,25140,1,25540,1,25628,1,25682,1,
+		25942,1,26395,1,26454,1,27513,1,28379,1,28363,1,28702,1,30631,1,
+		29237,1,29359,1,29809,1,29958,1,30011,1,30237,1,30239,1,30427,1,
+		30452,1,30538,1,30528,1,30924,1,31409,1,31867,1,32091,1,32574,1,
+		33618,1,33775,1,34681,1,35137,1,35206,1,35519,1,35531,1,35565,1,
+		35722,1,36664,1,36978,1,37273,1,37494,1,38524,1,38875,1,38923,1,
+		39698,2,55370,56394,2,55370,56388,2,55372,57301,1,15261,1,16408,1,16441,
+		2,55380,56905,2,55383,56528,2,55391,57043,1,40771,1,40846,34,102,102,
+		34,102,105,34,102,108,35,102,102,105,35,102,102,108,34,115,
+		116,34,1396,1398,34,1396,1381,34,1396,1387,34,1406,1398,34,1396,1389,
+		2,1497,1460,2,1522,1463,33,1506,33,1492,33,1499,33,1500,33,1501,
+		33,1512,33,1514,2,1513,1473,2,1513,1474,3,1513,1468,1473,3,1513,
+		1468,1474,2,1488,1463,2,1488,1464,2,1488,1468,2,1489,1468,2,1490,
+		1468,2,1491,1468,2,1492,1468,2,1493,1468,2,1494,1468,2,1496,1468,
+		2,1497,1468,2,1498,1468,2,1499,1468,2,1500,1468,2,1502,1468,2,
+		1504,1468,2,1505,1468,2,1507,1468,2,1508,1468,2,1510,1468,2,1511,
+		1468,2,1512,1468,2,1513,1468,2,1514,1468,2,1493,1465,2,1489,1471,
+		2,1499,1471,2,1508,1471,34,1488,1500,33,1649,33,1659,33,1662,33,
+		1664,33,1658,33,1663,33,1657,33,1700,33,1702,33,1668,33,1667,33,
+		1670,33,1671,33,1677,33,1676,33,1678,33,1672,33,1688,33,1681,33,
+		1705,33,1711,33,1715,33,1713,33,1722,33,1723,34,1749,1620,33,1729,
+		33,1726,33,1746,34,1746,1620,33,1709,33,1735,33,1734,33,1736,33,
+		1739,33,1733,33,1737,33,1744,33,1609,35,1610,1620,1575,35,1610,1620,
+		1749,35,1610,1620,1608,35,1610,1620,1735,35,1610,1620,1734,35,1610,1620,
+		1736,35,1610,1620,1744,35,1610,1620,1609,33,1740,35,1610,1620,1580,35,
+		1610,1620,1581,35,1610,1620,1605,35,1610,1620,1610,34,1576,1580,34,1576,
+		1581,34,1576,1582,34,1576,1605,34,1576,1609,34,1576,1610,34,1578,1580,
+		34,1578,1581,34,1578,1582,34,1578,1605,34,1578,1609,34,1578,1610,34,
+		1579,1580,34,1579,1605,34,1579,1609,34,1579,1610,34,1580,1581,34,1580,
+		1605,34,1581,1580,34,1581,1605,34,1582,1580,34,1582,1581,34,1582,1605,
+		34,1587,1580,34,1587,1581,34,1587,1582,34,1587,1605,34,1589,1581,34,
+		1589,1605,34,1590,1580,34,1590,1581,34,1590,1582,34,1590,1605,34,1591,
+		1581,34,1591,1605,34,1592,1605,34,1593,1580,34,1593,1605,34,1594,1580,
+		34,1594,1605,34,1601,1580,34,1601,1581,34,1601,1582,34,1601,1605,34,
+		1601,1609,34,1601,1610,34,1602,1581,34,1602,1605,34,1602,1609,34,1602,
+		1610,34,1603,1575,34,1603,1580,34,1603,1581,34,1603,1582,34,1603,1604,
+		34,1603,1605,34,1603,1609,34,1603,1610,34,1604,1580,34,1604,1581,34,
+		1604,1582,34,1604,1605,34,1604,1609,34,1604,1610,34,1605,1580,34,1605,
+		1581,34,1605,1582,34,1605,1605,34,1605,1609,34,1605,1610,34,1606,1580,
+		34,1606,1581,34,1606,1582,34,1606,1605,34,1606,1609,34,1606,1610,34,
+		1607,1580,34,1607,1605,34,1607,1609,34,1607,1610,34,1610,1580,34,1610,
+		1581,34,1610,1582,34,1610,1605,34,1610,1609,34,1610,1610,34,1584,1648,
+		34,1585,1648,34,1609,1648,35,32,1612,1617,35,32,1613,1617,35,32,
+		1614,1617,35,32,1615,1617,35,32,1616,1617,35,32,1617,1648,35,1610,
+		1620,1585,35,1610,1620,1586,35,1610,1620,1606,34,1576,1585,34,1576,1586,
+		34,1576,1606,34,1578,1585,34,1578,1586,34,1578,1606,34,1579,1585,34,
+		1579,1586,34,1579,1606,34,1605,1575,34,1606,1585,34,1606,1586,34,1606,
+		1606,34,1610,1585,34,1610,1586,34,1610,1606,35,1610,1620,1582,35,1610,
+		1620,1607,34,1576,1607,34,1578,1607,34,1589,1582,34,1604,1607,34,1606,
+		1607,34,1607,1648,34,1610,1607,34,1579,1607,34,1587,1607,34,1588,1605,
+		34,1588,1607,35,1600,1614,1617,35,1600,1615,1617,35,1600,1616,1617,34,
+		1591,1609,34,1591,1610,34,1593,1609,34,1593,1610,34,1594,1609,34,1594,
+		1610,34,1587,1609,34,1587,1610,34,1588,1609,34,1588,1610,34,1581,1609,
+		34,1581,1610,34,1580,1609,34,1580,1610,34,1582,1609,34,1582,1610,34,
+		1589,1609,34,1589,1610,34,1590,1609,34,1590,1610,34,1588,1580,34,1588,
+		1581,34,1588,1582,34,1588,1585,34,1587,1585,34,1589,1585,34,1590,1585,
+		34,1575,1611,35,1578,1580,1605,35,1578,1581,1580,35,1578,1581,1605,35,
+		1578,1582,1605,35,1578,1605,1580,35,1578,1605,1581,35,1578,1605,1582,35,
+		1580,1605,1581,35,1581,1605,1610,35,1581,1605,1609,35,1587,1581,1580,35,
+		1587,1580,1581,35,1587,1580,1609,35,1587,1605,1581,35,1587,1605,1580,35,
+		1587,1605,1605,35,1589,1581,1581,35,1589,1605,1605,35,1588,1581,1605,35,
+		1588,1580,1610,35,1588,1605,1582,35,1588,1605,1605,35,1590,1581,1609,35,
+		1590,1582,1605,35,1591,1605,1581,35,1591,1605,1605,35,1591,1605,1610,35,
+		1593,1580,1605,35,1593,1605,1605,35,1593,1605,1609,35,1594,1605,1605,35,
+		1594,1605,1610,35,1594,1605,1609,35,1601,1582,1605,35,1602,1605,1581,35,
+		1602,1605,1605,35,1604,1581,1605,35,1604,1581,1610,35,1604,1581,1609,35,
+		1604,1580,1580,35,1604,1582,1605,35,1604,1605,1581,35,1605,1581,1580,35,
+		1605,1581,1605,35,1605,1581,1610,35,1605,1580,1581,35,1605,1580,1605,35,
+		1605,1582,1580,35,1605,1582,1605,35,1605,1580,1582,35,1607,1605,1580,35,
+		1607,1605,1605,35,1606,1581,1605,35,1606,1581,1609,35,1606,1580,1605,35,
+		1606,1580,1609,35,1606,1605,1610,35,1606,1605,1609,35,1610,1605,1605,35,
+		1576,1582,1610,35,1578,1580,1610,35,1578,1580,1609,35,1578,1582,1610,35,
+		1578,1582,1609,35,1578,1605,1610,35,1578,1605,1609,35,1580,1605,1610,35,
+		1580,1581,1609,35,1580,1605,1609,35,1587,1582,1609,35,1589,1581,1610,35,
+		1588,1581,1610,35,1590,1581,1610,35,1604,1580,1610,35,1604,1605,1610,35,
+		1610,1581,1610,35,1610,1580,1610,35,1610,1605,1610,35,1605,1605,1610,35,
+		1602,1605,1610,35,1606,1581,1610,35,1593,1605,1610,35,1603,1605,1610,35,
+		1606,1580,1581,35,1605,1582,1610,35,1604,1580,1605,35,1603,1605,1605,35,
+		1580,1581,1610,35,1581,1580,1610,35,1605,1580,1610,35,1601,1605,1610,35,
+		1576,1581,1610,35,1587,1582,1610,35,1606,1580,1610,35,1589,1604,1746,35,
+		1602,1604,1746,36,1575,1604,1604,1607,36,1575,1603,1576,1585,36,1605,1581,
+		1605,1583,36,1589,1604,1593,1605,36,1585,1587,1608,1604,36,1593,1604,1610,
+		1607,36,1608,1587,1604,1605,35,1589,1604,1609,50,1589,1604,1609,32,1575,
+		1604,1604,1607,32,1593,1604,1610,1607,32,1608,1587,1604,1605,40,1580,1604,
+		32,1580,1604,1575,1604,1607,36,1585,1740,1575,1604,33,44,33,12289,33,
+		12290,33,58,33,59,33,33,33,63,33,12310,33,12311,33,8212,33,
+		8211,33,95,33,123,33,125,33,12308,33,12309,33,12304,33,12305,33,
+		12298,33,12299,33,12296,33,12297,33,12300,33,12301,33,12302,33,12303,33,
+		91,33,93,33,35,33,38,33,42,33,45,33,60,33,62,33,
+		92,33,36,33,37,33,64,34,32,1611,34,1600,1611,34,32,1612,
+		34,32,1613,34,32,1614,34,1600,1614,34,32,1615,34,1600,1615,34,
+		32,1616,34,1600,1616,34,32,1617,34,1600,1617,34,32,1618,34,1600,
+		1618,33,1569,34,1575,1619,34,1575,1620,34,1608,1620,34,1575,1621,34,
+		1610,1620,33,1575,33,1576,33,1577,33,1578,33,1579,33,1580,33,1581,
+		33,1582,33,1583,33,1584,33,1585,33,1586,33,1587,33,1588,33,1589,
+		33,1590,33,1591,33,1592,33,1593,33,1594,33,1601,33,1602,33,1603,
+		33,1604,33,1605,33,1606,33,1607,33,1608,33,1610,35,1604,1575,1619,
+		35,1604,1575,1620,35,1604,1575,1621,34,1604,1575,33,34,33,39,33,
+		47,33,94,33,96,33,124,33,126,33,10629,33,10630,33,12539,33,
+		12449,33,12451,33,12453,33,12455,33,12457,33,12515,33,12517,33,12519,33,
+		12483,33,12540,33,12531,33,12441,33,12442,33,162,33,163,33,172,33,
+		166,33,165,33,8361,33,9474,33,8592,33,8593,33,8594,33,8595,33,
+		9632,33,9675,33,720,33,721,33,230,33,665,33,595,33,675,33,
+		43878,33,677,33,676,33,598,33,599,33,7569,33,600,33,606,33,
+		681,33,612,33,610,33,608,33,667,33,668,33,615,33,644,33,
+		682,33,683,33,620,34,55351,57092,33,42894,33,622,34,55351,57093,33,
+		654,34,55351,57094,33,248,33,630,33,631,33,634,34,55351,57096,33,
+		637,33,638,33,640,33,680,33,678,33,43879,33,679,33,648,33,
+		11377,33,655,33,673,33,674,33,664,33,448,33,449,33,450,34,
+		55351,57098,34,55351,57118,4,55300,56473,55300,56506,4,55300,56475,55300,56506,4,
+		55300,56485,55300,56506,4,55300,56625,55300,56615,4,55300,56626,55300,56615,4,55300,
+		57159,55300,57150,4,55300,57159,55300,57175,4,55301,56505,55301,56506,4,55301,56505,
+		55301,56496,4,55301,56505,55301,56509,4,55301,56760,55301,56751,4,55301,56761,55301,
+		56751,4,55302,56629,55302,56624,4,55348,56663,55348,56677,4,55348,56664,55348,56677,
+		6,55348,56664,55348,56677,55348,56686,6,55348,56664,55348,56677,55348,56687,6,55348,
+		56664,55348,56677,55348,56688,6,55348,56664,55348,56677,55348,56689,6,55348,56664,55348,
+		56677,55348,56690,4,55348,56761,55348,56677,4,55348,56762,55348,56677,6,55348,56761,
+		55348,56677,55348,56686,6,55348,56762,55348,56677,55348,56686,6,55348,56761,55348,56677,
+		55348,56687,6,55348,56762,55348,56677,55348,56687,33,305,33,567,33,913,33,
+		914,33,916,33,917,33,918,33,919,33,921,33,922,33,923,33,
+		924,33,925,33,926,33,927,33,929,33,932,33,934,33,935,33,
+		936,33,937,33,8711,33,945,33,950,33,951,33,953,33,955,33,
+		957,33,958,33,959,33,963,33,964,33,965,33,968,33,969,33,
+		8706,33,988,33,989,33,1646,33,1697,33,1647,34,48,46,34,48,
+		44,34,49,44,34,50,44,34,51,44,34,52,44,34,53,44,
+		34,54,44,34,55,44,34,56,44,34,57,44,35,40,65,41,
+		35,40,66,41,35,40,67,41,35,40,68,41,35,40,69,41,
+		35,40,70,41,35,40,71,41,35,40,72,41,35,40,73,41,
+		35,40,74,41,35,40,75,41,35,40,76,41,35,40,77,41,
+		35,40,78,41,35,40,79,41,35,40,80,41,35,40,81,41,
+		35,40,82,41,35,40,83,41,35,40,84,41,35,40,85,41,
+		35,40,86,41,35,40,87,41,35,40,88,41,35,40,89,41,
+		35,40,90,41,35,12308,83,12309,34,67,68,34,87,90,34,72,
+		86,34,83,68,34,83,83,35,80,80,86,34,87,67,34,77,
+		67,34,77,68,34,77,82,34,68,74,34,12411,12363,34,12467,12467,
+		33,23383,33,21452,34,12486,12441,33,22810,33,35299,33,20132,33,26144,33,
+		28961,33,26009,33,21069,33,24460,33,20877,33,26032,33,21021,33,32066,33,
+		36009,33,22768,33,21561,33,28436,33,25237,33,25429,33,36938,33,25351,33,
+		25171,33,31105,33,31354,33,21512,33,28288,33,30003,33,21106,33,21942,33,
+		37197,35,12308,26412,12309,35,12308,19977,12309,35,12308,20108,12309,35,12308,23433,
+		12309,35,12308,28857,12309,35,12308,25171,12309,35,12308,30423,12309,35,12308,21213,
+		12309,35,12308,25943,12309,33,24471,33,21487,1,20029,1,20024,1,20033,2,
+		55360,56610,1,20320,1,20411,1,20482,1,20602,1,20633,1,20687,1,13470,
+		2,55361,56890,1,20820,1,20836,1,20855,2,55361,56604,1,13497,1,20839,
+		1,20877,2,55361,56651,1,20887,1,20900,1,20172,1,20908,2,55396,56799,
+		1,20981,1,20995,1,13535,1,21051,1,21062,1,21106,1,21111,1,13589,
+		1,21253,1,21254,1,21321,1,21338,1,21363,1,21373,1,21375,2,55362,
+		56876,1,28784,1,21450,1,21471,2,55362,57187,1,21483,1,21489,1,21510,
+		1,21662,1,21560,1,21576,1,21608,1,21666,1,21750,1,21776,1,21843,
+		1,21859,1,21892,1,21931,1,21939,1,21954,1,22294,1,22295,1,22097,
+		1,22132,1,22766,1,22478,1,22516,1,22541,1,22411,1,22578,1,22577,
+		1,22700,2,55365,56548,1,22770,1,22775,1,22790,1,22810,1,22818,1,
+		22882,2,55365,57000,2,55365,57066,1,23020,1,23067,1,23079,1,23000,1,
+		23142,1,14062,1,14076,1,23304,1,23358,2,55366,56776,1,23491,1,23512,
+		1,23539,2,55366,57112,1,23551,1,23558,1,24403,1,23586,1,14209,1,
+		23648,1,23744,1,23693,2,55367,56804,1,23875,2,55367,56806,1,23918,1,
+		23915,1,23932,1,24033,1,24034,1,14383,1,24061,1,24104,1,24125,1,
+		24169,1,14434,2,55368,56707,1,14460,1,24240,1,24243,1,24246,2,55400,
+		57234,1,24318,2,55368,57137,1,33281,1,24354,1,14535,2,55372,57016,2,
+		55384,56794,1,24418,1,24427,1,14563,1,24474,1,24525,1,24535,1,24569,
+		1,24705,1,14650,1,14620,2,55369,57044,1,24775,1,24904,1,24908,1,
+		24954,1,25010,1,24996,1,25007,1,25054,1,25104,1,25115,1,25181,1,
+		25265,1,25300,1,25424,2,55370,57100,1,25405,1,25340,1,25448,1,25475,
+		1,25572,2,55370,57329,1,25634,1,25541,1,25513,1,14894,1,25705,1,
+		25726,1,25757,1,25719,1,14956,1,25964,2,55372,56330,1,26083,1,26360,
+		1,26185,1,15129,1,15112,1,15076,1,20882,1,20885,1,26368,1,26268,
+		1,32941,1,17369,1,26401,1,26462,1,26451,2,55372,57283,1,15177,1,
+		26618,1,26501,1,26706,2,55373,56429,1,26766,1,26655,1,26900,1,26946,
+		1,27043,1,27114,1,27304,2,55373,56995,1,27355,1,15384,1,27425,2,
+		55374,56487,1,27476,1,15438,1,27506,1,27551,1,27579,2,55374,56973,2,
+		55367,56587,2,55374,57082,1,27726,2,55375,56508,1,27839,1,27853,1,27751,
+		1,27926,1,27966,1,28009,1,28024,1,28037,2,55375,56606,1,27956,1,
+		28207,1,28270,1,15667,1,28359,2,55375,57041,1,28153,1,28526,2,55375,
+		57182,2,55375,57230,1,28614,1,28729,1,28699,1,15766,1,28746,1,28797,
+		1,28791,1,28845,2,55361,56613,1,28997,2,55376,56931,1,29084,2,55376,
+		57259,1,29224,1,29264,2,55377,56840,1,29312,1,29333,2,55377,57141,2,
+		55378,56340,1,29562,1,29579,1,16044,1,29605,1,16056,1,29767,1,29788,
+		1,29829,1,29898,1,16155,1,29988,2,55379,56374,1,30014,2,55379,56466,
+		2,55368,56735,1,30224,2,55379,57249,2,55379,57272,2,55380,56388,1,16380,
+		1,16392,2,55380,56563,2,55380,56562,2,55380,56601,2,55380,56627,1,30494,
+		1,30495,1,30603,1,16454,1,16534,2,55381,56349,1,30798,1,16611,2,
+		55381,56870,2,55381,56986,2,55381,57029,1,31211,1,16687,1,31306,1,31311,
+		2,55382,56700,2,55382,56999,1,31470,1,16898,2,55382,57259,1,31686,1,
+		31689,1,16935,2,55383,56448,1,31954,1,17056,1,31976,1,31971,1,32000,
+		2,55383,57222,1,32099,1,17153,1,32199,1,32258,1,32325,1,17204,2,
+		55384,56872,2,55384,56903,1,17241,2,55384,57049,1,32634,2,55384,57150,1,
+		32661,1,32762,2,55385,56538,2,55385,56611,1,32864,2,55385,56744,1,32880,
+		2,55372,57183,1,17365,1,32946,1,33027,1,17419,1,33086,1,23221,2,
+		55385,57255,2,55385,57269,2,55372,57235,2,55372,57244,1,33284,1,36766,1,
+		17515,1,33425,1,33419,1,33437,1,21171,1,33457,1,33459,1,33469,1,
+		33510,2,55386,57148,1,33565,1,33635,1,33709,1,33571,1,33725,1,33767,
+		1,33619,1,33738,1,33740,1,33756,2,55387,56374,2,55387,56683,2,55387,
+		56533,1,17707,1,34033,1,34035,1,34070,2,55388,57290,1,34148,2,55387,
+		57132,1,17757,1,17761,2,55387,57265,2,55388,56530,1,17771,1,34384,1,
+		34407,1,34409,1,34473,1,34440,1,34574,1,34530,1,34600,1,34667,1,
+		34694,1,17879,1,34785,1,34817,1,17913,1,34912,1,34915,2,55389,56935,
+		1,35031,1,35038,1,17973,1,35066,1,13499,2,55390,56494,2,55390,56678,
+		1,18110,1,18119,1,35488,1,35925,2,55391,56488,1,36011,1,36033,1,
+		36123,1,36215,2,55391,57135,2,55362,56324,1,36299,1,36284,1,36336,2,
+		55362,56542,1,36564,2,55393,56786,2,55393,56813,1,37012,1,37105,1,37137,
+		2,55393,57134,1,37147,1,37432,1,37591,1,37592,1,37500,1,37881,1,
+		37909,2,55394,57338,1,38283,1,18837,1,38327,2,55395,56695,1,18918,1,
+		38595,1,23986,1,38691,2,55396,56645,2,55396,56858,1,19054,1,19062,1,
+		38880,2,55397,56330,1,19122,2,55397,56470,1,38953,2,55397,56758,1,39138,
+		1,19251,1,39209,1,39335,1,39362,1,39422,1,19406,2,55398,57136,1,
+		40000,1,40189,1,19662,1,19693,1,40295,2,55400,56526,1,19704,2,55400,
+		56581,2,55400,56846,2,55400,56977,1,40635,1,19798,1,40697,1,40702,1,
+		40709,1,40719,1,40726,1,40763,2,55401,56832
+	};
+
+	template<class T> const boost::uint32_t normalization_data<T>::composition_first[941] = {
+		60,61,62,65,65,65,65,65,65,65,65,65,
+		65,65,65,65,65,65,65,66,66,66,67,67,
+		67,67,67,68,68,68,68,68,68,69,69,69,
+		69,69,69,69,69,69,69,69,69,69,69,69,
+		69,69,70,71,71,71,71,71,71,71,72,72,
+		72,72,72,72,72,73,73,73,73,73,73,73,
+		73,73,73,73,73,73,73,73,74,75,75,75,
+		75,75,76,76,76,76,76,76,77,77,77,78,
+		78,78,78,78,78,78,78,78,79,79,79,79,
+		79,79,79,79,79,79,79,79,79,79,79,79,
+		80,80,82,82,82,82,82,82,82,82,83,83,
+		83,83,83,83,83,84,84,84,84,84,84,84,
+		85,85,85,85,85,85,85,85,85,85,85,85,
+		85,85,85,85,85,85,85,86,86,87,87,87,
+		87,87,87,88,88,89,89,89,89,89,89,89,
+		89,89,90,90,90,90,90,90,97,97,97,97,
+		97,97,97,97,97,97,97,97,97,97,97,97,
+		98,98,98,99,99,99,99,99,100,100,100,100,
+		100,100,101,101,101,101,101,101,101,101,101,101,
+		101,101,101,101,101,101,101,102,103,103,103,103,
+		103,103,103,104,104,104,104,104,104,104,104,105,
+		105,105,105,105,105,105,105,105,105,105,105,105,
+		105,106,106,107,107,107,107,107,108,108,108,108,
+		108,108,109,109,109,110,110,110,110,110,110,110,
+		110,110,111,111,111,111,111,111,111,111,111,111,
+		111,111,111,111,111,111,112,112,114,114,114,114,
+		114,114,114,114,115,115,115,115,115,115,115,116,
+		116,116,116,116,116,116,116,117,117,117,117,117,
+		117,117,117,117,117,117,117,117,117,117,117,117,
+		117,117,118,118,119,119,119,119,119,119,119,120,
+		120,121,121,121,121,121,121,121,121,121,121,122,
+		122,122,122,122,122,168,168,168,194,194,194,194,
+		196,197,198,198,199,202,202,202,202,207,212,212,
+		212,212,213,213,213,214,216,220,220,220,220,226,
+		226,226,226,228,229,230,230,231,234,234,234,234,
+		239,244,244,244,244,245,245,245,246,248,252,252,
+		252,252,258,258,258,258,259,259,259,259,274,274,
+		275,275,332,332,333,333,346,347,352,353,360,361,
+		362,363,383,416,416,416,416,416,417,417,417,417,
+		417,431,431,431,431,431,432,432,432,432,432,439,
+		490,491,550,551,552,553,558,559,658,913,913,913,
+		913,913,913,913,917,917,917,917,919,919,919,919,
+		919,921,921,921,921,921,921,921,927,927,927,927,
+		929,933,933,933,933,933,933,937,937,937,937,937,
+		940,942,945,945,945,945,945,945,945,945,949,949,
+		949,949,951,951,951,951,951,951,953,953,953,953,
+		953,953,953,953,959,959,959,959,961,961,965,965,
+		965,965,965,965,965,965,969,969,969,969,969,969,
+		970,970,970,971,971,971,974,978,978,1030,1040,1040,
+		1043,1045,1045,1045,1046,1046,1047,1048,1048,1048,1048,1050,
+		1054,1059,1059,1059,1059,1063,1067,1069,1072,1072,1075,1077,
+		1077,1077,1078,1078,1079,1080,1080,1080,1080,1082,1086,1091,
+		1091,1091,1091,1095,1099,1101,1110,1140,1141,1240,1241,1256,
+		1257,1575,1575,1575,1608,1610,1729,1746,1749,2344,2352,2355,
+		2503,2503,2887,2887,2887,2962,3014,3014,3015,3142,3263,3270,
+		3270,3270,3274,3398,3398,3399,3545,3545,3545,3548,4133,6917,
+		6919,6921,6923,6925,6929,6970,6972,6974,6975,6978,7734,7735,
+		7770,7771,7778,7779,7840,7840,7841,7841,7864,7865,7884,7885,
+		7936,7936,7936,7936,7937,7937,7937,7937,7938,7939,7940,7941,
+		7942,7943,7944,7944,7944,7944,7945,7945,7945,7945,7946,7947,
+		7948,7949,7950,7951,7952,7952,7953,7953,7960,7960,7961,7961,
+		7968,7968,7968,7968,7969,7969,7969,7969,7970,7971,7972,7973,
+		7974,7975,7976,7976,7976,7976,7977,7977,7977,7977,7978,7979,
+		7980,7981,7982,7983,7984,7984,7984,7985,7985,7985,7992,7992,
+		7992,7993,7993,7993,8000,8000,8001,8001,8008,8008,8009,8009,
+		8016,8016,8016,8017,8017,8017,8025,8025,8025,8032,8032,8032,
+		8032,8033,8033,8033,8033,8034,8035,8036,8037,8038,8039,8040,
+		8040,8040,8040,8041,8041,8041,8041,8042,8043,8044,8045,8046,
+		8047,8048,8052,8060,8118,8127,8127,8127,8134,8182,8190,8190,
+		8190,8592,8594,8596,8656,8658,8660,8707,8712,8715,8739,8741,
+		8764,8771,8773,8776,8781,8801,8804,8805,8818,8819,8822,8823,
+		8826,8827,8828,8829,8834,8835,8838,8839,8849,8850,8866,8872,
+		8873,8875,8882,8883,8884,8885,12358,12363,12365,12367,12369,12371,
+		12373,12375,12377,12379,12381,12383,12385,12388,12390,12392,12399,12399,
+		12402,12402,12405,12405,12408,12408,12411,12411,12445,12454,12459,12461,
+		12463,12465,12467,12469,12471,12473,12475,12477,12479,12481,12484,12486,
+		12488,12495,12495,12498,12498,12501,12501,12504,12504,12507,12507,12527,
+		12528,12529,12530,12541,69785,69787,69797,69937,69938,70471,70471,70841,
+		70841,70841,71096,71097,71989
+	};
+
+	template<class T> const boost::uint32_t normalization_data<T>::composition_second[941] = {
+		824,824,824,768,769,770,771,772,774,775,776,777,
+		778,780,783,785,803,805,808,775,803,817,769,770,
+		775,780,807,775,780,803,807,813,817,768,769,770,
+		771,772,774,775,776,777,780,783,785,803,807,808,
+		813,816,775,769,770,772,774,775,780,807,770,775,
+		776,780,803,807,814,768,769,770,771,772,774,775,
+		776,777,780,783,785,803,808,816,770,769,780,803,
+		807,817,769,780,803,807,813,817,769,775,803,768,
+		769,771,775,780,803,807,813,817,768,769,770,771,
+		772,774,775,776,777,779,780,783,785,795,803,808,
+		769,775,769,775,780,783,785,803,807,817,769,770,
+		775,780,803,806,807,775,780,803,806,807,813,817,
+		768,769,770,771,772,774,776,777,778,779,780,783,
+		785,795,803,804,808,813,816,771,803,768,769,770,
+		775,776,803,775,776,768,769,770,771,772,775,776,
+		777,803,769,770,775,780,803,817,768,769,770,771,
+		772,774,775,776,777,778,780,783,785,803,805,808,
+		775,803,817,769,770,775,780,807,775,780,803,807,
+		813,817,768,769,770,771,772,774,775,776,777,780,
+		783,785,803,807,808,813,816,775,769,770,772,774,
+		775,780,807,770,775,776,780,803,807,814,817,768,
+		769,770,771,772,774,776,777,780,783,785,803,808,
+		816,770,780,769,780,803,807,817,769,780,803,807,
+		813,817,769,775,803,768,769,771,775,780,803,807,
+		813,817,768,769,770,771,772,774,775,776,777,779,
+		780,783,785,795,803,808,769,775,769,775,780,783,
+		785,803,807,817,769,770,775,780,803,806,807,775,
+		776,780,803,806,807,813,817,768,769,770,771,772,
+		774,776,777,778,779,780,783,785,795,803,804,808,
+		813,816,771,803,768,769,770,775,776,778,803,775,
+		776,768,769,770,771,772,775,776,777,778,803,769,
+		770,775,780,803,817,768,769,834,768,769,771,777,
+		772,769,769,772,769,768,769,771,777,769,768,769,
+		771,777,769,772,776,772,769,768,769,772,780,768,
+		769,771,777,772,769,769,772,769,768,769,771,777,
+		769,768,769,771,777,769,772,776,772,769,768,769,
+		772,780,768,769,771,777,768,769,771,777,768,769,
+		768,769,768,769,768,769,775,775,775,775,769,769,
+		776,776,775,768,769,771,777,803,768,769,771,777,
+		803,768,769,771,777,803,768,769,771,777,803,780,
+		772,772,772,772,774,774,772,772,780,768,769,772,
+		774,787,788,837,768,769,787,788,768,769,787,788,
+		837,768,769,772,774,776,787,788,768,769,787,788,
+		788,768,769,772,774,776,788,768,769,787,788,837,
+		837,837,768,769,772,774,787,788,834,837,768,769,
+		787,788,768,769,787,788,834,837,768,769,772,774,
+		776,787,788,834,768,769,787,788,787,788,768,769,
+		772,774,776,787,788,834,768,769,787,788,834,837,
+		768,769,834,768,769,834,837,769,776,776,774,776,
+		769,768,774,776,774,776,776,768,772,774,776,769,
+		776,772,774,776,779,776,776,776,774,776,769,768,
+		774,776,774,776,776,768,772,774,776,769,776,772,
+		774,776,779,776,776,776,776,783,783,776,776,776,
+		776,1619,1620,1621,1620,1620,1620,1620,1620,2364,2364,2364,
+		2494,2519,2878,2902,2903,3031,3006,3031,3006,3158,3285,3266,
+		3285,3286,3285,3390,3415,3390,3530,3535,3551,3530,4142,6965,
+		6965,6965,6965,6965,6965,6965,6965,6965,6965,6965,772,772,
+		772,772,775,775,770,774,770,774,770,770,770,770,
+		768,769,834,837,768,769,834,837,837,837,837,837,
+		837,837,768,769,834,837,768,769,834,837,837,837,
+		837,837,837,837,768,769,768,769,768,769,768,769,
+		768,769,834,837,768,769,834,837,837,837,837,837,
+		837,837,768,769,834,837,768,769,834,837,837,837,
+		837,837,837,837,768,769,834,768,769,834,768,769,
+		834,768,769,834,768,769,768,769,768,769,768,769,
+		768,769,834,768,769,834,768,769,834,768,769,834,
+		837,768,769,834,837,837,837,837,837,837,837,768,
+		769,834,837,768,769,834,837,837,837,837,837,837,
+		837,837,837,837,837,768,769,834,837,837,768,769,
+		834,824,824,824,824,824,824,824,824,824,824,824,
+		824,824,824,824,824,824,824,824,824,824,824,824,
+		824,824,824,824,824,824,824,824,824,824,824,824,
+		824,824,824,824,824,824,12441,12441,12441,12441,12441,12441,
+		12441,12441,12441,12441,12441,12441,12441,12441,12441,12441,12441,12442,
+		12441,12442,12441,12442,12441,12442,12441,12442,12441,12441,12441,12441,
+		12441,12441,12441,12441,12441,12441,12441,12441,12441,12441,12441,12441,
+		12441,12441,12442,12441,12442,12441,12442,12441,12442,12441,12442,12441,
+		12441,12441,12441,12441,69818,69818,69818,69927,69927,70462,70487,70832,
+		70842,70845,71087,71087,71984
+	};
+
+	template<class T> const boost::uint32_t normalization_data<T>::composition_result[941] = {
+		8814,8800,8815,192,193,194,195,256,258,550,196,7842,
+		197,461,512,514,7840,7680,260,7682,7684,7686,262,264,
+		266,268,199,7690,270,7692,7696,7698,7694,200,201,202,
+		7868,274,276,278,203,7866,282,516,518,7864,552,280,
+		7704,7706,7710,500,284,7712,286,288,486,290,292,7714,
+		7718,542,7716,7720,7722,204,205,206,296,298,300,304,
+		207,7880,463,520,522,7882,302,7724,308,7728,488,7730,
+		310,7732,313,317,7734,315,7740,7738,7742,7744,7746,504,
+		323,209,7748,327,7750,325,7754,7752,210,211,212,213,
+		332,334,558,214,7886,336,465,524,526,416,7884,490,
+		7764,7766,340,7768,344,528,530,7770,342,7774,346,348,
+		7776,352,7778,536,350,7786,356,7788,538,354,7792,7790,
+		217,218,219,360,362,364,220,7910,366,368,467,532,
+		534,431,7908,7794,370,7798,7796,7804,7806,7808,7810,372,
+		7814,7812,7816,7818,7820,7922,221,374,7928,562,7822,376,
+		7926,7924,377,7824,379,381,7826,7828,224,225,226,227,
+		257,259,551,228,7843,229,462,513,515,7841,7681,261,
+		7683,7685,7687,263,265,267,269,231,7691,271,7693,7697,
+		7699,7695,232,233,234,7869,275,277,279,235,7867,283,
+		517,519,7865,553,281,7705,7707,7711,501,285,7713,287,
+		289,487,291,293,7715,7719,543,7717,7721,7723,7830,236,
+		237,238,297,299,301,239,7881,464,521,523,7883,303,
+		7725,309,496,7729,489,7731,311,7733,314,318,7735,316,
+		7741,7739,7743,7745,7747,505,324,241,7749,328,7751,326,
+		7755,7753,242,243,244,245,333,335,559,246,7887,337,
+		466,525,527,417,7885,491,7765,7767,341,7769,345,529,
+		531,7771,343,7775,347,349,7777,353,7779,537,351,7787,
+		7831,357,7789,539,355,7793,7791,249,250,251,361,363,
+		365,252,7911,367,369,468,533,535,432,7909,7795,371,
+		7799,7797,7805,7807,7809,7811,373,7815,7813,7832,7817,7819,
+		7821,7923,253,375,7929,563,7823,255,7927,7833,7925,378,
+		7825,380,382,7827,7829,8173,901,8129,7846,7844,7850,7848,
+		478,506,508,482,7688,7872,7870,7876,7874,7726,7890,7888,
+		7894,7892,7756,556,7758,554,510,475,471,469,473,7847,
+		7845,7851,7849,479,507,509,483,7689,7873,7871,7877,7875,
+		7727,7891,7889,7895,7893,7757,557,7759,555,511,476,472,
+		470,474,7856,7854,7860,7858,7857,7855,7861,7859,7700,7702,
+		7701,7703,7760,7762,7761,7763,7780,7781,7782,7783,7800,7801,
+		7802,7803,7835,7900,7898,7904,7902,7906,7901,7899,7905,7903,
+		7907,7914,7912,7918,7916,7920,7915,7913,7919,7917,7921,494,
+		492,493,480,481,7708,7709,560,561,495,8122,902,8121,
+		8120,7944,7945,8124,8136,904,7960,7961,8138,905,7976,7977,
+		8140,8154,906,8153,8152,938,7992,7993,8184,908,8008,8009,
+		8172,8170,910,8169,8168,939,8025,8186,911,8040,8041,8188,
+		8116,8132,8048,940,8113,8112,7936,7937,8118,8115,8050,941,
+		7952,7953,8052,942,7968,7969,8134,8131,8054,943,8145,8144,
+		970,7984,7985,8150,8056,972,8000,8001,8164,8165,8058,973,
+		8161,8160,971,8016,8017,8166,8060,974,8032,8033,8182,8179,
+		8146,912,8151,8162,944,8167,8180,979,980,1031,1232,1234,
+		1027,1024,1238,1025,1217,1244,1246,1037,1250,1049,1252,1036,
+		1254,1262,1038,1264,1266,1268,1272,1260,1233,1235,1107,1104,
+		1239,1105,1218,1245,1247,1117,1251,1081,1253,1116,1255,1263,
+		1118,1265,1267,1269,1273,1261,1111,1142,1143,1242,1243,1258,
+		1259,1570,1571,1573,1572,1574,1730,1747,1728,2345,2353,2356,
+		2507,2508,2891,2888,2892,2964,3018,3020,3019,3144,3264,3274,
+		3271,3272,3275,3402,3404,3403,3546,3548,3550,3549,4134,6918,
+		6920,6922,6924,6926,6930,6971,6973,6976,6977,6979,7736,7737,
+		7772,7773,7784,7785,7852,7862,7853,7863,7878,7879,7896,7897,
+		7938,7940,7942,8064,7939,7941,7943,8065,8066,8067,8068,8069,
+		8070,8071,7946,7948,7950,8072,7947,7949,7951,8073,8074,8075,
+		8076,8077,8078,8079,7954,7956,7955,7957,7962,7964,7963,7965,
+		7970,7972,7974,8080,7971,7973,7975,8081,8082,8083,8084,8085,
+		8086,8087,7978,7980,7982,8088,7979,7981,7983,8089,8090,8091,
+		8092,8093,8094,8095,7986,7988,7990,7987,7989,7991,7994,7996,
+		7998,7995,7997,7999,8002,8004,8003,8005,8010,8012,8011,8013,
+		8018,8020,8022,8019,8021,8023,8027,8029,8031,8034,8036,8038,
+		8096,8035,8037,8039,8097,8098,8099,8100,8101,8102,8103,8042,
+		8044,8046,8104,8043,8045,8047,8105,8106,8107,8108,8109,8110,
+		8111,8114,8130,8178,8119,8141,8142,8143,8135,8183,8157,8158,
+		8159,8602,8603,8622,8653,8655,8654,8708,8713,8716,8740,8742,
+		8769,8772,8775,8777,8813,8802,8816,8817,8820,8821,8824,8825,
+		8832,8833,8928,8929,8836,8837,8840,8841,8930,8931,8876,8877,
+		8878,8879,8938,8939,8940,8941,12436,12364,12366,12368,12370,12372,
+		12374,12376,12378,12380,12382,12384,12386,12389,12391,12393,12400,12401,
+		12403,12404,12406,12407,12409,12410,12412,12413,12446,12532,12460,12462,
+		12464,12466,12468,12470,12472,12474,12476,12478,12480,12482,12485,12487,
+		12489,12496,12497,12499,12500,12502,12503,12505,12506,12508,12509,12535,
+		12536,12537,12538,12542,69786,69788,69803,69934,69935,70475,70476,70844,
+		70843,70846,71098,71099,71992
+	};
+
+	// Canonical combining class (bits 0-7), and NFC, NFKC (2 bits each), NFD and NFKD quick check values.
+	inline boost::uint16_t normalization_props(boost::uint32_t cp)
+	{
+		if(cp >= 0x2FB00) // Everything from here on has the same value.
+			return 0;
+
+		return normalization_data<>::normalization_props_stage3[(normalization_data<>::normalization_props_stage2[(normalization_data<>::normalization_props_stage1[cp >> 8] << 4) + ((cp >> 4) & 0xF)] << 4) + (cp & 0xF)];
+	}
+
+	// Offset of the character's decompositions in decomposition_pool, or 0 if it has none.
+	inline boost::uint16_t decomposition_offset(boost::uint32_t cp)
+	{
+		if(cp >= 0x2FB00) // Everything from here on has the same value.
+			return 0;
+
+		return normalization_data<>::decomposition_offset_stage3[(normalization_data<>::decomposition_offset_stage2[(normalization_data<>::decomposition_offset_stage1[cp >> 8] << 4) + ((cp >> 4) & 0xF)] << 4) + (cp & 0xF)];
+	}
+}
+
+#endif
@@ -0,0 +1,436 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_NORMALIZE_HPP
+#define BOOST_UNICODE_NORMALIZE_HPP
+
+#include <cstddef>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "normalization_tables.hpp"
+#include "utf8_count.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Normalization (http://www.unicode.org/reports/tr15/).
+	// Most text is already normalized, so everything starts with a quick check, which
+	// only has to look up the characters that aren't ASCII, and which can usually say
+	// "yes" without any decomposing or composing.
+	//================================================================================
+
+	enum normalization_form
+	{
+		nfc, // Canonical decomposition, then canonical composition.
+		nfd, // Canonical decomposition.
+		nfkc, // Compatibility decomposition, then canonical composition.
+		nfkd // Compatibility decomposition.
+	};
+
+	enum quick_check_result
+	{
+		quick_check_yes, // Is normalized.
+		quick_check_no, // Isn't normalized.
+		quick_check_maybe // Can't tell without normalizing.
+	};
+
+	// Hangul syllables decompose and compose algorithmically, so they aren't in the tables.
+	const boost::uint32_t hangul_s_base = 0xAC00;
+	const boost::uint32_t hangul_l_base = 0x1100;
+	const boost::uint32_t hangul_v_base = 0x1161;
+	const boost::uint32_t hangul_t_base = 0x11A7;
+	const boost::uint32_t hangul_l_count = 19;
+	const boost::uint32_t hangul_v_count = 21;
+	const boost::uint32_t hangul_t_count = 28;
+	const boost::uint32_t hangul_n_count = hangul_v_count * hangul_t_count;
+	const boost::uint32_t hangul_s_count = hangul_l_count * hangul_n_count;
+
+	// A stream is normalized a segment at a time. Once a segment has this many characters,
+	// it's cut before the next character that normalizing can start over at, so a long
+	// run of characters that aren't boundaries (like "é" in NFD) doesn't have to be read
+	// all at once.
+	const std::size_t max_normalization_segment = 32;
+
+	// Streams are also put in the Stream-Safe Text Format (see UAX #15): a run of more
+	// than this many non-starters has a COMBINING GRAPHEME JOINER put in it, so a run of
+	// thousands of combining marks can't make normalizing take quadratic time or
+	// unbounded memory. Real text never comes close.
+	const std::size_t max_nonstarters = 30;
+	const boost::uint32_t combining_grapheme_joiner = 0x034F;
+
+	inline int combining_class(boost::uint32_t cp)
+	{
+		return normalization_props(cp) & 0xFF;
+	}
+
+	inline quick_check_result quick_check(boost::uint32_t cp, normalization_form form)
+	{
+		// Where each form's value is in normalization_props. NFD and NFKD are never Maybe.
+		static const int shift[4] = { 8, 12, 10, 13 };
+		static const int mask[4] = { 3, 1, 3, 1 };
+
+		return (quick_check_result)(normalization_props(cp) >> shift[form] & mask[form]);
+	}
+
+	// Does nothing that comes before or after cp change when it's normalized? Normalizing
+	// can start over at any such character.
+	inline bool is_normalization_boundary(boost::uint32_t cp, normalization_form form)
+	{
+		return cp < 0x80 || ((normalization_props(cp) & 0xFF) == 0 && quick_check(cp, form) == quick_check_yes);
+	}
+
+	// Quick check a range of code points.
+	template<class iterator_type>
+	quick_check_result quick_check(iterator_type first, iterator_type last, normalization_form form)
+	{
+		quick_check_result ret = quick_check_yes;
+		int last_class = 0;
+
+		for(; first != last; ++first)
+		{
+			boost::uint32_t cp = *first;
+
+			if(cp < 0x80)
+			{
+				last_class = 0;
+				continue;
+			}
+
+			int ccc = combining_class(cp);
+
+			// Combining marks have to be in order.
+			if(ccc && last_class > ccc)
+				return quick_check_no;
+
+			quick_check_result check = quick_check(cp, form);
+
+			if(check == quick_check_no)
+				return quick_check_no;
+			else if(check == quick_check_maybe)
+				ret = quick_check_maybe;
+
+			last_class = ccc;
+		}
+
+		return ret;
+	}
+
+	// Quick check well-formed UTF-8, skipping ASCII 16 bytes at a time.
+	inline quick_check_result quick_check_utf8(const boost::uint8_t* first, const boost::uint8_t* last, normalization_form form)
+	{
+		quick_check_result ret = quick_check_yes;
+		int last_class = 0;
+
+		while(first != last)
+		{
+#ifdef BOOST_UNICODE_HAS_SSE2
+			if(last - first >= 16 && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)first)))
+			{
+				first += 16;
+				last_class = 0;
+				continue;
+			}
+#endif
+
+			if(*first < 0x80)
+			{
+				++first;
+				last_class = 0;
+				continue;
+			}
+
+			boost::uint32_t cp = utf8_next(first);
+			int ccc = combining_class(cp);
+
+			if(ccc && last_class > ccc)
+				return quick_check_no;
+
+			quick_check_result check = quick_check(cp, form);
+
+			if(check == quick_check_no)
+				return quick_check_no;
+			else if(check == quick_check_maybe)
+				ret = quick_check_maybe;
+
+			last_class = ccc;
+		}
+
+		return ret;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Decomposing and composing
+	//--------------------------------------------------------------------------------
+
+	// Append the full canonical (or compatibility) decomposition of cp to out.
+	inline void decompose(boost::uint32_t cp, bool compatibility, std::vector<boost::uint32_t>& out)
+	{
+		if(cp - hangul_s_base < hangul_s_count)
+		{
+			boost::uint32_t s = cp - hangul_s_base;
+			out.push_back(hangul_l_base + s / hangul_n_count);
+			out.push_back(hangul_v_base + s % hangul_n_count / hangul_t_count);
+
+			if(s % hangul_t_count)
+				out.push_back(hangul_t_base + s % hangul_t_count);
+
+			return;
+		}
+
+		boost::uint16_t offset = decomposition_offset(cp);
+
+		if(!offset)
+		{
+			out.push_back(cp);
+			return;
+		}
+
+		typedef normalization_data<> data;
+		const boost::uint16_t* p = &data::decomposition_pool[offset];
+
+		if(*p & data::decomposition_compatibility)
+		{
+			// It only has a compatibility decomposition.
+			if(!compatibility)
+			{
+				out.push_back(cp);
+				return;
+			}
+		}
+		else if(compatibility && (*p & data::decomposition_compatibility_follows))
+		{
+			p += (*p & data::decomposition_length_mask) + 1;
+		}
+
+		const boost::uint16_t* end = p + 1 + (*p & data::decomposition_length_mask);
+
+		// The decomposition is stored in UTF-16.
+		for(++p; p != end; ++p)
+		{
+			if(*p - 0xD800U < 0x400)
+			{
+				out.push_back(0x10000 + ((*p - 0xD800) << 10) + (p[1] - 0xDC00));
+				++p;
+			}
+			else
+			{
+				out.push_back(*p);
+			}
+		}
+	}
+
+	// Sort each run of combining marks by combining class, keeping marks of the same class in order.
+	inline void canonical_order(boost::uint32_t* first, boost::uint32_t* last)
+	{
+		for(boost::uint32_t* i=first; i != last; ++i)
+		{
+			int ccc = combining_class(*i);
+
+			if(!ccc)
+				continue;
+
+			boost::uint32_t cp = *i;
+			boost::uint32_t* j = i;
+
+			for(; j != first && combining_class(j[-1]) > ccc; --j)
+				*j = j[-1];
+
+			*j = cp;
+		}
+	}
+
+	// The primary composite of a and b, or 0 if there isn't one.
+	inline boost::uint32_t compose_pair(boost::uint32_t a, boost::uint32_t b)
+	{
+		if(a - hangul_l_base < hangul_l_count && b - hangul_v_base < hangul_v_count)
+			return hangul_s_base + ((a - hangul_l_base) * hangul_v_count + b - hangul_v_base) * hangul_t_count;
+
+		if(a - hangul_s_base < hangul_s_count && (a - hangul_s_base) % hangul_t_count == 0
+			&& b - hangul_t_base - 1 < hangul_t_count - 1)
+			return a + b - hangul_t_base;
+
+		// The pairs are sorted, so binary search them.
+		typedef normalization_data<> data;
+		int lo = 0, hi = data::composition_count;
+
+		while(lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+
+			if(data::composition_first[mid] < a || (data::composition_first[mid] == a && data::composition_second[mid] < b))
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		if(lo < data::composition_count && data::composition_first[lo] == a && data::composition_second[lo] == b)
+			return data::composition_result[lo];
+
+		return 0;
+	}
+
+	// Canonically compose the decomposed, ordered characters in s from start on.
+	inline void compose(std::vector<boost::uint32_t>& s, std::size_t start=0)
+	{
+		if(start >= s.size())
+			return;
+
+		std::size_t starter = start;
+		std::size_t out = start + 1;
+		// 256 stops anything composing with a combining mark at the start.
+		int last_class = combining_class(s[start]) ? 256 : 0;
+
+		for(std::size_t i=start+1; i < s.size(); ++i)
+		{
+			boost::uint32_t cp = s[i];
+			int ccc = combining_class(cp);
+
+			// Only characters with an NFC quick check of Maybe can be the second of a pair.
+			if((last_class < ccc || last_class == 0) && quick_check(cp, nfc) == quick_check_maybe)
+			{
+				boost::uint32_t composite = compose_pair(s[starter], cp);
+
+				if(composite)
+				{
+					s[starter] = composite;
+					continue;
+				}
+			}
+
+			if(!ccc)
+				starter = out;
+
+			last_class = ccc;
+			s[out++] = cp;
+		}
+
+		s.resize(out);
+	}
+
+	// Append the normalized form of the code points in [first, last) to out.
+	inline void normalize(const boost::uint32_t* first, const boost::uint32_t* last, normalization_form form, std::vector<boost::uint32_t>& out)
+	{
+		std::size_t start = out.size();
+		bool compatibility = form == nfkc || form == nfkd;
+
+		for(; first != last; ++first)
+		{
+			if(*first < 0x80)
+				out.push_back(*first);
+			else
+				decompose(*first, compatibility, out);
+		}
+
+		if(out.size() != start)
+			canonical_order(&out[start], &out[0] + out.size());
+
+		if(form == nfc || form == nfkc)
+			compose(out, start);
+	}
+
+	//--------------------------------------------------------------------------------
+	// Cutting a stream into segments
+	//--------------------------------------------------------------------------------
+
+	// How the decomposition of a character starts and ends.
+	struct segment_edges
+	{
+		std::size_t leading; // Non-starters at the start.
+		std::size_t trailing; // Non-starters at the end (all of them if there's no starter).
+		bool can_start; // Can normalizing start over at the character? It can if the decomposition starts with a starter that nothing before it composes with.
+	};
+
+	// The edges of cp's decomposition in the given form. scratch is used to decompose it.
+	inline segment_edges get_segment_edges(boost::uint32_t cp, normalization_form form, std::vector<boost::uint32_t>& scratch)
+	{
+		segment_edges ret;
+
+		scratch.clear();
+		decompose(cp, form == nfkc || form == nfkd, scratch);
+
+		for(ret.leading = 0; ret.leading < scratch.size() && combining_class(scratch[ret.leading]); ++ret.leading);
+		for(ret.trailing = 0; ret.trailing < scratch.size() && combining_class(scratch[scratch.size()-1-ret.trailing]); ++ret.trailing);
+
+		// Only characters with an NFC quick check of Maybe compose with what's before them.
+		ret.can_start = !ret.leading && !((form == nfc || form == nfkc) && quick_check(scratch[0], nfc) == quick_check_maybe);
+		return ret;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Strings and views. A basic_ustring converts to a ustring_view, so the functions
+	// that take a view work for both.
+	//--------------------------------------------------------------------------------
+
+	// The code points of s, normalized to the given form.
+	inline void normalize(const ustring_view& s, normalization_form form, std::vector<boost::uint32_t>& out)
+	{
+		std::vector<boost::uint32_t> in;
+		in.reserve(s.bytes());
+
+		for(ustring_view::iterator i=s.begin(); i != s.end(); ++i)
+			in.push_back(*i);
+
+		out.clear();
+
+		if(!in.empty())
+			normalize(&in[0], &in[0] + in.size(), form, out);
+	}
+
+	// Is s in the given normalization form? Usually only the quick check is needed.
+	inline bool is_normalized(const ustring_view& s, normalization_form form=nfc)
+	{
+		quick_check_result check = quick_check_utf8(s.data(), s.data() + s.bytes(), form);
+
+		if(check != quick_check_maybe)
+			return check == quick_check_yes;
+
+		std::vector<boost::uint32_t> out;
+		normalize(s, form, out);
+
+		ustring_view::iterator i = s.begin();
+		std::size_t n = 0;
+
+		for(; i != s.end() && n < out.size() && *i == out[n]; ++i, ++n);
+
+		return i == s.end() && n == out.size();
+	}
+
+	// Compare canonically equivalent strings as equal, e.g. "\u00E9" and "e\u0301".
+	inline int compare_canonical(const ustring_view& a, const ustring_view& b)
+	{
+		if(quick_check_utf8(a.data(), a.data() + a.bytes(), nfd) == quick_check_yes
+			&& quick_check_utf8(b.data(), b.data() + b.bytes(), nfd) == quick_check_yes)
+			return a.compare(b);
+
+		std::vector<boost::uint32_t> x, y;
+		normalize(a, nfd, x);
+		normalize(b, nfd, y);
+
+		return x < y ? -1 : y < x ? 1 : 0;
+	}
+
+	// A copy of s in the given normalization form.
+	template<class tpl_enc, class tpl_dec>
+	basic_ustring<tpl_enc, tpl_dec> normalize(const basic_ustring<tpl_enc, tpl_dec>& s, normalization_form form=nfc)
+	{
+		ustring_view v(s);
+
+		if(quick_check_utf8(v.data(), v.data() + v.bytes(), form) == quick_check_yes)
+			return s;
+
+		std::vector<boost::uint32_t> out;
+		normalize(v, form, out);
+
+		basic_ustring<tpl_enc, tpl_dec> ret;
+
+		for(std::size_t i=0; i < out.size(); ++i)
+			ret.append((utf32_unit)out[i]);
+
+		return ret;
+	}
+}
+
+#endif
@@ -0,0 +1,88 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_PROPERTIES_HPP
+#define BOOST_UNICODE_PROPERTIES_HPP
+
+#include <boost/cstdint.hpp>
+#include "properties_tables.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Character properties from the Unicode Character Database. Each character's
+	// properties are packed into a record shared by every character with the same ones,
+	// so looking them all up is one table lookup (see tools/ucdgen.py).
+	//================================================================================
+
+	struct character_properties
+	{
+		general_category category;
+		script_code script;
+		east_asian_width width;
+	};
+
+	inline character_properties properties(boost::uint32_t cp)
+	{
+		typedef properties_data<> data;
+
+		boost::uint32_t record = data::property_records[property_record(cp)];
+		character_properties ret;
+		ret.category = (general_category)(record & ((1 << data::width_shift) - 1));
+		ret.width = (east_asian_width)(record >> data::width_shift & ((1 << (data::script_shift - data::width_shift)) - 1));
+		ret.script = (script_code)(record >> data::script_shift);
+		return ret;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Classifying by general category.
+	//--------------------------------------------------------------------------------
+
+	inline bool is_letter(boost::uint32_t cp)
+	{
+		general_category gc = properties(cp).category;
+		return gc >= gc_uppercase_letter && gc <= gc_other_letter;
+	}
+
+	inline bool is_mark(boost::uint32_t cp)
+	{
+		general_category gc = properties(cp).category;
+		return gc >= gc_nonspacing_mark && gc <= gc_enclosing_mark;
+	}
+
+	inline bool is_number(boost::uint32_t cp)
+	{
+		general_category gc = properties(cp).category;
+		return gc >= gc_decimal_number && gc <= gc_other_number;
+	}
+
+	inline bool is_punctuation(boost::uint32_t cp)
+	{
+		general_category gc = properties(cp).category;
+		return gc >= gc_connector_punctuation && gc <= gc_other_punctuation;
+	}
+
+	inline bool is_symbol(boost::uint32_t cp)
+	{
+		general_category gc = properties(cp).category;
+		return gc >= gc_math_symbol && gc <= gc_other_symbol;
+	}
+
+	// Space, line and paragraph separators (not tabs or line breaks, which are controls).
+	inline bool is_separator(boost::uint32_t cp)
+	{
+		general_category gc = properties(cp).category;
+		return gc >= gc_space_separator && gc <= gc_paragraph_separator;
+	}
+
+	// Wide and fullwidth characters, which take two columns in East Asian text.
+	inline bool is_wide(boost::uint32_t cp)
+	{
+		east_asian_width w = properties(cp).width;
+		return w == eaw_wide || w == eaw_fullwidth;
+	}
+}
+
+#endif
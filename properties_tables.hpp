@@ -0,0 +1,1751 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tables for character properties (see properties.hpp).
+// Generated by tools/ucdgen.py from the Unicode Character Database 14.0.0. Don't edit.
+// Tables: 44992 bytes.
+
+#ifndef BOOST_UNICODE_PROPERTIES_TABLES_HPP
+#define BOOST_UNICODE_PROPERTIES_TABLES_HPP
+
+#include <boost/cstdint.hpp>
+
+namespace unicode
+{
+	enum general_category
+	{
+		gc_unassigned, // Unassigned
+		gc_uppercase_letter, // Uppercase Letter
+		gc_lowercase_letter, // Lowercase Letter
+		gc_titlecase_letter, // Titlecase Letter
+		gc_modifier_letter, // Modifier Letter
+		gc_other_letter, // Other Letter
+		gc_nonspacing_mark, // Nonspacing Mark
+		gc_spacing_mark, // Spacing Mark
+		gc_enclosing_mark, // Enclosing Mark
+		gc_decimal_number, // Decimal Number
+		gc_letter_number, // Letter Number
+		gc_other_number, // Other Number
+		gc_connector_punctuation, // Connector Punctuation
+		gc_dash_punctuation, // Dash Punctuation
+		gc_open_punctuation, // Open Punctuation
+		gc_close_punctuation, // Close Punctuation
+		gc_initial_punctuation, // Initial Punctuation
+		gc_final_punctuation, // Final Punctuation
+		gc_other_punctuation, // Other Punctuation
+		gc_math_symbol, // Math Symbol
+		gc_currency_symbol, // Currency Symbol
+		gc_modifier_symbol, // Modifier Symbol
+		gc_other_symbol, // Other Symbol
+		gc_space_separator, // Space Separator
+		gc_line_separator, // Line Separator
+		gc_paragraph_separator, // Paragraph Separator
+		gc_control, // Control
+		gc_format, // Format
+		gc_surrogate, // Surrogate
+		gc_private_use // Private Use
+	};
+
+	enum script_code
+	{
+		script_unknown, // Unknown
+		script_adlam, // Adlam
+		script_ahom, // Ahom
+		script_anatolian_hieroglyphs, // Anatolian Hieroglyphs
+		script_arabic, // Arabic
+		script_armenian, // Armenian
+		script_avestan, // Avestan
+		script_balinese, // Balinese
+		script_bamum, // Bamum
+		script_bassa_vah, // Bassa Vah
+		script_batak, // Batak
+		script_bengali, // Bengali
+		script_bhaiksuki, // Bhaiksuki
+		script_bopomofo, // Bopomofo
+		script_brahmi, // Brahmi
+		script_braille, // Braille
+		script_buginese, // Buginese
+		script_buhid, // Buhid
+		script_canadian_aboriginal, // Canadian Aboriginal
+		script_carian, // Carian
+		script_caucasian_albanian, // Caucasian Albanian
+		script_chakma, // Chakma
+		script_cham, // Cham
+		script_cherokee, // Cherokee
+		script_chorasmian, // Chorasmian
+		script_common, // Common
+		script_coptic, // Coptic
+		script_cuneiform, // Cuneiform
+		script_cypriot, // Cypriot
+		script_cypro_minoan, // Cypro Minoan
+		script_cyrillic, // Cyrillic
+		script_deseret, // Deseret
+		script_devanagari, // Devanagari
+		script_dives_akuru, // Dives Akuru
+		script_dogra, // Dogra
+		script_duployan, // Duployan
+		script_egyptian_hieroglyphs, // Egyptian Hieroglyphs
+		script_elbasan, // Elbasan
+		script_elymaic, // Elymaic
+		script_ethiopic, // Ethiopic
+		script_georgian, // Georgian
+		script_glagolitic, // Glagolitic
+		script_gothic, // Gothic
+		script_grantha, // Grantha
+		script_greek, // Greek
+		script_gujarati, // Gujarati
+		script_gunjala_gondi, // Gunjala Gondi
+		script_gurmukhi, // Gurmukhi
+		script_han, // Han
+		script_hangul, // Hangul
+		script_hanifi_rohingya, // Hanifi Rohingya
+		script_hanunoo, // Hanunoo
+		script_hatran, // Hatran
+		script_hebrew, // Hebrew
+		script_hiragana, // Hiragana
+		script_imperial_aramaic, // Imperial Aramaic
+		script_inherited, // Inherited
+		script_inscriptional_pahlavi, // Inscriptional Pahlavi
+		script_inscriptional_parthian, // Inscriptional Parthian
+		script_javanese, // Javanese
+		script_kaithi, // Kaithi
+		script_kannada, // Kannada
+		script_katakana, // Katakana
+		script_kayah_li, // Kayah Li
+		script_kharoshthi, // Kharoshthi
+		script_khitan_small_script, // Khitan Small Script
+		script_khmer, // Khmer
+		script_khojki, // Khojki
+		script_khudawadi, // Khudawadi
+		script_lao, // Lao
+		script_latin, // Latin
+		script_lepcha, // Lepcha
+		script_limbu, // Limbu
+		script_linear_a, // Linear A
+		script_linear_b, // Linear B
+		script_lisu, // Lisu
+		script_lycian, // Lycian
+		script_lydian, // Lydian
+		script_mahajani, // Mahajani
+		script_makasar, // Makasar
+		script_malayalam, // Malayalam
+		script_mandaic, // Mandaic
+		script_manichaean, // Manichaean
+		script_marchen, // Marchen
+		script_masaram_gondi, // Masaram Gondi
+		script_medefaidrin, // Medefaidrin
+		script_meetei_mayek, // Meetei Mayek
+		script_mende_kikakui, // Mende Kikakui
+		script_meroitic_cursive, // Meroitic Cursive
+		script_meroitic_hieroglyphs, // Meroitic Hieroglyphs
+		script_miao, // Miao
+		script_modi, // Modi
+		script_mongolian, // Mongolian
+		script_mro, // Mro
+		script_multani, // Multani
+		script_myanmar, // Myanmar
+		script_nabataean, // Nabataean
+		script_nandinagari, // Nandinagari
+		script_new_tai_lue, // New Tai Lue
+		script_newa, // Newa
+		script_nko, // Nko
+		script_nushu, // Nushu
+		script_nyiakeng_puachue_hmong, // Nyiakeng Puachue Hmong
+		script_ogham, // Ogham
+		script_ol_chiki, // Ol Chiki
+		script_old_hungarian, // Old Hungarian
+		script_old_italic, // Old Italic
+		script_old_north_arabian, // Old North Arabian
+		script_old_permic, // Old Permic
+		script_old_persian, // Old Persian
+		script_old_sogdian, // Old Sogdian
+		script_old_south_arabian, // Old South Arabian
+		script_old_turkic, // Old Turkic
+		script_old_uyghur, // Old Uyghur
+		script_oriya, // Oriya
+		script_osage, // Osage
+		script_osmanya, // Osmanya
+		script_pahawh_hmong, // Pahawh Hmong
+		script_palmyrene, // Palmyrene
+		script_pau_cin_hau, // Pau Cin Hau
+		script_phags_pa, // Phags Pa
+		script_phoenician, // Phoenician
+		script_psalter_pahlavi, // Psalter Pahlavi
+		script_rejang, // Rejang
+		script_runic, // Runic
+		script_samaritan, // Samaritan
+		script_saurashtra, // Saurashtra
+		script_sharada, // Sharada
+		script_shavian, // Shavian
+		script_siddham, // Siddham
+		script_sign_writing, // Sign Writing
+		script_sinhala, // Sinhala
+		script_sogdian, // Sogdian
+		script_sora_sompeng, // Sora Sompeng
+		script_soyombo, // Soyombo
+		script_sundanese, // Sundanese
+		script_syloti_nagri, // Syloti Nagri
+		script_syriac, // Syriac
+		script_tagalog, // Tagalog
+		script_tagbanwa, // Tagbanwa
+		script_tai_le, // Tai Le
+		script_tai_tham, // Tai Tham
+		script_tai_viet, // Tai Viet
+		script_takri, // Takri
+		script_tamil, // Tamil
+		script_tangsa, // Tangsa
+		script_tangut, // Tangut
+		script_telugu, // Telugu
+		script_thaana, // Thaana
+		script_thai, // Thai
+		script_tibetan, // Tibetan
+		script_tifinagh, // Tifinagh
+		script_tirhuta, // Tirhuta
+		script_toto, // Toto
+		script_ugaritic, // Ugaritic
+		script_vai, // Vai
+		script_vithkuqi, // Vithkuqi
+		script_wancho, // Wancho
+		script_warang_citi, // Warang Citi
+		script_yezidi, // Yezidi
+		script_yi, // Yi
+		script_zanabazar_square // Zanabazar Square
+	};
+
+	enum east_asian_width
+	{
+		eaw_neutral, // Neutral
+		eaw_ambiguous, // Ambiguous
+		eaw_halfwidth, // Halfwidth
+		eaw_wide, // Wide
+		eaw_fullwidth, // Fullwidth
+		eaw_narrow // Narrow
+	};
+
+	// The tables are static members of a class template so that they're only
+	// stored once however many translation units include this.
+	template<class T=void>
+	struct properties_data
+	{
+		static const boost::uint8_t property_record_stage1[2176];
+		static const boost::uint16_t property_record_stage2[3488];
+		static const boost::uint16_t property_record_stage3[17216];
+		static const int width_shift = 5;
+		static const int script_shift = 8;
+		static const boost::uint16_t property_records[704];
+	};
+
+	template<class T> const boost::uint8_t properties_data<T>::property_record_stage1[2176] = {
+		0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+		16,17,18,19,20,21,22,23,24,25,26,26,26,26,26,26,
+		26,26,26,26,26,26,27,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		28,29,30,31,32,33,34,34,34,34,34,34,34,34,34,34,
+		34,34,34,34,34,34,34,34,34,34,34,35,36,36,36,36,
+		37,37,37,37,37,37,37,37,37,37,37,37,38,39,40,41,
+		42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,
+		58,59,60,61,61,61,61,62,63,63,64,61,61,61,61,61,
+		61,61,65,66,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,67,68,61,69,70,70,70,70,70,70,70,70,
+		70,70,70,71,70,72,73,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,74,75,76,61,61,61,61,77,61,
+		61,61,61,61,61,61,61,78,79,80,81,82,83,84,61,85,
+		86,87,61,88,89,61,90,91,92,93,94,95,96,97,61,61,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,98,26,26,26,26,26,26,26,99,100,26,26,26,
+		26,26,26,26,26,26,26,101,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,102,103,103,103,103,103,103,26,104,103,105,
+		26,26,26,26,26,26,26,26,26,106,103,103,103,103,103,103,
+		103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+		103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+		103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+		103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+		103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+		103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+		103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,105,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		107,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,108,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+		37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,108
+	};
+
+	template<class T> const boost::uint16_t properties_data<T>::property_record_stage2[3488] = {
+		0,0,1,2,3,4,5,6,0,0,7,8,9,10,11,12,
+		13,14,15,16,17,18,15,19,20,21,22,23,24,25,26,27,
+		26,26,26,28,29,30,30,31,31,32,31,33,34,35,36,37,
+		38,38,38,38,38,38,38,39,40,41,42,43,44,45,46,47,
+		48,49,49,50,50,51,52,52,53,52,52,52,54,52,52,52,
+		52,52,52,55,56,57,58,58,59,60,61,62,63,64,65,66,
+		67,68,69,69,70,71,72,73,69,69,69,69,69,74,75,76,
+		77,78,79,80,81,69,69,69,82,82,83,84,85,86,87,88,
+		89,90,91,92,93,94,95,69,96,97,69,69,98,99,100,99,
+		101,102,102,103,104,105,106,107,108,109,110,111,112,113,114,115,
+		116,117,118,119,120,121,122,123,124,125,126,127,128,129,130,131,
+		132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,
+		148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,
+		164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,
+		180,181,181,182,183,184,185,185,186,187,188,189,190,191,185,185,
+		192,193,194,195,196,197,198,199,200,201,202,203,204,205,185,185,
+		206,206,207,208,209,210,211,212,213,214,215,215,216,217,217,218,
+		219,219,219,219,219,219,220,220,220,220,220,220,220,220,220,220,
+		221,221,221,221,222,223,221,221,222,221,221,224,225,226,221,221,
+		221,225,221,221,221,227,228,229,221,230,231,231,231,231,231,232,
+		233,234,234,234,234,234,234,234,234,234,234,234,234,234,234,234,
+		234,234,234,234,234,234,234,234,234,234,234,234,234,234,234,234,
+		234,234,234,234,234,234,235,234,236,237,238,238,238,238,239,240,
+		241,242,243,244,245,246,247,248,249,249,249,250,251,252,253,254,
+		255,256,257,257,258,257,257,259,260,257,261,234,234,234,234,262,
+		263,264,265,266,267,268,269,270,271,271,272,271,273,274,275,275,
+		276,277,278,278,278,279,280,281,282,282,283,284,285,185,185,185,
+		286,287,287,288,289,290,291,292,293,294,295,296,297,297,298,299,
+		300,300,301,302,303,304,305,306,307,215,215,308,309,310,311,312,
+		31,31,313,314,314,315,316,317,31,318,314,319,320,320,320,320,
+		26,26,26,26,26,26,26,26,26,321,26,26,26,26,26,26,
+		322,323,322,322,323,324,322,325,326,326,326,327,328,329,330,331,
+		332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,
+		348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,
+		364,365,366,367,368,369,370,371,372,373,374,375,371,371,371,371,
+		376,377,378,379,379,379,379,380,379,381,371,382,379,383,384,385,
+		379,379,386,185,387,185,388,388,388,389,390,390,390,390,391,388,
+		390,390,390,390,392,390,390,393,390,394,395,396,397,398,399,400,
+		401,402,379,379,403,404,405,406,379,407,408,409,410,411,412,413,
+		414,379,415,416,417,418,419,420,421,422,379,423,424,371,425,371,
+		426,426,426,426,426,426,426,426,426,426,426,426,426,426,426,426,
+		371,371,371,371,371,371,371,371,427,428,371,371,371,429,371,430,
+		371,371,371,371,371,371,371,371,371,371,371,371,371,371,371,371,
+		379,431,379,371,432,433,379,434,379,435,379,379,379,379,379,379,
+		436,436,436,437,437,437,438,439,440,440,440,440,440,440,441,442,
+		217,217,443,444,444,444,445,446,221,447,448,448,448,448,449,449,
+		450,451,452,453,454,455,185,185,456,457,456,456,456,456,456,458,
+		456,456,456,456,456,456,456,456,456,456,456,456,456,459,185,460,
+		461,462,463,464,465,466,466,466,466,467,468,469,469,469,469,470,
+		471,472,472,473,219,219,219,219,474,475,472,472,476,476,477,469,
+		478,479,480,476,481,482,478,483,480,476,476,482,476,484,484,485,
+		484,484,484,484,484,486,476,476,476,476,476,476,476,476,476,476,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,487,487,487,487,487,487,487,487,379,379,379,379,
+		488,489,488,488,488,488,488,488,488,488,488,488,488,488,488,488,
+		488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,
+		488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,
+		488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,
+		488,488,488,488,488,488,488,488,490,491,491,491,492,493,493,494,
+		495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
+		496,495,497,185,52,52,498,499,52,500,501,501,501,501,502,503,
+		37,504,505,506,26,26,26,507,508,509,510,511,512,513,185,514,
+		515,516,517,518,519,519,519,520,521,522,522,523,524,525,526,527,
+		528,529,530,531,532,533,219,534,535,536,536,537,538,539,540,541,
+		542,542,543,544,545,546,206,547,548,548,548,549,550,551,552,553,
+		554,555,448,31,31,556,557,558,558,558,558,558,559,559,560,561,
+		219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
+		219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
+		219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,219,
+		219,219,219,219,219,219,219,219,219,219,562,220,563,220,220,564,
+		565,565,565,565,565,565,565,565,565,565,565,565,565,565,565,565,
+		565,565,565,565,565,565,565,565,565,565,565,565,565,565,565,565,
+		566,566,566,566,566,566,566,566,566,566,566,566,566,566,566,566,
+		566,566,566,566,566,566,566,566,566,566,566,566,566,566,566,566,
+		566,566,566,566,566,566,566,566,566,566,566,566,566,566,566,566,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,487,487,567,487,487,487,487,487,487,568,569,569,
+		570,571,572,573,574,69,69,69,69,69,69,575,576,577,69,69,
+		69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+		69,69,69,578,579,69,69,69,69,580,69,69,581,185,185,582,
+		38,583,584,585,586,587,588,589,69,69,69,69,69,69,69,590,
+		591,592,593,594,595,596,597,598,599,600,601,602,603,604,605,606,
+		607,608,609,610,611,611,185,185,608,608,608,608,608,608,608,612,
+		613,421,421,614,615,615,615,616,617,618,619,185,185,379,379,620,
+		185,185,185,185,185,185,185,185,621,622,623,623,623,624,625,626,
+		627,627,628,629,630,631,631,632,633,634,635,635,636,637,185,185,
+		638,638,639,640,640,641,641,641,642,643,644,645,645,646,647,648,
+		649,649,650,651,651,651,652,653,653,654,655,656,185,185,185,185,
+		657,657,657,657,657,657,657,657,657,657,657,657,657,657,657,657,
+		657,657,657,658,657,659,660,185,661,314,314,662,185,185,185,185,
+		663,664,664,665,666,667,668,669,670,671,672,185,185,185,673,674,
+		675,676,677,678,185,185,185,185,679,679,680,681,682,683,682,682,
+		684,685,686,687,688,689,690,691,692,693,185,185,694,695,696,697,
+		698,698,698,699,700,701,702,703,704,705,706,185,185,185,185,185,
+		707,707,707,707,708,185,185,185,709,709,709,710,711,711,711,712,
+		713,713,714,715,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,716,717,718,718,719,720,185,185,185,185,
+		721,722,723,724,725,726,185,727,728,185,185,729,730,185,731,732,
+		733,734,734,735,736,737,738,739,740,741,741,742,743,744,745,746,
+		747,748,749,750,751,752,752,753,754,755,755,756,757,758,759,760,
+		761,762,763,764,185,185,185,185,765,766,767,768,768,769,770,771,
+		772,773,774,775,776,777,778,779,185,185,185,185,185,185,185,185,
+		780,780,780,781,782,783,784,185,785,785,785,786,787,788,185,185,
+		185,185,185,185,185,185,185,185,789,789,790,791,792,793,185,185,
+		794,794,794,795,796,797,798,185,799,799,800,801,802,185,185,185,
+		803,804,805,806,807,185,185,185,185,185,185,185,185,185,185,185,
+		808,808,809,810,185,185,185,185,185,185,811,811,812,812,813,814,
+		815,816,817,818,819,820,185,185,185,185,821,822,822,823,824,185,
+		825,826,826,827,828,829,830,830,831,832,833,234,834,834,834,835,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		836,837,838,839,840,841,842,843,844,845,846,847,185,185,185,185,
+		848,849,849,850,851,852,853,854,855,856,857,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,858,859,
+		185,185,185,185,185,185,185,185,185,185,185,860,861,862,863,864,
+		865,865,865,865,865,865,865,865,865,865,865,865,865,865,865,865,
+		865,865,865,865,865,865,865,865,865,865,865,865,865,865,865,865,
+		865,865,865,865,865,865,865,865,865,865,865,865,865,865,865,865,
+		865,865,865,865,865,865,865,865,865,866,185,185,185,185,185,185,
+		867,867,867,867,867,867,868,869,865,865,865,865,865,865,865,865,
+		865,865,865,865,870,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,871,871,871,871,871,871,872,
+		873,873,873,873,873,873,873,873,873,873,873,873,873,873,873,873,
+		873,873,873,873,873,873,873,873,873,873,873,873,873,873,873,873,
+		873,873,874,875,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		876,876,876,876,876,876,876,876,876,876,876,876,876,876,876,876,
+		876,876,876,876,876,876,876,876,876,876,876,876,876,876,876,876,
+		876,876,876,876,877,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
+		501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,501,
+		501,501,501,878,879,880,881,882,882,882,882,883,884,885,886,887,
+		888,888,888,889,890,891,892,893,888,185,185,185,185,185,185,185,
+		185,185,185,185,894,894,895,895,896,897,185,185,185,185,185,185,
+		898,898,898,898,899,900,901,901,902,903,185,185,185,185,904,905,
+		906,906,906,906,906,906,906,906,906,906,906,906,906,906,906,906,
+		906,906,906,906,906,906,906,906,906,906,906,906,906,906,906,906,
+		906,906,906,906,906,906,906,906,906,906,906,906,906,906,906,906,
+		906,906,906,906,906,906,906,906,906,906,906,906,906,906,906,907,
+		906,906,906,906,906,906,906,906,906,906,906,906,906,906,906,906,
+		908,908,908,908,908,908,908,908,908,908,908,908,908,908,908,908,
+		908,908,908,908,908,908,908,908,908,908,908,908,908,909,185,185,
+		910,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,911,
+		912,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+		466,466,913,185,185,914,915,916,916,916,916,916,916,916,916,916,
+		916,916,916,916,916,916,916,916,916,916,916,916,916,916,916,917,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		918,918,918,918,918,918,919,920,921,922,923,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		320,320,924,320,925,379,379,379,379,379,379,379,926,185,185,185,
+		379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,927,
+		379,379,928,379,379,379,929,930,931,379,932,379,379,379,387,185,
+		933,933,933,933,934,185,185,185,185,185,185,185,185,185,421,935,
+		379,379,379,379,379,386,421,936,185,185,185,185,185,185,185,185,
+		937,938,939,940,941,942,943,937,944,945,946,947,948,937,938,939,
+		949,950,939,951,952,953,954,937,955,939,937,938,939,940,941,939,
+		943,937,944,954,937,955,939,937,938,939,956,937,957,958,959,960,
+		939,961,937,962,963,964,965,939,966,937,967,939,968,969,969,969,
+		970,970,970,970,970,970,970,970,970,970,970,970,970,970,970,970,
+		970,970,970,970,970,970,970,970,970,970,970,970,970,970,970,970,
+		971,971,971,972,971,971,973,974,975,976,977,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		978,979,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		980,981,982,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		983,983,984,985,986,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,987,988,185,989,989,990,991,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,992,993,
+		994,994,994,994,994,994,994,994,994,994,994,994,995,996,185,185,
+		997,997,998,999,1000,1001,185,185,185,185,185,185,185,185,185,185,
+		185,185,185,185,185,185,185,1002,421,421,1003,1004,185,185,185,185,
+		1002,421,1005,1006,185,185,185,185,185,185,185,185,185,185,185,185,
+		1007,69,1008,1009,1010,1011,1012,1013,1014,1015,1016,1015,185,185,185,1017,
+		185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,
+		1018,379,1019,379,379,379,379,379,379,926,1020,1021,1022,1021,379,927,
+		1023,390,1024,390,390,390,1025,390,1026,1027,1028,185,185,185,1029,379,
+		1030,476,476,460,1031,1032,1033,185,185,185,185,185,185,185,185,185,
+		476,476,1034,1035,476,476,476,1036,476,404,476,476,1037,404,476,1038,
+		476,476,476,1039,1040,476,476,476,476,476,476,476,476,476,476,1041,
+		476,476,476,1042,1043,476,1044,1045,379,1046,1018,379,379,379,379,1047,
+		476,476,476,476,476,379,379,379,476,476,476,476,1048,1049,1050,1051,
+		379,379,379,379,379,379,379,926,379,379,379,379,379,1052,460,1053,
+		1019,379,379,379,1054,1055,379,379,1054,379,1056,1057,185,185,185,185,
+		1058,476,476,1059,1035,476,476,476,476,476,476,476,476,476,476,476,
+		379,379,379,379,379,926,1056,1060,1061,476,1062,1063,1033,1064,1065,1061,
+		379,379,379,379,379,379,379,379,379,1066,379,379,387,185,185,1067,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,569,569,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,1068,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,567,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,487,487,487,487,487,487,1069,487,487,487,487,487,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,1070,569,
+		569,569,569,569,569,569,569,569,569,569,569,569,569,569,569,569,
+		569,569,569,569,569,569,569,569,569,569,569,569,569,569,569,569,
+		487,567,569,569,569,569,569,569,569,569,569,569,569,569,569,569,
+		569,569,569,569,569,569,569,569,569,569,569,569,569,569,569,569,
+		569,569,569,569,569,569,569,569,569,569,569,569,569,569,569,569,
+		569,569,569,569,569,569,569,569,569,569,569,569,569,569,569,1071,
+		487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,
+		487,487,487,487,1072,569,569,569,569,569,569,569,569,569,569,569,
+		1073,185,1074,1074,1074,1074,1074,1074,185,185,185,185,185,185,185,185,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,185,
+		566,566,566,566,566,566,566,566,566,566,566,566,566,566,566,566,
+		566,566,566,566,566,566,566,566,566,566,566,566,566,566,566,1075
+	};
+
+	template<class T> const boost::uint16_t properties_data<T>::property_record_stage3[17216] = {
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		2,3,3,3,4,3,3,3,5,6,3,7,3,8,3,3,
+		9,9,9,9,9,9,9,9,9,9,3,3,7,7,7,3,
+		3,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,5,3,6,11,12,
+		11,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+		13,13,13,13,13,13,13,13,13,13,13,5,7,6,7,1,
+		14,15,4,4,16,4,17,15,18,19,20,21,7,22,23,11,
+		23,24,25,25,18,26,15,15,18,25,20,27,25,25,25,15,
+		28,28,28,28,28,28,29,28,28,28,28,28,28,28,28,28,
+		29,28,28,28,28,28,28,24,29,28,28,28,28,28,29,30,
+		30,30,31,31,31,31,30,31,30,30,30,31,30,30,31,31,
+		30,31,30,30,31,31,31,24,30,30,30,31,30,31,30,31,
+		28,30,28,31,28,31,28,31,28,31,28,31,28,31,28,31,
+		28,30,28,30,28,31,28,31,28,31,28,30,28,31,28,31,
+		28,31,28,31,28,31,29,30,28,31,28,30,28,31,28,31,
+		28,30,29,30,28,31,28,31,30,28,31,28,31,28,31,29,
+		30,29,30,28,30,28,31,28,30,30,29,30,28,30,28,31,
+		28,31,29,30,28,31,28,31,28,31,28,31,28,31,28,31,
+		28,31,28,31,28,31,28,31,28,28,31,28,31,28,31,31,
+		31,28,28,31,28,31,28,28,31,28,28,28,31,31,28,28,
+		28,28,31,28,28,31,28,28,28,31,31,31,28,28,31,28,
+		28,31,28,31,28,31,28,28,31,28,31,31,28,31,28,28,
+		31,28,28,28,31,28,31,28,28,31,31,32,28,31,31,31,
+		32,32,32,32,28,33,31,28,33,31,28,33,31,28,30,28,
+		30,28,30,28,30,28,30,28,30,28,30,28,30,31,28,31,
+		28,31,28,31,28,31,28,31,28,31,28,31,28,31,28,31,
+		31,28,33,31,28,31,28,28,28,31,28,31,28,31,28,31,
+		28,31,28,31,31,31,31,31,31,31,28,28,31,28,28,31,
+		31,28,31,28,28,28,28,31,28,31,28,31,28,31,28,31,
+		31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+		31,31,31,31,32,31,31,31,31,31,31,31,31,31,31,31,
+		34,34,34,34,34,34,34,34,34,35,35,35,35,35,35,35,
+		35,35,36,36,18,36,35,37,35,37,37,37,35,37,35,35,
+		37,35,36,36,36,36,36,36,18,18,18,18,36,18,36,18,
+		34,34,34,34,34,36,36,36,36,36,38,38,35,36,35,36,
+		36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+		39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+		40,41,40,41,35,42,40,41,0,0,43,41,41,41,44,40,
+		0,0,0,0,42,36,40,44,40,40,40,0,40,0,40,40,
+		41,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+		45,45,0,45,45,45,45,45,45,45,40,40,41,41,41,41,
+		41,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+		46,46,41,46,46,46,46,46,46,46,41,41,41,41,41,40,
+		41,41,40,40,40,41,41,41,40,41,40,41,40,41,40,41,
+		40,41,47,48,47,48,47,48,47,48,47,48,47,48,47,48,
+		41,41,41,41,40,41,49,40,41,40,40,41,41,40,40,40,
+		50,51,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+		51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+		52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+		53,52,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+		50,53,50,53,50,53,50,53,50,53,50,53,50,53,50,53,
+		50,53,54,55,55,56,56,55,57,57,50,53,50,53,50,53,
+		50,50,53,50,53,50,53,50,53,50,53,50,53,50,53,53,
+		0,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+		58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+		58,58,58,58,58,58,58,0,0,59,60,60,60,60,60,60,
+		61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+		61,61,61,61,61,61,61,61,61,60,62,0,0,63,63,64,
+		0,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+		65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+		65,65,65,65,65,65,65,65,65,65,65,65,65,65,66,65,
+		67,65,65,67,65,65,67,65,0,0,0,0,0,0,0,0,
+		68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+		68,68,68,68,68,68,68,68,68,68,68,0,0,0,0,68,
+		68,68,68,67,67,0,0,0,0,0,0,0,0,0,0,0,
+		69,69,69,69,69,70,71,71,71,72,72,73,44,72,74,74,
+		75,75,75,75,75,75,75,75,75,75,75,44,69,72,72,44,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		35,76,76,76,76,76,76,76,76,76,76,56,56,56,56,56,
+		56,56,56,56,56,56,75,75,75,75,75,75,75,75,75,75,
+		77,77,77,77,77,77,77,77,77,77,72,72,72,72,76,76,
+		56,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,72,76,75,75,75,75,75,75,75,70,74,75,
+		75,75,75,75,75,78,78,75,75,74,75,75,75,75,76,76,
+		77,77,77,77,77,77,77,77,77,77,76,76,76,74,74,76,
+		79,79,79,79,79,79,79,79,79,79,79,79,79,79,0,80,
+		81,82,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+		81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+		82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+		82,82,82,82,82,82,82,82,82,82,82,0,0,81,81,81,
+		83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+		83,83,83,83,83,83,84,84,84,84,84,84,84,84,84,84,
+		84,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		85,85,85,85,85,85,85,85,85,85,86,86,86,86,86,86,
+		86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+		86,86,86,86,86,86,86,86,86,86,86,87,87,87,87,87,
+		87,87,87,87,88,88,89,90,90,90,88,0,0,87,91,91,
+		92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+		92,92,92,92,92,92,93,93,93,93,94,93,93,93,93,93,
+		93,93,93,93,94,93,93,93,94,93,93,93,93,93,0,0,
+		95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,0,
+		96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+		96,96,96,96,96,96,96,96,96,97,97,97,0,0,98,0,
+		81,81,81,81,81,81,81,81,81,81,81,0,0,0,0,0,
+		76,76,76,76,76,76,76,76,99,76,76,76,76,76,76,0,
+		69,69,0,0,0,0,0,0,75,75,75,75,75,75,75,75,
+		76,76,76,76,76,76,76,76,76,78,75,75,75,75,75,75,
+		75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,
+		75,75,70,75,75,75,75,75,75,75,75,75,75,75,75,75,
+		100,100,100,101,102,102,102,102,102,102,102,102,102,102,102,102,
+		102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
+		102,102,102,102,102,102,102,102,102,102,100,101,100,102,101,101,
+		101,100,100,100,100,100,100,100,100,101,101,101,101,100,101,101,
+		102,56,56,56,56,100,100,100,102,102,102,102,102,102,102,102,
+		102,102,100,100,44,44,103,103,103,103,103,103,103,103,103,103,
+		104,105,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
+		106,107,108,108,0,106,106,106,106,106,106,106,106,0,0,106,
+		106,0,0,106,106,106,106,106,106,106,106,106,106,106,106,106,
+		106,106,106,106,106,106,106,106,106,0,106,106,106,106,106,106,
+		106,0,106,0,0,0,106,106,106,106,0,0,107,106,108,108,
+		108,107,107,107,107,0,0,108,108,0,0,108,108,107,106,0,
+		0,0,0,0,0,0,0,108,0,0,0,0,106,106,0,106,
+		106,106,107,107,0,0,109,109,109,109,109,109,109,109,109,109,
+		106,106,110,110,111,111,111,111,111,111,112,110,106,113,107,0,
+		0,114,114,115,0,116,116,116,116,116,116,0,0,0,0,116,
+		116,0,0,116,116,116,116,116,116,116,116,116,116,116,116,116,
+		116,116,116,116,116,116,116,116,116,0,116,116,116,116,116,116,
+		116,0,116,116,0,116,116,0,116,116,0,0,114,0,115,115,
+		115,114,114,0,0,0,0,114,114,0,0,114,114,114,0,0,
+		0,114,0,0,0,0,0,0,0,116,116,116,116,0,116,0,
+		0,0,0,0,0,0,117,117,117,117,117,117,117,117,117,117,
+		114,114,116,116,116,114,118,0,0,0,0,0,0,0,0,0,
+		0,119,119,120,0,121,121,121,121,121,121,121,121,121,0,121,
+		121,121,0,121,121,121,121,121,121,121,121,121,121,121,121,121,
+		121,121,121,121,121,121,121,121,121,0,121,121,121,121,121,121,
+		121,0,121,121,0,121,121,121,121,121,0,0,119,121,120,120,
+		120,119,119,119,119,119,0,119,119,120,0,120,120,119,0,0,
+		121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		121,121,119,119,0,0,122,122,122,122,122,122,122,122,122,122,
+		123,124,0,0,0,0,0,0,0,121,119,119,119,119,119,119,
+		0,125,126,126,0,127,127,127,127,127,127,127,127,0,0,127,
+		127,0,0,127,127,127,127,127,127,127,127,127,127,127,127,127,
+		127,127,127,127,127,127,127,127,127,0,127,127,127,127,127,127,
+		127,0,127,127,0,127,127,127,127,127,0,0,125,127,126,125,
+		126,125,125,125,125,0,0,126,126,0,0,126,126,125,0,0,
+		0,0,0,0,0,125,125,126,0,0,0,0,127,127,0,127,
+		127,127,125,125,0,0,128,128,128,128,128,128,128,128,128,128,
+		129,127,130,130,130,130,130,130,0,0,0,0,0,0,0,0,
+		0,0,131,132,0,132,132,132,132,132,132,0,0,0,132,132,
+		132,0,132,132,132,132,0,0,0,132,132,0,132,0,132,132,
+		0,0,0,132,132,0,0,0,132,132,132,0,0,0,132,132,
+		132,132,132,132,132,132,132,132,132,132,0,0,0,0,133,133,
+		131,133,133,0,0,0,133,133,133,0,133,133,133,131,0,0,
+		132,0,0,0,0,0,0,133,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,134,134,134,134,134,134,134,134,134,134,
+		135,135,135,136,136,136,136,136,136,137,136,0,0,0,0,0,
+		138,139,139,139,138,140,140,140,140,140,140,140,140,0,140,140,
+		140,0,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+		140,140,140,140,140,140,140,140,140,0,140,140,140,140,140,140,
+		140,140,140,140,140,140,140,140,140,140,0,0,138,140,138,138,
+		138,139,139,139,139,0,138,138,138,0,138,138,138,138,0,0,
+		0,0,0,0,0,138,138,0,140,140,140,0,0,140,0,0,
+		140,140,138,138,0,0,141,141,141,141,141,141,141,141,141,141,
+		0,0,0,0,0,0,0,142,143,143,143,143,143,143,143,144,
+		145,146,147,147,148,145,145,145,145,145,145,145,145,0,145,145,
+		145,0,145,145,145,145,145,145,145,145,145,145,145,145,145,145,
+		145,145,145,145,145,145,145,145,145,0,145,145,145,145,145,145,
+		145,145,145,145,0,145,145,145,145,145,0,0,146,145,147,146,
+		147,147,147,147,147,0,146,147,147,0,147,147,146,146,0,0,
+		0,0,0,0,0,147,147,0,0,0,0,0,0,145,145,0,
+		145,145,146,146,0,0,149,149,149,149,149,149,149,149,149,149,
+		0,145,145,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		150,150,151,151,152,152,152,152,152,152,152,152,152,0,152,152,
+		152,0,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+		152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+		152,152,152,152,152,152,152,152,152,152,152,150,150,152,151,151,
+		151,150,150,150,150,0,151,151,151,0,151,151,151,150,152,153,
+		0,0,0,0,152,152,152,151,154,154,154,154,154,154,154,152,
+		152,152,150,150,0,0,155,155,155,155,155,155,155,155,155,155,
+		154,154,154,154,154,154,154,154,154,153,152,152,152,152,152,152,
+		0,156,157,157,0,158,158,158,158,158,158,158,158,158,158,158,
+		158,158,158,158,158,158,158,0,0,0,158,158,158,158,158,158,
+		158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+		158,158,0,158,158,158,158,158,158,158,158,158,0,158,0,0,
+		158,158,158,158,158,158,158,0,0,0,156,0,0,0,0,157,
+		157,157,156,156,156,0,156,0,157,157,157,157,157,157,157,157,
+		0,0,0,0,0,0,159,159,159,159,159,159,159,159,159,159,
+		0,0,157,157,160,0,0,0,0,0,0,0,0,0,0,0,
+		0,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+		161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+		161,162,161,161,162,162,162,162,162,162,162,0,0,0,0,163,
+		161,161,161,161,161,161,164,162,162,162,162,162,162,162,162,165,
+		166,166,166,166,166,166,166,166,166,166,165,165,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,167,167,0,167,0,167,167,167,167,167,0,167,167,167,167,
+		167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,
+		167,167,167,167,0,167,0,167,167,167,167,167,167,167,167,167,
+		167,168,167,167,168,168,168,168,168,168,168,168,168,167,0,0,
+		167,167,167,167,167,0,169,0,168,168,168,168,168,168,0,0,
+		170,170,170,170,170,170,170,170,170,170,0,0,167,167,167,167,
+		171,172,172,172,173,173,173,173,173,173,173,173,173,173,173,173,
+		173,173,173,172,173,172,172,172,174,174,172,172,172,172,172,172,
+		175,175,175,175,175,175,175,175,175,175,176,176,176,176,176,176,
+		176,176,176,176,172,174,172,174,172,174,177,178,177,178,179,179,
+		171,171,171,171,171,171,171,171,0,171,171,171,171,171,171,171,
+		171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,
+		171,171,171,171,171,171,171,171,171,171,171,171,171,0,0,0,
+		0,174,174,174,174,174,174,174,174,174,174,174,174,174,174,179,
+		174,174,174,174,174,173,174,174,171,171,171,171,171,174,174,174,
+		174,174,174,174,174,174,174,174,0,174,174,174,174,174,174,174,
+		174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,
+		174,174,174,174,174,174,174,174,174,174,174,174,174,0,172,172,
+		172,172,172,172,172,172,174,172,172,172,172,172,172,0,172,172,
+		173,173,173,173,173,19,19,19,19,173,173,0,0,0,0,0,
+		180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+		180,180,180,180,180,180,180,180,180,180,180,181,181,182,182,182,
+		182,181,182,182,182,182,182,182,181,182,182,181,181,182,182,180,
+		183,183,183,183,183,183,183,183,183,183,184,184,184,184,184,184,
+		180,180,180,180,180,180,181,181,182,182,180,180,180,180,182,182,
+		182,180,181,181,181,180,180,181,181,181,181,181,181,181,180,180,
+		180,182,182,182,182,180,180,180,180,180,180,180,180,180,180,180,
+		180,180,182,181,181,182,182,181,181,181,181,181,181,182,180,181,
+		183,183,183,183,183,183,183,183,183,183,181,181,181,182,185,185,
+		186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,
+		186,186,186,186,186,186,0,186,0,0,0,0,0,186,0,0,
+		187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,
+		187,187,187,187,187,187,187,187,187,187,187,44,188,187,187,187,
+		189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+		190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+		191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+		191,191,191,191,191,191,191,191,191,0,191,191,191,191,0,0,
+		191,191,191,191,191,191,191,0,191,0,191,191,191,191,0,0,
+		191,0,191,191,191,191,0,0,191,191,191,191,191,191,191,0,
+		191,0,191,191,191,191,0,0,191,191,191,191,191,191,191,191,
+		191,191,191,191,191,191,191,0,191,191,191,191,191,191,191,191,
+		191,191,191,191,191,191,191,191,191,191,191,0,0,192,192,192,
+		193,193,193,193,193,193,193,193,193,194,194,194,194,194,194,194,
+		194,194,194,194,194,194,194,194,194,194,194,194,194,0,0,0,
+		195,195,195,195,195,195,195,195,195,195,0,0,0,0,0,0,
+		196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,
+		196,196,196,196,196,196,0,0,197,197,197,197,197,197,0,0,
+		198,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,
+		199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,
+		199,199,199,199,199,199,199,199,199,199,199,199,199,200,201,199,
+		202,203,203,203,203,203,203,203,203,203,203,203,203,203,203,203,
+		203,203,203,203,203,203,203,203,203,203,203,204,205,0,0,0,
+		206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+		206,206,206,206,206,206,206,206,206,206,206,44,44,44,207,207,
+		207,206,206,206,206,206,206,206,206,0,0,0,0,0,0,0,
+		208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,
+		208,208,209,209,209,210,0,0,0,0,0,0,0,0,0,208,
+		211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,
+		211,211,212,212,213,44,44,0,0,0,0,0,0,0,0,0,
+		214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,
+		214,214,215,215,0,0,0,0,0,0,0,0,0,0,0,0,
+		216,216,216,216,216,216,216,216,216,216,216,216,216,0,216,216,
+		216,0,217,217,0,0,0,0,0,0,0,0,0,0,0,0,
+		218,218,218,218,218,218,218,218,218,218,218,218,218,218,218,218,
+		218,218,218,218,219,219,220,219,219,219,219,219,219,219,220,220,
+		220,220,220,220,220,220,219,220,220,219,219,219,219,219,219,219,
+		219,219,219,219,221,221,221,222,221,221,221,223,218,219,0,0,
+		224,224,224,224,224,224,224,224,224,224,0,0,0,0,0,0,
+		225,225,225,225,225,225,225,225,225,225,0,0,0,0,0,0,
+		226,226,44,44,226,44,227,226,226,226,226,228,228,228,229,228,
+		230,230,230,230,230,230,230,230,230,230,0,0,0,0,0,0,
+		231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,
+		231,231,231,232,231,231,231,231,231,231,231,231,231,231,231,231,
+		231,231,231,231,231,231,231,231,231,0,0,0,0,0,0,0,
+		231,231,231,231,231,228,228,231,231,231,231,231,231,231,231,231,
+		231,231,231,231,231,231,231,231,231,228,231,0,0,0,0,0,
+		199,199,199,199,199,199,0,0,0,0,0,0,0,0,0,0,
+		233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,
+		233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,0,
+		234,234,234,235,235,235,235,234,234,235,235,235,0,0,0,0,
+		235,235,234,235,235,235,235,235,235,234,234,234,0,0,0,0,
+		236,0,0,0,237,237,238,238,238,238,238,238,238,238,238,238,
+		239,239,239,239,239,239,239,239,239,239,239,239,239,239,239,239,
+		239,239,239,239,239,239,239,239,239,239,239,239,239,239,0,0,
+		239,239,239,239,239,0,0,0,0,0,0,0,0,0,0,0,
+		240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,
+		240,240,240,240,240,240,240,240,240,240,240,240,0,0,0,0,
+		240,240,240,240,240,240,240,240,240,240,0,0,0,0,0,0,
+		241,241,241,241,241,241,241,241,241,241,242,0,0,0,243,243,
+		244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,244,
+		245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,
+		245,245,245,245,245,245,245,246,246,247,247,246,0,0,248,248,
+		249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+		249,249,249,249,249,250,251,250,251,251,251,251,251,251,251,0,
+		251,250,251,250,250,251,251,251,251,251,251,251,251,250,250,250,
+		250,250,250,251,251,251,251,251,251,251,251,251,251,0,0,251,
+		252,252,252,252,252,252,252,252,252,252,0,0,0,0,0,0,
+		253,253,253,253,253,253,253,254,253,253,253,253,253,253,0,0,
+		56,56,56,56,56,56,56,56,56,56,56,56,56,56,255,56,
+		56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,0,
+		256,256,256,256,257,258,258,258,258,258,258,258,258,258,258,258,
+		258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+		258,258,258,258,256,257,256,256,256,256,256,257,256,257,257,257,
+		257,257,256,257,257,258,258,258,258,258,258,258,258,0,0,0,
+		259,259,259,259,259,259,259,259,259,259,260,260,260,260,260,260,
+		260,261,261,261,261,261,261,261,261,261,261,256,256,256,256,256,
+		256,256,256,256,261,261,261,261,261,261,261,261,261,260,260,0,
+		262,262,263,264,264,264,264,264,264,264,264,264,264,264,264,264,
+		264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,
+		264,263,262,262,262,262,263,263,262,262,263,262,262,262,264,264,
+		265,265,265,265,265,265,265,265,265,265,264,264,264,264,264,264,
+		266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,
+		266,266,266,266,266,266,267,268,267,267,268,268,268,267,268,267,
+		267,267,268,268,0,0,0,0,0,0,0,0,269,269,269,269,
+		270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+		270,270,270,270,271,271,271,271,271,271,271,271,272,272,272,272,
+		272,272,272,272,271,271,272,272,0,0,0,273,273,273,273,273,
+		274,274,274,274,274,274,274,274,274,274,0,0,0,270,270,270,
+		275,275,275,275,275,275,275,275,275,275,276,276,276,276,276,276,
+		276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,
+		276,276,276,276,276,276,276,276,277,277,277,277,277,277,278,278,
+		53,53,53,53,53,53,53,53,53,0,0,0,0,0,0,0,
+		186,186,186,186,186,186,186,186,186,186,186,0,0,186,186,186,
+		279,279,279,279,279,279,279,279,0,0,0,0,0,0,0,0,
+		56,56,56,44,56,56,56,56,56,56,56,56,56,56,56,56,
+		56,280,56,56,56,56,56,56,56,281,281,281,281,56,281,281,
+		281,281,281,281,56,281,281,280,56,56,281,0,0,0,0,0,
+		31,31,31,31,31,31,41,41,41,41,41,53,34,34,34,34,
+		34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+		34,34,34,34,34,34,34,34,34,34,34,34,34,43,43,43,
+		43,43,34,34,34,34,43,43,43,43,43,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,282,31,31,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,34,34,34,34,34,
+		34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,43,
+		56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,
+		28,31,28,31,28,31,31,31,31,31,31,31,31,31,28,31,
+		41,41,41,41,41,41,41,41,40,40,40,40,40,40,40,40,
+		41,41,41,41,41,41,0,0,40,40,40,40,40,40,0,0,
+		41,41,41,41,41,41,41,41,0,40,0,40,0,40,0,40,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,0,0,
+		41,41,41,41,41,41,41,41,283,283,283,283,283,283,283,283,
+		41,41,41,41,41,0,41,41,40,40,40,40,283,42,41,42,
+		42,42,41,41,41,0,41,41,40,40,40,40,283,42,42,42,
+		41,41,41,41,0,0,41,41,40,40,40,40,0,42,42,42,
+		41,41,41,41,41,41,41,41,40,40,40,40,40,42,42,42,
+		0,0,41,41,41,0,41,41,40,40,40,40,283,42,42,0,
+		14,14,14,14,14,14,14,14,14,14,14,70,284,284,70,70,
+		285,286,286,285,285,285,15,44,287,288,289,21,287,288,289,21,
+		15,15,15,44,15,15,15,15,290,291,70,70,70,70,70,14,
+		15,44,15,15,44,15,44,44,44,21,27,15,44,44,15,292,
+		292,44,44,44,293,289,294,44,44,44,44,44,44,44,44,44,
+		44,44,293,44,292,44,44,44,44,44,44,44,44,44,44,14,
+		70,70,70,70,70,0,70,70,70,70,70,70,70,70,70,70,
+		295,34,0,0,25,295,295,295,295,295,293,293,293,289,294,296,
+		295,25,25,25,25,295,295,295,295,295,293,293,293,289,294,0,
+		34,34,34,34,34,34,34,34,34,34,34,34,34,0,0,0,
+		163,163,163,163,163,163,163,163,163,297,163,163,16,163,163,163,
+		163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,
+		163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		56,56,56,56,56,56,56,56,56,56,56,56,56,255,255,255,
+		255,56,255,255,255,56,56,56,56,56,56,56,56,56,56,56,
+		56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		19,19,298,23,19,23,19,298,19,23,26,298,298,298,26,26,
+		298,298,298,299,19,298,23,19,293,298,298,298,298,298,19,19,
+		19,23,23,19,298,19,45,19,298,19,28,29,298,298,19,26,
+		298,298,28,298,26,281,281,281,281,26,19,19,26,26,298,298,
+		293,293,293,293,293,298,26,26,26,26,19,293,19,19,31,19,
+		295,295,295,25,25,295,295,295,295,295,295,25,25,25,25,295,
+		300,300,300,300,300,300,300,300,300,300,300,300,301,301,301,301,
+		300,300,300,300,300,300,300,300,300,300,301,301,301,301,301,301,
+		301,301,301,28,31,301,301,301,301,25,19,19,0,0,0,0,
+		24,24,24,24,24,23,23,23,23,23,293,293,19,19,19,19,
+		293,19,19,293,19,19,293,19,19,19,19,19,19,19,293,19,
+		19,19,19,19,19,19,19,19,23,23,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,19,19,19,293,293,
+		19,19,24,19,24,19,19,19,19,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,23,19,19,19,19,19,19,19,19,
+		19,19,19,19,293,293,293,293,293,293,293,293,293,293,293,293,
+		24,293,24,24,293,293,293,24,24,293,293,24,293,293,293,24,
+		293,24,293,293,293,24,293,293,293,293,24,293,293,24,24,24,
+		24,293,293,24,293,24,293,24,24,24,24,24,24,293,24,293,
+		293,293,293,293,24,24,24,24,293,293,293,293,24,24,293,293,
+		293,293,293,293,293,293,293,293,24,293,293,293,24,293,293,293,
+		293,293,24,293,293,293,293,293,293,293,293,293,293,293,293,293,
+		24,24,293,293,24,24,24,24,293,293,24,24,293,293,24,24,
+		293,293,293,293,293,293,293,293,293,293,293,293,293,293,293,293,
+		293,293,24,24,293,293,24,24,293,293,293,293,293,293,293,293,
+		293,293,293,293,293,24,293,293,293,24,293,293,293,293,293,293,
+		293,293,293,293,293,24,293,293,293,293,293,293,293,293,293,293,
+		293,293,293,293,293,293,293,293,293,293,293,293,293,293,293,24,
+		19,19,19,19,19,19,19,19,289,294,289,294,19,19,19,19,
+		19,19,23,19,19,19,19,19,19,19,302,302,19,19,19,19,
+		293,293,19,19,19,19,19,19,19,303,304,19,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,19,293,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,293,293,293,293,293,
+		293,293,293,293,19,19,19,19,19,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,19,293,293,293,293,
+		293,293,19,19,19,19,19,19,19,302,302,302,302,19,19,19,
+		302,19,19,302,19,19,19,19,19,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,0,0,0,0,0,0,0,0,0,
+		19,19,19,19,19,19,19,19,19,19,19,0,0,0,0,0,
+		25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+		25,25,25,25,25,25,25,25,25,25,25,25,23,23,23,23,
+		23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+		23,23,23,23,23,23,23,23,23,23,295,25,25,25,25,25,
+		23,23,23,23,23,23,23,23,23,23,23,23,19,19,19,19,
+		23,23,23,23,19,19,19,19,19,19,19,19,19,19,19,19,
+		19,19,23,23,23,23,19,19,19,19,19,19,19,19,19,19,
+		23,23,19,23,23,23,23,23,23,23,19,19,19,19,19,19,
+		19,19,23,23,19,19,23,24,19,19,19,19,23,23,19,19,
+		23,24,19,19,19,19,23,23,23,19,19,23,19,19,23,23,
+		23,23,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+		19,19,23,23,23,23,19,19,19,19,19,19,19,19,19,23,
+		19,19,19,19,19,19,19,19,293,293,293,293,293,305,305,293,
+		19,19,19,19,19,23,23,19,19,23,19,19,19,19,23,23,
+		19,19,19,19,302,302,19,19,19,19,19,19,23,19,23,19,
+		23,19,23,19,19,19,19,19,302,302,302,302,302,302,302,302,
+		302,302,302,302,19,19,19,19,19,19,19,19,19,19,19,19,
+		23,23,19,23,23,23,19,23,23,23,23,19,23,23,19,24,
+		19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,302,
+		19,19,19,302,19,19,19,19,19,19,19,19,19,19,23,23,
+		19,302,19,19,19,19,19,19,19,19,302,302,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,19,19,302,302,23,
+		19,19,19,19,302,302,23,23,23,23,23,23,23,23,302,23,
+		23,23,23,23,302,23,23,23,23,23,23,23,23,23,23,23,
+		23,23,19,23,19,19,19,19,23,23,302,23,23,23,23,23,
+		23,23,302,302,23,302,23,23,23,23,302,23,23,302,23,23,
+		19,19,19,19,19,302,19,19,19,19,302,302,19,19,19,19,
+		19,19,19,19,19,19,19,19,302,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,19,19,23,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,19,302,19,302,19,
+		19,19,19,302,302,302,19,302,19,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,19,289,294,289,294,289,294,289,294,
+		289,294,289,294,289,294,25,25,25,25,25,25,25,25,25,25,
+		295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
+		295,295,295,295,19,302,302,302,19,19,19,19,19,19,19,19,
+		302,19,19,19,19,19,19,19,19,19,19,19,19,19,19,302,
+		293,293,293,293,293,289,294,293,293,293,293,293,293,293,293,293,
+		293,293,293,293,293,293,5,6,5,6,5,6,5,6,289,294,
+		306,306,306,306,306,306,306,306,306,306,306,306,306,306,306,306,
+		293,293,293,289,294,5,6,289,294,289,294,289,294,289,294,289,
+		294,289,294,289,294,289,294,289,294,293,293,293,293,293,293,293,
+		293,293,293,293,293,293,293,293,289,294,289,294,293,293,293,293,
+		293,293,293,293,293,293,293,293,293,293,293,293,289,294,293,293,
+		19,19,19,19,19,19,19,19,19,19,19,302,302,19,19,19,
+		293,293,293,293,293,19,19,293,293,293,293,293,293,19,19,19,
+		302,19,19,19,19,302,23,23,23,23,19,19,19,19,19,19,
+		19,19,19,19,0,0,19,19,19,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,0,19,19,19,19,19,19,19,19,19,
+		307,307,307,307,307,307,307,307,307,307,307,307,307,307,307,307,
+		308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,
+		28,31,28,28,28,31,31,28,31,28,31,28,31,28,28,28,
+		28,31,28,31,31,28,31,31,31,31,31,31,34,34,28,28,
+		47,48,47,48,47,48,47,48,47,48,47,48,47,48,47,48,
+		47,48,47,48,48,309,309,309,309,309,309,47,48,47,48,310,
+		310,310,47,48,0,0,0,0,0,311,311,311,311,312,311,311,
+		187,187,187,187,187,187,0,187,0,0,0,0,0,187,0,0,
+		313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,313,
+		313,313,313,313,313,313,313,313,0,0,0,0,0,0,0,314,
+		315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,316,
+		191,191,191,191,191,191,191,0,0,0,0,0,0,0,0,0,
+		191,191,191,191,191,191,191,0,191,191,191,191,191,191,191,0,
+		55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+		44,44,21,27,21,27,44,44,44,21,27,44,21,27,44,44,
+		44,44,44,44,44,44,44,286,44,44,286,44,21,27,44,44,
+		21,27,289,294,289,294,289,294,289,294,44,44,44,44,44,35,
+		44,44,44,44,44,44,44,44,44,44,286,286,44,44,44,44,
+		286,44,289,44,44,44,44,44,44,44,44,44,44,44,44,44,
+		19,19,44,44,44,289,294,289,294,289,294,289,294,286,0,0,
+		317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,
+		317,317,317,317,317,317,317,317,317,317,0,317,317,317,317,317,
+		317,317,317,317,0,0,0,0,0,0,0,0,0,0,0,0,
+		317,317,317,317,317,317,0,0,0,0,0,0,0,0,0,0,
+		302,302,302,302,302,302,302,302,302,302,302,302,0,0,0,0,
+		318,319,319,319,302,320,321,322,303,304,303,304,303,304,303,304,
+		303,304,302,302,303,304,303,304,303,304,303,304,323,303,304,304,
+		302,322,322,322,322,322,322,322,322,322,324,324,324,324,325,325,
+		323,326,326,326,326,326,302,302,322,322,322,320,321,319,302,19,
+		0,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,
+		327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,
+		327,327,327,327,327,327,327,0,0,324,324,328,328,329,329,327,
+		323,330,330,330,330,330,330,330,330,330,330,330,330,330,330,330,
+		330,330,330,330,330,330,330,330,330,330,330,330,330,330,330,330,
+		330,330,330,330,330,330,330,330,330,330,330,319,326,331,331,330,
+		0,0,0,0,0,332,332,332,332,332,332,332,332,332,332,332,
+		332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+		0,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+		189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,0,
+		302,302,333,333,333,333,302,302,302,302,302,302,302,302,302,302,
+		302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,
+		302,302,302,302,0,0,0,0,0,0,0,0,0,0,0,0,
+		334,334,334,334,334,334,334,334,334,334,334,334,334,334,334,334,
+		334,334,334,334,334,334,334,334,334,334,334,334,334,334,334,0,
+		333,333,333,333,333,333,333,333,333,333,302,302,302,302,302,302,
+		302,302,302,302,302,302,302,302,25,25,25,25,25,25,25,25,
+		302,333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,
+		334,334,334,334,334,334,334,334,334,334,334,334,334,334,334,302,
+		335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,
+		335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,302,
+		335,335,335,335,335,335,335,335,302,302,302,302,302,302,302,302,
+		336,336,336,336,336,336,336,336,336,336,336,336,336,336,336,336,
+		337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,
+		337,337,337,337,337,338,337,337,337,337,337,337,337,337,337,337,
+		337,337,337,337,337,337,337,337,337,337,337,337,337,0,0,0,
+		339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,
+		339,339,339,339,339,339,339,0,0,0,0,0,0,0,0,0,
+		340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,
+		340,340,340,340,340,340,340,340,341,341,341,341,341,341,342,342,
+		343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,
+		343,343,343,343,343,343,343,343,343,343,343,343,344,345,345,345,
+		346,346,346,346,346,346,346,346,346,346,343,343,0,0,0,0,
+		50,53,50,53,50,53,50,53,50,53,50,53,50,53,347,55,
+		57,57,57,348,55,55,55,55,55,55,55,55,55,55,348,282,
+		50,53,50,53,50,53,50,53,50,53,50,53,282,282,55,55,
+		349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,
+		349,349,349,349,349,349,350,350,350,350,350,350,350,350,350,350,
+		351,351,352,352,352,352,352,352,0,0,0,0,0,0,0,0,
+		36,36,36,36,36,36,36,35,35,35,35,35,35,35,35,35,
+		36,36,28,31,28,31,28,31,28,31,28,31,28,31,28,31,
+		31,31,28,31,28,31,28,31,28,31,28,31,28,31,28,31,
+		34,31,31,31,31,31,31,31,31,28,31,28,31,28,28,31,
+		28,31,28,31,28,31,28,31,35,36,36,28,31,28,31,32,
+		28,31,28,31,31,31,28,31,28,31,28,31,28,31,28,31,
+		28,31,28,31,28,31,28,31,28,31,28,28,28,28,28,31,
+		28,28,28,28,28,31,28,31,28,31,28,31,28,31,28,31,
+		28,31,28,31,28,28,28,28,31,28,31,0,0,0,0,0,
+		28,31,0,31,0,31,28,31,28,31,0,0,0,0,0,0,
+		0,0,34,34,34,28,31,32,34,34,31,32,32,32,32,32,
+		353,353,354,353,353,353,354,353,353,353,353,354,353,353,353,353,
+		353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,
+		353,353,353,355,355,354,354,355,356,356,356,356,354,0,0,0,
+		295,295,295,295,295,295,19,19,163,19,0,0,0,0,0,0,
+		357,357,357,357,357,357,357,357,357,357,357,357,357,357,357,357,
+		357,357,357,357,358,358,358,358,0,0,0,0,0,0,0,0,
+		359,359,360,360,360,360,360,360,360,360,360,360,360,360,360,360,
+		360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,
+		360,360,360,360,359,359,359,359,359,359,359,359,359,359,359,359,
+		359,359,359,359,361,361,0,0,0,0,0,0,0,0,362,362,
+		363,363,363,363,363,363,363,363,363,363,0,0,0,0,0,0,
+		100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+		100,100,102,102,102,102,102,102,104,104,104,102,104,102,102,100,
+		364,364,364,364,364,364,364,364,364,364,365,365,365,365,365,365,
+		365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,
+		365,365,365,365,365,365,366,366,366,366,366,366,366,366,44,367,
+		368,368,368,368,368,368,368,368,368,368,368,368,368,368,368,368,
+		368,368,368,368,368,368,368,369,369,369,369,369,369,369,369,369,
+		369,369,370,370,0,0,0,0,0,0,0,0,0,0,0,371,
+		189,189,189,189,189,189,189,189,189,189,189,189,189,0,0,0,
+		372,372,372,373,374,374,374,374,374,374,374,374,374,374,374,374,
+		374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,
+		374,374,374,372,373,373,372,372,372,372,373,373,372,372,373,373,
+		373,375,375,375,375,375,375,375,375,375,375,375,375,375,0,35,
+		376,376,376,376,376,376,376,376,376,376,0,0,0,0,375,375,
+		180,180,180,180,180,182,377,180,180,180,180,180,180,180,180,180,
+		183,183,183,183,183,183,183,183,183,183,180,180,180,180,180,0,
+		378,378,378,378,378,378,378,378,378,378,378,378,378,378,378,378,
+		378,378,378,378,378,378,378,378,378,379,379,379,379,379,379,380,
+		380,379,379,380,380,379,379,0,0,0,0,0,0,0,0,0,
+		378,378,378,379,378,378,378,378,378,378,378,378,379,380,0,0,
+		381,381,381,381,381,381,381,381,381,381,0,0,382,382,382,382,
+		377,180,180,180,180,180,180,185,185,185,180,181,182,181,180,180,
+		383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,
+		384,383,384,384,384,383,383,384,384,383,383,383,383,383,384,384,
+		383,384,383,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,383,383,385,386,386,
+		387,387,387,387,387,387,387,387,387,387,387,388,389,389,388,388,
+		390,390,387,391,391,388,389,0,0,0,0,0,0,0,0,0,
+		0,191,191,191,191,191,191,0,0,191,191,191,191,191,191,0,
+		0,191,191,191,191,191,191,0,0,0,0,0,0,0,0,0,
+		31,31,31,31,31,31,31,31,31,31,31,36,34,34,34,34,
+		31,31,31,31,31,41,31,31,31,34,36,36,0,0,0,0,
+		197,197,197,197,197,197,197,197,197,197,197,197,197,197,197,197,
+		387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,
+		387,387,387,388,388,389,388,388,389,388,388,390,388,389,0,0,
+		392,392,392,392,392,392,392,392,392,392,0,0,0,0,0,0,
+		189,189,189,189,0,0,0,0,0,0,0,0,0,0,0,0,
+		190,190,190,190,190,190,190,0,0,0,0,190,190,190,190,190,
+		190,190,190,190,190,190,190,190,190,190,190,190,0,0,0,0,
+		393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,
+		394,394,394,394,394,394,394,394,394,394,394,394,394,394,394,394,
+		336,336,336,336,336,336,336,336,336,336,336,336,336,336,395,395,
+		336,336,336,336,336,336,336,336,336,336,395,395,395,395,395,395,
+		395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,
+		31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,
+		0,0,0,61,61,61,61,61,0,0,0,0,0,68,65,68,
+		68,68,68,68,68,68,68,68,68,396,68,68,68,68,68,68,
+		68,68,68,68,68,68,68,0,68,68,68,68,68,0,68,0,
+		68,68,0,68,68,0,68,68,68,68,68,68,68,68,68,68,
+		76,76,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+		99,99,99,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,294,289,
+		74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+		0,0,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,0,0,0,0,0,0,0,74,
+		76,76,76,76,76,76,76,76,76,76,76,76,73,74,74,74,
+		319,319,319,319,319,319,319,303,304,319,0,0,0,0,0,0,
+		56,56,56,56,56,56,56,56,56,56,56,56,56,56,55,55,
+		319,323,323,397,397,303,304,303,304,303,304,303,304,303,304,303,
+		304,303,304,303,304,319,319,303,304,319,319,319,319,397,397,397,
+		319,319,319,0,319,319,319,319,323,303,304,303,304,303,304,319,
+		319,319,305,323,305,305,305,0,319,398,319,319,0,0,0,0,
+		76,76,76,76,76,0,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,0,0,70,
+		0,399,399,399,400,399,399,399,401,402,399,403,399,404,399,399,
+		405,405,405,405,405,405,405,405,405,405,399,399,403,403,403,399,
+		399,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+		406,406,406,406,406,406,406,406,406,406,406,401,399,402,407,408,
+		407,409,409,409,409,409,409,409,409,409,409,409,409,409,409,409,
+		409,409,409,409,409,409,409,409,409,409,409,401,403,402,403,401,
+		402,410,411,412,410,410,413,413,413,413,413,413,413,413,413,413,
+		414,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,
+		413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,
+		413,413,413,413,413,413,413,413,413,413,413,413,413,413,414,414,
+		415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,
+		415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,0,
+		0,0,415,415,415,415,415,415,0,0,415,415,415,415,415,415,
+		0,0,415,415,415,415,415,415,0,0,415,415,415,0,0,0,
+		400,400,403,407,416,400,400,0,417,418,418,418,418,417,417,0,
+		0,0,0,0,0,0,0,0,0,70,70,70,19,23,0,0,
+		419,419,419,419,419,419,419,419,419,419,419,419,0,419,419,419,
+		419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,
+		419,419,419,419,419,419,419,0,419,419,419,419,419,419,419,419,
+		419,419,419,419,419,419,419,419,419,419,419,0,419,419,0,419,
+		419,419,419,419,419,419,419,419,419,419,419,419,419,419,0,0,
+		419,419,419,419,419,419,419,419,419,419,419,0,0,0,0,0,
+		44,44,44,0,0,0,0,295,295,295,295,295,295,295,295,295,
+		295,295,295,295,0,0,0,19,19,19,19,19,19,19,19,19,
+		420,420,420,420,420,420,420,420,420,420,420,420,420,420,420,420,
+		420,420,420,420,420,421,421,421,421,422,422,422,422,422,422,422,
+		422,422,422,422,422,422,422,422,422,422,421,421,422,422,422,0,
+		19,19,19,19,19,19,19,19,19,19,19,19,19,0,0,0,
+		422,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		19,19,19,19,19,19,19,19,19,19,19,19,19,56,0,0,
+		423,423,423,423,423,423,423,423,423,423,423,423,423,423,423,423,
+		423,423,423,423,423,423,423,423,423,423,423,423,423,0,0,0,
+		424,424,424,424,424,424,424,424,424,424,424,424,424,424,424,424,
+		424,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		56,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
+		295,295,295,295,295,295,295,295,295,295,295,295,0,0,0,0,
+		425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,
+		426,426,426,426,0,0,0,0,0,0,0,0,0,425,425,425,
+		427,427,427,427,427,427,427,427,427,427,427,427,427,427,427,427,
+		427,428,427,427,427,427,427,427,427,427,428,0,0,0,0,0,
+		429,429,429,429,429,429,429,429,429,429,429,429,429,429,429,429,
+		429,429,429,429,429,429,430,430,430,430,430,0,0,0,0,0,
+		431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,
+		431,431,431,431,431,431,431,431,431,431,431,431,431,431,0,432,
+		433,433,433,433,433,433,433,433,433,433,433,433,433,433,433,433,
+		433,433,433,433,0,0,0,0,433,433,433,433,433,433,433,433,
+		434,435,435,435,435,435,0,0,0,0,0,0,0,0,0,0,
+		436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,
+		436,436,436,436,436,436,436,436,437,437,437,437,437,437,437,437,
+		437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,
+		438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,
+		439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,439,
+		439,439,439,439,439,439,439,439,439,439,439,439,439,439,0,0,
+		440,440,440,440,440,440,440,440,440,440,0,0,0,0,0,0,
+		441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,
+		441,441,441,441,0,0,0,0,442,442,442,442,442,442,442,442,
+		442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,442,
+		442,442,442,442,442,442,442,442,442,442,442,442,0,0,0,0,
+		443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,
+		443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,0,
+		444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,
+		444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,445,
+		446,446,446,446,446,446,446,446,446,446,446,0,446,446,446,446,
+		446,446,446,0,446,446,0,447,447,447,447,447,447,447,447,447,
+		447,447,0,447,447,447,447,447,447,447,447,447,447,447,447,447,
+		447,447,0,447,447,447,447,447,447,447,0,447,447,0,0,0,
+		448,448,448,448,448,448,448,448,448,448,448,448,448,448,448,448,
+		448,448,448,448,448,448,448,0,0,0,0,0,0,0,0,0,
+		448,448,448,448,448,448,0,0,0,0,0,0,0,0,0,0,
+		448,448,448,448,448,448,448,448,0,0,0,0,0,0,0,0,
+		34,34,34,34,34,34,0,34,34,34,34,34,34,34,34,34,
+		34,0,34,34,34,34,34,34,34,34,34,0,0,0,0,0,
+		449,449,449,449,449,449,0,0,449,0,449,449,449,449,449,449,
+		449,449,449,449,449,449,449,449,449,449,449,449,449,449,449,449,
+		449,449,449,449,449,449,0,449,449,0,0,0,449,0,0,449,
+		450,450,450,450,450,450,450,450,450,450,450,450,450,450,450,450,
+		450,450,450,450,450,450,0,451,452,452,452,452,452,452,452,452,
+		453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+		453,453,453,453,453,453,453,454,454,455,455,455,455,455,455,455,
+		456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,
+		456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,0,
+		0,0,0,0,0,0,0,457,457,457,457,457,457,457,457,457,
+		458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,
+		458,458,458,0,458,458,0,0,0,0,0,459,459,459,459,459,
+		460,460,460,460,460,460,460,460,460,460,460,460,460,460,460,460,
+		460,460,460,460,460,460,461,461,461,461,461,461,0,0,0,462,
+		463,463,463,463,463,463,463,463,463,463,463,463,463,463,463,463,
+		463,463,463,463,463,463,463,463,463,463,0,0,0,0,0,464,
+		465,465,465,465,465,465,465,465,465,465,465,465,465,465,465,465,
+		466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+		466,466,466,466,466,466,466,466,0,0,0,0,467,467,466,466,
+		467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,467,
+		0,0,467,467,467,467,467,467,467,467,467,467,467,467,467,467,
+		468,469,469,469,0,469,469,0,0,0,0,0,469,469,469,469,
+		468,468,468,468,0,468,468,468,0,468,468,468,468,468,468,468,
+		468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,
+		468,468,468,468,468,468,0,0,469,469,469,0,0,0,0,469,
+		470,470,470,470,470,470,470,470,470,0,0,0,0,0,0,0,
+		471,471,471,471,471,471,471,471,471,0,0,0,0,0,0,0,
+		472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,
+		472,472,472,472,472,472,472,472,472,472,472,472,472,473,473,474,
+		475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,
+		475,475,475,475,475,475,475,475,475,475,475,475,475,476,476,476,
+		477,477,477,477,477,477,477,477,478,477,477,477,477,477,477,477,
+		477,477,477,477,477,477,477,477,477,477,477,477,477,477,477,477,
+		477,477,477,477,477,479,479,0,0,0,0,480,480,480,480,480,
+		481,481,481,481,481,481,481,0,0,0,0,0,0,0,0,0,
+		482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,
+		482,482,482,482,482,482,0,0,0,483,483,483,483,483,483,483,
+		484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,
+		484,484,484,484,484,484,0,0,485,485,485,485,485,485,485,485,
+		486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,486,
+		486,486,486,0,0,0,0,0,487,487,487,487,487,487,487,487,
+		488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,
+		488,488,0,0,0,0,0,0,0,489,489,489,489,0,0,0,
+		0,0,0,0,0,0,0,0,0,490,490,490,490,490,490,490,
+		491,491,491,491,491,491,491,491,491,491,491,491,491,491,491,491,
+		491,491,491,491,491,491,491,491,491,0,0,0,0,0,0,0,
+		492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,492,
+		492,492,492,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,
+		493,493,493,0,0,0,0,0,0,0,494,494,494,494,494,494,
+		495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
+		495,495,495,495,496,496,496,496,0,0,0,0,0,0,0,0,
+		497,497,497,497,497,497,497,497,497,497,0,0,0,0,0,0,
+		498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
+		498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,0,
+		499,499,499,499,499,499,499,499,499,499,499,499,499,499,499,499,
+		499,499,499,499,499,499,499,499,499,499,0,500,500,501,0,0,
+		499,499,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		502,502,502,502,502,502,502,502,502,502,502,502,502,502,502,502,
+		502,502,502,502,502,502,502,502,502,502,502,502,502,503,503,503,
+		503,503,503,503,503,503,503,502,0,0,0,0,0,0,0,0,
+		504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,504,
+		504,504,504,504,504,504,505,505,505,505,505,505,505,505,505,505,
+		505,506,506,506,506,507,507,507,507,507,0,0,0,0,0,0,
+		508,508,508,508,508,508,508,508,508,508,508,508,508,508,508,508,
+		508,508,509,509,509,509,510,510,510,510,0,0,0,0,0,0,
+		511,511,511,511,511,511,511,511,511,511,511,511,511,511,511,511,
+		511,511,511,511,511,512,512,512,512,512,512,512,0,0,0,0,
+		513,513,513,513,513,513,513,513,513,513,513,513,513,513,513,513,
+		513,513,513,513,513,513,513,0,0,0,0,0,0,0,0,0,
+		514,515,514,516,516,516,516,516,516,516,516,516,516,516,516,516,
+		516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,516,
+		516,516,516,516,516,516,516,516,515,515,515,515,515,515,515,515,
+		515,515,515,515,515,515,515,517,517,517,517,517,517,517,0,0,
+		0,0,518,518,518,518,518,518,518,518,518,518,518,518,518,518,
+		518,518,518,518,518,518,519,519,519,519,519,519,519,519,519,519,
+		515,516,516,515,515,516,0,0,0,0,0,0,0,0,0,515,
+		520,520,521,522,522,522,522,522,522,522,522,522,522,522,522,522,
+		522,522,522,522,522,522,522,522,522,522,522,522,522,522,522,522,
+		521,521,521,520,520,520,520,521,521,520,520,523,523,524,523,523,
+		523,523,520,0,0,0,0,0,0,0,0,0,0,524,0,0,
+		525,525,525,525,525,525,525,525,525,525,525,525,525,525,525,525,
+		525,525,525,525,525,525,525,525,525,0,0,0,0,0,0,0,
+		526,526,526,526,526,526,526,526,526,526,0,0,0,0,0,0,
+		527,527,527,528,528,528,528,528,528,528,528,528,528,528,528,528,
+		528,528,528,528,528,528,528,528,528,528,528,528,528,528,528,528,
+		528,528,528,528,528,528,528,527,527,527,527,527,529,527,527,527,
+		527,527,527,527,527,0,530,530,530,530,530,530,530,530,530,530,
+		531,531,531,531,528,529,529,528,0,0,0,0,0,0,0,0,
+		532,532,532,532,532,532,532,532,532,532,532,532,532,532,532,532,
+		532,532,532,533,534,534,532,0,0,0,0,0,0,0,0,0,
+		535,535,536,537,537,537,537,537,537,537,537,537,537,537,537,537,
+		537,537,537,537,537,537,537,537,537,537,537,537,537,537,537,537,
+		537,537,537,536,536,536,535,535,535,535,535,535,535,535,535,536,
+		536,537,537,537,537,538,538,538,538,535,535,535,535,538,536,535,
+		539,539,539,539,539,539,539,539,539,539,537,538,537,538,538,538,
+		0,540,540,540,540,540,540,540,540,540,540,540,540,540,540,540,
+		540,540,540,540,540,0,0,0,0,0,0,0,0,0,0,0,
+		541,541,541,541,541,541,541,541,541,541,541,541,541,541,541,541,
+		541,541,0,541,541,541,541,541,541,541,541,541,541,541,541,541,
+		541,541,541,541,541,541,541,541,541,541,541,541,542,542,542,543,
+		543,543,542,542,543,542,543,543,544,544,544,544,544,544,543,0,
+		545,545,545,545,545,545,545,0,545,0,545,545,545,545,0,545,
+		545,545,545,545,545,545,545,545,545,545,545,545,545,545,0,545,
+		545,545,545,545,545,545,545,545,545,546,0,0,0,0,0,0,
+		547,547,547,547,547,547,547,547,547,547,547,547,547,547,547,547,
+		547,547,547,547,547,547,547,547,547,547,547,547,547,547,547,548,
+		549,549,549,548,548,548,548,548,548,548,548,0,0,0,0,0,
+		550,550,550,550,550,550,550,550,550,550,0,0,0,0,0,0,
+		551,551,552,552,0,553,553,553,553,553,553,553,553,0,0,553,
+		553,0,0,553,553,553,553,553,553,553,553,553,553,553,553,553,
+		553,553,553,553,553,553,553,553,553,0,553,553,553,553,553,553,
+		553,0,553,553,0,553,553,553,553,553,0,56,551,553,552,552,
+		551,552,552,552,552,0,0,552,552,0,0,552,552,552,0,0,
+		553,0,0,0,0,0,0,552,0,0,0,0,0,553,553,553,
+		553,553,552,552,0,0,551,551,551,551,551,551,551,0,0,0,
+		551,551,551,551,551,0,0,0,0,0,0,0,0,0,0,0,
+		554,554,554,554,554,554,554,554,554,554,554,554,554,554,554,554,
+		554,554,554,554,554,555,555,555,556,556,556,556,556,556,556,556,
+		555,555,556,556,556,555,556,554,554,554,554,557,557,557,557,557,
+		558,558,558,558,558,558,558,558,558,558,557,557,0,557,556,554,
+		554,554,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		559,559,559,559,559,559,559,559,559,559,559,559,559,559,559,559,
+		560,560,560,561,561,561,561,561,561,560,561,560,560,560,560,561,
+		561,560,561,561,559,559,562,559,0,0,0,0,0,0,0,0,
+		563,563,563,563,563,563,563,563,563,563,0,0,0,0,0,0,
+		564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,
+		564,564,564,564,564,564,564,564,564,564,564,564,564,564,564,565,
+		565,565,566,566,566,566,0,0,565,565,565,565,566,566,565,566,
+		566,567,567,567,567,567,567,567,567,567,567,567,567,567,567,567,
+		567,567,567,567,567,567,567,567,564,564,564,564,566,566,0,0,
+		568,568,568,568,568,568,568,568,568,568,568,568,568,568,568,568,
+		569,569,569,570,570,570,570,570,570,570,570,569,569,570,569,570,
+		570,571,571,571,568,0,0,0,0,0,0,0,0,0,0,0,
+		572,572,572,572,572,572,572,572,572,572,0,0,0,0,0,0,
+		226,226,226,226,226,226,226,226,226,226,226,226,226,0,0,0,
+		573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,573,
+		573,573,573,573,573,573,573,573,573,573,573,574,575,574,575,575,
+		574,574,574,574,574,574,575,574,573,576,0,0,0,0,0,0,
+		577,577,577,577,577,577,577,577,577,577,0,0,0,0,0,0,
+		578,578,578,578,578,578,578,578,578,578,578,578,578,578,578,578,
+		578,578,578,578,578,578,578,578,578,578,578,0,0,579,579,579,
+		580,580,579,579,579,579,580,579,579,579,579,579,0,0,0,0,
+		581,581,581,581,581,581,581,581,581,581,582,582,583,583,583,584,
+		578,578,578,578,578,578,578,0,0,0,0,0,0,0,0,0,
+		585,585,585,585,585,585,585,585,585,585,585,585,585,585,585,585,
+		585,585,585,585,585,585,585,585,585,585,585,585,586,586,586,587,
+		587,587,587,587,587,587,587,587,586,587,587,588,0,0,0,0,
+		589,589,589,589,589,589,589,589,589,589,589,589,589,589,589,589,
+		590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,
+		591,591,591,591,591,591,591,591,591,591,592,592,592,592,592,592,
+		592,592,592,0,0,0,0,0,0,0,0,0,0,0,0,593,
+		594,594,594,594,594,594,594,0,0,594,0,0,594,594,594,594,
+		594,594,594,594,0,594,594,0,594,594,594,594,594,594,594,594,
+		594,594,594,594,594,594,594,594,594,594,594,594,594,594,594,594,
+		595,595,595,595,595,595,0,595,595,0,0,596,596,595,596,594,
+		595,594,595,596,597,597,597,0,0,0,0,0,0,0,0,0,
+		598,598,598,598,598,598,598,598,598,598,0,0,0,0,0,0,
+		599,599,599,599,599,599,599,599,0,0,599,599,599,599,599,599,
+		599,599,599,599,599,599,599,599,599,599,599,599,599,599,599,599,
+		599,600,600,600,601,601,601,601,0,0,601,601,600,600,600,600,
+		601,599,602,599,600,0,0,0,0,0,0,0,0,0,0,0,
+		603,604,604,604,604,604,604,604,604,604,604,603,603,603,603,603,
+		603,603,603,603,603,603,603,603,603,603,603,603,603,603,603,603,
+		603,603,603,604,604,604,604,604,604,605,603,604,604,604,604,606,
+		606,606,606,606,606,606,606,604,0,0,0,0,0,0,0,0,
+		607,608,608,608,608,608,608,609,609,608,608,608,607,607,607,607,
+		607,607,607,607,607,607,607,607,607,607,607,607,607,607,607,607,
+		607,607,607,607,607,607,607,607,607,607,608,608,608,608,608,608,
+		608,608,608,608,608,608,608,609,608,608,610,610,610,607,610,610,
+		610,610,610,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		611,611,611,611,611,611,611,611,611,611,611,611,611,611,611,611,
+		611,611,611,611,611,611,611,611,611,0,0,0,0,0,0,0,
+		612,612,612,612,612,612,612,612,612,0,612,612,612,612,612,612,
+		612,612,612,612,612,612,612,612,612,612,612,612,612,612,612,612,
+		612,612,612,612,612,612,612,612,612,612,612,612,612,612,612,613,
+		614,614,614,614,614,614,614,0,614,614,614,614,614,614,613,614,
+		612,615,615,615,615,615,0,0,0,0,0,0,0,0,0,0,
+		616,616,616,616,616,616,616,616,616,616,617,617,617,617,617,617,
+		617,617,617,617,617,617,617,617,617,617,617,617,617,0,0,0,
+		618,618,619,619,619,619,619,619,619,619,619,619,619,619,619,619,
+		619,619,619,619,619,619,619,619,619,619,619,619,619,619,619,619,
+		0,0,620,620,620,620,620,620,620,620,620,620,620,620,620,620,
+		620,620,620,620,620,620,620,620,0,621,620,620,620,620,620,620,
+		620,621,620,620,621,620,620,0,0,0,0,0,0,0,0,0,
+		622,622,622,622,622,622,622,0,622,622,0,622,622,622,622,622,
+		622,622,622,622,622,622,622,622,622,622,622,622,622,622,622,622,
+		622,623,623,623,623,623,623,0,0,0,623,0,623,623,0,623,
+		623,623,623,623,623,623,622,623,0,0,0,0,0,0,0,0,
+		624,624,624,624,624,624,624,624,624,624,0,0,0,0,0,0,
+		625,625,625,625,625,625,0,625,625,0,625,625,625,625,625,625,
+		625,625,625,625,625,625,625,625,625,625,625,625,625,625,625,625,
+		625,625,625,625,625,625,625,625,625,625,626,626,626,626,626,0,
+		627,627,0,626,626,627,626,627,625,0,0,0,0,0,0,0,
+		628,628,628,628,628,628,628,628,628,628,0,0,0,0,0,0,
+		629,629,629,629,629,629,629,629,629,629,629,629,629,629,629,629,
+		629,629,629,630,630,631,631,632,632,0,0,0,0,0,0,0,
+		340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,
+		135,135,135,135,135,136,136,136,136,136,136,136,136,137,137,137,
+		137,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+		136,136,0,0,0,0,0,0,0,0,0,0,0,0,0,633,
+		634,634,634,634,634,634,634,634,634,634,634,634,634,634,634,634,
+		634,634,634,634,634,634,634,634,634,634,0,0,0,0,0,0,
+		635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,
+		635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,0,
+		636,636,636,636,636,0,0,0,0,0,0,0,0,0,0,0,
+		634,634,634,634,0,0,0,0,0,0,0,0,0,0,0,0,
+		637,637,637,637,637,637,637,637,637,637,637,637,637,637,637,637,
+		637,638,638,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+		639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,0,
+		640,640,640,640,640,640,640,640,640,0,0,0,0,0,0,0,
+		641,641,641,641,641,641,641,641,641,641,641,641,641,641,641,641,
+		641,641,641,641,641,641,641,0,0,0,0,0,0,0,0,0,
+		349,349,349,349,349,349,349,349,349,0,0,0,0,0,0,0,
+		642,642,642,642,642,642,642,642,642,642,642,642,642,642,642,642,
+		642,642,642,642,642,642,642,642,642,642,642,642,642,642,642,0,
+		643,643,643,643,643,643,643,643,643,643,0,0,0,0,644,644,
+		645,645,645,645,645,645,645,645,645,645,645,645,645,645,645,645,
+		645,645,645,645,645,645,645,645,645,645,645,645,645,645,645,0,
+		646,646,646,646,646,646,646,646,646,646,0,0,0,0,0,0,
+		647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,
+		647,647,647,647,647,647,647,647,647,647,647,647,647,647,0,0,
+		648,648,648,648,648,649,0,0,0,0,0,0,0,0,0,0,
+		650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,650,
+		651,651,651,651,651,651,651,652,652,652,652,652,653,653,653,653,
+		654,654,654,654,652,653,0,0,0,0,0,0,0,0,0,0,
+		655,655,655,655,655,655,655,655,655,655,0,656,656,656,656,656,
+		656,656,0,650,650,650,650,650,650,650,650,650,650,650,650,650,
+		650,650,650,650,650,650,650,650,0,0,0,0,0,650,650,650,
+		657,657,657,657,657,657,657,657,657,657,657,657,657,657,657,657,
+		658,658,658,658,658,658,658,658,658,658,658,658,658,658,658,658,
+		659,659,659,659,659,659,659,659,659,659,659,659,659,659,659,659,
+		659,659,659,659,659,659,659,660,660,660,660,0,0,0,0,0,
+		661,661,661,661,661,661,661,661,661,661,661,661,661,661,661,661,
+		661,661,661,661,661,661,661,661,661,661,661,0,0,0,0,662,
+		661,663,663,663,663,663,663,663,663,663,663,663,663,663,663,663,
+		663,663,663,663,663,663,663,663,663,663,663,663,663,663,663,663,
+		663,663,663,663,663,663,663,663,0,0,0,0,0,0,0,662,
+		662,662,662,664,664,664,664,664,664,664,664,664,664,664,664,664,
+		665,666,667,320,668,0,0,0,0,0,0,0,0,0,0,0,
+		669,669,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,
+		670,670,670,670,670,670,670,670,0,0,0,0,0,0,0,0,
+		671,671,671,671,671,671,671,671,671,671,671,671,671,671,671,671,
+		671,671,671,671,671,671,0,0,0,0,0,0,0,0,0,0,
+		670,670,670,670,670,670,670,670,670,0,0,0,0,0,0,0,
+		331,331,331,331,0,331,331,331,331,331,331,331,0,331,331,0,
+		330,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,
+		330,330,330,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		327,327,327,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,330,330,330,330,0,0,0,0,0,0,0,0,
+		672,672,672,672,672,672,672,672,672,672,672,672,672,672,672,672,
+		672,672,672,672,672,672,672,672,672,672,672,672,0,0,0,0,
+		673,673,673,673,673,673,673,673,673,673,673,673,673,673,673,673,
+		673,673,673,673,673,673,673,673,673,673,673,0,0,0,0,0,
+		673,673,673,673,673,673,673,673,673,673,673,673,673,0,0,0,
+		673,673,673,673,673,673,673,673,673,0,0,0,0,0,0,0,
+		673,673,673,673,673,673,673,673,673,673,0,0,674,675,675,676,
+		70,70,70,70,0,0,0,0,0,0,0,0,0,0,0,0,
+		56,56,56,56,56,56,56,56,56,56,56,56,56,56,0,0,
+		56,56,56,56,56,56,56,0,0,0,0,0,0,0,0,0,
+		19,19,19,19,0,0,0,0,0,0,0,0,0,0,0,0,
+		19,19,19,19,19,19,0,0,0,0,0,0,0,0,0,0,
+		19,19,19,19,19,19,19,0,0,19,19,19,19,19,19,19,
+		19,19,19,19,19,280,280,56,56,56,19,19,19,280,280,280,
+		280,280,280,70,70,70,70,70,70,70,70,56,56,56,56,56,
+		56,56,56,19,19,56,56,56,56,56,56,56,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,56,56,56,56,19,19,
+		422,422,422,422,422,422,422,422,422,422,422,422,422,422,422,422,
+		422,422,677,677,677,422,0,0,0,0,0,0,0,0,0,0,
+		295,295,295,295,0,0,0,0,0,0,0,0,0,0,0,0,
+		295,295,295,295,295,295,295,295,295,0,0,0,0,0,0,0,
+		298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,
+		298,298,298,298,298,298,298,298,298,298,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,298,298,298,298,298,298,298,298,298,298,298,298,
+		298,298,298,298,298,298,298,298,298,298,298,298,298,298,26,26,
+		26,26,26,26,26,0,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,298,298,298,298,298,298,298,298,
+		298,298,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,298,0,298,298,
+		0,0,298,0,0,298,298,0,0,298,298,298,298,0,298,298,
+		298,298,298,298,298,298,26,26,26,26,0,26,0,26,26,26,
+		26,26,26,26,0,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,298,298,0,298,298,298,298,0,0,298,298,298,
+		298,298,298,298,298,0,298,298,298,298,298,298,298,0,26,26,
+		26,26,26,26,26,26,26,26,298,298,0,298,298,298,298,0,
+		298,298,298,298,298,0,298,0,0,0,298,298,298,298,298,298,
+		298,0,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,298,298,298,298,
+		298,298,298,298,298,298,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,0,0,298,298,298,298,298,298,298,298,
+		298,293,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,293,26,26,26,26,
+		26,26,298,298,298,298,298,298,298,298,298,298,298,298,298,298,
+		298,298,298,298,298,298,298,298,298,298,298,293,26,26,26,26,
+		26,26,26,26,26,293,26,26,26,26,26,26,298,298,298,298,
+		298,298,298,298,298,293,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,293,
+		26,26,26,26,26,26,298,298,298,298,298,298,298,298,298,298,
+		298,298,298,298,298,298,298,298,298,298,298,298,298,298,298,293,
+		26,26,26,26,26,26,26,26,26,293,26,26,26,26,26,26,
+		298,298,298,298,298,298,298,298,298,293,26,26,26,26,26,26,
+		26,26,26,293,26,26,26,26,26,26,298,26,0,0,678,678,
+		678,678,678,678,678,678,678,678,678,678,678,678,678,678,678,678,
+		679,679,679,679,679,679,679,679,679,679,679,679,679,679,679,679,
+		680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,
+		680,680,680,680,680,680,680,679,679,679,679,680,680,680,680,680,
+		680,680,680,680,680,680,680,680,680,680,680,680,680,679,679,679,
+		679,679,679,679,679,680,679,679,679,679,679,679,679,679,679,679,
+		679,679,679,679,680,679,679,681,681,681,681,681,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,680,680,680,680,680,
+		0,680,680,680,680,680,680,680,680,680,680,680,680,680,680,680,
+		31,31,31,31,31,31,31,31,31,31,32,31,31,31,31,31,
+		31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,
+		682,682,682,682,682,682,682,0,682,682,682,682,682,682,682,682,
+		682,682,682,682,682,682,682,682,682,0,0,682,682,682,682,682,
+		682,682,0,682,682,0,682,682,682,682,682,0,0,0,0,0,
+		683,683,683,683,683,683,683,683,683,683,683,683,683,683,683,683,
+		683,683,683,683,683,683,683,683,683,683,683,683,683,0,0,0,
+		684,684,684,684,684,684,684,685,685,685,685,685,685,685,0,0,
+		686,686,686,686,686,686,686,686,686,686,0,0,0,0,683,687,
+		688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,
+		688,688,688,688,688,688,688,688,688,688,688,688,688,688,689,0,
+		690,690,690,690,690,690,690,690,690,690,690,690,690,690,690,690,
+		690,690,690,690,690,690,690,690,690,690,690,690,691,691,691,691,
+		692,692,692,692,692,692,692,692,692,692,0,0,0,0,0,693,
+		191,191,191,191,191,191,191,0,191,191,191,191,0,191,191,0,
+		191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,0,
+		694,694,694,694,694,694,694,694,694,694,694,694,694,694,694,694,
+		694,694,694,694,694,0,0,695,695,695,695,695,695,695,695,695,
+		696,696,696,696,696,696,696,0,0,0,0,0,0,0,0,0,
+		697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,
+		697,697,698,698,698,698,698,698,698,698,698,698,698,698,698,698,
+		698,698,698,698,698,698,698,698,698,698,698,698,698,698,698,698,
+		698,698,698,698,699,699,699,699,699,699,699,700,0,0,0,0,
+		701,701,701,701,701,701,701,701,701,701,0,0,0,0,702,702,
+		0,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
+		295,295,295,295,295,295,295,295,295,295,295,295,19,295,295,295,
+		163,295,295,295,295,0,0,0,0,0,0,0,0,0,0,0,
+		295,295,295,295,295,295,295,295,295,295,295,295,295,295,19,295,
+		295,295,295,295,295,295,295,295,295,295,295,295,295,295,0,0,
+		76,76,76,76,0,76,76,76,76,76,76,76,76,76,76,76,
+		0,76,76,0,76,0,0,76,0,76,76,76,76,76,76,76,
+		76,76,76,0,76,76,76,76,0,76,0,76,0,0,0,0,
+		0,0,76,0,0,0,0,76,0,76,0,76,0,76,76,76,
+		0,76,76,0,76,0,0,76,0,76,0,76,0,76,0,76,
+		0,76,76,0,76,0,0,76,76,76,76,0,76,76,76,76,
+		76,76,76,0,76,76,76,76,0,76,76,76,76,0,76,0,
+		76,76,76,76,76,76,76,76,76,76,0,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,0,0,0,0,
+		0,76,76,76,0,76,76,76,76,76,0,76,76,76,76,76,
+		71,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		19,19,19,19,302,19,19,19,19,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,19,0,0,0,0,
+		19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,0,
+		0,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+		0,19,19,19,19,19,19,19,19,19,19,19,19,19,19,302,
+		25,25,25,25,25,25,25,25,25,25,25,295,295,19,19,19,
+		23,23,23,23,23,23,23,23,23,23,23,23,23,23,19,19,
+		23,23,23,23,23,23,23,23,23,23,19,19,19,19,19,19,
+		23,23,23,23,23,23,23,23,23,23,23,23,23,23,302,23,
+		23,302,302,302,302,302,302,302,302,302,302,23,23,23,23,23,
+		23,23,23,23,23,23,23,23,23,23,23,23,23,19,0,0,
+		0,0,0,0,0,0,19,19,19,19,19,19,19,19,19,19,
+		703,302,302,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		302,302,302,302,302,302,302,302,302,0,0,0,0,0,0,0,
+		302,302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		302,302,302,302,302,302,0,0,0,0,0,0,0,0,0,0,
+		302,19,19,19,19,19,19,19,19,19,19,19,19,302,302,302,
+		302,302,302,302,302,302,19,302,302,302,302,302,302,302,302,302,
+		302,302,302,302,302,302,302,302,302,302,302,302,302,19,302,302,
+		302,302,302,302,302,302,302,302,302,302,302,19,19,19,19,302,
+		302,19,19,19,302,19,19,19,302,302,302,328,328,328,328,328,
+		302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,19,
+		302,19,302,302,302,302,302,302,302,302,302,302,302,302,302,302,
+		302,302,302,302,302,302,302,302,302,302,302,302,302,19,19,302,
+		302,302,302,302,302,302,302,302,302,302,302,302,302,302,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,302,302,302,302,19,
+		302,302,302,302,302,302,302,302,19,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,302,19,19,19,19,19,
+		19,19,19,19,19,302,302,19,19,19,19,19,19,19,19,19,
+		19,19,19,19,19,19,19,19,19,19,19,302,302,302,302,302,
+		302,302,302,302,302,302,19,19,19,19,19,19,302,19,19,19,
+		302,302,302,19,19,302,302,302,0,0,0,0,0,302,302,302,
+		19,19,19,19,19,19,19,19,19,19,19,302,302,0,0,0,
+		19,19,19,19,302,302,302,302,302,302,302,302,302,0,0,0,
+		19,19,19,19,19,19,19,19,19,0,0,0,0,0,0,0,
+		302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		19,19,19,19,19,19,19,19,0,0,0,0,0,0,0,0,
+		19,19,19,19,19,19,19,19,19,19,0,0,0,0,0,0,
+		19,19,19,19,19,19,19,19,19,19,19,19,19,19,0,0,
+		19,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		19,19,19,19,19,19,19,19,19,19,19,19,302,302,302,302,
+		302,302,302,302,302,302,302,302,302,302,302,19,302,302,302,302,
+		302,302,302,302,302,0,0,0,302,302,302,302,302,0,0,0,
+		302,302,302,302,302,302,302,0,0,0,0,0,0,0,0,0,
+		302,302,302,302,302,302,302,302,302,302,302,302,302,0,0,0,
+		302,302,302,302,302,302,302,302,302,302,302,0,0,0,0,0,
+		302,302,302,302,302,302,302,302,302,302,0,0,0,0,0,0,
+		302,302,302,302,302,302,302,302,0,0,0,0,0,0,0,0,
+		19,19,19,0,19,19,19,19,19,19,19,19,19,19,19,19,
+		678,678,678,678,678,678,678,678,678,678,0,0,0,0,0,0,
+		336,336,336,336,336,336,336,336,336,395,395,395,395,395,395,395,
+		336,336,395,395,395,395,395,395,395,395,395,395,395,395,395,395,
+		336,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,
+		395,395,395,395,395,395,395,395,395,395,395,395,395,395,0,0,
+		336,336,336,336,336,336,336,336,336,336,336,395,395,395,395,395,
+		0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		394,394,394,394,394,394,394,394,394,394,394,394,394,394,0,0
+	};
+
+	template<class T> const boost::uint16_t properties_data<T>::property_records[704] = {
+		0,6426,6583,6578,6580,6574,6575,6579,6573,6569,18081,6581,
+		6572,18082,6423,6450,6452,6582,6453,6422,17957,6416,6459,6454,
+		6451,6443,6402,6417,17921,17953,17954,17922,17925,17923,17924,6404,
+		6421,6436,3349,14374,11265,11266,11285,11268,6418,11297,11298,6657,
+		6658,11283,7681,7713,7714,7682,7702,7686,14342,7688,1281,1284,
+		1298,1282,1293,1302,1300,13574,13581,13586,13573,1051,6427,1043,
+		1042,1044,1046,1030,1029,1033,1028,35090,35099,35077,35078,37893,
+		37894,25609,25605,25606,25604,25622,25618,25620,32005,32006,32004,32018,
+		20741,20742,20754,1045,8198,8199,8197,8201,8210,8196,2821,2822,
+		2823,2825,2836,2827,2838,2834,12038,12039,12037,12041,12050,11526,
+		11527,11525,11529,11538,11540,29190,29191,29189,29193,29206,29195,36870,
+		36869,36871,36873,36875,36886,36884,37638,37639,37637,37641,37650,37643,
+		37654,15621,15622,15623,15634,15625,20486,20487,20485,20502,20491,20489,
+		33542,33543,33541,33545,33554,38149,38150,6420,38148,38162,38153,17669,
+		17670,17668,17673,38405,38422,38418,38406,38409,38411,38414,38415,38407,
+		24325,24327,24326,24329,24338,24342,10241,10242,10244,12645,12549,9989,
+		9990,10002,9995,10006,5889,5890,4621,4613,4630,4626,26391,26373,
+		26382,26383,31749,31754,35333,35334,35335,13061,13062,13063,4357,4358,
+		35589,35590,16901,16902,16903,16914,16900,16916,16905,16907,23570,23565,
+		23558,23579,23561,23557,23556,18437,18438,18439,18454,18450,18441,35845,
+		25093,25097,25099,25110,16918,4101,4102,4103,4114,36101,36103,36102,
+		36105,36114,36100,14344,1798,1799,1797,1801,1810,1814,34566,34567,
+		34565,34569,2565,2566,2567,2578,18181,18183,18182,18194,18185,26633,
+		26629,26628,26642,34578,6407,6405,7684,11267,14363,6445,6413,6448,
+		6449,6414,6424,6425,6412,6419,6415,6411,17956,6484,6401,6434,
+		17962,17930,6518,6510,6511,6515,3862,10497,10498,6678,6662,6674,
+		6667,38661,38660,38674,38662,12406,6551,6514,12388,6501,12394,6509,
+		14438,12647,6500,13925,6517,13924,15973,15972,3429,6507,12662,15990,
+		12389,41061,41060,41078,19205,19204,19218,39685,39684,39698,39689,7685,
+		7698,2053,2058,2054,2066,34821,34822,34823,34838,30725,30738,32263,
+		32261,32262,32274,32265,16137,16133,16134,16146,31493,31494,31495,31506,
+		15110,15111,15109,15122,15113,24324,5637,5638,5639,5641,5650,36357,
+		36358,36356,36370,22021,22023,22022,22034,22020,22025,28,61,96,
+		13587,6508,6516,6546,6548,6542,6543,6547,6541,6537,18049,6549,
+		6540,18050,6482,6478,6479,15941,6468,12613,6550,6486,6483,18949,
+		11274,11275,11286,19461,4869,27141,27147,10757,10762,27653,27654,39429,
+		39442,27909,27922,27914,7937,7938,32773,29701,29705,29441,29442,9477,
+		5125,5138,39937,39938,18693,7173,14085,14098,14091,30213,30230,30219,
+		24581,24587,13317,13323,30981,30987,30994,19717,19730,22789,22533,22539,
+		16389,16390,16395,16402,28421,28427,28434,27397,27403,20997,21014,20998,
+		21003,21010,1541,1554,14853,14859,14597,14603,31237,31250,31243,28677,
+		26881,26882,26891,12805,12806,12809,1035,40709,40710,40717,28165,28171,
+		33797,33798,33803,33810,28933,28934,28946,6149,6155,9733,3591,3590,
+		3589,3602,3595,3593,15366,15367,15365,15378,15387,34053,34057,5382,
+		5381,5383,5385,5394,19973,19974,19986,32518,32519,32517,32530,32521,
+		33547,17157,17159,17158,17170,24069,24082,17413,17414,17415,17417,11014,
+		11015,11013,25349,25351,25350,25362,25353,38917,38919,38918,38930,38921,
+		33029,33031,33030,33042,23301,23303,23302,23314,23305,36613,36614,36615,
+		36626,36617,517,518,519,521,523,530,534,8709,8711,8710,
+		8722,40449,40450,40457,40459,40453,8453,8455,8454,8466,8457,24837,
+		24839,24838,24850,41221,41222,41223,41234,34309,34310,34311,34322,30469,
+		3077,3079,3078,3090,3081,3083,21266,21253,21254,21255,21509,21510,
+		21513,11781,11783,11782,11785,20229,20230,20231,20242,36882,6917,6922,
+		6930,7429,7442,9221,9243,773,23813,23817,23826,37125,37129,2309,
+		2310,2322,29957,29958,29970,29974,29956,29961,29963,21761,21762,21771,
+		21778,23045,23046,23047,23044,37476,25956,12402,16742,12391,37477,16741,
+		25957,8965,8982,8966,8978,11270,6409,33302,33286,33298,10502,26117,
+		26118,26116,26121,26134,39173,39174,40197,40198,40201,40212,22277,22283,
+		22278,257,258,262,260,265,274,13942
+	};
+
+	// Index of the character's record in property_records.
+	inline boost::uint16_t property_record(boost::uint32_t cp)
+	{
+		if(cp >= 0x110000) // Everything from here on has the same value.
+			return 0;
+
+		return properties_data<>::property_record_stage3[(properties_data<>::property_record_stage2[(properties_data<>::property_record_stage1[cp >> 9] << 5) + ((cp >> 4) & 0x1F)] << 4) + (cp & 0xF)];
+	}
+}
+
+#endif
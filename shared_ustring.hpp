@@ -0,0 +1,204 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_SHARED_USTRING_HPP
+#define BOOST_UNICODE_SHARED_USTRING_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include "unicode.h"
+#include "utf8_count.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// An immutable string whose UTF-8 is shared by all its copies and substrings, so
+	// copying one (e.g. to hand it to another thread or put it in a container) never
+	// copies the text. The buffer is freed along with the last string using it. The
+	// reference count is atomic, so copies can be made and dropped in any thread, and
+	// nothing about a string changes after it's made, so it can be read from any
+	// number of threads at once.
+	//
+	// A shared_ustring converts to a ustring_view for everything that reads text.
+	//================================================================================
+
+	class shared_ustring
+	{
+	public:
+		typedef std::size_t size_type;
+		typedef ustring_view::iterator iterator;
+
+		shared_ustring() : first(0), last(0), length(0)
+		{
+		}
+
+		// Copy the text of s (once) into a new buffer.
+		shared_ustring(const ustring_view& s)
+		{
+			assign(s);
+		}
+
+		shared_ustring(const char* cstr)
+		{
+			assign(ustring_view(cstr));
+		}
+
+		shared_ustring(const std::string& str)
+		{
+			assign(ustring_view(str));
+		}
+
+		template<class tpl_enc, class tpl_dec>
+		shared_ustring(const basic_ustring<tpl_enc, tpl_dec>& str)
+		{
+			assign(ustring_view(str));
+		}
+
+		// A view of the text, valid as long as this string (or any other sharing its buffer) is.
+		ustring_view view() const
+		{
+			return ustring_view(first, last - first, length);
+		}
+
+		operator ustring_view() const
+		{
+			return view();
+		}
+
+		iterator begin() const
+		{
+			return iterator(first);
+		}
+
+		iterator end() const
+		{
+			return iterator(last);
+		}
+
+		// Raw UTF-8 data. This is not null terminated.
+		const utf8_unit* data() const
+		{
+			return first;
+		}
+
+		// Number of bytes.
+		size_type bytes() const
+		{
+			return last - first;
+		}
+
+		// Number of characters.
+		int size() const
+		{
+			return length;
+		}
+
+		bool empty() const
+		{
+			return first == last;
+		}
+
+		// The characters in [b, e), sharing this string's buffer.
+		shared_ustring substr(iterator b, iterator e) const
+		{
+			return shared_ustring(buffer, b.base(), e.base(), (int)utf8_count(b.base(), e.base()));
+		}
+
+		// qty characters starting at character pos, sharing this string's buffer. They
+		// have to be in the string.
+		shared_ustring substr(int pos, int qty) const
+		{
+			assert(pos >= 0 && qty >= 0 && pos <= length && qty <= length - pos);
+
+			std::size_t n = pos;
+			const utf8_unit* b = utf8_advance(first, last, n);
+			n = qty;
+			const utf8_unit* e = utf8_advance(b, last, n);
+			return shared_ustring(buffer, b, e, qty);
+		}
+
+		// Number of strings (including this one) sharing the buffer.
+		long use_count() const
+		{
+			return buffer.use_count();
+		}
+
+		int compare(const shared_ustring& with) const
+		{
+			return view().compare(with.view());
+		}
+
+		bool operator ==(const shared_ustring& op) const
+		{
+			return view() == op.view();
+		}
+
+		bool operator !=(const shared_ustring& op) const
+		{
+			return view() != op.view();
+		}
+
+		bool operator <(const shared_ustring& op) const
+		{
+			return view() < op.view();
+		}
+
+		bool operator >(const shared_ustring& op) const
+		{
+			return view() > op.view();
+		}
+
+		std::size_t hash() const
+		{
+			return view().hash();
+		}
+
+		friend std::ostream& operator<<(std::ostream& os, const shared_ustring& s)
+		{
+			return os << s.view();
+		}
+
+	private:
+		shared_ustring(const boost::shared_ptr<const std::vector<utf8_unit> >& _buffer,
+			const utf8_unit* _first, const utf8_unit* _last, int _length)
+			: buffer(_buffer), first(_first), last(_last), length(_length)
+		{
+		}
+
+		void assign(const ustring_view& s)
+		{
+			length = s.size();
+
+			if(s.empty())
+			{
+				first = last = 0;
+				return;
+			}
+
+			buffer = boost::make_shared<const std::vector<utf8_unit> >(s.data(), s.data() + s.bytes());
+			first = &(*buffer)[0];
+			last = first + buffer->size();
+		}
+
+		boost::shared_ptr<const std::vector<utf8_unit> > buffer; // Null if the string is empty.
+		const utf8_unit* first; // First byte of the string in the buffer.
+		const utf8_unit* last; // One past the last byte.
+		int length; // Number of characters.
+	};
+
+	// So shared strings can be used as keys with boost::hash and unordered containers.
+	inline std::size_t hash_value(const shared_ustring& s)
+	{
+		return s.hash();
+	}
+}
+
+#endif
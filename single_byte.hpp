@@ -0,0 +1,318 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_SINGLE_BYTE_HPP
+#define BOOST_UNICODE_SINGLE_BYTE_HPP
+
+#include <cctype>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <boost/cstdint.hpp>
+#include "ustream.hpp"
+#include "utf8_count.hpp"
+#include "single_byte_tables.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Legacy single-byte code pages: ISO-8859-1 (Latin-1) to ISO-8859-16 and
+	// Windows-1250 to Windows-1258. All of them are ASCII up to 0x7F. Above that, each
+	// byte is one character, looked up in a table of 256 per code page. Characters are
+	// encoded by looking their high byte up in a table of 256 per code page, which picks
+	// a shared block of 256 bytes for the low byte.
+	//
+	// The decoders and encoders work with the Unicode streams like the UTF ones. For
+	// converting whole blocks in memory there are single_byte_to_utf8() and
+	// utf8_to_single_byte(), which copy runs of ASCII 16 bytes at a time.
+	//================================================================================
+
+	// The character byte b stands for in code_page, or 0xFFFF if it isn't used.
+	inline boost::uint16_t single_byte_to_unicode(int code_page, boost::uint8_t b)
+	{
+		return single_byte_data<>::single_byte_decode[(code_page << 8) + b];
+	}
+
+	// The byte for ch in code_page, or 0 if the code page doesn't have it (or ch is 0).
+	inline boost::uint8_t unicode_to_single_byte(int code_page, boost::uint32_t ch)
+	{
+		if(ch < 0x80)
+			return (boost::uint8_t)ch;
+
+		if(ch > 0xFFFF)
+			return 0;
+
+		return single_byte_data<>::single_byte_encode[(single_byte_data<>::single_byte_encode_index[(code_page << 8) + (ch >> 8)] << 8) + (ch & 0xFF)];
+	}
+
+	// The code page called name (e.g. "latin1", "ISO-8859-15", "cp1252" or "windows-1252"), or -1.
+	inline int find_single_byte_code_page(std::string name)
+	{
+		for(std::size_t i=0; i < name.size(); ++i)
+			name[i] = (char)std::tolower((unsigned char)name[i]);
+
+		if(name == "latin1" || name == "latin-1")
+			return code_page_iso8859_1;
+
+		const char* digits = 0;
+
+		if(name.compare(0, 9, "iso-8859-") == 0 || name.compare(0, 8, "iso8859-") == 0 || name.compare(0, 8, "iso8859_") == 0)
+			digits = name.c_str() + (name[3] == '-' ? 9 : 8);
+		else if(name.compare(0, 2, "cp") == 0)
+			digits = name.c_str() + 2;
+		else if(name.compare(0, 8, "windows-") == 0)
+			digits = name.c_str() + 8;
+
+		if(!digits || !*digits)
+			return -1;
+
+		char* end;
+		long n = std::strtol(digits, &end, 10);
+
+		if(*end)
+			return -1;
+
+		if(name[0] == 'c' || name[0] == 'w')
+			return n >= 1250 && n <= 1258 ? code_page_windows1250 + (int)(n - 1250) : -1;
+
+		if(n >= 1 && n <= 11)
+			return code_page_iso8859_1 + (int)(n - 1);
+
+		if(n >= 13 && n <= 16)
+			return code_page_iso8859_13 + (int)(n - 13);
+
+		return -1;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Stream decoder and encoder. The code page is given at run time to the basic_
+	// classes, and as a template argument to the others, which is what the Unicode
+	// streams need.
+	//--------------------------------------------------------------------------------
+
+	template<class error_policy=replace_on_error>
+	class basic_single_byte_decoder : public basic_decoder
+	{
+	public:
+		basic_single_byte_decoder(std::istream* _is, int _code_page) : basic_decoder(_is), code_page(_code_page) {}
+
+		// Read until one character is decoded.
+		boost::int_fast32_t decode()
+		{
+			for(;;)
+			{
+				BOOST_UNICODE_STAT(refill());
+
+				int b = is->get();
+
+				if(b == EOF)
+					return EOF;
+
+				boost::uint16_t ch = single_byte_to_unicode(code_page, (boost::uint8_t)b);
+
+				if(ch != 0xFFFF)
+				{
+					BOOST_UNICODE_STAT(count(1));
+					++bytes_decoded;
+					return ch;
+				}
+
+				boost::int_fast32_t ret = error_policy::handle(is, "Byte not used in the code page.", error(1));
+				BOOST_UNICODE_STAT(count_error(1, ret));
+
+				if(ret != skip_character)
+					return ret;
+			}
+		}
+
+		// Skip a character in an input stream.
+		bool nextg()
+		{
+			if(is->get() == EOF)
+				return false;
+
+			++bytes_decoded;
+			return true;
+		}
+
+		// Go back a character in an input stream.
+		bool prevg()
+		{
+			if(is->unget())
+				--bytes_decoded;
+			else
+				lost_position();
+
+			return true;
+		}
+
+		// Every character is one byte, so skipping is just skipping bytes.
+		int skipg(int qty)
+		{
+			is->ignore(qty);
+			bytes_decoded += is->gcount();
+			return (int)is->gcount();
+		}
+
+		bool seekg(int off, std::ios_base::seekdir dir=std::ios_base::beg)
+		{
+			lost_position();
+			is->seekg(off, dir);
+			return true;
+		}
+
+	private:
+		int code_page;
+	};
+
+	template<int tpl_code_page, class error_policy=replace_on_error>
+	class single_byte_decoder : public basic_single_byte_decoder<error_policy>
+	{
+	public:
+		single_byte_decoder(std::istream* _is) : basic_single_byte_decoder<error_policy>(_is, tpl_code_page) {}
+	};
+
+	class basic_single_byte_encoder : public basic_encoder
+	{
+	public:
+		basic_single_byte_encoder(std::ostream* _os, int _code_page, std::size_t buffer_size=default_buffer_size)
+			: basic_encoder(_os, buffer_size), code_page(_code_page) {}
+
+		// Encode a character and write it to the stream. Characters the code page doesn't
+		// have are written as '?'.
+		void encode(boost::int_fast32_t ch)
+		{
+			BOOST_UNICODE_STAT(++counters.code_points_out);
+
+			boost::uint8_t* p = reserve(1);
+			boost::uint8_t b = unicode_to_single_byte(code_page, (boost::uint32_t)ch);
+			*p++ = b || !ch ? b : '?';
+			commit(p);
+		}
+
+	private:
+		int code_page;
+	};
+
+	template<int tpl_code_page>
+	class single_byte_encoder : public basic_single_byte_encoder
+	{
+	public:
+		single_byte_encoder(std::ostream* _os, std::size_t buffer_size=basic_encoder::default_buffer_size)
+			: basic_single_byte_encoder(_os, tpl_code_page, buffer_size) {}
+	};
+
+	// Decoders, encoders, codecs and streams for each code page, e.g. windows1252_decoder,
+	// windows1252_uistream and windows1252_uofstream.
+#define BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(name) \
+	typedef single_byte_decoder<code_page_##name> name##_decoder; \
+	typedef single_byte_encoder<code_page_##name> name##_encoder; \
+	typedef specific_codec<name##_decoder, name##_encoder> name##_codec; \
+	typedef specific_uistream<name##_decoder> name##_uistream; \
+	typedef specific_uostream<name##_encoder> name##_uostream; \
+	typedef specific_ustream<name##_codec> name##_ustream; \
+	typedef specific_ufstream<name##_uistream, std::ifstream> name##_uifstream; \
+	typedef specific_ufstream<name##_uostream, std::ofstream> name##_uofstream; \
+	typedef specific_ufstream<name##_ustream, std::fstream> name##_ufstream;
+
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_1)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_2)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_3)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_4)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_5)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_6)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_7)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_8)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_9)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_10)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_11)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_13)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_14)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_15)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(iso8859_16)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(windows1250)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(windows1251)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(windows1252)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(windows1253)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(windows1254)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(windows1255)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(windows1256)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(windows1257)
+	BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS(windows1258)
+
+#undef BOOST_UNICODE_SINGLE_BYTE_TYPEDEFS
+
+	typedef iso8859_1_decoder latin1_decoder; // ISO-8859-1 Decoder
+	typedef iso8859_1_encoder latin1_encoder; // ISO-8859-1 Encoder
+	typedef iso8859_1_uistream latin1_uistream; // ISO-8859-1 Input Stream
+	typedef iso8859_1_uostream latin1_uostream; // ISO-8859-1 Output Stream
+	typedef iso8859_1_uifstream latin1_uifstream; // ISO-8859-1 Input File Stream
+	typedef iso8859_1_uofstream latin1_uofstream; // ISO-8859-1 Output File Stream
+
+	//--------------------------------------------------------------------------------
+	// Converting blocks in memory.
+	//--------------------------------------------------------------------------------
+
+	// Decode [first, last) in code_page to UTF-8 at out, which needs room for 3 bytes per
+	// byte of input. Bytes the code page doesn't use become U+FFFD. Returns the end of
+	// the output.
+	inline boost::uint8_t* single_byte_to_utf8(int code_page, const boost::uint8_t* first, const boost::uint8_t* last, boost::uint8_t* out)
+	{
+		while(first != last)
+		{
+			std::size_t n = ascii_run(first, last);
+
+			if(n)
+			{
+				std::memcpy(out, first, n);
+				first += n;
+				out += n;
+				continue;
+			}
+
+			boost::uint32_t ch = *first++;
+
+			if(ch >= 0x80)
+			{
+				ch = single_byte_to_unicode(code_page, (boost::uint8_t)ch);
+
+				if(ch == 0xFFFF)
+					ch = 0xFFFD;
+			}
+
+			out = utf8_put(ch, out);
+		}
+
+		return out;
+	}
+
+	// Encode well-formed UTF-8 [first, last) in code_page at out, which needs room for
+	// one byte per character. Characters the code page doesn't have are written as '?'.
+	// Returns the end of the output.
+	inline boost::uint8_t* utf8_to_single_byte(int code_page, const boost::uint8_t* first, const boost::uint8_t* last, boost::uint8_t* out)
+	{
+		while(first != last)
+		{
+			std::size_t n = ascii_run(first, last);
+
+			if(n)
+			{
+				std::memcpy(out, first, n);
+				first += n;
+				out += n;
+				continue;
+			}
+
+			boost::uint32_t ch = utf8_next(first);
+			boost::uint8_t b = unicode_to_single_byte(code_page, ch);
+			*out++ = b || !ch ? b : '?';
+		}
+
+		return out;
+	}
+}
+
+#endif
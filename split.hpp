@@ -0,0 +1,337 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_SPLIT_HPP
+#define BOOST_UNICODE_SPLIT_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "unicode.h"
+#include "utf8_count.hpp"
+#include "utf8_search.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Splitting text into fields at delimiters without copying anything: each field is
+	// a ustring_view of the text, so e.g. a line of TSV can be taken apart without
+	// allocating. Like std::string::find, "a,,b" split at ',' is "a", "" and "b", and
+	// text that ends with a delimiter ends with an empty field.
+	//
+	// A delimiter is anything with
+	//
+	//   const utf8_unit* find(const utf8_unit* p, const utf8_unit* last, const utf8_unit*& after) const
+	//
+	// that returns the start of the first delimiter in [p, last) and sets after to its
+	// end, or returns last if there isn't one. The text is well-formed UTF-8 up to last.
+	//================================================================================
+
+	// A single character. ASCII is found with memchr(), which is vectorised everywhere
+	// that matters, and anything else with utf8_search().
+	class char_delimiter
+	{
+	public:
+		char_delimiter() : size(0)
+		{
+		}
+
+		char_delimiter(utf32_unit c) : size(utf8_put(c, bytes) - bytes)
+		{
+		}
+
+		const utf8_unit* find(const utf8_unit* p, const utf8_unit* last, const utf8_unit*& after) const
+		{
+			if(size == 1)
+			{
+				const void* q = p == last ? 0 : std::memchr(p, bytes[0], last - p);
+				p = q ? (const utf8_unit*)q : last;
+			}
+			else
+				p = utf8_search(p, last, bytes, bytes + size);
+
+			after = p == last ? last : p + size;
+			return p;
+		}
+
+	private:
+		utf8_unit bytes[4]; // The character in UTF-8.
+		std::size_t size; // Number of bytes in it.
+	};
+
+	// A string of one or more characters, found with utf8_search(). The delimiter's data
+	// has to outlive the split.
+	class string_delimiter
+	{
+	public:
+		string_delimiter()
+		{
+		}
+
+		string_delimiter(const ustring_view& _what) : what(_what)
+		{
+			assert(!what.empty());
+		}
+
+		const utf8_unit* find(const utf8_unit* p, const utf8_unit* last, const utf8_unit*& after) const
+		{
+			p = utf8_search(p, last, what.data(), what.data() + what.bytes());
+			after = p == last ? last : p + what.bytes();
+			return p;
+		}
+
+	private:
+		ustring_view what;
+	};
+
+	// Any character pred(c) is true for, e.g. is_separator from properties.hpp.
+	template<class predicate_type>
+	class predicate_delimiter
+	{
+	public:
+		predicate_delimiter() : pred()
+		{
+		}
+
+		predicate_delimiter(predicate_type _pred) : pred(_pred)
+		{
+		}
+
+		const utf8_unit* find(const utf8_unit* p, const utf8_unit* last, const utf8_unit*& after) const
+		{
+			while(p != last)
+			{
+				const utf8_unit* q = p;
+
+				if(pred((utf32_unit)utf8_next(q)))
+				{
+					after = q;
+					return p;
+				}
+
+				p = q;
+			}
+
+			after = last;
+			return last;
+		}
+
+	private:
+		predicate_type pred;
+	};
+
+	//--------------------------------------------------------------------------------
+	// Splitting UTF-8 in memory (a basic_ustring or ustring_view). The fields are views
+	// of the text, so it has to outlive them.
+	//--------------------------------------------------------------------------------
+
+	template<class delimiter_type>
+	class split_iterator
+	{
+	public:
+		// The end of any split.
+		split_iterator() : last(0), ptr(0), stop(0), next(0)
+		{
+		}
+
+		// An iterator at the first field of [p, _last).
+		split_iterator(const utf8_unit* p, const utf8_unit* _last, const delimiter_type& _delim)
+			: delim(_delim), last(_last), ptr(p)
+		{
+			stop = delim.find(ptr, last, next);
+		}
+
+		bool operator==(const split_iterator& op) const
+		{
+			return ptr == op.ptr;
+		}
+
+		bool operator!=(const split_iterator& op) const
+		{
+			return ptr != op.ptr;
+		}
+
+		split_iterator& operator++()
+		{
+			if(stop == last)
+				ptr = 0; // That was the last field.
+			else
+			{
+				ptr = next;
+				stop = delim.find(ptr, last, next);
+			}
+
+			return *this;
+		}
+
+		split_iterator operator++(int)
+		{
+			split_iterator tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		ustring_view operator*() const
+		{
+			return ustring_view(ptr, stop - ptr);
+		}
+
+	private:
+		delimiter_type delim;
+		const utf8_unit* last;
+		const utf8_unit* ptr; // Start of the current field, or 0 past the last one.
+		const utf8_unit* stop; // End of the current field.
+		const utf8_unit* next; // Start of the field after it.
+	};
+
+	template<class delimiter_type>
+	class split_range
+	{
+	public:
+		typedef split_iterator<delimiter_type> iterator;
+		typedef iterator const_iterator;
+
+		split_range(const ustring_view& _s, const delimiter_type& _delim) : s(_s), delim(_delim)
+		{
+		}
+
+		iterator begin() const
+		{
+			// An empty view may have no data at all, but still has one (empty) field.
+			static const utf8_unit empty = 0;
+			const utf8_unit* p = s.empty() ? &empty : s.data();
+			return iterator(p, p + s.bytes(), delim);
+		}
+
+		iterator end() const
+		{
+			return iterator();
+		}
+
+	private:
+		ustring_view s;
+		delimiter_type delim;
+	};
+
+	// The fields of s between occurrences of c, e.g.
+	//
+	//   for(split_range<char_delimiter>::iterator i=split(line, '\t').begin(); ...
+	inline split_range<char_delimiter> split(const ustring_view& s, utf32_unit c)
+	{
+		return split_range<char_delimiter>(s, char_delimiter(c));
+	}
+
+	// The fields of s between occurrences of what, which mustn't be empty.
+	inline split_range<string_delimiter> split(const ustring_view& s, const ustring_view& what)
+	{
+		return split_range<string_delimiter>(s, string_delimiter(what));
+	}
+
+	// The fields of s between characters pred is true for.
+	template<class predicate_type>
+	split_range<predicate_delimiter<predicate_type> > split_if(const ustring_view& s, predicate_type pred)
+	{
+		return split_range<predicate_delimiter<predicate_type> >(s, predicate_delimiter<predicate_type>(pred));
+	}
+
+	//--------------------------------------------------------------------------------
+	// Splitting UTF-8 read from a std::istream (e.g. records of a file) a block at a
+	// time. Each field is a view of an internal buffer, valid until the next call to
+	// next(). The buffer grows to fit the longest field, and is otherwise reused.
+	//--------------------------------------------------------------------------------
+
+	template<class delimiter_type>
+	class split_reader
+	{
+	public:
+		split_reader(std::istream& _is, const delimiter_type& _delim, std::size_t block=65536)
+			: is(&_is), delim(_delim), buf(block ? block : 1), first(0), last(0), eof(false), done(false)
+		{
+		}
+
+		// Read the next field. Returns false after the last one.
+		bool next(ustring_view& field)
+		{
+			while(!done)
+			{
+				// Only whole characters are searched, so a delimiter or character split
+				// by the end of the block is found once the rest of it has been read.
+				const utf8_unit* p = &buf[0] + first;
+				const utf8_unit* end = eof ? &buf[0] + last : whole_characters_end();
+				const utf8_unit* after;
+				const utf8_unit* stop = delim.find(p, end, after);
+
+				if(stop != end || eof)
+				{
+					field = ustring_view(p, stop - p);
+
+					if(stop == end)
+						done = true;
+					else
+						first = after - &buf[0];
+
+					return true;
+				}
+
+				fill();
+			}
+
+			return false;
+		}
+
+	private:
+		// End of the last whole character read.
+		const utf8_unit* whole_characters_end() const
+		{
+			const utf8_unit* p = &buf[0] + first;
+			const utf8_unit* end = &buf[0] + last;
+			const utf8_unit* lead = end;
+
+			while(lead != p && !utf8_is_lead(lead[-1]))
+				--lead;
+
+			if(lead != p && end - lead < table_extra_bytes[lead[-1]])
+				return lead - 1; // The last character isn't all there.
+
+			return end;
+		}
+
+		// Move the unfinished field to the start of the buffer and read more after it,
+		// making the buffer bigger if the field fills it.
+		void fill()
+		{
+			if(first)
+			{
+				std::memmove(&buf[0], &buf[0] + first, last - first);
+				last -= first;
+				first = 0;
+			}
+
+			if(last == buf.size())
+				buf.resize(buf.size() * 2);
+
+			is->read((char*)&buf[0] + last, buf.size() - last);
+			std::streamsize got = is->gcount();
+			last += (std::size_t)got;
+
+			if(!got)
+				eof = true;
+		}
+
+		std::istream* is;
+		delimiter_type delim;
+		std::vector<utf8_unit> buf;
+		std::size_t first; // Start of the next field in buf.
+		std::size_t last; // End of the data read into buf.
+		bool eof; // Has everything been read?
+		bool done; // Has the last field been returned?
+	};
+}
+
+#endif
@@ -0,0 +1,345 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Writes text through the asynchronous output file streams and reads it back through
+// the read-ahead input file streams, with block sizes that cut characters in two, and
+// checks the read-ahead validation and seeking. The file is test_async.tmp in the
+// current directory.
+//
+//	test_async
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "async_ufstream.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef vector<boost::uint32_t> chars;
+
+const char* const temp_file = "test_async.tmp";
+
+// Block sizes and numbers of blocks to try. The sizes are odd, so blocks end in the
+// middle of UTF-8, UTF-16 and UTF-32 characters.
+const size_t block_sizes[] = { 1, 3, 7, 61, 1001, 4093 };
+const size_t block_counts[] = { 2, 3, 5 };
+const size_t read_block_sizes[] = { 4, 5, 7, 61, 1001, 4093 }; // prefetch_filebuf's blocks are at least 4 bytes.
+
+// ASCII, Latin-1, Greek, CJK and characters outside the BMP, over and over.
+chars sample_text()
+{
+	const boost::uint32_t pattern[] = { 0x48, 0x69, 0x20, 0xE9, 0x0301, 0x03B1, 0x03B2, 0x0A, 0x65E5, 0x672C, 0x1F600, 0x10348, 0x20 };
+	const size_t qty = sizeof(pattern) / sizeof(pattern[0]);
+	chars ret;
+
+	for(size_t i=0; i < 5000; ++i)
+		ret.push_back(pattern[i % qty] + (i / qty) % 7);
+
+	return ret;
+}
+
+// The bytes of a file.
+string read_file(const char* filename)
+{
+	ifstream in(filename, ios::binary);
+	ostringstream ret;
+	ret << in.rdbuf();
+	return ret.str();
+}
+
+// The bytes encoder_type gives for s through an ordinary stream.
+template<class encoder_type>
+string encoded(const chars& s)
+{
+	ostringstream out;
+	unicode::specific_uostream<encoder_type> us(&out);
+
+	for(size_t i=0; i < s.size(); ++i)
+		us.put(s[i]);
+
+	us.flush();
+	return out.str();
+}
+
+// Write s through specific_async_uofstream<encoder_type> with every block size and
+// count, and check the file each time. Half way through, flush() has to have put
+// everything so far in the file.
+template<class encoder_type>
+void test_write(const char* name, const chars& s)
+{
+	string expect = encoded<encoder_type>(s);
+	chars half(s.begin(), s.begin() + s.size() / 2);
+	string expect_half = encoded<encoder_type>(half);
+
+	int cases = 0, failed = 0, printed = 0;
+
+	for(size_t i=0; i < sizeof(block_sizes) / sizeof(block_sizes[0]); ++i)
+	{
+		for(size_t j=0; j < sizeof(block_counts) / sizeof(block_counts[0]); ++j)
+		{
+			ostringstream what;
+			what << "block size " << block_sizes[i] << ", " << block_counts[j] << " blocks";
+
+			unicode::specific_async_uofstream<encoder_type> out(temp_file, block_sizes[i], block_counts[j]);
+			++cases;
+
+			if(!out.is_open())
+			{
+				++failed;
+				fail(printed, name, what.str() + ": couldn't open " + temp_file);
+				continue;
+			}
+
+			for(size_t k=0; k < half.size(); ++k)
+				out.put(half[k]);
+
+			out.flush();
+			bool ok = read_file(temp_file) == expect_half;
+
+			if(!ok)
+				fail(printed, name, what.str() + ": the file doesn't hold everything put before flush()");
+
+			for(size_t k=half.size(); k < s.size(); ++k)
+				out.put(s[k]);
+
+			out.close();
+
+			if(ok && read_file(temp_file) != expect)
+			{
+				ok = false;
+				fail(printed, name, what.str() + ": the file doesn't match the encoder's output");
+			}
+
+			failed += !ok;
+		}
+	}
+
+	report(name, cases, failed);
+}
+
+// Write s with specific_async_uofstream<encoder_type> and read it back through
+// specific_prefetch_uifstream<decoder_type> with every block size and count.
+template<class encoder_type, class decoder_type>
+void test_read(const char* name, const chars& s)
+{
+	{
+		unicode::specific_async_uofstream<encoder_type> out(temp_file, 1001, 3);
+
+		for(size_t i=0; i < s.size(); ++i)
+			out.put(s[i]);
+	}
+
+	int cases = 0, failed = 0, printed = 0;
+
+	for(size_t i=0; i < sizeof(read_block_sizes) / sizeof(read_block_sizes[0]); ++i)
+	{
+		for(size_t j=0; j < sizeof(block_counts) / sizeof(block_counts[0]); ++j)
+		{
+			ostringstream what;
+			what << "block size " << read_block_sizes[i] << ", " << block_counts[j] << " blocks";
+
+			unicode::specific_prefetch_uifstream<decoder_type> in(temp_file, read_block_sizes[i], block_counts[j]);
+			chars got;
+
+			for(boost::int_fast32_t ch; (ch = in.get()) != EOF; )
+				got.push_back((boost::uint32_t)ch);
+
+			++cases;
+
+			if(got != s)
+			{
+				++failed;
+				fail(printed, name, what.str() + ": didn't read back what was written");
+			}
+		}
+	}
+
+	report(name, cases, failed);
+}
+
+// The read-ahead validation mustn't find anything wrong with valid UTF-8, and has to
+// find malformed UTF-8 wherever it falls in a block, including in a character cut in
+// two by the end of one, and at the end of the file.
+void test_validate()
+{
+	int cases = 0, failed = 0, printed = 0;
+	const string good = to_utf8(sample_text());
+
+	{
+		ofstream out(temp_file, ios::binary);
+		out << good;
+	}
+
+	for(size_t i=0; i < sizeof(read_block_sizes) / sizeof(read_block_sizes[0]); ++i)
+	{
+		unicode::utf8_prefetch_uifstream in(temp_file, read_block_sizes[i], 3, true);
+
+		while(in.get() != EOF)
+			;
+
+		++cases;
+
+		if(in.first_invalid() != -1)
+		{
+			++failed;
+			ostringstream what;
+			what << "block size " << read_block_sizes[i] << ": first_invalid() gave " << in.first_invalid() << " for valid UTF-8";
+			fail(printed, "prefetch validation", what.str());
+		}
+	}
+
+	for(size_t i=0; i < sizeof(read_block_sizes) / sizeof(read_block_sizes[0]); ++i)
+	{
+		// A stray continuation byte, a lead byte without its continuation bytes, and a
+		// four byte character cut short by the end of the file.
+		for(int kind=0; kind < 3; ++kind)
+		{
+			// Around the end of the block that 1000 is in.
+			size_t boundary = (1000 / read_block_sizes[i] + 1) * read_block_sizes[i];
+
+			for(size_t at = boundary - 4; at < boundary + 4; ++at)
+			{
+				// Only start the lead byte or stray byte between characters.
+				size_t pos = at;
+
+				while((good[pos] & 0xC0) == 0x80)
+					++pos;
+
+				string bytes;
+				std::streamoff expect = pos;
+
+				if(kind == 0)
+					bytes = good.substr(0, pos) + "\x80" + good.substr(pos);
+				else if(kind == 1)
+					bytes = good.substr(0, pos) + "\xE6\x97" + good.substr(pos);
+				else
+					bytes = good.substr(0, pos) + "\xF0\x9F\x98";
+
+				{
+					ofstream out(temp_file, ios::binary);
+					out << bytes;
+				}
+
+				unicode::utf8_prefetch_uifstream in(temp_file, read_block_sizes[i], 3, true);
+
+				while(in.get() != EOF)
+					;
+
+				++cases;
+
+				if(in.first_invalid() != expect)
+				{
+					++failed;
+					ostringstream what;
+					what << "block size " << read_block_sizes[i] << ", malformed UTF-8 of kind " << kind << " at " << expect
+						<< ": first_invalid() gave " << in.first_invalid();
+					fail(printed, "prefetch validation", what.str());
+				}
+			}
+		}
+	}
+
+	report("prefetch validation", cases, failed);
+}
+
+// Seeking through an istream on a prefetch_filebuf, inside the block in memory and
+// outside it, and stepping back with unget() over the start of a block: after every
+// byte read, the last four are ungotten and read again.
+void test_seek()
+{
+	int cases = 0, failed = 0, printed = 0;
+	const string bytes = to_utf8(sample_text());
+	const std::streamoff size = bytes.size();
+
+	{
+		ofstream out(temp_file, ios::binary);
+		out << bytes;
+	}
+
+	const std::streamoff offsets[] = { 0, 1, 6, 7, 8, 500, 499, 10300, 3, 8007, 8006, 17 };
+
+	for(size_t i=0; i < sizeof(read_block_sizes) / sizeof(read_block_sizes[0]); ++i)
+	{
+		unicode::prefetch_filebuf fb(read_block_sizes[i], 3);
+		fb.open(temp_file);
+		istream in(&fb);
+
+		for(size_t j=0; j < sizeof(offsets) / sizeof(offsets[0]); ++j)
+		{
+			std::streamoff at = offsets[j];
+			std::streamoff end = at + 2 * read_block_sizes[i] + 8;
+			bool ok = true;
+
+			in.clear();
+			in.seekg(at);
+			++cases;
+
+			for(std::streamoff pos = at; ok && pos < end && pos < size; ++pos)
+			{
+				ok = in.get() == (boost::uint8_t)bytes[pos];
+
+				if(ok && pos - at >= 3)
+				{
+					for(int k=0; k < 4; ++k)
+						ok = ok && in.unget();
+
+					for(int k=3; k >= 0; --k)
+						ok = ok && in.get() == (boost::uint8_t)bytes[pos - k];
+				}
+			}
+
+			if(ok && end < size)
+				ok = in.tellg() == end;
+
+			if(!ok)
+			{
+				++failed;
+				ostringstream what;
+				what << "block size " << read_block_sizes[i] << ", reading from " << at;
+				fail(printed, "prefetch seek", what.str());
+			}
+		}
+
+		in.clear();
+		in.seekg(-5, ios::end);
+		++cases;
+
+		if(in.tellg() != size - 5 || in.get() != (boost::uint8_t)bytes[size - 5])
+		{
+			++failed;
+			fail(printed, "prefetch seek", "seeking from the end");
+		}
+	}
+
+	report("prefetch seek", cases, failed);
+}
+
+int main()
+{
+	chars s = sample_text();
+
+	test_write<unicode::utf8_encoder>("utf8_async_uofstream", s);
+	test_write<unicode::utf16le_encoder>("utf16le_async_uofstream", s);
+	test_write<unicode::utf16be_encoder>("utf16be_async_uofstream", s);
+	test_write<unicode::utf32le_encoder>("utf32le_async_uofstream", s);
+	test_write<unicode::utf32be_encoder>("utf32be_async_uofstream", s);
+
+	test_read<unicode::utf8_encoder, unicode::utf8_decoder>("utf8_prefetch_uifstream", s);
+	test_read<unicode::utf16le_encoder, unicode::utf16le_decoder>("utf16le_prefetch_uifstream", s);
+	test_read<unicode::utf16be_encoder, unicode::utf16be_decoder>("utf16be_prefetch_uifstream", s);
+	test_read<unicode::utf32le_encoder, unicode::utf32le_decoder>("utf32le_prefetch_uifstream", s);
+	test_read<unicode::utf32be_encoder, unicode::utf32be_decoder>("utf32be_prefetch_uifstream", s);
+
+	test_validate();
+	test_seek();
+
+	std::remove(temp_file);
+
+	return failures() ? 1 : 0;
+}
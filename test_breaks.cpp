@@ -0,0 +1,393 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the text boundaries against the cases below and against the UAX #29 and
+// UAX #14 test files from the UCD's auxiliary directory (GraphemeBreakTest.txt,
+// WordBreakTest.txt and LineBreakTest.txt), if they're in the directory given as the
+// argument.
+//
+//	test_breaks [directory]
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "grapheme.hpp"
+#include "word_break.hpp"
+#include "line_break.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+// The marks in the test files for a boundary (÷) and no boundary (×).
+#define BRK "\xC3\xB7"
+#define NOBRK "\xC3\x97"
+
+// One line of a test file: the characters, and whether there's a boundary before
+// each of them and at the end.
+struct break_case
+{
+	vector<boost::uint32_t> chars;
+	vector<bool> breaks;
+};
+
+bool parse_case(const string& line, break_case& c)
+{
+	string s = strip_comment(line);
+	c.chars.clear();
+	c.breaks.clear();
+
+	for(string::size_type pos = 0; pos < s.size(); )
+	{
+		string::size_type end = s.find_first_of(" \t", pos);
+		if(end == string::npos)
+			end = s.size();
+
+		string token = s.substr(pos, end - pos);
+
+		if(token == BRK || token == NOBRK)
+			c.breaks.push_back(token == BRK);
+		else if(!token.empty())
+			c.chars.push_back((boost::uint32_t)strtoul(token.c_str(), 0, 16));
+
+		pos = end + 1;
+	}
+
+	return !c.chars.empty() && c.breaks.size() == c.chars.size() + 1;
+}
+
+// The start of the text isn't compared: it's a boundary for grapheme clusters and
+// words, but not a line break opportunity (LB2), and nothing is found there anyway.
+bool same_breaks(const vector<bool>& a, const vector<bool>& b)
+{
+	return a.size() == b.size() && equal(a.begin() + 1, a.end(), b.begin() + 1);
+}
+
+// A way of finding boundaries: fills breaks (one entry per character and one for
+// the end) given the UTF-8 text and the offset of each character in it.
+typedef void (*break_finder)(const boost::uint8_t* first, const boost::uint8_t* last, const vector<size_t>& offsets, vector<bool>& breaks);
+
+// Mark the boundary at p.
+void mark(const boost::uint8_t* first, const boost::uint8_t* p, const vector<size_t>& offsets, vector<bool>& breaks)
+{
+	vector<size_t>::const_iterator i = lower_bound(offsets.begin(), offsets.end(), (size_t)(p - first));
+
+	if(i != offsets.end() && *i == (size_t)(p - first))
+		breaks[i - offsets.begin()] = true;
+}
+
+//--------------------------------------------------------------------------------
+// Grapheme clusters, found each of the ways grapheme.hpp can find them.
+//--------------------------------------------------------------------------------
+
+void graphemes_forward(const boost::uint8_t* first, const boost::uint8_t* last, const vector<size_t>& offsets, vector<bool>& breaks)
+{
+	for(const boost::uint8_t* p = first; ; p = unicode::next_grapheme(p, last))
+	{
+		mark(first, p, offsets, breaks);
+
+		if(p == last)
+			break;
+	}
+}
+
+void graphemes_backward(const boost::uint8_t* first, const boost::uint8_t* last, const vector<size_t>& offsets, vector<bool>& breaks)
+{
+	for(const boost::uint8_t* p = last; ; p = unicode::prior_grapheme(first, p))
+	{
+		mark(first, p, offsets, breaks);
+
+		if(p == first)
+			break;
+	}
+}
+
+void graphemes_at(const boost::uint8_t* first, const boost::uint8_t*, const vector<size_t>& offsets, vector<bool>& breaks)
+{
+	for(size_t i=0; i + 1 < offsets.size(); ++i)
+		breaks[i] = unicode::is_grapheme_boundary(first, first + offsets[i]);
+
+	breaks.back() = true;
+}
+
+// Through the free functions over a ustring_view.
+void graphemes_iterator(const boost::uint8_t* first, const boost::uint8_t* last, const vector<size_t>& offsets, vector<bool>& breaks)
+{
+	unicode::ustring_view s(first, last - first);
+
+	for(unicode::grapheme_iterator g = unicode::grapheme_begin(s); g != unicode::grapheme_end(s); ++g)
+	{
+		unicode::ustring_view cluster = unicode::segment_view(g);
+		mark(first, cluster.data(), offsets, breaks);
+		mark(first, cluster.data() + cluster.bytes(), offsets, breaks);
+	}
+}
+
+// One cluster at a time with substr_graphemes, as many as grapheme_count says there are.
+void graphemes_substr(const boost::uint8_t* first, const boost::uint8_t* last, const vector<size_t>& offsets, vector<bool>& breaks)
+{
+	unicode::ustring_view s(first, last - first);
+	int qty = unicode::grapheme_count(s);
+
+	for(int i=0; i < qty; ++i)
+	{
+		unicode::ustring_view cluster = unicode::substr_graphemes(s, i, 1);
+		mark(first, cluster.data() + cluster.bytes(), offsets, breaks);
+	}
+}
+
+// Code points from memory, for the stream readers.
+class char_source
+{
+public:
+	char_source(const vector<boost::uint32_t>& _chars) : chars(_chars), pos(0)
+	{
+	}
+
+	boost::int_fast32_t get()
+	{
+		return pos < chars.size() ? (boost::int_fast32_t)chars[pos++] : EOF;
+	}
+
+private:
+	const vector<boost::uint32_t>& chars;
+	size_t pos;
+};
+
+void graphemes_reader(const vector<boost::uint32_t>& chars, vector<bool>& breaks)
+{
+	char_source src(chars);
+	unicode::grapheme_reader<char_source> reader(&src);
+	vector<boost::uint32_t> cluster;
+	size_t pos = 0;
+
+	breaks[0] = true;
+
+	while(reader.next(cluster))
+	{
+		pos += cluster.size();
+
+		if(pos < breaks.size())
+			breaks[pos] = true;
+	}
+}
+
+//--------------------------------------------------------------------------------
+// Word boundaries and line break opportunities, found in memory and from a stream.
+//--------------------------------------------------------------------------------
+
+void words_forward(const boost::uint8_t* first, const boost::uint8_t* last, const vector<size_t>& offsets, vector<bool>& breaks)
+{
+	for(const boost::uint8_t* p = first; ; p = unicode::next_word_boundary(p, last))
+	{
+		mark(first, p, offsets, breaks);
+
+		if(p == last)
+			break;
+	}
+}
+
+void words_reader(const vector<boost::uint32_t>& chars, vector<bool>& breaks)
+{
+	char_source src(chars);
+	unicode::word_reader<char_source> reader(&src);
+	vector<boost::uint32_t> segment;
+	size_t pos = 0;
+
+	breaks[0] = true;
+
+	while(reader.next(segment))
+	{
+		pos += segment.size();
+
+		if(pos < breaks.size())
+			breaks[pos] = true;
+	}
+}
+
+void lines_forward(const boost::uint8_t* first, const boost::uint8_t* last, const vector<size_t>& offsets, vector<bool>& breaks)
+{
+	for(const boost::uint8_t* p = first; ; p = unicode::next_line_break(p, last))
+	{
+		mark(first, p, offsets, breaks);
+
+		if(p == last)
+			break;
+	}
+}
+
+void lines_reader(const vector<boost::uint32_t>& chars, vector<bool>& breaks)
+{
+	char_source src(chars);
+	unicode::line_break_reader<char_source> reader(&src);
+	vector<boost::uint32_t> segment;
+	bool mandatory;
+	size_t pos = 0;
+
+	breaks[0] = true;
+
+	while(reader.next(segment, mandatory))
+	{
+		pos += segment.size();
+
+		if(pos < breaks.size())
+			breaks[pos] = true;
+	}
+}
+
+//--------------------------------------------------------------------------------
+
+string describe(const break_case& c, const vector<bool>& breaks)
+{
+	string ret;
+
+	for(size_t i=0; i < c.chars.size(); ++i)
+	{
+		vector<boost::uint32_t> one(1, c.chars[i]);
+		ret += breaks[i] ? BRK " " : NOBRK " ";
+		ret += to_hex(one) + " ";
+	}
+
+	return ret + (breaks.back() ? BRK : NOBRK);
+}
+
+// Check one case with each of the finders, and with the reader if there is one.
+bool check_case(const char* what, const break_case& c, const break_finder* finders, size_t finder_qty,
+	void (*reader)(const vector<boost::uint32_t>&, vector<bool>&), int& printed)
+{
+	vector<size_t> offsets;
+	string text = to_utf8(c.chars, &offsets);
+	const boost::uint8_t* first = (const boost::uint8_t*)text.data();
+	bool ok = true;
+
+	for(size_t i=0; i <= finder_qty; ++i)
+	{
+		vector<bool> breaks(c.breaks.size(), false);
+
+		if(i < finder_qty)
+			finders[i](first, first + text.size(), offsets, breaks);
+		else if(reader)
+			reader(c.chars, breaks);
+		else
+			break;
+
+		if(!same_breaks(breaks, c.breaks))
+		{
+			fail(printed, what, "expected " + describe(c, c.breaks) + " got " + describe(c, breaks));
+			ok = false;
+			break;
+		}
+	}
+
+	return ok;
+}
+
+void run_cases(const char* name, const char* const* lines, size_t qty, const break_finder* finders, size_t finder_qty,
+	void (*reader)(const vector<boost::uint32_t>&, vector<bool>&))
+{
+	int cases = 0, failed = 0, printed = 0;
+	break_case c;
+
+	for(size_t i=0; i < qty; ++i)
+	{
+		check(parse_case(lines[i], c), "parse built-in case");
+
+		++cases;
+		failed += !check_case(name, c, finders, finder_qty, reader, printed);
+	}
+
+	report(name, cases, failed);
+}
+
+void run_file(const string& dir, const char* name, const break_finder* finders, size_t finder_qty,
+	void (*reader)(const vector<boost::uint32_t>&, vector<bool>&))
+{
+	ifstream in;
+
+	if(!open_data(in, dir, name))
+		return;
+
+	int cases = 0, failed = 0, printed = 0;
+	break_case c;
+
+	for(string line; getline(in, line); )
+	{
+		if(!parse_case(line, c))
+			continue;
+
+		++cases;
+		failed += !check_case(name, c, finders, finder_qty, reader, printed);
+	}
+
+	report(name, cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+
+const char* const grapheme_cases[] = {
+	BRK " 0061 " BRK " 0062 " BRK,								// ASCII
+	BRK " 000D " NOBRK " 000A " BRK " 0061 " BRK,						// GB3 CR LF
+	BRK " 000A " BRK " 0301 " BRK,								// GB4 no Extend after a control
+	BRK " 0065 " NOBRK " 0301 " BRK " 0066 " BRK,						// GB9 Extend
+	BRK " 1100 " NOBRK " 1161 " NOBRK " 11A8 " BRK " AC00 " NOBRK " 11A8 " BRK,		// GB6-8 Hangul
+	BRK " 0915 " NOBRK " 093F " BRK,							// GB9a SpacingMark
+	BRK " 0600 " NOBRK " 0031 " BRK,							// GB9b Prepend
+	BRK " 0061 " NOBRK " 200D " BRK " 0062 " BRK,						// GB9 ZWJ, but no GB11
+	BRK " 1F468 " NOBRK " 200D " NOBRK " 1F469 " NOBRK " 200D " NOBRK " 1F467 " BRK,	// GB11 ZWJ sequence
+	BRK " 2764 " NOBRK " FE0F " NOBRK " 200D " NOBRK " 1F525 " BRK,				// GB11 with Extend
+	BRK " 1F1FA " NOBRK " 1F1F8 " BRK " 1F1EB " NOBRK " 1F1F7 " BRK " 1F1E9 " BRK,		// GB12/13 flags
+	BRK " 0061 " BRK " 1F1FA " NOBRK " 1F1F8 " NOBRK " 0308 " BRK " 1F1E9 " BRK,		// GB12/13 after other text
+};
+
+const char* const word_cases[] = {
+	BRK " 0063 " NOBRK " 0061 " NOBRK " 006E " NOBRK " 0027 " NOBRK " 0074 " BRK,		// WB6/7 can't
+	BRK " 0033 " NOBRK " 002E " NOBRK " 0031 " NOBRK " 0034 " BRK,				// WB11/12 3.14
+	BRK " 0061 " BRK " 002C " BRK " 0062 " BRK,						// comma between letters
+	BRK " 0061 " BRK " 0020 " NOBRK " 0020 " BRK " 0062 " BRK,				// WB3d spaces
+	BRK " 000D " NOBRK " 000A " BRK " 0061 " BRK,						// WB3/3a CR LF
+	BRK " 0041 " NOBRK " 0301 " NOBRK " 0042 " BRK,						// WB4 Extend
+	BRK " 0061 " NOBRK " 005F " NOBRK " 0062 " BRK,						// WB13a/b ExtendNumLet
+	BRK " 3042 " BRK " 3044 " BRK,								// Hiragana
+	BRK " 30A2 " NOBRK " 30A4 " BRK,							// WB13 Katakana
+	BRK " 1F476 " NOBRK " 1F3FF " BRK,							// WB4 emoji modifier
+	BRK " 0061 " BRK " 1F468 " NOBRK " 200D " NOBRK " 1F469 " BRK,				// WB3c ZWJ
+	BRK " 1F1FA " NOBRK " 1F1F8 " BRK " 1F1EB " NOBRK " 1F1F7 " BRK,				// WB15/16 flags
+};
+
+const char* const line_cases[] = {
+	NOBRK " 0061 " NOBRK " 0062 " NOBRK " 0020 " BRK " 0063 " BRK,				// LB7/18 spaces
+	NOBRK " 0061 " NOBRK " 0020 " NOBRK " 0020 " BRK " 0062 " BRK,
+	NOBRK " 0061 " NOBRK " 000A " BRK " 0062 " BRK,						// LB5/6 LF
+	NOBRK " 0031 " NOBRK " 0030 " NOBRK " 0025 " BRK,					// LB25 10%
+	NOBRK " 0028 " NOBRK " 0061 " NOBRK " 0029 " BRK,					// LB13/14 brackets
+	NOBRK " 4E00 " BRK " 4E8C " BRK,							// LB31 ideographs
+	NOBRK " 4E00 " NOBRK " 3002 " BRK " 4E8C " BRK,						// LB13 CL
+	NOBRK " 0061 " NOBRK " 002D " BRK " 0062 " BRK,						// LB21 hyphen
+	NOBRK " 0061 " NOBRK " 00A0 " NOBRK " 0062 " BRK,					// LB12/12a no-break space
+	NOBRK " 0061 " NOBRK " 200B " BRK " 0062 " BRK,						// LB7/8 ZWSP
+	NOBRK " 1F1FA " NOBRK " 1F1F8 " BRK " 1F1EB " NOBRK " 1F1F7 " BRK,			// LB30a flags
+};
+
+const break_finder grapheme_finders[] = { graphemes_forward, graphemes_backward, graphemes_at, graphemes_iterator, graphemes_substr };
+const break_finder word_finders[] = { words_forward };
+const break_finder line_finders[] = { lines_forward };
+
+int main(int argc, char** argv)
+{
+	string dir = data_dir(argc, argv);
+	const size_t grapheme_finder_qty = sizeof(grapheme_finders) / sizeof(grapheme_finders[0]);
+
+	run_cases("grapheme clusters", grapheme_cases, sizeof(grapheme_cases) / sizeof(grapheme_cases[0]), grapheme_finders, grapheme_finder_qty, graphemes_reader);
+	run_file(dir, "GraphemeBreakTest.txt", grapheme_finders, grapheme_finder_qty, graphemes_reader);
+
+	run_cases("word boundaries", word_cases, sizeof(word_cases) / sizeof(word_cases[0]), word_finders, 1, words_reader);
+	run_file(dir, "WordBreakTest.txt", word_finders, 1, words_reader);
+
+	run_cases("line breaks", line_cases, sizeof(line_cases) / sizeof(line_cases[0]), line_finders, 1, lines_reader);
+	run_file(dir, "LineBreakTest.txt", line_finders, 1, lines_reader);
+
+	return failures() ? 1 : 0;
+}
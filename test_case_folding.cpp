@@ -0,0 +1,232 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks case folding, compare_nocase() and hash_nocase() against the cases below, and
+// the folding of every code point against CaseFolding.txt if it's in the directory
+// given as the argument.
+//
+//	test_case_folding [directory]
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "ustream.hpp"
+#include "ustring.h"
+#include "case_folding.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef unicode::basic_ustring<unicode::utf8_encoder, unicode::utf8_decoder> test_string;
+typedef vector<boost::uint32_t> chars;
+
+const boost::uint32_t max_code_point = 0x10FFFF;
+
+//--------------------------------------------------------------------------------
+// Known strings
+//--------------------------------------------------------------------------------
+
+struct nocase_case
+{
+	const char* a;
+	const char* b;
+	int order; // compare_nocase(a, b)
+	bool turkic;
+};
+
+// Foldings to more than one character, the three sigmas, dotted and dotless I with and
+// without Turkic folding, and ASCII long enough to be compared in 16 byte blocks with
+// the difference before, in and after a block.
+const nocase_case nocase_cases[] = {
+	{ "Stra\xC3\x9F" "e", "STRASSE", 0, false }, // U+00DF
+	{ "\xC3\x9F", "ss", 0, false },
+	{ "\xE1\xBA\x9E", "SS", 0, false }, // U+1E9E
+	{ "\xC3\x9F", "s", 1, false },
+	{ "\xC3\x9F", "st", -1, false },
+	{ "\xEF\xAC\x83", "FFI", 0, false }, // U+FB03
+	{ "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3", "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82", 0, false }, // ΟΔΟΣ, οδος with final sigma
+	{ "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82", "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x83", 0, false }, // Final and medial sigma.
+	{ "\xCF\x82\xCF\x83", "\xCE\xA3\xCE\xA3", 0, false },
+	{ "\xC4\xB0", "i\xCC\x87", 0, false }, // U+0130 is i and a combining dot.
+	{ "\xC4\xB0", "i", 1, false },
+	{ "\xC4\xB0", "I\xCC\x87", 0, false },
+	{ "I", "\xC4\xB1", -1, false }, // U+0131 doesn't fold.
+	{ "\xC4\xB0", "i", 0, true },
+	{ "I", "\xC4\xB1", 0, true },
+	{ "I", "i", 1, true },
+	{ "\xC4\xB0stanbul", "istanbul", 0, true },
+	{ "", "", 0, false },
+	{ "", "a", -1, false },
+	{ "The quick brown fox jumps over the lazy dog", "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG", 0, false },
+	{ "The quick brown fox jumps over the lazy dog", "THE QUICK BROWN FOX JUMPS OVER THE LAZY COG", 1, false },
+	{ "The quick brown fox jumps", "THE QUICK BROWN FOX JUMPS OVER", -1, false },
+	{ "The quick brown Fox jumps over the lazy dog", "THE QUICK BROWN GOX JUMPS OVER THE LAZY DOG", -1, false },
+	{ "The quick brown fox jumps over the lazy dog Stra\xC3\x9F" "e", "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG STRASSE", 0, false },
+	{ "[quick]", "{QUICK}", -1, false }, // Not letters, so not folded.
+	{ "@ABCDEFGHIJKLMNOPQRSTUVWXYZ[", "@abcdefghijklmnopqrstuvwxyz[", 0, false },
+};
+
+int sign(int x)
+{
+	return x < 0 ? -1 : x > 0;
+}
+
+// Both ways round, with equal strings hashing the same, and the function objects agreeing.
+void test_nocase()
+{
+	int cases = 0, failed = 0, printed = 0;
+
+	for(size_t i=0; i < sizeof(nocase_cases) / sizeof(nocase_cases[0]); ++i)
+	{
+		const nocase_case& c = nocase_cases[i];
+		unicode::ustring_view a(c.a), b(c.b);
+		bool equal = c.order == 0;
+		bool ok = sign(unicode::compare_nocase(a, b, c.turkic)) == c.order && sign(unicode::compare_nocase(b, a, c.turkic)) == -c.order
+			&& (unicode::hash_nocase(a, c.turkic) == unicode::hash_nocase(b, c.turkic)) == equal;
+
+		if(!c.turkic)
+		{
+			ok = ok && unicode::nocase_equal()(a, b) == equal && unicode::nocase_less()(a, b) == (c.order < 0)
+				&& (unicode::nocase_hash()(a) == unicode::nocase_hash()(b)) == equal;
+		}
+
+		++cases;
+
+		if(!ok)
+		{
+			ostringstream what;
+			what << "\"" << c.a << "\" and \"" << c.b << "\"" << (c.turkic ? " (Turkic)" : "");
+			++failed;
+			fail(printed, "compare_nocase", what.str());
+		}
+	}
+
+	report("compare_nocase, hash_nocase", cases, failed);
+}
+
+// A string holding the UTF-8 in utf8 (constructing one from a char* takes each char as
+// a code point).
+test_string make_string(const char* utf8)
+{
+	unicode::ustring_view v(utf8);
+	test_string ret;
+	ret.append_utf8(v.data(), v.bytes(), v.size());
+	return ret;
+}
+
+// Folded copies of strings.
+void test_fold_strings()
+{
+	int failed = 0, printed = 0;
+	const char* const strings[][3] = {
+		// String, folded, folded for Turkic.
+		{ "Stra\xC3\x9F" "e", "strasse", "strasse" },
+		{ "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3", "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x83", "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x83" },
+		{ "\xC4\xB0stanbul IRMAK", "i\xCC\x87stanbul irmak", "istanbul \xC4\xB1rmak" },
+		{ "", "", "" },
+	};
+	const int qty = sizeof(strings) / sizeof(strings[0]);
+
+	for(int i=0; i < qty; ++i)
+	{
+		for(int turkic=0; turkic < 2; ++turkic)
+		{
+			test_string folded = unicode::fold_case(make_string(strings[i][0]), turkic != 0);
+
+			if(unicode::ustring_view(folded) != unicode::ustring_view(strings[i][1 + turkic]))
+			{
+				++failed;
+				fail(printed, "fold_case", string("\"") + strings[i][0] + "\"" + (turkic ? " (Turkic)" : ""));
+			}
+		}
+	}
+
+	report("fold_case (strings)", qty * 2, failed);
+}
+
+//--------------------------------------------------------------------------------
+// CaseFolding.txt
+//--------------------------------------------------------------------------------
+
+// Check the simple, full and Turkic folding of every code point (other than
+// surrogates) against CaseFolding.txt, where characters that aren't listed fold to
+// themselves. Each character also has to compare equal to, and hash the same as, its
+// full folding.
+void test_file(const string& dir)
+{
+	ifstream in;
+
+	if(!open_data(in, dir, "CaseFolding.txt"))
+		return;
+
+	vector<chars> simple(max_code_point + 1), full(max_code_point + 1), turkic(max_code_point + 1);
+	string line;
+
+	while(getline(in, line))
+	{
+		line = strip_comment(line);
+		istringstream fields(line);
+		string code, status, mapping;
+
+		if(!getline(fields, code, ';') || !getline(fields, status, ';') || !getline(fields, mapping, ';'))
+			continue;
+
+		boost::uint32_t cp = parse_hex(code)[0];
+		chars to = parse_hex(mapping);
+
+		if(status.find('C') != string::npos)
+			simple[cp] = full[cp] = to;
+		else if(status.find('S') != string::npos)
+			simple[cp] = to;
+		else if(status.find('F') != string::npos)
+			full[cp] = to;
+		else if(status.find('T') != string::npos)
+			turkic[cp] = to;
+	}
+
+	int cases = 0, failed = 0, printed = 0;
+
+	for(boost::uint32_t cp=0; cp <= max_code_point; ++cp)
+	{
+		if(cp >= 0xD800 && cp <= 0xDFFF)
+			continue;
+
+		chars self(1, cp);
+		const chars& expect_simple = simple[cp].empty() ? self : simple[cp];
+		const chars& expect_full = full[cp].empty() ? expect_simple : full[cp];
+		const chars& expect_turkic = turkic[cp].empty() ? expect_full : turkic[cp];
+
+		boost::uint32_t buf[unicode::max_case_folding];
+		int n = unicode::fold_case_full(cp, buf);
+		bool ok = unicode::fold_case(cp) == expect_simple[0] && chars(buf, buf + n) == expect_full;
+
+		n = unicode::fold_case_full(cp, buf, true);
+		ok = ok && chars(buf, buf + n) == expect_turkic && unicode::fold_case(cp, true) == (turkic[cp].empty() ? expect_simple : turkic[cp])[0];
+
+		string a = to_utf8(self), b = to_utf8(expect_full);
+		ok = ok && unicode::compare_nocase(a, b) == 0 && unicode::hash_nocase(a) == unicode::hash_nocase(b);
+
+		++cases;
+
+		if(!ok)
+		{
+			++failed;
+			fail(printed, "CaseFolding.txt", to_hex(self));
+		}
+	}
+
+	report("CaseFolding.txt", cases, failed);
+}
+
+int main(int argc, char** argv)
+{
+	test_nocase();
+	test_fold_strings();
+	test_file(data_dir(argc, argv));
+
+	return failures() ? 1 : 0;
+}
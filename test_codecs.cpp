@@ -0,0 +1,402 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Round trips every character of the legacy codecs through the stream decoders and
+// encoders and the block conversions, and checks some well-known mappings.
+//
+//	test_codecs
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "single_byte.hpp"
+#include "multi_byte.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef vector<boost::uint32_t> chars;
+
+// Decode all of bytes with decoder_type.
+template<class decoder_type>
+chars decode_all(decoder_type& dec)
+{
+	chars ret;
+
+	for(boost::int_fast32_t ch; (ch = dec.decode()) != EOF; )
+		ret.push_back((boost::uint32_t)ch);
+
+	return ret;
+}
+
+// Encode all of s with encoder_type and return the bytes.
+template<class encoder_type>
+string encode_all(encoder_type& enc, ostringstream& out, const chars& s)
+{
+	for(size_t i=0; i < s.size(); ++i)
+		enc.encode(s[i]);
+
+	enc.flush();
+	return out.str();
+}
+
+//--------------------------------------------------------------------------------
+// Single-byte code pages
+//--------------------------------------------------------------------------------
+
+struct mapping
+{
+	int code_page;
+	boost::uint8_t byte;
+	boost::uint32_t ch;
+};
+
+const mapping single_byte_mappings[] = {
+	{ unicode::code_page_iso8859_1, 0xE9, 0x00E9 },
+	{ unicode::code_page_iso8859_2, 0xA1, 0x0104 },
+	{ unicode::code_page_iso8859_5, 0xB0, 0x0410 },
+	{ unicode::code_page_iso8859_7, 0xC1, 0x0391 },
+	{ unicode::code_page_iso8859_11, 0xA1, 0x0E01 },
+	{ unicode::code_page_iso8859_15, 0xA4, 0x20AC },
+	{ unicode::code_page_iso8859_16, 0xA4, 0x20AC },
+	{ unicode::code_page_windows1250, 0x8A, 0x0160 },
+	{ unicode::code_page_windows1251, 0xC0, 0x0410 },
+	{ unicode::code_page_windows1252, 0x80, 0x20AC },
+	{ unicode::code_page_windows1252, 0x9F, 0x0178 },
+	{ unicode::code_page_windows1255, 0xE0, 0x05D0 },
+	{ unicode::code_page_windows1258, 0xCC, 0x0300 },
+};
+
+void test_single_byte()
+{
+	int cases = 0, failed = 0, printed = 0;
+	char buf[64];
+
+	for(int cp=0; cp < unicode::single_byte_data<>::code_page_count; ++cp)
+	{
+		// Every byte the code page uses, and its character.
+		string bytes;
+		chars expect;
+
+		for(int b=0; b < 256; ++b)
+		{
+			boost::uint16_t ch = unicode::single_byte_to_unicode(cp, (boost::uint8_t)b);
+
+			if(ch == 0xFFFF)
+				continue;
+
+			bytes += (char)b;
+			expect.push_back(ch);
+
+			++cases;
+			sprintf(buf, "code page %d byte %02X", cp, b);
+
+			if(unicode::unicode_to_single_byte(cp, ch) != b)
+			{
+				++failed;
+				fail(printed, "unicode_to_single_byte", buf);
+			}
+		}
+
+		// Through the stream decoder and encoder.
+		istringstream in(bytes);
+		unicode::basic_single_byte_decoder<> dec(&in, cp);
+		ostringstream out;
+		unicode::basic_single_byte_encoder enc(&out, cp);
+		sprintf(buf, "code page %d", cp);
+
+		++cases;
+		if(decode_all(dec) != expect || encode_all(enc, out, expect) != bytes)
+		{
+			++failed;
+			fail(printed, "single-byte streams", buf);
+		}
+
+		// Through the block conversions.
+		vector<boost::uint8_t> utf8(bytes.size() * 3), back(bytes.size());
+		const boost::uint8_t* first = (const boost::uint8_t*)bytes.data();
+		boost::uint8_t* end = unicode::single_byte_to_utf8(cp, first, first + bytes.size(), &utf8[0]);
+		boost::uint8_t* back_end = unicode::utf8_to_single_byte(cp, &utf8[0], end, &back[0]);
+
+		++cases;
+		if(string(utf8.begin(), utf8.begin() + (end - &utf8[0])) != to_utf8(expect) || string(back.begin(), back.begin() + (back_end - &back[0])) != bytes)
+		{
+			++failed;
+			fail(printed, "single-byte blocks", buf);
+		}
+	}
+
+	const int qty = sizeof(single_byte_mappings) / sizeof(single_byte_mappings[0]);
+
+	for(int i=0; i < qty; ++i)
+	{
+		const mapping& m = single_byte_mappings[i];
+		sprintf(buf, "code page %d byte %02X", m.code_page, m.byte);
+
+		++cases;
+		if(unicode::single_byte_to_unicode(m.code_page, m.byte) != m.ch)
+		{
+			++failed;
+			fail(printed, "single-byte mapping", buf);
+		}
+	}
+
+	// Characters a code page doesn't have are written as '?', and bytes it doesn't use
+	// are read as U+FFFD.
+	istringstream in("\x81");
+	unicode::windows1252_decoder dec(&in);
+	ostringstream out;
+	unicode::latin1_encoder enc(&out);
+	chars euro(1, 0x20AC);
+
+	cases += 2;
+	failed += decode_all(dec) != chars(1, 0xFFFD);
+	failed += encode_all(enc, out, euro) != "?";
+
+	// Names.
+	const char* names[] = { "latin1", "ISO-8859-15", "iso8859_2", "cp1252", "Windows-1258" };
+	const int name_code_pages[] = { unicode::code_page_iso8859_1, unicode::code_page_iso8859_15, unicode::code_page_iso8859_2, unicode::code_page_windows1252, unicode::code_page_windows1258 };
+
+	for(int i=0; i < 5; ++i)
+	{
+		++cases;
+		failed += unicode::find_single_byte_code_page(names[i]) != name_code_pages[i];
+	}
+
+	cases += 2;
+	failed += unicode::find_single_byte_code_page("iso-8859-12") != -1;
+	failed += unicode::find_single_byte_code_page("cp1249") != -1;
+
+	report("single-byte code pages", cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// Multi-byte encodings
+//--------------------------------------------------------------------------------
+
+struct multi_byte_mapping
+{
+	int encoding;
+	const char* bytes;
+	boost::uint32_t ch;
+};
+
+const multi_byte_mapping multi_byte_mappings[] = {
+	{ unicode::multi_byte_shift_jis, "\x82\xA0", 0x3042 },
+	{ unicode::multi_byte_shift_jis, "\xB1", 0xFF71 },			// Half-width katakana
+	{ unicode::multi_byte_shift_jis, "\x87\x40", 0x2460 },		// NEC extension
+	{ unicode::multi_byte_euc_jp, "\xA4\xA2", 0x3042 },
+	{ unicode::multi_byte_euc_jp, "\x8E\xB1", 0xFF71 },
+	{ unicode::multi_byte_euc_jp, "\x8F\xB0\xA1", 0x4E02 },		// JIS X 0212
+	{ unicode::multi_byte_gbk, "\xD6\xD0", 0x4E2D },
+	{ unicode::multi_byte_gb18030, "\xD6\xD0", 0x4E2D },
+	{ unicode::multi_byte_gb18030, "\xA2\xE3", 0x20AC },
+	{ unicode::multi_byte_gb18030, "\x81\x30\x81\x30", 0x0080 },	// Four bytes
+	{ unicode::multi_byte_gb18030, "\x84\x31\x97\x33", 0xFF71 },
+	{ unicode::multi_byte_gb18030, "\x90\x30\x81\x30", 0x10000 },
+	{ unicode::multi_byte_gb18030, "\xE3\x32\x9A\x35", 0x10FFFF },
+	{ unicode::multi_byte_big5, "\xA4\xA4", 0x4E2D },
+	{ unicode::multi_byte_big5, "\xA3\xE1", 0x20AC },
+};
+
+const char* const multi_byte_names[5] = { "Shift_JIS", "EUC-JP", "GBK", "GB18030", "Big5" };
+
+// Decode in blocks of block_size bytes with multi_byte_to_utf8(), carrying characters
+// split by the end of a block over to the next with multi_byte_whole().
+string multi_byte_to_utf8_in_blocks(int encoding, const string& bytes, size_t block_size)
+{
+	string ret, carry;
+	vector<boost::uint8_t> out;
+
+	for(size_t pos = 0; pos < bytes.size() || !carry.empty(); pos += block_size)
+	{
+		bool end = pos >= bytes.size();
+		string block = carry + (end ? string() : bytes.substr(pos, block_size));
+		const boost::uint8_t* first = (const boost::uint8_t*)block.data();
+		const boost::uint8_t* last = end || pos + block_size >= bytes.size() ? first + block.size() : unicode::multi_byte_whole(encoding, first, first + block.size());
+
+		out.resize(block.size() * 3 + 1);
+		ret.append((const char*)&out[0], unicode::multi_byte_to_utf8(encoding, first, last, &out[0]) - &out[0]);
+		carry.assign((const char*)last, block.size() - (last - first));
+
+		if(end)
+			break;
+	}
+
+	return ret;
+}
+
+void test_multi_byte(int encoding)
+{
+	int cases = 0, failed = 0, printed = 0;
+	char buf[64];
+	boost::uint8_t seq[4];
+	chars encodable;
+	string encoded;
+
+	// Every character the encoding has decodes back to itself, except for the few that
+	// are encoded as a look-alike (like U+00A2 CENT SIGN as Shift_JIS's FULLWIDTH CENT
+	// SIGN). Those have to be encoded the same way as the look-alike.
+	for(boost::uint32_t ch=0; ch < 0x110000; ++ch)
+	{
+		if(ch >= 0xD800 && ch <= 0xDFFF)
+			continue;
+
+		int n = unicode::unicode_to_multi_byte(encoding, ch, seq);
+
+		if(!n)
+			continue;
+
+		int size;
+		boost::int_fast32_t back = unicode::multi_byte_next(encoding, seq, seq + n, size);
+
+		if(back == (boost::int_fast32_t)ch && size == n)
+		{
+			++cases;
+			encodable.push_back(ch);
+			encoded.append((const char*)seq, n);
+			continue;
+		}
+
+		boost::uint8_t look_alike[4];
+
+		++cases;
+		if(back < 0 || size != n || unicode::unicode_to_multi_byte(encoding, (boost::uint32_t)back, look_alike) != n || memcmp(seq, look_alike, n) != 0)
+		{
+			++failed;
+			sprintf(buf, "U+%04X", (unsigned)ch);
+			fail(printed, multi_byte_names[encoding], string(buf) + " doesn't round trip");
+		}
+	}
+
+	// Every one and two byte sequence that decodes encodes to a sequence that decodes to
+	// the same character. It isn't always the same sequence: some characters have more
+	// than one (like the NEC and IBM extensions in Shift_JIS).
+	for(int lead=0; lead < 256; ++lead)
+	{
+		for(int trail=0x3F; trail < 256; ++trail)
+		{
+			boost::uint8_t in[2] = { (boost::uint8_t)lead, (boost::uint8_t)trail };
+			int size;
+			boost::int_fast32_t ch = unicode::multi_byte_next(encoding, in, in + 2, size);
+
+			if(ch < 0 || (size == 1 && trail != 0x3F))
+				continue;
+
+			int n = unicode::unicode_to_multi_byte(encoding, (boost::uint32_t)ch, seq);
+			int back_size;
+
+			++cases;
+			if(!n || unicode::multi_byte_next(encoding, seq, seq + n, back_size) != ch)
+			{
+				++failed;
+				sprintf(buf, "%02X %02X", lead, trail);
+				fail(printed, multi_byte_names[encoding], string(buf) + " doesn't encode back");
+			}
+		}
+	}
+
+	// The stream decoder and encoder and the block conversions agree.
+	string utf8 = to_utf8(encodable);
+
+	istringstream in(encoded);
+	unicode::basic_multi_byte_decoder<> dec(&in, encoding);
+	ostringstream out;
+	unicode::basic_multi_byte_encoder enc(&out, encoding);
+
+	vector<boost::uint8_t> block(utf8.size() * 2);
+	const boost::uint8_t* first = (const boost::uint8_t*)utf8.data();
+	boost::uint8_t* end = unicode::utf8_to_multi_byte(encoding, first, first + utf8.size(), &block[0]);
+
+	cases += 3;
+	if(decode_all(dec) != encodable || encode_all(enc, out, encodable) != encoded || string(block.begin(), block.begin() + (end - &block[0])) != encoded)
+	{
+		++failed;
+		fail(printed, multi_byte_names[encoding], "the streams and block conversions disagree");
+	}
+
+	// Blocks of odd sizes cut characters in every possible place.
+	const size_t block_sizes[] = { 1, 2, 3, 7, 4093 };
+
+	for(int i=0; i < 5; ++i)
+	{
+		++cases;
+		if(multi_byte_to_utf8_in_blocks(encoding, encoded, block_sizes[i]) != utf8)
+		{
+			++failed;
+			sprintf(buf, "%d byte blocks", (int)block_sizes[i]);
+			fail(printed, multi_byte_names[encoding], buf);
+		}
+	}
+
+	// A sequence cut short by the end is U+FFFD, and a character the encoding doesn't
+	// have is '?'. GB18030 has every character, so it gets U+0E01's four bytes.
+	const char* const cuts[5] = { "a\x82", "a\xA4", "a\xD6", "a\x81\x30\x81", "a\xA4" };
+	istringstream cut_in(cuts[encoding]);
+	unicode::basic_multi_byte_decoder<> cut_dec(&cut_in, encoding);
+	chars cut_expect(1, 'a');
+	cut_expect.push_back(0xFFFD);
+
+	ostringstream missing_out;
+	unicode::basic_multi_byte_encoder missing_enc(&missing_out, encoding);
+
+	cases += 2;
+	if(decode_all(cut_dec) != cut_expect || encode_all(missing_enc, missing_out, chars(1, 0x0E01)) != (encoding == unicode::multi_byte_gb18030 ? "\x81\x32\xCE\x39" : "?"))
+	{
+		++failed;
+		fail(printed, multi_byte_names[encoding], "a cut short sequence or a missing character");
+	}
+
+	report(multi_byte_names[encoding], cases, failed);
+}
+
+void test_multi_byte_mappings()
+{
+	int cases = 0, failed = 0, printed = 0;
+	const int qty = sizeof(multi_byte_mappings) / sizeof(multi_byte_mappings[0]);
+
+	for(int i=0; i < qty; ++i)
+	{
+		const multi_byte_mapping& m = multi_byte_mappings[i];
+		const boost::uint8_t* bytes = (const boost::uint8_t*)m.bytes;
+		int n = (int)strlen(m.bytes);
+		boost::uint8_t seq[4];
+		int size;
+
+		++cases;
+		if(unicode::multi_byte_next(m.encoding, bytes, bytes + n, size) != (boost::int_fast32_t)m.ch || size != n
+			|| unicode::unicode_to_multi_byte(m.encoding, m.ch, seq) != n || memcmp(seq, bytes, n) != 0)
+		{
+			++failed;
+			char buf[64];
+			sprintf(buf, "%s U+%04X", multi_byte_names[m.encoding], (unsigned)m.ch);
+			fail(printed, "multi-byte mapping", buf);
+		}
+	}
+
+	const char* names[] = { "Shift_JIS", "cp932", "EUC-JP", "gb2312", "GB18030", "big5", "utf-8" };
+	const int encodings[] = { unicode::multi_byte_shift_jis, unicode::multi_byte_shift_jis, unicode::multi_byte_euc_jp, unicode::multi_byte_gbk, unicode::multi_byte_gb18030, unicode::multi_byte_big5, -1 };
+
+	for(int i=0; i < 7; ++i)
+	{
+		++cases;
+		failed += unicode::find_multi_byte_encoding(names[i]) != encodings[i];
+	}
+
+	report("multi-byte mappings", cases, failed);
+}
+
+int main()
+{
+	test_single_byte();
+
+	for(int encoding = unicode::multi_byte_shift_jis; encoding <= unicode::multi_byte_big5; ++encoding)
+		test_multi_byte(encoding);
+
+	test_multi_byte_mappings();
+
+	return failures() ? 1 : 0;
+}
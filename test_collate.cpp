@@ -0,0 +1,176 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks collation against the cases below and against CollationTest_NON_IGNORABLE.txt
+// and CollationTest_SHIFTED.txt from the UCA test data, if they're in the directory
+// given as the argument. The test data has to be for the same version of the DUCET as
+// ucd/allkeys.txt.
+//
+//	test_collate [directory]
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include "collate.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef vector<boost::uint32_t> chars;
+
+const char* const strength_names[5] = { "", "primary", "secondary", "tertiary", "quaternary" };
+const char* const weighting_names[2] = { "non-ignorable", "shifted" };
+
+unicode::collation_key sort_key(const chars& s, unicode::collation_strength strength, unicode::variable_weighting weighting)
+{
+	unicode::collation_key ret;
+	const boost::uint32_t* first = s.empty() ? 0 : &s[0];
+	unicode::make_sort_key(first, first + s.size(), ret, strength, weighting);
+	return ret;
+}
+
+// Compare a and b at every level, and then by their NFD code points if their keys are
+// the same (the identical level), which is how the test data is sorted.
+int compare_identical(const chars& a, const chars& b, unicode::variable_weighting weighting)
+{
+	int ret = unicode::compare_sort_keys(sort_key(a, unicode::collation_quaternary, weighting),
+		sort_key(b, unicode::collation_quaternary, weighting));
+
+	if(ret)
+		return ret;
+
+	chars x, y;
+
+	if(!a.empty())
+		unicode::normalize(&a[0], &a[0] + a.size(), unicode::nfd, x);
+
+	if(!b.empty())
+		unicode::normalize(&b[0], &b[0] + b.size(), unicode::nfd, y);
+
+	return x < y ? -1 : y < x ? 1 : 0;
+}
+
+//--------------------------------------------------------------------------------
+// CollationTest_*.txt
+//--------------------------------------------------------------------------------
+
+// Every line has to sort after the one before it, or be identical to it.
+void run_file(const string& dir, const char* name, unicode::variable_weighting weighting)
+{
+	ifstream in;
+
+	if(!open_data(in, dir, name))
+		return;
+
+	int cases = 0, failed = 0, printed = 0;
+	chars prev;
+	bool first = true;
+
+	for(string line; getline(in, line); )
+	{
+		string::size_type end = line.find(';');
+		line = strip_comment(line.substr(0, end));
+
+		if(line.empty())
+			continue;
+
+		chars s = parse_hex(line);
+
+		if(!first)
+		{
+			++cases;
+
+			if(compare_identical(prev, s, weighting) > 0)
+			{
+				++failed;
+				fail(printed, name, to_hex(prev) + " sorts after " + to_hex(s));
+			}
+		}
+
+		prev.swap(s);
+		first = false;
+	}
+
+	report(name, cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// Built-in cases
+//--------------------------------------------------------------------------------
+
+struct collation_case
+{
+	const char* a;
+	const char* b;
+	unicode::collation_strength strength;
+	unicode::variable_weighting weighting;
+	int expect; // -1 if a sorts first, 0 if they're equal, 1 if b sorts first.
+};
+
+const collation_case cases[] = {
+	{ "0061", "0041", unicode::collation_tertiary, unicode::variable_non_ignorable, -1 },	// a < A
+	{ "0061", "0041", unicode::collation_secondary, unicode::variable_non_ignorable, 0 },
+	{ "0041", "00E1", unicode::collation_secondary, unicode::variable_non_ignorable, -1 },	// A < á
+	{ "0041", "00E1", unicode::collation_primary, unicode::variable_non_ignorable, 0 },
+	{ "00E9", "0065 0301", unicode::collation_tertiary, unicode::variable_non_ignorable, 0 },	// Canonically equivalent
+	{ "0061 002D 0062", "0061 0062", unicode::collation_quaternary, unicode::variable_shifted, -1 },	// a-b < ab < abc
+	{ "0061 0062", "0061 0062 0063", unicode::collation_quaternary, unicode::variable_shifted, -1 },
+	{ "0061 002D 0062", "0061 0062 0063", unicode::collation_quaternary, unicode::variable_shifted, -1 },
+	{ "0061 0062", "0061 002D 0062", unicode::collation_tertiary, unicode::variable_shifted, 0 },
+	{ "0061 002D 0062", "0061 0062", unicode::collation_tertiary, unicode::variable_non_ignorable, -1 },
+	{ "004C 00B7 0061", "004C 0061", unicode::collation_primary, unicode::variable_non_ignorable, 0 },	// Contraction
+	{ "0418 0306", "0419", unicode::collation_tertiary, unicode::variable_non_ignorable, 0 },
+	{ "0E40 0E01", "0E01 0E40", unicode::collation_tertiary, unicode::variable_non_ignorable, 0 },	// Thai reordering
+	{ "0418 0316 0306", "0419 0316", unicode::collation_tertiary, unicode::variable_non_ignorable, 0 },	// Discontiguous
+	{ "AC00", "1100 1161", unicode::collation_tertiary, unicode::variable_non_ignorable, 0 },	// Hangul
+	{ "4E00", "4E01", unicode::collation_primary, unicode::variable_non_ignorable, -1 },	// Implicit weights
+	{ "9FA5", "3400", unicode::collation_primary, unicode::variable_non_ignorable, -1 },	// Core Han first
+	{ "20000", "E000", unicode::collation_primary, unicode::variable_non_ignorable, -1 },	// Then other Han, then unassigned
+	{ "18AFF", "18D00", unicode::collation_primary, unicode::variable_non_ignorable, -1 },	// Tangut, then its supplement
+	{ "", "0000", unicode::collation_quaternary, unicode::variable_shifted, 0 },	// Completely ignorable
+};
+
+int main(int argc, char** argv)
+{
+	int printed = 0, failed = 0;
+	const int qty = sizeof(cases) / sizeof(cases[0]);
+
+	for(int i=0; i < qty; ++i)
+	{
+		const collation_case& c = cases[i];
+		chars a = parse_hex(c.a), b = parse_hex(c.b);
+		int got = unicode::compare_sort_keys(sort_key(a, c.strength, c.weighting), sort_key(b, c.strength, c.weighting));
+
+		if(got != c.expect)
+		{
+			++failed;
+			fail(printed, "collation", to_hex(a) + " vs " + to_hex(b) + " (" + strength_names[c.strength] + ", "
+				+ weighting_names[c.weighting] + "): got " + (got < 0 ? "<" : got > 0 ? ">" : "="));
+		}
+	}
+
+	// The same through compare_collated(), which takes UTF-8 views.
+	for(int i=0; i < qty; ++i)
+	{
+		const collation_case& c = cases[i];
+		string a = to_utf8(parse_hex(c.a)), b = to_utf8(parse_hex(c.b));
+		int got = unicode::compare_collated(a, b, c.strength, c.weighting);
+
+		if(got != c.expect)
+		{
+			++failed;
+			fail(printed, "compare_collated", to_hex(parse_hex(c.a)) + " vs " + to_hex(parse_hex(c.b)));
+		}
+	}
+
+	report("collation", qty * 2, failed);
+
+	string dir = data_dir(argc, argv);
+	run_file(dir, "CollationTest_NON_IGNORABLE.txt", unicode::variable_non_ignorable);
+	run_file(dir, "CollationTest_SHIFTED.txt", unicode::variable_shifted);
+
+	return failures() ? 1 : 0;
+}
@@ -0,0 +1,227 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the conversions between UTF-8, UTF-16 and UTF-32 in utf_convert.hpp with
+// every CPU tier up to the one dispatched to by default, on runs of ASCII of every
+// length either side of the kernels' blocks, starting at different alignments.
+// tools/check.sh also runs this with BOOST_UNICODE_CPU set to sse2 and scalar, which
+// has to give the same results.
+//
+//	test_convert
+
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "utf_convert.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef vector<boost::uint32_t> chars;
+typedef vector<boost::uint16_t> units16;
+
+// Code points as UTF-16.
+units16 to_utf16(const chars& s)
+{
+	units16 ret;
+
+	for(size_t i=0; i < s.size(); ++i)
+	{
+		if(s[i] < 0x10000)
+			ret.push_back((boost::uint16_t)s[i]);
+		else
+		{
+			ret.push_back((boost::uint16_t)(((s[i] - 0x10000) >> 10) + 0xD800));
+			ret.push_back((boost::uint16_t)(((s[i] - 0x10000) & 0x3FF) + 0xDC00));
+		}
+	}
+
+	return ret;
+}
+
+// Runs of ASCII of every length up to 140 (past two AVX-512 blocks), each followed by a
+// character of 2, 3 or 4 bytes, and random text of both.
+vector<chars> sample_texts()
+{
+	const boost::uint32_t others[] = { 0xE9, 0x65E5, 0x1F600, 0x7F, 0x80, 0x7FF, 0x800, 0xFFFF, 0x10000, 0x10FFFF };
+	const size_t other_qty = sizeof(others) / sizeof(others[0]);
+	vector<chars> ret(1);
+
+	for(size_t run=1; run <= 140; ++run)
+	{
+		chars s;
+
+		for(size_t i=0; i < run; ++i)
+			s.push_back('a' + i % 26);
+
+		ret.push_back(s);
+		s.push_back(others[run % other_qty]);
+		ret.push_back(s);
+		s.insert(s.end(), s.begin(), s.end());
+		ret.push_back(s);
+	}
+
+	std::srand(1);
+
+	for(int i=0; i < 100; ++i)
+	{
+		chars s;
+
+		while(s.size() < 500)
+		{
+			if(std::rand() % 3)
+				s.insert(s.end(), std::rand() % 100, 'x');
+			else
+				s.push_back(others[std::rand() % other_qty]);
+		}
+
+		ret.push_back(s);
+	}
+
+	return ret;
+}
+
+// Convert each text every way, starting at each of 4 alignments, and compare with
+// what it should be.
+void test_tier(int tier, const vector<chars>& texts)
+{
+	int cases = 0, failed = 0, printed = 0;
+	string name = string("utf_convert, ") + unicode::cpu_tier_name(tier);
+	unicode::set_cpu_tier(tier);
+
+	for(size_t i=0; i < texts.size(); ++i)
+	{
+		const chars& s = texts[i];
+		string utf8 = to_utf8(s);
+		units16 utf16 = to_utf16(s);
+
+		for(size_t align=0; align < 4; ++align)
+		{
+			// Copies of the input, starting align units in, with a unit after them so
+			// empty text has somewhere to point.
+			vector<boost::uint8_t> in8(align);
+			in8.insert(in8.end(), utf8.begin(), utf8.end());
+			units16 in16(align);
+			in16.insert(in16.end(), utf16.begin(), utf16.end());
+			chars in32(align);
+			in32.insert(in32.end(), s.begin(), s.end());
+			in8.push_back(0);
+			in16.push_back(0);
+			in32.push_back(0);
+			const boost::uint8_t* first8 = &in8[0] + align;
+			const boost::uint16_t* first16 = &in16[0] + align;
+			const boost::uint32_t* first32 = &in32[0] + align;
+
+			units16 out16(utf8.size() + 1);
+			chars out32(utf8.size() + 1);
+			vector<boost::uint8_t> out8(s.size() * 4 + 1);
+			string wrong;
+
+			boost::uint16_t* end16 = unicode::utf8_to_utf16(first8, first8 + utf8.size(), &out16[0]);
+
+			if(units16(&out16[0], end16) != utf16)
+				wrong = "utf8_to_utf16";
+
+			boost::uint32_t* end32 = unicode::utf8_to_utf32(first8, first8 + utf8.size(), &out32[0]);
+
+			if(chars(&out32[0], end32) != s)
+				wrong = "utf8_to_utf32";
+
+			boost::uint8_t* end8 = unicode::utf16_to_utf8(first16, first16 + utf16.size(), &out8[0]);
+
+			if(string(out8.begin(), out8.begin() + (end8 - &out8[0])) != utf8)
+				wrong = "utf16_to_utf8";
+
+			end8 = unicode::utf32_to_utf8(first32, first32 + s.size(), &out8[0]);
+
+			if(string(out8.begin(), out8.begin() + (end8 - &out8[0])) != utf8)
+				wrong = "utf32_to_utf8";
+
+			++cases;
+
+			if(!wrong.empty())
+			{
+				++failed;
+				ostringstream what;
+				what << wrong << " of text " << i << " (" << s.size() << " characters) at alignment " << align;
+				fail(printed, name.c_str(), what.str());
+			}
+		}
+	}
+
+	report(name.c_str(), cases, failed);
+}
+
+// Unpaired surrogates in UTF-16, and surrogates and values past U+10FFFF in UTF-32,
+// become U+FFFD, after runs of ASCII so the kernels stop right before them.
+void test_invalid(int tier)
+{
+	int cases = 0, failed = 0, printed = 0;
+	string name = string("utf_convert invalid, ") + unicode::cpu_tier_name(tier);
+	unicode::set_cpu_tier(tier);
+
+	for(size_t run=0; run <= 70; ++run)
+	{
+		string ascii(run, 'q');
+		string expect = ascii + "\xEF\xBF\xBD" + ascii + "\xEF\xBF\xBD" + ascii + "\xEF\xBF\xBD";
+
+		units16 in16(ascii.begin(), ascii.end());
+		in16.push_back(0xDC00);
+		in16.insert(in16.end(), ascii.begin(), ascii.end());
+		in16.push_back(0xD800);
+		in16.insert(in16.end(), ascii.begin(), ascii.end());
+		in16.push_back(0xDBFF);
+
+		chars in32(ascii.begin(), ascii.end());
+		in32.push_back(0xD800);
+		in32.insert(in32.end(), ascii.begin(), ascii.end());
+		in32.push_back(0x110000);
+		in32.insert(in32.end(), ascii.begin(), ascii.end());
+		in32.push_back(0xFFFFFFFF);
+
+		vector<boost::uint8_t> out(in32.size() * 4);
+		boost::uint8_t* end = unicode::utf16_to_utf8(&in16[0], &in16[0] + in16.size(), &out[0]);
+		bool ok = string(out.begin(), out.begin() + (end - &out[0])) == expect;
+
+		end = unicode::utf32_to_utf8(&in32[0], &in32[0] + in32.size(), &out[0]);
+		ok = ok && string(out.begin(), out.begin() + (end - &out[0])) == expect;
+
+		++cases;
+
+		if(!ok)
+		{
+			++failed;
+			ostringstream what;
+			what << "after " << run << " ASCII characters";
+			fail(printed, name.c_str(), what.str());
+		}
+	}
+
+	report(name.c_str(), cases, failed);
+}
+
+int main()
+{
+	const char* env = std::getenv("BOOST_UNICODE_CPU");
+	int tier = unicode::available_cpu_tier();
+	std::printf("%-30s %s%s%s\n", "CPU tier", unicode::cpu_tier_name(tier), env ? ", BOOST_UNICODE_CPU=" : "", env ? env : "");
+
+	// BOOST_UNICODE_CPU caps the tier, and the default dispatch uses it.
+	check(!env || unicode::find_cpu_tier(env) < 0 || tier <= unicode::find_cpu_tier(env), "BOOST_UNICODE_CPU");
+	check(unicode::cpu_tier() == tier && unicode::set_cpu_tier(unicode::cpu_tier_avx512) == tier, "cpu_tier()");
+
+	vector<chars> texts = sample_texts();
+
+	for(int t = unicode::cpu_tier_scalar; t <= tier; ++t)
+	{
+		test_tier(t, texts);
+		test_invalid(t);
+	}
+
+	return failures() ? 1 : 0;
+}
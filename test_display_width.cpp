@@ -0,0 +1,245 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks display_width() and truncate_to_width() on user-perceived characters of
+// known widths, on their own and strung together with runs of ASCII long enough to be
+// counted 16 bytes at a time.
+//
+//	test_display_width
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "ustream.hpp"
+#include "ustring.h"
+#include "display_width.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef unicode::basic_ustring<unicode::utf8_encoder, unicode::utf8_decoder> test_string;
+typedef vector<boost::uint32_t> chars;
+
+//--------------------------------------------------------------------------------
+// Known characters
+//--------------------------------------------------------------------------------
+
+struct width_case
+{
+	const char* text; // One user-perceived character.
+	unsigned width;
+	unsigned cjk_width; // With ambiguous characters wide.
+	bool alone; // Joins onto what comes before it, so can only be checked on its own.
+};
+
+const width_case width_cases[] = {
+	{ "a", 1, 1, false },
+	{ " ", 1, 1, false },
+	{ "e\xCC\x81", 1, 1, false }, // e and a combining acute accent.
+	{ "a\xCC\x81\xCC\xA7\xCD\x85", 1, 1, false }, // Several marks.
+	{ "\xCC\x81", 0, 0, true }, // A mark with nothing to go on.
+	{ "\xC3\xA9", 1, 2, false }, // Ambiguous: e with an acute accent.
+	{ "\xE6\x97\xA5", 2, 2, false }, // U+65E5
+	{ "\xE6\x97\xA5\xCC\x81", 2, 2, false }, // A wide character with a mark.
+	{ "\xF0\xA0\x80\x80", 2, 2, false }, // U+20000
+	{ "\xE3\x80\x80", 2, 2, false }, // Ideographic space.
+	{ "\xEF\xBC\xA1", 2, 2, false }, // Fullwidth A.
+	{ "\xEF\xBD\xB1", 1, 1, false }, // Halfwidth katakana.
+	{ "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8", 2, 2, false }, // A Hangul syllable made of jamo.
+	{ "\xCE\xB1", 1, 2, false }, // Ambiguous: Greek alpha.
+	{ "\xE2\x94\x80", 1, 2, false }, // Ambiguous: box drawing.
+	{ "\xF0\x9F\x98\x80", 2, 2, false }, // U+1F600
+	{ "\xE2\x98\xBA\xEF\xB8\x8F", 2, 2, false }, // U+263A made an emoji by VS16.
+	{ "\xE2\x9D\xA4\xEF\xB8\x8F", 2, 2, false }, // U+2764 and VS16.
+	{ "\xE2\x98\xBA", 1, 1, false }, // Without it.
+	{ "#\xEF\xB8\x8F", 2, 2, false }, // ASCII made an emoji by VS16.
+	{ "\xF0\x9F\x91\x8D\xF0\x9F\x8F\xBD", 2, 2, false }, // With a skin tone.
+	{ "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7", 2, 2, false }, // A family joined by ZWJs.
+	{ "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7", 2, 2, false }, // The French flag.
+	{ "\t", 0, 0, false },
+	{ "\x01", 0, 0, false },
+	{ "\x7F", 0, 0, false },
+	{ "\r\n", 0, 0, false },
+	{ "\n", 0, 0, false },
+	{ "\xC2\x85", 0, 0, false }, // NEL, a C1 control.
+	{ "\xE2\x80\x8B", 0, 0, false }, // Zero width space.
+	{ "\xE2\x80\xA8", 0, 0, false }, // Line separator.
+};
+
+const size_t width_case_qty = sizeof(width_cases) / sizeof(width_cases[0]);
+
+// Check text made of clusters, and truncating it to every number of columns up to
+// one more than it takes.
+bool check_clusters(const vector<const width_case*>& clusters, bool cjk, string& wrong)
+{
+	string text;
+	vector<size_t> ends; // Byte offset of the end of each cluster.
+	size_t width = 0;
+
+	for(size_t i=0; i < clusters.size(); ++i)
+	{
+		text += clusters[i]->text;
+		ends.push_back(text.size());
+		width += cjk ? clusters[i]->cjk_width : clusters[i]->width;
+	}
+
+	unicode::ustring_view v(text);
+	chars cps;
+
+	for(unicode::ustring_view::iterator i=v.begin(); i != v.end(); ++i)
+		cps.push_back(*i);
+
+	if(unicode::display_width(v, cjk) != width)
+		wrong = "display_width() of a view";
+	else if(unicode::display_width(cps.begin(), cps.end(), cjk) != width)
+		wrong = "display_width() of code points";
+	else
+	{
+		for(size_t columns=0; columns <= width + 1; ++columns)
+		{
+			// Whole clusters while they fit, including ones that take no columns.
+			size_t fits = 0, fits_width = 0;
+
+			for(; fits < clusters.size(); ++fits)
+			{
+				unsigned w = cjk ? clusters[fits]->cjk_width : clusters[fits]->width;
+
+				if(fits_width + w > columns)
+					break;
+
+				fits_width += w;
+			}
+
+			size_t bytes = fits ? ends[fits - 1] : 0;
+			size_t got_width;
+			const boost::uint8_t* first = (const boost::uint8_t*)text.data();
+
+			if(unicode::truncate_to_width_utf8(first, first + text.size(), columns, got_width, cjk) - first != (ptrdiff_t)bytes || got_width != fits_width
+				|| unicode::truncate_to_width(v, columns, cjk).bytes() != bytes)
+			{
+				wrong = "truncate_to_width()";
+				break;
+			}
+		}
+	}
+
+	return wrong.empty();
+}
+
+// Each character on its own, and after and before ASCII.
+void test_cases()
+{
+	int cases = 0, failed = 0, printed = 0;
+	const width_case ascii = { "x", 1, 1, false };
+
+	for(size_t i=0; i < width_case_qty; ++i)
+	{
+		for(int cjk=0; cjk < 2; ++cjk)
+		{
+			vector<const width_case*> clusters(1, &width_cases[i]);
+			string wrong;
+
+			if(!width_cases[i].alone)
+			{
+				if(check_clusters(clusters, cjk != 0, wrong))
+				{
+					clusters.insert(clusters.begin(), &ascii);
+					clusters.push_back(&ascii);
+				}
+			}
+
+			++cases;
+
+			if(!check_clusters(clusters, cjk != 0, wrong))
+			{
+				++failed;
+				fail(printed, "display width", string("\"") + width_cases[i].text + "\"" + (cjk ? " (CJK)" : "") + ": " + wrong);
+			}
+		}
+	}
+
+	report("display width", cases, failed);
+}
+
+// The characters after runs of ASCII of every length up to 40, so they fall at every
+// place in and around the 16 byte blocks, and strung together at random.
+void test_blocks()
+{
+	int cases = 0, failed = 0, printed = 0;
+	const width_case ascii = { "x", 1, 1, false };
+
+	for(size_t i=0; i < width_case_qty; ++i)
+	{
+		if(width_cases[i].alone)
+			continue;
+
+		for(size_t run=0; run <= 40; ++run)
+		{
+			vector<const width_case*> clusters(run, &ascii);
+			clusters.push_back(&width_cases[i]);
+			clusters.insert(clusters.end(), 20, &ascii);
+			string wrong;
+
+			++cases;
+
+			if(!check_clusters(clusters, false, wrong))
+			{
+				++failed;
+				fail(printed, "display width", string("\"") + width_cases[i].text + "\" after ASCII: " + wrong);
+			}
+		}
+	}
+
+	std::srand(1);
+
+	for(int i=0; i < 200; ++i)
+	{
+		vector<const width_case*> clusters;
+
+		while(clusters.size() < 100)
+		{
+			const width_case* c = &width_cases[std::rand() % width_case_qty];
+
+			if(std::rand() % 4 == 0)
+				clusters.insert(clusters.end(), std::rand() % 40, &ascii);
+			else if(!c->alone)
+				clusters.push_back(c);
+		}
+
+		string wrong;
+		++cases;
+
+		if(!check_clusters(clusters, i % 2 != 0, wrong))
+		{
+			++failed;
+			fail(printed, "display width", "random text: " + wrong);
+		}
+	}
+
+	report("display width (blocks)", cases, failed);
+}
+
+// truncate_to_width() of a string gives a string.
+void test_string_copy()
+{
+	test_string s;
+	const boost::uint32_t text[] = { 0x61, 0x65E5, 0x301, 0x62, 0x1F600, 0x63 };
+
+	for(size_t i=0; i < sizeof(text) / sizeof(text[0]); ++i)
+		s.append((unicode::utf32_unit)text[i]);
+
+	test_string cut = unicode::truncate_to_width(s, 4);
+	check(cut.size() == 4 && unicode::display_width(cut) == 4 && unicode::display_width(s) == 7, "truncate_to_width() of a string");
+}
+
+int main()
+{
+	test_cases();
+	test_blocks();
+	test_string_copy();
+
+	return failures() ? 1 : 0;
+}
@@ -0,0 +1,119 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that ustring_literal encodes and counts text at compile time (most of the
+// checks are static_asserts, so this failing to compile is a failure too), and that
+// the views made of literals hold what they should. Needs C++14, which tools/check.sh
+// builds it with.
+//
+//	test_literal
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "ustring_literal.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+#ifdef BOOST_UNICODE_HAS_USTRING_LITERALS
+
+typedef vector<boost::uint32_t> chars;
+
+// Characters of every UTF-8 length: 1 + 2 + 3 + 4 + 1 bytes.
+BOOST_UNICODE_LITERAL(mixed, U"a\u00E9\u65E5\U0001F600z");
+static_assert(mixed.size() == 5, "characters in a mixed-width literal");
+static_assert(mixed.bytes() == 11, "bytes in a mixed-width literal");
+static_assert(!mixed.is_ascii() && !mixed.empty(), "a mixed-width literal");
+static_assert(mixed.data()[0] == 'a' && mixed.data()[1] == 0xC3 && mixed.data()[2] == 0xA9, "U+00E9 in UTF-8");
+static_assert(mixed.data()[3] == 0xE6 && mixed.data()[4] == 0x97 && mixed.data()[5] == 0xA5, "U+65E5 in UTF-8");
+static_assert(mixed.data()[6] == 0xF0 && mixed.data()[7] == 0x9F && mixed.data()[8] == 0x98 && mixed.data()[9] == 0x80, "U+1F600 in UTF-8");
+static_assert(mixed.data()[10] == 'z' && mixed.data()[11] == 0, "the null after a literal");
+
+BOOST_UNICODE_LITERAL(ascii, "plain ASCII");
+static_assert(ascii.size() == 11 && ascii.bytes() == 11 && ascii.is_ascii(), "an ASCII literal");
+
+BOOST_UNICODE_LITERAL(nothing, "");
+static_assert(nothing.size() == 0 && nothing.bytes() == 0 && nothing.empty() && nothing.is_ascii() && nothing.data()[0] == 0, "an empty literal");
+
+// The edges of each length.
+BOOST_UNICODE_LITERAL(edges, U"\u007F\u0080\u07FF\u0800\uFFFF\U00010000\U0010FFFF");
+static_assert(edges.size() == 7 && edges.bytes() == 1 + 2 + 2 + 3 + 3 + 4 + 4, "the edges of each UTF-8 length");
+
+// It ends at the first null.
+BOOST_UNICODE_LITERAL(early, U"ab\0cd");
+static_assert(early.size() == 2 && early.bytes() == 2, "a literal with a null in it");
+
+// Surrogates and values past U+10FFFF can't be written in a literal, but can reach the
+// constructor, and become U+FFFD.
+constexpr char32_t invalid_text[] = { 0xD800, 'x', 0xDFFF, 0x110000, 0 };
+constexpr unicode::ustring_literal<unicode::utf8_literal_bytes(invalid_text)> invalid(invalid_text);
+static_assert(invalid.size() == 4 && invalid.bytes() == 3 + 1 + 3 + 3, "surrogates and values past U+10FFFF");
+static_assert(invalid.data()[0] == 0xEF && invalid.data()[1] == 0xBF && invalid.data()[2] == 0xBD && invalid.data()[3] == 'x', "U+FFFD in UTF-8");
+
+// The views, and literals declared at function scope.
+void test_views()
+{
+	BOOST_UNICODE_LITERAL(local, "Gr\u00FC\u00DF dich"); // A narrow literal.
+	static_assert(local.size() == 9 && local.bytes() == 11, "a literal at function scope");
+
+	const boost::uint32_t mixed_chars[] = { 0x61, 0xE9, 0x65E5, 0x1F600, 0x7A };
+	const boost::uint32_t edge_chars[] = { 0x7F, 0x80, 0x7FF, 0x800, 0xFFFF, 0x10000, 0x10FFFF };
+	const boost::uint32_t invalid_chars[] = { 0xFFFD, 0x78, 0xFFFD, 0xFFFD };
+
+	struct literal_case
+	{
+		unicode::ustring_view view;
+		chars expect;
+		const char* name;
+	};
+
+	const literal_case cases[] = {
+		{ mixed, chars(mixed_chars, mixed_chars + 5), "mixed" },
+		{ edges, chars(edge_chars, edge_chars + 7), "edges" },
+		{ invalid, chars(invalid_chars, invalid_chars + 4), "invalid" },
+		{ ascii, chars(ascii.c_str(), ascii.c_str() + 11), "ascii" },
+		{ nothing, chars(), "nothing" },
+	};
+
+	const int qty = sizeof(cases) / sizeof(cases[0]);
+	int failed = 0, printed = 0;
+
+	for(int i=0; i < qty; ++i)
+	{
+		const unicode::ustring_view& v = cases[i].view;
+		chars got;
+
+		for(unicode::ustring_view::iterator j=v.begin(); j != v.end(); ++j)
+			got.push_back(*j);
+
+		if(got != cases[i].expect || v.size() != (int)got.size() || string((const char*)v.data(), v.bytes()) != to_utf8(cases[i].expect))
+		{
+			++failed;
+			fail(printed, "ustring_literal", cases[i].name);
+		}
+	}
+
+	report("ustring_literal", qty, failed);
+	check(unicode::ustring_view(local) == unicode::ustring_view("Gr\xC3\xBC\xC3\x9F dich"), "ustring_literal at function scope");
+}
+
+int main()
+{
+	test_views();
+
+	return failures() ? 1 : 0;
+}
+
+#else
+
+int main()
+{
+	std::printf("%-30s skipped (needs C++14)\n", "ustring_literal");
+	return 0;
+}
+
+#endif
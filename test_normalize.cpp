@@ -0,0 +1,386 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks normalization, in memory and through normalizing_decoder, against the cases
+// below and against NormalizationTest.txt from the UCD, if it's in the directory given
+// as the argument.
+//
+//	test_normalize [directory]
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "normalize.hpp"
+#include "ustream.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef vector<boost::uint32_t> chars;
+
+const char* const form_names[4] = { "NFC", "NFD", "NFKC", "NFKD" };
+
+chars normalized(const chars& s, unicode::normalization_form form)
+{
+	chars ret;
+
+	if(!s.empty())
+		unicode::normalize(&s[0], &s[0] + s.size(), form, ret);
+
+	return ret;
+}
+
+template<unicode::normalization_form form>
+chars stream_normalized_as(const chars& s)
+{
+	istringstream in(to_utf8(s));
+	unicode::normalizing_decoder<unicode::utf8_decoder, form> dec(&in);
+	chars ret;
+
+	for(boost::int_fast32_t ch; (ch = dec.decode()) != EOF; )
+		ret.push_back((boost::uint32_t)ch);
+
+	return ret;
+}
+
+// Normalize s by reading it through a normalizing_decoder.
+chars stream_normalized(const chars& s, unicode::normalization_form form)
+{
+	switch(form)
+	{
+	case unicode::nfc: return stream_normalized_as<unicode::nfc>(s);
+	case unicode::nfd: return stream_normalized_as<unicode::nfd>(s);
+	case unicode::nfkc: return stream_normalized_as<unicode::nfkc>(s);
+	default: return stream_normalized_as<unicode::nfkd>(s);
+	}
+}
+
+// Check that s normalizes to expect both ways, and that the quick check doesn't
+// say yes when it isn't normalized. Returns false if anything's wrong.
+bool check_form(const chars& s, unicode::normalization_form form, const chars& expect, int& printed)
+{
+	chars got = normalized(s, form);
+	chars streamed = stream_normalized(s, form);
+	string what = string(form_names[form]) + " of " + to_hex(s) + ": expected " + to_hex(expect);
+
+	if(got != expect)
+	{
+		fail(printed, "normalize", what + " got " + to_hex(got));
+		return false;
+	}
+
+	if(streamed != expect)
+	{
+		fail(printed, "normalizing_decoder", what + " got " + to_hex(streamed));
+		return false;
+	}
+
+	if(s != expect && !s.empty() && unicode::quick_check(&s[0], &s[0] + s.size(), form) == unicode::quick_check_yes)
+	{
+		fail(printed, "quick_check", what + " but the quick check said yes");
+		return false;
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------
+// NormalizationTest.txt
+//--------------------------------------------------------------------------------
+
+// Check a line of columns c1 to c5 as the file's header says:
+// NFC: c2 == toNFC(c1) == toNFC(c2) == toNFC(c3), c4 == toNFC(c4) == toNFC(c5)
+// NFD: c3 == toNFD(c1) == toNFD(c2) == toNFD(c3), c5 == toNFD(c4) == toNFD(c5)
+// NFKC: c4 == toNFKC(c1..c5), NFKD: c5 == toNFKD(c1..c5)
+bool check_line(const vector<chars>& c, int& printed)
+{
+	bool ok = true;
+
+	for(int i=0; i < 5; ++i)
+	{
+		ok = ok && check_form(c[i], unicode::nfc, i < 3 ? c[1] : c[3], printed);
+		ok = ok && check_form(c[i], unicode::nfd, i < 3 ? c[2] : c[4], printed);
+		ok = ok && check_form(c[i], unicode::nfkc, c[3], printed);
+		ok = ok && check_form(c[i], unicode::nfkd, c[4], printed);
+	}
+
+	return ok;
+}
+
+void run_file(const string& dir)
+{
+	const char* name = "NormalizationTest.txt";
+	ifstream in;
+
+	if(!open_data(in, dir, name))
+		return;
+
+	int cases = 0, failed = 0, printed = 0;
+	bool part1 = false;
+	vector<bool> listed(0x110000, false); // Characters in part 1.
+
+	for(string line; getline(in, line); )
+	{
+		line = strip_comment(line);
+
+		if(line.empty())
+			continue;
+
+		if(line[0] == '@')
+		{
+			part1 = line.compare(0, 6, "@Part1") == 0;
+			continue;
+		}
+
+		vector<chars> c;
+		string::size_type pos = 0;
+
+		for(int i=0; i < 5; ++i)
+		{
+			string::size_type end = line.find(';', pos);
+			c.push_back(parse_hex(line.substr(pos, end - pos)));
+			pos = end + 1;
+		}
+
+		if(part1 && c[0].size() == 1)
+			listed[c[0][0]] = true;
+
+		++cases;
+		failed += !check_line(c, printed);
+	}
+
+	// Every character that isn't in part 1 is left alone by all the forms.
+	for(boost::uint32_t cp=0; cp < 0x110000; ++cp)
+	{
+		if(listed[cp] || (cp >= 0xD800 && cp <= 0xDFFF))
+			continue;
+
+		chars s(1, cp);
+		bool ok = true;
+
+		for(int form=0; ok && form < 4; ++form)
+			ok = check_form(s, (unicode::normalization_form)form, s, printed);
+
+		++cases;
+		failed += !ok;
+	}
+
+	report(name, cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// Built-in cases
+//--------------------------------------------------------------------------------
+
+struct normalization_case
+{
+	const char* source;
+	unicode::normalization_form form;
+	const char* expect;
+};
+
+const normalization_case cases[] = {
+	{ "00E9", unicode::nfd, "0065 0301" },
+	{ "0065 0301", unicode::nfc, "00E9" },
+	{ "00C5", unicode::nfd, "0041 030A" },
+	{ "212B", unicode::nfc, "00C5" },				// Singleton decomposition
+	{ "0071 0307 0323", unicode::nfc, "0071 0323 0307" },		// Canonical ordering
+	{ "1E0B 0323", unicode::nfc, "1E0D 0307" },			// Composing past a reordered mark
+	{ "FB01", unicode::nfc, "FB01" },
+	{ "FB01", unicode::nfkc, "0066 0069" },
+	{ "AC00", unicode::nfd, "1100 1161" },
+	{ "1100 1161 11A8", unicode::nfc, "AC01" },			// Hangul
+	{ "0F73", unicode::nfd, "0F71 0F72" },				// A starter that decomposes to non-starters
+	{ "0F74 0F73", unicode::nfd, "0F71 0F72 0F74" },
+};
+
+// A long segment has to be cut where normalizing can start over, not just anywhere:
+// 31 "é" then U+0301 U+0336 puts the last two marks past max_normalization_segment.
+// Returns the number of failures.
+int check_long_segment(int& printed)
+{
+	chars s(31, 0xE9);
+	s.push_back(0x0301);
+	s.push_back(0x0336);
+
+	chars expect;
+
+	for(int i=0; i < 30; ++i)
+	{
+		expect.push_back(0x65);
+		expect.push_back(0x0301);
+	}
+
+	expect.push_back(0x65);
+	expect.push_back(0x0336);
+	expect.push_back(0x0301);
+	expect.push_back(0x0301);
+
+	int failed = !check_form(s, unicode::nfd, expect, printed);
+
+	// The same with starters that aren't boundaries for NFC either, and a mark that composes.
+	chars t;
+
+	for(int i=0; i < 40; ++i)
+		t.push_back(i % 2 ? 0x0301 : 0x0041);
+
+	t.back() = 0x0041;
+	t.push_back(0x0323);
+	t.push_back(0x0302);
+
+	chars nfc = normalized(t, unicode::nfc);
+	failed += !check_form(t, unicode::nfc, nfc, printed);
+
+	if(nfc.back() != 0x1EAC)
+	{
+		++failed;
+		fail(printed, "normalize", "NFC across the segment limit: expected A U+0323 U+0302 to compose to U+1EAC");
+	}
+
+	return failed;
+}
+
+// Runs of more than max_nonstarters non-starters are put in the Stream-Safe Text
+// Format by the decoder (but not by normalize()). Returns the number of failures.
+int check_stream_safe(int& printed)
+{
+	int failed = 0;
+
+	chars s(1, 0x61);
+	s.insert(s.end(), 40, 0x0301);
+
+	chars expect(1, 0x61);
+	expect.insert(expect.end(), 30, 0x0301);
+	expect.push_back(unicode::combining_grapheme_joiner);
+	expect.insert(expect.end(), 10, 0x0301);
+
+	chars got = stream_normalized(s, unicode::nfd);
+
+	if(got != expect)
+	{
+		++failed;
+		fail(printed, "Stream-Safe", "NFD of a + 40 U+0301: got " + to_hex(got));
+	}
+
+	expect.erase(expect.begin(), expect.begin() + 2);
+	expect.insert(expect.begin(), 0xE1);
+	got = stream_normalized(s, unicode::nfc);
+
+	if(got != expect)
+	{
+		++failed;
+		fail(printed, "Stream-Safe", "NFC of a + 40 U+0301: got " + to_hex(got));
+	}
+
+	return failed;
+}
+
+// peek() and unget() go back over the last character read, and tellg() counts the
+// characters read. "e" U+0301 is normalized as a segment, the rest are passed straight
+// through. Returns the number of failures.
+template<class stream_type>
+int check_peek(const char* name, const char* expect_hex, int& printed)
+{
+	istringstream in("ab" "e\xCC\x81" "c");
+	stream_type us(&in);
+	chars expect = parse_hex(expect_hex);
+	bool ok = true;
+
+	for(size_t i=0; ok && i < expect.size(); ++i)
+	{
+		ok = us.peek() == (boost::int_fast32_t)expect[i] && us.tellg() == i;
+		ok = ok && us.get() == (boost::int_fast32_t)expect[i] && us.tellg() == i + 1;
+
+		if(ok && i % 2)
+		{
+			us.unget();
+			ok = us.tellg() == i && us.get() == (boost::int_fast32_t)expect[i];
+		}
+	}
+
+	ok = ok && us.peek() == EOF && us.tellg() == expect.size();
+
+	// Seeking from the current position doesn't work, and mustn't move tellg().
+	istringstream in2("abc");
+	stream_type us2(&in2);
+	us2.get();
+	us2.seekg(1, std::ios_base::cur);
+	ok = ok && us2.tellg() == 1 && us2.get() == 0x62;
+
+	if(!ok)
+		fail(printed, name, "peek(), unget() or tellg()");
+
+	return !ok;
+}
+
+// is_normalized(), compare_canonical() and normalize() on UTF-8 strings. Returns the
+// number of failures.
+int check_strings(int& printed)
+{
+	typedef unicode::basic_ustring<unicode::utf8_encoder, unicode::utf8_decoder> test_string;
+
+	int failed = 0;
+	string composed = "caf\xC3\xA9", decomposed = "cafe\xCC\x81", other = "cafe";
+
+	if(!unicode::is_normalized(composed, unicode::nfc) || unicode::is_normalized(decomposed, unicode::nfc)
+		|| unicode::is_normalized(composed, unicode::nfd) || !unicode::is_normalized(decomposed, unicode::nfd)
+		|| !unicode::is_normalized(other, unicode::nfc) || !unicode::is_normalized("", unicode::nfd))
+	{
+		++failed;
+		fail(printed, "is_normalized", "caf\\u00E9 or cafe\\u0301");
+	}
+
+	// U+0301 U+0300 after e is NFC, but the quick check can only say maybe.
+	if(!unicode::is_normalized("\xC3\xA9\xCC\x80", unicode::nfc) || unicode::is_normalized("\xC3\xA9\xCC\x80", unicode::nfd))
+	{
+		++failed;
+		fail(printed, "is_normalized", "\\u00E9\\u0300");
+	}
+
+	if(unicode::compare_canonical(composed, decomposed) != 0 || unicode::compare_canonical(other, composed) >= 0
+		|| unicode::compare_canonical(decomposed, other) <= 0)
+	{
+		++failed;
+		fail(printed, "compare_canonical", "caf\\u00E9, cafe\\u0301 and cafe");
+	}
+
+	test_string s;
+	s.append("cafe");
+	s.append((unicode::utf32_unit)0x0301);
+	test_string nfc = unicode::normalize(s, unicode::nfc);
+	test_string nfd = unicode::normalize(nfc, unicode::nfd);
+
+	if(nfc.size() != 4 || *nfc.at(3) != 0xE9 || nfd.compare(s) != 0)
+	{
+		++failed;
+		fail(printed, "normalize", "a basic_ustring to NFC and back to NFD");
+	}
+
+	return failed;
+}
+
+int main(int argc, char** argv)
+{
+	int printed = 0, failed = 0;
+	const int qty = sizeof(cases) / sizeof(cases[0]);
+
+	for(int i=0; i < qty; ++i)
+		failed += !check_form(parse_hex(cases[i].source), cases[i].form, parse_hex(cases[i].expect), printed);
+
+	failed += check_long_segment(printed);
+	failed += check_stream_safe(printed);
+
+	failed += check_peek<unicode::utf8_nfc_uistream>("utf8_nfc_uistream", "0061 0062 00E9 0063", printed);
+	failed += check_peek<unicode::utf8_nfd_uistream>("utf8_nfd_uistream", "0061 0062 0065 0301 0063", printed);
+
+	failed += check_strings(printed);
+
+	report("normalization", qty + 8, failed);
+	run_file(data_dir(argc, argv));
+
+	return failures() ? 1 : 0;
+}
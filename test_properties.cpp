@@ -0,0 +1,327 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the character property lookups against the cases below, and against every
+// code point in UnicodeData.txt, Scripts.txt and EastAsianWidth.txt if they're in the
+// directory given as the argument.
+//
+//	test_properties [directory]
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "properties.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+const boost::uint32_t max_code_point = 0x10FFFF;
+
+//--------------------------------------------------------------------------------
+// Known characters
+//--------------------------------------------------------------------------------
+
+struct property_case
+{
+	boost::uint32_t cp;
+	unicode::general_category category;
+	unicode::script_code script;
+	unicode::east_asian_width width;
+};
+
+// A character of each general category, and the first and last characters of ranges
+// (surrogates, private use, Han, Hangul syllables, the end of the code space).
+const property_case property_cases[] = {
+	{ 0x0000, unicode::gc_control, unicode::script_common, unicode::eaw_neutral },
+	{ 0x0041, unicode::gc_uppercase_letter, unicode::script_latin, unicode::eaw_narrow },
+	{ 0x0061, unicode::gc_lowercase_letter, unicode::script_latin, unicode::eaw_narrow },
+	{ 0x01C5, unicode::gc_titlecase_letter, unicode::script_latin, unicode::eaw_neutral },
+	{ 0x02B0, unicode::gc_modifier_letter, unicode::script_latin, unicode::eaw_neutral },
+	{ 0x05D0, unicode::gc_other_letter, unicode::script_hebrew, unicode::eaw_neutral },
+	{ 0x0301, unicode::gc_nonspacing_mark, unicode::script_inherited, unicode::eaw_ambiguous },
+	{ 0x0903, unicode::gc_spacing_mark, unicode::script_devanagari, unicode::eaw_neutral },
+	{ 0x20DD, unicode::gc_enclosing_mark, unicode::script_inherited, unicode::eaw_neutral },
+	{ 0x0030, unicode::gc_decimal_number, unicode::script_common, unicode::eaw_narrow },
+	{ 0x2160, unicode::gc_letter_number, unicode::script_latin, unicode::eaw_ambiguous },
+	{ 0x00B2, unicode::gc_other_number, unicode::script_common, unicode::eaw_ambiguous },
+	{ 0x005F, unicode::gc_connector_punctuation, unicode::script_common, unicode::eaw_narrow },
+	{ 0x002D, unicode::gc_dash_punctuation, unicode::script_common, unicode::eaw_narrow },
+	{ 0x0028, unicode::gc_open_punctuation, unicode::script_common, unicode::eaw_narrow },
+	{ 0x0029, unicode::gc_close_punctuation, unicode::script_common, unicode::eaw_narrow },
+	{ 0x00AB, unicode::gc_initial_punctuation, unicode::script_common, unicode::eaw_neutral },
+	{ 0x00BB, unicode::gc_final_punctuation, unicode::script_common, unicode::eaw_neutral },
+	{ 0x0021, unicode::gc_other_punctuation, unicode::script_common, unicode::eaw_narrow },
+	{ 0x002B, unicode::gc_math_symbol, unicode::script_common, unicode::eaw_narrow },
+	{ 0x0024, unicode::gc_currency_symbol, unicode::script_common, unicode::eaw_narrow },
+	{ 0x005E, unicode::gc_modifier_symbol, unicode::script_common, unicode::eaw_narrow },
+	{ 0x00A9, unicode::gc_other_symbol, unicode::script_common, unicode::eaw_neutral },
+	{ 0x0020, unicode::gc_space_separator, unicode::script_common, unicode::eaw_narrow },
+	{ 0x2028, unicode::gc_line_separator, unicode::script_common, unicode::eaw_neutral },
+	{ 0x2029, unicode::gc_paragraph_separator, unicode::script_common, unicode::eaw_neutral },
+	{ 0x200D, unicode::gc_format, unicode::script_inherited, unicode::eaw_neutral },
+	{ 0xD800, unicode::gc_surrogate, unicode::script_unknown, unicode::eaw_neutral },
+	{ 0xDFFF, unicode::gc_surrogate, unicode::script_unknown, unicode::eaw_neutral },
+	{ 0xE000, unicode::gc_private_use, unicode::script_unknown, unicode::eaw_ambiguous },
+	{ 0xF8FF, unicode::gc_private_use, unicode::script_unknown, unicode::eaw_ambiguous },
+	{ 0xF0000, unicode::gc_private_use, unicode::script_unknown, unicode::eaw_ambiguous },
+	{ 0x10FFFD, unicode::gc_private_use, unicode::script_unknown, unicode::eaw_ambiguous },
+	{ 0x0378, unicode::gc_unassigned, unicode::script_unknown, unicode::eaw_neutral },
+	{ 0xFFFF, unicode::gc_unassigned, unicode::script_unknown, unicode::eaw_neutral },
+	{ 0x10FFFF, unicode::gc_unassigned, unicode::script_unknown, unicode::eaw_neutral },
+	{ 0x4E00, unicode::gc_other_letter, unicode::script_han, unicode::eaw_wide },
+	{ 0x9FFF, unicode::gc_other_letter, unicode::script_han, unicode::eaw_wide },
+	{ 0xA000, unicode::gc_other_letter, unicode::script_yi, unicode::eaw_wide },
+	{ 0xAC00, unicode::gc_other_letter, unicode::script_hangul, unicode::eaw_wide },
+	{ 0xD7A3, unicode::gc_other_letter, unicode::script_hangul, unicode::eaw_wide },
+	{ 0xD7A4, unicode::gc_unassigned, unicode::script_unknown, unicode::eaw_neutral },
+	{ 0xFF21, unicode::gc_uppercase_letter, unicode::script_latin, unicode::eaw_fullwidth },
+	{ 0xFF61, unicode::gc_other_punctuation, unicode::script_common, unicode::eaw_halfwidth },
+	{ 0x1F600, unicode::gc_other_symbol, unicode::script_common, unicode::eaw_wide },
+	{ 0x20000, unicode::gc_other_letter, unicode::script_han, unicode::eaw_wide },
+	{ 0x2A6DF, unicode::gc_other_letter, unicode::script_han, unicode::eaw_wide },
+	{ 0x2A6E0, unicode::gc_unassigned, unicode::script_unknown, unicode::eaw_wide },
+	{ 0xE01EF, unicode::gc_nonspacing_mark, unicode::script_inherited, unicode::eaw_ambiguous },
+	{ 0xE01F0, unicode::gc_unassigned, unicode::script_unknown, unicode::eaw_neutral },
+};
+
+// The is_ functions, for a character that is and one that isn't.
+struct classify_case
+{
+	bool (*classify)(boost::uint32_t cp);
+	const char* name;
+	boost::uint32_t is;
+	boost::uint32_t isnt;
+};
+
+const classify_case classify_cases[] = {
+	{ unicode::is_letter, "is_letter", 0x01C5, 0x0030 },
+	{ unicode::is_mark, "is_mark", 0x0903, 0x02B0 },
+	{ unicode::is_number, "is_number", 0x2160, 0x0041 },
+	{ unicode::is_punctuation, "is_punctuation", 0x00BB, 0x002B },
+	{ unicode::is_symbol, "is_symbol", 0x005E, 0x005F },
+	{ unicode::is_separator, "is_separator", 0x2029, 0x0009 },
+	{ unicode::is_wide, "is_wide", 0xFF21, 0xFF61 },
+};
+
+void test_cases()
+{
+	int cases = 0, failed = 0, printed = 0;
+
+	for(size_t i=0; i < sizeof(property_cases) / sizeof(property_cases[0]); ++i)
+	{
+		const property_case& c = property_cases[i];
+		unicode::character_properties got = unicode::properties(c.cp);
+		++cases;
+
+		if(got.category != c.category || got.script != c.script || got.width != c.width)
+		{
+			++failed;
+			ostringstream what;
+			what << hex << "U+" << c.cp << ": category " << dec << got.category << ", script " << got.script << ", width " << got.width
+				<< ", expected " << c.category << ", " << c.script << ", " << c.width;
+			fail(printed, "properties", what.str());
+		}
+	}
+
+	for(size_t i=0; i < sizeof(classify_cases) / sizeof(classify_cases[0]); ++i)
+	{
+		const classify_case& c = classify_cases[i];
+		cases += 2;
+
+		if(!c.classify(c.is) || c.classify(c.isnt))
+		{
+			++failed;
+			fail(printed, "properties", c.name);
+		}
+	}
+
+	report("properties", cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// Every code point, from the UCD's property files
+//--------------------------------------------------------------------------------
+
+// General category abbreviations, in the order of the general_category enum.
+const char* const category_names[] = { "Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No",
+	"Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co" };
+
+// East_Asian_Width values, in the order of the east_asian_width enum.
+const char* const width_names[] = { "N", "A", "H", "W", "F", "Na" };
+
+int index_of(const char* const* names, size_t qty, const string& name)
+{
+	return (int)(find(names, names + qty, name) - names);
+}
+
+// Fill values (by code point) with the index in names of each range's value in the
+// property file (fields separated by ;). Code points that aren't listed keep their value.
+bool read_ranges(const string& dir, const char* name, const vector<string>& names, vector<int>& values)
+{
+	ifstream in;
+
+	if(!open_data(in, dir, name))
+		return false;
+
+	string line;
+
+	while(getline(in, line))
+	{
+		line = strip_comment(line);
+		size_t semi = line.find(';');
+
+		if(semi == string::npos)
+			continue;
+
+		string range = line.substr(0, semi), value = line.substr(semi + 1);
+		value.erase(0, value.find_first_not_of(" \t"));
+		value.erase(value.find_last_not_of(" \t\r") + 1);
+
+		size_t dots = range.find("..");
+		boost::uint32_t first = (boost::uint32_t)strtoul(range.c_str(), 0, 16);
+		boost::uint32_t last = dots == string::npos ? first : (boost::uint32_t)strtoul(range.c_str() + dots + 2, 0, 16);
+		int v = (int)(find(names.begin(), names.end(), value) - names.begin());
+
+		for(boost::uint32_t cp = first; cp <= last; ++cp)
+			values[cp] = v;
+	}
+
+	return true;
+}
+
+// Fill categories (by code point) from UnicodeData.txt, where ranges are given by
+// <..., First> and <..., Last> lines.
+bool read_categories(const string& dir, vector<int>& categories)
+{
+	ifstream in;
+
+	if(!open_data(in, dir, "UnicodeData.txt"))
+		return false;
+
+	const size_t qty = sizeof(category_names) / sizeof(category_names[0]);
+	boost::uint32_t range_first = 0;
+	string line;
+
+	while(getline(in, line))
+	{
+		vector<string> fields;
+		istringstream split(line);
+
+		for(string field; getline(split, field, ';'); )
+			fields.push_back(field);
+
+		if(fields.size() < 3)
+			continue;
+
+		boost::uint32_t cp = (boost::uint32_t)strtoul(fields[0].c_str(), 0, 16);
+		int category = index_of(category_names, qty, fields[2]);
+
+		if(fields[1].find(", First>") != string::npos)
+			range_first = cp;
+		else if(fields[1].find(", Last>") != string::npos)
+		{
+			for(boost::uint32_t c = range_first; c <= cp; ++c)
+				categories[c] = category;
+		}
+		else
+			categories[cp] = category;
+	}
+
+	return true;
+}
+
+// Compare one property of every code point with what the files say.
+void compare_all(const char* name, const vector<int>& expect, int (*lookup)(boost::uint32_t cp))
+{
+	int failed = 0, printed = 0;
+
+	for(boost::uint32_t cp = 0; cp <= max_code_point; ++cp)
+	{
+		int got = lookup(cp);
+
+		if(got != expect[cp])
+		{
+			++failed;
+			ostringstream what;
+			what << hex << "U+" << cp << dec << ": got " << got << ", expected " << expect[cp];
+			fail(printed, name, what.str());
+		}
+	}
+
+	report(name, max_code_point + 1, failed);
+}
+
+int category_of(boost::uint32_t cp)
+{
+	return unicode::properties(cp).category;
+}
+
+int script_of(boost::uint32_t cp)
+{
+	return unicode::properties(cp).script;
+}
+
+int width_of(boost::uint32_t cp)
+{
+	return unicode::properties(cp).width;
+}
+
+void test_files(const string& dir)
+{
+	vector<int> categories(max_code_point + 1, unicode::gc_unassigned);
+
+	if(read_categories(dir, categories))
+		compare_all("UnicodeData.txt", categories, category_of);
+
+	// Scripts are numbered in alphabetical order, after Unknown.
+	vector<string> scripts;
+	ifstream in;
+
+	if(open_data(in, dir, "Scripts.txt"))
+	{
+		string line;
+
+		while(getline(in, line))
+		{
+			line = strip_comment(line);
+			size_t semi = line.find(';');
+
+			if(semi == string::npos)
+				continue;
+
+			istringstream value(line.substr(semi + 1));
+			string script;
+			value >> script;
+
+			if(find(scripts.begin(), scripts.end(), script) == scripts.end())
+				scripts.push_back(script);
+		}
+
+		sort(scripts.begin(), scripts.end());
+		scripts.insert(scripts.begin(), "Unknown");
+
+		vector<int> script_values(max_code_point + 1, unicode::script_unknown);
+
+		if(read_ranges(dir, "Scripts.txt", scripts, script_values))
+			compare_all("Scripts.txt", script_values, script_of);
+	}
+
+	vector<string> widths(width_names, width_names + sizeof(width_names) / sizeof(width_names[0]));
+	vector<int> width_values(max_code_point + 1, unicode::eaw_neutral);
+
+	if(read_ranges(dir, "EastAsianWidth.txt", widths, width_values))
+		compare_all("EastAsianWidth.txt", width_values, width_of);
+}
+
+int main(int argc, char** argv)
+{
+	test_cases();
+	test_files(data_dir(argc, argv));
+
+	return failures() ? 1 : 0;
+}
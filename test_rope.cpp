@@ -0,0 +1,267 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks ustring_rope against a vector of code points: random inserts, erases and
+// substrings, big enough to make trees several levels deep, with snapshots taken along
+// the way that mustn't change afterwards.
+//
+//	test_rope
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ustring_rope.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef vector<boost::uint32_t> chars;
+typedef unicode::ustring_rope::size_type size_type;
+
+// Line feeds and characters of every UTF-8 length.
+chars random_text(size_t qty)
+{
+	const boost::uint32_t samples[] = { 0x61, 0x62, 0x20, 0x0A, 0xE9, 0x03B1, 0x65E5, 0x1F600 };
+	chars ret;
+
+	for(size_t i=0; i < qty; ++i)
+		ret.push_back(samples[std::rand() % (sizeof(samples) / sizeof(samples[0]))]);
+
+	return ret;
+}
+
+// Compare everything the rope can say about itself with the model, and return what's
+// wrong, or an empty string.
+string check_rope(const unicode::ustring_rope& r, const chars& model)
+{
+	string bytes = to_utf8(model);
+
+	if(r.size() != model.size() || r.bytes() != bytes.size() || r.empty() != model.empty())
+		return "size(), bytes() or empty()";
+
+	ostringstream out;
+	out << r;
+
+	if(out.str() != bytes)
+		return "the UTF-8 written by operator<<";
+
+	// Forwards and backwards.
+	size_type pos = 0;
+
+	for(unicode::ustring_rope::iterator i=r.begin(); i != r.end(); ++i, ++pos)
+	{
+		if(*i != model[pos] || i.position() != pos)
+			return "iterating forwards";
+	}
+
+	unicode::ustring_rope::iterator i = r.end();
+
+	for(pos = model.size(); pos--; )
+	{
+		--i;
+
+		if(*i != model[pos] || i.position() != pos)
+			return "iterating backwards";
+	}
+
+	// Lines, and at() for a sample of positions.
+	vector<size_type> starts(1, 0);
+
+	for(size_type p=0; p < model.size(); ++p)
+	{
+		if(model[p] == '\n')
+			starts.push_back(p + 1);
+	}
+
+	if(r.line_count() != starts.size())
+		return "line_count()";
+
+	for(size_type line=0; line < starts.size(); ++line)
+	{
+		if(r.line_start(line) != starts[line])
+			return "line_start()";
+	}
+
+	size_type step = model.size() / 200 + 1;
+
+	for(size_type p=0, line=0; p <= model.size(); p += step)
+	{
+		while(line + 1 < starts.size() && starts[line + 1] <= p)
+			++line;
+
+		if(r.line_of(p) != line)
+			return "line_of()";
+
+		if(p < model.size() && *r.at(p) != model[p])
+			return "at()";
+	}
+
+	return string();
+}
+
+void test_rope()
+{
+	int cases = 0, failed = 0, printed = 0;
+	unicode::ustring_rope r;
+	chars model;
+	vector<unicode::ustring_rope> snapshots;
+	vector<chars> snapshot_models;
+
+	std::srand(1);
+
+	for(int op=0; op < 2000; ++op)
+	{
+		int what = std::rand() % 10;
+		ostringstream detail;
+		detail << "operation " << op << ": ";
+
+		if(what < 5 || model.empty())
+		{
+			// Mostly typing a few characters, sometimes pasting a lot.
+			chars s = random_text(std::rand() % 8 ? std::rand() % 10 + 1 : std::rand() % 3000 + 1);
+			string bytes = to_utf8(s);
+			size_type pos = std::rand() % (model.size() + 1);
+
+			if(s.size() == 1 && std::rand() % 2 && pos == model.size())
+				r.append((unicode::utf32_unit)s[0]);
+			else
+				r.insert(pos, unicode::ustring_view(bytes));
+
+			model.insert(model.begin() + pos, s.begin(), s.end());
+			detail << "insert " << s.size() << " at " << pos;
+		}
+		else if(what < 8)
+		{
+			size_type pos = std::rand() % (model.size() + 1);
+			size_type qty = std::rand() % 4 ? std::rand() % 5 : std::rand() % 2000;
+			size_type end = qty > model.size() - pos ? model.size() : pos + qty;
+
+			r.erase(pos, qty);
+			model.erase(model.begin() + pos, model.begin() + end);
+			detail << "erase " << qty << " at " << pos;
+		}
+		else if(what == 8)
+		{
+			size_type pos = std::rand() % (model.size() + 1);
+			size_type qty = std::rand() % (model.size() - pos + 1);
+			unicode::ustring_rope sub = r.substr(pos, qty);
+			chars sub_model(model.begin() + pos, model.begin() + pos + qty);
+			string wrong = check_rope(sub, sub_model);
+			++cases;
+
+			if(!wrong.empty())
+			{
+				++failed;
+				detail << "substr(" << pos << ", " << qty << "): " << wrong;
+				fail(printed, "ustring_rope", detail.str());
+			}
+
+			// Put a copy of it back, sharing the text.
+			size_type at = std::rand() % (model.size() + 1);
+			r.insert(at, sub);
+			model.insert(model.begin() + at, sub_model.begin(), sub_model.end());
+			detail << "insert a substring of " << qty << " at " << at;
+		}
+		else
+		{
+			snapshots.push_back(r);
+			snapshot_models.push_back(model);
+			continue;
+		}
+
+		if(op % 10 == 0 || model.size() < 100)
+		{
+			string wrong = check_rope(r, model);
+			++cases;
+
+			if(!wrong.empty())
+			{
+				++failed;
+				fail(printed, "ustring_rope", detail.str() + ": " + wrong);
+				break;
+			}
+		}
+
+		// Keep it from growing without bound.
+		if(model.size() > 50000)
+		{
+			r.erase(0, 25000);
+			model.erase(model.begin(), model.begin() + 25000);
+		}
+	}
+
+	++cases;
+
+	if(!check_rope(r, model).empty())
+	{
+		++failed;
+		fail(printed, "ustring_rope", "at the end: " + check_rope(r, model));
+	}
+
+	// The snapshots, and substrings of them taken after the rope they came from is gone.
+	r.clear();
+
+	for(size_t i=0; i < snapshots.size(); ++i)
+	{
+		const chars& m = snapshot_models[i];
+		size_type pos = m.size() / 3, qty = m.size() / 2;
+		string wrong = check_rope(snapshots[i], m);
+
+		unicode::ustring_rope sub = snapshots[i].substr(pos, qty);
+		snapshots[i] = unicode::ustring_rope();
+
+		if(wrong.empty())
+			wrong = check_rope(sub, chars(m.begin() + pos, m.begin() + pos + qty));
+
+		ostringstream detail;
+		detail << "snapshot " << i << ": ";
+		++cases;
+
+		if(!wrong.empty())
+		{
+			++failed;
+			fail(printed, "ustring_rope", detail.str() + wrong);
+		}
+	}
+
+	report("ustring_rope", cases, failed);
+}
+
+// A rope made from text with line feeds at the very ends, and an empty one.
+void test_edges()
+{
+	int cases = 0, failed = 0, printed = 0;
+	const char* const texts[] = { "", "\n", "a", "\n\n", "a\nb\n", "\xE6\x97\xA5\n\xF0\x9F\x98\x80" };
+
+	for(size_t i=0; i < sizeof(texts) / sizeof(texts[0]); ++i)
+	{
+		unicode::ustring_rope r = unicode::ustring_view(texts[i]);
+		chars model;
+
+		for(unicode::ustring_view::iterator j=unicode::ustring_view(texts[i]).begin(); j != unicode::ustring_view(texts[i]).end(); ++j)
+			model.push_back(*j);
+
+		string wrong = check_rope(r, model);
+		++cases;
+
+		if(!wrong.empty())
+		{
+			++failed;
+			fail(printed, "ustring_rope", "\"" + string(texts[i]) + "\": " + wrong);
+		}
+	}
+
+	report("ustring_rope edges", cases, failed);
+}
+
+int main()
+{
+	test_edges();
+	test_rope();
+
+	return failures() ? 1 : 0;
+}
@@ -0,0 +1,807 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the Unicode streams: counting and skipping UTF-8 in blocks, ignore() on
+// streams that can seek and on ones that can't, what the decoders make of malformed
+// input with each error policy, the encoders' buffers, and the statistics (which
+// tools/check.sh also builds this with BOOST_UNICODE_ENABLE_STATS for).
+//
+//	test_ustream
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "ustream.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef vector<boost::uint32_t> chars;
+
+// A streambuf that hands out a few bytes at a time and can't seek, like a pipe.
+class pipe_buf : public std::streambuf
+{
+public:
+	pipe_buf(const string& _data) : data(_data), pos(0) {}
+
+protected:
+	int_type underflow()
+	{
+		if(pos == data.size())
+			return traits_type::eof();
+
+		size_t qty = data.size() - pos < sizeof(buf) ? data.size() - pos : sizeof(buf);
+		data.copy(buf, qty, pos);
+		pos += qty;
+		setg(buf, buf, buf + qty);
+		return traits_type::to_int_type(*buf);
+	}
+
+private:
+	string data;
+	size_t pos;
+	char buf[7];
+};
+
+// Characters of 1 to 4 bytes in UTF-8, chosen at random but the same every run.
+chars random_text(size_t qty)
+{
+	const boost::uint32_t samples[] = { 0x41, 0x7A, 0x0A, 0xE9, 0x03B1, 0x0416, 0x20AC, 0x65E5, 0xFFFD, 0x1F600, 0x10348, 0x10FFFF };
+	chars ret;
+	std::srand(1);
+
+	for(size_t i=0; i < qty; ++i)
+		ret.push_back(samples[std::rand() % (sizeof(samples) / sizeof(samples[0]))]);
+
+	return ret;
+}
+
+//--------------------------------------------------------------------------------
+// utf8_count and utf8_advance
+//--------------------------------------------------------------------------------
+
+// Against a byte at a time, for every length up to a few 64 byte blocks (so the SSE2
+// and 64 byte block paths are used along with the tails), and every amount to skip.
+void test_count_advance()
+{
+	int cases = 0, failed = 0, printed = 0;
+	string bytes = to_utf8(random_text(100));
+	const boost::uint8_t* p = (const boost::uint8_t*)bytes.data();
+
+	for(size_t first=0; first < 4; ++first)
+	{
+		for(size_t last=first; last <= 200 && last <= bytes.size(); ++last)
+		{
+			size_t leads = 0;
+
+			for(size_t i=first; i < last; ++i)
+				leads += (p[i] & 0xC0) != 0x80;
+
+			++cases;
+
+			if(unicode::utf8_count(p + first, p + last) != leads)
+			{
+				++failed;
+				ostringstream what;
+				what << "utf8_count of bytes " << first << " to " << last;
+				fail(printed, "utf8_count", what.str());
+			}
+
+			for(size_t qty=0; qty <= leads + 1; ++qty)
+			{
+				// The (qty+1)th lead byte, or last.
+				size_t expect = first, seen = 0;
+
+				for(; expect < last; ++expect)
+				{
+					if((p[expect] & 0xC0) != 0x80 && seen++ == qty)
+						break;
+				}
+
+				size_t left = qty;
+				const boost::uint8_t* got = unicode::utf8_advance(p + first, p + last, left);
+				++cases;
+
+				if(got != p + expect || left != (qty > leads ? qty - leads : 0))
+				{
+					++failed;
+					ostringstream what;
+					what << "utf8_advance of " << qty << " over bytes " << first << " to " << last;
+					fail(printed, "utf8_advance", what.str());
+				}
+			}
+		}
+	}
+
+	report("utf8_count, utf8_advance", cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// skipg and ignore()
+//--------------------------------------------------------------------------------
+
+// ignore() qty characters from s and check what's read next, with and without a
+// delimiter, on in (which holds s in UTF-8). Returns false if anything's wrong.
+bool check_ignore(std::istream& in, const chars& s, size_t qty, boost::int_fast32_t delim, string& detail)
+{
+	unicode::utf8_uistream us(&in);
+	size_t expect = qty < s.size() ? qty : s.size();
+
+	if(delim != EOF)
+	{
+		for(size_t i=0; i < expect; ++i)
+		{
+			if(s[i] == (boost::uint32_t)delim)
+			{
+				expect = i + 1;
+				break;
+			}
+		}
+	}
+
+	us.ignore((int)qty, delim);
+
+	if((size_t)us.gcount() != expect || us.tellg() != expect)
+	{
+		ostringstream what;
+		what << "ignored " << us.gcount() << ", expected " << expect;
+		detail = what.str();
+		return false;
+	}
+
+	boost::int_fast32_t next = us.get();
+
+	if(next != (expect < s.size() ? (boost::int_fast32_t)s[expect] : EOF))
+	{
+		ostringstream what;
+		what << "read " << next << " after ignoring " << expect << ", expected " << (expect < s.size() ? (boost::int_fast32_t)s[expect] : EOF);
+		detail = what.str();
+		return false;
+	}
+
+	return true;
+}
+
+// Skip amounts either side of the 4 KB blocks skipg reads and the 64 byte blocks
+// utf8_advance counts, on a stream that can seek and on a pipe, which skipg has to
+// step through without seeking back.
+void test_ignore()
+{
+	int cases = 0, failed = 0, printed = 0;
+	chars s = random_text(5000);
+	string bytes = to_utf8(s);
+	vector<size_t> amounts;
+
+	for(size_t qty=0; qty < 70; ++qty)
+		amounts.push_back(qty);
+
+	// Characters that end near the 4 KB boundaries.
+	vector<size_t> offsets;
+	to_utf8(s, &offsets);
+
+	for(size_t i=0; i < s.size(); ++i)
+	{
+		if(offsets[i + 1] > 4090 && offsets[i] < 4102)
+			amounts.push_back(i);
+
+		if(offsets[i + 1] > 8186 && offsets[i] < 8198)
+			amounts.push_back(i);
+	}
+
+	amounts.push_back(s.size() - 1);
+	amounts.push_back(s.size());
+	amounts.push_back(s.size() + 10);
+
+	const boost::int_fast32_t delims[] = { EOF, 0x1F600, 0x0A };
+
+	for(size_t i=0; i < amounts.size(); ++i)
+	{
+		for(size_t d=0; d < sizeof(delims) / sizeof(delims[0]); ++d)
+		{
+			string detail;
+			istringstream in(bytes);
+			pipe_buf pb(bytes);
+			std::istream pipe(&pb);
+
+			++cases;
+
+			if(!check_ignore(in, s, amounts[i], delims[d], detail))
+			{
+				++failed;
+				fail(printed, "ignore", "from an istringstream: " + detail);
+			}
+
+			++cases;
+
+			if(!check_ignore(pipe, s, amounts[i], delims[d], detail))
+			{
+				++failed;
+				fail(printed, "ignore", "from a pipe: " + detail);
+			}
+		}
+	}
+
+	// ignore(0) mustn't read anything.
+	istringstream in(bytes);
+	unicode::utf8_uistream us(&in);
+	us.ignore(0);
+	++cases;
+
+	if(in.tellg() != 0 || us.gcount() != 0)
+	{
+		++failed;
+		fail(printed, "ignore", "ignore(0) read from the stream");
+	}
+
+	report("skipg, ignore", cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// Malformed input and the error policies
+//--------------------------------------------------------------------------------
+
+struct malformed_case
+{
+	const char* bytes;
+	size_t size; // The bytes can have nulls in them.
+	const char* replaced; // What replace_on_error decodes, in hex.
+	const char* offsets; // Byte offsets of the errors, in hex.
+};
+
+#define BYTES(s) s, sizeof(s) - 1
+
+// Nothing here decodes to a real U+FFFD, so what the other policies give can be found
+// by taking the U+FFFDs out.
+const malformed_case utf8_cases[] = {
+	{ BYTES("a\xC2\x80\xED\x9F\xBF\xEE\x80\x80\xF4\x8F\xBF\xBF"), "0061 0080 D7FF E000 10FFFF", "" }, // The edges of what's allowed.
+	{ BYTES("a\xC0\x80" "b"), "0061 FFFD 0062", "1" }, // Overlong.
+	{ BYTES("\xC1\xBF"), "FFFD", "0" },
+	{ BYTES("\xE0\x80\x80" "a"), "FFFD 0061", "0" },
+	{ BYTES("\xE0\x9F\xBF"), "FFFD", "0" },
+	{ BYTES("\xF0\x80\x80\x80"), "FFFD", "0" },
+	{ BYTES("\xF0\x8F\xBF\xBF" "a"), "FFFD 0061", "0" },
+	{ BYTES("a\xED\xA0\x80"), "0061 FFFD", "1" }, // Surrogates.
+	{ BYTES("\xED\xBF\xBF" "\xED\xA0\xBD\xED\xB8\x80"), "FFFD FFFD FFFD", "0 3 6" },
+	{ BYTES("\xF4\x90\x80\x80" "a"), "FFFD 0061", "0" }, // Past U+10FFFF.
+	{ BYTES("\xF7\xBF\xBF\xBF"), "FFFD", "0" },
+	{ BYTES("a\x80" "b"), "0061 FFFD 0062", "1" }, // Stray continuation bytes.
+	{ BYTES("\x80\xBF" "a\xBF"), "FFFD FFFD 0061 FFFD", "0 1 3" },
+	{ BYTES("\xC3\xA9\xA9"), "00E9 FFFD", "2" },
+	{ BYTES("\xF8\x88\x80\x80\x80"), "FFFD FFFD FFFD FFFD FFFD", "0 1 2 3 4" }, // Five and six byte forms.
+	{ BYTES("\xFC\x84\x80\x80\x80\x80" "a"), "FFFD FFFD FFFD FFFD FFFD FFFD 0061", "0 1 2 3 4 5" },
+	{ BYTES("\xFE\xFF" "a"), "FFFD FFFD 0061", "0 1" },
+	{ BYTES("\xE6\x97" "a"), "FFFD 0061", "0" }, // Cut short by the next character.
+	{ BYTES("\xF0\x9F\x98\xC3\xA9"), "FFFD 00E9", "0" },
+	{ BYTES("\xC3" "\xE6\x97\xA5"), "FFFD 65E5", "0" },
+	{ BYTES("a\xE6\x97"), "0061 FFFD", "1" }, // Cut short by the end.
+	{ BYTES("\xF0\x9F\x98"), "FFFD", "0" },
+	{ BYTES("\xC3"), "FFFD", "0" },
+};
+
+const malformed_case utf16le_cases[] = {
+	{ BYTES("A\0=\xD8\0\xDE"), "0041 1F600", "" },
+	{ BYTES("\0\xD8" "A\0"), "FFFD 0041", "0" }, // A high surrogate without a low one.
+	{ BYTES("A\0\0\xDC" "B\0"), "0041 FFFD 0042", "2" }, // A low surrogate by itself.
+	{ BYTES("\0\xD8\0\xD8\0\xDC"), "FFFD 10000", "0" },
+	{ BYTES("A\0\0\xD8"), "0041 FFFD", "2" }, // Cut short by the end.
+	{ BYTES("A\0B"), "0041 FFFD", "2" },
+};
+
+const malformed_case utf32le_cases[] = {
+	{ BYTES("A\0\0\0\xFF\xFF\x10\0"), "0041 10FFFF", "" },
+	{ BYTES("\0\0\x11\0" "A\0\0\0"), "FFFD 0041", "0" }, // Past U+10FFFF.
+	{ BYTES("A\0\0\0\0\xD8\0\0\xFF\xDF\0\0"), "0041 FFFD FFFD", "4 8" }, // Surrogates.
+	{ BYTES("A\0\0\0" "B\0"), "0041 FFFD", "4" }, // Cut short by the end.
+};
+
+// The decoders for each encoding, given an error policy.
+template<class error_policy>
+struct utf8_with
+{
+	typedef unicode::basic_utf8_decoder<error_policy> type;
+};
+
+template<class error_policy>
+struct utf16le_with
+{
+	typedef unicode::utf16_decoder<1234, error_policy> type;
+};
+
+template<class error_policy>
+struct utf32le_with
+{
+	typedef unicode::utf32_decoder<1234, error_policy> type;
+};
+
+// The offsets the decoder gives: from a pipe, there's no telling.
+vector<boost::intmax_t> expected_offsets(const malformed_case& c, bool pipe)
+{
+	chars offsets = parse_hex(c.offsets);
+	vector<boost::intmax_t> ret;
+
+	for(size_t i=0; i < offsets.size(); ++i)
+		ret.push_back(pipe ? -1 : (boost::intmax_t)offsets[i]);
+
+	return ret;
+}
+
+// Decode c with each policy, from an istringstream and from a pipe, and check what's
+// decoded, the number of errors and where they were. Returns what's wrong, or an
+// empty string.
+template<template<class> class with>
+string check_policies(const malformed_case& c, bool pipe)
+{
+	string bytes(c.bytes, c.size);
+	chars replaced = parse_hex(c.replaced), skipped;
+	vector<boost::intmax_t> offsets = expected_offsets(c, pipe);
+
+	for(size_t i=0; i < replaced.size(); ++i)
+	{
+		if(replaced[i] != 0xFFFD)
+			skipped.push_back(replaced[i]);
+	}
+
+	// Replacing, noting where each error was as it happens.
+	{
+		istringstream in(bytes);
+		pipe_buf pb(bytes);
+		std::istream pipe_in(&pb);
+		typename with<unicode::replace_on_error>::type dec(pipe ? &pipe_in : (std::istream*)&in);
+		chars got;
+		vector<boost::intmax_t> got_offsets;
+
+		for(boost::int_fast32_t ch; (ch = dec.decode()) != EOF; )
+		{
+			got.push_back((boost::uint32_t)ch);
+
+			if(dec.errors() > got_offsets.size())
+				got_offsets.push_back(dec.last_error());
+		}
+
+		if(got != replaced)
+			return "replace_on_error decoded " + to_hex(got);
+
+		if(dec.errors() != offsets.size() || got_offsets != offsets)
+			return "replace_on_error didn't say where the errors were";
+	}
+
+	// Skipping.
+	{
+		istringstream in(bytes);
+		pipe_buf pb(bytes);
+		std::istream pipe_in(&pb);
+		typename with<unicode::skip_on_error>::type dec(pipe ? &pipe_in : (std::istream*)&in);
+		chars got;
+
+		for(boost::int_fast32_t ch; (ch = dec.decode()) != EOF; )
+			got.push_back((boost::uint32_t)ch);
+
+		if(got != skipped)
+			return "skip_on_error decoded " + to_hex(got);
+
+		if(dec.errors() != offsets.size() || (!offsets.empty() && dec.last_error() != offsets.back()))
+			return "skip_on_error didn't count the errors";
+	}
+
+	// Stopping at each error, and going on once the stream is cleared.
+	{
+		istringstream in(bytes);
+		pipe_buf pb(bytes);
+		std::istream pipe_in(&pb);
+		std::istream& is = pipe ? pipe_in : in;
+		typename with<unicode::stop_on_error>::type dec(&is);
+		chars got;
+		size_t stops = 0;
+
+		for(;;)
+		{
+			boost::int_fast32_t ch = dec.decode();
+
+			if(ch != EOF)
+			{
+				got.push_back((boost::uint32_t)ch);
+				continue;
+			}
+
+			if(is.eof())
+				break;
+
+			// Stopped at an error, after everything before it.
+			if(stops >= offsets.size() || dec.errors() != stops + 1 || dec.last_error() != offsets[stops])
+				return "stop_on_error stopped where there wasn't an error";
+
+			++stops;
+			is.clear();
+		}
+
+		if(got != skipped)
+			return "stop_on_error decoded " + to_hex(got);
+
+		if(dec.errors() != offsets.size())
+			return "stop_on_error didn't count the errors";
+	}
+
+	// Throwing at each error, and going on after it.
+	{
+		istringstream in(bytes);
+		pipe_buf pb(bytes);
+		std::istream pipe_in(&pb);
+		typename with<unicode::throw_on_error>::type dec(pipe ? &pipe_in : (std::istream*)&in);
+		chars got;
+		vector<boost::intmax_t> thrown;
+
+		for(;;)
+		{
+			try
+			{
+				boost::int_fast32_t ch = dec.decode();
+
+				if(ch == EOF)
+					break;
+
+				got.push_back((boost::uint32_t)ch);
+			}
+			catch(const unicode::decode_error& e)
+			{
+				thrown.push_back(e.offset());
+			}
+		}
+
+		if(got != skipped)
+			return "throw_on_error decoded " + to_hex(got);
+
+		if(thrown != offsets)
+			return "throw_on_error didn't throw where the errors were";
+	}
+
+	return string();
+}
+
+template<template<class> class with>
+void test_policies(const char* name, const malformed_case* cases, size_t qty)
+{
+	int failed = 0, printed = 0;
+
+	for(size_t i=0; i < qty; ++i)
+	{
+		for(int pipe=0; pipe < 2; ++pipe)
+		{
+			string wrong = check_policies<with>(cases[i], pipe != 0);
+
+			if(!wrong.empty())
+			{
+				++failed;
+				vector<boost::uint32_t> bytes(cases[i].bytes, cases[i].bytes + cases[i].size);
+				fail(printed, name, "bytes " + to_hex(bytes) + (pipe ? " from a pipe: " : ": ") + wrong);
+			}
+		}
+	}
+
+	report(name, (int)qty * 2, failed);
+}
+
+// The offsets of errors are counted by the decoder rather than asked of the stream,
+// so they have to stay right when the stream goes back with unget() and peek(), and
+// seeks.
+void test_error_offsets()
+{
+	int cases = 0, failed = 0, printed = 0;
+
+	// Ten characters with errors at 2, 4, 7 and 9. (Not stray continuation bytes,
+	// which unget() can't step back over by themselves.)
+	string block = "ab\xC3" "c\xE6\x97" "d\xFF" "e\xC0\x80" "\xC3\xA9";
+	string bytes;
+
+	for(int i=0; i < 20; ++i)
+		bytes += block;
+
+	const boost::intmax_t in_block[] = { 2, 4, 7, 9 };
+	vector<boost::intmax_t> expect;
+
+	for(int i=0; i < 20; ++i)
+	{
+		for(size_t j=0; j < 4; ++j)
+			expect.push_back(in_block[j] + i * (boost::intmax_t)block.size());
+	}
+
+	// Reading, with a peek() and an unget() and get() before each character.
+	{
+		istringstream in(bytes);
+		unicode::utf8_uistream us(&in);
+		vector<boost::intmax_t> got;
+
+		for(;;)
+		{
+			us.peek();
+
+			if(us.get() == EOF)
+				break;
+
+			us.unget();
+
+			// Each error is decoded three times, but it has to be found at the same place.
+			if(us.get() == 0xFFFD)
+				got.push_back(us.last_error());
+		}
+
+		++cases;
+
+		if(got != expect)
+		{
+			++failed;
+			fail(printed, "error offsets", "after peek() and unget()");
+		}
+	}
+
+	// After seeking to the start of each block.
+	for(int i=19; i >= 0; i -= 3)
+	{
+		istringstream in(bytes);
+		unicode::utf8_uistream us(&in);
+
+		while(us.get() != EOF)
+			;
+
+		in.clear();
+		us.seekg(i * 10);
+		unsigned long errors = (unsigned long)us.errors();
+		us.get();
+		us.get();
+		us.get();
+		++cases;
+
+		if(us.errors() != errors + 1 || us.last_error() != expect[i * 4])
+		{
+			++failed;
+			ostringstream what;
+			what << "after seeking to character " << i * 10 << ": " << us.last_error() << ", expected " << expect[i * 4];
+			fail(printed, "error offsets", what.str());
+		}
+	}
+
+	report("error offsets", cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// Encoder buffers
+//--------------------------------------------------------------------------------
+
+// s in UTF-16 or UTF-32 (unit_size 2 or 4), worked out here rather than by the encoders.
+string encode_units(const chars& s, int unit_size, bool big_endian)
+{
+	string ret;
+
+	for(size_t i=0; i < s.size(); ++i)
+	{
+		vector<boost::uint32_t> units;
+
+		if(unit_size == 2 && s[i] > 0xFFFF)
+		{
+			units.push_back(((s[i] - 0x10000) >> 10) + 0xD800);
+			units.push_back(((s[i] - 0x10000) & 0x3FF) + 0xDC00);
+		}
+		else
+			units.push_back(s[i]);
+
+		for(size_t j=0; j < units.size(); ++j)
+		{
+			for(int k=0; k < unit_size; ++k)
+				ret += (char)(units[j] >> 8 * (big_endian ? unit_size - 1 - k : k));
+		}
+	}
+
+	return ret;
+}
+
+// Encode s with every buffer size (including ones smaller than a character), a
+// character at a time with put() and in blocks with encode_n(). Whatever has reached
+// the stream has to be the start of the encoding and no more than a buffer short of
+// everything encoded, flush() half way has to write everything so far, and the rest
+// has to be written when the encoder is destroyed. Then it's decoded again.
+template<class encoder_type, class decoder_type>
+void test_buffers(const char* name, const chars& s, const string& expect)
+{
+	const size_t buffer_sizes[] = { 1, 4, 5, 7, 64, 4096, unicode::basic_encoder::default_buffer_size };
+	const size_t block_sizes[] = { 0, 1, 3, 100, 2500 }; // 0 for put().
+	chars first_half(s.begin(), s.begin() + s.size() / 2);
+	string expect_half;
+
+	{
+		ostringstream out;
+		unicode::specific_uostream<encoder_type> us(&out);
+
+		for(size_t i=0; i < first_half.size(); ++i)
+			us.put(first_half[i]);
+
+		us.flush();
+		expect_half = out.str();
+	}
+
+	int cases = 0, failed = 0, printed = 0;
+
+	for(size_t i=0; i < sizeof(buffer_sizes) / sizeof(buffer_sizes[0]); ++i)
+	{
+		for(size_t j=0; j < sizeof(block_sizes) / sizeof(block_sizes[0]); ++j)
+		{
+			ostringstream what;
+			what << "buffer size " << buffer_sizes[i] << ", ";
+
+			if(block_sizes[j])
+				what << "blocks of " << block_sizes[j];
+			else
+				what << "put()";
+
+			ostringstream out;
+			string wrong;
+
+			{
+				encoder_type enc(&out, buffer_sizes[i]);
+				unicode::uostream<encoder_type> us(&enc);
+
+				for(size_t k=0; k < s.size(); )
+				{
+					size_t qty = block_sizes[j] ? block_sizes[j] : 1;
+
+					if(k < first_half.size() && k + qty > first_half.size())
+						qty = first_half.size() - k;
+					else if(qty > s.size() - k)
+						qty = s.size() - k;
+
+					if(block_sizes[j])
+						enc.encode_n(&s[k], qty);
+					else
+						us.put(s[k]);
+
+					k += qty;
+
+					string so_far = out.str();
+
+					if(wrong.empty() && (expect.compare(0, so_far.size(), so_far) || so_far.size() > expect.size()))
+						wrong = "what reached the stream isn't the start of the encoding";
+
+					if(k == first_half.size())
+					{
+						us.flush();
+
+						if(wrong.empty() && out.str() != expect_half)
+							wrong = "flush() didn't write everything so far";
+					}
+				}
+
+				if(wrong.empty() && out.str() != expect && out.str().size() + (buffer_sizes[i] < 4 ? 4 : buffer_sizes[i]) < expect.size())
+					wrong = "more than a buffer is waiting to be written";
+			} // Destroying the encoder writes the rest.
+
+			if(wrong.empty() && out.str() != expect)
+				wrong = "the rest wasn't written when the encoder was destroyed";
+
+			if(wrong.empty())
+			{
+				istringstream in(out.str());
+				unicode::specific_uistream<decoder_type> us(&in);
+				chars got;
+
+				for(boost::int_fast32_t ch; (ch = us.get()) != EOF; )
+					got.push_back((boost::uint32_t)ch);
+
+				if(got != s)
+					wrong = "didn't decode back to what was encoded";
+			}
+
+			++cases;
+
+			if(!wrong.empty())
+			{
+				++failed;
+				fail(printed, name, what.str() + ": " + wrong);
+			}
+		}
+	}
+
+	report(name, cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// Statistics
+//--------------------------------------------------------------------------------
+
+#ifndef BOOST_UNICODE_ENABLE_STATS
+// Without BOOST_UNICODE_ENABLE_STATS, decoders and encoders have no counters in them.
+BOOST_STATIC_ASSERT(sizeof(unicode::utf8_decoder) < sizeof(unicode::stream_stats));
+BOOST_STATIC_ASSERT(sizeof(unicode::utf8_encoder) < sizeof(unicode::stream_stats));
+#endif
+
+// Decode text with two malformed sequences (one a surrogate) from a pipe, and encode
+// it again with a small buffer, and check the counters: all zeros unless they're
+// compiled in, and then what was decoded and encoded.
+void test_stats()
+{
+	int cases = 0, failed = 0, printed = 0;
+	chars s = random_text(3000);
+	string bytes = to_utf8(chars(s.begin(), s.begin() + 1500)) + "\xFF" + to_utf8(chars(s.begin() + 1500, s.end())) + "\xED\xA0\x80";
+
+	pipe_buf pb(bytes);
+	std::istream in(&pb);
+	unicode::utf8_uistream us(&in);
+	ostringstream out;
+	unicode::utf8_uostream os(&out, 64);
+
+	for(boost::int_fast32_t ch; (ch = us.get()) != EOF; )
+		os.put(ch);
+
+	os.flush();
+
+	unicode::stream_stats in_stats = us.stats(), out_stats = os.stats();
+	ostringstream what;
+	what << "bytes_in " << in_stats.bytes_in << ", code_points_in " << in_stats.code_points_in << ", replacements " << in_stats.replacements
+		<< ", surrogate_errors " << in_stats.surrogate_errors << ", refills " << in_stats.refills << ", bytes_out " << out_stats.bytes_out
+		<< ", code_points_out " << out_stats.code_points_out << ", writes " << out_stats.writes;
+
+#ifdef BOOST_UNICODE_ENABLE_STATS
+	const char* name = "stats";
+	size_t written = out.str().size();
+
+	bool ok = in_stats.bytes_in == bytes.size() && in_stats.code_points_in == s.size() + 2 && in_stats.replacements == 2
+		&& in_stats.surrogate_errors == 1 && in_stats.refills && in_stats.refills <= bytes.size() / 7 + 1
+		&& out_stats.bytes_out == written && out_stats.code_points_out == s.size() + 2
+		&& out_stats.writes >= written / 64 && out_stats.writes <= written / 61 + 1;
+#else
+	const char* name = "stats (compiled out)";
+
+	bool ok = !in_stats.bytes_in && !in_stats.code_points_in && !in_stats.replacements && !in_stats.surrogate_errors && !in_stats.refills
+		&& !out_stats.bytes_out && !out_stats.code_points_out && !out_stats.writes;
+#endif
+
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+	what << ", decode_seconds " << in_stats.decode_seconds << ", io_seconds " << in_stats.io_seconds << ", encode_seconds " << out_stats.encode_seconds;
+	ok = ok && in_stats.decode_seconds > 0 && in_stats.io_seconds > 0 && out_stats.encode_seconds > 0;
+#else
+	ok = ok && !in_stats.decode_seconds && !in_stats.io_seconds && !out_stats.encode_seconds && !out_stats.io_seconds;
+#endif
+
+	++cases;
+
+	if(!ok)
+	{
+		++failed;
+		fail(printed, name, what.str());
+	}
+
+	// Adding up.
+	unicode::stream_stats total = in_stats;
+	total += out_stats;
+	++cases;
+
+	if(total.bytes_in != in_stats.bytes_in || total.bytes_out != out_stats.bytes_out || total.refills != in_stats.refills || total.writes != out_stats.writes)
+	{
+		++failed;
+		fail(printed, name, "operator+=");
+	}
+
+	report(name, cases, failed);
+}
+
+int main()
+{
+	test_count_advance();
+	test_ignore();
+	test_policies<utf8_with>("UTF-8 errors", utf8_cases, sizeof(utf8_cases) / sizeof(utf8_cases[0]));
+	test_policies<utf16le_with>("UTF-16LE errors", utf16le_cases, sizeof(utf16le_cases) / sizeof(utf16le_cases[0]));
+	test_policies<utf32le_with>("UTF-32LE errors", utf32le_cases, sizeof(utf32le_cases) / sizeof(utf32le_cases[0]));
+	test_error_offsets();
+	test_stats();
+
+	chars text = random_text(6000);
+	test_buffers<unicode::utf8_encoder, unicode::utf8_decoder>("utf8_encoder buffers", text, to_utf8(text));
+	test_buffers<unicode::utf16le_encoder, unicode::utf16le_decoder>("utf16le_encoder buffers", text, encode_units(text, 2, false));
+	test_buffers<unicode::utf16be_encoder, unicode::utf16be_decoder>("utf16be_encoder buffers", text, encode_units(text, 2, true));
+	test_buffers<unicode::utf32le_encoder, unicode::utf32le_decoder>("utf32le_encoder buffers", text, encode_units(text, 4, false));
+	test_buffers<unicode::utf32be_encoder, unicode::utf32be_decoder>("utf32be_encoder buffers", text, encode_units(text, 4, true));
+
+	return failures() ? 1 : 0;
+}
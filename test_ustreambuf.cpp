@@ -0,0 +1,274 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Writes and reads text through u16streambuf and u32streambuf with buffers small
+// enough that characters, and UTF-16 surrogate pairs, are cut by their ends: a unit at
+// a time, in chunks smaller and bigger than the buffer, flushing along the way.
+// Needs char16_t and char32_t (C++11).
+//
+//	test_ustreambuf
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ustreambuf.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+#ifdef BOOST_UNICODE_HAS_USTREAMBUF
+
+typedef vector<boost::uint32_t> chars;
+
+const size_t buffer_sizes[] = { 2, 3, 5, 64, 4096 };
+const size_t chunk_sizes[] = { 1, 2, 7, 100, 5000 }; // Besides a unit at a time with put() or get().
+
+// ASCII, BMP characters and characters outside it, which are surrogate pairs in UTF-16.
+chars sample_text()
+{
+	const boost::uint32_t pattern[] = { 0x41, 0x1F600, 0xE9, 0x10348, 0x10348, 0x65E5, 0x0A, 0x1F44D, 0x62 };
+	const size_t qty = sizeof(pattern) / sizeof(pattern[0]);
+	chars ret;
+
+	for(size_t i=0; i < 3000; ++i)
+		ret.push_back(pattern[(i * 7 + i / qty) % qty]);
+
+	return ret;
+}
+
+// s as UTF-32 or UTF-16 code units.
+void to_units(const chars& s, basic_string<char32_t>& out)
+{
+	out.assign(s.begin(), s.end());
+}
+
+void to_units(const chars& s, basic_string<char16_t>& out)
+{
+	out.clear();
+
+	for(size_t i=0; i < s.size(); ++i)
+	{
+		if(s[i] <= 0xFFFF)
+			out += (char16_t)s[i];
+		else
+		{
+			out += (char16_t)(((s[i] - 0x10000) >> 10) + 0xD800);
+			out += (char16_t)(((s[i] - 0x10000) & 0x3FF) + 0xDC00);
+		}
+	}
+}
+
+// The characters in the first qty units, leaving out a high surrogate at the end.
+template<class tpl_char>
+chars from_units(const basic_string<tpl_char>& units, size_t qty)
+{
+	chars ret;
+
+	for(size_t i=0; i < qty; ++i)
+	{
+		boost::uint32_t c = units[i];
+
+		if(c >= 0xD800 && c <= 0xDBFF)
+		{
+			if(i + 1 == qty)
+				break;
+
+			c = ((c - 0xD800) << 10) + (units[++i] - 0xDC00) + 0x10000;
+		}
+
+		ret.push_back(c);
+	}
+
+	return ret;
+}
+
+// Write the units of s through a basic_ustreambuf<tpl_char> with every buffer size,
+// in chunks of every size (or a unit at a time with put()), and check the UTF-8. Half
+// way through, flush() has to have written everything so far.
+template<class tpl_char>
+void test_write(const char* name, const chars& s)
+{
+	basic_string<tpl_char> units;
+	to_units(s, units);
+	string expect = to_utf8(s);
+
+	// Flush half way, just after a high surrogate if there are any.
+	size_t half = units.size() / 2;
+
+	while(half < units.size() && (units[half - 1] < 0xD800 || units[half - 1] > 0xDBFF))
+		++half;
+
+	if(half == units.size())
+		half = units.size() / 2;
+
+	string expect_half = to_utf8(from_units(units, half));
+
+	int cases = 0, failed = 0, printed = 0;
+
+	for(size_t i=0; i < sizeof(buffer_sizes) / sizeof(buffer_sizes[0]); ++i)
+	{
+		for(size_t j=0; j <= sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); ++j)
+		{
+			size_t chunk = j ? chunk_sizes[j - 1] : 0;
+			ostringstream what;
+			what << "buffer size " << buffer_sizes[i] << ", ";
+
+			if(chunk)
+				what << "chunks of " << chunk;
+			else
+				what << "put()";
+
+			ostringstream out;
+			bool ok = true;
+
+			{
+				unicode::utf8_encoder enc(&out, 16);
+				unicode::basic_ustreambuf<tpl_char> sb(0, &enc, buffer_sizes[i]);
+				basic_ostream<tpl_char> os(&sb);
+
+				for(size_t k=0; k < units.size(); )
+				{
+					size_t qty = chunk ? chunk : 1;
+
+					if(k < half && k + qty > half)
+						qty = half - k;
+					else if(qty > units.size() - k)
+						qty = units.size() - k;
+
+					if(chunk)
+						os.write(units.data() + k, qty);
+					else
+						os.put(units[k]);
+
+					k += qty;
+
+					if(k == half)
+					{
+						// Everything but the high surrogate, which waits to be paired.
+						os.flush();
+						ok = out.str() == expect_half;
+					}
+				}
+
+				ok = ok && os.good();
+			} // The streambuf gives the rest to the encoder, and the encoder writes it out.
+
+			++cases;
+
+			if(!ok || out.str() != expect)
+			{
+				++failed;
+				fail(printed, name, what.str() + (ok ? ": the UTF-8 doesn't match" : ": flush() didn't write everything so far"));
+			}
+		}
+	}
+
+	report(name, cases, failed);
+}
+
+// Read the UTF-8 of s through a basic_ustreambuf<tpl_char> with every buffer size, in
+// chunks of every size (or a unit at a time with get()), and check the units.
+template<class tpl_char>
+void test_read(const char* name, const chars& s)
+{
+	basic_string<tpl_char> expect;
+	to_units(s, expect);
+
+	int cases = 0, failed = 0, printed = 0;
+
+	for(size_t i=0; i < sizeof(buffer_sizes) / sizeof(buffer_sizes[0]); ++i)
+	{
+		for(size_t j=0; j <= sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); ++j)
+		{
+			size_t chunk = j ? chunk_sizes[j - 1] : 0;
+			ostringstream what;
+			what << "buffer size " << buffer_sizes[i] << ", ";
+
+			if(chunk)
+				what << "chunks of " << chunk;
+			else
+				what << "get()";
+
+			istringstream in(to_utf8(s));
+			unicode::utf8_decoder dec(&in);
+			unicode::basic_ustreambuf<tpl_char> sb(&dec, 0, buffer_sizes[i]);
+			basic_istream<tpl_char> is(&sb);
+			basic_string<tpl_char> got;
+
+			if(chunk)
+			{
+				vector<tpl_char> buf(chunk);
+
+				while(is.read(&buf[0], chunk) || is.gcount())
+					got.append(&buf[0], (size_t)is.gcount());
+			}
+			else
+			{
+				for(typename basic_istream<tpl_char>::int_type c; (c = is.get()) != char_traits<tpl_char>::eof(); )
+					got += (tpl_char)c;
+			}
+
+			++cases;
+
+			if(got != expect)
+			{
+				++failed;
+				fail(printed, name, what.str() + ": didn't read back what was written");
+			}
+		}
+	}
+
+	report(name, cases, failed);
+}
+
+// Unpaired surrogates are written as U+FFFD, but only once it's known that they're
+// unpaired (at the end, or when what follows isn't a low surrogate).
+void test_unpaired()
+{
+	int failed = 0, printed = 0;
+	const char16_t units[] = { 0x61, 0xDC00, 0x62, 0xD800, 0x63, 0xD83D, 0xDE00, 0xD800 };
+
+	ostringstream out;
+
+	{
+		unicode::utf8_encoder enc(&out);
+		unicode::u16streambuf sb(0, &enc, 3);
+		basic_ostream<char16_t> os(&sb);
+		os.write(units, sizeof(units) / sizeof(units[0]));
+	}
+
+	if(out.str() != "a\xEF\xBF\xBD" "b\xEF\xBF\xBD" "c\xF0\x9F\x98\x80\xEF\xBF\xBD")
+	{
+		++failed;
+		fail(printed, "u16streambuf", "unpaired surrogates");
+	}
+
+	report("u16streambuf surrogates", 1, failed);
+}
+
+int main()
+{
+	chars s = sample_text();
+
+	test_write<char32_t>("u32streambuf write", s);
+	test_write<char16_t>("u16streambuf write", s);
+	test_read<char32_t>("u32streambuf read", s);
+	test_read<char16_t>("u16streambuf read", s);
+	test_unpaired();
+
+	return failures() ? 1 : 0;
+}
+
+#else
+
+int main()
+{
+	std::printf("%-30s skipped (no char16_t and char32_t)\n", "ustreambuf");
+	return 0;
+}
+
+#endif
@@ -0,0 +1,716 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks basic_ustring, ustring_view and shared_ustring, and searching and splitting
+// UTF-8.
+//
+//	test_ustring
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ustream.hpp"
+#include "ustring.h"
+#include "ustring_view.hpp"
+#include "grapheme.hpp"
+#include "split.hpp"
+#include "shared_ustring.hpp"
+#include "test_util.hpp"
+
+using namespace std;
+using namespace unicode_test;
+
+typedef unicode::basic_ustring<unicode::utf8_encoder, unicode::utf8_decoder> test_string;
+typedef vector<boost::uint32_t> chars;
+
+// Characters of 1 to 4 bytes in UTF-8, over and over, qty of them.
+chars sample_text(size_t qty)
+{
+	const boost::uint32_t pattern[] = { 0x61, 0xE9, 0x65E5, 0x1F600, 0x62, 0x0A, 0x10348, 0x03B1, 0x63 };
+	chars ret;
+
+	for(size_t i=0; i < qty; ++i)
+		ret.push_back(pattern[(i * 5 + i / 9) % (sizeof(pattern) / sizeof(pattern[0]))]);
+
+	return ret;
+}
+
+//--------------------------------------------------------------------------------
+// compare()
+//--------------------------------------------------------------------------------
+
+struct compare_case
+{
+	const char* a;
+	const char* b;
+	int expect;
+};
+
+// A string sorts after its prefixes, and characters compare by code point.
+const compare_case compare_cases[] = {
+	{ "", "", 0 },
+	{ "0061 0062 0063", "0061 0062 0063", 0 },
+	{ "", "0061", -1 },
+	{ "0061 0062", "0061 0062 0063", -1 },
+	{ "0061 0062 0063", "0061 0062", 1 },
+	{ "0061 0062 0063", "0061 0062 0064", -1 },
+	{ "0061 0062 0064", "0061 0062 0063", 1 },
+	{ "0061 0062 0063", "0062", -1 },
+	{ "007A", "00E9", -1 },
+	{ "00E9", "00E9 0301", -1 },
+	{ "FFFD", "1F600", -1 },
+};
+
+// A string of the code points in hex.
+test_string from_hex(const char* hex)
+{
+	vector<boost::uint32_t> chars = parse_hex(hex);
+	test_string ret;
+
+	for(size_t i=0; i < chars.size(); ++i)
+		ret.append((unicode::utf32_unit)chars[i]);
+
+	return ret;
+}
+
+void test_compare()
+{
+	int failed = 0, printed = 0;
+	const int qty = sizeof(compare_cases) / sizeof(compare_cases[0]);
+
+	for(int i=0; i < qty; ++i)
+	{
+		const compare_case& c = compare_cases[i];
+		test_string x = from_hex(c.a), y = from_hex(c.b);
+		int got = x.compare(y);
+
+		if(got != c.expect || (x == y) != (c.expect == 0) || (x < y) != (c.expect < 0) || (x > y) != (c.expect > 0))
+		{
+			++failed;
+			fail(printed, "compare", string("[") + c.a + "] with [" + c.b + "]");
+		}
+	}
+
+	report("compare", qty, failed);
+}
+
+//--------------------------------------------------------------------------------
+// ustring_view
+//--------------------------------------------------------------------------------
+
+// Iterators from begin() know where the view ends and skip ahead in blocks; ones made
+// from a pointer step a character at a time. Both have to land on the same character
+// for every start and distance, including past the 64 byte blocks.
+void test_view_iterators()
+{
+	int cases = 0, failed = 0, printed = 0;
+	chars s = sample_text(150);
+	vector<size_t> offsets;
+	string bytes = to_utf8(s, &offsets);
+	unicode::ustring_view v(bytes);
+
+	for(size_t first=0; first < 5; ++first)
+	{
+		unicode::ustring_view::iterator b = v.begin(), p(v.data());
+
+		for(size_t i=0; i < first; ++i)
+			++b, ++p;
+
+		for(size_t qty=0; first + qty <= s.size(); ++qty)
+		{
+			const unicode::utf8_unit* expect = v.data() + offsets[first + qty];
+			++cases;
+
+			if((b + (int)qty).base() != expect || (p + (int)qty).base() != expect)
+			{
+				++failed;
+				ostringstream what;
+				what << "operator+(" << qty << ") from character " << first;
+				fail(printed, "ustring_view::iterator", what.str());
+			}
+		}
+
+		// Past the end, an iterator that knows the end stops there.
+		++cases;
+
+		if((b + (int)(s.size() + 5)) != v.end())
+		{
+			++failed;
+			fail(printed, "ustring_view::iterator", "operator+ past the end");
+		}
+	}
+
+	report("ustring_view::iterator", cases, failed);
+}
+
+// size(), at(), substr() and find() of a character of each length.
+void test_view()
+{
+	int cases = 0, failed = 0, printed = 0;
+	chars s = sample_text(40);
+	vector<size_t> offsets;
+	string bytes = to_utf8(s, &offsets);
+	unicode::ustring_view v(bytes);
+
+	++cases;
+
+	if(v.size() != (int)s.size() || v.bytes() != bytes.size())
+	{
+		++failed;
+		fail(printed, "ustring_view", "size() or bytes()");
+	}
+
+	for(size_t pos=0; pos <= s.size(); ++pos)
+	{
+		if(pos < s.size())
+		{
+			++cases;
+
+			if(*v.at((int)pos) != s[pos])
+			{
+				++failed;
+				fail(printed, "ustring_view", "at()");
+			}
+
+			// The first occurrence of the character.
+			size_t first = find(s.begin(), s.end(), s[pos]) - s.begin();
+			++cases;
+
+			if(v.find((unicode::utf32_unit)s[pos]).base() != v.data() + offsets[first])
+			{
+				++failed;
+				fail(printed, "ustring_view", "find() of a character");
+			}
+		}
+
+		// Up to the end and past it.
+		for(size_t qty=0; qty < 5; ++qty)
+		{
+			size_t end = pos + qty < s.size() ? pos + qty : s.size();
+			unicode::ustring_view sub = v.substr((int)pos, (int)qty);
+			++cases;
+
+			if(sub.data() != v.data() + offsets[pos] || sub.bytes() != offsets[end] - offsets[pos] || sub.size() != (int)(end - pos))
+			{
+				++failed;
+				ostringstream what;
+				what << "substr(" << pos << ", " << qty << ")";
+				fail(printed, "ustring_view", what.str());
+			}
+		}
+	}
+
+	++cases;
+
+	if(v.find((unicode::utf32_unit)0x10FFFF) != v.end())
+	{
+		++failed;
+		fail(printed, "ustring_view", "find() of a character that isn't there");
+	}
+
+	report("ustring_view", cases, failed);
+}
+
+// substr_graphemes() keeps accents with their letters, and stops at the end.
+void test_substr_graphemes()
+{
+	int failed = 0, printed = 0;
+	unicode::ustring_view v("e\xCC\x81" "a" "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7" "b\xCC\x81\xCC\x82");
+	const char* const expect[] = { "e\xCC\x81", "a", "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7", "b\xCC\x81\xCC\x82", "" };
+	const int qty = sizeof(expect) / sizeof(expect[0]);
+
+	for(int pos=0; pos < qty; ++pos)
+	{
+		if(unicode::substr_graphemes(v, pos, 1) != unicode::ustring_view(expect[pos]))
+		{
+			++failed;
+			fail(printed, "substr_graphemes", "one cluster");
+		}
+	}
+
+	if(unicode::substr_graphemes(v, 1, 10) != unicode::ustring_view(v.data() + 3, v.bytes() - 3))
+	{
+		++failed;
+		fail(printed, "substr_graphemes", "past the end");
+	}
+
+	report("substr_graphemes", qty + 1, failed);
+}
+
+// read_view() with every block size from the smallest that holds any character up
+// past the length of the text: each view has to be whole characters, and together
+// they have to be the text, with the characters split by the end of a block carried
+// over to the next.
+void test_read_view()
+{
+	int cases = 0, failed = 0, printed = 0;
+	string bytes = to_utf8(sample_text(300));
+
+	for(size_t size=4; size < 80; ++size)
+	{
+		istringstream in(bytes);
+		vector<unicode::utf8_unit> buf(size);
+		size_t carried = 0, blocks = 0;
+		string got;
+		bool whole = true;
+
+		for(unicode::ustring_view v; !(v = unicode::read_view(in, buf, carried)).empty(); ++blocks)
+		{
+			const unicode::utf8_unit* p = v.data();
+			const unicode::utf8_unit* e = p + v.bytes();
+
+			// Starts with a lead byte, and ends with a whole character.
+			if((*p & 0xC0) == 0x80 || unicode::utf8_count(p, e) != (size_t)v.size())
+				whole = false;
+
+			const unicode::utf8_unit* lead = e - 1;
+
+			while((*lead & 0xC0) == 0x80)
+				--lead;
+
+			if(lead + unicode::table_extra_bytes[*lead] + 1 != e)
+				whole = false;
+
+			got.append((const char*)p, v.bytes());
+		}
+
+		++cases;
+
+		if(got != bytes || !whole || blocks < bytes.size() / size)
+		{
+			++failed;
+			ostringstream what;
+			what << "block size " << size << (whole ? ": didn't read back the text" : ": a view ends with part of a character");
+			fail(printed, "read_view", what.str());
+		}
+	}
+
+	// An empty buffer reads nothing.
+	istringstream in(bytes);
+	vector<unicode::utf8_unit> buf;
+	size_t carried = 0;
+	++cases;
+
+	if(!unicode::read_view(in, buf, carried).empty() || in.tellg() != 0)
+	{
+		++failed;
+		fail(printed, "read_view", "an empty buffer");
+	}
+
+	report("read_view", cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// utf8_search and utf8_search_last
+//--------------------------------------------------------------------------------
+
+// Search text (from first) for needle both ways and compare with std::search and
+// std::find_end.
+void check_search(const string& text, size_t first, const string& needle, int& cases, int& failed, int& printed)
+{
+	const boost::uint8_t* t = (const boost::uint8_t*)text.data();
+	const boost::uint8_t* n = (const boost::uint8_t*)needle.data();
+	const boost::uint8_t* last = t + text.size();
+
+	const boost::uint8_t* got = unicode::utf8_search(t + first, last, n, n + needle.size());
+	const boost::uint8_t* got_last = unicode::utf8_search_last(t + first, last, n, n + needle.size());
+	const boost::uint8_t* expect = std::search(t + first, last, n, n + needle.size());
+	const boost::uint8_t* expect_last = std::find_end(t + first, last, n, n + needle.size());
+	++cases;
+
+	if(got != expect || got_last != expect_last)
+	{
+		++failed;
+		ostringstream what;
+		what << "needle of " << needle.size() << " bytes in " << text.size() - first << " bytes: found at "
+			<< got - t << " and " << got_last - t << ", expected " << expect - t << " and " << expect_last - t;
+		fail(printed, "utf8_search", what.str());
+	}
+}
+
+// Needles of each length either side of the 16 byte blocks and of the length where
+// Two-Way takes over, put in the text at offsets around the blocks (so matches start
+// at 15, 16 and 17 and end either side of a block), in text starting at different
+// alignments. Also the empty needle, needles longer than the text, and periodic
+// needles in periodic text, where the first and last bytes match nearly everywhere.
+void test_search()
+{
+	int cases = 0, failed = 0, printed = 0;
+	string filler = to_utf8(sample_text(40));
+	string other = to_utf8(sample_text(60)).substr(7);
+
+	const size_t lengths[] = { 0, 1, 2, 3, 4, 15, 16, 17, 31, 32, 33, 34, 40, 64, 65 };
+	const size_t places[] = { 0, 1, 14, 15, 16, 17, 18, 31, 32, 33, 47, 48, 49 };
+
+	for(size_t i=0; i < sizeof(lengths) / sizeof(lengths[0]); ++i)
+	{
+		string needle = other.substr(0, lengths[i]);
+
+		for(size_t j=0; j < sizeof(places) / sizeof(places[0]); ++j)
+		{
+			for(size_t first=0; first < 4; ++first)
+			{
+				// The needle once, then twice (so the last match differs from the first).
+				string text = filler.substr(0, first + places[j]) + needle + filler.substr(0, 20);
+				string twice = text + needle + filler.substr(0, 3);
+
+				check_search(text, first, needle, cases, failed, printed);
+				check_search(twice, first, needle, cases, failed, printed);
+
+				// Near misses, which only differ from the needle in its second byte or its
+				// second to last.
+				if(needle.size() >= 3)
+				{
+					const size_t inside[] = { 1, needle.size() - 2 };
+
+					for(size_t k=0; k < 2; ++k)
+					{
+						string near = needle;
+						near[inside[k]] = 'x';
+						check_search(filler.substr(0, first + places[j]) + near + filler.substr(0, 20), first, needle, cases, failed, printed);
+					}
+				}
+			}
+		}
+
+		// Not there, and longer than the text.
+		check_search(filler, 0, needle + "x", cases, failed, printed);
+		check_search(needle.substr(0, needle.size() / 2), 0, needle, cases, failed, printed);
+	}
+
+	// Periodic needles (a run of a's ending in b, ab's ending in c, and the same with
+	// multi-byte characters) in text of the same period, where the first and last bytes
+	// match nearly everywhere: without the end, with it, and with it twice.
+	const char* const periods[] = { "a", "ab", "\xC3\xA9", "a\xE6\x97\xA5" };
+	const char* const ends[] = { "b", "c", "\xC3\xA8", "a" };
+
+	for(size_t i=0; i < sizeof(periods) / sizeof(periods[0]); ++i)
+	{
+		for(size_t repeats=1; repeats < 50; repeats += repeats < 20 ? 1 : 7)
+		{
+			string needle;
+
+			for(size_t k=0; k < repeats; ++k)
+				needle += periods[i];
+
+			needle += ends[i];
+
+			for(size_t text_repeats=repeats; text_repeats < repeats + 40; text_repeats += 3)
+			{
+				string text;
+
+				for(size_t k=0; k < text_repeats; ++k)
+					text += periods[i];
+
+				check_search(text, 0, needle, cases, failed, printed);
+				check_search(text + ends[i], 0, needle, cases, failed, printed);
+				check_search(text + ends[i] + text + ends[i] + text, 1, needle, cases, failed, printed);
+			}
+		}
+	}
+
+	report("utf8_search", cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// split and split_reader
+//--------------------------------------------------------------------------------
+
+// The fields of text between occurrences of delim, found the way std::string::find
+// finds them.
+vector<string> expect_fields(const string& text, const string& delim)
+{
+	vector<string> ret;
+	size_t p = 0;
+
+	for(size_t q; (q = text.find(delim, p)) != string::npos; p = q + delim.size())
+		ret.push_back(text.substr(p, q - p));
+
+	ret.push_back(text.substr(p));
+	return ret;
+}
+
+string field_string(const unicode::ustring_view& v)
+{
+	return string((const char*)v.data(), v.bytes());
+}
+
+// Spaces and ideographic spaces.
+struct is_space
+{
+	bool operator()(unicode::utf32_unit c) const
+	{
+		return c == ' ' || c == 0x3000;
+	}
+};
+
+// Split text with split() and with a split_reader reading it in blocks of every size up
+// to 17 bytes (so delimiters and characters are cut by the ends of blocks everywhere)
+// and in bigger blocks, and compare the fields with expect.
+template<class delimiter_type>
+void check_split(const string& text, const delimiter_type& delim, const vector<string>& expect, int& cases, int& failed, int& printed)
+{
+	vector<string> got;
+	unicode::split_range<delimiter_type> fields(text, delim);
+
+	for(typename unicode::split_range<delimiter_type>::iterator i=fields.begin(); i != fields.end(); ++i)
+		got.push_back(field_string(*i));
+
+	++cases;
+
+	if(got != expect)
+	{
+		++failed;
+		fail(printed, "split", "\"" + text + "\"");
+	}
+
+	const size_t big_blocks[] = { 64, 65536 };
+
+	for(size_t block=1; block < 20; ++block)
+	{
+		size_t size = block < 18 ? block : big_blocks[block - 18];
+		istringstream in(text);
+		unicode::split_reader<delimiter_type> reader(in, delim, size);
+		unicode::ustring_view field;
+		got.clear();
+
+		while(reader.next(field))
+			got.push_back(field_string(field));
+
+		++cases;
+
+		if(got != expect || reader.next(field))
+		{
+			++failed;
+			ostringstream what;
+			what << "\"" << text << "\" in blocks of " << size;
+			fail(printed, "split_reader", what.str());
+		}
+	}
+}
+
+// Random text made of pieces, which include the delimiter or parts of it.
+string random_pieces(const char* const* pieces, size_t qty)
+{
+	string ret;
+	size_t n = std::rand() % 40;
+
+	for(size_t i=0; i < n; ++i)
+		ret += pieces[std::rand() % qty];
+
+	return ret;
+}
+
+// Splitting at characters of each UTF-8 length, at strings that partly match the text
+// around them, and at characters a predicate picks. Each is tried on text that's empty,
+// is nothing but delimiters, or starts or ends with one (so has empty fields), and on
+// random text.
+void test_split()
+{
+	int cases = 0, failed = 0, printed = 0;
+	const char* const texts[] = { "", "D", "DD", "DaD", "aDDb", "aD", "Da", "a", "\xE6\x97\xA5\xE6\x9C\xAC" "DD\xF0\x9F\x98\x80" };
+	const size_t text_qty = sizeof(texts) / sizeof(texts[0]);
+
+	struct delimiter_case
+	{
+		const char* text;
+		bool is_char;
+	};
+
+	const delimiter_case delimiters[] = {
+		{ ",", true },
+		{ "\xC3\xA9", true },
+		{ "\xE6\x97\xA5", true },
+		{ "\xF0\x9F\x98\x80", true },
+		{ "::", false },
+		{ "\xE6\x97\xA5\xE6\x9C\xAC", false },
+		{ "a\xF0\x9F\x98\x80", false },
+		{ "\xC3\xA9\xC3\xA9\xC3\xA9", false },
+	};
+
+	std::srand(1);
+
+	for(size_t i=0; i < sizeof(delimiters) / sizeof(delimiters[0]); ++i)
+	{
+		string delim = delimiters[i].text;
+		unicode::ustring_view delim_view(delimiters[i].text);
+		string partial = to_utf8(chars(1, *delim_view.begin()));
+		const char* const pieces[] = { "a", "b", "\xC3\xA9", "\xE6\x97\xA5", "\xF0\x9F\x98\x80", ":", delimiters[i].text, partial.c_str() };
+		vector<string> samples;
+
+		for(size_t j=0; j < text_qty; ++j)
+		{
+			string s = texts[j];
+
+			for(size_t d; (d = s.find('D')) != string::npos; )
+				s.replace(d, 1, delim);
+
+			samples.push_back(s);
+		}
+
+		for(int j=0; j < 200; ++j)
+			samples.push_back(random_pieces(pieces, sizeof(pieces) / sizeof(pieces[0])));
+
+		for(size_t j=0; j < samples.size(); ++j)
+		{
+			vector<string> expect = expect_fields(samples[j], delim);
+
+			if(delimiters[i].is_char)
+				check_split(samples[j], unicode::char_delimiter(*delim_view.begin()), expect, cases, failed, printed);
+			else
+				check_split(samples[j], unicode::string_delimiter(delim_view), expect, cases, failed, printed);
+		}
+	}
+
+	// The fields between spaces, whichever kind of space separates them.
+	const char* const pieces[] = { "a", "b", "\xC3\xA9", "\xE6\x97\xA5", " ", "\xE3\x80\x80" };
+
+	for(int i=0; i < 200; ++i)
+	{
+		string text = random_pieces(pieces, sizeof(pieces) / sizeof(pieces[0]));
+		string spaces = text;
+
+		for(size_t d; (d = spaces.find("\xE3\x80\x80")) != string::npos; )
+			spaces.replace(d, 3, " ");
+
+		check_split(text, unicode::predicate_delimiter<is_space>(), expect_fields(spaces, " "), cases, failed, printed);
+	}
+
+	// A field many times longer than the block.
+	string text = "a," + to_utf8(sample_text(300)) + ",b";
+	check_split(text, unicode::char_delimiter(','), expect_fields(text, ","), cases, failed, printed);
+
+	report("split, split_reader", cases, failed);
+}
+
+//--------------------------------------------------------------------------------
+// shared_ustring
+//--------------------------------------------------------------------------------
+
+// The characters of a shared_ustring.
+chars shared_chars(const unicode::shared_ustring& str)
+{
+	chars ret;
+
+	for(unicode::shared_ustring::iterator i=str.begin(); i != str.end(); ++i)
+		ret.push_back(*i);
+
+	return ret;
+}
+
+// Copies and substrings share the text rather than copying it, and substrings are
+// still good once the string they came from, and all its copies, are gone.
+void test_shared()
+{
+	int cases = 0, failed = 0, printed = 0;
+	chars s = sample_text(100);
+	vector<size_t> offsets;
+	string bytes = to_utf8(s, &offsets);
+
+	vector<unicode::shared_ustring> subs;
+	vector<chars> sub_models;
+
+	{
+		unicode::shared_ustring str(bytes);
+		unicode::shared_ustring copy = str;
+		unicode::shared_ustring assigned;
+		assigned = copy;
+
+		++cases;
+
+		if(str.data() == (const unicode::utf8_unit*)bytes.data() || copy.data() != str.data() || assigned.data() != str.data()
+			|| str.use_count() != 3 || str.bytes() != bytes.size() || str.size() != (int)s.size() || copy != str || shared_chars(copy) != s)
+		{
+			++failed;
+			fail(printed, "shared_ustring", "copies");
+		}
+
+		// Substrings at the ends and in the middle, of lengths up to the end.
+		const int starts[] = { 0, 1, 37, 99, 100 };
+
+		for(size_t i=0; i < sizeof(starts) / sizeof(starts[0]); ++i)
+		{
+			for(int qty=0; qty <= (int)s.size() - starts[i]; qty += qty < 5 ? 1 : 13)
+			{
+				unicode::shared_ustring sub = str.substr(starts[i], qty);
+				chars model(s.begin() + starts[i], s.begin() + starts[i] + qty);
+				++cases;
+
+				if(sub.size() != qty || shared_chars(sub) != model || (qty && sub.data() != str.data() + offsets[starts[i]])
+					|| sub.bytes() != offsets[starts[i] + qty] - offsets[starts[i]])
+				{
+					++failed;
+					ostringstream what;
+					what << "substr(" << starts[i] << ", " << qty << ")";
+					fail(printed, "shared_ustring", what.str());
+				}
+
+				subs.push_back(sub);
+				sub_models.push_back(model);
+			}
+		}
+
+		// And by iterators, and substrings of substrings.
+		unicode::shared_ustring sub = str.substr(str.view().at(10), str.view().at(60));
+		subs.push_back(sub.substr(5, 20));
+		sub_models.push_back(chars(s.begin() + 15, s.begin() + 35));
+
+		++cases;
+
+		if(shared_chars(sub) != chars(s.begin() + 10, s.begin() + 60) || sub.size() != 50 || str.use_count() != (long)subs.size() + 4)
+		{
+			++failed;
+			fail(printed, "shared_ustring", "substr(iterator, iterator)");
+		}
+	}
+
+	// Only the substrings are left.
+	for(size_t i=0; i < subs.size(); ++i)
+	{
+		++cases;
+
+		if(shared_chars(subs[i]) != sub_models[i] || subs[i].size() != (int)sub_models[i].size() || subs[i].view().bytes() != to_utf8(sub_models[i]).size())
+		{
+			++failed;
+			fail(printed, "shared_ustring", "a substring after the string is gone");
+		}
+	}
+
+	++cases;
+
+	if(subs[0].use_count() != (long)subs.size())
+	{
+		++failed;
+		fail(printed, "shared_ustring", "use_count() after the string is gone");
+	}
+
+	// Empty strings share nothing.
+	unicode::shared_ustring empty, empty_copy = empty, empty_sub = unicode::shared_ustring("").substr(0, 0);
+	++cases;
+
+	if(!empty_copy.empty() || empty_copy.size() || empty_copy.bytes() || !empty_sub.empty() || empty_sub != empty || empty.use_count())
+	{
+		++failed;
+		fail(printed, "shared_ustring", "empty strings");
+	}
+
+	report("shared_ustring", cases, failed);
+}
+
+int main()
+{
+	test_compare();
+	test_view_iterators();
+	test_view();
+	test_substr_graphemes();
+	test_read_view();
+	test_search();
+	test_split();
+	test_shared();
+
+	return failures() ? 1 : 0;
+}
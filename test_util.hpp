@@ -0,0 +1,168 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_TEST_UTIL_HPP
+#define BOOST_UNICODE_TEST_UTIL_HPP
+
+// Helpers shared by the test_*.cpp programs. Each program checks the library against
+// hand-picked cases that always run, and against the Unicode consortium's test files
+// when they've been downloaded into the directory given on the command line (ucd by
+// default). A missing test file is reported as skipped, not as a failure.
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <boost/cstdint.hpp>
+
+namespace unicode_test
+{
+	// Failures so far, which main() returns.
+	inline int& failures()
+	{
+		static int ret = 0;
+		return ret;
+	}
+
+	// Print a failed case; only the first few of each set are printed. The set's
+	// failures are counted by report().
+	inline void fail(int& printed, const char* what, const std::string& detail)
+	{
+		if(++printed <= 10)
+			std::printf("FAIL %s: %s\n", what, detail.c_str());
+	}
+
+	// Check something that isn't part of a set of cases.
+	inline void check(bool ok, const char* what)
+	{
+		if(!ok)
+		{
+			++failures();
+			std::printf("FAIL %s\n", what);
+		}
+	}
+
+	// The directory holding the test files, from the command line.
+	inline std::string data_dir(int argc, char** argv)
+	{
+		return argc > 1 ? argv[1] : "ucd";
+	}
+
+	// Open a test file, or say it's being skipped.
+	inline bool open_data(std::ifstream& in, const std::string& dir, const char* name)
+	{
+		in.open((dir + "/" + name).c_str(), std::ios::binary);
+
+		if(!in)
+			std::printf("%-30s skipped (not found in %s)\n", name, dir.c_str());
+
+		return (bool)in;
+	}
+
+	// Print a summary of one set of cases, and add its failures to the total.
+	inline void report(const char* name, int cases, int failed)
+	{
+		failures() += failed;
+		std::printf("%-30s %6d cases, %d failed\n", name, cases, failed);
+	}
+
+	// Remove a # comment and surrounding white space from a line of a test file.
+	inline std::string strip_comment(const std::string& line)
+	{
+		std::string::size_type end = line.find('#');
+		std::string ret = line.substr(0, end);
+
+		while(!ret.empty() && (ret[ret.size()-1] == ' ' || ret[ret.size()-1] == '\t' || ret[ret.size()-1] == '\r'))
+			ret.erase(ret.size()-1);
+
+		std::string::size_type begin = ret.find_first_not_of(" \t");
+		return begin == std::string::npos ? std::string() : ret.substr(begin);
+	}
+
+	// Parse space separated hex code points, e.g. "0041 030A".
+	inline std::vector<boost::uint32_t> parse_hex(const std::string& s)
+	{
+		std::vector<boost::uint32_t> ret;
+		const char* p = s.c_str();
+		char* end;
+
+		for(;;)
+		{
+			unsigned long ch = std::strtoul(p, &end, 16);
+
+			if(end == p)
+				break;
+
+			ret.push_back((boost::uint32_t)ch);
+			p = end;
+		}
+
+		return ret;
+	}
+
+	// Code points written as hex, for failure messages.
+	inline std::string to_hex(const std::vector<boost::uint32_t>& chars)
+	{
+		std::string ret;
+		char buf[16];
+
+		for(std::size_t i=0; i < chars.size(); ++i)
+		{
+			std::sprintf(buf, i ? " %04X" : "%04X", (unsigned)chars[i]);
+			ret += buf;
+		}
+
+		return ret;
+	}
+
+	// Encode code points as UTF-8. If offsets isn't null, it gets the byte offset of
+	// each character, followed by the total size.
+	inline std::string to_utf8(const std::vector<boost::uint32_t>& chars, std::vector<std::size_t>* offsets=0)
+	{
+		std::string ret;
+
+		if(offsets)
+			offsets->clear();
+
+		for(std::size_t i=0; i < chars.size(); ++i)
+		{
+			boost::uint32_t c = chars[i];
+
+			if(offsets)
+				offsets->push_back(ret.size());
+
+			if(c < 0x80)
+			{
+				ret += (char)c;
+			}
+			else if(c < 0x800)
+			{
+				ret += (char)(0xC0 | (c >> 6));
+				ret += (char)(0x80 | (c & 0x3F));
+			}
+			else if(c < 0x10000)
+			{
+				ret += (char)(0xE0 | (c >> 12));
+				ret += (char)(0x80 | ((c >> 6) & 0x3F));
+				ret += (char)(0x80 | (c & 0x3F));
+			}
+			else
+			{
+				ret += (char)(0xF0 | (c >> 18));
+				ret += (char)(0x80 | ((c >> 12) & 0x3F));
+				ret += (char)(0x80 | ((c >> 6) & 0x3F));
+				ret += (char)(0x80 | (c & 0x3F));
+			}
+		}
+
+		if(offsets)
+			offsets->push_back(ret.size());
+
+		return ret;
+	}
+}
+
+#endif
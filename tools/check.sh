@@ -0,0 +1,82 @@
+#!/bin/sh
+# (c) Copyright Emery De Nuccio 2007
+# Distributed under the Boost
+# Software License, Version 1.0. (See accompanying file
+# LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+# Build the programs at the top of the tree and run the tests, with GCC or Clang.
+# Run it from the top of the tree:
+#
+#	tools/check.sh [build directory]
+#
+# CXX and CXXFLAGS are used if they're set. Boost (with Boost.Chrono and
+# Boost.Thread built) must be where the compiler can find it. The tests also check
+# against the Unicode test files (NormalizationTest.txt, GraphemeBreakTest.txt,
+# CollationTest_SHIFTED.txt...) in UCD_TESTS (ucd by default), and skip the ones
+# that aren't there.
+
+set -e
+
+out=${1:-_check}
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2 -Wall -Wextra}
+LIBS="-lboost_chrono -lboost_thread -lpthread"
+UCD_TESTS=${UCD_TESTS:-ucd}
+
+mkdir -p "$out"
+
+# Build a program from name.cpp, called name or the second argument, with any
+# further arguments added to the compiler flags.
+build()
+{
+	src=$1
+	exe=${2:-$1}
+	shift
+	[ $# -gt 0 ] && shift
+	echo "Building $exe"
+	$CXX $CXXFLAGS "$@" -I. "$src.cpp" -o "$out/$exe" $LIBS
+}
+
+# Build and run a test program.
+run()
+{
+	build $1
+	"$out/$1" "$UCD_TESTS"
+}
+
+build bench
+
+# The stream statistics are compiled out by default, so build with them too.
+build bench bench_stats -DBOOST_UNICODE_ENABLE_STATS_TIMING
+build bench_codecs
+build bench_collate
+
+run test_properties
+run test_case_folding
+run test_display_width
+run test_breaks
+run test_normalize
+run test_codecs
+run test_convert
+# The conversions again with the tier capped, as it would be on an older machine.
+BOOST_UNICODE_CPU=sse2 "$out/test_convert"
+BOOST_UNICODE_CPU=scalar "$out/test_convert"
+run test_collate
+run test_async
+run test_ustream
+# And the stream tests with the statistics, to see that they count.
+build test_ustream test_ustream_stats -DBOOST_UNICODE_ENABLE_STATS
+"$out/test_ustream_stats"
+build test_ustream test_ustream_timing -DBOOST_UNICODE_ENABLE_STATS_TIMING
+"$out/test_ustream_timing"
+run test_ustring
+run test_rope
+run test_ustreambuf
+# The literals are encoded by constexpr functions, which need C++14.
+build test_literal test_literal -std=c++14
+"$out/test_literal"
+
+build uconv
+sh tools/test_uconv.sh "$out/uconv"
+
+echo "All checks passed"
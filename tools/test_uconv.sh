@@ -0,0 +1,148 @@
+#!/bin/sh
+# (c) Copyright Emery De Nuccio 2007
+# Distributed under the Boost
+# Software License, Version 1.0. (See accompanying file
+# LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+# Checks uconv: a few conversions against the bytes they have to give, round trips
+# between every Unicode encoding on one thread and on several (with chunks of an odd
+# size, so they're cut in the middle of characters), byte order marks and malformed
+# input. Run it from the top of the tree:
+#
+#	tools/test_uconv.sh [uconv]
+#
+# uconv is _check/uconv by default, which tools/check.sh builds.
+
+uconv=${1:-_check/uconv}
+tmp=${TMPDIR:-/tmp}/test_uconv.$$
+cases=0
+failed=0
+
+mkdir -p "$tmp" || exit 2
+trap 'rm -rf "$tmp"' EXIT
+
+fail()
+{
+	failed=$((failed + 1))
+	echo "FAIL uconv: $*"
+}
+
+# The bytes of a file in hex, all on one line.
+hex()
+{
+	od -An -tx1 "$1" | tr -d ' \n'
+}
+
+# Check that converting the file $1 with the uconv options after it gives the bytes
+# in hex in $expect.
+expect_hex()
+{
+	cases=$((cases + 1))
+	src=$1
+	shift
+
+	if ! "$uconv" -q "$@" "$src" "$tmp/out"; then
+		fail "uconv $* $src failed"
+	elif [ "$(hex "$tmp/out")" != "$expect" ]; then
+		fail "uconv $* gave $(hex "$tmp/out"), expected $expect"
+	fi
+}
+
+# Check that the files $1 and $2 are the same.
+same()
+{
+	cases=$((cases + 1))
+
+	if ! cmp -s "$1" "$2"; then
+		fail "$3"
+	fi
+}
+
+#--------------------------------------------------------------------------------
+# Conversions to known bytes: "A", U+00E9 and U+1F600 (a surrogate pair in UTF-16).
+#--------------------------------------------------------------------------------
+
+printf 'A\303\251\360\237\230\200' > "$tmp/short"
+
+expect=4100e9003dd800de
+expect_hex "$tmp/short" -f utf-8 -t utf-16le
+expect=004100e9d83dde00
+expect_hex "$tmp/short" -f utf-8 -t utf-16be
+expect=41000000e900000000f60100
+expect_hex "$tmp/short" -f utf-8 -t utf-32le
+expect=00000041000000e90001f600
+expect_hex "$tmp/short" -f utf-8 -t utf-32be
+expect=fffe4100e9003dd800de
+expect_hex "$tmp/short" -f utf-8 -t utf-16le --add-bom
+expect=0000feff00000041000000e90001f600
+expect_hex "$tmp/short" -f utf-8 -t utf-32be --add-bom
+
+#--------------------------------------------------------------------------------
+# Round trips
+#--------------------------------------------------------------------------------
+
+# ASCII, Latin-1, Greek, Cyrillic, CJK and emoji, doubled until it's about 200 KB.
+printf 'Hello, world. Caf\303\251 na\303\257ve \316\261\316\262\316\263 \320\277\321\200\320\270\320\262\320\265\321\202 \346\227\245\346\234\254\350\252\236 \360\237\230\200\360\237\221\215\n' > "$tmp/in"
+
+for i in 1 2 3 4 5 6 7 8 9 10 11; do
+	cat "$tmp/in" "$tmp/in" > "$tmp/twice"
+	mv "$tmp/twice" "$tmp/in"
+done
+
+for to in utf-16le utf-16be utf-32le utf-32be; do
+	"$uconv" -q -f utf-8 -t $to "$tmp/in" "$tmp/$to"
+	"$uconv" -q -f $to -t utf-8 "$tmp/$to" "$tmp/back"
+	same "$tmp/in" "$tmp/back" "utf-8 to $to and back"
+
+	# On several threads, with chunks that end in the middle of characters.
+	"$uconv" -q -j 4 --chunk=1001 -f utf-8 -t $to "$tmp/in" "$tmp/threads"
+	same "$tmp/$to" "$tmp/threads" "utf-8 to $to on 4 threads"
+	"$uconv" -q -j 3 --chunk=999 -f $to -t utf-8 "$tmp/$to" "$tmp/back"
+	same "$tmp/in" "$tmp/back" "$to to utf-8 on 3 threads"
+done
+
+# Between the UTF-16 and UTF-32 encodings without going through UTF-8.
+for from in utf-16le utf-16be utf-32le utf-32be; do
+	for to in utf-16le utf-16be utf-32le utf-32be; do
+		"$uconv" -q -j 2 --chunk=4097 -f $from -t $to "$tmp/$from" "$tmp/out"
+		same "$tmp/$to" "$tmp/out" "$from to $to"
+	done
+done
+
+#--------------------------------------------------------------------------------
+# Byte order marks
+#--------------------------------------------------------------------------------
+
+for to in utf-8 utf-16le utf-16be utf-32le utf-32be; do
+	"$uconv" -q --add-bom -f utf-8 -t $to "$tmp/in" "$tmp/bom"
+	"$uconv" -q --strip-bom -j 4 --chunk=1001 -f $to -t utf-8 "$tmp/bom" "$tmp/back"
+	same "$tmp/in" "$tmp/back" "$to with a byte order mark added and stripped"
+done
+
+# Without --strip-bom the mark is just a character, and only the first one is stripped.
+printf '\357\273\277a' > "$tmp/short"
+expect=efbbbf61
+expect_hex "$tmp/short" -f utf-8 -t utf-8
+printf '\357\273\277\357\273\277a' > "$tmp/short"
+expect=efbbbf61
+expect_hex "$tmp/short" -f utf-8 -t utf-8 --strip-bom
+
+#--------------------------------------------------------------------------------
+# Malformed input
+#--------------------------------------------------------------------------------
+
+printf 'a\377b' > "$tmp/short"
+expect=61efbfbd62
+expect_hex "$tmp/short" -f utf-8 -t utf-8
+expect=6162
+expect_hex "$tmp/short" -f utf-8 -t utf-8 --on-error=skip
+
+cases=$((cases + 1))
+"$uconv" -q --on-error=stop -f utf-8 -t utf-8 "$tmp/short" "$tmp/out" 2> /dev/null
+status=$?
+if [ $status -ne 1 ]; then
+	fail "--on-error=stop exited with $status, expected 1"
+fi
+
+printf '%-30s %6d cases, %d failed\n' uconv $cases $failed
+[ $failed -eq 0 ]
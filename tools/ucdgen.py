@@ -0,0 +1,953 @@
+# (c) Copyright Emery De Nuccio 2007
+# Distributed under the Boost
+# Software License, Version 1.0. (See accompanying file
+# LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Generates the character tables (the *_tables.hpp headers) from the Unicode
+# Character Database files in ucd/.
+#
+# usage: python tools/ucdgen.py [top of the tree]
+#
+# Every table maps a code point to a value through two or three stages: the code
+# point's high bits pick a block of the next stage, and its low bits pick the value
+# within the block. Identical blocks are stored once, and the number of stages and
+# block sizes are whichever make the table smallest.
+
+import os
+import re
+import sys
+
+max_code_point = 0x10FFFF
+
+top = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+ucd_dir = os.path.join(top, 'ucd')
+
+#================================================================================
+# Reading the UCD
+#================================================================================
+
+def ucd_version():
+	for line in open(os.path.join(ucd_dir, 'ReadMe.txt')):
+		m = re.search(r'Version (\d+\.\d+\.\d+)', line)
+		if m:
+			return m.group(1)
+
+	raise RuntimeError('No version in ucd/ReadMe.txt')
+
+def parse_range(s):
+	s = s.strip()
+
+	if '..' in s:
+		first, last = s.split('..')
+		return int(first, 16), int(last, 16)
+
+	return int(s, 16), int(s, 16)
+
+# Yield (first, last, fields) for each line of a UCD property file, where fields
+# are the ;-separated fields after the code point range, without the comment.
+def read_property_file(name):
+	for line in open(os.path.join(ucd_dir, name), encoding='utf-8'):
+		line = line.split('#', 1)[0].strip()
+
+		if not line:
+			continue
+
+		fields = [f.strip() for f in line.split(';')]
+		first, last = parse_range(fields[0])
+		yield first, last, fields[1:]
+
+# Read UnicodeData.txt into a dictionary of code point to its list of fields
+# (name, general category, combining class, ...). Ranges given by First/Last
+# lines are expanded.
+def read_unicode_data():
+	ret = {}
+	range_first = None
+
+	for line in open(os.path.join(ucd_dir, 'UnicodeData.txt'), encoding='utf-8'):
+		fields = line.rstrip('\n').split(';')
+
+		if len(fields) < 15:
+			continue
+
+		cp = int(fields[0], 16)
+		fields = fields[1:]
+
+		if fields[0].endswith(', First>'):
+			range_first = cp
+			continue
+
+		if fields[0].endswith(', Last>'):
+			for c in range(range_first, cp + 1):
+				ret[c] = [''] + fields[1:]
+
+			continue
+
+		ret[cp] = fields
+
+	return ret
+
+#================================================================================
+# Building tables
+#================================================================================
+
+# Split values into blocks of 1 << shift, storing identical blocks once. Returns the
+# block number of each block, and the blocks.
+def split(values, shift):
+	size = 1 << shift
+	blocks = {}
+	index = []
+	data = []
+
+	for i in range(0, len(values), size):
+		block = tuple(values[i:i + size])
+
+		if block not in blocks:
+			blocks[block] = len(blocks)
+			data.extend(block)
+
+		index.append(blocks[block])
+
+	return index, data
+
+# Split values (one per code point) into two or three stages, trying every block
+# size, and keep whichever is smallest. Values after the last one that isn't
+# default aren't stored. Returns (limit, shifts, stages), where limit is the first
+# code point that isn't stored.
+def multi_stage(values, default):
+	best = None
+	end = len(values)
+
+	while end > 0 and values[end - 1] == default:
+		end -= 1
+
+	for shift in range(4, 11):
+		for shift2 in [0, 2, 3, 4, 5, 6, 7]:
+			span = 1 << (shift + shift2)
+			padded = values[:end] + [default] * (-end % span)
+			index, data = split(padded, shift)
+
+			if shift2:
+				index, middle = split(index, shift2)
+				stages = [index, middle, data]
+			else:
+				stages = [index, data]
+
+			cost = sum(len(stage) * type_size(max(stage)) for stage in stages)
+
+			if best is None or cost < best[0]:
+				best = (cost, len(padded), [shift2, shift] if shift2 else [shift], stages)
+
+	return best[1], best[2], best[3]
+
+def type_size(max_value):
+	if max_value < 0x100:
+		return 1
+	elif max_value < 0x10000:
+		return 2
+
+	return 4
+
+def type_name(max_value):
+	return 'boost::uint%d_t' % (type_size(max_value) * 8)
+
+class header:
+	def __init__(self, name, what):
+		self.name = name
+		self.guard = 'BOOST_UNICODE_' + name.upper().replace('.', '_')
+		self.what = what
+		self.enums = []
+		self.declarations = []
+		self.definitions = []
+		self.functions = []
+		self.size = 0
+
+	# Add a static array to the data class.
+	def array(self, name, values, type=None, per_line=16):
+		type = type or type_name(max(values) if values else 0)
+		self.size += len(values) * int(re.search(r'\d+', type).group(0)) // 8
+		self.declarations.append('\t\tstatic const %s %s[%d];' % (type, name, len(values)))
+
+		lines = []
+		for i in range(0, len(values), per_line):
+			lines.append('\t\t' + ','.join(str(v) for v in values[i:i + per_line]))
+
+		self.definitions.append('\ttemplate<class T> const %s %s_data<T>::%s[%d] = {\n%s\n\t};'
+			% (type, self.data_name(), name, len(values), ',\n'.join(lines)))
+
+	# Add an enum of the given names, numbered from 0, each with a comment. A value can
+	# also be a (name, comment) pair.
+	def enum(self, name, prefix, values):
+		values = [v if isinstance(v, tuple) else (v, v) for v in values]
+		names = [(re.sub('(?<=[a-z])(?=[A-Z])', '_', v), re.sub('(?<=[a-z])(?=[A-Z])', '_', c)) for v, c in values]
+		lines = ['\t\t%s%s, // %s' % (prefix, n.lower(), c.replace('_', ' ')) for n, c in names]
+		lines[-1] = lines[-1].replace(',', '', 1)
+		self.enums.append('\tenum %s\n\t{\n%s\n\t};' % (name, '\n'.join(lines)))
+
+	def constant(self, name, value):
+		self.declarations.append('\t\tstatic const int %s = %d;' % (name, value))
+
+	# Add a multi-stage table of a value for every code point, and an inline function
+	# with the given name that looks the value up.
+	def table(self, name, values, comment, default=0):
+		limit, shifts, stages = multi_stage(values, default)
+		data = self.data_name() + '_data<>'
+		type = type_name(max(stages[-1] + [default]))
+
+		for i, stage in enumerate(stages):
+			self.array('%s_stage%d' % (name, i + 1), stage, type if i == len(stages) - 1 else None)
+
+		if len(stages) == 2:
+			lookup = '%s::%s_stage2[(%s::%s_stage1[cp >> %d] << %d) + (cp & 0x%X)]' % (
+				data, name, data, name, shifts[0], shifts[0], (1 << shifts[0]) - 1)
+		else:
+			lookup = '%s::%s_stage3[(%s::%s_stage2[(%s::%s_stage1[cp >> %d] << %d) + ((cp >> %d) & 0x%X)] << %d) + (cp & 0x%X)]' % (
+				data, name, data, name, data, name, shifts[0] + shifts[1], shifts[0], shifts[1], (1 << shifts[0]) - 1,
+				shifts[1], (1 << shifts[1]) - 1)
+
+		self.functions.append('''	// %s
+	inline %s %s(boost::uint32_t cp)
+	{
+		if(cp >= 0x%X) // Everything from here on has the same value.
+			return %d;
+
+		return %s;
+	}''' % (comment, type, name, limit, default, lookup))
+
+	def data_name(self):
+		return self.name.replace('_tables.hpp', '')
+
+	def write(self):
+		data = self.data_name()
+		text = '''// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// %s
+// Generated by tools/ucdgen.py from the Unicode Character Database %s. Don't edit.
+// Tables: %d bytes.
+
+#ifndef %s
+#define %s
+
+#include <boost/cstdint.hpp>
+
+namespace unicode
+{
+%s	// The tables are static members of a class template so that they're only
+	// stored once however many translation units include this.
+	template<class T=void>
+	struct %s_data
+	{
+%s
+	};
+
+%s
+
+%s
+}
+
+#endif
+''' % (self.what, ucd_version(), self.size, self.guard, self.guard,
+			''.join(e + '\n\n' for e in self.enums), data,
+			'\n'.join(self.declarations), '\n\n'.join(self.definitions), '\n\n'.join(self.functions))
+
+		open(os.path.join(top, self.name), 'w', newline='\n').write(text)
+		print('%s: %d bytes of tables' % (self.name, self.size))
+
+#================================================================================
+# Normalization
+#================================================================================
+
+def gen_normalization(unicode_data):
+	h = header('normalization_tables.hpp', 'Tables for normalization (see normalize.hpp).')
+
+	# Quick check values: 0 is Yes, 1 is No and 2 is Maybe.
+	quick_check = dict((p, [0] * (max_code_point + 1)) for p in ('NFC_QC', 'NFKC_QC', 'NFD_QC', 'NFKD_QC'))
+	excluded = set()
+
+	for first, last, fields in read_property_file('DerivedNormalizationProps.txt'):
+		if fields[0] == 'Full_Composition_Exclusion':
+			excluded.update(range(first, last + 1))
+		elif fields[0] in quick_check:
+			value = {'N': 1, 'M': 2}[fields[1]]
+
+			for cp in range(first, last + 1):
+				quick_check[fields[0]][cp] = value
+
+	# Combining class in the low 8 bits, then NFC_QC, NFKC_QC (2 bits each), NFD_QC and NFKD_QC.
+	props = [0] * (max_code_point + 1)
+
+	for cp in range(max_code_point + 1):
+		ccc = int(unicode_data[cp][2]) if cp in unicode_data else 0
+		props[cp] = (ccc | quick_check['NFC_QC'][cp] << 8 | quick_check['NFKC_QC'][cp] << 10
+			| quick_check['NFD_QC'][cp] << 12 | quick_check['NFKD_QC'][cp] << 13)
+
+	h.table('normalization_props', props,
+		'Canonical combining class (bits 0-7), and NFC, NFKC (2 bits each), NFD and NFKD quick check values.')
+
+	# Decomposition mappings, fully decomposed. Hangul syllables are left to the algorithm.
+	mappings = {}
+
+	for cp, fields in unicode_data.items():
+		if fields[4] and not 0xAC00 <= cp <= 0xD7A3:
+			parts = fields[4].split()
+			compat = parts[0].startswith('<') # Compatibility mappings start with a <tag>.
+			mappings[cp] = (compat, [int(p, 16) for p in (parts[1:] if compat else parts)])
+
+	def full(cp, compat):
+		if 0xAC00 <= cp <= 0xD7A3:
+			s = cp - 0xAC00
+			ret = [0x1100 + s // 588, 0x1161 + s % 588 // 28]
+			return ret + [0x11A7 + s % 28] if s % 28 else ret
+
+		if cp in mappings and (compat or not mappings[cp][0]):
+			ret = []
+
+			for c in mappings[cp][1]:
+				ret.extend(full(c, compat))
+
+			return ret
+
+		return [cp]
+
+	# The decompositions of a character are stored together in the pool, in UTF-16, each
+	# after a header word of its length and flags. A canonical decomposition comes first
+	# and is followed by a compatibility one if that differs; a character with only a
+	# compatibility decomposition has just that.
+	def utf16(seq):
+		ret = []
+
+		for c in seq:
+			if c >= 0x10000:
+				ret.extend([0xD800 + ((c - 0x10000) >> 10), 0xDC00 + (c & 0x3FF)])
+			else:
+				ret.append(c)
+
+		return ret
+
+	length_mask, compatibility_flag, compatibility_follows = 0x1F, 0x20, 0x40
+
+	pool = [0]
+	pool_index = {}
+	entries = [0] * (max_code_point + 1)
+
+	for cp in sorted(mappings):
+		compat = utf16(full(cp, True))
+
+		if mappings[cp][0]:
+			words = [len(compat) | compatibility_flag] + compat
+		else:
+			canonical = utf16(full(cp, False))
+			words = [len(canonical)] + canonical
+
+			if compat != canonical:
+				words[0] |= compatibility_follows
+				words += [len(compat) | compatibility_flag] + compat
+
+		assert len(canonical if not mappings[cp][0] else compat) <= length_mask and len(compat) <= length_mask
+
+		key = tuple(words)
+
+		if key not in pool_index:
+			pool_index[key] = len(pool)
+			pool.extend(words)
+
+		entries[cp] = pool_index[key]
+
+	h.table('decomposition_offset', entries, 'Offset of the character\'s decompositions in decomposition_pool, or 0 if it has none.')
+	h.constant('decomposition_length_mask', length_mask)
+	h.constant('decomposition_compatibility', compatibility_flag)
+	h.constant('decomposition_compatibility_follows', compatibility_follows)
+	h.array('decomposition_pool', pool, 'boost::uint16_t')
+
+	# Primary composites: canonical decompositions of two characters that aren't excluded.
+	pairs = sorted((m[1][0], m[1][1], cp) for cp, m in mappings.items()
+		if not m[0] and len(m[1]) == 2 and cp not in excluded)
+
+	h.constant('composition_count', len(pairs))
+	h.array('composition_first', [p[0] for p in pairs], 'boost::uint32_t', 12)
+	h.array('composition_second', [p[1] for p in pairs], 'boost::uint32_t', 12)
+	h.array('composition_result', [p[2] for p in pairs], 'boost::uint32_t', 12)
+
+	h.write()
+
+#================================================================================
+# Case folding
+#================================================================================
+
+def gen_case_folding():
+	h = header('case_folding_tables.hpp', 'Tables for case folding (see case_folding.hpp).')
+
+	# Simple (C and S) and full (C and F) foldings. The T foldings are left to the code.
+	simple = {}
+	full = {}
+
+	for first, last, fields in read_property_file('CaseFolding.txt'):
+		mapping = [int(c, 16) for c in fields[1].split()]
+
+		if fields[0] in ('C', 'S'):
+			simple[first] = mapping[0]
+
+		if fields[0] in ('C', 'F'):
+			full[first] = mapping
+
+	# Every character that folds has an entry of the difference between its simple
+	# folding and itself, and of where its full folding is in the pool if that's more
+	# than one character. Characters share entries, so there are few of them.
+	pool = [0]
+	entry_index = {(0, 0): 0}
+	deltas = [0]
+	fulls = [0]
+	entries = [0] * (max_code_point + 1)
+
+	for cp in sorted(set(simple) | set(full)):
+		offset = 0
+
+		if len(full.get(cp, [])) > 1:
+			assert max(full[cp]) < 0x10000
+			offset = len(pool)
+			pool.append(len(full[cp]))
+			pool.extend(full[cp])
+
+		key = (simple.get(cp, cp) - cp, offset)
+
+		if key not in entry_index:
+			entry_index[key] = len(deltas)
+			deltas.append(key[0])
+			fulls.append(key[1])
+
+		entries[cp] = entry_index[key]
+
+	h.table('case_folding_entry', entries, 'Index into case_folding_delta and case_folding_full, or 0 if the character doesn\'t fold.')
+	h.array('case_folding_delta', deltas, 'boost::int32_t', 12)
+	h.array('case_folding_full', fulls)
+	h.array('case_folding_pool', pool)
+
+	h.write()
+
+#================================================================================
+# Grapheme clusters
+#================================================================================
+
+# Grapheme_Cluster_Break values, in the order of the grapheme_break enum. Extended
+# pictographic characters are all Other, so they get a value of their own.
+grapheme_break_values = ['Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator', 'Prepend',
+	'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT', 'Extended_Pictographic']
+
+def gen_grapheme_break():
+	h = header('grapheme_break_tables.hpp', 'Tables for grapheme clusters (see grapheme.hpp).')
+	values = [0] * (max_code_point + 1)
+
+	for first, last, fields in read_property_file('GraphemeBreakProperty.txt'):
+		for cp in range(first, last + 1):
+			values[cp] = grapheme_break_values.index(fields[0])
+
+	for first, last, fields in read_property_file('emoji-data.txt'):
+		if fields[0] == 'Extended_Pictographic':
+			for cp in range(first, last + 1):
+				assert values[cp] == 0
+				values[cp] = grapheme_break_values.index('Extended_Pictographic')
+
+	h.enum('grapheme_break', 'gb_', grapheme_break_values)
+	h.table('grapheme_break_property', values, 'Grapheme_Cluster_Break (or extended pictographic) of a character.')
+	h.write()
+
+#================================================================================
+# Word and line breaks
+#================================================================================
+
+# Word_Break values, in the order of the word_break enum.
+word_break_values = ['Other', 'CR', 'LF', 'Newline', 'Extend', 'ZWJ', 'Regional_Indicator', 'Format', 'Katakana',
+	'Hebrew_Letter', 'ALetter', 'Single_Quote', 'Double_Quote', 'MidNumLet', 'MidLetter', 'MidNum', 'Numeric',
+	'ExtendNumLet', 'WSegSpace']
+
+def read_extended_pictographic():
+	ret = set()
+
+	for first, last, fields in read_property_file('emoji-data.txt'):
+		if fields[0] == 'Extended_Pictographic':
+			ret.update(range(first, last + 1))
+
+	return ret
+
+def gen_word_break():
+	h = header('word_break_tables.hpp', 'Tables for word boundaries (see word_break.hpp).')
+	values = [0] * (max_code_point + 1)
+
+	for first, last, fields in read_property_file('WordBreakProperty.txt'):
+		for cp in range(first, last + 1):
+			values[cp] = word_break_values.index(fields[0])
+
+	# Extended pictographic characters can have any Word_Break, so they're flagged.
+	pictographic_flag = 0x20
+	assert len(word_break_values) <= pictographic_flag
+
+	for cp in read_extended_pictographic():
+		values[cp] |= pictographic_flag
+
+	h.enum('word_break', 'wb_', word_break_values)
+	h.constant('pictographic_flag', pictographic_flag)
+	h.table('word_break_property', values, 'Word_Break of a character, with pictographic_flag if it\'s extended pictographic.')
+	h.write()
+
+# Line_Break values, in the order of the line_break enum, as resolved by rule LB1 of
+# UAX #14: AI, SG and XX are AL, CJ is NS, and SA is CM for marks and AL otherwise.
+line_break_values = [('AL', 'Alphabetic'), ('BK', 'Mandatory_Break'), ('CR', 'Carriage_Return'), ('LF', 'Line_Feed'),
+	('NL', 'Next_Line'), ('CM', 'Combining_Mark'), ('ZWJ', 'ZWJ'), ('WJ', 'Word_Joiner'), ('ZW', 'ZWSpace'), ('GL', 'Glue'),
+	('SP', 'Space'), ('B2', 'Break_Both'), ('BA', 'Break_After'), ('BB', 'Break_Before'), ('HY', 'Hyphen'),
+	('CB', 'Contingent_Break'), ('CL', 'Close_Punctuation'), ('CP', 'Close_Parenthesis'), ('EX', 'Exclamation'),
+	('IN', 'Inseparable'), ('NS', 'Nonstarter'), ('OP', 'Open_Punctuation'), ('QU', 'Quotation'), ('IS', 'Infix_Numeric'),
+	('NU', 'Numeric'), ('PO', 'Postfix_Numeric'), ('PR', 'Prefix_Numeric'), ('SY', 'Break_Symbols'), ('EB', 'E_Base'),
+	('EM', 'E_Modifier'), ('H2', 'H2'), ('H3', 'H3'), ('HL', 'Hebrew_Letter'), ('ID', 'Ideographic'), ('JL', 'JL'),
+	('JV', 'JV'), ('JT', 'JT'), ('RI', 'Regional_Indicator')]
+
+def gen_line_break(unicode_data):
+	h = header('line_break_tables.hpp', 'Tables for line breaks (see line_break.hpp).')
+	index = dict((v[0], i) for i, v in enumerate(line_break_values))
+	values = [0] * (max_code_point + 1)
+
+	for first, last, fields in read_property_file('LineBreak.txt'):
+		for cp in range(first, last + 1):
+			lb = fields[0]
+
+			if lb == 'SA':
+				lb = 'CM' if cp in unicode_data and unicode_data[cp][1] in ('Mn', 'Mc') else 'AL'
+			elif lb == 'CJ':
+				lb = 'NS'
+			elif lb in ('AI', 'SG', 'XX'):
+				lb = 'AL'
+
+			values[cp] = index[lb]
+
+	# Rule LB30 treats wide opening and closing punctuation differently, and LB30b
+	# unassigned extended pictographic characters, so they're flagged.
+	east_asian_flag, pictographic_flag = 0x40, 0x80
+	assert len(line_break_values) <= east_asian_flag
+
+	for first, last, fields in read_property_file('EastAsianWidth.txt'):
+		if fields[0] in ('F', 'W', 'H'):
+			for cp in range(first, last + 1):
+				if values[cp] in (index['OP'], index['CP']):
+					values[cp] |= east_asian_flag
+
+	for cp in read_extended_pictographic():
+		if cp not in unicode_data:
+			values[cp] |= pictographic_flag
+
+	h.enum('line_break', 'lb_', line_break_values)
+	h.constant('east_asian_flag', east_asian_flag)
+	h.constant('pictographic_flag', pictographic_flag)
+	h.table('line_break_property', values, 'Line_Break of a character (resolved as by rule LB1), with east_asian_flag and pictographic_flag.')
+	h.write()
+
+#================================================================================
+# Character properties
+#================================================================================
+
+# General_Category values, in the order of the general_category enum, with unassigned first.
+general_categories = [('Cn', 'Unassigned'),
+	('Lu', 'Uppercase_Letter'), ('Ll', 'Lowercase_Letter'), ('Lt', 'Titlecase_Letter'), ('Lm', 'Modifier_Letter'),
+	('Lo', 'Other_Letter'), ('Mn', 'Nonspacing_Mark'), ('Mc', 'Spacing_Mark'), ('Me', 'Enclosing_Mark'),
+	('Nd', 'Decimal_Number'), ('Nl', 'Letter_Number'), ('No', 'Other_Number'), ('Pc', 'Connector_Punctuation'),
+	('Pd', 'Dash_Punctuation'), ('Ps', 'Open_Punctuation'), ('Pe', 'Close_Punctuation'), ('Pi', 'Initial_Punctuation'),
+	('Pf', 'Final_Punctuation'), ('Po', 'Other_Punctuation'), ('Sm', 'Math_Symbol'), ('Sc', 'Currency_Symbol'),
+	('Sk', 'Modifier_Symbol'), ('So', 'Other_Symbol'), ('Zs', 'Space_Separator'), ('Zl', 'Line_Separator'),
+	('Zp', 'Paragraph_Separator'), ('Cc', 'Control'), ('Cf', 'Format'), ('Cs', 'Surrogate'), ('Co', 'Private_Use')]
+
+# East_Asian_Width values, in the order of the east_asian_width enum, with the default first.
+east_asian_widths = [('N', 'Neutral'), ('A', 'Ambiguous'), ('H', 'Halfwidth'), ('W', 'Wide'), ('F', 'Fullwidth'), ('Na', 'Narrow')]
+
+def gen_properties(unicode_data):
+	h = header('properties_tables.hpp', 'Tables for character properties (see properties.hpp).')
+
+	category_index = dict((c[0], i) for i, c in enumerate(general_categories))
+	width_index = dict((w[0], i) for i, w in enumerate(east_asian_widths))
+
+	categories = [0] * (max_code_point + 1)
+
+	for cp, fields in unicode_data.items():
+		categories[cp] = category_index[fields[1]]
+
+	# Scripts are numbered in alphabetical order, after Unknown.
+	script_ranges = list(read_property_file('Scripts.txt'))
+	scripts = ['Unknown'] + sorted(set(fields[0] for first, last, fields in script_ranges))
+	script_values = [0] * (max_code_point + 1)
+
+	for first, last, fields in script_ranges:
+		for cp in range(first, last + 1):
+			script_values[cp] = scripts.index(fields[0])
+
+	widths = [0] * (max_code_point + 1)
+
+	for first, last, fields in read_property_file('EastAsianWidth.txt'):
+		for cp in range(first, last + 1):
+			widths[cp] = width_index[fields[0]]
+
+	h.enum('general_category', 'gc_', [c[1] for c in general_categories])
+	h.enum('script_code', 'script_', scripts)
+	h.enum('east_asian_width', 'eaw_', [w[1] for w in east_asian_widths])
+
+	# Every character's properties are packed into one record, and characters with the same
+	# properties share it, so one lookup finds them all.
+	category_bits, width_bits = 5, 3
+	records = [0]
+	record_index = {0: 0}
+	values = [0] * (max_code_point + 1)
+
+	for cp in range(max_code_point + 1):
+		record = categories[cp] | widths[cp] << category_bits | script_values[cp] << (category_bits + width_bits)
+
+		if record not in record_index:
+			record_index[record] = len(records)
+			records.append(record)
+
+		values[cp] = record_index[record]
+
+	h.table('property_record', values, 'Index of the character\'s record in property_records.')
+	h.constant('width_shift', category_bits)
+	h.constant('script_shift', category_bits + width_bits)
+	h.array('property_records', records, None, 12)
+	h.write()
+
+#================================================================================
+# Display width
+#================================================================================
+
+# Columns a character takes in a terminal, in the order of the display_width_class enum.
+display_widths = [('Zero', 'Combining marks, format and control characters, line and paragraph separators, and conjoining jamo after the first'),
+	('Narrow', 'Everything else'), ('Wide', 'East_Asian_Width W or F'), ('Ambiguous', 'East_Asian_Width A: narrow, or wide in East Asian text')]
+
+def gen_display_width(unicode_data):
+	h = header('display_width_tables.hpp', 'Tables for display widths (see display_width.hpp).')
+	values = [1] * (max_code_point + 1)
+
+	for first, last, fields in read_property_file('EastAsianWidth.txt'):
+		if fields[0] in ('W', 'F', 'A'):
+			for cp in range(first, last + 1):
+				values[cp] = 3 if fields[0] == 'A' else 2
+
+	for cp, fields in unicode_data.items():
+		if fields[1] in ('Mn', 'Me', 'Cf', 'Cc', 'Zl', 'Zp') and cp != 0xAD: # A soft hyphen shows where a line is broken.
+			values[cp] = 0
+
+	for cp in list(range(0x1160, 0x1200)) + list(range(0xD7B0, 0xD800)):
+		values[cp] = 0
+
+	h.enum('display_width_class', 'width_', display_widths)
+	h.table('display_width_property', values, 'display_width_class of a character.', 1)
+	h.write()
+
+#================================================================================
+# Collation
+#================================================================================
+
+def gen_collation():
+	h = header('collation_tables.hpp', 'Tables for collation (see collate.hpp).')
+
+	# Read the DUCET: a list of collation elements, [.primary.secondary.tertiary] (or
+	# [*...] for variable ones), for single characters and for contractions.
+	mappings = {}
+	implicit = []
+
+	for line in open(os.path.join(ucd_dir, 'allkeys.txt'), encoding='utf-8'):
+		line = line.split('#', 1)[0].strip()
+
+		if line.startswith('@implicitweights'):
+			first, last = parse_range(line.split()[1].rstrip(';'))
+			implicit.append((first, last, int(line.split(';')[1], 16)))
+			continue
+
+		if not line or line.startswith('@'):
+			continue
+
+		chars, elements = line.split(';')
+		mappings[tuple(int(c, 16) for c in chars.split())] = [(v == '*', int(p, 16), int(s, 16), int(t, 16))
+			for v, p, s, t in re.findall(r'\[([.*])([0-9A-F]+)\.([0-9A-F]+)\.([0-9A-F]+)\]', elements)]
+
+	# Secondary weights are renumbered densely in order, so they fit in a byte.
+	secondaries = sorted(set(e[2] for ces in mappings.values() for e in ces) | set([0, 0x20]))
+	assert len(secondaries) <= 256
+	secondary_rank = dict((w, i) for i, w in enumerate(secondaries))
+
+	# Variable elements (punctuation and symbols, which can be ignored) are exactly those
+	# with primaries from 1 to variable_top, so they needn't be marked.
+	variable_top = max(e[1] for ces in mappings.values() for e in ces if e[0])
+	assert all(e[0] == (0 < e[1] <= variable_top) for ces in mappings.values() for e in ces)
+
+	# Collation elements are stored in 16-bit units. Most are just a primary weight with
+	# the common secondary and tertiary weights, which take one unit: the primary if more
+	# elements follow, or short_last plus the primary for the last one. Others take two:
+	# long_first with last_flag for the last one, the tertiary (bits 8-12) and secondary
+	# (bits 0-7), then the primary.
+	short_last, long_first, last_flag = 0x6000, 0xC000, 0x2000
+	# Instead of elements, a character that starts contractions has contraction_marker,
+	# then its own elements.
+	contraction_marker = short_last - 1 + short_last
+
+	def encode(ces):
+		units = []
+
+		for i, (variable, p, s, t) in enumerate(ces):
+			last = i == len(ces) - 1
+
+			if p and p < short_last - 1 and s == 0x20 and t == 2:
+				units.append(p + (short_last if last else 0))
+			else:
+				units.append(long_first | (last_flag if last else 0) | t << 8 | secondary_rank[s])
+				units.append(p)
+
+		return units
+
+	pool = [0]
+	pool_index = {}
+
+	def add(units):
+		key = tuple(units)
+
+		if key not in pool_index:
+			pool_index[key] = len(pool)
+			pool.extend(units)
+
+		return pool_index[key]
+
+	starters = set(chars[0] for chars in mappings if len(chars) > 1)
+	offsets = [0] * (max_code_point + 1)
+
+	for chars, ces in mappings.items():
+		if len(chars) == 1:
+			offsets[chars[0]] = add(([contraction_marker] if chars[0] in starters else []) + encode(ces))
+
+	for cp in starters:
+		assert offsets[cp]
+
+	contractions = sorted(chars for chars in mappings if len(chars) > 1)
+	assert max(len(c) for c in contractions) <= 3
+	contraction_offsets = [add(encode(mappings[chars])) for chars in contractions]
+	assert len(pool) < 0x10000
+
+	h.table('collation_offset', offsets, 'Offset of the character\'s collation elements in collation_pool, or 0 if it has implicit weights.')
+	h.constant('variable_top', variable_top)
+	h.constant('short_last', short_last)
+	h.constant('long_first', long_first)
+	h.constant('last_flag', last_flag)
+	h.constant('contraction_marker', contraction_marker)
+	h.constant('common_secondary', secondary_rank[0x20])
+	h.array('collation_pool', pool)
+
+	h.constant('contraction_count', len(contractions))
+	h.array('contraction_chars', [c for chars in contractions for c in (list(chars) + [0, 0])[:3]], 'boost::uint32_t', 12)
+	h.array('contraction_offset', contraction_offsets)
+
+	# Implicit weights: the ranges given in the DUCET, then unified ideographs, of which
+	# the ones in the CJK Unified Ideographs and CJK Compatibility Ideographs blocks
+	# ("core" ones) sort first.
+	ideographs = [(first, last) for first, last, fields in read_property_file('PropList.txt') if fields[0] == 'Unified_Ideograph']
+
+	h.constant('implicit_count', len(implicit))
+	h.array('implicit_first', [r[0] for r in implicit], 'boost::uint32_t')
+	h.array('implicit_last', [r[1] for r in implicit], 'boost::uint32_t')
+	h.array('implicit_base', [r[2] for r in implicit])
+	h.constant('ideograph_count', len(ideographs))
+	h.array('ideograph_first', [r[0] for r in ideographs], 'boost::uint32_t')
+	h.array('ideograph_last', [r[1] for r in ideographs], 'boost::uint32_t')
+	h.array('ideograph_core', [int(0x4E00 <= r[0] <= 0x9FFF or 0xF900 <= r[0] <= 0xFAFF) for r in ideographs])
+
+	h.write()
+
+#================================================================================
+# Single-byte code pages
+#================================================================================
+
+# Code pages in the order of the single_byte_code_page enum, with the names of
+# Python's codecs for them, which the tables are made from.
+single_byte_code_pages = [('iso8859_%d' % n, 'ISO-8859-%d' % n) for n in list(range(1, 12)) + list(range(13, 17))] + [
+	('cp%d' % n, 'Windows-%d' % n) for n in range(1250, 1259)]
+
+def gen_single_byte():
+	h = header('single_byte_tables.hpp', 'Tables for the single-byte code pages (see single_byte.hpp), made from Python\'s codecs.')
+
+	# Decoding is a lookup in 256 entries per code page, with 0xFFFF for bytes that
+	# aren't used. Encoding looks up the high byte of a character in 256 entries per
+	# code page, which pick a block of 256 bytes for the low byte, with 0 for characters
+	# that aren't in the code page. Block 0 is all 0s, and the rest are shared.
+	decode = []
+	encode_index = []
+	blocks = [tuple([0] * 256)]
+
+	for codec, title in single_byte_code_pages:
+		table = []
+
+		for b in range(256):
+			try:
+				table.append(ord(bytes([b]).decode(codec)))
+			except UnicodeDecodeError:
+				table.append(0xFFFF)
+
+		assert table[:0x80] == list(range(0x80)) # They're all ASCII as well.
+		decode += table
+
+		pages = {}
+		for b in range(0x80, 0x100):
+			if table[b] != 0xFFFF:
+				pages.setdefault(table[b] >> 8, [0] * 256)[table[b] & 0xFF] = b
+
+		index = [0] * 256
+		for high, block in pages.items():
+			if tuple(block) not in blocks:
+				blocks.append(tuple(block))
+
+			index[high] = blocks.index(tuple(block))
+
+		encode_index += index
+
+	h.enum('single_byte_code_page', 'code_page_', [(codec.replace('cp', 'windows'), title) for codec, title in single_byte_code_pages])
+	h.constant('code_page_count', len(single_byte_code_pages))
+	h.array('single_byte_decode', decode)
+	h.array('single_byte_encode_index', encode_index)
+	h.array('single_byte_encode', [b for block in blocks for b in block])
+	h.write()
+
+#================================================================================
+# Multi-byte East Asian encodings
+#================================================================================
+
+# (name, Python codec, description)
+multi_byte_encodings = [
+	('shift_jis', 'cp932', 'Shift_JIS, with the Windows (CP932) extensions'),
+	('euc_jp', 'euc_jp', 'EUC-JP, including JIS X 0212'),
+	('gbk', 'gbk', 'GBK'),
+	('gb18030', 'gb18030', 'GB18030'),
+	('big5', 'cp950', 'Big5, with the Windows (CP950) extensions')]
+
+# GB18030's four byte sequences counted from 81 30 81 30.
+def gb18030_linear(b):
+	return (((b[0] - 0x81) * 10 + b[1] - 0x30) * 126 + b[2] - 0x81) * 10 + b[3] - 0x30
+
+def gen_multi_byte():
+	h = header('multi_byte_tables.hpp', 'Tables for the multi-byte East Asian encodings (see multi_byte.hpp), made from Python\'s codecs.')
+
+	# Decoding looks a byte up in 256 entries per encoding, giving a character (or 0xFFFF
+	# if it isn't one by itself), and in another 256, giving a row of 192 characters
+	# for the trail bytes 0x40-0xFF (or 0 if it isn't a lead byte). Row 0 is all 0xFFFF,
+	# and the rest are shared. An extra 256 lead entries at the end are for the second
+	# byte of EUC-JP's three byte JIS X 0212 sequences, which start with 0x8F.
+	decode_single = []
+	lead = []
+	rows = [tuple([0xFFFF] * 192)]
+	row_numbers = {rows[0]: 0}
+
+	def add_row(row):
+		row = tuple(row)
+		if row not in row_numbers:
+			row_numbers[row] = len(rows)
+			rows.append(row)
+
+		return row_numbers[row]
+
+	def decode_row(codec, prefix):
+		row = []
+		for t in range(0x40, 0x100):
+			try:
+				s = (prefix + bytes([t])).decode(codec)
+				row.append(ord(s) if len(s) == 1 and ord(s) < 0x10000 else 0xFFFF)
+			except UnicodeDecodeError:
+				row.append(0xFFFF)
+
+		return row
+
+	for name, codec, title in multi_byte_encodings:
+		single = []
+		for b in range(256):
+			try:
+				s = bytes([b]).decode(codec)
+				single.append(ord(s) if len(s) == 1 else 0xFFFF)
+			except UnicodeDecodeError:
+				single.append(0xFFFF)
+
+		assert single[:0x80] == list(range(0x80)) # They're all ASCII as well.
+		decode_single += single
+		lead += [0 if single[b] != 0xFFFF else add_row(decode_row(codec, bytes([b]))) for b in range(256)]
+
+	lead += [add_row(decode_row('euc_jp', bytes([0x8F, b]))) if b >= 0xA1 else 0 for b in range(256)]
+
+	# Encoding looks the high byte of a character up in 256 entries per encoding, which
+	# pick a shared block of 256 for the low byte, like the single-byte code pages. The
+	# values are a byte (below 0x100), a lead and trail byte (0x8000 and up), or the
+	# last two bytes of a JIS X 0212 sequence without their top bits (in between), with
+	# 0 for characters that aren't in the encoding. GB18030's four byte sequences are
+	# worked out from ranges instead.
+	encode_index = []
+	blocks = [tuple([0] * 256)]
+	block_numbers = {blocks[0]: 0}
+	linear = []
+
+	for name, codec, title in multi_byte_encodings:
+		values = [0] * 0x10000
+		for cp in list(range(0x80, 0xD800)) + list(range(0xE000, 0x10000)):
+			try:
+				e = chr(cp).encode(codec)
+			except UnicodeEncodeError:
+				continue
+
+			if len(e) == 1:
+				values[cp] = e[0]
+			elif len(e) == 2:
+				assert e[0] >= 0x80
+				values[cp] = e[0] << 8 | e[1]
+			elif len(e) == 3:
+				assert e[0] == 0x8F
+				values[cp] = (e[1] & 0x7F) << 8 | e[2] & 0x7F
+			else:
+				assert codec == 'gb18030'
+				linear.append((gb18030_linear(e), cp))
+
+		if codec == 'gb18030': # Everything in the BMP but surrogates.
+			assert len(linear) + sum(1 for v in values if v) == 0x10000 - 0x80 - 0x800
+
+		for high in range(256):
+			block = tuple(values[high << 8:(high + 1) << 8])
+			if block not in block_numbers:
+				block_numbers[block] = len(blocks)
+				blocks.append(block)
+
+			encode_index.append(block_numbers[block])
+
+	# Every other BMP character is a four byte sequence in GB18030, in order. Runs of
+	# them that are consecutive in both become a range.
+	linear.sort()
+	ranges = []
+	for l, cp in linear:
+		if not ranges or l - ranges[-1][0] != cp - ranges[-1][1]:
+			ranges.append((l, cp))
+
+	assert all(ranges[i][1] < ranges[i + 1][1] for i in range(len(ranges) - 1))
+
+	h.enum('multi_byte_encoding', 'multi_byte_', [(name, title) for name, codec, title in multi_byte_encodings])
+	h.constant('multi_byte_count', len(multi_byte_encodings))
+	h.array('multi_byte_decode_single', decode_single)
+	h.array('multi_byte_lead', lead)
+	h.array('multi_byte_decode', [c for row in rows for c in row])
+	h.array('multi_byte_encode_index', encode_index)
+	h.array('multi_byte_encode', [v for block in blocks for v in block])
+	h.constant('gb18030_range_count', len(ranges))
+	h.constant('gb18030_bmp_linear', linear[-1][0] + 1)
+	h.array('gb18030_range_linear', [l for l, cp in ranges], 'boost::uint16_t')
+	h.array('gb18030_range_code', [cp for l, cp in ranges], 'boost::uint16_t')
+	h.write()
+
+#================================================================================
+
+if __name__ == '__main__':
+	unicode_data = read_unicode_data()
+
+	gen_normalization(unicode_data)
+	gen_case_folding()
+	gen_grapheme_break()
+	gen_word_break()
+	gen_line_break(unicode_data)
+	gen_properties(unicode_data)
+	gen_display_width(unicode_data)
+	gen_collation()
+	gen_single_byte()
+	gen_multi_byte()
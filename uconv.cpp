@@ -0,0 +1,527 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// uconv: converts text between the Unicode encodings using the library's decoders
+// and encoders, like iconv. Large inputs are cut into chunks at character boundaries
+// and the chunks are converted on several threads at once.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include "ustream.hpp"
+#include "single_byte.hpp"
+#include "multi_byte.hpp"
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+using namespace std;
+
+const char* usage =
+	"usage: uconv -f FROM -t TO [options] [input [output]]\n"
+	"Converts text between Unicode encodings. Reads stdin and writes stdout by default.\n"
+	"\n"
+	"Encodings: utf-8, utf-16le, utf-16be, utf-32le, utf-32be, latin1,\n"
+	"           iso-8859-1 to iso-8859-16 (but not 12), windows-1250 to windows-1258,\n"
+	"           shift_jis, euc-jp, gbk, gb18030, big5\n"
+	"\n"
+	"Options:\n"
+	"  -f FROM            input encoding\n"
+	"  -t TO              output encoding\n"
+	"  -o FILE            output file (instead of the second argument)\n"
+	"  --add-bom          start the output with a byte order mark\n"
+	"  --strip-bom        drop a byte order mark at the start of the input\n"
+	"  --on-error=ACTION  what to do with malformed input: replace (with U+FFFD, the\n"
+	"                     default), skip, or stop (exit with status 1)\n"
+	"  -j N               number of threads (default: 1)\n"
+	"  --chunk=BYTES      bytes of input each thread converts at a time (default: 4M)\n"
+	"  -q                 don't print statistics to stderr\n";
+
+// Multi-byte encodings are encoding_multi_byte plus their multi_byte_encoding, and
+// single-byte code pages are encoding_single_byte plus their single_byte_code_page.
+enum encoding
+{
+	encoding_utf8, encoding_utf16le, encoding_utf16be, encoding_utf32le, encoding_utf32be, encoding_multi_byte,
+	encoding_single_byte = encoding_multi_byte + unicode::multi_byte_tables::multi_byte_count
+};
+
+enum error_action
+{
+	error_replace, error_skip, error_stop
+};
+
+struct options
+{
+	encoding from;
+	encoding to;
+	error_action on_error;
+	bool add_bom;
+	bool strip_bom;
+	bool quiet;
+	int threads;
+	size_t chunk_size;
+	const char* input;
+	const char* output;
+};
+
+bool parse_encoding(string name, encoding& e)
+{
+	for(size_t i=0; i < name.size(); ++i)
+		name[i] = tolower(name[i]);
+
+	if(name == "utf-8" || name == "utf8")
+		e = encoding_utf8;
+	else if(name == "utf-16le" || name == "utf16le")
+		e = encoding_utf16le;
+	else if(name == "utf-16be" || name == "utf16be")
+		e = encoding_utf16be;
+	else if(name == "utf-32le" || name == "utf32le")
+		e = encoding_utf32le;
+	else if(name == "utf-32be" || name == "utf32be")
+		e = encoding_utf32be;
+	else if(unicode::find_multi_byte_encoding(name) >= 0)
+		e = (encoding)(encoding_multi_byte + unicode::find_multi_byte_encoding(name));
+	else if(unicode::find_single_byte_code_page(name) >= 0)
+		e = (encoding)(encoding_single_byte + unicode::find_single_byte_code_page(name));
+	else
+		return false;
+
+	return true;
+}
+
+// Reads a block of memory in place.
+class memory_buffer : public std::streambuf
+{
+public:
+	memory_buffer(const char* data, size_t size)
+	{
+		char* p = const_cast<char*>(data);
+		setg(p, p, p + size);
+	}
+
+protected:
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode)
+	{
+		off_type pos;
+
+		if(dir == std::ios_base::beg)
+			pos = off;
+		else if(dir == std::ios_base::cur)
+			pos = gptr() - eback() + off;
+		else
+			pos = egptr() - eback() + off;
+
+		if(pos < 0 || pos > egptr() - eback())
+			return pos_type(off_type(-1));
+
+		setg(eback(), eback() + pos, egptr());
+		return pos_type(pos);
+	}
+
+	pos_type seekpos(pos_type pos, std::ios_base::openmode which)
+	{
+		return seekoff(off_type(pos), std::ios_base::beg, which);
+	}
+};
+
+unicode::basic_encoder* make_encoder(encoding e, std::ostream* os)
+{
+	switch(e)
+	{
+	case encoding_utf8: return new unicode::utf8_encoder(os);
+	case encoding_utf16le: return new unicode::utf16le_encoder(os);
+	case encoding_utf16be: return new unicode::utf16be_encoder(os);
+	case encoding_utf32le: return new unicode::utf32le_encoder(os);
+	case encoding_utf32be: return new unicode::utf32be_encoder(os);
+	default:
+		if(e >= encoding_single_byte)
+			return new unicode::basic_single_byte_encoder(os, e - encoding_single_byte);
+
+		return new unicode::basic_multi_byte_encoder(os, e - encoding_multi_byte);
+	}
+}
+
+// How many bytes of [data, data+size) can be converted without cutting a character in two.
+size_t safe_size(encoding e, const char* data, size_t size)
+{
+	const unsigned char* p = (const unsigned char*)data;
+
+	switch(e)
+	{
+	case encoding_utf8:
+		{
+			// Back up to the first byte of the last character, and leave it out if it isn't all there.
+			size_t lead = size;
+			while(lead > 0 && size - lead < 4 && (p[lead-1] & 0xC0) == 0x80)
+				--lead;
+
+			if(lead == 0)
+				return size; // Not UTF-8 enough to care; the decoder will complain.
+
+			--lead;
+			return size - lead < (size_t)unicode::utf8_character_sizes_lookup[p[lead]] ? lead : size;
+		}
+
+	case encoding_utf16le:
+	case encoding_utf16be:
+		{
+			size &= ~(size_t)1;
+
+			if(size < 2)
+				return size;
+
+			// Don't split a surrogate pair.
+			unsigned char high = e == encoding_utf16le ? p[size-1] : p[size-2];
+			return (high & 0xFC) == 0xD8 ? size - 2 : size;
+		}
+
+	case encoding_utf32le:
+	case encoding_utf32be:
+		return size & ~(size_t)3;
+
+	default:
+		if(e >= encoding_single_byte)
+			return size; // Every byte of a single-byte code page is a character.
+
+		return (const char*)unicode::multi_byte_whole(e - encoding_multi_byte, p, p + size) - data;
+	}
+}
+
+// A piece of the input and what it converts to.
+struct chunk
+{
+	const char* data;
+	size_t size;
+	bool first; // Is this the start of the input?
+	string out;
+	boost::uintmax_t chars;
+	boost::uintmax_t errors;
+	boost::intmax_t error_offset; // Offset in the chunk where conversion stopped on an error, or -1.
+};
+
+template<class decoder_type>
+void convert(chunk& c, const options& opt, decoder_type& dec)
+{
+	std::ostringstream os;
+	boost::scoped_ptr<unicode::basic_encoder> enc(make_encoder(opt.to, &os));
+
+	c.chars = 0;
+	c.error_offset = -1;
+
+	boost::int_fast32_t ch = dec.decode();
+
+	if(c.first && opt.strip_bom && ch == 0xFEFF)
+		ch = dec.decode();
+
+	for(; ch != EOF; ch = dec.decode())
+	{
+		enc->encode(ch);
+		++c.chars;
+	}
+
+	if(opt.on_error == error_stop && dec.errors())
+		c.error_offset = dec.last_error();
+
+	c.errors = dec.errors();
+	enc->flush();
+	c.out = os.str();
+}
+
+template<class decoder_type>
+void convert(chunk& c, const options& opt)
+{
+	memory_buffer mb(c.data, c.size);
+	std::istream is(&mb);
+	decoder_type dec(&is);
+	convert(c, opt, dec);
+}
+
+template<class error_policy>
+void convert_single_byte(chunk& c, const options& opt)
+{
+	memory_buffer mb(c.data, c.size);
+	std::istream is(&mb);
+	unicode::basic_single_byte_decoder<error_policy> dec(&is, opt.from - encoding_single_byte);
+	convert(c, opt, dec);
+}
+
+template<class error_policy>
+void convert_multi_byte(chunk& c, const options& opt)
+{
+	memory_buffer mb(c.data, c.size);
+	std::istream is(&mb);
+	unicode::basic_multi_byte_decoder<error_policy> dec(&is, opt.from - encoding_multi_byte);
+	convert(c, opt, dec);
+}
+
+template<class error_policy>
+void convert_from(chunk& c, const options& opt)
+{
+	switch(opt.from)
+	{
+	case encoding_utf8: convert<unicode::basic_utf8_decoder<error_policy> >(c, opt); break;
+	case encoding_utf16le: convert<unicode::utf16_decoder<1234, error_policy> >(c, opt); break;
+	case encoding_utf16be: convert<unicode::utf16_decoder<4321, error_policy> >(c, opt); break;
+	case encoding_utf32le: convert<unicode::utf32_decoder<1234, error_policy> >(c, opt); break;
+	case encoding_utf32be: convert<unicode::utf32_decoder<4321, error_policy> >(c, opt); break;
+	default:
+		if(opt.from >= encoding_single_byte)
+			convert_single_byte<error_policy>(c, opt);
+		else
+			convert_multi_byte<error_policy>(c, opt);
+		break;
+	}
+}
+
+void convert_chunk(chunk* c, const options* opt)
+{
+	switch(opt->on_error)
+	{
+	case error_replace: convert_from<unicode::replace_on_error>(*c, *opt); break;
+	case error_skip: convert_from<unicode::skip_on_error>(*c, *opt); break;
+	case error_stop: convert_from<unicode::stop_on_error>(*c, *opt); break;
+	}
+}
+
+bool parse_options(int argc, char** argv, options& opt)
+{
+	bool have_from = false, have_to = false;
+	vector<const char*> files;
+
+	opt.on_error = error_replace;
+	opt.add_bom = false;
+	opt.strip_bom = false;
+	opt.quiet = false;
+	opt.threads = 1;
+	opt.chunk_size = 4*1024*1024;
+	opt.input = 0;
+	opt.output = 0;
+
+	for(int i=1; i < argc; ++i)
+	{
+		string arg = argv[i];
+
+		if((arg == "-f" || arg == "-t" || arg == "-o" || arg == "-j") && i+1 == argc)
+		{
+			fprintf(stderr, "uconv: %s needs an argument\n", arg.c_str());
+			return false;
+		}
+
+		if(arg == "-f" || arg == "-t")
+		{
+			if(!parse_encoding(argv[++i], arg == "-f" ? opt.from : opt.to))
+			{
+				fprintf(stderr, "uconv: unknown encoding %s\n", argv[i]);
+				return false;
+			}
+
+			(arg == "-f" ? have_from : have_to) = true;
+		}
+		else if(arg == "-o")
+			opt.output = argv[++i];
+		else if(arg == "-j")
+			opt.threads = atoi(argv[++i]);
+		else if(arg.compare(0, 8, "--chunk=") == 0)
+			opt.chunk_size = strtoul(arg.c_str() + 8, 0, 10);
+		else if(arg == "--add-bom")
+			opt.add_bom = true;
+		else if(arg == "--strip-bom")
+			opt.strip_bom = true;
+		else if(arg == "--on-error=replace")
+			opt.on_error = error_replace;
+		else if(arg == "--on-error=skip")
+			opt.on_error = error_skip;
+		else if(arg == "--on-error=stop")
+			opt.on_error = error_stop;
+		else if(arg == "-q")
+			opt.quiet = true;
+		else if(arg == "-h" || arg == "--help")
+			return false;
+		else if(arg.size() > 1 && arg[0] == '-')
+		{
+			fprintf(stderr, "uconv: unknown option %s\n", arg.c_str());
+			return false;
+		}
+		else
+			files.push_back(argv[i]);
+	}
+
+	if(files.size() > 0 && strcmp(files[0], "-") != 0)
+		opt.input = files[0];
+
+	if(files.size() > 1 && !opt.output && strcmp(files[1], "-") != 0)
+		opt.output = files[1];
+
+	if(files.size() > 2 || !have_from || !have_to)
+		return false;
+
+	if(opt.threads < 1)
+		opt.threads = 1;
+
+	if(opt.chunk_size < 16)
+		opt.chunk_size = 16;
+
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	options opt;
+
+	if(!parse_options(argc, argv, opt))
+	{
+		fputs(usage, stderr);
+		return 2;
+	}
+
+	FILE* in = opt.input ? fopen(opt.input, "rb") : stdin;
+	if(!in)
+	{
+		fprintf(stderr, "uconv: can't open %s\n", opt.input);
+		return 2;
+	}
+
+	FILE* out = opt.output ? fopen(opt.output, "wb") : stdout;
+	if(!out)
+	{
+		fprintf(stderr, "uconv: can't create %s\n", opt.output);
+		return 2;
+	}
+
+#ifdef _WIN32
+	_setmode(_fileno(in), _O_BINARY);
+	_setmode(_fileno(out), _O_BINARY);
+#endif
+
+	boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+	boost::uintmax_t bytes_in = 0, bytes_out = 0, chars = 0, errors = 0;
+	int status = 0;
+
+	if(opt.add_bom)
+	{
+		std::ostringstream os;
+		boost::scoped_ptr<unicode::basic_encoder> enc(make_encoder(opt.to, &os));
+		enc->encode(0xFEFF);
+		enc->flush();
+		bytes_out += fwrite(os.str().data(), 1, os.str().size(), out);
+	}
+
+	// Each round reads enough for every thread to have a chunk, converts the chunks
+	// at the same time and writes them out in order. Bytes of a character cut off by
+	// the end of the round are carried over to the next one.
+	vector<char> buf(opt.chunk_size * opt.threads);
+	vector<chunk> chunks(opt.threads);
+	size_t carried = 0;
+	bool first = true, done = false;
+
+	while(!done)
+	{
+		size_t got = carried + fread(&buf[carried], 1, buf.size() - carried, in);
+		bool at_end = got < buf.size();
+
+		if(ferror(in))
+		{
+			fprintf(stderr, "uconv: error reading input\n");
+			status = 2;
+			break;
+		}
+
+		size_t usable = at_end ? got : safe_size(opt.from, &buf[0], got);
+
+		if(usable == 0 && !at_end)
+			usable = got; // Nothing looks like a whole character; let the decoder deal with it.
+
+		// Cut the round into chunks at character boundaries.
+		size_t n = 0;
+		for(size_t pos = 0; pos < usable && n < chunks.size(); ++n)
+		{
+			size_t size = usable - pos;
+
+			if(n+1 < chunks.size() && size > opt.chunk_size)
+				size = safe_size(opt.from, &buf[pos], opt.chunk_size);
+
+			if(size == 0)
+				size = usable - pos;
+
+			chunks[n].data = &buf[pos];
+			chunks[n].size = size;
+			chunks[n].first = first && n == 0;
+			pos += size;
+		}
+
+		if(n == 1)
+		{
+			convert_chunk(&chunks[0], &opt);
+		}
+		else
+		{
+			boost::thread_group threads;
+
+			for(size_t i=0; i < n; ++i)
+				threads.create_thread(boost::bind(convert_chunk, &chunks[i], &opt));
+
+			threads.join_all();
+		}
+
+		for(size_t i=0; i < n; ++i)
+		{
+			bytes_out += fwrite(chunks[i].out.data(), 1, chunks[i].out.size(), out);
+			chars += chunks[i].chars;
+			errors += chunks[i].errors;
+
+			if(chunks[i].error_offset >= 0)
+			{
+				fprintf(stderr, "uconv: malformed input at byte %lu\n",
+					(unsigned long)(bytes_in + (chunks[i].data - &buf[0]) + chunks[i].error_offset));
+				status = 1;
+				done = true;
+				break;
+			}
+		}
+
+		bytes_in += usable;
+		carried = got - usable;
+		memmove(&buf[0], &buf[usable], carried);
+		first = false;
+
+		if(at_end)
+			done = true;
+	}
+
+	if(fflush(out) != 0 || ferror(out))
+	{
+		fprintf(stderr, "uconv: error writing output\n");
+		status = 2;
+	}
+
+	if(opt.input)
+		fclose(in);
+	if(opt.output)
+		fclose(out);
+
+	double secs = boost::chrono::duration<double>(boost::chrono::steady_clock::now() - start).count();
+
+	if(!opt.quiet)
+	{
+		if(secs <= 0)
+			secs = 1e-9;
+
+		fprintf(stderr, "uconv: %lu bytes in, %lu bytes out, %lu code points, %lu errors in %.3f s\n",
+			(unsigned long)bytes_in, (unsigned long)bytes_out, (unsigned long)chars, (unsigned long)errors, secs);
+		fprintf(stderr, "uconv: %.1f MB/s in, %.1f M code points/s\n",
+			bytes_in / secs / (1024*1024), chars / secs / 1000000);
+	}
+
+	return status;
+}
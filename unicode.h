@@ -24,6 +24,43 @@ namespace unicode
 	const int endianness_big = 1;
 	*/
 
+	// Number of bytes following the first byte of a UTF-8 character, given the first byte as an index.
+	const utf8_unit table_extra_bytes[256] = {
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,4,4,4,4,5,5,5,5
+	};
 
+	// Magic values to subtract from the sum of a character's bytes, given its number of extra bytes.
+	// From http://www.unicode.org/Public/PROGRAMS/CVTUTF/ConvertUTF.c
+	const utf32_unit table_offset[6] = {
+		0x00000000UL, 0x00003080UL, 0x000E2080UL,
+		0x03C82080UL, 0xFA082080UL, 0x82082080UL
+	};
+
+	// Decode the UTF-8 character starting at source.
+	inline utf32_unit utf8_to_utf32(const utf8_unit* source)
+	{
+		utf32_unit ret = 0;
+
+		int byte_qty = table_extra_bytes[*source];
+
+		switch(byte_qty)
+		{
+			case 5: ret += *source++; ret <<= 6; // Fall through.
+			case 4: ret += *source++; ret <<= 6; // Fall through.
+			case 3: ret += *source++; ret <<= 6; // Fall through.
+			case 2: ret += *source++; ret <<= 6; // Fall through.
+			case 1: ret += *source++; ret <<= 6; // Fall through.
+			case 0: ret += *source++;
+		}
+
+		return ret - table_offset[byte_qty];
+	}
 
 }
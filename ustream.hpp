@@ -10,9 +10,42 @@
 #include <fstream>
 #include <list>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 #include <boost/cstdint.hpp>
-#include <boost/detail/endian.hpp>
+#include <boost/predef/other/endian.h>
 #include "ustring.hpp"
+#include "utf8_count.hpp"
+#include "utf_convert.hpp"
+#include "normalize.hpp"
+
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+#ifndef BOOST_UNICODE_ENABLE_STATS
+#define BOOST_UNICODE_ENABLE_STATS
+#endif
+#include <boost/chrono.hpp>
+#endif
+
+// Byte order of the machine, as the multi-byte-unit codecs take it (1234 or 4321).
+#if BOOST_ENDIAN_BIG_BYTE
+#define BOOST_UNICODE_BYTE_ORDER 4321
+#else
+#define BOOST_UNICODE_BYTE_ORDER 1234
+#endif
+
+// BOOST_UNICODE_STAT(x) is x when statistics are enabled and nothing otherwise.
+#ifdef BOOST_UNICODE_ENABLE_STATS
+#define BOOST_UNICODE_STAT(x) x
+#else
+#define BOOST_UNICODE_STAT(x)
+#endif
+
+// BOOST_UNICODE_STAT_TIMER(total) adds the time until the end of the enclosing block to total.
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+#define BOOST_UNICODE_STAT_TIMER(total) unicode::stats_timer stats_timer_(total)
+#else
+#define BOOST_UNICODE_STAT_TIMER(total)
+#endif
 
 namespace unicode
 {
@@ -22,39 +55,378 @@ namespace unicode
 
 	using std::ios_base;
 
+	//--------------------------------------------------------------------------------
+	// Error Policies:
+	// These decide what a decoder does with malformed input. They are template
+	// arguments of the decoders so that handling errors costs nothing until one happens.
+	//--------------------------------------------------------------------------------
+
+	// Returned by an error policy to have the decoder drop the malformed input and go on to the next character.
+	const boost::int_fast32_t skip_character = -2;
+
+	// Thrown by throw_on_error.
+	class decode_error : public std::runtime_error
+	{
+	public:
+		decode_error(const char* what, boost::intmax_t _offset) : std::runtime_error(what), off(_offset) {}
+
+		// Byte offset of the malformed input in the stream, or -1 if the stream can't tell.
+		boost::intmax_t offset() const
+		{
+			return off;
+		}
+
+	private:
+		boost::intmax_t off;
+	};
+
+	// Decode malformed input as U+FFFD REPLACEMENT CHARACTER.
+	struct replace_on_error
+	{
+		static boost::int_fast32_t handle(std::istream*, const char*, boost::intmax_t)
+		{
+			return 0xFFFD;
+		}
+	};
+
+	// Drop malformed input.
+	struct skip_on_error
+	{
+		static boost::int_fast32_t handle(std::istream*, const char*, boost::intmax_t)
+		{
+			return skip_character;
+		}
+	};
+
+	// Stop at malformed input. The stream's failbit is set, so it reads as EOF until it
+	// is cleared, and then decoding resumes after the malformed input.
+	struct stop_on_error
+	{
+		static boost::int_fast32_t handle(std::istream* is, const char*, boost::intmax_t)
+		{
+			is->setstate(std::ios_base::failbit);
+			return EOF;
+		}
+	};
+
+	// Throw decode_error on malformed input.
+	struct throw_on_error
+	{
+		static boost::int_fast32_t handle(std::istream*, const char* what, boost::intmax_t offset)
+		{
+			throw decode_error(what, offset);
+		}
+	};
+
+	//--------------------------------------------------------------------------------
+	// Statistics:
+	// Define BOOST_UNICODE_ENABLE_STATS to have decoders, encoders and the streams
+	// built on them count what they do, and BOOST_UNICODE_ENABLE_STATS_TIMING to time
+	// it as well (which reads the clock on every get() and put()). Otherwise nothing is
+	// counted, the counters take no space, and stats() returns all zeros.
+	//--------------------------------------------------------------------------------
+
+	struct stream_stats
+	{
+		boost::uintmax_t bytes_in; // Bytes decoded, malformed or not.
+		boost::uintmax_t bytes_out; // Bytes encoded and written to the stream.
+		boost::uintmax_t code_points_in; // Characters decoded, including replacement characters.
+		boost::uintmax_t code_points_out; // Characters encoded.
+		boost::uintmax_t replacements; // Malformed sequences decoded as U+FFFD.
+		boost::uintmax_t surrogate_errors; // Unpaired surrogates, and surrogates in UTF-8 or UTF-32.
+		boost::uintmax_t refills; // Times a decoder found the stream's buffer empty (every character if it's unbuffered).
+		boost::uintmax_t writes; // Times an encoder wrote its buffer to the stream.
+		double decode_seconds; // Time spent decoding, not counting refills.
+		double encode_seconds; // Time spent encoding, not counting writes.
+		double io_seconds; // Time spent in refills and writes.
+
+		stream_stats() : bytes_in(0), bytes_out(0), code_points_in(0), code_points_out(0), replacements(0),
+			surrogate_errors(0), refills(0), writes(0), decode_seconds(0), encode_seconds(0), io_seconds(0) {}
+
+		stream_stats& operator+=(const stream_stats& s)
+		{
+			bytes_in += s.bytes_in;
+			bytes_out += s.bytes_out;
+			code_points_in += s.code_points_in;
+			code_points_out += s.code_points_out;
+			replacements += s.replacements;
+			surrogate_errors += s.surrogate_errors;
+			refills += s.refills;
+			writes += s.writes;
+			decode_seconds += s.decode_seconds;
+			encode_seconds += s.encode_seconds;
+			io_seconds += s.io_seconds;
+			return *this;
+		}
+	};
+
+#ifdef BOOST_UNICODE_ENABLE_STATS
+	// Looks at the get area of any streambuf. (in_avail() can't tell whether the get
+	// area is empty, because it asks showmanyc() when it is, which may count what's
+	// left in the file.)
+	class streambuf_get_area : public std::streambuf
+	{
+	public:
+		static bool empty(std::streambuf* sb)
+		{
+			char* (std::streambuf::*get)() const = &streambuf_get_area::gptr;
+			char* (std::streambuf::*end)() const = &streambuf_get_area::egptr;
+
+			return (sb->*get)() == (sb->*end)();
+		}
+	};
+#endif
+
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+	// Adds the time between its construction and destruction to a total.
+	class stats_timer
+	{
+	public:
+		stats_timer(double& _total) : total(_total), start(boost::chrono::steady_clock::now()) {}
+
+		~stats_timer()
+		{
+			total += boost::chrono::duration<double>(boost::chrono::steady_clock::now() - start).count();
+		}
+
+	private:
+		double& total;
+		boost::chrono::steady_clock::time_point start;
+	};
+#endif
+
+	// Encoders write into a buffer of their own and hand it to the stream's streambuf
+	// in one sputn() when it fills up, when flush() is called, or when the encoder is
+	// destroyed. Anything written to the std::ostream directly may therefore come out
+	// ahead of characters encoded before it unless the encoder is flushed first.
 	class basic_encoder
 	{
 	protected:
 		std::ostream* os;
+		std::vector<char> buf;
+		std::size_t used; // Number of bytes waiting in buf.
+#ifdef BOOST_UNICODE_ENABLE_STATS
+		stream_stats counters;
+#endif
+
+		// Make room for qty bytes and return where to write them. Call commit() afterwards.
+		boost::uint8_t* reserve(std::size_t qty)
+		{
+			if(buf.size() - used < qty)
+				flush_buffer();
+
+			return (boost::uint8_t*)&buf[used];
+		}
+
+		// Mark the bytes up to (but not including) p as written.
+		void commit(boost::uint8_t* p)
+		{
+			used = (char*)p - &buf[0];
+		}
+
+		// Write the buffer to the stream, without flushing the stream itself.
+		void flush_buffer()
+		{
+			if(!used)
+				return;
+
+			BOOST_UNICODE_STAT(counters.bytes_out += used; ++counters.writes);
+
+			{
+				BOOST_UNICODE_STAT_TIMER(counters.io_seconds);
+
+				if(os->rdbuf()->sputn(&buf[0], used) != (std::streamsize)used)
+					os->setstate(std::ios_base::badbit);
+			}
+
+			used = 0;
+		}
 
 	public:
-		basic_encoder(std::ostream* _os) : os(_os) {}
+		static const std::size_t default_buffer_size = 8192;
+
+		basic_encoder(std::ostream* _os, std::size_t buffer_size=default_buffer_size) : os(_os), buf(buffer_size < 4 ? 4 : buffer_size), used(0) {}
+
+		virtual ~basic_encoder()
+		{
+			flush_buffer();
+		}
+
 		std::ostream* ostream()
 		{
 			return os;
 		}
 
+		// Write everything encoded so far to the stream and flush the stream.
+		void flush()
+		{
+			flush_buffer();
+			os->flush();
+		}
+
+		// What the encoder has done so far. All zeros unless BOOST_UNICODE_ENABLE_STATS is defined.
+		stream_stats stats() const
+		{
+#ifdef BOOST_UNICODE_ENABLE_STATS
+			return counters;
+#else
+			return stream_stats();
+#endif
+		}
+
 		virtual void encode(boost::int_fast32_t ch) = 0;
+
+		// Encode qty characters from p. Encoders with a faster way to do a block override this.
+		virtual void encode_n(const boost::uint32_t* p, std::size_t qty)
+		{
+			for(std::size_t i=0; i < qty; ++i)
+				encode(p[i]);
+		}
 	};
 
 	class basic_decoder
 	{
 	protected:
 		std::istream* is;
+		boost::uintmax_t error_count;
+		boost::intmax_t error_offset;
+
+		// Bytes decoded, and the offset in the stream they're counted from, so errors
+		// can be placed without asking the stream each time. The offset is found from
+		// the stream at the first error, and again after the decoder seeks (-2 if the
+		// stream can't tell). Reading the stream other than through the decoder after
+		// that throws the offsets off.
+		boost::intmax_t bytes_decoded;
+		boost::intmax_t decoded_from;
+		static const boost::intmax_t unknown_offset = -1;
+#ifdef BOOST_UNICODE_ENABLE_STATS
+		stream_stats counters;
+
+		// Count a refill (and time it) if the stream's buffer is empty.
+		void refill()
+		{
+			if(is->rdbuf() && streambuf_get_area::empty(is->rdbuf()))
+			{
+				BOOST_UNICODE_STAT_TIMER(counters.io_seconds);
+				++counters.refills;
+				is->rdbuf()->sgetc();
+			}
+		}
+
+		// Count a character decoded from the given number of bytes.
+		void count(int bytes)
+		{
+			counters.bytes_in += bytes;
+			++counters.code_points_in;
+		}
+
+		// Count malformed input of the given size, and what the error policy made of it.
+		void count_error(int bytes, boost::int_fast32_t ch)
+		{
+			counters.bytes_in += bytes;
+
+			if(ch == 0xFFFD)
+			{
+				++counters.replacements;
+				++counters.code_points_in;
+			}
+		}
+#endif
+
+		// Count an error and remember where it was. consumed is how many bytes of the
+		// malformed input have already been read. Returns the error's byte offset.
+		boost::intmax_t error(int consumed)
+		{
+			++error_count;
+
+			if(decoded_from == unknown_offset)
+			{
+				// Ask the streambuf, which doesn't care whether the stream is at EOF.
+				std::streamoff pos = is->rdbuf() ? (std::streamoff)is->rdbuf()->pubseekoff(0, std::ios_base::cur, std::ios_base::in) : -1;
+				decoded_from = pos < 0 ? -2 : (boost::intmax_t)pos - consumed - bytes_decoded;
+			}
+
+			error_offset = decoded_from < 0 ? -1 : decoded_from + bytes_decoded;
+			bytes_decoded += consumed;
+			return error_offset;
+		}
+
+		// The decoder has sought, so bytes_decoded no longer says where it is.
+		void lost_position()
+		{
+			bytes_decoded = 0;
+			decoded_from = unknown_offset;
+		}
 
 	public:
-		basic_decoder(std::istream* _is) : is(_is) {}
+		basic_decoder(std::istream* _is) : is(_is), error_count(0), error_offset(-1), bytes_decoded(0), decoded_from(unknown_offset) {}
 
 		std::istream* istream()
 		{
 			return is;
 		}
 
+		// Number of malformed sequences decoded so far.
+		boost::uintmax_t errors() const
+		{
+			return error_count;
+		}
+
+		// Byte offset of the most recent malformed sequence, or -1 if there hasn't been one (or the stream can't tell).
+		boost::intmax_t last_error() const
+		{
+			return error_offset;
+		}
+
+		// What the decoder has done so far. All zeros unless BOOST_UNICODE_ENABLE_STATS is defined.
+		stream_stats stats() const
+		{
+#ifdef BOOST_UNICODE_ENABLE_STATS
+			return counters;
+#else
+			return stream_stats();
+#endif
+		}
+
 		virtual boost::int_fast32_t decode() = 0;
 		virtual bool prevg() = 0;
 		virtual bool nextg() = 0;
+
+		// Decode up to qty characters into out, stopping early only at EOF (or where the
+		// error policy stops). Returns the number decoded. Decoders with a faster way to
+		// do a block override this.
+		virtual std::size_t decode_n(boost::uint32_t* out, std::size_t qty)
+		{
+			std::size_t ret = 0;
+
+			for(; ret < qty; ++ret)
+			{
+				boost::int_fast32_t ch = decode();
+
+				if(ch == EOF)
+					break;
+
+				out[ret] = (boost::uint32_t)ch;
+			}
+
+			return ret;
+		}
+
+		// Move get-pointer forward qty characters. Returns the number of characters skipped.
+		virtual int skipg(int qty)
+		{
+			int ret = 0;
+
+			for(; ret < qty && is->peek() != EOF; ++ret)
+				nextg();
+
+			return ret;
+		}
+
 		virtual bool seekg(int off, std::ios_base::seekdir dir=std::ios_base::beg)
 		{
+			lost_position();
+
 			switch(dir)
 			{
 			case std::ios_base::beg:
@@ -79,10 +451,7 @@ namespace unicode
 			}
 			else
 			{
-				while(off--)
-				{
-					nextg();
-				}
+				skipg(off);
 			}
 
 			return true;
@@ -96,13 +465,11 @@ namespace unicode
 	public:
 	};
 
+	// A decoder and an encoder on the same iostream.
 	template<class decoder_type, class encoder_type>
-	class specific_codec : public basic_codec
+	class specific_codec : public decoder_type, public encoder_type
 	{
 	public:
-		decoder_type d;
-		encoder_type e;
-
 		specific_codec(std::iostream* _ios) : decoder_type(_ios), encoder_type(_ios) {}
 	};
 
@@ -135,19 +502,26 @@ namespace unicode
 	template<class unit_type, int byte_order>
 	class basic_mbu_decoder : public basic_decoder
 	{
+	protected:
+		int unit_size; // Number of bytes read by the last get_unit(). This is less than a whole unit at EOF.
+
 	public:
-		basic_mbu_decoder(std::istream* _is) : basic_decoder(_is) {}
+		basic_mbu_decoder(std::istream* _is) : basic_decoder(_is), unit_size(0) {}
 
 		unit_type get_unit()
 		{
 			unit_type tmp;
+			unit_size = 0;
 
-			for(int i=0; i < sizeof(unit_type); ++i)
+			for(std::size_t i=0; i < sizeof(unit_type); ++i)
 			{
-				if(byte_order == BOOST_BYTE_ORDER)
-					((boost::uint8_t*)&tmp)[i] = is->get();
+				int c = is->get();
+				unit_size += (c != EOF);
+
+				if(byte_order == BOOST_UNICODE_BYTE_ORDER)
+					((boost::uint8_t*)&tmp)[i] = c;
 				else // If the source is a different endian than the system,
-					((boost::uint8_t*)&tmp)[sizeof(unit_type)-i-1] = is->get(); // fill tmp backwards.
+					((boost::uint8_t*)&tmp)[sizeof(unit_type)-i-1] = c; // fill tmp backwards.
 			}
 
 			return tmp;
@@ -159,17 +533,21 @@ namespace unicode
 	class basic_mbu_encoder : public basic_encoder
 	{
 	public:
-		basic_mbu_encoder(std::ostream* _os) : basic_encoder(_os) {}
+		basic_mbu_encoder(std::ostream* _os, std::size_t buffer_size=default_buffer_size) : basic_encoder(_os, buffer_size) {}
 
 		void put_unit(boost::int_fast32_t ch)
 		{
-			for(int i=0; i < sizeof(unit_type); ++i)
+			boost::uint8_t* p = reserve(sizeof(unit_type));
+
+			for(std::size_t i=0; i < sizeof(unit_type); ++i)
 			{
-				if(byte_order == BOOST_BYTE_ORDER)
-					os->put(((boost::uint8_t*)&ch)[i]);
+				if(byte_order == BOOST_UNICODE_BYTE_ORDER)
+					p[i] = ((boost::uint8_t*)&ch)[i];
 				else // If the source is a different endian than the system,
-					os->put(((boost::uint8_t*)&ch)[sizeof(unit_type)-i-1]); // read ch backwards.
+					p[i] = ((boost::uint8_t*)&ch)[sizeof(unit_type)-i-1]; // read ch backwards.
 			}
+
+			commit(p + sizeof(unit_type));
 		}
 	};
 
@@ -178,7 +556,7 @@ namespace unicode
 	//--------------------------------------------------------------------------------
 
 	// UTF-32 Decoder
-	template<int byte_order>
+	template<int byte_order, class error_policy=replace_on_error>
 	class utf32_decoder : public basic_mbu_decoder<boost::uint32_t, byte_order>
 	{
 	public:
@@ -187,29 +565,67 @@ namespace unicode
 		// Read until one while character is decoded.
 		boost::int_fast32_t decode()
 		{
-			int pk = is->peek();
+			for(;;)
+			{
+				BOOST_UNICODE_STAT(this->refill());
 
-			if(pk == EOF)
-				return EOF;
+				int pk = this->is->peek();
+
+				if(pk == EOF)
+					return EOF;
+
+				boost::uint32_t ch = this->get_unit();
+				const char* what;
+
+				if(!this->is->good())
+				{
+					what = "Truncated UTF-32 unit.";
+				}
+				else if(ch > 0x10FFFF)
+				{
+					what = "UTF-32 unit out of range.";
+				}
+				else if((ch & 0xFFFFF800) == 0xD800)
+				{
+					what = "Surrogate in UTF-32.";
+					BOOST_UNICODE_STAT(++this->counters.surrogate_errors);
+				}
+				else
+				{
+					BOOST_UNICODE_STAT(this->count(4));
+					this->bytes_decoded += 4;
+					return ch;
+				}
 
-			return get_unit();
+				boost::int_fast32_t ret = error_policy::handle(this->is, what, this->error(this->unit_size));
+				BOOST_UNICODE_STAT(this->count_error(this->unit_size, ret));
+
+				if(ret != skip_character)
+					return ret;
+			}
 		}
 
 		// Skip a character in an input stream.
 		bool nextg()
 		{
-			is->seekg(std::ios::cur, 4);
+			this->lost_position();
+			this->is->seekg(4, std::ios::cur);
+			return true;
 		}
 
 		// Go back a character in an input stream.
 		bool prevg()
 		{
-			is->seekg(std::ios::cur, -4);
+			this->lost_position();
+			this->is->seekg(-4, std::ios::cur);
+			return true;
 		}
 
 		bool seekg(int off, std::ios_base::seekdir dir=std::ios_base::beg)
 		{
-			is->seekg(4*off, dir);
+			this->lost_position();
+			this->is->seekg(4*off, dir);
+			return true;
 		}
 	};
 
@@ -218,12 +634,13 @@ namespace unicode
 	class utf32_encoder : public basic_mbu_encoder<boost::uint32_t, byte_order>
 	{
 	public:
-		utf32_encoder(std::ostream* _os) : basic_mbu_encoder<boost::uint32_t, byte_order>(_os) {}
+		utf32_encoder(std::ostream* _os, std::size_t buffer_size=basic_encoder::default_buffer_size) : basic_mbu_encoder<boost::uint32_t, byte_order>(_os, buffer_size) {}
 
 		// Encode a character and write it to the stream.
 		void encode(boost::int_fast32_t ch)
 		{
-			put_unit(ch);
+			BOOST_UNICODE_STAT(++this->counters.code_points_out);
+			this->put_unit(ch);
 		}
 	};
 
@@ -237,7 +654,7 @@ namespace unicode
 	//--------------------------------------------------------------------------------
 
 	// UTF-16 Decoder
-	template<int byte_order>
+	template<int byte_order, class error_policy=replace_on_error>
 	class utf16_decoder : public basic_mbu_decoder<boost::uint16_t, byte_order>
 	{
 	public:
@@ -246,41 +663,82 @@ namespace unicode
 		// Read until one whole character is decoded.
 		boost::int_fast32_t decode()
 		{
-			int pk = is->peek();
+			for(;;)
+			{
+				BOOST_UNICODE_STAT(this->refill());
 
-			if(pk == EOF)
-				return EOF;
+				int pk = this->is->peek();
 
-			boost::uint16_t ch = get_unit();
+				if(pk == EOF)
+					return EOF;
 
-			if( istream().good() && (ch >= 0xD800 && ch <= 0xDBFF) ) // If ch is the first unit in a surrogate pair...
-			{
-				boost::uint16_t ch2 = get_unit(); // Get the following unit.
+				boost::uint16_t ch = this->get_unit();
+				const char* what;
+				int consumed;
 
-				if( istream().good() && (ch2 >= 0xDC00 && ch2 <= 0xDFFF) ) // If the following unit appropriately completes the surrogate pair...
+				if(!this->is->good())
 				{
-					ch = (boost::uint16_t)((ch - (boost::uint16_t)0xD800) << 10) + (ch2 - (boost::uint16_t)0xDC00) + 0x0010000; // Magic
+					what = "Truncated UTF-16 unit.";
+					consumed = this->unit_size;
+				}
+				else if((ch & 0xF800) != 0xD800) // If ch isn't a surrogate at all...
+				{
+					BOOST_UNICODE_STAT(this->count(2));
+					this->bytes_decoded += 2;
+					return ch;
+				}
+				else if(ch <= 0xDBFF) // If ch is the first unit in a surrogate pair...
+				{
+					boost::uint16_t ch2 = this->get_unit(); // Get the following unit.
+
+					if( this->is->good() && (ch2 >= 0xDC00 && ch2 <= 0xDFFF) ) // If the following unit appropriately completes the surrogate pair...
+					{
+						BOOST_UNICODE_STAT(this->count(4));
+						this->bytes_decoded += 4;
+						return ((ch - (boost::int_fast32_t)0xD800) << 10) + (ch2 - (boost::int_fast32_t)0xDC00) + 0x0010000; // Magic
+					}
+
+					if(this->is->good())
+					{
+						// The following unit is the start of the next character, so leave it for next time.
+						this->is->unget();
+						this->is->unget();
+						consumed = 2;
+					}
+					else
+					{
+						consumed = 2 + this->unit_size;
+					}
+
+					what = "Unpaired surrogate.";
+					BOOST_UNICODE_STAT(++this->counters.surrogate_errors);
 				}
 				else
 				{
-					throw "Unpaired surrogate.";
+					what = "Unpaired surrogate.";
+					consumed = 2;
+					BOOST_UNICODE_STAT(++this->counters.surrogate_errors);
 				}
-			}
 
-			return ch;
+				boost::int_fast32_t ret = error_policy::handle(this->is, what, this->error(consumed));
+				BOOST_UNICODE_STAT(this->count_error(consumed, ret));
+
+				if(ret != skip_character)
+					return ret;
+			}
 		}
 
 
 		bool nextg() // Move get-pointer forward one full character.
 		{
-			return decode() == EOF;
+			return decode() != EOF;
 
 			/*
-			boost::uint16_t ch = get_unit();
+			boost::uint16_t ch = this->get_unit();
 
 			if( istream().good() && (ch >= 0xD800 && ch <= 0xDBFF) )
 			{
-				boost::uint16_t ch2 = get_unit();
+				boost::uint16_t ch2 = this->get_unit();
 
 				if( istream().good() && (ch2 < 0xDC00 || ch2 > 0xDFFF) )
 				{
@@ -291,18 +749,15 @@ namespace unicode
 
 		bool prevg() // Move get-pointer back one full character.
 		{
-			is->seekg(std::ios::cur, -2); // Previous unit.
-			boost::uint16_t ch = get_unit();
+			this->lost_position();
+			this->is->seekg(-2, std::ios::cur); // Previous unit.
+			boost::uint16_t ch = this->get_unit();
+			this->is->seekg(-2, std::ios::cur);
 
-			if(ch < 0xDC00 || ch > 0xDFFF) // If this is the second unit in a surrogate pair...
+			if(ch >= 0xDC00 && ch <= 0xDFFF) // If this is the second unit in a surrogate pair...
 			{
 				// Go back another unit to the first part of the surrogate pair.
-				is->seekg(std::ios::cur, -2); 
-				boost::uint16_t ch = get_unit();
-
-				if(ch < 0xD800 || ch > 0xDBFF)
-				{
-				}
+				this->is->seekg(-2, std::ios::cur);
 			}
 
 			return true;
@@ -314,21 +769,23 @@ namespace unicode
 	class utf16_encoder : public basic_mbu_encoder<boost::uint16_t, byte_order>
 	{
 	public:
-		utf16_encoder(std::ostream* _os) : basic_mbu_encoder<boost::uint16_t, byte_order>(_os) {}
+		utf16_encoder(std::ostream* _os, std::size_t buffer_size=basic_encoder::default_buffer_size) : basic_mbu_encoder<boost::uint16_t, byte_order>(_os, buffer_size) {}
 
 		// Encode a character and write it to the stream.
 		void encode(boost::int_fast32_t ch)
 		{
+			BOOST_UNICODE_STAT(++this->counters.code_points_out);
+
 			if(ch <= 0xFFFF)
 			{
-				put_unit(ch);
+				this->put_unit(ch);
 			}
 			else
 			{
 				ch -= 0x0010000UL;
 
-				put_unit( (boost::uint16_t)(ch >> 10) + 0xD800 );
-				put_unit( (boost::uint16_t)(ch & 0x3FFUL) + 0xDC00 );
+				this->put_unit( (boost::uint16_t)(ch >> 10) + 0xD800 );
+				this->put_unit( (boost::uint16_t)(ch & 0x3FFUL) + 0xDC00 );
 			}
 		}
 	};
@@ -363,72 +820,182 @@ namespace unicode
 		0x03C82080UL, 0xFA082080UL, 0x82082080UL
 	};
 
+	// Smallest character that needs a given number of bytes. Anything smaller is an overlong encoding.
+	const boost::int_fast32_t utf8_minimums_lookup[5] = {
+		0, 0, 0x80, 0x800, 0x10000
+	};
+
 	// UTF-8 Encoder
 	class utf8_encoder : public basic_encoder
 	{
 	public:
-		utf8_encoder(std::ostream* _os) : basic_encoder(_os) {}
+		utf8_encoder(std::ostream* _os, std::size_t buffer_size=default_buffer_size) : basic_encoder(_os, buffer_size) {}
 
 		// Encode a character and write it to the stream.
 		void encode(boost::int_fast32_t ch)
 		{
+			BOOST_UNICODE_STAT(++counters.code_points_out);
+
+			boost::uint8_t* p = reserve(4);
+
 			if(ch < 0x80)
 			{
-				os->put((boost::uint8_t)ch);
+				*p++ = (boost::uint8_t)ch;
 			}
 			else if(ch < 0x800)
 			{
-				os->put((boost::uint8_t)(0xC0 | ch >> 6));
-				os->put((boost::uint8_t)(0x80 | ch & 0x3F));
+				*p++ = (boost::uint8_t)(0xC0 | ch >> 6);
+				*p++ = (boost::uint8_t)(0x80 | (ch & 0x3F));
 			}
 			else if(ch < 0x10000)
 			{
-				os->put((boost::uint8_t)(0xE0 | ch >> 12));
-				os->put((boost::uint8_t)(0x80 | ch >> 6 & 0x3F));
-				os->put((boost::uint8_t)(0x80 | ch & 0x3F));
+				*p++ = (boost::uint8_t)(0xE0 | ch >> 12);
+				*p++ = (boost::uint8_t)(0x80 | ((ch >> 6) & 0x3F));
+				*p++ = (boost::uint8_t)(0x80 | (ch & 0x3F));
 			}
 			else if(ch < 0x200000)
 			{
-				os->put((boost::uint8_t)(0xF0 | ch >> 18));
-				os->put((boost::uint8_t)(0x80 | ch >> 12 & 0x3F));
-				os->put((boost::uint8_t)(0x80 | ch >> 6 & 0x3F));
-				os->put((boost::uint8_t)(0x80 | ch & 0x3F));
+				*p++ = (boost::uint8_t)(0xF0 | ch >> 18);
+				*p++ = (boost::uint8_t)(0x80 | ((ch >> 12) & 0x3F));
+				*p++ = (boost::uint8_t)(0x80 | ((ch >> 6) & 0x3F));
+				*p++ = (boost::uint8_t)(0x80 | (ch & 0x3F));
+			}
+
+			commit(p);
+		}
+
+		// Encode qty characters from p, a buffer at a time (see utf_convert.hpp). Values
+		// that aren't characters (surrogates, or above U+10FFFF) are written as U+FFFD.
+		void encode_n(const boost::uint32_t* p, std::size_t qty)
+		{
+			BOOST_UNICODE_STAT(counters.code_points_out += qty);
+
+			while(qty)
+			{
+				std::size_t n = qty < buf.size() / 4 ? qty : buf.size() / 4;
+				commit(utf32_to_utf8(p, p + n, reserve(n * 4)));
+				p += n;
+				qty -= n;
 			}
 		}
 	};
 
 	// UTF-8 Decoder
-	class utf8_decoder : public basic_decoder
+	template<class error_policy=replace_on_error>
+	class basic_utf8_decoder : public basic_decoder
 	{
 	public:
-		utf8_decoder(std::istream* _is) : basic_decoder(_is) {}
+		basic_utf8_decoder(std::istream* _is) : basic_decoder(_is) {}
 
 		// Read until one character is decoded.
 		boost::int_fast32_t decode()
 		{
-			int pk = is->peek();
+			for(;;)
+			{
+				BOOST_UNICODE_STAT(refill());
 
-			if(pk == EOF)
-				return EOF;
+				int pk = is->get();
 
-			int ret = 0;
-			int len = utf8_character_sizes_lookup[pk];
+				if(pk == EOF)
+					return EOF;
 
-			switch(len)
-			{
-				case 6: ret += is->get(); ret <<= 6;
-				case 5: ret += is->get(); ret <<= 6;
-				case 4: ret += is->get(); ret <<= 6;
-				case 3: ret += is->get(); ret <<= 6;
-				case 2: ret += is->get(); ret <<= 6;
-				case 1: ret += is->get();
+				if(pk < 0x80) // ASCII needs no more work.
+				{
+					BOOST_UNICODE_STAT(count(1));
+					++bytes_decoded;
+					return pk;
+				}
+
+				boost::int_fast32_t ret = pk;
+				int len = utf8_character_sizes_lookup[pk];
+				int consumed = 1;
+				const char* what = 0;
+
+				if(len == 1 || len > 4)
+				{
+					what = "Invalid UTF-8 first byte.";
+				}
+				else
+				{
+					for(; consumed < len; ++consumed)
+					{
+						int c = is->get();
+
+						if((c & 0xC0) != 0x80) // Also true for EOF.
+						{
+							if(c != EOF)
+								is->unget(); // This byte starts the next character.
+
+							what = "Truncated UTF-8 sequence.";
+							break;
+						}
+
+						ret = (ret << 6) + c;
+					}
+
+					if(!what)
+					{
+						ret -= utf8_magic_offsets_lookup[len-1];
+
+						if(ret >= utf8_minimums_lookup[len] && ret <= 0x10FFFF && (ret & 0xFFFFF800) != 0xD800)
+						{
+							BOOST_UNICODE_STAT(count(len));
+							bytes_decoded += len;
+							return ret;
+						}
+
+						if(ret < utf8_minimums_lookup[len])
+						{
+							what = "Overlong UTF-8 sequence.";
+						}
+						else if(ret > 0x10FFFF)
+						{
+							what = "UTF-8 sequence out of range.";
+						}
+						else
+						{
+							what = "Surrogate in UTF-8.";
+							BOOST_UNICODE_STAT(++counters.surrogate_errors);
+						}
+					}
+				}
+
+				ret = error_policy::handle(this->is, what, this->error(consumed));
+				BOOST_UNICODE_STAT(count_error(consumed, ret));
+
+				if(ret != skip_character)
+					return ret;
 			}
+		}
 
-			ret -= utf8_magic_offsets_lookup[len-1];
+		// Decode up to qty characters into out. ASCII is taken from the streambuf
+		// directly, rather than a byte at a time through the std::istream.
+		std::size_t decode_n(boost::uint32_t* out, std::size_t qty)
+		{
+			std::streambuf* sb = is->rdbuf();
+			std::size_t ret = 0;
 
-			if(ret >=0xD800 && ret <= 0xDFFF)
+			while(ret < qty)
 			{
-				ret = 0x0000FFFD;
+				BOOST_UNICODE_STAT(refill());
+
+				int c = sb && is->good() ? sb->sgetc() : EOF;
+
+				if(c != EOF && c < 0x80)
+				{
+					sb->sbumpc();
+					BOOST_UNICODE_STAT(count(1));
+					++bytes_decoded;
+					out[ret++] = c;
+					continue;
+				}
+
+				boost::int_fast32_t ch = decode(); // Also sets the stream's state at EOF.
+
+				if(ch == EOF)
+					break;
+
+				out[ret++] = (boost::uint32_t)ch;
 			}
 
 			return ret;
@@ -438,11 +1005,53 @@ namespace unicode
 		bool nextg()
 		{
 			int c = is->get();
-			is->seekg(std::ios::cur, utf8_character_sizes_lookup[c]);
 
+			if(c == EOF)
+				return false;
+
+			is->ignore(utf8_character_sizes_lookup[c] - 1); // The bytes after the first. (Reading them works on pipes too.)
+			bytes_decoded += 1 + is->gcount();
 			return true;
 		}
 
+		// Skip qty characters in an input stream, counting whole blocks at a time
+		// rather than decoding each character. That reads past the last character
+		// skipped and seeks back, so a stream that can't seek (a pipe, std::cin) is
+		// stepped through a character at a time instead.
+		int skipg(int qty)
+		{
+			if(qty <= 0)
+				return 0;
+
+			if(is->tellg() < 0)
+				return basic_decoder::skipg(qty);
+
+			lost_position();
+			boost::uint8_t buf[4096];
+			std::size_t left = qty;
+
+			for(;;)
+			{
+				is->read((char*)buf, sizeof(buf));
+				std::streamsize got = is->gcount();
+
+				if(!got)
+					break;
+
+				const boost::uint8_t* stop = utf8_advance(buf, buf+got, left);
+
+				if(stop != buf+got)
+				{
+					// Went too far; go back to the start of the next character.
+					is->clear();
+					is->seekg(stop - (buf+got), std::ios_base::cur);
+					break;
+				}
+			}
+
+			return qty - (int)left;
+		}
+
 		// Go back a character in an input stream.
 		bool prevg()
 		{
@@ -451,14 +1060,20 @@ namespace unicode
 			do
 			{
 				is->unget();
+				--bytes_decoded;
 				tmp = is->peek();
 			}
 			while(tmp > 0x7F && tmp < 0xC0); // All bytes in a character after the first byte are in this range.
 
+			if(is->fail())
+				lost_position();
+
 			return true;
 		}
 	};
 
+	typedef basic_utf8_decoder<> utf8_decoder; // UTF-8 Decoder
+
 
 	// Codecs for each combination decoder and encoder.
 	typedef specific_codec<utf8_decoder, utf8_encoder> utf8_codec;
@@ -468,6 +1083,161 @@ namespace unicode
 	typedef specific_codec<utf32be_decoder, utf32be_encoder> utf32be_codec;
 
 
+	//================================================================================
+	// Normalizing
+	//================================================================================
+
+	// A decoder that normalizes what another decoder decodes, so it can go between a
+	// decoder and an encoder (as in specific_uistream<normalizing_decoder<utf8_decoder> >).
+	// Characters are read a segment at a time, up to the next character that can't
+	// change when normalized, and a character followed by one of those is passed
+	// straight through. Long segments are cut before a character that normalizing can
+	// start over at (see max_normalization_segment), and long runs of non-starters
+	// have a COMBINING GRAPHEME JOINER put in them (see max_nonstarters).
+	// It can only go back over characters of the segment it has normalized, which is
+	// always at least the last one (enough for peek() and unget()), and only seek from
+	// the beginning or the end.
+	template<class decoder_type, normalization_form form=nfc>
+	class normalizing_decoder : public basic_decoder
+	{
+	protected:
+		static const boost::int_fast32_t none = -2;
+
+		decoder_type src;
+		std::vector<boost::uint32_t> input; // The segment being normalized.
+		std::vector<boost::uint32_t> output; // Normalized characters waiting to be returned.
+		std::size_t next; // The next one of them to return.
+		boost::int_fast32_t ahead; // A character already read from src, or none.
+		std::vector<boost::uint32_t> scratch; // For get_segment_edges().
+
+		boost::int_fast32_t read()
+		{
+			boost::int_fast32_t ret = ahead;
+
+			if(ret == none)
+			{
+				ret = src.decode();
+
+				// The source's errors (and stats) are ours.
+				error_count = src.errors();
+				error_offset = src.last_error();
+				BOOST_UNICODE_STAT(counters = src.stats());
+			}
+
+			ahead = none;
+			return ret;
+		}
+
+	public:
+		normalizing_decoder(std::istream* _is) : basic_decoder(_is), src(_is), next(0), ahead(none) {}
+
+		decoder_type& source()
+		{
+			return src;
+		}
+
+		boost::int_fast32_t decode()
+		{
+			if(next < output.size())
+				return output[next++];
+
+			boost::int_fast32_t ch = read();
+
+			if(ch == EOF)
+				return EOF;
+
+			input.clear();
+			input.push_back(ch);
+
+			std::size_t nonstarters = 0; // Non-starters in a row at the end of the segment, once decomposed.
+
+			if(is_normalization_boundary(ch, form))
+			{
+				ahead = read();
+
+				if(ahead == EOF || is_normalization_boundary(ahead, form))
+				{
+					// Kept so prevg() can go back over it.
+					output.assign(1, (boost::uint32_t)ch);
+					next = 1;
+					return ch;
+				}
+			}
+			else
+			{
+				nonstarters = get_segment_edges(ch, form, scratch).trailing;
+			}
+
+			for(;;)
+			{
+				if(ahead == none)
+					ahead = read();
+
+				if(ahead == EOF || is_normalization_boundary(ahead, form))
+					break;
+
+				segment_edges edges = get_segment_edges(ahead, form, scratch);
+
+				if(edges.can_start && input.size() >= max_normalization_segment)
+					break;
+
+				if(nonstarters + edges.leading > max_nonstarters)
+				{
+					// The joiner is a starter that nothing composes with, so the segment can end with it.
+					input.push_back(combining_grapheme_joiner);
+					break;
+				}
+
+				nonstarters = edges.leading == scratch.size() ? nonstarters + edges.leading : edges.trailing;
+				input.push_back(ahead);
+				ahead = none;
+			}
+
+			output.clear();
+			normalize(&input[0], &input[0] + input.size(), form, output);
+			next = 1;
+			return output[0];
+		}
+
+		bool prevg()
+		{
+			if(!next)
+				return false;
+
+			--next;
+			return true;
+		}
+
+		bool nextg()
+		{
+			return decode() != EOF;
+		}
+
+		int skipg(int qty)
+		{
+			int ret = 0;
+
+			for(; ret < qty && decode() != EOF; ++ret);
+
+			return ret;
+		}
+
+		// Only the beginning and end can be sought, plus going forward from them.
+		bool seekg(int off, std::ios_base::seekdir dir=std::ios_base::beg)
+		{
+			if(off < 0 || dir == std::ios_base::cur)
+				return false;
+
+			output.clear();
+			next = 0;
+			ahead = none;
+			src.seekg(0, dir);
+			skipg(off);
+			return true;
+		}
+	};
+
+
 	//================================================================================
 	// Stream Stuff
 	//================================================================================
@@ -482,10 +1252,16 @@ namespace unicode
 		decoder_type* dec;
 		boost::uintmax_t gpos;
 		int gcnt;
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+		double decode_seconds; // Including refills.
+#endif
 
 	public:
 		uistream(decoder_type* _dec) : dec(_dec), gpos(0)
 		{
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+			decode_seconds = 0;
+#endif
 		}
 
 		decoder_type* decoder(decoder_type* nd)
@@ -502,29 +1278,54 @@ namespace unicode
 
 		boost::int_fast32_t get()
 		{
+			BOOST_UNICODE_STAT_TIMER(decode_seconds);
+
 			boost::int_fast32_t ret = dec->decode();
-			++gpos;
-			gcnt = 1;
+			gcnt = ret != EOF;
+			gpos += gcnt;
 			return ret;
 		}
 
 		uistream& get(boost::int_fast32_t& c)
 		{
 			c = get();
-			++gpos;
-			gcnt = 1;
 			return *this;
 		}
 
 		uistream& ignore(int qty=1, boost::int_fast32_t delim=EOF)
 		{
-			while(qty-- || get() == delim);
+			BOOST_UNICODE_STAT_TIMER(decode_seconds);
+
+			if(delim == EOF)
+			{
+				// There's no delimiter to look for, so let the decoder skip in bulk.
+				gcnt = dec->skipg(qty);
+				gpos += gcnt;
+				return *this;
+			}
+
+			for(gcnt=0; gcnt < qty; )
+			{
+				boost::int_fast32_t ch = dec->decode();
+
+				if(ch == EOF)
+					break;
+
+				++gcnt;
+
+				if(ch == delim)
+					break;
+			}
+
+			gpos += gcnt;
+			return *this;
 		}
 
 		uistream& unget()
 		{
-			dec->prevg();
-			--gpos;
+			if(dec->prevg())
+				--gpos;
+
 			gcnt = 0;
 			return *this;
 		}
@@ -532,13 +1333,23 @@ namespace unicode
 		boost::int_fast32_t peek()
 		{
 			boost::int_fast32_t ret = get();
-			unget();
+
+			if(ret != EOF)
+				unget();
+
 			return ret;
 		}
 
 		uistream& seekg(int off, std::ios_base::seekdir dir=std::ios_base::beg)
 		{
-			dec->seekg(off, dir);
+			if(!dec->seekg(off, dir))
+				return *this;
+
+			if(dir == std::ios_base::beg)
+				gpos = off;
+			else if(dir == std::ios_base::cur)
+				gpos += off;
+
 			return *this;
 		}
 
@@ -552,17 +1363,43 @@ namespace unicode
 			return gcnt;
 		}
 
-		uistream& getline(ustring<decoder_type>& s, int qty, boost::int_fast32_t delim='\n')
+		// Number of malformed sequences the decoder has come across.
+		boost::uintmax_t errors()
+		{
+			return dec->errors();
+		}
+
+		// Byte offset of the most recent malformed sequence, or -1 if there hasn't been one.
+		boost::intmax_t last_error()
+		{
+			return dec->last_error();
+		}
+
+		// What the stream has read so far. All zeros unless BOOST_UNICODE_ENABLE_STATS is defined.
+		stream_stats stats()
+		{
+			stream_stats ret = static_cast<basic_decoder*>(dec)->stats();
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+			ret.decode_seconds = decode_seconds - ret.io_seconds;
+#endif
+			return ret;
+		}
+
+		// Append up to qty characters to s (e.g. a basic_ustring), stopping after delim or at EOF.
+		template<class tpl_string>
+		uistream& getline(tpl_string& s, int qty, boost::int_fast32_t delim='\n')
 		{
 			while(qty--)
 			{
 				boost::int_fast32_t ch = get();
 
-				if(ch == delim)
+				if(ch == EOF || ch == delim)
 					break;
 
-				s.append(ch);
+				s.append((boost::uint32_t)ch);
 			}
+
+			return *this;
 		}
 	};
 
@@ -572,10 +1409,16 @@ namespace unicode
 	protected:
 		encoder_type* enc;
 		boost::uintmax_t ppos;
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+		double encode_seconds; // Including writes.
+#endif
 
 	public:
 		uostream(encoder_type* _enc) : enc(_enc), ppos(0)
 		{
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+			encode_seconds = 0;
+#endif
 		}
 
 		encoder_type* encoder(encoder_type* nd)
@@ -592,7 +1435,19 @@ namespace unicode
 
 		uostream& put(boost::int_fast32_t ch)
 		{
+			BOOST_UNICODE_STAT_TIMER(encode_seconds);
+
 			enc->encode(ch);
+			++ppos;
+			return *this;
+		}
+
+		// Write out everything put so far.
+		uostream& flush()
+		{
+			BOOST_UNICODE_STAT_TIMER(encode_seconds);
+
+			enc->flush();
 			return *this;
 		}
 
@@ -600,6 +1455,16 @@ namespace unicode
 		{
 			return ppos;
 		}
+
+		// What the stream has written so far. All zeros unless BOOST_UNICODE_ENABLE_STATS is defined.
+		stream_stats stats()
+		{
+			stream_stats ret = static_cast<basic_encoder*>(enc)->stats();
+#ifdef BOOST_UNICODE_ENABLE_STATS_TIMING
+			ret.encode_seconds = encode_seconds - ret.io_seconds;
+#endif
+			return ret;
+		}
 	};
 
 	template<class codec_type>
@@ -609,7 +1474,7 @@ namespace unicode
 		codec_type* cod;
 
 	public:
-		ustream(codec_type* _c) : cod(_c), uistream<codec_type>(_c), uostream<codec_type>(_c)
+		ustream(codec_type* _c) : uistream<codec_type>(_c), uostream<codec_type>(_c), cod(_c)
 		{
 		}
 
@@ -625,6 +1490,14 @@ namespace unicode
 			return cod;
 		}
 
+		// What the stream has read and written so far.
+		stream_stats stats()
+		{
+			stream_stats ret = uistream<codec_type>::stats();
+			ret += uostream<codec_type>::stats();
+			return ret;
+		}
+
 		ustream& seekp(int off, std::ios_base::seekdir dir=std::ios_base::beg)
 		{
 			/*
@@ -656,7 +1529,7 @@ namespace unicode
 		decoder_type sd;
 
 	public:
-		specific_uistream(std::istream* _is) : sd(_is), uistream<decoder_type>(&sd) {}
+		specific_uistream(std::istream* _is) : uistream<decoder_type>(&sd), sd(_is) {}
 	};
 
 	// Specific-encoding Unicode Output Stream
@@ -667,7 +1540,7 @@ namespace unicode
 		encoder_type se;
 
 	public:
-		specific_uostream(std::ostream* _os) : se(_os), uostream<encoder_type>(&se) {}
+		specific_uostream(std::ostream* _os, std::size_t buffer_size=basic_encoder::default_buffer_size) : uostream<encoder_type>(&se), se(_os, buffer_size) {}
 	};
 
 	// Specific-encoding(s) Unicode I/O Stream
@@ -678,7 +1551,7 @@ namespace unicode
 		codec_type sc;
 
 	public:
-		specific_ustream(std::iostream* _ios) : sc(_ios), ustream<codec_type>(&sc) {}
+		specific_ustream(std::iostream* _ios) : ustream<codec_type>(&sc), sc(_ios) {}
 	};
 
 	// All of the specific Unicode streams:
@@ -697,12 +1570,25 @@ namespace unicode
 	typedef specific_uistream<utf32be_decoder> utf32be_uistream; // UTF-32 Big-Endian Input Stream
 	typedef specific_uostream<utf32be_encoder> utf32be_uostream; // UTF-32 Big-Endian Output Stream
 	typedef specific_ustream<utf32be_codec> utf32be_ustream; // UTF-32 Big-Endian I/O Stream
+	typedef specific_uistream<normalizing_decoder<utf8_decoder, nfc> > utf8_nfc_uistream; // UTF-8 Input Stream normalized to NFC
+	typedef specific_uistream<normalizing_decoder<utf8_decoder, nfd> > utf8_nfd_uistream; // UTF-8 Input Stream normalized to NFD
 
 
 	//================================================================================
 	// This overlays file specific features to a Unicode stream class.
 	//================================================================================
 
+	// Write out an output stream's buffered characters. Does nothing for input-only streams.
+	template<class encoder_type>
+	void flush_ustream(uostream<encoder_type>* s)
+	{
+		s->flush();
+	}
+
+	inline void flush_ustream(const void*)
+	{
+	}
+
 	template<class specific_ustream_type, class fstream_type>
 	class specific_ufstream : public specific_ustream_type
 	{
@@ -719,11 +1605,26 @@ namespace unicode
 			open(filename);
 		}
 
+		~specific_ufstream()
+		{
+			// fs goes before the encoder does, so the encoder can't wait until then to write its buffer.
+			close();
+		}
+
 		void open(const char* filename)
 		{
 			fs.open(filename, std::ios_base::binary);
 		}
 
+		void close()
+		{
+			if(fs.is_open())
+			{
+				flush_ustream(this);
+				fs.close();
+			}
+		}
+
 		void is_open()
 		{
 			return fs.is_open();
@@ -0,0 +1,267 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_USTREAMBUF_HPP
+#define BOOST_UNICODE_USTREAMBUF_HPP
+
+#include <streambuf>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include "ustream.hpp"
+
+#if !defined(BOOST_NO_CXX11_CHAR16_T) && !defined(BOOST_NO_CXX11_CHAR32_T)
+#define BOOST_UNICODE_HAS_USTREAMBUF
+
+namespace unicode
+{
+	//================================================================================
+	// A std::basic_streambuf of char32_t (UTF-32) or char16_t (UTF-16) on top of any
+	// decoder and/or encoder, so std::basic_istream, std::basic_ostream and
+	// istreambuf_iterator can read and write text in any encoding. Characters are
+	// decoded and encoded a buffer at a time, with decode_n() and encode_n().
+	//
+	// Unformatted input and output (get, read, write, the iterators...) work as they
+	// are; >> and << need locale facets for the character type that the standard
+	// libraries don't provide. Seeking isn't supported. The decoder and encoder must
+	// outlive the streambuf.
+	//================================================================================
+
+	template<class tpl_char>
+	class basic_ustreambuf : public std::basic_streambuf<tpl_char>
+	{
+	public:
+		typedef std::basic_streambuf<tpl_char> base_type;
+		typedef typename base_type::traits_type traits_type;
+		typedef typename base_type::int_type int_type;
+
+		static const std::size_t default_buffer_size = 4096; // In code units.
+
+		// Read through dec and write through enc. Either may be 0 (e.g. basic_ustreambuf(0, &enc)
+		// only writes).
+		basic_ustreambuf(basic_decoder* _dec, basic_encoder* _enc=0, std::size_t buffer_size=default_buffer_size)
+			: dec(_dec), enc(_enc), gbuf(_dec ? (buffer_size < 2 ? 2 : buffer_size) : 0), pbuf(_enc ? (buffer_size < 2 ? 2 : buffer_size) : 0)
+		{
+			if(enc)
+				this->setp(&pbuf[0], &pbuf[0] + pbuf.size());
+		}
+
+		// Hands whatever is left to the encoder (which writes it out when it's flushed or destroyed).
+		~basic_ustreambuf()
+		{
+			if(enc)
+				put_units(true);
+		}
+
+		basic_decoder* decoder()
+		{
+			return dec;
+		}
+
+		basic_encoder* encoder()
+		{
+			return enc;
+		}
+
+	protected:
+		int_type underflow()
+		{
+			if(this->gptr() != this->egptr())
+				return traits_type::to_int_type(*this->gptr());
+
+			if(!dec)
+				return traits_type::eof();
+
+			std::size_t got = decode_units(&gbuf[0], gbuf.size());
+			this->setg(&gbuf[0], &gbuf[0], &gbuf[0] + got);
+
+			return got ? traits_type::to_int_type(gbuf[0]) : traits_type::eof();
+		}
+
+		std::streamsize xsgetn(tpl_char* s, std::streamsize n)
+		{
+			std::streamsize ret = 0;
+
+			while(ret < n)
+			{
+				std::streamsize avail = this->egptr() - this->gptr();
+
+				if(avail)
+				{
+					std::streamsize qty = avail < n - ret ? avail : n - ret;
+					traits_type::copy(s + ret, this->gptr(), (std::size_t)qty);
+					this->gbump((int)qty);
+					ret += qty;
+				}
+				else if(dec && n - ret >= (std::streamsize)gbuf.size())
+				{
+					// Decode big reads straight into s.
+					std::size_t got = decode_units(s + ret, gbuf.size());
+
+					if(!got)
+						break;
+
+					ret += got;
+				}
+				else if(traits_type::eq_int_type(underflow(), traits_type::eof()))
+				{
+					break;
+				}
+			}
+
+			return ret;
+		}
+
+		int_type overflow(int_type c)
+		{
+			if(!enc)
+				return traits_type::eof();
+
+			put_units(false);
+
+			if(!traits_type::eq_int_type(c, traits_type::eof()))
+			{
+				*this->pptr() = traits_type::to_char_type(c);
+				this->pbump(1);
+			}
+
+			return traits_type::not_eof(c);
+		}
+
+		std::streamsize xsputn(const tpl_char* s, std::streamsize n)
+		{
+			if(!enc)
+				return 0;
+
+			// Small writes go through the put area.
+			if(n < (std::streamsize)pbuf.size())
+				return base_type::xsputn(s, n);
+
+			std::streamsize ret = n;
+			put_units(false);
+
+			// A high surrogate held back from the put area goes first.
+			while(this->pptr() != this->pbase() && n)
+			{
+				*this->pptr() = *s++;
+				this->pbump(1);
+				--n;
+				put_units(false);
+			}
+
+			// Big writes are encoded straight from s.
+			std::size_t done = encode_units(s, (std::size_t)n, false);
+			traits_type::copy(this->pptr(), s + done, (std::size_t)n - done);
+			this->pbump((int)(n - done));
+
+			return ret;
+		}
+
+		int sync()
+		{
+			if(!enc)
+				return 0;
+
+			put_units(false);
+			enc->flush();
+
+			return enc->ostream()->bad() ? -1 : 0;
+		}
+
+	private:
+		// Encode the put area, except (unless final) a high surrogate at the end of it
+		// that may yet be paired.
+		void put_units(bool final)
+		{
+			std::size_t qty = this->pptr() - this->pbase();
+			std::size_t done = encode_units(this->pbase(), qty, final);
+
+			traits_type::move(&pbuf[0], this->pbase() + done, qty - done);
+			this->setp(&pbuf[0], &pbuf[0] + pbuf.size());
+			this->pbump((int)(qty - done));
+		}
+
+		std::size_t decode_units(char32_t* out, std::size_t qty)
+		{
+			return dec->decode_n((boost::uint32_t*)out, qty);
+		}
+
+		std::size_t decode_units(char16_t* out, std::size_t qty)
+		{
+			// Half as many characters as there's room for, in case they're all surrogate pairs.
+			points.resize(qty / 2);
+			std::size_t got = dec->decode_n(&points[0], points.size());
+			char16_t* p = out;
+
+			for(std::size_t i=0; i < got; ++i)
+			{
+				boost::uint32_t ch = points[i];
+
+				if(ch <= 0xFFFF)
+				{
+					*p++ = (char16_t)ch;
+				}
+				else
+				{
+					ch -= 0x10000;
+					*p++ = (char16_t)((ch >> 10) + 0xD800);
+					*p++ = (char16_t)((ch & 0x3FF) + 0xDC00);
+				}
+			}
+
+			return p - out;
+		}
+
+		// Encode qty units from p. Returns how many were used.
+		std::size_t encode_units(const char32_t* p, std::size_t qty, bool)
+		{
+			enc->encode_n((const boost::uint32_t*)p, qty);
+			return qty;
+		}
+
+		// Encode qty units from p, pairing surrogates. Unpaired ones become U+FFFD, except
+		// (unless final) a high surrogate at the end, which isn't used.
+		std::size_t encode_units(const char16_t* p, std::size_t qty, bool final)
+		{
+			std::size_t i = 0;
+			points.clear();
+
+			for(; i < qty; ++i)
+			{
+				boost::uint32_t ch = p[i];
+
+				if((ch & 0xF800) == 0xD800) // If ch is a surrogate...
+				{
+					if(ch <= 0xDBFF && i + 1 < qty && (p[i+1] & 0xFC00) == 0xDC00)
+						ch = ((ch - 0xD800) << 10) + (p[++i] - 0xDC00) + 0x10000;
+					else if(ch <= 0xDBFF && i + 1 == qty && !final)
+						break;
+					else
+						ch = 0xFFFD;
+				}
+
+				points.push_back(ch);
+			}
+
+			if(!points.empty())
+				enc->encode_n(&points[0], points.size());
+
+			return i;
+		}
+
+		basic_decoder* dec;
+		basic_encoder* enc;
+		std::vector<tpl_char> gbuf; // Get area.
+		std::vector<tpl_char> pbuf; // Put area.
+		std::vector<boost::uint32_t> points; // Characters on their way between the areas and dec or enc.
+	};
+
+	typedef basic_ustreambuf<char32_t> u32streambuf; // UTF-32 Stream Buffer
+	typedef basic_ustreambuf<char16_t> u16streambuf; // UTF-16 Stream Buffer
+}
+
+#endif
+
+#endif
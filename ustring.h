@@ -1,6 +1,9 @@
 #pragma once
 
 #include "unicode.h"
+#include "utf8_count.hpp"
+#include "utf8_search.hpp"
+#include "utf_convert.hpp"
 
 namespace unicode
 {
@@ -13,17 +16,24 @@ namespace unicode
 		public:
 			iterator()
 			{
+				last = 0;
 			}
 
 			iterator(utf8_unit *p)
 			{
 				ptr = p;
+				last = 0;
 			}
 
-			utf32_unit operator*()
+			// An iterator that knows where the string ends can skip whole blocks in operator+.
+			iterator(utf8_unit *p, utf8_unit *e)
 			{
-				int tmp = table_extra_bytes[*ptr];
+				ptr = p;
+				last = e;
+			}
 
+			utf32_unit operator*()
+			{
 				return utf8_to_utf32(ptr);
 			}
 
@@ -62,35 +72,49 @@ namespace unicode
 			{
 				iterator tmp = *this;
 
+				if(last)
+				{
+					std::size_t qty = op;
+					tmp.ptr = (utf8_unit*)utf8_advance(ptr, last, qty);
+					return tmp;
+				}
+
 				while(op--)
 					tmp++;
 
 				return tmp;
 			}
 
+			// Pointer to the first byte of the current character.
+			utf8_unit* base() const
+			{
+				return ptr;
+			}
+
 		private:
 			utf8_unit* ptr;
+			utf8_unit* last; // End of the string, or 0 if unknown.
 		};
 
-		ustring()
+		basic_ustring()
 		{
 			length = 0;
 		}
 
 		template<class tpl>
-		ustring(tpl& t)
+		basic_ustring(tpl& t)
 		{
 			length = 0;
 			append(t);
 		}
 
-		ustring& operator +=(utf32_unit op)
+		basic_ustring& operator +=(utf32_unit op)
 		{
 			append(op);
 			return (*this);
 		}
 
-		int compare(const ustring& with) const
+		int compare(const basic_ustring& with) const
 		{
 			iterator i=begin();
 			iterator j=with.begin();
@@ -103,26 +127,31 @@ namespace unicode
 					return 1; // Greater than
 			}
 
+			if(i != end())
+				return 1; // with is a prefix of this.
+			else if(j != with.end())
+				return -1; // This is a prefix of with.
+
 			return 0; // Equal
 		}
 
-		bool operator ==(const ustring& op) const
+		bool operator ==(const basic_ustring& op) const
 		{
 			return compare(op) == 0;
 		}
 
-		bool operator <(const ustring& op) const
+		bool operator <(const basic_ustring& op) const
 		{
 			return compare(op) < 0;
 		}
 
-		bool operator >(const ustring& op) const
+		bool operator >(const basic_ustring& op) const
 		{
 			return compare(op) > 0;
 		}
 
 		template<class tpl>
-		ustring& operator =(tpl t)
+		basic_ustring& operator =(tpl t)
 		{
 			assign(t);
 			return *this;
@@ -130,7 +159,7 @@ namespace unicode
 
 		iterator begin() const
 		{
-			return iterator((utf8_unit*)&*data.begin());
+			return iterator((utf8_unit*)&*data.begin(), (utf8_unit*)&*data.end());
 		}
 
 		iterator end() const
@@ -142,13 +171,56 @@ namespace unicode
 		{
 			assert(pos < length);
 
-			iterator ret=begin();
-			for(int i=0; i < pos; ++i)
-			{
-				++ret;
-			}
+			return begin() + pos;
+		}
+
+		// Find the first occurrence of what at or after from. Returns end() if there is none.
+		// Only the UTF-8 bytes are compared; use position() for the character index.
+		iterator find(const basic_ustring& what, iterator from) const
+		{
+			const boost::uint8_t* p = utf8_search(from.base(), last_unit(), what.first_unit(), what.last_unit());
+			return iterator((utf8_unit*)p, (utf8_unit*)last_unit());
+		}
+
+		iterator find(const basic_ustring& what) const
+		{
+			return find(what, begin());
+		}
+
+		iterator find(utf32_unit c) const
+		{
+			basic_ustring what;
+			what.append(c);
+			return find(what, begin());
+		}
+
+		// Find the last occurrence of what. Returns end() if there is none.
+		iterator rfind(const basic_ustring& what) const
+		{
+			const boost::uint8_t* p = utf8_search_last(first_unit(), last_unit(), what.first_unit(), what.last_unit());
+			return iterator((utf8_unit*)p, (utf8_unit*)last_unit());
+		}
+
+		bool contains(const basic_ustring& what) const
+		{
+			return what.empty() || utf8_search(first_unit(), last_unit(), what.first_unit(), what.last_unit()) != last_unit();
+		}
+
+		bool starts_with(const basic_ustring& what) const
+		{
+			return utf8_starts_with(first_unit(), last_unit(), what.first_unit(), what.last_unit());
+		}
+
+		bool ends_with(const basic_ustring& what) const
+		{
+			return utf8_ends_with(first_unit(), last_unit(), what.first_unit(), what.last_unit());
+		}
 
-			return ret;
+		// Index of the character at i, e.g. of a match from find(). This has to count the
+		// characters before i.
+		int position(iterator i) const
+		{
+			return (int)utf8_count(first_unit(), (const boost::uint8_t*)i.base());
 		}
 
 		const utf8_unit* utf8()
@@ -163,48 +235,21 @@ namespace unicode
 		const utf16_unit* utf16()
 		{
 			static std::vector<utf16_unit> buf;
-			buf.clear();
-
-			utf16_unit tmp;
-
-			for(iterator i=begin(); i != end(); ++i)
-			{
-				utf32_unit ch = *i;
-
-				if(ch <= 0xFFFF)
-				{
-//					tmp = (utf16_unit)ch;
-//					buf.append((char*)&ch, 2);
-					buf.push_back((utf16_unit)ch);
-				}
-				else
-				{
-					ch -= 0x0010000UL;
-
-					tmp = (utf16_unit)((ch >> 10) + (utf32_unit)0xD800);
-					buf.push_back(tmp);
-					tmp = (utf16_unit)((ch & 0x3FFUL) + (utf32_unit)0xDC00);
-					buf.push_back(tmp);
-				}
-	
-			}
+			buf.resize(data.size() + 1); // One unit per byte is always enough.
 
-			buf.push_back(0); // Null terminate.
-			return (utf16_unit*)&*buf.begin();
+			utf16_unit* end = (utf16_unit*)utf8_to_utf16(first_unit(), last_unit(), (boost::uint16_t*)&buf[0]);
+			*end = 0; // Null terminate.
+			return &buf[0];
 		}
 
 		const utf32_unit* utf32()
 		{
 			static std::vector<utf32_unit> buf;
-			buf.clear();
-
-			for(iterator i=begin(); i != end(); ++i)
-			{
-				buf.push_back(*i);
-			}
+			buf.resize(data.size() + 1); // One unit per byte is always enough.
 
-			buf.push_back(0); // Null terminate.
-			return (utf32_unit*)&*buf.begin();
+			utf32_unit* end = (utf32_unit*)utf8_to_utf32(first_unit(), last_unit(), (boost::uint32_t*)&buf[0]);
+			*end = 0; // Null terminate.
+			return &buf[0];
 		}
 
 		const char* ascii(char replacement='?')
@@ -241,7 +286,7 @@ namespace unicode
 //				data += (char)(0xC0 | c>>6);
 //				data += (char)(0x80 | c & 0x3F);
 				data.push_back((char)(0xC0 | c>>6));
-				data.push_back((char)(0x80 | c & 0x3F));
+				data.push_back((char)(0x80 | (c & 0x3F)));
 			}
 			else if(c < 0x10000)
 			{
@@ -249,8 +294,8 @@ namespace unicode
 //				data += (char)(0x80 | c>>6 & 0x3F);
 //				data += (char)(0x80 | c & 0x3F);
 				data.push_back((char)(0xE0 | c>>12));
-				data.push_back((char)(0x80 | c>>6 & 0x3F));
-				data.push_back((char)(0x80 | c & 0x3F));
+				data.push_back((char)(0x80 | (c>>6 & 0x3F)));
+				data.push_back((char)(0x80 | (c & 0x3F)));
 			}
 			else if(c < 0x200000)
 			{
@@ -259,9 +304,9 @@ namespace unicode
 //				data += (char)(0x80 | c>>6 & 0x3F);
 //				data += (char)(0x80 | c & 0x3F);
 				data.push_back((char)(0xF0 | c>>18));
-				data.push_back((char)(0x80 | c>>12 & 0x3F));
-				data.push_back((char)(0x80 | c>>6 & 0x3F));
-				data.push_back((char)(0x80 | c & 0x3F));
+				data.push_back((char)(0x80 | (c>>12 & 0x3F)));
+				data.push_back((char)(0x80 | (c>>6 & 0x3F)));
+				data.push_back((char)(0x80 | (c & 0x3F)));
 			}
 
 			++length;
@@ -301,12 +346,20 @@ namespace unicode
 				append(*i);
 		}
 
-		void append(const ustring& str)
+		void append(const basic_ustring& str)
 		{
-			for(unicode::ustring::iterator i=str.begin(); i != str.end(); ++i)
+			for(iterator i=str.begin(); i != str.end(); ++i)
 				append(*i);
 		}
 
+		// Append bytes of UTF-8 at p that are known to be well-formed and to hold count
+		// characters (e.g. a ustring_literal's), without decoding them.
+		void append_utf8(const utf8_unit* p, std::size_t bytes, int count)
+		{
+			data.insert(data.end(), p, p + bytes);
+			length += count;
+		}
+
 		template<class tpl>
 		void assign(tpl& t)
 		{
@@ -330,7 +383,7 @@ namespace unicode
 			data.clear();
 		}
 
-		friend std::ostream& operator<<(std::ostream& os, const ustring s)
+		friend std::ostream& operator<<(std::ostream& os, const basic_ustring& s)
 		{
 			for(iterator i=s.begin(); i != s.end();	++i)
 			{
@@ -340,7 +393,7 @@ namespace unicode
 			return os;
 		}
 
-		friend std::wostream& operator<<(std::wostream& os, ustring& s)
+		friend std::wostream& operator<<(std::wostream& os, basic_ustring& s)
 		{
 			for(iterator i=s.begin(); i != s.end(); ++i)
 			{
@@ -351,6 +404,16 @@ namespace unicode
 		}
 
 	private:
+		const boost::uint8_t* first_unit() const
+		{
+			return data.empty() ? 0 : &data[0];
+		}
+
+		const boost::uint8_t* last_unit() const
+		{
+			return first_unit() + data.size();
+		}
+
 		std::vector<utf8_unit> data; // Raw data buffer. We use UTF-8 for internal encoding.
 		int length; // Number of characters in string.
 	};
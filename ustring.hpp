@@ -26,59 +26,6 @@ namespace unicode
 	private:
 		const char* ptr;
 	};
-
-	class basic_ustring
-	{
-	public:
-		void append()
-		{
-
-		}
-	};
-
-	template<class codec_type>
-	class ustring
-	{
-	protected:
-		codec_type cod;
-		std::stringstream data;
-
-	public:
-		ustring() : cod(&data)
-		{
-		}
-
-		template<class encoder_type>
-		char* c_str()
-		{
-			static std::stringstream buf;
-
-			return ssbuf.str().c_str();
-		}
-
-		boost::int_fast32_t at(int i)
-		{
-			cod->seekg(i, beg);
-		}
-
-		void append(boost::int_fast32_t ch)
-		{
-			cod->encode(ch);
-		}
-
-		void append(std::string& s)
-		{
-			for(std::string::iterator i=s.begin(); i != s.end(); ++i)
-				append(*i);
-		}
-
-/*
-		friend void uistream::get(ustring& s)
-		{
-
-		}
-		*/
-	};
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,150 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_USTRING_LITERAL_HPP
+#define BOOST_UNICODE_USTRING_LITERAL_HPP
+
+#include <cstddef>
+#include <boost/config.hpp>
+#include "unicode.h"
+#include "ustring_view.hpp"
+
+// Encoding at compile time needs loops in constexpr functions (C++14) and U"" literals.
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && !defined(BOOST_NO_CXX11_CHAR32_T) && !defined(BOOST_NO_CXX11_UNICODE_LITERALS)
+#define BOOST_UNICODE_HAS_USTRING_LITERALS
+
+namespace unicode
+{
+	//================================================================================
+	// String constants encoded to UTF-8 by the compiler. A ustring_literal holds the
+	// UTF-8, the number of characters and whether it's all ASCII as constant data, so
+	// making a ustring_view of it costs a pointer and a size, and nothing is encoded
+	// or counted at run time. Declare them with BOOST_UNICODE_LITERAL:
+	//
+	//	BOOST_UNICODE_LITERAL(greeting, "Grüß dich");
+	//	ustring_view v = greeting;
+	//
+	// The text is a narrow or U"" string literal (it's joined to U"", so the compiler
+	// converts it from the source character set). It ends at its first null, and
+	// surrogates are replaced with U+FFFD.
+	//================================================================================
+
+	// Bytes of UTF-8 for c.
+	constexpr std::size_t utf8_literal_size(char32_t c)
+	{
+		return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 || c > 0x10FFFF ? 3 : 4; // Values above U+10FFFF become U+FFFD.
+	}
+
+	// Bytes of UTF-8 for the null terminated s.
+	constexpr std::size_t utf8_literal_bytes(const char32_t* s)
+	{
+		std::size_t ret = 0;
+
+		for(; *s; ++s)
+			ret += utf8_literal_size(*s);
+
+		return ret;
+	}
+
+	template<std::size_t tpl_bytes>
+	class ustring_literal
+	{
+	public:
+		constexpr explicit ustring_literal(const char32_t* s) : units(), length(0), ascii(true)
+		{
+			std::size_t n = 0;
+
+			for(; *s; ++s, ++length)
+			{
+				char32_t c = *s;
+
+				if(c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+					c = 0xFFFD;
+
+				if(c < 0x80)
+				{
+					units[n++] = (utf8_unit)c;
+					continue;
+				}
+
+				ascii = false;
+
+				if(c < 0x800)
+				{
+					units[n++] = (utf8_unit)(0xC0 | c >> 6);
+				}
+				else if(c < 0x10000)
+				{
+					units[n++] = (utf8_unit)(0xE0 | c >> 12);
+					units[n++] = (utf8_unit)(0x80 | (c >> 6 & 0x3F));
+				}
+				else
+				{
+					units[n++] = (utf8_unit)(0xF0 | c >> 18);
+					units[n++] = (utf8_unit)(0x80 | (c >> 12 & 0x3F));
+					units[n++] = (utf8_unit)(0x80 | (c >> 6 & 0x3F));
+				}
+
+				units[n++] = (utf8_unit)(0x80 | (c & 0x3F));
+			}
+		}
+
+		ustring_view view() const
+		{
+			return ustring_view(units, tpl_bytes, length);
+		}
+
+		operator ustring_view() const
+		{
+			return view();
+		}
+
+		// The UTF-8, followed by a null.
+		constexpr const utf8_unit* data() const
+		{
+			return units;
+		}
+
+		const char* c_str() const
+		{
+			return (const char*)units;
+		}
+
+		// Number of characters.
+		constexpr int size() const
+		{
+			return length;
+		}
+
+		constexpr std::size_t bytes() const
+		{
+			return tpl_bytes;
+		}
+
+		constexpr bool empty() const
+		{
+			return !tpl_bytes;
+		}
+
+		constexpr bool is_ascii() const
+		{
+			return ascii;
+		}
+
+	private:
+		utf8_unit units[tpl_bytes + 1];
+		int length;
+		bool ascii;
+	};
+}
+
+// Declare a constant ustring_literal called name holding text, at namespace or
+// function scope.
+#define BOOST_UNICODE_LITERAL(name, text) \
+	static constexpr ::unicode::ustring_literal< ::unicode::utf8_literal_bytes(U"" text)> name(U"" text)
+
+#endif
+
+#endif
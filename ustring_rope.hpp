@@ -0,0 +1,633 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_USTRING_ROPE_HPP
+#define BOOST_UNICODE_USTRING_ROPE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#include "unicode.h"
+#include "utf8_count.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// A string for large documents that are edited, e.g. the text in an editor. The
+	// UTF-8 is kept in pieces of up to max_leaf_bytes at the leaves of a balanced tree,
+	// and every node knows how many bytes, characters and line feeds are under it, so
+	// finding a character or a line, inserting and erasing are all O(log n) however
+	// long the text is.
+	//
+	// Nodes are never changed once made: an edit makes new nodes on the path to the
+	// change and shares the rest. So copying a rope (e.g. to keep a snapshot for undo)
+	// only copies a pointer, and substr() shares the text it covers.
+	//================================================================================
+
+	class ustring_rope
+	{
+		struct node;
+		typedef boost::shared_ptr<const node> node_ptr;
+
+		struct node
+		{
+			node_ptr left, right; // Both null in a leaf.
+			std::vector<utf8_unit> text; // Only in a leaf.
+			std::size_t bytes, chars, lines; // Totals for everything under the node.
+			int height; // 0 for a leaf.
+		};
+
+	public:
+		typedef std::size_t size_type;
+
+		// The most bytes a leaf is made with. Smaller leaves make edits cheaper and
+		// larger ones make the tree smaller.
+		static const size_type max_leaf_bytes = 1024;
+
+		// Iterates over the characters of a rope, which mustn't change while it's used.
+		class iterator
+		{
+		public:
+			iterator() : root(0), leaf(0), offset(0), pos(0)
+			{
+			}
+
+			utf32_unit operator*() const
+			{
+				return utf8_to_utf32(&leaf->text[offset]);
+			}
+
+			bool operator==(const iterator& op) const
+			{
+				return pos == op.pos;
+			}
+
+			bool operator!=(const iterator& op) const
+			{
+				return pos != op.pos;
+			}
+
+			iterator& operator++()
+			{
+				offset += table_extra_bytes[leaf->text[offset]]+1;
+
+				if(offset == leaf->bytes)
+					seek(pos + 1);
+				else
+					++pos;
+
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				iterator tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			iterator& operator--()
+			{
+				if(!offset)
+					seek(pos - 1);
+				else
+				{
+					// All bytes in a character after the first byte are in the range 0x80-0xBF.
+					do
+					{
+						--offset;
+					}
+					while((leaf->text[offset] & 0xC0) == 0x80);
+
+					--pos;
+				}
+
+				return *this;
+			}
+
+			iterator operator--(int)
+			{
+				iterator tmp = *this;
+				--*this;
+				return tmp;
+			}
+
+			// Index of the current character.
+			size_type position() const
+			{
+				return pos;
+			}
+
+		private:
+			friend class ustring_rope;
+
+			iterator(const node* _root, size_type p) : root(_root)
+			{
+				seek(p);
+			}
+
+			// Go to character p, finding its leaf from the root.
+			void seek(size_type p)
+			{
+				pos = p;
+				leaf = 0;
+				offset = 0;
+
+				if(!root || p >= root->chars)
+					return;
+
+				const node* n = root;
+
+				while(n->height)
+				{
+					if(p < n->left->chars)
+						n = n->left.get();
+					else
+					{
+						p -= n->left->chars;
+						n = n->right.get();
+					}
+				}
+
+				leaf = n;
+				offset = utf8_advance(&n->text[0], &n->text[0] + n->bytes, p) - &n->text[0];
+			}
+
+			const node* root;
+			const node* leaf; // The leaf the current character is in, or 0 at the end.
+			size_type offset; // Byte offset of the current character in the leaf.
+			size_type pos; // Index of the current character.
+		};
+
+		ustring_rope()
+		{
+		}
+
+		ustring_rope(const ustring_view& s) : root(build(s.data(), s.data() + s.bytes()))
+		{
+		}
+
+		// Number of characters.
+		size_type size() const
+		{
+			return root ? root->chars : 0;
+		}
+
+		// Number of bytes of UTF-8.
+		size_type bytes() const
+		{
+			return root ? root->bytes : 0;
+		}
+
+		bool empty() const
+		{
+			return !root;
+		}
+
+		// Number of lines, i.e. one more than the number of line feeds.
+		size_type line_count() const
+		{
+			return (root ? root->lines : 0) + 1;
+		}
+
+		iterator begin() const
+		{
+			return iterator(root.get(), 0);
+		}
+
+		iterator end() const
+		{
+			return iterator(root.get(), size());
+		}
+
+		iterator at(size_type pos) const
+		{
+			assert(pos <= size());
+
+			return iterator(root.get(), pos);
+		}
+
+		// Index of the first character of the line'th line (counting from 0).
+		size_type line_start(size_type line) const
+		{
+			assert(line < line_count());
+
+			if(!line)
+				return 0;
+
+			size_type ret = 0;
+			const node* n = root.get();
+
+			// Find the leaf with the line'th line feed in it.
+			while(n->height)
+			{
+				if(line <= n->left->lines)
+					n = n->left.get();
+				else
+				{
+					line -= n->left->lines;
+					ret += n->left->chars;
+					n = n->right.get();
+				}
+			}
+
+			const utf8_unit* p = &n->text[0];
+
+			for(; line; --line)
+				p = (const utf8_unit*)std::memchr(p, '\n', &n->text[0] + n->bytes - p) + 1;
+
+			return ret + utf8_count(&n->text[0], p);
+		}
+
+		// Number of the line character pos is on (counting from 0).
+		size_type line_of(size_type pos) const
+		{
+			assert(pos <= size());
+
+			if(!root)
+				return 0;
+
+			size_type ret = 0;
+			const node* n = root.get();
+
+			while(n->height)
+			{
+				if(pos < n->left->chars)
+					n = n->left.get();
+				else
+				{
+					pos -= n->left->chars;
+					ret += n->left->lines;
+					n = n->right.get();
+				}
+			}
+
+			const utf8_unit* p = utf8_advance(&n->text[0], &n->text[0] + n->bytes, pos);
+			return ret + std::count(&n->text[0], p, '\n');
+		}
+
+		// Insert s before character pos.
+		void insert(size_type pos, const ustring_view& s)
+		{
+			assert(pos <= size());
+
+			if(s.empty())
+				return;
+
+			// Typing usually adds a little text to one leaf, which keeps the shape of the tree.
+			if(root && s.bytes() <= max_leaf_bytes)
+			{
+				node_ptr n = insert_in_leaf(root, pos, s);
+
+				if(n)
+				{
+					root = n;
+					return;
+				}
+			}
+
+			node_ptr a, b;
+			split(root, pos, a, b);
+			root = join(join(a, build(s.data(), s.data() + s.bytes())), b);
+		}
+
+		// Insert (a snapshot of) r before character pos. Nothing is copied.
+		void insert(size_type pos, const ustring_rope& r)
+		{
+			assert(pos <= size());
+
+			node_ptr a, b;
+			split(root, pos, a, b);
+			root = join(join(a, r.root), b);
+		}
+
+		void append(const ustring_view& s)
+		{
+			insert(size(), s);
+		}
+
+		void append(utf32_unit c)
+		{
+			utf8_unit buf[4];
+			insert(size(), ustring_view(buf, utf8_put(c, buf) - buf, 1));
+		}
+
+		// Erase qty characters starting at character pos (or as many as there are).
+		void erase(size_type pos, size_type qty)
+		{
+			assert(pos <= size());
+
+			if(qty > size() - pos)
+				qty = size() - pos;
+
+			if(!qty)
+				return;
+
+			node_ptr n = erase_in_leaf(root, pos, qty);
+
+			if(n)
+			{
+				root = n;
+				return;
+			}
+
+			node_ptr a, b, c;
+			split(root, pos, a, b);
+			split(b, qty, b, c);
+			root = join(a, c);
+		}
+
+		void clear()
+		{
+			root.reset();
+		}
+
+		// qty characters starting at character pos, sharing this rope's text.
+		ustring_rope substr(size_type pos, size_type qty) const
+		{
+			assert(pos <= size());
+
+			ustring_rope ret;
+			node_ptr a, b, c;
+			split(root, pos, a, b);
+			split(b, qty, ret.root, c);
+			return ret;
+		}
+
+		// Call f with a ustring_view of each piece of the text in order, e.g. to write it
+		// out or search it without putting it all together.
+		template<class function_type>
+		void for_each_chunk(function_type f) const
+		{
+			visit(root.get(), f);
+		}
+
+		// Put every character to a Unicode output stream (a uostream, or anything else
+		// with a put() that takes code points), to write the text in another encoding.
+		template<class stream_type>
+		void write(stream_type& os) const
+		{
+			for(iterator i=begin(); i != end(); ++i)
+				os.put(*i);
+		}
+
+		friend std::ostream& operator<<(std::ostream& os, const ustring_rope& s)
+		{
+			// Output the raw UTF-8.
+			s.for_each_chunk(chunk_writer(os));
+			return os;
+		}
+
+	private:
+		struct chunk_writer
+		{
+			std::ostream* os;
+
+			chunk_writer(std::ostream& _os) : os(&_os)
+			{
+			}
+
+			void operator()(const ustring_view& s) const
+			{
+				os->write((const char*)s.data(), s.bytes());
+			}
+		};
+
+		template<class function_type>
+		static void visit(const node* n, function_type& f)
+		{
+			if(!n)
+				return;
+
+			if(!n->height)
+				f(ustring_view(&n->text[0], n->bytes, (int)n->chars));
+			else
+			{
+				visit(n->left.get(), f);
+				visit(n->right.get(), f);
+			}
+		}
+
+		static int height(const node_ptr& n)
+		{
+			return n ? n->height : -1;
+		}
+
+		// A leaf holding text (which is swapped out), or null if it's empty.
+		static node_ptr leaf(std::vector<utf8_unit>& text)
+		{
+			if(text.empty())
+				return node_ptr();
+
+			node* n = new node;
+			node_ptr ret(n);
+
+			n->text.swap(text);
+			n->bytes = n->text.size();
+			n->chars = utf8_count(&n->text[0], &n->text[0] + n->bytes);
+			n->lines = std::count(n->text.begin(), n->text.end(), '\n');
+			n->height = 0;
+			return ret;
+		}
+
+		static node_ptr leaf(const utf8_unit* first, const utf8_unit* last)
+		{
+			std::vector<utf8_unit> text(first, last);
+			return leaf(text);
+		}
+
+		// A node with l on the left and r on the right, or just one of them if the other is null.
+		static node_ptr branch(const node_ptr& l, const node_ptr& r)
+		{
+			if(!l)
+				return r;
+			if(!r)
+				return l;
+
+			node* n = new node;
+			node_ptr ret(n);
+
+			n->left = l;
+			n->right = r;
+			n->bytes = l->bytes + r->bytes;
+			n->chars = l->chars + r->chars;
+			n->lines = l->lines + r->lines;
+			n->height = std::max(l->height, r->height) + 1;
+			return ret;
+		}
+
+		// branch(l, r), rotated if one side is two higher than the other.
+		static node_ptr balance(const node_ptr& l, const node_ptr& r)
+		{
+			if(height(l) > height(r) + 1)
+			{
+				if(height(l->left) >= height(l->right))
+					return branch(l->left, branch(l->right, r));
+
+				return branch(branch(l->left, l->right->left), branch(l->right->right, r));
+			}
+
+			if(height(r) > height(l) + 1)
+			{
+				if(height(r->right) >= height(r->left))
+					return branch(branch(l, r->left), r->right);
+
+				return branch(branch(l, r->left->left), branch(r->left->right, r->right));
+			}
+
+			return branch(l, r);
+		}
+
+		// All of l followed by all of r, balanced.
+		static node_ptr join(const node_ptr& l, const node_ptr& r)
+		{
+			if(!l)
+				return r;
+			if(!r)
+				return l;
+
+			if(height(l) > height(r) + 1)
+				return balance(l->left, join(l->right, r));
+
+			if(height(r) > height(l) + 1)
+				return balance(join(l, r->left), r->right);
+
+			if(!l->height && !r->height && l->bytes + r->bytes <= max_leaf_bytes)
+			{
+				std::vector<utf8_unit> text;
+				text.reserve(l->bytes + r->bytes);
+				text.insert(text.end(), l->text.begin(), l->text.end());
+				text.insert(text.end(), r->text.begin(), r->text.end());
+				return leaf(text);
+			}
+
+			return branch(l, r);
+		}
+
+		// Split n into the first pos characters and the rest.
+		static void split(node_ptr n, size_type pos, node_ptr& a, node_ptr& b)
+		{
+			if(!n || pos >= n->chars)
+			{
+				a = n;
+				b.reset();
+			}
+			else if(!pos)
+			{
+				a.reset();
+				b = n;
+			}
+			else if(!n->height)
+			{
+				const utf8_unit* first = &n->text[0];
+				const utf8_unit* mid = utf8_advance(first, first + n->bytes, pos);
+				a = leaf(first, mid);
+				b = leaf(mid, first + n->bytes);
+			}
+			else if(pos <= n->left->chars)
+			{
+				node_ptr c;
+				split(n->left, pos, a, c);
+				b = join(c, n->right);
+			}
+			else
+			{
+				node_ptr c;
+				split(n->right, pos - n->left->chars, c, b);
+				a = join(n->left, c);
+			}
+		}
+
+		// A balanced tree of [first, last), or null if it's empty.
+		static node_ptr build(const utf8_unit* first, const utf8_unit* last)
+		{
+			if((size_type)(last - first) <= max_leaf_bytes)
+				return leaf(first, last);
+
+			// Split in the middle, at the start of a character.
+			const utf8_unit* mid = first + (last - first) / 2;
+
+			while(mid != last && !utf8_is_lead(*mid))
+				++mid;
+
+			return branch(build(first, mid), build(mid, last));
+		}
+
+		// n with s inserted before character pos, if that fits in the leaf it goes in,
+		// otherwise null.
+		static node_ptr insert_in_leaf(const node_ptr& n, size_type pos, const ustring_view& s)
+		{
+			if(!n->height)
+			{
+				if(n->bytes + s.bytes() > max_leaf_bytes)
+					return node_ptr();
+
+				const utf8_unit* first = &n->text[0];
+				const utf8_unit* mid = utf8_advance(first, first + n->bytes, pos);
+
+				std::vector<utf8_unit> text;
+				text.reserve(n->bytes + s.bytes());
+				text.insert(text.end(), first, mid);
+				text.insert(text.end(), s.data(), s.data() + s.bytes());
+				text.insert(text.end(), mid, first + n->bytes);
+				return leaf(text);
+			}
+
+			if(pos <= n->left->chars)
+			{
+				node_ptr l = insert_in_leaf(n->left, pos, s);
+				return l ? branch(l, n->right) : l;
+			}
+
+			node_ptr r = insert_in_leaf(n->right, pos - n->left->chars, s);
+			return r ? branch(n->left, r) : r;
+		}
+
+		// n with qty characters erased from character pos, if they're all in one leaf
+		// and aren't all of it, otherwise null.
+		static node_ptr erase_in_leaf(const node_ptr& n, size_type pos, size_type qty)
+		{
+			if(!n->height)
+			{
+				if(qty >= n->chars)
+					return node_ptr();
+
+				const utf8_unit* first = &n->text[0];
+				const utf8_unit* b = utf8_advance(first, first + n->bytes, pos);
+				const utf8_unit* e = utf8_advance(b, first + n->bytes, qty);
+
+				std::vector<utf8_unit> text;
+				text.reserve(n->bytes - (e - b));
+				text.insert(text.end(), first, b);
+				text.insert(text.end(), e, first + n->bytes);
+				return leaf(text);
+			}
+
+			if(pos + qty <= n->left->chars)
+			{
+				node_ptr l = erase_in_leaf(n->left, pos, qty);
+				return l ? branch(l, n->right) : l;
+			}
+
+			if(pos >= n->left->chars)
+			{
+				node_ptr r = erase_in_leaf(n->right, pos - n->left->chars, qty);
+				return r ? branch(n->left, r) : r;
+			}
+
+			return node_ptr();
+		}
+
+		node_ptr root; // Null if the rope is empty.
+	};
+}
+
+#endif
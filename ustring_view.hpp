@@ -0,0 +1,376 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_USTRING_VIEW_HPP
+#define BOOST_UNICODE_USTRING_VIEW_HPP
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iostream>
+#include "unicode.h"
+#include "ustring.h"
+#include "utf8_count.hpp"
+#include "utf8_search.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// A non-owning view of UTF-8 data that lives somewhere else: a ustring, a memory
+	// mapped file, a block read from a stream... Copying or slicing a view never
+	// copies the data, so the data must outlive every view of it.
+	//================================================================================
+
+	class ustring_view
+	{
+	public:
+		typedef std::size_t size_type;
+
+		class iterator
+		{
+		public:
+			iterator() : ptr(0), last(0)
+			{
+			}
+
+			iterator(const utf8_unit* p) : ptr(p), last(0)
+			{
+			}
+
+			// An iterator that knows where the view ends can skip whole blocks in operator+.
+			iterator(const utf8_unit* p, const utf8_unit* e) : ptr(p), last(e)
+			{
+			}
+
+			utf32_unit operator*() const
+			{
+				return utf8_to_utf32(ptr);
+			}
+
+			bool operator==(iterator op) const
+			{
+				return (ptr == op.ptr);
+			}
+
+			bool operator!=(iterator op) const
+			{
+				return !(ptr == op.ptr);
+			}
+
+			iterator& operator--()
+			{
+				// All bytes in a character after the first byte are in the range 0x80-0xBF.
+				do
+				{
+					--ptr;
+				}
+				while((*ptr & 0xC0) == 0x80);
+
+				return (*this);
+			}
+
+			iterator operator--(int)
+			{
+				iterator tmp = *this;
+				--*this;
+				return tmp;
+			}
+
+			iterator& operator++()
+			{
+				ptr += table_extra_bytes[*ptr]+1;
+
+				return (*this);
+			}
+
+			iterator operator++(int)
+			{
+				iterator tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			iterator operator+(int op) const
+			{
+				iterator tmp = *this;
+
+				if(last)
+				{
+					std::size_t qty = op;
+					tmp.ptr = utf8_advance(ptr, last, qty);
+					return tmp;
+				}
+
+				while(op--)
+					++tmp;
+
+				return tmp;
+			}
+
+			// Pointer to the first byte of the current character.
+			const utf8_unit* base() const
+			{
+				return ptr;
+			}
+
+		private:
+			const utf8_unit* ptr;
+			const utf8_unit* last; // End of the view, or 0 if unknown.
+		};
+
+		ustring_view() : first(0), last(0), length(0)
+		{
+		}
+
+		// View bytes bytes of UTF-8 at p (e.g. a memory mapped file). If the number of
+		// characters is already known it can be passed as count, otherwise it is counted
+		// the first time size() is called.
+		ustring_view(const utf8_unit* p, size_type bytes, int count=-1) : first(p), last(p+bytes), length(count)
+		{
+		}
+
+		ustring_view(const char* p, size_type bytes, int count=-1) : first((const utf8_unit*)p), last((const utf8_unit*)p+bytes), length(count)
+		{
+		}
+
+		ustring_view(const char* cstr) : first((const utf8_unit*)cstr), last((const utf8_unit*)cstr+std::strlen(cstr)), length(-1)
+		{
+		}
+
+		ustring_view(iterator b, iterator e, int count=-1) : first(b.base()), last(e.base()), length(count)
+		{
+		}
+
+		ustring_view(const std::string& str) : first((const utf8_unit*)str.data()), last((const utf8_unit*)str.data()+str.size()), length(-1)
+		{
+		}
+
+		ustring_view(const std::vector<utf8_unit>& v) : first(v.empty() ? 0 : &v[0]), last(v.empty() ? 0 : &v[0]+v.size()), length(-1)
+		{
+		}
+
+		template<class tpl_enc, class tpl_dec>
+		ustring_view(const basic_ustring<tpl_enc, tpl_dec>& str) : first(str.begin().base()), last(str.end().base()), length(str.size())
+		{
+		}
+
+		iterator begin() const
+		{
+			return iterator(first, last);
+		}
+
+		iterator end() const
+		{
+			return iterator(last, last);
+		}
+
+		iterator at(int pos) const
+		{
+			assert(pos < size());
+
+			std::size_t qty = pos;
+			return iterator(utf8_advance(first, last, qty), last);
+		}
+
+		// Raw UTF-8 data. This is not null terminated.
+		const utf8_unit* data() const
+		{
+			return first;
+		}
+
+		// Number of bytes in the view.
+		size_type bytes() const
+		{
+			return last - first;
+		}
+
+		// Number of characters in the view.
+		int size() const
+		{
+			if(length < 0)
+				length = (int)utf8_count(first, last);
+
+			return length;
+		}
+
+		bool empty() const
+		{
+			return first == last;
+		}
+
+		// A view of the characters in [b, e).
+		ustring_view substr(iterator b, iterator e) const
+		{
+			return ustring_view(b, e);
+		}
+
+		// A view of qty characters starting at character pos. pos may be size(), and the
+		// view stops at the end if fewer than qty characters follow pos.
+		ustring_view substr(int pos, int qty) const
+		{
+			assert(pos >= 0 && pos <= size() && qty >= 0);
+
+			std::size_t n = pos;
+			const utf8_unit* b = utf8_advance(first, last, n);
+			n = qty;
+			const utf8_unit* e = utf8_advance(b, last, n); // n is now the number of characters missing.
+			return ustring_view(iterator(b), iterator(e), qty - (int)n);
+		}
+
+		int compare(const ustring_view& with) const
+		{
+			// Comparing UTF-8 byte by byte orders the same as comparing code points.
+			size_type n = bytes() < with.bytes() ? bytes() : with.bytes();
+			int ret = n ? std::memcmp(first, with.first, n) : 0;
+
+			if(ret < 0)
+				return -1; // Less than
+			else if(ret > 0)
+				return 1; // Greater than
+			else if(bytes() < with.bytes())
+				return -1; // Prefix of with.
+			else if(bytes() > with.bytes())
+				return 1; // with is our prefix.
+
+			return 0; // Equal
+		}
+
+		bool operator ==(const ustring_view& op) const
+		{
+			return bytes() == op.bytes() && compare(op) == 0;
+		}
+
+		bool operator !=(const ustring_view& op) const
+		{
+			return !(*this == op);
+		}
+
+		bool operator <(const ustring_view& op) const
+		{
+			return compare(op) < 0;
+		}
+
+		bool operator >(const ustring_view& op) const
+		{
+			return compare(op) > 0;
+		}
+
+		// Find the first occurrence of what at or after from. Returns end() if there is none.
+		iterator find(const ustring_view& what, iterator from) const
+		{
+			return iterator(utf8_search(from.base(), last, what.first, what.last), last);
+		}
+
+		iterator find(const ustring_view& what) const
+		{
+			return find(what, begin());
+		}
+
+		iterator find(utf32_unit c) const
+		{
+			utf8_unit buf[4];
+			return find(ustring_view(buf, utf8_put(c, buf) - buf, 1));
+		}
+
+		// Find the last occurrence of what. Returns end() if there is none.
+		iterator rfind(const ustring_view& what) const
+		{
+			return iterator(utf8_search_last(first, last, what.first, what.last), last);
+		}
+
+		bool contains(const ustring_view& what) const
+		{
+			return what.empty() || utf8_search(first, last, what.first, what.last) != last;
+		}
+
+		bool starts_with(const ustring_view& what) const
+		{
+			return utf8_starts_with(first, last, what.first, what.last);
+		}
+
+		bool ends_with(const ustring_view& what) const
+		{
+			return utf8_ends_with(first, last, what.first, what.last);
+		}
+
+		// Index of the character at i, e.g. of a match from find(). This has to count the
+		// characters before i.
+		int position(iterator i) const
+		{
+			return (int)utf8_count(first, i.base());
+		}
+
+		// FNV-1a hash of the UTF-8 bytes.
+		std::size_t hash() const
+		{
+			std::size_t h = 2166136261UL;
+
+			for(const utf8_unit* p=first; p != last; ++p)
+			{
+				h ^= *p;
+				h *= 16777619UL;
+			}
+
+			return h;
+		}
+
+		friend std::ostream& operator<<(std::ostream& os, const ustring_view& s)
+		{
+			// Output the raw UTF-8.
+			os.write((const char*)s.first, s.bytes());
+			return os;
+		}
+
+	private:
+		const utf8_unit* first; // First byte of the view.
+		const utf8_unit* last; // One past the last byte of the view.
+		mutable int length; // Number of characters in the view, or -1 if they haven't been counted yet.
+	};
+
+	// So views can be used as keys with boost::hash and unordered containers.
+	inline std::size_t hash_value(const ustring_view& s)
+	{
+		return s.hash();
+	}
+
+	// Read a block of up to buf.size() bytes from is into buf and return a view of the
+	// whole characters in it. A character split by the end of the block is left at the
+	// end of buf, and carried says how many bytes of it there are, so the next call
+	// moves them to the front and the next view starts with the whole character.
+	// carried must be 0 for the first call. Nothing is put back into is, so this works
+	// on pipes and sockets. The view is only valid until buf is reused.
+	inline ustring_view read_view(std::istream& is, std::vector<utf8_unit>& buf, std::size_t& carried)
+	{
+		if(buf.empty())
+			return ustring_view();
+
+		std::size_t kept = carried;
+		if(kept)
+			std::memmove(&buf[0], &buf[buf.size() - kept], kept);
+		carried = 0;
+
+		is.read((char*)&buf[kept], buf.size() - kept);
+		std::streamsize got = kept + is.gcount();
+
+		if(got == (std::streamsize)buf.size())
+		{
+			// Find the start of the last character and check whether all of it made it in.
+			std::streamsize lead = got-1;
+			while(lead > 0 && (buf[lead] & 0xC0) == 0x80)
+				--lead;
+
+			std::streamsize partial = got - lead;
+			if(partial < table_extra_bytes[buf[lead]]+1 && lead > 0)
+			{
+				carried = (std::size_t)partial;
+				got = lead;
+			}
+		}
+
+		return ustring_view(&buf[0], (ustring_view::size_type)got);
+	}
+}
+
+#endif
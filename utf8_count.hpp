@@ -0,0 +1,278 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_UTF8_COUNT_HPP
+#define BOOST_UNICODE_UTF8_COUNT_HPP
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOOST_UNICODE_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace unicode
+{
+	//================================================================================
+	// Counting and skipping UTF-8 characters without decoding them.
+	// Every character has exactly one byte outside of 0x80-0xBF (its first byte), so
+	// counting characters is counting those bytes, which can be done 16 at a time.
+	//================================================================================
+
+	// Is b the first byte of a character (rather than one of the bytes following it)?
+	inline bool utf8_is_lead(boost::uint8_t b)
+	{
+		return (b & 0xC0) != 0x80;
+	}
+
+	inline int utf8_popcount(boost::uint32_t x)
+	{
+		x = x - ((x >> 1) & 0x55555555U);
+		x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+		x = (x + (x >> 4)) & 0x0F0F0F0FU;
+		return (int)((boost::uint32_t)(x * 0x01010101U) >> 24);
+	}
+
+	// Number of characters in a 64 byte block.
+	inline int utf8_count_block64(const boost::uint8_t* p)
+	{
+#ifdef BOOST_UNICODE_HAS_SSE2
+		// Following bytes are 0x80-0xBF, which are exactly the bytes less than -64 when signed.
+		const __m128i limit = _mm_set1_epi8(-65);
+
+		boost::uint32_t lo = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)p), limit))
+			| _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(p+16)), limit)) << 16;
+		boost::uint32_t hi = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(p+32)), limit))
+			| _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(p+48)), limit)) << 16;
+
+		return utf8_popcount(lo) + utf8_popcount(hi);
+#else
+		int ret = 0;
+
+		for(int i=0; i < 64; ++i)
+			ret += utf8_is_lead(p[i]);
+
+		return ret;
+#endif
+	}
+
+	// Count the characters in [first, last).
+	inline std::size_t utf8_count(const boost::uint8_t* first, const boost::uint8_t* last)
+	{
+		std::size_t ret = 0;
+
+#ifdef BOOST_UNICODE_HAS_SSE2
+		const __m128i limit = _mm_set1_epi8(-65);
+		const __m128i zero = _mm_setzero_si128();
+
+		while(last - first >= 16)
+		{
+			// Each byte of sums counts up to 255 blocks before it has to be added to ret.
+			__m128i sums = zero;
+			const boost::uint8_t* stop = first + ((last - first) / 16 > 255 ? 255 : (last - first) / 16) * 16;
+
+			for(; first != stop; first += 16)
+			{
+				// Comparisons produce -1 for true, so subtracting them counts.
+				sums = _mm_sub_epi8(sums, _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)first), limit));
+			}
+
+			sums = _mm_sad_epu8(sums, zero);
+			ret += _mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+		}
+#else
+		for(; last - first >= 64; first += 64)
+			ret += utf8_count_block64(first);
+#endif
+
+		for(; first != last; ++first)
+			ret += utf8_is_lead(*first);
+
+		return ret;
+	}
+
+	// Skip qty characters starting at first, without going past last. Whole 64 byte
+	// blocks are skipped at once while they hold no more than the characters still to
+	// skip. Returns the first byte of the next character (or last), and qty is reduced
+	// by the number of characters skipped, so it is 0 unless last was reached.
+	// If qty is 0, bytes following a character are skipped up to the next character.
+	inline const boost::uint8_t* utf8_advance(const boost::uint8_t* first, const boost::uint8_t* last, std::size_t& qty)
+	{
+		while(last - first >= 64)
+		{
+			std::size_t n = utf8_count_block64(first);
+
+			if(n > qty)
+				break;
+
+			qty -= n;
+			first += 64;
+		}
+
+		for(; first != last; ++first)
+		{
+			if(utf8_is_lead(*first))
+			{
+				if(!qty)
+					break;
+
+				--qty;
+			}
+		}
+
+		return first;
+	}
+
+	//================================================================================
+	// Validating UTF-8 without decoding it.
+	//================================================================================
+
+	// Find the first malformed sequence in [first, last), following table 3-7 of the
+	// Unicode standard (so overlong forms, surrogates and values above U+10FFFF are all
+	// malformed). A sequence that is only cut short by last isn't malformed: its first
+	// byte is stored in tail so checking can carry on from there once more data is
+	// available, otherwise tail is set to last. Returns last if nothing is malformed.
+	inline const boost::uint8_t* utf8_find_invalid(const boost::uint8_t* first, const boost::uint8_t* last, const boost::uint8_t*& tail)
+	{
+		tail = last;
+
+		while(first != last)
+		{
+#ifdef BOOST_UNICODE_HAS_SSE2
+			// Skip ASCII 16 bytes at a time.
+			while(last - first >= 16 && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)first)))
+				first += 16;
+
+			if(first == last)
+				break;
+#endif
+			boost::uint8_t b = *first;
+
+			if(b < 0x80)
+			{
+				++first;
+				continue;
+			}
+
+			// Work out the size of the sequence and the range allowed for its second byte.
+			int len;
+			boost::uint8_t low = 0x80, high = 0xBF;
+
+			if(b < 0xC2)
+				return first; // Following byte, or overlong two byte form.
+			else if(b < 0xE0)
+				len = 2;
+			else if(b < 0xF0)
+			{
+				len = 3;
+
+				if(b == 0xE0)
+					low = 0xA0; // Overlong below that.
+				else if(b == 0xED)
+					high = 0x9F; // Surrogates above that.
+			}
+			else if(b < 0xF5)
+			{
+				len = 4;
+
+				if(b == 0xF0)
+					low = 0x90; // Overlong below that.
+				else if(b == 0xF4)
+					high = 0x8F; // Above U+10FFFF above that.
+			}
+			else
+				return first;
+
+			for(int i=1; i < len; ++i)
+			{
+				if(first + i == last)
+				{
+					tail = first;
+					return last;
+				}
+
+				boost::uint8_t c = first[i];
+
+				if(i == 1 ? (c < low || c > high) : (c & 0xC0) != 0x80)
+					return first;
+			}
+
+			first += len;
+		}
+
+		return last;
+	}
+
+	//================================================================================
+	// Decoding UTF-8 that is known to be well-formed (e.g. a ustring's).
+	//================================================================================
+
+	// Decode the character at p, and move p past it.
+	inline boost::uint32_t utf8_next(const boost::uint8_t*& p)
+	{
+		boost::uint32_t c = *p++;
+
+		if(c < 0x80)
+			return c;
+
+		if(c < 0xE0)
+			return (c & 0x1F) << 6 | (*p++ & 0x3F);
+
+		if(c < 0xF0)
+		{
+			c = (c & 0x0F) << 12 | (p[0] & 0x3F) << 6 | (p[1] & 0x3F);
+			p += 2;
+			return c;
+		}
+
+		c = (c & 0x07) << 18 | (p[0] & 0x3F) << 12 | (p[1] & 0x3F) << 6 | (p[2] & 0x3F);
+		p += 3;
+		return c;
+	}
+
+	// Write c as UTF-8 at out, and return the end of it.
+	inline boost::uint8_t* utf8_put(boost::uint32_t c, boost::uint8_t* out)
+	{
+		if(c < 0x80)
+			*out++ = (boost::uint8_t)c;
+		else if(c < 0x800)
+		{
+			*out++ = (boost::uint8_t)(0xC0 | (c >> 6));
+			*out++ = (boost::uint8_t)(0x80 | (c & 0x3F));
+		}
+		else if(c < 0x10000)
+		{
+			*out++ = (boost::uint8_t)(0xE0 | (c >> 12));
+			*out++ = (boost::uint8_t)(0x80 | ((c >> 6) & 0x3F));
+			*out++ = (boost::uint8_t)(0x80 | (c & 0x3F));
+		}
+		else
+		{
+			*out++ = (boost::uint8_t)(0xF0 | (c >> 18));
+			*out++ = (boost::uint8_t)(0x80 | ((c >> 12) & 0x3F));
+			*out++ = (boost::uint8_t)(0x80 | ((c >> 6) & 0x3F));
+			*out++ = (boost::uint8_t)(0x80 | (c & 0x3F));
+		}
+
+		return out;
+	}
+
+	// How many bytes from p are ASCII, counting 16 at a time (so it's 0 if the next 16
+	// aren't, or there's no SSE2). The legacy encodings' converters copy these as they are.
+	inline std::size_t ascii_run(const boost::uint8_t* p, const boost::uint8_t* last)
+	{
+		const boost::uint8_t* q = p;
+
+#ifdef BOOST_UNICODE_HAS_SSE2
+		while(last - q >= 16 && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)q)))
+			q += 16;
+#endif
+
+		return q - p;
+	}
+}
+
+#endif
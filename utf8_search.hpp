@@ -0,0 +1,269 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_UTF8_SEARCH_HPP
+#define BOOST_UNICODE_UTF8_SEARCH_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <boost/cstdint.hpp>
+#include "utf8_count.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Finding UTF-8 in UTF-8 by comparing bytes. A well-formed needle starts with the
+	// first byte of a character and ends with the last byte of one, so every match in
+	// well-formed text is on character boundaries and nothing has to be decoded.
+	//
+	// Short needles are found by checking 16 places at once for the needle's first and
+	// last bytes, and only comparing the rest where both match. That rarely happens in
+	// real text, but can happen everywhere (e.g. "aaab" in "aaaa..."), so needles longer
+	// than utf8_search_two_way_min bytes use the Two-Way algorithm, which never looks
+	// at a byte of the text more than twice.
+	//================================================================================
+
+	const std::ptrdiff_t utf8_search_two_way_min = 32;
+
+	// Start of the maximal suffix of [x, x+m) in the order a < b (or a > b if reversed),
+	// minus one, and its period.
+	template<class iterator>
+	std::ptrdiff_t two_way_maximal_suffix(iterator x, std::ptrdiff_t m, std::ptrdiff_t& period, bool reversed)
+	{
+		std::ptrdiff_t ms = -1, j = 0, k = 1;
+		period = 1;
+
+		while(j + k < m)
+		{
+			boost::uint8_t a = x[j + k];
+			boost::uint8_t b = x[ms + k];
+
+			if(reversed ? a > b : a < b)
+			{
+				j += k;
+				k = 1;
+				period = j - ms;
+			}
+			else if(a == b)
+			{
+				if(k != period)
+					++k;
+				else
+				{
+					j += period;
+					k = 1;
+				}
+			}
+			else
+			{
+				ms = j++;
+				k = period = 1;
+			}
+		}
+
+		return ms;
+	}
+
+	// First match of [nfirst, nlast) in [first, last) using the Two-Way algorithm
+	// (Crochemore and Perrin), or last if there is none. Works on any random access
+	// iterators, so it can search backwards with reverse iterators.
+	template<class iterator>
+	iterator two_way_search(iterator first, iterator last, iterator nfirst, iterator nlast)
+	{
+		std::ptrdiff_t n = last - first, m = nlast - nfirst;
+
+		if(m > n)
+			return last;
+
+		// Split the needle at its critical position ell+1.
+		std::ptrdiff_t p1, p2;
+		std::ptrdiff_t ms1 = two_way_maximal_suffix(nfirst, m, p1, false);
+		std::ptrdiff_t ms2 = two_way_maximal_suffix(nfirst, m, p2, true);
+		std::ptrdiff_t ell = ms1 > ms2 ? ms1 : ms2;
+		std::ptrdiff_t period = ms1 > ms2 ? p1 : p2;
+
+		std::ptrdiff_t i;
+		for(i=0; i <= ell && nfirst[i] == nfirst[i + period]; ++i)
+			;
+
+		if(i > ell)
+		{
+			// The needle is periodic: after a mismatch in the left part, the part of the
+			// next window that overlaps this one is already known to match.
+			std::ptrdiff_t memory = -1;
+
+			for(std::ptrdiff_t j=0; j <= n - m;)
+			{
+				for(i = (ell > memory ? ell : memory) + 1; i < m && nfirst[i] == first[i + j]; ++i)
+					;
+
+				if(i < m)
+				{
+					j += i - ell;
+					memory = -1;
+					continue;
+				}
+
+				for(i=ell; i > memory && nfirst[i] == first[i + j]; --i)
+					;
+
+				if(i <= memory)
+					return first + j;
+
+				j += period;
+				memory = m - period - 1;
+			}
+		}
+		else
+		{
+			period = (ell + 1 > m - ell - 1 ? ell + 1 : m - ell - 1) + 1;
+
+			for(std::ptrdiff_t j=0; j <= n - m;)
+			{
+				for(i=ell + 1; i < m && nfirst[i] == first[i + j]; ++i)
+					;
+
+				if(i < m)
+				{
+					j += i - ell;
+					continue;
+				}
+
+				for(i=ell; i >= 0 && nfirst[i] == first[i + j]; --i)
+					;
+
+				if(i < 0)
+					return first + j;
+
+				j += period;
+			}
+		}
+
+		return last;
+	}
+
+	// First match of [nfirst, nlast) in [first, last), or last if there is none. An empty
+	// needle matches at first.
+	inline const boost::uint8_t* utf8_search(const boost::uint8_t* first, const boost::uint8_t* last,
+		const boost::uint8_t* nfirst, const boost::uint8_t* nlast)
+	{
+		std::ptrdiff_t m = nlast - nfirst;
+
+		if(m == 0)
+			return first;
+
+		if(m > last - first)
+			return last;
+
+		if(m == 1)
+		{
+			const void* p = std::memchr(first, *nfirst, last - first);
+			return p ? (const boost::uint8_t*)p : last;
+		}
+
+		if(m > utf8_search_two_way_min)
+			return two_way_search(first, last, nfirst, nlast);
+
+		const boost::uint8_t* p = first;
+		const boost::uint8_t* stop = last - m; // The last place a match can start.
+
+#ifdef BOOST_UNICODE_HAS_SSE2
+		const __m128i head = _mm_set1_epi8((char)nfirst[0]);
+		const __m128i tail = _mm_set1_epi8((char)nfirst[m - 1]);
+
+		for(; stop - p >= 15; p += 16)
+		{
+			__m128i a = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), head);
+			__m128i b = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + m - 1)), tail);
+			unsigned mask = _mm_movemask_epi8(_mm_and_si128(a, b));
+
+			for(int bit=0; mask; ++bit, mask >>= 1)
+				if((mask & 1) && !std::memcmp(p + bit + 1, nfirst + 1, m - 2))
+					return p + bit;
+		}
+#endif
+
+		for(; p <= stop; ++p)
+			if(*p == nfirst[0] && p[m - 1] == nfirst[m - 1] && !std::memcmp(p + 1, nfirst + 1, m - 2))
+				return p;
+
+		return last;
+	}
+
+	// Last match of [nfirst, nlast) in [first, last), or last if there is none. An empty
+	// needle matches at last.
+	inline const boost::uint8_t* utf8_search_last(const boost::uint8_t* first, const boost::uint8_t* last,
+		const boost::uint8_t* nfirst, const boost::uint8_t* nlast)
+	{
+		std::ptrdiff_t m = nlast - nfirst;
+
+		if(m == 0)
+			return last;
+
+		if(m > last - first)
+			return last;
+
+		if(m > utf8_search_two_way_min)
+		{
+			typedef std::reverse_iterator<const boost::uint8_t*> reverse;
+			reverse r = two_way_search(reverse(last), reverse(first), reverse(nlast), reverse(nfirst));
+			return r == reverse(first) ? last : r.base() - m;
+		}
+
+		const boost::uint8_t* p = last - m + 1; // One past the last place a match can start.
+
+#ifdef BOOST_UNICODE_HAS_SSE2
+		const __m128i head = _mm_set1_epi8((char)nfirst[0]);
+		const __m128i tail = _mm_set1_epi8((char)nfirst[m - 1]);
+
+		for(; p - first >= 16; p -= 16)
+		{
+			__m128i a = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p - 16)), head);
+			__m128i b = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p - 16 + m - 1)), tail);
+			unsigned mask = _mm_movemask_epi8(_mm_and_si128(a, b));
+
+			while(mask)
+			{
+				int bit = 15;
+
+				while(!(mask >> bit & 1))
+					--bit;
+
+				if(!std::memcmp(p - 16 + bit + 1, nfirst + 1, m > 1 ? m - 2 : 0))
+					return p - 16 + bit;
+
+				mask &= ~(1U << bit);
+			}
+		}
+#endif
+
+		while(p != first)
+		{
+			--p;
+
+			if(*p == nfirst[0] && p[m - 1] == nfirst[m - 1] && !std::memcmp(p + 1, nfirst + 1, m > 1 ? m - 2 : 0))
+				return p;
+		}
+
+		return last;
+	}
+
+	// Does [first, last) start with [nfirst, nlast)?
+	inline bool utf8_starts_with(const boost::uint8_t* first, const boost::uint8_t* last,
+		const boost::uint8_t* nfirst, const boost::uint8_t* nlast)
+	{
+		return nlast - nfirst <= last - first && (nfirst == nlast || !std::memcmp(first, nfirst, nlast - nfirst));
+	}
+
+	// Does [first, last) end with [nfirst, nlast)?
+	inline bool utf8_ends_with(const boost::uint8_t* first, const boost::uint8_t* last,
+		const boost::uint8_t* nfirst, const boost::uint8_t* nlast)
+	{
+		return nlast - nfirst <= last - first && (nfirst == nlast || !std::memcmp(last - (nlast - nfirst), nfirst, nlast - nfirst));
+	}
+}
+
+#endif
@@ -0,0 +1,523 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_UTF_CONVERT_HPP
+#define BOOST_UNICODE_UTF_CONVERT_HPP
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include "utf8_count.hpp"
+#include "cpu_features.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Converting blocks of UTF-8 to and from UTF-16 and UTF-32 in memory. Most of the
+	// time in real text goes on runs of ASCII, which are widened or narrowed a block
+	// at a time by kernels for each CPU tier (see cpu_features.hpp); everything else
+	// is converted a character at a time. Each conversion picks its kernels with
+	// cpu_tier() when it's called.
+	//================================================================================
+
+	//--------------------------------------------------------------------------------
+	// Kernels. Each converts whole blocks of ASCII from p, stopping at the first block
+	// that isn't all ASCII or doesn't fit before last, and returns how many units it
+	// converted. The conversions only try them after a few ASCII characters in a row,
+	// so text that mixes ASCII with other characters isn't slowed down by calls that
+	// convert nothing.
+	//--------------------------------------------------------------------------------
+
+	struct scalar_kernels
+	{
+		static const bool enabled = false; // So the conversions never call these.
+
+		static std::size_t widen16(const boost::uint8_t*, const boost::uint8_t*, boost::uint16_t*)
+		{
+			return 0;
+		}
+
+		static std::size_t widen32(const boost::uint8_t*, const boost::uint8_t*, boost::uint32_t*)
+		{
+			return 0;
+		}
+
+		static std::size_t narrow16(const boost::uint16_t*, const boost::uint16_t*, boost::uint8_t*)
+		{
+			return 0;
+		}
+
+		static std::size_t narrow32(const boost::uint32_t*, const boost::uint32_t*, boost::uint8_t*)
+		{
+			return 0;
+		}
+	};
+
+#ifdef BOOST_UNICODE_HAS_SSE2
+	struct sse2_kernels
+	{
+		static const bool enabled = true;
+
+		static std::size_t widen16(const boost::uint8_t* p, const boost::uint8_t* last, boost::uint16_t* out)
+		{
+			const boost::uint8_t* first = p;
+			const __m128i zero = _mm_setzero_si128();
+
+			for(; last - p >= 16; p += 16, out += 16)
+			{
+				__m128i v = _mm_loadu_si128((const __m128i*)p);
+
+				if(_mm_movemask_epi8(v))
+					break;
+
+				_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(v, zero));
+				_mm_storeu_si128((__m128i*)(out + 8), _mm_unpackhi_epi8(v, zero));
+			}
+
+			return p - first;
+		}
+
+		static std::size_t widen32(const boost::uint8_t* p, const boost::uint8_t* last, boost::uint32_t* out)
+		{
+			const boost::uint8_t* first = p;
+			const __m128i zero = _mm_setzero_si128();
+
+			for(; last - p >= 16; p += 16, out += 16)
+			{
+				__m128i v = _mm_loadu_si128((const __m128i*)p);
+
+				if(_mm_movemask_epi8(v))
+					break;
+
+				__m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+				_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi16(lo, zero));
+				_mm_storeu_si128((__m128i*)(out + 4), _mm_unpackhi_epi16(lo, zero));
+				_mm_storeu_si128((__m128i*)(out + 8), _mm_unpacklo_epi16(hi, zero));
+				_mm_storeu_si128((__m128i*)(out + 12), _mm_unpackhi_epi16(hi, zero));
+			}
+
+			return p - first;
+		}
+
+		static std::size_t narrow16(const boost::uint16_t* p, const boost::uint16_t* last, boost::uint8_t* out)
+		{
+			const boost::uint16_t* first = p;
+			const __m128i high = _mm_set1_epi16((short)0xFF80);
+
+			for(; last - p >= 16; p += 16, out += 16)
+			{
+				__m128i a = _mm_loadu_si128((const __m128i*)p), b = _mm_loadu_si128((const __m128i*)(p + 8));
+
+				if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), high), _mm_setzero_si128())) != 0xFFFF)
+					break;
+
+				_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(a, b));
+			}
+
+			return p - first;
+		}
+
+		static std::size_t narrow32(const boost::uint32_t* p, const boost::uint32_t* last, boost::uint8_t* out)
+		{
+			const boost::uint32_t* first = p;
+			const __m128i high = _mm_set1_epi32((int)0xFFFFFF80);
+
+			for(; last - p >= 16; p += 16, out += 16)
+			{
+				__m128i a = _mm_loadu_si128((const __m128i*)p), b = _mm_loadu_si128((const __m128i*)(p + 4));
+				__m128i c = _mm_loadu_si128((const __m128i*)(p + 8)), d = _mm_loadu_si128((const __m128i*)(p + 12));
+				__m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+
+				if(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, high), _mm_setzero_si128())) != 0xFFFF)
+					break;
+
+				_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+			}
+
+			return p - first;
+		}
+	};
+#endif
+
+#ifdef BOOST_UNICODE_HAS_CPU_DISPATCH
+	struct avx2_kernels
+	{
+		static const bool enabled = true;
+
+		BOOST_UNICODE_TARGET("avx2")
+		static std::size_t widen16(const boost::uint8_t* p, const boost::uint8_t* last, boost::uint16_t* out)
+		{
+			const boost::uint8_t* first = p;
+
+			for(; last - p >= 32; p += 32, out += 32)
+			{
+				__m256i v = _mm256_loadu_si256((const __m256i*)p);
+
+				if(_mm256_movemask_epi8(v))
+					break;
+
+				_mm256_storeu_si256((__m256i*)out, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+				_mm256_storeu_si256((__m256i*)(out + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+			}
+
+			return p - first;
+		}
+
+		BOOST_UNICODE_TARGET("avx2")
+		static std::size_t widen32(const boost::uint8_t* p, const boost::uint8_t* last, boost::uint32_t* out)
+		{
+			const boost::uint8_t* first = p;
+
+			for(; last - p >= 32; p += 32, out += 32)
+			{
+				__m256i v = _mm256_loadu_si256((const __m256i*)p);
+
+				if(_mm256_movemask_epi8(v))
+					break;
+
+				__m128i lo = _mm256_castsi256_si128(v), hi = _mm256_extracti128_si256(v, 1);
+				_mm256_storeu_si256((__m256i*)out, _mm256_cvtepu8_epi32(lo));
+				_mm256_storeu_si256((__m256i*)(out + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+				_mm256_storeu_si256((__m256i*)(out + 16), _mm256_cvtepu8_epi32(hi));
+				_mm256_storeu_si256((__m256i*)(out + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+			}
+
+			return p - first;
+		}
+
+		BOOST_UNICODE_TARGET("avx2")
+		static std::size_t narrow16(const boost::uint16_t* p, const boost::uint16_t* last, boost::uint8_t* out)
+		{
+			const boost::uint16_t* first = p;
+			const __m256i high = _mm256_set1_epi16((short)0xFF80);
+
+			for(; last - p >= 32; p += 32, out += 32)
+			{
+				__m256i a = _mm256_loadu_si256((const __m256i*)p), b = _mm256_loadu_si256((const __m256i*)(p + 16));
+
+				if(!_mm256_testz_si256(_mm256_or_si256(a, b), high))
+					break;
+
+				// Packing works within each 128 bit half, so put the quarters back in order.
+				_mm256_storeu_si256((__m256i*)out, _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+			}
+
+			return p - first;
+		}
+
+		BOOST_UNICODE_TARGET("avx2")
+		static std::size_t narrow32(const boost::uint32_t* p, const boost::uint32_t* last, boost::uint8_t* out)
+		{
+			const boost::uint32_t* first = p;
+			const __m256i high = _mm256_set1_epi32((int)0xFFFFFF80);
+			const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+			for(; last - p >= 32; p += 32, out += 32)
+			{
+				__m256i a = _mm256_loadu_si256((const __m256i*)p), b = _mm256_loadu_si256((const __m256i*)(p + 8));
+				__m256i c = _mm256_loadu_si256((const __m256i*)(p + 16)), d = _mm256_loadu_si256((const __m256i*)(p + 24));
+
+				if(!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), high))
+					break;
+
+				__m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+				_mm256_storeu_si256((__m256i*)out, _mm256_permutevar8x32_epi32(bytes, order));
+			}
+
+			return p - first;
+		}
+	};
+
+	struct avx512_kernels
+	{
+		static const bool enabled = true;
+
+		BOOST_UNICODE_TARGET("avx512f,avx512bw")
+		static std::size_t widen16(const boost::uint8_t* p, const boost::uint8_t* last, boost::uint16_t* out)
+		{
+			const boost::uint8_t* first = p;
+
+			for(; last - p >= 64; p += 64, out += 64)
+			{
+				__m512i v = _mm512_loadu_si512((const void*)p);
+
+				if(_mm512_movepi8_mask(v))
+					break;
+
+				// The halves are loaded again rather than extracted from v, which is as quick
+				// and keeps GCC from warning about the undefined register extracting starts from.
+				_mm512_storeu_si512((void*)out, _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)p)));
+				_mm512_storeu_si512((void*)(out + 32), _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)(p + 32))));
+			}
+
+			return p - first;
+		}
+
+		BOOST_UNICODE_TARGET("avx512f,avx512bw")
+		static std::size_t widen32(const boost::uint8_t* p, const boost::uint8_t* last, boost::uint32_t* out)
+		{
+			const boost::uint8_t* first = p;
+
+			for(; last - p >= 64; p += 64, out += 64)
+			{
+				__m512i v = _mm512_loadu_si512((const void*)p);
+
+				if(_mm512_movepi8_mask(v))
+					break;
+
+				// The same, and maskz so the widening starts from zeros rather than undefined.
+				_mm512_storeu_si512((void*)out, _mm512_maskz_cvtepu8_epi32(0xFFFF, _mm_loadu_si128((const __m128i*)p)));
+				_mm512_storeu_si512((void*)(out + 16), _mm512_maskz_cvtepu8_epi32(0xFFFF, _mm_loadu_si128((const __m128i*)(p + 16))));
+				_mm512_storeu_si512((void*)(out + 32), _mm512_maskz_cvtepu8_epi32(0xFFFF, _mm_loadu_si128((const __m128i*)(p + 32))));
+				_mm512_storeu_si512((void*)(out + 48), _mm512_maskz_cvtepu8_epi32(0xFFFF, _mm_loadu_si128((const __m128i*)(p + 48))));
+			}
+
+			return p - first;
+		}
+
+		BOOST_UNICODE_TARGET("avx512f,avx512bw")
+		static std::size_t narrow16(const boost::uint16_t* p, const boost::uint16_t* last, boost::uint8_t* out)
+		{
+			const boost::uint16_t* first = p;
+			const __m512i high = _mm512_set1_epi16((short)0xFF80);
+
+			for(; last - p >= 64; p += 64, out += 64)
+			{
+				__m512i a = _mm512_loadu_si512((const void*)p), b = _mm512_loadu_si512((const void*)(p + 32));
+
+				if(_mm512_test_epi16_mask(_mm512_or_si512(a, b), high))
+					break;
+
+				// Narrowing straight to memory, which doesn't leave GCC warning about the
+				// undefined upper half of the register _mm512_cvtepi16_epi8() returns.
+				_mm512_mask_cvtepi16_storeu_epi8((void*)out, 0xFFFFFFFF, a);
+				_mm512_mask_cvtepi16_storeu_epi8((void*)(out + 32), 0xFFFFFFFF, b);
+			}
+
+			return p - first;
+		}
+
+		BOOST_UNICODE_TARGET("avx512f,avx512bw")
+		static std::size_t narrow32(const boost::uint32_t* p, const boost::uint32_t* last, boost::uint8_t* out)
+		{
+			const boost::uint32_t* first = p;
+			const __m512i high = _mm512_set1_epi32((int)0xFFFFFF80);
+
+			for(; last - p >= 64; p += 64, out += 64)
+			{
+				__m512i a = _mm512_loadu_si512((const void*)p), b = _mm512_loadu_si512((const void*)(p + 16));
+				__m512i c = _mm512_loadu_si512((const void*)(p + 32)), d = _mm512_loadu_si512((const void*)(p + 48));
+
+				if(_mm512_test_epi32_mask(_mm512_or_si512(_mm512_or_si512(a, b), _mm512_or_si512(c, d)), high))
+					break;
+
+				_mm512_mask_cvtepi32_storeu_epi8((void*)out, 0xFFFF, a);
+				_mm512_mask_cvtepi32_storeu_epi8((void*)(out + 16), 0xFFFF, b);
+				_mm512_mask_cvtepi32_storeu_epi8((void*)(out + 32), 0xFFFF, c);
+				_mm512_mask_cvtepi32_storeu_epi8((void*)(out + 48), 0xFFFF, d);
+			}
+
+			return p - first;
+		}
+	};
+#endif
+
+	//--------------------------------------------------------------------------------
+	// The conversions, for a given set of kernels.
+	//--------------------------------------------------------------------------------
+
+	template<class kernels>
+	boost::uint16_t* utf8_to_utf16_with(const boost::uint8_t* first, const boost::uint8_t* last, boost::uint16_t* out)
+	{
+		int ascii = 0; // ASCII characters in a row.
+
+		while(first != last)
+		{
+			if(kernels::enabled && ascii >= 8)
+			{
+				std::size_t n = kernels::widen16(first, last, out);
+				first += n;
+				out += n;
+				ascii = 0;
+				continue;
+			}
+
+			boost::uint32_t ch = utf8_next(first);
+			ascii = ch < 0x80 ? ascii + 1 : 0;
+
+			if(ch <= 0xFFFF)
+			{
+				*out++ = (boost::uint16_t)ch;
+			}
+			else
+			{
+				ch -= 0x10000;
+				*out++ = (boost::uint16_t)((ch >> 10) + 0xD800);
+				*out++ = (boost::uint16_t)((ch & 0x3FF) + 0xDC00);
+			}
+		}
+
+		return out;
+	}
+
+	template<class kernels>
+	boost::uint32_t* utf8_to_utf32_with(const boost::uint8_t* first, const boost::uint8_t* last, boost::uint32_t* out)
+	{
+		int ascii = 0; // ASCII characters in a row.
+
+		while(first != last)
+		{
+			if(kernels::enabled && ascii >= 8)
+			{
+				std::size_t n = kernels::widen32(first, last, out);
+				first += n;
+				out += n;
+				ascii = 0;
+				continue;
+			}
+
+			boost::uint32_t ch = utf8_next(first);
+			ascii = ch < 0x80 ? ascii + 1 : 0;
+			*out++ = ch;
+		}
+
+		return out;
+	}
+
+	template<class kernels>
+	boost::uint8_t* utf16_to_utf8_with(const boost::uint16_t* first, const boost::uint16_t* last, boost::uint8_t* out)
+	{
+		int ascii = 0; // ASCII characters in a row.
+
+		while(first != last)
+		{
+			if(kernels::enabled && ascii >= 8)
+			{
+				std::size_t n = kernels::narrow16(first, last, out);
+				first += n;
+				out += n;
+				ascii = 0;
+				continue;
+			}
+
+			boost::uint32_t ch = *first++;
+			ascii = ch < 0x80 ? ascii + 1 : 0;
+
+			if((ch & 0xF800) == 0xD800) // If ch is a surrogate...
+			{
+				if(ch <= 0xDBFF && first != last && (*first & 0xFC00) == 0xDC00)
+					ch = ((ch - 0xD800) << 10) + (*first++ - 0xDC00) + 0x10000;
+				else
+					ch = 0xFFFD;
+			}
+
+			out = utf8_put(ch, out);
+		}
+
+		return out;
+	}
+
+	template<class kernels>
+	boost::uint8_t* utf32_to_utf8_with(const boost::uint32_t* first, const boost::uint32_t* last, boost::uint8_t* out)
+	{
+		int ascii = 0; // ASCII characters in a row.
+
+		while(first != last)
+		{
+			if(kernels::enabled && ascii >= 8)
+			{
+				std::size_t n = kernels::narrow32(first, last, out);
+				first += n;
+				out += n;
+				ascii = 0;
+				continue;
+			}
+
+			boost::uint32_t ch = *first++;
+			ascii = ch < 0x80 ? ascii + 1 : 0;
+
+			if(ch > 0x10FFFF || (ch & 0xFFFFF800) == 0xD800)
+				ch = 0xFFFD;
+
+			out = utf8_put(ch, out);
+		}
+
+		return out;
+	}
+
+	//--------------------------------------------------------------------------------
+	// The conversions, using the kernels for cpu_tier().
+	//--------------------------------------------------------------------------------
+
+	// Convert well-formed UTF-8 [first, last) to UTF-16 at out, which needs room for one
+	// unit per byte of input. Returns the end of the output.
+	inline boost::uint16_t* utf8_to_utf16(const boost::uint8_t* first, const boost::uint8_t* last, boost::uint16_t* out)
+	{
+		switch(cpu_tier())
+		{
+#ifdef BOOST_UNICODE_HAS_CPU_DISPATCH
+		case cpu_tier_avx512: return utf8_to_utf16_with<avx512_kernels>(first, last, out);
+		case cpu_tier_avx2: return utf8_to_utf16_with<avx2_kernels>(first, last, out);
+#endif
+#ifdef BOOST_UNICODE_HAS_SSE2
+		case cpu_tier_sse2: return utf8_to_utf16_with<sse2_kernels>(first, last, out);
+#endif
+		default: return utf8_to_utf16_with<scalar_kernels>(first, last, out);
+		}
+	}
+
+	// Convert well-formed UTF-8 [first, last) to UTF-32 at out, which needs room for one
+	// unit per byte of input. Returns the end of the output.
+	inline boost::uint32_t* utf8_to_utf32(const boost::uint8_t* first, const boost::uint8_t* last, boost::uint32_t* out)
+	{
+		switch(cpu_tier())
+		{
+#ifdef BOOST_UNICODE_HAS_CPU_DISPATCH
+		case cpu_tier_avx512: return utf8_to_utf32_with<avx512_kernels>(first, last, out);
+		case cpu_tier_avx2: return utf8_to_utf32_with<avx2_kernels>(first, last, out);
+#endif
+#ifdef BOOST_UNICODE_HAS_SSE2
+		case cpu_tier_sse2: return utf8_to_utf32_with<sse2_kernels>(first, last, out);
+#endif
+		default: return utf8_to_utf32_with<scalar_kernels>(first, last, out);
+		}
+	}
+
+	// Convert UTF-16 [first, last) to UTF-8 at out, which needs room for 3 bytes per
+	// unit of input. Unpaired surrogates become U+FFFD. Returns the end of the output.
+	inline boost::uint8_t* utf16_to_utf8(const boost::uint16_t* first, const boost::uint16_t* last, boost::uint8_t* out)
+	{
+		switch(cpu_tier())
+		{
+#ifdef BOOST_UNICODE_HAS_CPU_DISPATCH
+		case cpu_tier_avx512: return utf16_to_utf8_with<avx512_kernels>(first, last, out);
+		case cpu_tier_avx2: return utf16_to_utf8_with<avx2_kernels>(first, last, out);
+#endif
+#ifdef BOOST_UNICODE_HAS_SSE2
+		case cpu_tier_sse2: return utf16_to_utf8_with<sse2_kernels>(first, last, out);
+#endif
+		default: return utf16_to_utf8_with<scalar_kernels>(first, last, out);
+		}
+	}
+
+	// Convert UTF-32 [first, last) to UTF-8 at out, which needs room for 4 bytes per
+	// unit of input. Surrogates and values above U+10FFFF become U+FFFD. Returns the
+	// end of the output.
+	inline boost::uint8_t* utf32_to_utf8(const boost::uint32_t* first, const boost::uint32_t* last, boost::uint8_t* out)
+	{
+		switch(cpu_tier())
+		{
+#ifdef BOOST_UNICODE_HAS_CPU_DISPATCH
+		case cpu_tier_avx512: return utf32_to_utf8_with<avx512_kernels>(first, last, out);
+		case cpu_tier_avx2: return utf32_to_utf8_with<avx2_kernels>(first, last, out);
+#endif
+#ifdef BOOST_UNICODE_HAS_SSE2
+		case cpu_tier_sse2: return utf32_to_utf8_with<sse2_kernels>(first, last, out);
+#endif
+		default: return utf32_to_utf8_with<scalar_kernels>(first, last, out);
+		}
+	}
+}
+
+#endif
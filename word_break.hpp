@@ -0,0 +1,377 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNICODE_WORD_BREAK_HPP
+#define BOOST_UNICODE_WORD_BREAK_HPP
+
+#include <cstddef>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "word_break_tables.hpp"
+#include "break_source.hpp"
+#include "properties.hpp"
+#include "ustring_view.hpp"
+
+namespace unicode
+{
+	//================================================================================
+	// Word boundaries (see UAX #29, http://www.unicode.org/reports/tr29/). Text is cut
+	// into words, runs of spaces, and single punctuation marks and symbols, so e.g.
+	// "can't stop, 3.14" is "can't", " ", "stop", ",", " " and "3.14". Letters, digits
+	// and underscores never have a boundary between them, so runs of them in ASCII are
+	// skipped 16 bytes at a time without looking anything up.
+	//================================================================================
+
+	inline bool is_ahletter(int wb)
+	{
+		return wb == wb_aletter || wb == wb_hebrew_letter;
+	}
+
+	inline bool is_mid_num_let_q(int wb)
+	{
+		return wb == wb_mid_num_let || wb == wb_single_quote;
+	}
+
+	// Characters that rule WB4 attaches to the one before them.
+	inline bool is_word_extend(int wb)
+	{
+		return wb == wb_extend || wb == wb_format || wb == wb_zwj;
+	}
+
+	// Word_Break of the nth character after the next one in src, skipping the ones that
+	// WB4 attaches to the one before, or -1 at the end.
+	template<class source_type>
+	int peek_word_break(source_type& src, std::size_t n)
+	{
+		for(;;)
+		{
+			boost::int_fast32_t c = src.peek(n++);
+
+			if(c < 0)
+				return -1;
+
+			int wb = word_break_property(c) & ~word_break_data<>::pictographic_flag;
+
+			if(!is_word_extend(wb))
+				return wb;
+		}
+	}
+
+	// Is there no word boundary before a character with Word_Break next, after ones with
+	// prev and before_prev (WB5 to WB16)? ri is the number of regional indicators in a
+	// row up to prev.
+	template<class source_type>
+	bool word_continues(int before_prev, int prev, int next, int ri, source_type& src)
+	{
+		if(is_ahletter(prev))
+		{
+			if(is_ahletter(next) || next == wb_numeric || next == wb_extend_num_let)
+				return true; // WB5, WB9, WB13a
+
+			if((next == wb_mid_letter || is_mid_num_let_q(next)) && is_ahletter(peek_word_break(src, 1)))
+				return true; // WB6
+
+			if(prev == wb_hebrew_letter && (next == wb_single_quote
+				|| (next == wb_double_quote && peek_word_break(src, 1) == wb_hebrew_letter)))
+				return true; // WB7a, WB7b
+		}
+		else if(prev == wb_numeric)
+		{
+			if(next == wb_numeric || is_ahletter(next) || next == wb_extend_num_let)
+				return true; // WB8, WB10, WB13a
+
+			if((next == wb_mid_num || is_mid_num_let_q(next)) && peek_word_break(src, 1) == wb_numeric)
+				return true; // WB12
+		}
+		else if(prev == wb_mid_letter || is_mid_num_let_q(prev))
+		{
+			if(is_ahletter(before_prev) && is_ahletter(next))
+				return true; // WB7
+
+			if(prev != wb_mid_letter && before_prev == wb_numeric && next == wb_numeric)
+				return true; // WB11
+		}
+		else if(prev == wb_mid_num)
+		{
+			if(before_prev == wb_numeric && next == wb_numeric)
+				return true; // WB11
+		}
+		else if(prev == wb_double_quote)
+		{
+			if(before_prev == wb_hebrew_letter && next == wb_hebrew_letter)
+				return true; // WB7c
+		}
+		else if(prev == wb_katakana)
+		{
+			if(next == wb_katakana || next == wb_extend_num_let)
+				return true; // WB13, WB13a
+		}
+		else if(prev == wb_extend_num_let)
+		{
+			if(is_ahletter(next) || next == wb_numeric || next == wb_katakana || next == wb_extend_num_let)
+				return true; // WB13a, WB13b
+		}
+		else if(prev == wb_regional_indicator)
+		{
+			if(next == wb_regional_indicator && ri % 2)
+				return true; // WB15, WB16
+		}
+
+		return false; // WB999
+	}
+
+	// Take the characters of one segment from src: everything up to the next word boundary.
+	template<class source_type>
+	void take_word(source_type& src)
+	{
+		const int pictographic = word_break_data<>::pictographic_flag;
+
+		boost::int_fast32_t c = src.peek(0);
+
+		if(c < 0)
+			return;
+
+		src.take();
+		int raw = word_break_property(c); // The character just taken, with the pictographic flag.
+		int prev = raw & ~pictographic; // The last one that wasn't attached to the one before it by WB4.
+		int before_prev = -1; // The one before that.
+		int ri = prev == wb_regional_indicator;
+
+		if(prev == wb_cr)
+		{
+			if(src.peek(0) == '\n')
+				src.take(); // WB3
+
+			return; // WB3a
+		}
+
+		if(prev == wb_lf || prev == wb_newline)
+			return; // WB3a
+
+		for(;;)
+		{
+			if(prev == wb_aletter || prev == wb_hebrew_letter || prev == wb_numeric || prev == wb_extend_num_let)
+			{
+				boost::uint32_t b = 0, l = 0;
+				std::size_t n = src.skip_ascii_word(b, l);
+
+				if(n)
+				{
+					before_prev = n > 1 ? word_break_property(b) : prev;
+					prev = raw = word_break_property(l);
+					ri = 0;
+				}
+			}
+
+			c = src.peek(0);
+
+			if(c < 0)
+				return; // WB2
+
+			int next_raw = word_break_property(c);
+			int next = next_raw & ~pictographic;
+
+			if(next == wb_cr || next == wb_lf || next == wb_newline)
+				return; // WB3b
+
+			if((raw & ~pictographic) == wb_zwj && (next_raw & pictographic))
+				; // WB3c
+			else if(raw == wb_wseg_space && next == wb_wseg_space)
+				; // WB3d
+			else if(is_word_extend(next))
+			{
+				// WB4: the character belongs to the one before, and otherwise doesn't count.
+				src.take();
+				raw = next_raw;
+				continue;
+			}
+			else if(!word_continues(before_prev, prev, next, ri, src))
+				return;
+
+			src.take();
+			raw = next_raw;
+			before_prev = prev;
+			prev = next;
+			ri = next == wb_regional_indicator ? ri + 1 : 0;
+		}
+	}
+
+	// The end of the segment that starts at p, in well-formed UTF-8.
+	inline const boost::uint8_t* next_word_boundary(const boost::uint8_t* p, const boost::uint8_t* last)
+	{
+		// Most ASCII segments can be found without looking anything up: a run of letters,
+		// digits and underscores, a run of spaces or a single other character, followed
+		// by ASCII that can't join it. Anything else goes the long way.
+		if(p != last && *p < 0x80 && *p != '\r')
+		{
+			const boost::uint8_t* q = p + 1;
+
+			if(is_ascii_word(*p))
+			{
+				q = skip_ascii_word(q, last);
+
+				if(q == last || (*q < 0x80 && *q != '\'' && *q != '.' && *q != ':' && *q != ',' && *q != ';'))
+					return q;
+			}
+			else if(*p == ' ')
+			{
+				while(q != last && *q == ' ')
+					++q;
+
+				if(q == last || *q < 0x80)
+					return q;
+			}
+			else if(q == last || *q < 0x80)
+				return q;
+		}
+
+		utf8_break_source src(p, last);
+		take_word(src);
+		return src.position();
+	}
+
+	// Is the segment [first, last) a word, i.e. does it have a letter or number in it
+	// (rather than being spaces, punctuation or symbols)?
+	inline bool is_word(const boost::uint8_t* first, const boost::uint8_t* last)
+	{
+		while(first != last)
+		{
+			if(*first < 0x80)
+			{
+				if(is_ascii_word(*first++))
+					return true;
+
+				continue;
+			}
+
+			boost::uint32_t cp = utf8_next(first);
+
+			if(is_letter(cp) || is_number(cp))
+				return true;
+		}
+
+		return false;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Iterating over the segments of UTF-8 in memory (a basic_ustring or ustring_view).
+	// Only forwards: finding a boundary going backwards can mean going back to the start.
+	//--------------------------------------------------------------------------------
+
+	class word_iterator
+	{
+	public:
+		word_iterator() : last(0), ptr(0), next(0)
+		{
+		}
+
+		// An iterator at p (which has to be a word boundary) in text that ends at _last.
+		word_iterator(const boost::uint8_t* _last, const boost::uint8_t* p) : last(_last), ptr(p), next(0)
+		{
+		}
+
+		bool operator==(const word_iterator& op) const
+		{
+			return ptr == op.ptr;
+		}
+
+		bool operator!=(const word_iterator& op) const
+		{
+			return ptr != op.ptr;
+		}
+
+		word_iterator& operator++()
+		{
+			ptr = end_of_segment();
+			next = 0;
+			return *this;
+		}
+
+		word_iterator operator++(int)
+		{
+			word_iterator tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		// First byte of the segment.
+		const boost::uint8_t* base() const
+		{
+			return ptr;
+		}
+
+		// One past the last byte of the segment.
+		const boost::uint8_t* end_of_segment() const
+		{
+			if(!next)
+				next = next_word_boundary(ptr, last);
+
+			return next;
+		}
+
+		// Number of bytes in the segment.
+		std::size_t bytes() const
+		{
+			return end_of_segment() - ptr;
+		}
+
+		// Is the segment a word (rather than spaces, punctuation or symbols)?
+		bool is_word() const
+		{
+			return unicode::is_word(ptr, end_of_segment());
+		}
+
+	private:
+		const boost::uint8_t* last;
+		const boost::uint8_t* ptr; // Start of the current segment.
+		mutable const boost::uint8_t* next; // End of the current segment, or 0 if it hasn't been found yet.
+	};
+
+	// Iterators over the words, runs of spaces and punctuation marks of s (a basic_ustring
+	// converts to a view, and the iterators point into its data).
+	inline word_iterator word_begin(const ustring_view& s)
+	{
+		return word_iterator(s.data() + s.bytes(), s.data());
+	}
+
+	inline word_iterator word_end(const ustring_view& s)
+	{
+		return word_iterator(s.data() + s.bytes(), s.data() + s.bytes());
+	}
+
+	// A view of the segment at w.
+	inline ustring_view segment_view(const word_iterator& w)
+	{
+		return ustring_view(w.base(), w.bytes());
+	}
+
+	//--------------------------------------------------------------------------------
+	// Reading segments from a Unicode input stream (a uistream, or anything else with a
+	// get() that returns code points and EOF at the end).
+	//--------------------------------------------------------------------------------
+
+	template<class stream_type>
+	class word_reader
+	{
+	public:
+		word_reader(stream_type* s) : src(s)
+		{
+		}
+
+		// Read the next segment into segment (replacing what was there). Returns false at the end.
+		bool next(std::vector<boost::uint32_t>& segment)
+		{
+			segment.clear();
+			src.output(&segment);
+			take_word(src);
+			return !segment.empty();
+		}
+
+	private:
+		stream_break_source<stream_type> src;
+	};
+}
+
+#endif
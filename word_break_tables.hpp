@@ -0,0 +1,764 @@
+// (c) Copyright Emery De Nuccio 2007
+// Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tables for word boundaries (see word_break.hpp).
+// Generated by tools/ucdgen.py from the Unicode Character Database 14.0.0. Don't edit.
+// Tables: 13745 bytes.
+
+#ifndef BOOST_UNICODE_WORD_BREAK_TABLES_HPP
+#define BOOST_UNICODE_WORD_BREAK_TABLES_HPP
+
+#include <boost/cstdint.hpp>
+
+namespace unicode
+{
+	enum word_break
+	{
+		wb_other, // Other
+		wb_cr, // CR
+		wb_lf, // LF
+		wb_newline, // Newline
+		wb_extend, // Extend
+		wb_zwj, // ZWJ
+		wb_regional_indicator, // Regional Indicator
+		wb_format, // Format
+		wb_katakana, // Katakana
+		wb_hebrew_letter, // Hebrew Letter
+		wb_aletter, // ALetter
+		wb_single_quote, // Single Quote
+		wb_double_quote, // Double Quote
+		wb_mid_num_let, // Mid Num Let
+		wb_mid_letter, // Mid Letter
+		wb_mid_num, // Mid Num
+		wb_numeric, // Numeric
+		wb_extend_num_let, // Extend Num Let
+		wb_wseg_space // WSeg Space
+	};
+
+	// The tables are static members of a class template so that they're only
+	// stored once however many translation units include this.
+	template<class T=void>
+	struct word_break_data
+	{
+		static const int pictographic_flag = 32;
+		static const boost::uint8_t word_break_property_stage1[1793];
+		static const boost::uint16_t word_break_property_stage2[2656];
+		static const boost::uint8_t word_break_property_stage3[6640];
+	};
+
+	template<class T> const boost::uint8_t word_break_data<T>::word_break_property_stage1[1793] = {
+		0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+		16,17,18,19,20,21,22,23,24,25,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		27,27,28,29,30,31,27,27,27,27,27,27,27,27,27,27,
+		27,27,27,27,27,27,27,27,27,27,27,32,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,33,34,35,
+		36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,
+		27,52,53,26,26,26,26,54,27,27,55,26,26,26,26,26,
+		26,26,27,56,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,27,57,26,58,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,59,60,26,26,26,26,26,61,26,
+		26,26,26,26,26,26,26,62,63,64,65,66,26,67,26,68,
+		69,70,26,71,72,26,26,73,74,75,76,77,78,79,80,81,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+		82
+	};
+
+	template<class T> const boost::uint16_t word_break_data<T>::word_break_property_stage2[2656] = {
+		0,1,2,3,4,5,4,6,7,1,8,9,10,11,10,11,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,12,10,10,
+		13,13,13,13,13,13,13,14,15,10,16,10,10,10,10,17,
+		10,10,10,10,10,10,10,10,18,10,10,10,10,10,10,10,
+		10,10,10,4,10,19,10,10,20,21,13,22,23,24,25,26,
+		27,28,10,10,29,13,30,31,10,10,10,10,10,32,33,34,
+		35,36,10,13,37,10,10,10,10,10,38,39,40,10,29,41,
+		10,42,43,1,10,44,6,10,45,46,10,10,47,13,48,13,
+		49,10,10,50,13,51,52,4,53,54,55,56,57,58,52,59,
+		60,54,55,61,62,63,64,65,66,16,55,67,68,69,52,70,
+		71,54,55,67,72,73,52,74,75,76,77,78,79,80,64,1,
+		81,82,55,83,84,85,52,1,86,82,55,87,84,88,52,89,
+		90,82,10,91,92,93,52,94,95,96,10,97,98,99,64,100,
+		1,1,1,101,102,103,1,1,1,1,1,104,105,103,1,1,
+		69,106,103,107,108,10,109,21,110,111,13,112,113,1,1,1,
+		1,1,114,115,103,116,117,118,119,120,10,10,121,10,10,122,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,123,124,10,10,123,10,10,125,126,11,10,10,
+		10,126,10,10,10,127,1,1,10,1,10,10,10,10,10,128,
+		4,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,129,10,130,6,10,10,10,10,131,132,
+		10,133,10,134,10,135,136,137,1,1,1,138,13,139,103,1,
+		140,103,10,10,10,10,10,132,141,10,142,10,10,10,10,143,
+		10,144,145,145,64,1,1,1,1,1,1,1,1,103,1,1,
+		10,146,1,1,1,147,13,148,103,103,1,13,115,1,1,1,
+		149,10,10,150,151,103,114,152,153,10,154,40,10,10,38,152,
+		10,10,150,155,156,40,10,157,132,10,10,158,1,159,160,161,
+		10,10,10,10,10,10,10,10,10,10,10,10,13,13,13,13,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,128,10,10,128,162,10,157,10,10,10,163,164,165,109,164,
+		166,167,168,169,170,171,172,173,1,109,1,1,1,13,13,174,
+		175,176,177,178,179,1,10,10,132,180,181,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,182,183,1,1,1,1,1,183,1,1,1,184,1,185,186,
+		1,1,1,1,1,1,1,1,1,1,1,187,188,10,189,1,
+		1,1,1,1,1,1,1,1,1,1,182,190,191,1,1,192,
+		193,194,195,195,195,195,195,195,196,195,195,195,195,195,195,195,
+		197,198,199,200,201,202,203,1,1,204,205,206,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,207,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		204,208,1,1,1,209,1,1,1,1,1,1,1,1,1,1,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,210,211,
+		10,10,121,10,10,10,212,213,10,214,215,215,215,215,13,13,
+		1,1,216,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		217,1,218,219,1,1,1,1,1,220,221,221,221,221,221,222,
+		223,10,10,4,10,10,10,10,144,1,10,10,1,1,1,221,
+		1,1,1,1,1,1,1,1,1,224,1,1,1,221,221,225,
+		221,221,221,221,221,226,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,109,1,1,1,1,10,10,157,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		109,10,227,1,10,10,228,229,10,230,10,10,10,10,10,231,
+		232,10,10,10,10,10,10,10,10,10,10,10,6,233,1,234,
+		235,10,236,1,10,10,10,237,238,10,10,150,239,103,13,240,
+		40,10,241,10,242,152,10,109,49,10,10,243,244,103,245,103,
+		10,10,246,247,248,103,1,249,1,1,1,250,251,1,29,252,
+		253,254,215,10,10,10,189,10,10,10,10,10,10,10,255,103,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,237,10,256,10,10,257,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		214,258,259,260,261,10,10,10,10,10,10,262,1,263,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,157,1,10,10,10,10,234,10,10,264,1,1,257,
+		13,265,13,266,267,268,1,269,10,10,10,10,10,10,10,270,
+		271,3,4,5,4,6,272,221,221,273,10,144,274,275,1,276,
+		277,10,11,278,157,157,1,1,10,10,10,10,10,10,10,6,
+		1,1,1,1,10,10,10,279,1,1,1,1,1,1,1,280,
+		1,1,1,1,1,1,1,1,10,109,10,10,10,69,174,1,
+		10,10,281,10,6,10,10,282,10,157,10,10,283,284,1,1,
+		10,10,10,10,10,10,10,10,10,157,103,10,10,283,10,257,
+		10,10,264,10,10,10,237,122,122,285,16,286,1,1,1,1,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,214,10,143,264,1,17,10,10,287,1,1,1,1,
+		288,10,10,289,10,143,10,214,10,144,1,1,1,1,10,290,
+		10,143,10,189,1,1,1,1,10,10,10,12,1,1,1,1,
+		291,292,10,293,1,1,10,109,10,109,1,1,108,10,294,1,
+		10,10,10,143,10,143,10,295,10,262,1,1,1,1,1,1,
+		10,10,10,10,132,1,1,1,10,10,10,295,10,10,10,295,
+		10,10,296,103,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,10,10,297,262,1,1,1,1,
+		10,109,298,10,38,174,1,10,299,1,1,10,279,1,10,214,
+		153,10,10,300,247,1,64,301,153,10,10,302,303,10,132,103,
+		153,10,242,304,305,10,10,306,153,10,10,243,307,308,1,1,
+		10,16,309,310,1,1,1,1,311,312,132,10,10,228,313,103,
+		314,54,55,315,72,316,317,318,1,1,1,1,1,1,1,1,
+		10,10,10,319,320,321,262,1,10,10,10,13,322,103,1,1,
+		1,1,1,1,1,1,1,1,10,10,228,323,174,324,1,1,
+		10,10,10,13,325,103,1,1,10,10,29,326,103,1,1,1,
+		1,327,145,103,1,1,1,1,1,1,1,1,1,1,1,1,
+		10,10,309,313,1,1,1,1,1,1,10,10,10,10,103,216,
+		328,329,10,330,331,103,1,1,1,1,332,10,10,333,334,1,
+		335,10,10,336,337,338,10,10,47,339,1,10,10,10,10,132,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		55,10,228,340,69,103,1,234,10,341,111,247,1,1,1,1,
+		342,10,10,343,344,103,345,10,346,347,103,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,10,348,
+		1,1,1,1,1,1,1,1,1,1,1,69,1,1,1,1,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,189,1,1,1,1,1,1,
+		10,10,10,10,10,10,144,1,10,10,10,10,10,10,10,10,
+		10,10,10,10,237,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,10,10,10,10,10,10,69,
+		10,10,144,349,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		10,10,10,10,214,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		10,10,10,132,10,144,103,10,10,10,10,144,103,10,157,318,
+		10,10,10,247,237,103,263,350,10,1,1,1,1,1,1,1,
+		1,1,1,1,10,10,10,10,1,1,1,1,1,1,1,1,
+		10,10,10,10,351,352,13,13,353,153,1,1,1,1,354,231,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,355,
+		356,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,357,1,1,1,358,1,1,1,1,1,1,1,1,1,
+		10,10,10,10,10,10,6,109,132,359,360,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		13,13,361,13,247,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,362,363,364,1,365,1,1,1,1,1,
+		1,1,1,1,366,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		10,10,10,10,10,269,10,10,10,136,367,368,369,10,10,10,
+		370,371,10,372,373,82,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,374,10,82,122,10,122,
+		10,269,10,269,144,10,144,10,55,10,55,10,375,376,376,376,
+		13,13,13,377,13,13,112,245,378,114,21,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		10,144,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		340,379,380,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		10,10,109,381,382,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,10,383,1,10,10,309,103,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,384,144,
+		10,10,10,10,10,10,10,10,10,10,10,10,279,247,1,1,
+		10,10,10,10,385,103,1,1,1,1,1,1,1,1,1,1,
+		369,10,386,387,388,389,390,391,392,257,393,257,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+		394,1,184,10,189,10,395,396,397,398,394,195,195,195,399,400,
+		401,402,184,403,185,195,195,195,195,195,195,195,195,195,195,195,
+		195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,404,
+		195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+		195,195,195,405,406,195,195,195,195,195,195,195,195,195,195,195,
+		195,195,195,195,195,1,1,1,195,195,195,195,195,195,195,195,
+		1,1,1,1,1,1,1,407,1,1,1,1,1,408,195,195,
+		409,1,1,1,410,411,1,1,410,1,412,195,195,195,195,195,
+		409,195,195,413,193,195,195,195,195,195,195,195,195,195,195,195,
+		195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,103,
+		195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+		195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+		195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+		195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,405,
+		414,1,13,13,13,13,13,13,1,1,1,1,1,1,1,1,
+		13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,1
+	};
+
+	template<class T> const boost::uint8_t word_break_data<T>::word_break_property_stage3[6640] = {
+		0,0,0,0,0,0,0,0,0,0,2,3,3,1,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		18,0,12,0,0,0,0,11,0,0,0,0,15,0,13,0,
+		16,16,16,16,16,16,16,16,16,16,14,15,0,0,0,0,
+		0,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,0,0,0,0,17,
+		10,10,10,10,10,10,10,10,10,10,10,0,0,0,0,0,
+		0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,32,10,0,0,7,32,0,
+		0,0,0,0,0,10,0,14,0,0,10,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,0,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,0,0,0,0,0,0,10,10,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		10,10,10,10,10,0,10,10,0,0,10,10,10,10,15,10,
+		0,0,0,0,0,0,10,14,10,10,10,0,10,0,10,10,
+		10,10,0,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,0,10,10,10,10,10,10,10,10,10,
+		10,10,0,4,4,4,4,4,4,4,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,0,0,10,10,10,10,0,10,14,
+		10,10,10,10,10,10,10,10,10,15,10,0,0,0,0,0,
+		0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,0,4,
+		0,4,4,0,4,4,0,4,0,0,0,0,0,0,0,0,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,0,0,0,0,9,
+		9,9,9,10,14,0,0,0,0,0,0,0,0,0,0,0,
+		7,7,7,7,7,7,0,0,0,0,0,0,15,15,0,0,
+		4,4,4,4,4,4,4,4,4,4,4,0,7,0,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,4,4,4,4,4,
+		16,16,16,16,16,16,16,16,16,16,0,16,15,0,10,10,
+		4,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,0,10,4,4,4,4,4,4,4,7,0,4,
+		4,4,4,4,4,10,10,4,4,0,4,4,4,4,10,10,
+		16,16,16,16,16,16,16,16,16,16,10,10,10,0,0,10,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
+		10,4,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		4,4,4,4,4,4,4,4,4,4,4,0,0,10,10,10,
+		10,10,10,10,10,10,4,4,4,4,4,4,4,4,4,4,
+		4,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		16,16,16,16,16,16,16,16,16,16,10,10,10,10,10,10,
+		4,4,4,4,10,10,0,0,15,0,10,0,0,4,0,0,
+		10,10,10,10,10,10,4,4,4,4,10,4,4,4,4,4,
+		4,4,4,4,10,4,4,4,10,4,4,4,4,4,0,0,
+		10,10,10,10,10,10,10,10,10,4,4,4,0,0,0,0,
+		10,10,10,10,10,10,10,10,0,10,10,10,10,10,10,0,
+		7,7,0,0,0,0,0,0,4,4,4,4,4,4,4,4,
+		10,10,10,10,10,10,10,10,10,10,4,4,4,4,4,4,
+		4,4,7,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,4,4,4,10,4,4,
+		10,4,4,4,4,4,4,4,10,10,10,10,10,10,10,10,
+		10,10,4,4,0,0,16,16,16,16,16,16,16,16,16,16,
+		10,4,4,4,0,10,10,10,10,10,10,10,10,0,0,10,
+		10,0,0,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,0,10,10,10,10,10,10,
+		10,0,10,0,0,0,10,10,10,10,0,0,4,10,4,4,
+		4,4,4,4,4,0,0,4,4,0,0,4,4,4,10,0,
+		0,0,0,0,0,0,0,4,0,0,0,0,10,10,0,10,
+		10,10,0,0,0,0,0,0,0,0,0,0,10,0,4,0,
+		0,4,4,4,0,10,10,10,10,10,10,0,0,0,0,10,
+		10,0,10,10,0,10,10,0,10,10,0,0,4,0,4,4,
+		4,4,4,0,0,0,0,4,4,0,0,4,4,4,0,0,
+		0,4,0,0,0,0,0,0,0,10,10,10,10,0,10,0,
+		0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,
+		4,4,10,10,10,4,0,0,0,0,0,0,0,0,0,0,
+		0,4,4,4,0,10,10,10,10,10,10,10,10,10,0,10,
+		10,0,10,10,0,10,10,10,10,10,0,0,4,10,4,4,
+		4,4,4,4,4,4,0,4,4,4,0,4,4,4,0,0,
+		10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,10,4,4,4,4,4,4,
+		0,4,4,4,0,10,10,10,10,10,10,10,10,0,0,10,
+		4,4,4,4,4,0,0,4,4,0,0,4,4,4,0,0,
+		0,0,0,0,0,4,4,4,0,0,0,0,10,10,0,10,
+		0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,4,10,0,10,10,10,10,10,10,0,0,0,10,10,
+		10,0,10,10,10,10,0,0,0,10,10,0,10,0,10,10,
+		0,0,0,10,10,0,0,0,10,10,10,0,0,0,10,10,
+		10,10,10,10,10,10,10,10,10,10,0,0,0,0,4,4,
+		4,4,4,0,0,0,4,4,4,0,4,4,4,4,0,0,
+		10,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,
+		4,4,4,4,4,10,10,10,10,10,10,10,10,0,10,10,
+		10,0,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,0,0,4,10,4,4,
+		4,4,4,4,4,0,4,4,4,0,4,4,4,4,0,0,
+		0,0,0,0,0,4,4,0,10,10,10,0,0,10,0,0,
+		10,4,4,4,0,10,10,10,10,10,10,10,10,0,10,10,
+		10,10,10,10,0,10,10,10,10,10,0,0,4,10,4,4,
+		0,0,0,0,0,4,4,0,0,0,0,0,0,10,10,0,
+		0,10,10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,4,10,10,10,10,10,10,10,10,10,0,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,4,4,10,4,4,
+		4,4,4,4,4,0,4,4,4,0,4,4,4,4,10,0,
+		0,0,0,0,10,10,10,4,0,0,0,0,0,0,0,10,
+		0,0,0,0,0,0,0,0,0,0,10,10,10,10,10,10,
+		0,4,4,4,0,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,0,0,0,10,10,10,10,10,10,
+		10,10,0,10,10,10,10,10,10,10,10,10,0,10,0,0,
+		10,10,10,10,10,10,10,0,0,0,4,0,0,0,0,4,
+		4,4,4,4,4,0,4,0,4,4,4,4,4,4,4,4,
+		0,0,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,4,0,0,4,4,4,4,4,4,4,0,0,0,0,0,
+		0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,0,
+		16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,
+		0,4,0,0,4,4,4,4,4,4,4,4,4,0,0,0,
+		0,0,0,0,0,0,0,0,4,4,4,4,4,4,0,0,
+		0,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,
+		0,0,0,0,0,4,0,4,0,4,0,0,0,0,4,4,
+		10,10,10,10,10,10,10,10,0,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,0,0,0,
+		4,4,4,4,4,0,4,4,10,10,10,10,10,4,4,4,
+		4,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,0,
+		0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,0,
+		0,0,0,0,0,0,4,4,4,4,0,0,0,0,4,4,
+		4,0,4,4,4,0,0,4,4,4,4,4,4,4,0,0,
+		0,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,4,4,4,4,4,4,4,4,4,4,4,4,0,4,
+		16,16,16,16,16,16,16,16,16,16,4,4,4,4,0,0,
+		10,10,10,10,10,10,0,10,0,0,0,0,0,10,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,0,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,0,10,10,10,10,0,0,
+		10,10,10,10,10,10,10,0,10,0,10,10,10,10,0,0,
+		10,0,10,10,10,10,0,0,10,10,10,10,10,10,10,0,
+		10,0,10,10,10,10,0,0,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,0,0,4,4,4,
+		10,10,10,10,10,10,0,0,10,10,10,10,10,10,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,0,0,10,
+		18,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,0,0,0,10,10,
+		10,10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,
+		10,10,4,4,4,4,0,0,0,0,0,0,0,0,0,10,
+		10,10,4,4,4,0,0,0,0,0,0,0,0,0,0,0,
+		10,10,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,0,10,10,
+		10,0,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,0,0,0,0,0,0,0,0,0,4,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,4,4,4,7,4,
+		10,10,10,10,10,4,4,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,4,10,0,0,0,0,0,
+		10,10,10,10,10,10,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,0,
+		4,4,4,4,4,4,4,4,4,4,4,4,0,0,0,0,
+		10,10,10,10,10,10,10,4,4,4,4,4,0,0,0,0,
+		0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,0,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,4,
+		4,4,4,4,4,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,10,10,10,10,10,10,10,10,0,0,0,
+		4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,4,4,4,4,4,4,4,4,4,4,4,4,4,10,10,
+		4,4,4,4,4,4,4,4,0,0,0,0,0,0,0,0,
+		16,16,16,16,16,16,16,16,16,16,0,0,0,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,0,0,10,10,10,
+		4,4,4,0,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,4,10,10,10,10,4,10,10,
+		10,10,10,10,4,10,10,4,4,4,10,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,0,10,0,10,0,10,0,10,
+		10,10,10,10,10,0,10,10,10,10,10,10,10,0,10,0,
+		0,0,10,10,10,0,10,10,10,10,10,10,10,0,0,0,
+		10,10,10,10,0,0,10,10,10,10,10,10,0,0,0,0,
+		18,18,18,18,18,18,18,0,18,18,18,0,4,5,7,7,
+		0,0,0,0,0,0,0,0,13,13,0,0,0,0,0,0,
+		0,0,0,0,13,0,0,14,3,3,7,7,7,7,7,17,
+		0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,17,
+		17,0,0,0,15,0,0,0,0,32,0,0,0,0,0,0,
+		0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,18,
+		7,7,7,7,7,0,7,7,7,7,7,7,7,7,7,7,
+		0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,10,
+		4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,10,0,0,0,0,10,0,0,10,10,10,10,10,10,
+		10,10,10,10,0,10,0,0,0,10,10,10,10,10,0,0,
+		0,0,32,0,10,0,10,0,10,0,10,10,10,10,0,10,
+		10,10,10,10,10,10,10,10,10,42,0,0,10,10,10,10,
+		0,0,0,0,0,10,10,10,10,10,0,0,0,0,10,0,
+		0,0,0,0,32,32,32,32,32,32,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,32,32,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,32,32,0,0,0,0,
+		0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,
+		0,0,0,0,0,0,0,0,0,32,32,32,32,32,32,32,
+		32,32,32,32,0,0,0,0,32,32,32,0,0,0,0,0,
+		0,0,0,0,0,0,10,10,10,10,10,10,10,10,10,10,
+		10,10,42,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,0,0,0,0,0,0,
+		0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,
+		32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,32,32,32,32,0,
+		32,32,32,32,32,32,0,32,32,32,32,32,32,32,32,32,
+		32,32,32,0,32,32,32,32,32,32,32,32,32,32,32,32,
+		32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+		32,32,32,32,32,32,0,0,0,0,0,0,0,0,0,0,
+		32,32,32,32,32,32,0,0,32,32,32,32,32,32,32,32,
+		32,32,32,0,32,0,32,0,0,0,0,0,0,32,0,0,
+		0,32,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+		0,0,0,32,32,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,32,0,0,32,0,0,0,0,32,0,32,0,
+		0,0,0,32,32,32,0,32,0,0,0,0,0,0,0,0,
+		0,0,0,32,32,32,32,32,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,32,32,32,0,0,0,0,0,0,0,0,
+		0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,
+		0,0,0,0,32,32,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,32,32,0,0,0,
+		32,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,0,0,0,0,0,0,10,10,10,10,4,
+		4,4,10,10,0,0,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,10,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,
+		10,10,10,10,10,10,10,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,0,10,10,10,10,10,10,10,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,
+		18,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,4,4,4,4,4,4,
+		32,8,8,8,8,8,0,0,0,0,0,10,10,32,0,0,
+		0,0,0,0,0,0,0,0,0,4,4,8,8,0,0,0,
+		8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+		8,8,8,8,8,8,8,8,8,8,8,0,8,8,8,8,
+		0,0,0,0,0,10,10,10,10,10,10,10,10,10,10,10,
+		0,0,0,0,0,0,0,32,0,32,0,0,0,0,0,0,
+		8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,0,
+		8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,0,
+		16,16,16,16,16,16,16,16,16,16,10,10,0,0,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,4,
+		4,4,4,0,4,4,4,4,4,4,4,4,4,4,0,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,4,4,
+		4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,10,10,10,10,10,10,10,10,
+		10,10,0,10,0,10,10,10,10,10,0,0,0,0,0,0,
+		0,0,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,4,10,10,10,4,10,10,10,10,4,10,10,10,10,
+		10,10,10,4,4,4,4,4,0,0,0,0,4,0,0,0,
+		10,10,10,10,0,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		4,4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,
+		4,4,10,10,10,10,10,10,0,0,0,10,0,10,10,4,
+		10,10,10,10,10,10,4,4,4,4,4,4,4,4,0,0,
+		10,10,10,10,10,10,10,4,4,4,4,4,4,4,4,4,
+		10,10,10,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,
+		0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,10,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,0,0,0,0,0,0,0,0,0,
+		10,10,10,4,10,10,10,10,10,10,10,10,4,4,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,4,4,4,0,0,
+		4,0,4,4,4,0,0,4,4,0,0,0,0,0,4,4,
+		0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,10,10,10,4,4,0,0,0,0,0,0,0,0,0,
+		0,10,10,10,10,10,10,0,0,10,10,10,10,10,10,0,
+		0,10,10,10,10,10,10,0,0,0,0,0,0,0,0,0,
+		10,10,10,4,4,4,4,4,4,4,4,0,4,4,0,0,
+		10,10,10,10,10,10,10,0,0,0,0,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,0,0,0,0,
+		0,0,0,10,10,10,10,10,0,0,0,0,0,9,4,9,
+		9,9,9,9,9,9,9,9,9,0,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,0,9,9,9,9,9,0,9,0,
+		9,9,0,9,9,0,9,9,9,9,9,9,9,9,9,9,
+		10,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,10,10,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,0,
+		15,0,0,14,15,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,17,17,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,17,17,17,
+		15,0,13,0,15,14,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,0,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,0,0,7,
+		0,0,0,0,0,0,0,13,0,0,0,0,15,0,13,0,
+		0,0,0,0,0,0,8,8,8,8,8,8,8,8,8,8,
+		8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,
+		0,0,10,10,10,10,10,10,0,0,10,10,10,10,10,10,
+		0,0,10,10,10,10,10,10,0,0,10,10,10,0,0,0,
+		0,0,0,0,0,0,0,0,0,7,7,7,0,0,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,10,0,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,0,10,10,0,10,
+		10,10,10,10,10,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,10,10,10,
+		10,10,10,10,10,10,4,4,4,4,4,0,0,0,0,0,
+		10,10,10,10,0,0,0,0,10,10,10,10,10,10,10,10,
+		0,10,10,10,10,10,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,0,10,10,0,10,10,10,10,10,10,10,10,10,
+		10,10,0,10,10,10,10,10,10,10,0,10,10,0,0,0,
+		10,0,10,10,10,10,10,10,10,10,10,0,0,0,0,0,
+		10,10,10,10,10,10,0,0,10,0,10,10,10,10,10,10,
+		10,10,10,10,10,10,0,10,10,0,0,0,10,0,0,10,
+		10,10,10,0,10,10,0,0,0,0,0,0,0,0,0,0,
+		10,4,4,4,0,4,4,0,0,0,0,0,4,4,4,4,
+		10,10,10,10,0,10,10,10,0,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,0,0,4,4,4,0,0,0,0,4,
+		10,10,10,10,10,4,4,0,0,0,0,0,0,0,0,0,
+		10,10,10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,4,4,4,4,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,10,10,0,4,4,0,0,0,
+		0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,
+		10,10,4,4,4,4,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,4,4,4,4,4,4,4,4,
+		4,10,10,4,4,10,0,0,0,0,0,0,0,0,0,4,
+		4,4,4,4,4,4,4,4,4,4,4,0,0,7,0,0,
+		0,0,4,0,0,0,0,0,0,0,0,0,0,7,0,0,
+		4,4,4,4,4,0,16,16,16,16,16,16,16,16,16,16,
+		0,0,0,0,10,4,4,10,0,0,0,0,0,0,0,0,
+		10,10,10,4,0,0,10,0,0,0,0,0,0,0,0,0,
+		4,10,10,10,10,0,0,0,0,4,4,4,4,0,4,4,
+		16,16,16,16,16,16,16,16,16,16,10,0,10,0,0,0,
+		10,10,10,10,10,10,10,10,10,10,10,10,4,4,4,4,
+		4,4,4,4,4,4,4,4,0,0,0,0,0,0,4,0,
+		10,10,10,10,10,10,10,0,10,0,10,10,10,10,0,10,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,0,10,
+		4,4,4,4,4,4,4,4,4,4,4,0,0,0,0,0,
+		4,4,4,4,0,10,10,10,10,10,10,10,10,0,0,10,
+		10,0,10,10,0,10,10,10,10,10,0,4,4,10,4,4,
+		10,0,0,0,0,0,0,4,0,0,0,0,0,10,10,10,
+		10,10,4,4,0,0,4,4,4,4,4,4,4,0,0,0,
+		4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,10,10,10,10,0,0,0,0,0,
+		16,16,16,16,16,16,16,16,16,16,0,0,0,0,4,10,
+		4,4,4,4,10,10,0,10,0,0,0,0,0,0,0,0,
+		4,4,4,4,4,4,0,0,4,4,4,4,4,4,4,4,
+		0,0,0,0,0,0,0,0,10,10,10,10,4,4,0,0,
+		4,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,4,4,4,4,4,10,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,4,
+		10,10,10,10,10,10,10,0,0,10,0,0,10,10,10,10,
+		10,10,10,10,0,10,10,0,10,10,10,10,10,10,10,10,
+		4,4,4,4,4,4,0,4,4,0,0,4,4,4,4,10,
+		4,10,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,0,0,10,10,10,10,10,10,
+		10,4,4,4,4,4,4,4,0,0,4,4,4,4,4,4,
+		4,10,0,10,4,0,0,0,0,0,0,0,0,0,0,0,
+		10,4,4,4,4,4,4,4,4,4,4,10,10,10,10,10,
+		10,10,10,4,4,4,4,4,4,4,10,4,4,4,4,0,
+		0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,
+		10,4,4,4,4,4,4,4,4,4,4,4,10,10,10,10,
+		4,4,4,4,4,4,4,4,4,4,0,0,0,10,0,0,
+		4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,4,
+		0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		10,10,10,10,10,10,10,0,10,10,0,10,10,10,10,10,
+		10,4,4,4,4,4,4,0,0,0,4,0,4,4,0,4,
+		4,4,4,4,4,4,10,4,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,0,10,10,0,10,10,10,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,4,4,4,4,4,0,
+		4,4,0,4,4,4,4,4,10,0,0,0,0,0,0,0,
+		10,10,10,4,4,4,4,0,0,0,0,0,0,0,0,0,
+		7,7,7,7,7,7,7,7,7,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,0,0,0,0,0,10,10,10,
+		10,10,10,10,10,10,10,10,10,10,10,0,0,0,0,4,
+		10,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+		4,4,4,4,4,4,4,4,0,0,0,0,0,0,0,4,
+		10,10,0,10,4,0,0,0,0,0,0,0,0,0,0,0,
+		8,8,8,8,0,8,8,8,8,8,8,8,0,8,8,0,
+		8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		8,8,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,8,8,8,8,0,0,0,0,0,0,0,0,
+		10,10,10,10,10,10,10,10,10,10,0,0,0,4,4,0,
+		7,7,7,7,0,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,
+		0,0,0,0,0,4,4,4,4,4,0,0,0,4,4,4,
+		4,4,4,7,7,7,7,7,7,7,7,4,4,4,4,4,
+		4,4,4,0,0,4,4,4,4,4,4,4,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,4,4,4,4,0,0,
+		0,0,4,4,4,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,10,0,0,10,10,0,0,10,10,10,10,0,10,10,
+		10,10,10,10,10,10,10,10,10,10,0,10,0,10,10,10,
+		10,10,10,10,0,10,10,10,10,10,10,10,10,10,10,10,
+		10,10,10,10,10,10,0,10,10,10,10,0,0,10,10,10,
+		10,10,10,10,10,0,10,10,10,10,10,10,10,0,10,10,
+		10,10,10,10,10,10,10,10,10,10,0,10,10,10,10,0,
+		10,10,10,10,10,0,10,0,0,0,10,10,10,10,10,10,
+		10,10,10,10,10,10,0,0,10,10,10,10,10,10,10,10,
+		10,10,10,0,10,10,10,10,10,10,10,10,0,0,16,16,
+		16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+		4,4,4,4,4,4,4,0,0,0,0,4,4,4,4,4,
+		0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
+		4,4,4,4,4,4,4,4,4,0,0,4,4,4,4,4,
+		4,4,0,4,4,0,4,4,4,4,4,0,0,0,0,0,
+		4,4,4,4,4,4,4,10,10,10,10,10,10,10,0,0,
+		16,16,16,16,16,16,16,16,16,16,0,0,0,0,10,0,
+		10,10,10,10,10,10,10,10,10,10,10,10,10,10,4,0,
+		10,10,10,10,10,10,10,0,10,10,10,10,0,10,10,0,
+		10,10,10,10,4,4,4,4,4,4,4,10,0,0,0,0,
+		0,10,10,0,10,0,0,10,0,10,10,10,10,10,10,10,
+		10,10,10,0,10,10,10,10,0,10,0,10,0,0,0,0,
+		0,0,10,0,0,0,0,10,0,10,0,10,0,10,10,10,
+		0,10,10,0,10,0,0,10,0,10,0,10,0,10,0,10,
+		0,10,10,0,10,0,0,10,10,10,10,0,10,10,10,10,
+		10,10,10,0,10,10,10,10,0,10,10,10,10,0,10,0,
+		10,10,10,10,10,10,10,10,10,10,0,10,10,10,10,10,
+		0,10,10,10,0,10,10,10,10,10,0,10,10,10,10,10,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,32,32,32,
+		10,10,10,10,10,10,10,10,10,10,0,0,32,32,32,32,
+		42,42,10,10,10,10,10,10,10,10,10,10,10,10,42,42,
+		10,10,10,10,10,10,10,10,10,10,0,0,0,0,32,0,
+		0,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,
+		32,32,32,32,32,32,6,6,6,6,6,6,6,6,6,6,
+		6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+		0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+		0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,
+		0,0,32,32,32,32,32,32,32,32,32,0,32,32,32,32,
+		32,32,32,32,32,32,32,32,32,32,32,4,4,4,4,4,
+		32,32,32,32,32,32,32,32,32,32,32,32,32,32,0,0,
+		0,0,0,0,0,0,32,32,32,32,32,32,32,32,32,32,
+		0,0,0,0,32,32,32,32,32,32,32,32,32,32,32,32,
+		0,0,0,0,0,32,32,32,32,32,32,32,32,32,32,32,
+		0,0,0,0,0,0,0,0,0,0,0,0,32,32,32,32,
+		0,0,0,0,0,0,0,0,32,32,32,32,32,32,32,32,
+		0,0,0,0,0,0,0,0,0,0,32,32,32,32,32,32,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,32,
+		32,32,32,32,32,32,32,32,32,32,32,0,32,32,32,32,
+		0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+	};
+
+	// Word_Break of a character, with pictographic_flag if it's extended pictographic.
+	inline boost::uint8_t word_break_property(boost::uint32_t cp)
+	{
+		if(cp >= 0xE0200) // Everything from here on has the same value.
+			return 0;
+
+		return word_break_data<>::word_break_property_stage3[(word_break_data<>::word_break_property_stage2[(word_break_data<>::word_break_property_stage1[cp >> 9] << 5) + ((cp >> 4) & 0x1F)] << 4) + (cp & 0xF)];
+	}
+}
+
+#endif